@@ -0,0 +1,167 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Minimal WAV / AIFF(-C) decoder for one-shot samples. Mixes down to mono float. Not for the audio thread.
+namespace AudioFile {
+
+    static constexpr double MAX_SECONDS = 30.0;  // Longer files are truncated.
+    static constexpr double MIN_RATE = 1.0;      // Sample rates outside [MIN_RATE, MAX_RATE] Hz are refused.
+    static constexpr double MAX_RATE = 1e6;
+
+    namespace detail {
+        inline uint32_t le32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+        inline uint16_t le16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+        inline uint32_t be32(const uint8_t* p) { return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+        inline uint16_t be16(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+        // 80-bit IEEE extended (AIFF sample rate) to double.
+        inline double extended80(const uint8_t* p) {
+            int exponent = ((p[0] & 0x7f) << 8) | p[1];
+            uint64_t mantissa = 0;
+            for (int i = 0; i < 8; i++)
+                mantissa = (mantissa << 8) | p[2 + i];
+            if (exponent == 0 && mantissa == 0)
+                return 0.0;
+            double value = std::ldexp((double)mantissa, exponent - 16383 - 63);
+            return (p[0] & 0x80) ? -value : value;
+        }
+
+        // One sample of 8..32-bit integer or 32/64-bit float PCM to [-1, 1].
+        inline float decodeSample(const uint8_t* p, int bits, bool isFloat, bool bigEndian) {
+            uint8_t b[8];
+            int bytes = bits / 8;
+            for (int i = 0; i < bytes; i++)
+                b[i] = bigEndian ? p[bytes - 1 - i] : p[i];  // To little-endian.
+
+            if (isFloat) {
+                if (bits == 32) { float f; std::memcpy(&f, b, 4); return f; }
+                double d; std::memcpy(&d, b, 8); return (float)d;
+            }
+            switch (bits) {
+                case 8: return bigEndian ? (int8_t)b[0] / 128.f : (b[0] - 128) / 128.f;  // WAV 8-bit is unsigned.
+                case 16: return (int16_t)(b[0] | (b[1] << 8)) / 32768.f;
+                case 24: return (int32_t)(((uint32_t)b[0] << 8) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 24)) / 2147483648.f;
+                case 32: return (int32_t)(b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24)) / 2147483648.f;
+            }
+            return 0.f;
+        }
+
+        // Offset of the chunk after the one at pos (chunks are word aligned), or 0 when its length runs past
+        // the end of the file.
+        inline size_t nextChunk(size_t pos, size_t len, size_t size) {
+            if (len > size - pos - 8)
+                return 0;
+            return pos + 8 + len + (len & 1);
+        }
+
+        inline bool decodeFrames(const uint8_t* data, size_t bytes, int channels, int bits, bool isFloat, bool bigEndian,
+                                 double sampleRate, std::vector<float>& out) {
+            bool supported = isFloat ? (bits == 32 || bits == 64) : (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+            if (!supported || channels < 1 || !(sampleRate >= MIN_RATE && sampleRate <= MAX_RATE))
+                return false;  // (Also refuses NaN.)
+            size_t frameBytes = (size_t)channels * (bits / 8);
+            size_t frames = std::min(bytes / frameBytes, (size_t)(MAX_SECONDS * sampleRate));
+            out.assign(frames, 0.f);
+            for (size_t f = 0; f < frames; f++) {
+                float sum = 0.f;
+                for (int c = 0; c < channels; c++)
+                    sum += decodeSample(data + f * frameBytes + c * (bits / 8), bits, isFloat, bigEndian);
+                out[f] = sum / channels;
+            }
+            return frames > 0;
+        }
+    }
+
+    // Decodes a RIFF/WAVE (PCM, float, extensible) or FORM/AIFF/AIFC (NONE, sowt, fl32) file.
+    inline bool loadMono(const std::string& path, std::vector<float>& out, float& sampleRate) {
+        using namespace detail;
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const uint8_t* p = bytes.data();
+        size_t size = bytes.size();
+        if (size < 12)
+            return false;
+
+        // RIFF / WAVE (little-endian chunks).
+        if (!std::memcmp(p, "RIFF", 4) && !std::memcmp(p + 8, "WAVE", 4)) {
+            int format = 0, channels = 0, bits = 0;
+            double rate = 0.0;
+            for (size_t pos = 12; pos + 8 <= size;) {
+                uint32_t len = le32(p + pos + 4);
+                const uint8_t* body = p + pos + 8;
+                size_t avail = std::min<size_t>(len, size - pos - 8);
+                if (!std::memcmp(p + pos, "fmt ", 4) && avail >= 16) {
+                    format = le16(body);
+                    channels = le16(body + 2);
+                    rate = le32(body + 4);
+                    bits = le16(body + 14);
+                    if (format == 0xFFFE && avail >= 26)  // WAVE_FORMAT_EXTENSIBLE: sub-format GUID starts with the tag.
+                        format = le16(body + 24);
+                }
+                else if (!std::memcmp(p + pos, "data", 4)) {
+                    if (format != 1 && format != 3)
+                        return false;
+                    sampleRate = (float)rate;
+                    return decodeFrames(body, avail, channels, bits, format == 3, false, rate, out);
+                }
+                pos = nextChunk(pos, len, size);
+                if (!pos)
+                    break;
+            }
+            return false;
+        }
+
+        // FORM / AIFF or AIFC (big-endian chunks).
+        if (!std::memcmp(p, "FORM", 4) && (!std::memcmp(p + 8, "AIFF", 4) || !std::memcmp(p + 8, "AIFC", 4))) {
+            bool aifc = !std::memcmp(p + 8, "AIFC", 4);
+            int channels = 0, bits = 0;
+            bool isFloat = false, bigEndian = true;
+            double rate = 0.0;
+            const uint8_t* sound = nullptr;
+            size_t soundBytes = 0;
+            for (size_t pos = 12; pos + 8 <= size;) {
+                uint32_t len = be32(p + pos + 4);
+                const uint8_t* body = p + pos + 8;
+                size_t avail = std::min<size_t>(len, size - pos - 8);
+                if (!std::memcmp(p + pos, "COMM", 4) && avail >= 18) {
+                    channels = be16(body);
+                    bits = (be16(body + 6) + 7) / 8 * 8;
+                    rate = extended80(body + 8);
+                    if (aifc && avail >= 22) {
+                        if (!std::memcmp(body + 18, "sowt", 4))
+                            bigEndian = false;
+                        else if (!std::memcmp(body + 18, "fl32", 4) || !std::memcmp(body + 18, "FL32", 4))
+                            isFloat = true, bits = 32;
+                        else if (std::memcmp(body + 18, "NONE", 4))
+                            return false;  // Compressed AIFC.
+                    }
+                }
+                else if (!std::memcmp(p + pos, "SSND", 4) && avail >= 8) {
+                    size_t offset = be32(body);
+                    if (offset > avail - 8)
+                        return false;
+                    sound = body + 8 + offset;
+                    soundBytes = avail - 8 - offset;
+                }
+                pos = nextChunk(pos, len, size);
+                if (!pos)
+                    break;
+            }
+            // COMM may follow SSND, so decode once both were seen.
+            if (sound) {
+                sampleRate = (float)rate;
+                return decodeFrames(sound, soundBytes, channels, bits, isFloat, bigEndian, rate, out);
+            }
+        }
+        return false;
+    }
+
+}
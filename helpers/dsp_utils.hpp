@@ -109,15 +109,20 @@ namespace DSPUtils {
         }
     };
 
+    // Per-sample multiplier of the one-shot decay envelope for a decay param (-10..+10).
+    inline float decayCoefficient(float decayParam, float sampleRate) {
+        const float minTime = 0.08f, maxTime = 0.8f;
+        float normalized = (decayParam + 10.f) / 20.f;
+        float decayTime = minTime * std::pow(maxTime / minTime, normalized);
+        decayTime = std::max(decayTime, 0.001f);
+        return std::exp(-1.f / (decayTime * sampleRate));
+    }
+
     // Simple exponential decay envelope (one-shot).
     struct DecayEnvelope {
         float value = 0.f, decayCoeff = 0.f;
         void trigger(float decayParam, float sampleRate) {
-            const float minTime = 0.08f, maxTime = 0.8f;
-            float normalized = (decayParam + 10.f) / 20.f;
-            float decayTime = minTime * std::pow(maxTime / minTime, normalized);
-            decayTime = std::max(decayTime, 0.001f);
-            decayCoeff = std::exp(-1.f / (decayTime * sampleRate));
+            decayCoeff = decayCoefficient(decayParam, sampleRate);
             value = 1.f;
         }
         float process() { value *= decayCoeff; return value; }
@@ -181,6 +186,48 @@ namespace DSPUtils {
         }
     };
 
+    // Biquad over SIMD lanes (e.g. simd::float_4), one coefficient set per lane. DF-II transposed.
+    template <typename T>
+    struct BiquadLanes {
+        T b0 = 1.f, b1 = 0.f, b2 = 0.f, a1 = 0.f, a2 = 0.f;
+        T z1 = 0.f, z2 = 0.f;
+
+        // Copy the coefficients of a scalar RBJ section (LowPassFilter / HighPassFilter) into one lane.
+        template <typename F>
+        void setLane(int lane, const F& f) {
+            b0[lane] = f.b0; b1[lane] = f.b1; b2[lane] = f.b2;
+            a1[lane] = f.a1; a2[lane] = f.a2;
+        }
+        void setLaneBypass(int lane) {
+            b0[lane] = 1.f; b1[lane] = 0.f; b2[lane] = 0.f;
+            a1[lane] = 0.f; a2[lane] = 0.f;
+        }
+
+        inline T process(T x) {
+            T y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            return y;
+        }
+        void reset() { z1 = 0.f; z2 = 0.f; }
+    };
+
+    // Macro filter (-10..+10) coefficients for one lane: <0 LP, >0 HP, 0 = bypass.
+    template <typename T>
+    inline void setMacroFilterLane(BiquadLanes<T>& biquad, int lane, float filterParam, float sampleRate) {
+        if (filterParam < 0.f) {
+            LowPassFilter lp;
+            lp.setCutoff(mapLP_Cutoff(filterParam, sampleRate), sampleRate, mapResonanceQ(-filterParam / 10.f));
+            biquad.setLane(lane, lp);
+        } else if (filterParam > 0.f) {
+            HighPassFilter hp;
+            hp.setCutoff(mapHP_Cutoff(filterParam, sampleRate), sampleRate, mapResonanceQ(filterParam / 10.f));
+            biquad.setLane(lane, hp);
+        } else {
+            biquad.setLaneBypass(lane);
+        }
+    }
+
     // Utility: volume knob [0..10] to linear gain [0..1].
     inline float applyVolume(float signal, float volumeParam) {
         float gain = clamp(volumeParam / 10.f, 0.f, 1.f);
@@ -203,6 +250,115 @@ namespace DSPUtils {
         return signal;
     }
 
+    // SIMD variant of applyBoost: lanes whose push mask is set get boosted and clamped.
+    template <typename T>
+    inline T applyBoost(T signal, T pushMask) {
+        return simd::ifelse(pushMask, simd::clamp(signal * 1.5f, -1.f, 1.f), signal);
+    }
+
+    // 4-point cubic Hermite (Catmull-Rom) interpolation between x0 and x1, t in [0, 1). Returns x0 exactly at t = 0.
+    template <typename T>
+    inline T hermite4(T xm1, T x0, T x1, T x2, T t) {
+        T c1 = 0.5f * (x1 - xm1);
+        T c2 = xm1 - 2.5f * x0 + 2.f * x1 - 0.5f * x2;
+        T c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+        return ((c3 * t + c2) * t + c1) * t + x0;
+    }
+
+    // Lane-wise select / abs, so the clippers below run on float_4 lanes as well as on scalars.
+    inline simd::float_4 laneSelect(simd::float_4 mask, simd::float_4 a, simd::float_4 b) { return simd::ifelse(mask, a, b); }
+    template <typename T>
+    inline T laneSelect(bool mask, T a, T b) { return mask ? a : b; }
+    inline simd::float_4 laneAbs(simd::float_4 x) { return simd::fabs(x); }
+    inline double laneAbs(double x) { return std::fabs(x); }
+    inline float laneAbs(float x) { return std::fabs(x); }
+
+    // Hard clip to ±1, with its first and second antiderivatives (F1' = f, F2' = F1) for ADAA.
+    struct HardClip {
+        template <typename T>
+        static T f(T x) {
+            return laneSelect(x > T(1.0), T(1.0), laneSelect(x < T(-1.0), T(-1.0), x));
+        }
+        template <typename T>
+        static T F1(T x) {
+            T ax = laneAbs(x);
+            return laneSelect(ax <= T(1.0), x * x * T(0.5), ax - T(0.5));
+        }
+        template <typename T>
+        static T F2(T x) {
+            T sign = laneSelect(x < T(0.0), T(-1.0), T(1.0));
+            return laneSelect(laneAbs(x) <= T(1.0), x * x * x * T(1.0 / 6.0), sign * (x * x * T(0.5) + T(1.0 / 6.0)) - x * T(0.5));
+        }
+    };
+
+    // Cubic soft clip: unity slope at 0, reaches ±1 with zero slope at |x| = 1.5, flat beyond.
+    struct SoftClip {
+        template <typename T>
+        static T f(T x) {
+            T sign = laneSelect(x < T(0.0), T(-1.0), T(1.0));
+            return laneSelect(laneAbs(x) <= T(1.5), x - x * x * x * T(4.0 / 27.0), sign);
+        }
+        template <typename T>
+        static T F1(T x) {
+            T ax = laneAbs(x), x2 = x * x;
+            return laneSelect(ax <= T(1.5), x2 * T(0.5) - x2 * x2 * T(1.0 / 27.0), ax - T(0.5625));
+        }
+        template <typename T>
+        static T F2(T x) {
+            T sign = laneSelect(x < T(0.0), T(-1.0), T(1.0)), x2 = x * x;
+            return laneSelect(laneAbs(x) <= T(1.5), x2 * x * T(1.0 / 6.0) - x2 * x2 * x * T(1.0 / 135.0), sign * (x2 * T(0.5) + T(0.225)) - x * T(0.5625));
+        }
+    };
+
+    // First-order antiderivative anti-aliasing of a clipper (half a sample of delay). Accurate in float,
+    // so it runs on float_4 lanes.
+    template <typename Shape, typename T>
+    struct ADAA1 {
+        static constexpr float EPS = 1e-3f;  // Smaller input steps use the clipper at the midpoint.
+        T x1 = 0.f;
+
+        T process(T x) {
+            T dx = x - x1;
+            T y = laneSelect(laneAbs(dx) < T(EPS), Shape::f((x + x1) * T(0.5)), (Shape::F1(x) - Shape::F1(x1)) / dx);
+            x1 = x;
+            return y;
+        }
+        void reset() { x1 = 0.f; }
+    };
+
+    // Second-order ADAA (one sample of delay, stronger alias rejection). Its second difference cancels
+    // badly in float, so it is meant for double.
+    template <typename Shape, typename T = double>
+    struct ADAA2 {
+        static constexpr double EPS = 1e-5;
+        T x1 = 0.0, x2 = 0.0;
+        T d1 = 0.0;  // Previous first difference of F2.
+
+        T process(T x) {
+            T dx = x - x1;
+            T d = laneSelect(laneAbs(dx) < T(EPS), Shape::F1((x + x1) * T(0.5)), (Shape::F2(x) - Shape::F2(x1)) / dx);
+
+            T y;
+            T dx2 = x - x2;
+            if (laneAbs(dx2) < T(EPS)) {
+                // x ~ x2: expand around their mean instead of dividing by their difference.
+                T mean = (x + x2) * T(0.5);
+                T delta = mean - x1;
+                y = laneSelect(laneAbs(delta) < T(EPS), Shape::f((mean + x1) * T(0.5)),
+                    (T(2.0) / delta) * (Shape::F1(mean) + (Shape::F2(x1) - Shape::F2(mean)) / delta));
+            }
+            else {
+                y = (T(2.0) / dx2) * (d - d1);
+            }
+
+            x2 = x1;
+            x1 = x;
+            d1 = d;
+            return y;
+        }
+        void reset() { x1 = 0.0; x2 = 0.0; d1 = 0.0; }
+    };
+
     // One-shot LP application with dynamic Q (macro filter use).
     inline float applyLowPassFilter(float input, float filterParam, float sampleRate, LowPassFilter& filter) {
         if (filterParam < 0.f) {
@@ -264,4 +420,19 @@ namespace DSPUtils {
         return clamp(cvVoltsPlusMinus5 / 5.f, -1.f, 1.f);
     }
 
+    // Small seeded PRNG (xorshift32): the same seed gives the same sequence, so random timing or patterns
+    // repeat exactly after a reset or a patch reload.
+    struct Rng {
+        uint32_t state = 0x9E3779B9u;
+
+        void seed(uint32_t s) { state = s ? s : 0x9E3779B9u; }  // Xorshift never leaves 0.
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+        float uniform() { return (next() >> 8) * (1.f / 16777216.f); }  // [0, 1).
+    };
+
 }
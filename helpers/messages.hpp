@@ -1,6 +1,57 @@
 #pragma once
+#include <cstdint>
 
+// Expander messages. A producer writes a whole message into the neighbor's producerMessage and requests the
+// flip; the neighbor reads only its own consumerMessage. Events travel as running counters, not one-frame
+// flags, so a consumer sees each of them exactly once however the frames line up.
+
+// Leads every message: what it is, and which write of which producer.
+struct MessageHeader {
+    uint32_t type = 0;      // Four-letter code of the message kind.
+    uint16_t version = 0;   // Layout version of that kind.
+    uint32_t sequence = 0;  // Bumped every frame, written or not.
+    int64_t source = -1;    // Module id of the producer (-1 = nothing written yet).
+
+    MessageHeader(uint32_t type = 0, uint16_t version = 0) : type(type), version(version) {}
+    bool is(uint32_t t, uint16_t v) const { return type == t && version == v; }
+};
+
+constexpr uint32_t messageType(char a, char b, char c, char d) {
+    return (uint32_t(uint8_t(a)) << 24) | (uint32_t(uint8_t(b)) << 16) | (uint32_t(uint8_t(c)) << 8) | uint8_t(d);
+}
+
+// TL_Reseter → TL_Seq4: resets sent so far, per TL_Seq4 channel (A, B).
 struct ReseterMessage {
-    bool aGate = false;
-    bool bGate = false;
-};
\ No newline at end of file
+    static constexpr uint32_t TYPE = messageType('T', 'L', 'R', 'S');
+    static constexpr uint16_t VERSION = 1;
+    static constexpr int HEADS = 16;  // TL_Seq4 playheads (polyphonic clock channels).
+
+    MessageHeader header{TYPE, VERSION};
+    uint32_t channelResets[2] = {};    // Every playhead of the channel (button, mono gate).
+    uint8_t headResets[2][HEADS] = {};  // Single playheads (polyphonic gate: channel i = playhead i).
+};
+
+// Consumer side: the resets of the messages since the last one taken, as playhead bits per channel.
+struct ReseterReceiver {
+    static constexpr uint32_t MAX_GAP = 64;  // Frames; a longer gap (modules were apart) restarts the counts.
+    ReseterMessage seen;  // Last message taken.
+
+    void take(const ReseterMessage& m, uint32_t resets[2]) {
+        if (!m.header.is(ReseterMessage::TYPE, ReseterMessage::VERSION))
+            return;
+        uint32_t gap = m.header.sequence - seen.header.sequence;
+        if (gap == 0 && m.header.source == seen.header.source)
+            return;  // Nothing new.
+        if (m.header.source != seen.header.source || gap > MAX_GAP) {
+            seen = m;  // New or returning producer: its counts so far are no events.
+            return;
+        }
+        for (int c = 0; c < 2; c++) {
+            uint32_t heads = (m.channelResets[c] != seen.channelResets[c]) ? (uint32_t(1) << ReseterMessage::HEADS) - 1 : 0;
+            for (int i = 0; i < ReseterMessage::HEADS; i++)
+                heads |= uint32_t(m.headResets[c][i] != seen.headResets[c][i]) << i;
+            resets[c] |= heads;
+        }
+        seen = m;
+    }
+};
@@ -0,0 +1,141 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Minimal Standard MIDI File reader: note-ons of format 0 / 1 files. Every read is bounds-checked, so a
+// malformed file only makes it return false. Not for the audio thread.
+namespace MidiFile {
+
+    static constexpr size_t MAX_BYTES = 16 << 20;  // Larger files are refused.
+    static constexpr size_t MAX_NOTES = 1 << 20;
+
+    struct Note {
+        uint32_t tick;
+        uint8_t channel;  // 0..15.
+        uint8_t key;
+        uint8_t velocity;  // 1..127.
+    };
+
+    namespace detail {
+        inline uint32_t be32(const uint8_t* p) { return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+        inline uint16_t be16(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+        // Variable-length quantity (at most 4 bytes) at p[pos], pos moved past it.
+        inline bool varLen(const uint8_t* p, size_t end, size_t& pos, uint32_t& value) {
+            value = 0;
+            for (int i = 0; i < 4; i++) {
+                if (pos >= end)
+                    return false;
+                uint8_t b = p[pos++];
+                value = (value << 7) | (b & 0x7f);
+                if (!(b & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        // One MTrk body [pos, end): note-ons appended to notes.
+        inline bool readTrack(const uint8_t* p, size_t pos, size_t end, std::vector<Note>& notes) {
+            uint64_t tick = 0;
+            uint8_t status = 0;  // Running status (0 = none).
+            while (pos < end) {
+                uint32_t delta;
+                if (!varLen(p, end, pos, delta) || pos >= end)
+                    return false;
+                tick += delta;
+
+                uint8_t byte = p[pos];
+                if (byte == 0xff) {  // Meta event.
+                    uint32_t len;
+                    if (end - pos < 2)
+                        return false;
+                    uint8_t type = p[pos + 1];
+                    pos += 2;
+                    if (!varLen(p, end, pos, len) || len > end - pos)
+                        return false;
+                    if (type == 0x2f)
+                        return true;  // End of track.
+                    pos += len;
+                    status = 0;
+                    continue;
+                }
+                if (byte == 0xf0 || byte == 0xf7) {  // Sysex.
+                    uint32_t len;
+                    pos++;
+                    if (!varLen(p, end, pos, len) || len > end - pos)
+                        return false;
+                    pos += len;
+                    status = 0;
+                    continue;
+                }
+                if (byte & 0x80) {
+                    if (byte > 0xef)
+                        return false;  // System messages don't belong in a file.
+                    status = byte;
+                    pos++;
+                }
+                else if (!status) {
+                    return false;  // Data byte without a status.
+                }
+
+                int dataBytes = ((status & 0xf0) == 0xc0 || (status & 0xf0) == 0xd0) ? 1 : 2;
+                if (end - pos < (size_t)dataBytes)
+                    return false;
+                if ((status & 0xf0) == 0x90 && p[pos + 1] > 0 && tick <= UINT32_MAX) {
+                    if (notes.size() >= MAX_NOTES)
+                        return false;
+                    notes.push_back({(uint32_t)tick, (uint8_t)(status & 0x0f), (uint8_t)(p[pos] & 0x7f), (uint8_t)(p[pos + 1] & 0x7f)});
+                }
+                pos += dataBytes;
+            }
+            return true;  // Tracks without an end event are accepted.
+        }
+    }
+
+    // Note-ons of every track, sorted by tick, and the file's ticks per quarter note. SMPTE time division
+    // is not supported.
+    inline bool loadNotes(const std::string& path, std::vector<Note>& notes, int& ticksPerQuarter) {
+        using namespace detail;
+        notes.clear();
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        file.seekg(0, std::ios::end);
+        std::streamoff fileSize = file.tellg();
+        if (fileSize < 14 || (size_t)fileSize > MAX_BYTES)
+            return false;
+        file.seekg(0);
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        const uint8_t* p = bytes.data();
+        size_t size = bytes.size();
+        if (size < 14 || std::memcmp(p, "MThd", 4))
+            return false;
+
+        uint32_t headerLen = be32(p + 4);
+        int format = be16(p + 8);
+        int division = be16(p + 12);
+        if (headerLen < 6 || format > 1 || (division & 0x8000) || division == 0)
+            return false;
+        ticksPerQuarter = division;
+
+        // Chunks: MTrk bodies are read, anything else is skipped.
+        for (size_t pos = 8 + (size_t)headerLen; pos + 8 <= size;) {
+            uint32_t len = be32(p + pos + 4);
+            size_t body = pos + 8;
+            if (len > size - body)
+                return false;
+            if (!std::memcmp(p + pos, "MTrk", 4) && !readTrack(p, body, body + len, notes))
+                return false;
+            pos = body + len;
+        }
+
+        std::stable_sort(notes.begin(), notes.end(), [](const Note& a, const Note& b) { return a.tick < b.tick; });
+        return true;
+    }
+
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Sample data converted once to float and shared by every module instance that plays it.
+namespace SampleBank {
+
+    // Zeroed samples kept before the first and after the last frame, so 4-point interpolation can read
+    // data[i - 1] .. data[i + 2] for any i in [0, length - 1) without a clamp.
+    static constexpr int LEAD = 1;
+    static constexpr int GUARD = 1;
+    static constexpr int ALIGN = 32;  // Bytes.
+
+    // 32-byte aligned float copy of one sample, between LEAD and GUARD zeros.
+    struct Buffer {
+        float* data = nullptr;
+        int length = 0;
+
+        explicit Buffer(int len) : length(len) {
+            // Over-allocate and align by hand (aligned_alloc is not available on every Rack target).
+            storage.assign(LEAD + len + GUARD + ALIGN / sizeof(float), 0.f);
+            uintptr_t p = reinterpret_cast<uintptr_t>(storage.data() + LEAD);
+            data = reinterpret_cast<float*>((p + ALIGN - 1) & ~uintptr_t(ALIGN - 1));
+        }
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+    private:
+        std::vector<float> storage;
+    };
+
+    // Converts 16-bit PCM to float in [-1.0, 1.0).
+    inline std::shared_ptr<const Buffer> fromInt16(const int16_t* pcm, int len) {
+        auto buffer = std::make_shared<Buffer>(len);
+        for (int i = 0; i < len; i++)
+            buffer->data[i] = (float)pcm[i] / 32768.f;
+        return buffer;
+    }
+
+    // Decodes a kit sample packed by tools/pack_samples.py to float (same values as fromInt16).
+    // Blocks of PACK_BLOCK samples: 2 bits predictor order (0-3), 5 bits Rice parameter (PACK_K_ZERO = all
+    // residuals zero), then one Rice code per zigzagged residual. MSB-first; predictor history runs across blocks.
+    static constexpr int PACK_BLOCK = 1024;
+    static constexpr int PACK_K_ZERO = 31;
+
+    inline std::shared_ptr<const Buffer> fromPacked(const uint8_t* packed, int packedLen, int len) {
+        auto buffer = std::make_shared<Buffer>(len);
+        int64_t bitPos = 0, bitEnd = (int64_t)packedLen * 8;
+        auto bit = [&]() -> int {
+            if (bitPos >= bitEnd)
+                return 0;  // Truncated data decodes as silence instead of reading past the end.
+            int b = (packed[bitPos >> 3] >> (7 - (bitPos & 7))) & 1;
+            bitPos++;
+            return b;
+        };
+        auto bits = [&](int n) {
+            uint32_t v = 0;
+            for (int i = 0; i < n; i++)
+                v = (v << 1) | bit();
+            return v;
+        };
+
+        int32_t x1 = 0, x2 = 0, x3 = 0;  // Previous samples.
+        for (int start = 0; start < len; start += PACK_BLOCK) {
+            int order = bits(2);
+            int k = bits(5);
+            for (int i = start; i < std::min(start + PACK_BLOCK, len); i++) {
+                int32_t residual = 0;
+                if (k != PACK_K_ZERO) {
+                    uint32_t q = 0;
+                    while (bit() && bitPos < bitEnd)
+                        q++;
+                    uint32_t u = (q << k) | bits(k);
+                    residual = (u & 1) ? -(int32_t)((u + 1) >> 1) : (int32_t)(u >> 1);
+                }
+                int32_t prediction = (order == 0) ? 0 : (order == 1) ? x1 : (order == 2) ? 2 * x1 - x2 : 3 * x1 - 3 * x2 + x3;
+                int32_t x = prediction + residual;
+                x3 = x2;
+                x2 = x1;
+                x1 = x;
+                buffer->data[i] = (float)(int16_t)x / 32768.f;
+            }
+        }
+        return buffer;
+    }
+
+    // Kaiser-windowed sinc kernel, tabulated over [0, ZEROS] zero crossings.
+    struct SincTable {
+        static constexpr int ZEROS = 16;  // Zero crossings per side.
+        static constexpr int RES = 512;   // Table points per zero crossing.
+        float table[ZEROS * RES + 2];
+
+        SincTable() {
+            const double beta = 8.6;  // ~-90 dB side lobes.
+            auto besselI0 = [](double x) {
+                double sum = 1.0, term = 1.0;
+                for (int k = 1; k < 32; k++) {
+                    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                    sum += term;
+                }
+                return sum;
+            };
+            double norm = besselI0(beta);
+            for (int i = 0; i <= ZEROS * RES; i++) {
+                double u = (double)i / RES;
+                double r = u / ZEROS;
+                double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / norm;
+                double sinc = (i == 0) ? 1.0 : std::sin(M_PI * u) / (M_PI * u);
+                table[i] = (float)(sinc * window);
+            }
+            table[ZEROS * RES + 1] = 0.f;
+        }
+
+        // Kernel value at u zero crossings from the center (linear interpolation between points).
+        float at(double u) const {
+            u = std::fabs(u) * RES;
+            int i = (int)u;
+            if (i >= ZEROS * RES)
+                return 0.f;
+            float frac = (float)(u - i);
+            return table[i] + (table[i + 1] - table[i]) * frac;
+        }
+    };
+
+    // Band-limited resampling for offline use (worker thread). Cutoff sits just below the lower Nyquist.
+    inline std::shared_ptr<const Buffer> resample(const Buffer& in, double inRate, double outRate) {
+        static const SincTable sinc;
+        double ratio = outRate / inRate;
+        double cutoff = 0.95 * std::min(1.0, ratio);  // Fraction of the input Nyquist.
+        double halfWidth = SincTable::ZEROS / cutoff;  // In input samples.
+
+        int outLen = std::max(1, (int)std::ceil(in.length * ratio - 1e-6));
+        auto out = std::make_shared<Buffer>(outLen);
+        for (int n = 0; n < outLen; n++) {
+            double t = n / ratio;  // Position in the input.
+            int first = std::max(0, (int)std::ceil(t - halfWidth));
+            int last = std::min(in.length - 1, (int)std::floor(t + halfWidth));
+            double acc = 0.0;
+            for (int k = first; k <= last; k++)
+                acc += in.data[k] * sinc.at(cutoff * (k - t));
+            out->data[n] = (float)(acc * cutoff);
+        }
+        return out;
+    }
+
+    // Plugin-wide instance of T: built by the first acquire, freed when the last holder lets go.
+    template <typename T>
+    std::shared_ptr<T> acquire() {
+        static std::mutex mutex;
+        static std::weak_ptr<T> shared;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<T> instance = shared.lock();
+        if (!instance) {
+            instance = std::make_shared<T>();
+            shared = instance;
+        }
+        return instance;
+    }
+
+}
@@ -0,0 +1,253 @@
+#pragma once
+#include <cstdint>
+
+// Step sequencer core, free of Rack (builds and runs on its own). A track's steps are the bits of one
+// 64-bit mask, so a pattern is a single integer and "does this step fire" is a bit test. The module keeps
+// edge detection, gate pulses and panel I/O, and tells the track when to advance or reset.
+namespace StepEngine {
+
+    static constexpr int MAX_STEPS = 64;
+    static constexpr int MAX_PLAYHEADS = 16;  // One per polyphonic clock channel.
+
+    inline uint64_t stepBit(int step) { return uint64_t(1) << step; }
+
+    // Four bits per step for all MAX_STEPS steps, 16 steps to a word. Zero is every step's default.
+    struct NibbleLane {
+        uint64_t words[MAX_STEPS / 16] = {};
+
+        int get(int step) const { return (words[step >> 4] >> ((step & 15) * 4)) & 15; }
+
+        void set(int step, int value) {
+            int shift = (step & 15) * 4;
+            uint64_t& word = words[step >> 4];
+            word = (word & ~(uint64_t(15) << shift)) | (uint64_t(value & 15) << shift);
+        }
+    };
+
+    // Per-step settings beside the step mask.
+    static constexpr int CHANCE_LEVELS = 8;
+    static constexpr int MAX_REPEATS = 4;
+    struct StepLanes {
+        NibbleLane chance;   // 0 = always fires, 1..7 = fires (CHANCE_LEVELS - value) times in CHANCE_LEVELS.
+        NibbleLane repeats;  // 0 = the channel's ratchet setting, 1..MAX_REPEATS = that many gates.
+    };
+
+    // Bits of steps 0..n-1.
+    inline uint64_t lengthMask(int n) { return (n >= MAX_STEPS) ? ~uint64_t(0) : stepBit(n) - 1; }
+
+    // Steps of an n-step mask moved r steps later, wrapping around inside the n steps.
+    inline uint64_t rotate(uint64_t mask, int r, int n) {
+        r %= n;
+        if (r == 0)
+            return mask;
+        return ((mask << r) | (mask >> (n - r))) & lengthMask(n);
+    }
+
+    // Euclidean rhythms: k hits spread as evenly as possible over n steps (step i fires when i * k mod n < k,
+    // so step 0 fires whenever k > 0). Built once, on the first euclid() call, for every n <= MAX_STEPS and k <= n.
+    struct EuclidTable {
+        static constexpr int SIZE = MAX_STEPS * (MAX_STEPS + 3) / 2;
+        uint64_t masks[SIZE] = {};
+
+        static constexpr int index(int k, int n) { return (n - 1) * (n + 2) / 2 + k; }
+
+        EuclidTable() {
+            for (int n = 1; n <= MAX_STEPS; n++) {
+                for (int k = 0; k <= n; k++) {
+                    uint64_t mask = 0;
+                    for (int i = 0; i < n; i++)
+                        if ((i * k) % n < k)
+                            mask |= uint64_t(1) << i;
+                    masks[index(k, n)] = mask;
+                }
+            }
+        }
+    };
+
+    // k of n steps, Euclidean (n in 1..MAX_STEPS, k in 0..n): one table read. The first call builds the table,
+    // so call it once off the audio thread.
+    inline uint64_t euclid(int k, int n) {
+        static const EuclidTable table;
+        return table.masks[EuclidTable::index(k, n)];
+    }
+
+    // Fill of n steps at a density (0..1 = share of steps that fire), rotated r steps later.
+    inline uint64_t fill(float density, int r, int n) {
+        int k = (int)(density * n + 0.5f);
+        k = (k < 0) ? 0 : (k > n) ? n : k;
+        return rotate(euclid(k, n), r, n);
+    }
+
+    // One step mask played by up to MAX_PLAYHEADS playheads. Playhead calls take a bit mask of the heads
+    // they apply to (bit i = head i); a mono clock only uses head 0. The per-head loops have a fixed trip
+    // count and no branches, so they vectorize.
+    struct Track {
+        uint64_t steps = 0;  // Bit i set = step i fires.
+        StepLanes lanes;
+        int length = 16;     // Steps played, 1..MAX_STEPS.
+        bool reverse = false;
+        // Playheads. One can sit past `length` right after it shrinks; the next move wraps it to the loop start.
+        int32_t current[MAX_PLAYHEADS] = {};
+
+        bool isOn(int step) const { return (steps >> step) & 1; }
+
+        void setStep(int step, bool on) {
+            steps = on ? (steps | stepBit(step)) : (steps & ~stepBit(step));
+        }
+
+        void setLength(int len) {
+            length = (len < 1) ? 1 : (len > MAX_STEPS) ? MAX_STEPS : len;
+        }
+
+        int32_t firstStep() const { return reverse ? length - 1 : 0; }
+
+        // Playheads back to the first step of the play direction.
+        void reset(uint32_t heads) {
+            const int32_t first = firstStep();
+            for (int i = 0; i < MAX_PLAYHEADS; i++)
+                current[i] = ((heads >> i) & 1) ? first : current[i];
+        }
+
+        // Move playheads one step in the play direction (a compare wraps them, no %).
+        void move(uint32_t heads) {
+            const int32_t dir = reverse ? -1 : 1;
+            const int32_t first = firstStep();
+            for (int i = 0; i < MAX_PLAYHEADS; i++) {
+                int32_t next = current[i] + dir;
+                next = (next < 0 || next >= length) ? first : next;
+                current[i] = ((heads >> i) & 1) ? next : current[i];
+            }
+        }
+
+        // Heads on the first step of the play direction (a loop boundary).
+        uint32_t atLoopStart(uint32_t heads) const {
+            const int32_t first = firstStep();
+            uint32_t at = 0;
+            for (int i = 0; i < MAX_PLAYHEADS; i++)
+                at |= uint32_t(current[i] == first) << i;
+            return at & heads;
+        }
+
+        // Heads sitting on a step that fires.
+        uint32_t firing(uint32_t heads) const {
+            uint32_t on = 0;
+            for (int i = 0; i < MAX_PLAYHEADS; i++)
+                on |= uint32_t((steps >> current[i]) & 1) << i;
+            return on & heads;
+        }
+
+        // One clock on `heads`: move, then the heads whose new step fires.
+        uint32_t advance(uint32_t heads) {
+            move(heads);
+            return firing(heads);
+        }
+    };
+
+    // Song: patterns played in order, each for a number of loops, then around again. next[] holds each
+    // entry's successor (rebuilt by link()), so moving on is a table read.
+    struct Chain {
+        static constexpr int MAX_ENTRIES = 64;
+        static constexpr int MAX_LOOPS = 64;
+        uint8_t pattern[MAX_ENTRIES] = {};
+        uint8_t loops[MAX_ENTRIES] = {1};  // 1..MAX_LOOPS.
+        uint8_t next[MAX_ENTRIES] = {};
+        int length = 1;
+
+        void link() {
+            for (int i = 0; i < length; i++)
+                next[i] = (i + 1 < length) ? i + 1 : 0;
+        }
+
+        // New entry after `at` (a copy of it), or nothing when full.
+        void insert(int at) {
+            if (length == MAX_ENTRIES)
+                return;
+            for (int i = length; i > at + 1; i--) {
+                pattern[i] = pattern[i - 1];
+                loops[i] = loops[i - 1];
+            }
+            pattern[at + 1] = pattern[at];
+            loops[at + 1] = loops[at];
+            length++;
+            link();
+        }
+
+        // The last entry stays.
+        void remove(int at) {
+            if (length == 1)
+                return;
+            for (int i = at; i < length - 1; i++) {
+                pattern[i] = pattern[i + 1];
+                loops[i] = loops[i + 1];
+            }
+            length--;
+            link();
+        }
+    };
+
+    // Position in a chain, moved on at loop starts. The pattern for the next boundary is known a whole loop
+    // ahead (staged()), so the boundary itself only swaps a pattern index.
+    struct Song {
+        Chain chain;
+        int position = 0;   // Entry playing.
+        int loopsLeft = 0;  // Loops of it still to come after the current one.
+
+        // Back to the first entry (playing from now); returns its pattern.
+        int restart() {
+            position = 0;
+            loopsLeft = chain.loops[0] - 1;
+            return chain.pattern[0];
+        }
+
+        // The first entry takes over at the next loop start.
+        void cue() {
+            position = chain.length - 1;
+            loopsLeft = 0;
+        }
+
+        // A loop starts: the next entry once the current one's loops are done.
+        void loop() {
+            if (loopsLeft == 0) {
+                position = chain.next[position];
+                loopsLeft = chain.loops[position] - 1;
+            }
+            else {
+                loopsLeft--;
+            }
+        }
+
+        // Pattern of the next boundary while the current loop is the entry's last, else -1 (no change).
+        int staged() const {
+            return (loopsLeft == 0) ? chain.pattern[chain.next[position]] : -1;
+        }
+    };
+
+    // Clock period (frames) as the median of the last three edge intervals, so one early or late edge does
+    // not move it. 0 until two edges have been seen.
+    struct PeriodTracker {
+        uint32_t intervals[3] = {};
+        int measured = 0;  // Intervals seen, up to 3.
+        uint32_t lastEdge = 0;
+        bool started = false;
+
+        void edge(uint32_t now) {
+            if (started) {
+                intervals[0] = intervals[1];
+                intervals[1] = intervals[2];
+                intervals[2] = now - lastEdge;
+                if (measured < 3)
+                    measured++;
+            }
+            lastEdge = now;
+            started = true;
+        }
+
+        uint32_t period() const {
+            if (measured < 3)
+                return intervals[2];
+            uint32_t a = intervals[0], b = intervals[1], c = intervals[2];
+            return (a > b) ? ((b > c) ? b : (a > c) ? c : a) : ((a > c) ? a : (b > c) ? c : b);
+        }
+    };
+
+}
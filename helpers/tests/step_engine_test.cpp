@@ -0,0 +1,202 @@
+// Standalone checks for helpers/step_engine.hpp (no Rack needed):
+//   c++ -std=c++11 -O2 helpers/tests/step_engine_test.cpp -o step_engine_test && ./step_engine_test
+#include "../step_engine.hpp"
+#include <cstdio>
+#include <initializer_list>
+
+using namespace StepEngine;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static int popcount(uint64_t mask) {
+    int n = 0;
+    for (; mask; mask &= mask - 1)
+        n++;
+    return n;
+}
+
+// Steps of an n-step mask, step 0 first ("x..x..x.").
+static bool sameSteps(uint64_t mask, const char* steps) {
+    int n = 0;
+    for (; steps[n]; n++)
+        if (((mask >> n) & 1) != (steps[n] == 'x'))
+            return false;
+    return (mask >> n) == 0 || n == MAX_STEPS;
+}
+
+static void testMasks() {
+    CHECK(lengthMask(1) == 1);
+    CHECK(lengthMask(16) == 0xffff);
+    CHECK(lengthMask(MAX_STEPS) == ~uint64_t(0));
+
+    // Rotation against a step-by-step reference, for every length.
+    for (int n = 1; n <= MAX_STEPS; n++) {
+        uint64_t mask = (0x9e3779b97f4a7c15ull * n) & lengthMask(n);
+        for (int r = 0; r < 2 * n; r++) {
+            uint64_t expected = 0;
+            for (int i = 0; i < n; i++)
+                if ((mask >> i) & 1)
+                    expected |= stepBit((i + r) % n);
+            CHECK(rotate(mask, r, n) == expected);
+        }
+    }
+}
+
+static void testEuclid() {
+    CHECK(sameSteps(euclid(3, 8), "x..x..x."));
+    CHECK(sameSteps(euclid(5, 8), "x.x.xx.x"));
+    CHECK(sameSteps(euclid(4, 16), "x...x...x...x..."));
+    CHECK(euclid(0, 7) == 0);
+
+    // Every entry: k hits inside n steps, step 0 set whenever k > 0, gaps differing by at most one.
+    for (int n = 1; n <= MAX_STEPS; n++) {
+        for (int k = 0; k <= n; k++) {
+            uint64_t mask = euclid(k, n);
+            CHECK(popcount(mask) == k);
+            CHECK((mask & ~lengthMask(n)) == 0);
+            CHECK(k == 0 || (mask & 1));
+            if (k < 2)
+                continue;
+            int shortest = MAX_STEPS, longest = 0, last = -1, first = -1;
+            for (int i = 0; i < n; i++) {
+                if (!((mask >> i) & 1))
+                    continue;
+                if (last >= 0) {
+                    shortest = (i - last < shortest) ? i - last : shortest;
+                    longest = (i - last > longest) ? i - last : longest;
+                }
+                else {
+                    first = i;
+                }
+                last = i;
+            }
+            int wrap = n - last + first;
+            shortest = (wrap < shortest) ? wrap : shortest;
+            longest = (wrap > longest) ? wrap : longest;
+            CHECK(longest - shortest <= 1);
+        }
+    }
+
+    CHECK(fill(0.f, 0, 8) == 0);
+    CHECK(fill(1.f, 0, 8) == 0xff);
+    CHECK(fill(0.375f, 1, 8) == rotate(euclid(3, 8), 1, 8));
+    CHECK(fill(2.f, 0, 8) == 0xff);  // Density past 100 % is clamped.
+}
+
+static void testTrack() {
+    Track track;
+    track.setLength(4);
+    track.steps = 0x5;  // Steps 1 and 3.
+
+    // Head 0 only; it wraps at the length.
+    int fired = 0;
+    for (int clock = 0; clock < 8; clock++)
+        fired += track.advance(1) & 1;
+    CHECK(track.current[0] == 0);
+    CHECK(fired == 4);
+    CHECK(track.current[1] == 0);  // Other heads stay put.
+
+    // A head past a shrunk length restarts the loop on its next move.
+    track.current[0] = 3;
+    track.setLength(2);
+    track.move(1);
+    CHECK(track.current[0] == 0);
+
+    track.reverse = true;
+    track.reset(1);
+    CHECK(track.current[0] == 1);
+    CHECK(track.atLoopStart(1) == 1);
+    track.move(1);
+    track.move(1);
+    CHECK(track.current[0] == 1);
+
+    track.setLength(0);
+    CHECK(track.length == 1);
+    track.setLength(MAX_STEPS + 5);
+    CHECK(track.length == MAX_STEPS);
+}
+
+static void testSong() {
+    Song song;
+    Chain& chain = song.chain;
+    chain.pattern[0] = 3;
+    chain.loops[0] = 2;
+    chain.insert(0);
+    chain.pattern[1] = 7;
+    chain.loops[1] = 1;
+    CHECK(chain.length == 2);
+
+    // Pattern per loop: 3, 3, 7, then around again. staged() names the next loop's pattern on an entry's last loop.
+    CHECK(song.restart() == 3);
+    CHECK(song.staged() == -1);
+    const int expected[] = {3, 3, 7, 3, 3};
+    for (int loop = 1; loop < 5; loop++) {
+        int staged = song.staged();
+        song.loop();
+        CHECK(chain.pattern[song.position] == expected[loop]);
+        CHECK(staged == -1 || staged == expected[loop]);
+        CHECK((staged == -1) == (expected[loop] == expected[loop - 1]));
+    }
+
+    // Cued: the first entry takes over at the next loop start.
+    song.cue();
+    CHECK(song.staged() == 3);
+    song.loop();
+    CHECK(song.position == 0);
+
+    chain.remove(0);
+    CHECK(chain.length == 1 && chain.pattern[0] == 7);
+    chain.remove(0);
+    CHECK(chain.length == 1);  // The last entry stays.
+}
+
+static void testPeriodTracker() {
+    PeriodTracker tracker;
+    CHECK(tracker.period() == 0);
+    tracker.edge(1000);
+    CHECK(tracker.period() == 0);  // One edge: no interval yet.
+    tracker.edge(1100);
+    CHECK(tracker.period() == 100);
+
+    tracker.edge(1200);
+    tracker.edge(1300);
+    CHECK(tracker.period() == 100);
+    tracker.edge(1900);  // One late edge is outvoted.
+    CHECK(tracker.period() == 100);
+    tracker.edge(1910);  // So is one early edge.
+    CHECK(tracker.period() == 100);
+
+    // A new tempo wins once it holds for two intervals.
+    PeriodTracker changed;
+    for (uint32_t t : {0u, 100u, 200u, 300u, 350u, 400u})
+        changed.edge(t);
+    CHECK(changed.period() == 50);
+
+    // Frame counts wrap.
+    PeriodTracker wrapped;
+    for (uint32_t t : {UINT32_MAX - 150, UINT32_MAX - 50, 49u, 149u})
+        wrapped.edge(t);
+    CHECK(wrapped.period() == 100);
+}
+
+int main() {
+    testMasks();
+    testEuclid();
+    testTrack();
+    testSong();
+    testPeriodTracker();
+    if (failures) {
+        std::printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("step_engine: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Single background thread running queued jobs in order (resampling, decoding...). Never used from the audio thread.
+struct Worker {
+	Worker() {
+		thread = std::thread([this] { run(); });
+	}
+
+	// Finishes the running job, drops the queued ones and joins.
+	~Worker() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+			jobs.clear();
+		}
+		cv.notify_all();
+		thread.join();
+	}
+
+	void push(std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			jobs.push_back(std::move(job));
+		}
+		cv.notify_one();
+	}
+
+private:
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque<std::function<void()>> jobs;
+	bool quit = false;
+	std::thread thread;
+
+	void run() {
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			cv.wait(lock, [this] { return quit || !jobs.empty(); });
+			if (quit)
+				return;
+			std::function<void()> job = std::move(jobs.front());
+			jobs.pop_front();
+			lock.unlock();
+			job();
+			lock.lock();
+		}
+	}
+};
@@ -3,4462 +3,978 @@
 
 #include <stdint.h>
 
+// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).
 const int clap_sample_len = 44538;
-const int16_t clap_sample[] = {
-    14, -41, 50, -69, -53, 426, -743, -583, 1281, 962, 
-    1649, -914, -6158, -5367, -2659, 2871, 4212, 2934, 6712, 7462, 
-    7077, 4324, -6474, -8164, -4951, -4850, 3073, -3096, -11499, -5960, 
-    -1157, 1253, 2254, -1291, -4586, -3193, 2629, 7728, 7445, 10077, 
-    10977, 8411, 6800, 6024, 3783, -3642, -6533, -4619, -5255, -5085, 
-    -5098, -1808, -879, -928, -347, 913, -1851, -4924, -3136, -2158, 
-    2300, 4352, -1112, -4869, -3617, -3362, -4030, -3573, -5196, -3702, 
-    4035, 5303, 1043, 924, 2317, 2807, 772, -29, 347, -611, 
-    -346, 522, 551, 3342, 5802, 4191, 2754, 1270, 640, 101, 
-    -264, -1604, -1376, 1045, 2195, 2909, 3034, 2884, 2740, 1998, 
-    1268, 399, -1012, -2727, -2607, -2011, -657, 535, 1089, 2048, 
-    217, -1094, -726, -685, -2733, -4159, -4452, -4589, -4634, -4276, 
-    -3907, -2794, -759, -2, 1008, 9, -1440, -1556, -1491, -97, 
-    79, 2260, 4229, 528, -1881, -3276, -3139, 165, 2320, 4394, 
-    5407, 5539, 5753, 4312, 3921, 4885, 4013, 2364, 1318, -204, 
-    883, 3077, 2940, 2611, 804, -991, -1837, -2678, -2407, -2426, 
-    -1885, -1679, -1150, -958, -1588, -2105, -2332, -2539, -3325, -3372, 
-    -2225, -1717, -1770, -948, 489, 1392, 3058, 1630, -519, -1079, 
-    -1439, -1549, -2638, -1257, 467, -216, -631, -1488, -1230, -2000, 
-    -2019, 1355, 2877, 2049, 1454, 2005, 1432, -926, -1164, -516, 
-    191, 930, 850, 880, 100, -471, -1059, -1924, -407, 1082, 
-    700, 63, 1601, 2760, 1441, 815, 1120, 1302, 2288, 1738, 
-    -419, -1130, -1008, -547, -113, 237, 1245, 891, 47, 97, 
-    177, 189, -44, -910, -1733, -390, 549, 336, 530, 466, 
-    47, 339, 390, -98, -340, -959, -971, -379, -428, -470, 
-    -969, -1838, -1999, -1941, -1201, -164, -212, -478, -119, 258, 
-    108, -84, -559, -916, -396, -147, -549, -739, -379, -123, 
-    -458, -227, 445, 809, 1162, 1041, 608, 759, 1035, 1270, 
-    1392, 1408, 1628, 1129, 456, 996, 1442, 460, -278, -440, 
-    -350, -174, -118, 376, 394, -60, -296, -751, -722, -166, 
-    -353, -866, -891, -771, -373, 119, 69, -49, -28, -139, 
-    -133, -102, -1028, -1615, -1004, -601, -197, -47, -469, -410, 
-    -27, 350, 352, 578, 1131, 1123, 708, 596, 583, 542, 
-    467, 347, 378, 146, -9, 109, 238, 240, 302, -162, 
-    -438, 161, 362, -2, -302, -220, -224, -484, -485, 172, 
-    84, -557, -418, 88, 191, 28, 16, 14, 38, -146, 
-    177, 396, 67, -236, -225, -176, -234, -200, -323, -223, 
-    135, 276, 190, 150, -117, -11, 222, 303, 358, 257, 
-    257, 54, -46, -184, -241, -110, 1, 128, 187, -32, 
-    -181, -272, -293, -108, -22, 245, 332, 349, 370, 458, 
-    386, 145, 6, -77, -201, -446, -302, -29, -69, -110, 
-    -121, -94, -97, 342, -588, -1016, 504, 1358, 1681, 834, 
-    -266, -2347, -2431, -2948, -907, 4506, 6921, 3768, -820, -5600, 
-    -12145, -6315, 4050, 796, -1933, -92, 148, 2166, 2339, 4201, 
-    6845, 5765, 5702, 2600, 353, 3917, 1770, -9524, -11468, -4901, 
-    -1350, 1658, 385, -116, -638, -7614, -599, 10958, 5919, -743, 
-    -4385, -6315, -1880, 827, 647, 724, -2771, -2794, 1980, 4163, 
-    9665, 8079, -1136, -3677, -6806, -3564, 2594, 3981, 6415, -315, 
-    -6066, -3895, -254, 3039, 4893, 2797, -452, 692, 2749, 1090, 
-    -28, -918, -2186, -1083, -2145, -4412, -5007, -9669, -8017, 1661, 
-    2368, -1887, -3730, -3498, -2624, -3248, -320, 2337, 5985, 7821, 
-    5524, 4153, -501, -3162, -3951, -4663, 1510, 4533, 4456, 3568, 
-    1182, 1574, 3427, 6111, 6488, 5252, 6259, 5190, 3037, 1215, 
-    -1175, -1876, -1783, -3695, -4527, -7558, -10961, -6535, -2582, -4387, 
-    -5285, -5949, -5453, -604, 1414, -1390, -1156, 795, 3164, 7243, 
-    7661, 6616, 4580, 882, -78, -1646, 1042, 4915, 4086, 3094, 
-    1308, -97, 301, -52, -525, -1346, -3955, -5692, -2214, -692, 
-    -3938, -5861, -6789, -5654, -2720, -1332, -635, -74, 974, 1287, 
-    848, 1387, 1655, 2274, 3275, 1705, -336, 815, 2075, 488, 
-    -565, 546, 2095, 3413, 4413, 6559, 6534, 5837, 4758, 550, 
-    -2140, -4759, -4741, -1814, -1714, 1313, -901, -4725, -3162, -473, 
-    159, -732, 439, 1641, 224, -1297, 185, 1111, 1034, 1018, 
-    315, 76, 2579, 2299, -1946, -3038, -2351, -1598, -735, -1233, 
-    -1205, -1453, -2285, -1072, 782, 287, -916, -232, 737, -86, 
-    -1230, -305, 339, -1382, -2180, -591, 104, 1409, 999, -1494, 
-    -1335, -1177, 599, 3393, 2033, -723, -1382, -1299, -970, -657, 
-    -463, -374, 975, 2817, 1826, 960, 2534, 3656, 3217, 2301, 
-    483, -513, -1475, -1772, -352, 444, 1272, 1323, 1208, 821, 
-    -408, -627, -563, -362, -167, -783, -1289, -1705, -1700, -1774, 
-    -1959, -555, 571, -1213, -2011, -1029, -351, 188, 127, -694, 
-    -692, 326, 635, 728, 432, 764, 227, -793, -477, -674, 
-    -47, 883, 1068, 1552, 82, -967, -456, -170, 662, 886, 
-    -360, -831, -271, -16, 565, 391, -1363, -1090, 448, 1012, 
-    1577, 748, -570, -65, 601, 1139, 1693, 788, -235, 193, 
-    442, -452, -1337, -599, 105, 549, 457, 36, 447, 68, 
-    -80, 178, 269, 715, -34, -1284, -1781, -2129, -1598, -1123, 
-    -277, 1009, 328, -353, -79, 217, 692, 753, 367, -38, 
-    -619, -818, -1045, -953, 179, 559, 13, 41, 891, 969, 
-    81, 335, 999, 1113, 1304, 572, -429, 103, 958, 412, 
-    -276, 113, 540, -10, -423, -350, -252, -258, -341, -76, 
-    -120, -571, -723, -455, -556, -861, -981, -983, -852, -777, 
-    -531, -175, -273, -405, -114, 200, 487, 634, 876, 1101, 
-    830, 726, 1197, 1326, 821, 542, 542, 481, 316, 175, 
-    177, 87, -87, 40, 220, 423, 554, 282, 78, -438, 
-    -952, -575, -231, -408, -562, -127, 189, -117, -143, -149, 
-    -5, 415, 355, -252, -439, -378, -381, -516, -438, -179, 
-    -149, -43, -224, -295, -343, -308, -42, 213, 344, 419, 
-    569, 660, 427, 235, 481, 364, -241, -481, -395, -287, 
-    -203, -114, 131, -13, -297, -421, -677, -403, -207, -152, 
-    -111, -171, -256, 328, 698, 515, 384, 46, 52, -70, 
-    105, 394, 591, 577, 553, 329, 221, 448, 177, 446, 
-    166, 458, 1383, -674, -791, -5835, -443, 8566, 2748, -1610, 
-    437, 2092, -4277, -7986, 181, 2272, -2570, -3989, -2116, -290, 
-    -1523, 262, 4665, 5259, 4222, 2514, 1361, 1286, 579, -1882, 
-    -4964, -2778, 617, -1824, -3511, 3609, 7992, 2878, -838, -5207, 
-    -5046, -1371, 644, 3296, 3157, 476, 268, 3161, 619, -7324, 
-    -4047, 4229, 1580, -4085, -4080, -2108, -2445, -2807, -866, 717, 
-    3625, 5424, 4075, 2785, -1001, -735, 2173, 2539, 5661, 2684, 
-    -3535, -6673, -9695, -6842, -2265, 509, 1735, 3586, 3553, 4541, 
-    4928, 2234, -3207, -4018, -925, -707, 869, -2250, -5965, -4672, 
-    -2760, -733, -82, 2117, 3066, 4124, 4647, 766, 2971, 7058, 
-    7404, 5884, 4460, 3112, 1184, -624, -215, -168, -166, -31, 
-    -2851, -4257, -1718, 252, -3493, -4904, 194, 683, -4531, -5692, 
-    -3204, -2272, -2483, -2199, -2265, -643, 2882, -404, -4803, -4171, 
-    -1949, -1481, -1953, 859, 2562, 2711, 2091, -2363, -4170, -4887, 
-    -4153, -1217, 343, 1216, 2137, 3045, 3650, 4631, 4291, 4029, 
-    6595, 6732, 8477, 10352, 8204, 6415, 3656, 1118, 1858, 1902, 
-    -741, -3297, -4466, -5287, -4194, -3475, -5932, -6224, -3347, -4881, 
-    -8492, -8769, -8597, -5598, -591, 513, 887, 1208, 2134, 2659, 
-    2446, 3690, 4102, 4735, 5080, 2213, 444, 2120, 2686, 2282, 
-    2163, 1228, 954, 1101, 720, -360, -658, 1227, -443, -4629, 
-    -3521, -272, 660, 1004, -150, -1610, -1280, -943, -2871, -4597, 
-    -3785, -3278, -1564, -887, -1906, -2452, -2197, -2139, -3016, -2759, 
-    -1951, -815, 1231, 1651, 1742, 2024, 1852, 3050, 4254, 4318, 
-    4455, 2429, 177, 1389, 2576, 1960, 998, 1647, 2515, 4, 
-    -719, 2031, 3173, 3395, 2579, 262, -521, -181, -952, -2176, 
-    -3075, -3746, -3270, -2208, -1949, -1693, -1018, -608, -210, 412, 
-    485, 470, 1171, 1131, 1470, 943, -2143, -3043, -1609, -730, 
-    539, 579, -741, -226, 1087, 1137, 1384, 991, 363, 165, 
-    -339, 265, 611, 622, 650, -1721, -3110, -2417, -1760, -444, 
-    102, -749, -837, -359, 18, 521, 196, -469, -634, -1192, 
-    -144, 1969, 2307, 1880, 1814, 2023, 1494, 327, 348, 257, 
-    -690, -1166, -1301, -684, 91, 287, 1480, 1539, 271, -444, 
-    -1639, -1562, -803, -354, 0, 11, 753, 120, -1609, -530, 
-    1232, 900, 91, -121, -117, 202, 332, 334, 172, 344, 
-    388, -546, -820, -129, 337, 315, 397, 1205, 1083, -33, 
-    -105, 414, 254, -227, -437, -578, -419, -130, -519, -852, 
-    -786, -504, -561, -656, 276, 716, -111, -597, -481, -427, 
-    -796, -880, -278, -249, -777, -581, 140, 312, 76, 182, 
-    630, 177, -646, 157, 948, 904, 635, 370, 212, 94, 
-    269, -2, 66, 992, 1372, 1659, 1537, 1302, 899, 120, 
-    -75, -152, -204, 5, -504, -1157, -1030, -765, -691, -675, 
-    -1044, -1299, -1390, -1388, -1211, -963, -753, -366, 287, 757, 
-    1379, 1476, 895, 762, 591, 684, 954, 745, 443, 227, 
-    285, 81, -213, 124, 544, 368, 221, -88, -276, -67, 
-    -67, -239, -449, -614, -689, -618, -580, -460, -420, -303, 
-    -177, -348, 56, 823, 690, 242, 107, 18, 72, -14, 
-    -59, -31, -456, -689, -384, -101, 40, 53, 255, 308, 
-    -253, -280, 154, 371, 618, 493, 290, 168, -51, 54, 
-    130, 164, 199, -4, -245, -47, 108, 306, 421, 312, 
-    219, 199, 153, -317, -472, -528, -416, -91, -5, -100, 
-    -9, 146, 438, 633, 523, 1854, -36, -5316, 837, 9667, 
-    2505, -4990, -4386, -2675, 1051, 2054, 1400, -461, -5964, -5270, 
-    -2527, -2747, 5685, 7500, 3222, 2142, 597, 8, -1917, -2182, 
-    -1967, -2520, -4278, -1772, -2954, 1053, 6137, 6348, 8997, 1727, 
-    -5638, -5582, -5164, -3280, -3860, 4942, 6352, 746, -599, 1090, 
-    1526, -333, 159, -1439, 1780, 5582, 3567, 362, -2110, -3678, 
-    -2677, -2562, 294, 3022, 1113, -312, 643, 1188, -4697, -6384, 
-    -3399, -637, -1171, -423, 3162, 2799, -577, -960, 2473, -109, 
-    -4926, -6074, -8446, -2397, 4264, 5013, 6266, 1675, -716, 1972, 
-    2767, 4109, 3427, 4759, 5727, 3525, 2111, 2827, 2064, -366, 
-    -2217, -1658, -3940, -9375, -7553, -3631, -3858, -8891, -4688, 2233, 
-    4773, 7755, 729, -5773, -4767, -3425, -648, -16, 5221, 5221, 
-    1903, -2209, -2752, -1144, 1810, 8085, 11338, 8557, 1278, -1771, 
-    -6872, -2964, 1981, 4042, 6613, 811, -2460, -443, -465, 1678, 
-    3205, 2702, 1731, 818, 841, -5641, -5778, 3756, 2386, -7464, 
-    -10387, -8128, -5645, -2055, -2391, -1472, 2665, 3123, 197, -2368, 
-    -3849, -4800, -5502, -5249, -3829, -1310, 2484, 5368, 6989, 8397, 
-    5001, 3669, 7254, 5975, 1402, -709, -1551, -1531, 1090, 3402, 
-    3600, 4350, 8055, 5398, 6, -776, -930, 572, 1069, -2814, 
-    -6450, -6498, -6489, -5450, -4515, -6251, -6150, 190, 1281, -2327, 
-    -3512, -3574, -1970, -2829, 2661, 4409, 1693, 3188, -2877, -9326, 
-    -5271, -264, 3187, 5383, 6489, 7748, 7773, 7217, 2613, 750, 
-    3274, 3493, 3218, 1457, -2001, -3331, -3600, -3723, -3127, -4489, 
-    -6077, -4713, -2561, -1688, -583, 1419, 1085, 6283, 12810, 6162, 
-    1392, 2885, 3776, 2932, 157, -7055, -9231, -2067, 1235, -1033, 
-    -1420, 2355, 2586, -3103, -2337, 1872, 1358, -190, -4437, -6250, 
-    -3883, -4185, 564, 6333, 2553, -725, 494, 1542, 345, -1974, 
-    -6353, -7239, -4103, -2127, 2196, 3034, 477, 85, -2347, -155, 
-    4529, 3527, 826, -347, -109, 747, -188, 3504, 8894, 3705, 
-    770, 2295, 1261, 1158, 3078, 2948, 1997, 3263, 3918, 2483, 
-    587, -481, -2734, -6273, -6611, -6175, -642, 840, -2999, -2487, 
-    -7278, -11918, -8669, -5407, -2965, 480, 2186, 2682, 7414, 9946, 
-    5590, 2380, 2944, 2506, -506, -3388, -5618, -5661, -5126, -2661, 
-    3705, 3798, 273, 2407, 4910, 6616, 7517, 3789, -1196, -2063, 
-    -1085, -4140, -6661, 2493, 7690, 4351, 1263, -4285, -4345, 802, 
-    3873, 2521, 1658, 5286, 1310, -6268, -7045, -7519, -2965, 3317, 
-    3614, 3991, 1333, -1451, 103, 1025, 570, -55, -1806, -3229, 
-    -2300, -2611, -6841, -7812, -4170, -2754, -2757, -2008, -1298, 746, 
-    6503, 6573, 3282, 2367, -1361, 1653, 6829, 5658, 5840, 1429, 
-    -1593, -1146, -895, 1532, 2577, 213, -1419, -815, -735, -1725, 
-    -3907, -5116, -6380, -6787, -4025, -4057, 2333, 12727, 8868, 2781, 
-    -810, -4996, -289, 3799, 3923, 3486, 1241, -147, 1334, 2351, 
-    -633, -1754, -335, 437, 3773, 2873, -2246, -3881, -4947, -3599, 
-    390, -70, -2551, -1681, 1669, 1236, -1685, 629, 3040, 3426, 
-    3790, -1718, -5015, -6441, -7087, -1583, 176, -3414, -4170, -102, 
-    2713, 4963, 5066, 2049, 1061, 3414, 1107, -5648, -4584, 459, 
-    -592, -2920, -2452, -587, 469, 946, 2939, 4538, 901, -917, 
-    1649, 3717, 5511, 5270, 6905, 6493, 3379, 1791, -1892, -2577, 
-    1805, -2490, -10245, -9752, -7190, -3306, 797, 972, 1306, 911, 
-    -21, 1195, 1230, -2281, -4375, -4954, -4708, -1048, 1261, 3019, 
-    3991, 4334, 3959, 2746, 888, -1611, -3360, -6375, -4538, 993, 
-    1413, 1993, -317, -1316, -1765, -1239, 528, 1723, 3579, 3799, 
-    6271, 8330, 5052, 3194, 4401, 3749, 1277, -1608, -4540, -5681, 
-    -5385, -5676, -5501, -4905, -4688, -1889, 1982, 3434, 4474, 173, 
-    -3078, -1911, -888, 1856, 2629, 3010, 2667, -1605, -3085, -1326, 
-    -229, -2588, -1814, 3127, 4111, 4937, 1987, -5055, -3698, 629, 
-    632, -301, -2134, -6795, -121, 8209, 3161, -498, -3768, -6338, 
-    658, 4058, 1120, -1444, -2837, -2048, -3956, -3021, 3080, 4644, 
-    3737, 3187, 693, 2639, 8319, 4953, -1660, -2672, -2791, -1221, 
-    279, 496, 1424, 2912, 3683, 2306, 2541, 3292, 2887, 421, 
-    -1485, -3709, -6315, -9234, -9475, -7136, -5407, -3413, -1957, 1685, 
-    2179, -179, 2364, 6636, 4352, 367, 585, 1208, -935, -2896, 
-    -1375, 135, 110, 822, 2415, 3839, 4514, 4618, 3876, 2640, 
-    2262, 283, -2974, -4420, -5140, -4256, -3075, -2424, -1599, -847, 
-    -83, -2230, -3509, -1806, 789, 3162, 2847, 6888, 8617, 5382, 
-    2841, 2989, 2052, -1221, -3289, -6456, -5319, 99, 411, -74, 
-    -1425, -2722, -923, 373, 1765, 2053, 807, -103, -3646, -5950, 
-    -3990, -2251, -1242, -802, 704, 1416, -328, -670, -67, 613, 
-    448, 598, 3064, 2369, -11, 267, 1948, 2022, 713, 1451, 
-    2730, 3900, 3632, -410, -1726, -2359, -2876, 4610, 6760, 313, 
-    -2848, 197, 2351, 1122, 17, -888, -1089, -2589, -2249, -242, 
-    -1084, -2941, -3405, -2672, -2729, -4177, -1472, 1601, -1530, -4079, 
-    -2887, -1611, -1958, -1683, -1902, -1669, 2754, 3562, 1485, 703, 
-    -1611, 84, 2710, 4997, 9042, 7731, 3654, 3869, 5588, 4121, 
-    1468, 48, -1353, 12, 1381, -996, -2781, -3881, -3826, -4347, 
-    -4750, -1764, -1821, -5132, -5741, -4468, -2404, -1767, 47, 5650, 
-    3179, -2628, -1833, 204, 2447, 3857, 2217, 1090, -207, -1176, 
-    2139, 4313, 5695, 5831, 3158, 1636, 226, -987, -340, -1382, 
-    -5817, -5690, 681, 1073, -1286, -1479, -1465, 86, 2508, 2348, 
-    1248, -2643, -6817, -3763, -1608, 460, 2154, 1219, 1059, -2035, 
-    -3995, -1970, -1312, -1819, -2375, -2228, -1182, 1363, 2225, 3266, 
-    2973, 1857, 2405, 3044, 2813, 2090, 1305, 624, 2023, 3141, 
-    3008, 2567, 1081, -190, -2699, -3477, -2029, -758, 602, 995, 
-    3682, 3380, -779, -1387, -1114, -1831, -3445, -5189, -5760, -4770, 
-    -3372, -1609, 320, -3397, -5365, -3137, -1246, 3329, 5874, 3681, 
-    2936, 2459, 2647, 6264, 6573, 2136, 1401, 3408, 3200, 2038, 
-    587, -1102, -1529, -1129, -2075, -3786, -1565, 1394, -36, -1014, 
-    -3959, -6304, -1259, 2015, 1926, 878, -4164, -5697, -2274, -882, 
-    -1323, -1654, -1706, -893, -116, 365, 1097, 2507, 3891, 3848, 
-    3548, 910, -2256, -806, -511, 2499, 5567, 445, -3543, -1831, 
-    -227, -685, -768, -114, 872, 3492, 3777, 2960, 1293, -835, 
-    -1902, -2002, -1133, -1763, 1271, 5788, 3328, 451, -2143, -3951, 
-    -4486, -4297, -4628, -4464, -409, 2105, 3738, 4082, -1085, -2105, 
-    488, 1758, 2103, 1215, 561, -360, -1538, -989, -1210, 1123, 
-    5286, 2401, -1077, -1561, -1727, 672, 2232, -822, -2906, -260, 
-    1721, 2318, 2370, 43, -54, 542, 281, -1050, -1651, -1242, 
-    -1616, -2574, -2136, -835, -1097, -1932, -4451, -6648, -5167, -2037, 
-    -640, -397, 3358, 6538, 5460, 4277, 3872, 3695, 2954, 2812, 
-    2041, 1604, 2644, 638, -2179, -2971, -2658, -1611, -1839, 229, 
-    3521, 3408, 2957, 1153, -410, -1248, -1661, -2572, -4078, -2312, 
-    -1381, -2762, -2880, -2865, -2565, -1947, -1204, -1548, -351, 1726, 
-    2759, 4579, 3556, 350, 580, 1986, 317, -1652, -2156, -2710, 
-    858, 4090, 1413, -619, -595, -345, -228, -245, 1301, 1764, 
-    852, 65, -758, -1097, -1567, -1780, -98, 4, -3269, -427, 
-    6185, 3901, 492, -1476, -3820, 324, 4012, 2200, 357, -297, 
-    -481, 248, 1067, -2893, -4465, 2252, 3221, -1752, -3367, -2547, 
-    -1136, -1067, -497, 642, 1631, 3492, 2026, 36, -431, -780, 
-    -164, -51, 228, 1046, -23, -749, 2650, 4699, 648, -2081, 
-    -3141, -2910, -2544, -1880, 413, 1164, 633, 1080, 2622, 1988, 
-    789, -568, -3030, -1456, 787, -1511, -3670, -2838, -1404, -425, 
-    163, -354, -235, 551, 1562, 1519, 1617, 2255, 2112, 1759, 
-    837, -72, -623, -1076, -546, 335, 1056, 1399, 1600, 2231, 
-    -955, -3851, -3558, -2835, -1570, -1396, 1718, 3398, 788, -427, 
-    2284, 3565, 1639, 890, 1590, 582, -1553, -2524, -2530, -2292, 
-    -2516, -999, 1341, 1474, 1084, 1608, 2334, 2335, 2138, 1796, 
-    630, 1493, 960, -4584, -6697, -5258, -3673, -830, -478, -760, 
-    -592, -517, 200, -1447, 407, 3576, 1772, -1532, -1528, -115, 
-    -1139, -2603, -1458, -196, 631, 1204, -105, 362, -495, -517, 
-    3035, 4668, 5366, 5012, 3213, 3159, 2179, 2066, 4537, 1355, 
-    -4568, -3950, -2103, -52, 1816, 566, -165, 175, 225, -182, 
-    -793, -3017, -4488, -3152, -2388, -3670, -3700, -1974, -748, 243, 
-    247, -720, -856, -944, -403, -484, 587, 2896, 1926, -752, 
-    766, 3305, 1179, -1305, -558, 941, 710, 988, 1466, 1694, 
-    1142, 533, 1841, 1049, -1885, -2763, -3334, -2260, 1277, 952, 
-    -821, -267, 750, 2243, 3731, 2194, 328, 19, -684, 808, 
-    1286, 274, -194, -1634, -2103, -1024, -199, -683, -901, -72, 
-    276, 410, -620, -935, -2693, -4895, -3596, -1806, 159, 1661, 
-    2470, 3606, 1959, 174, 267, 385, 169, 18, 480, 896, 
-    2329, 3191, 763, -274, 440, 1423, 3745, 4226, 4340, 2903, 
-    -120, -493, -1179, -1118, -90, -2863, -5606, -5799, -4989, -4146, 
-    -3813, -1461, 945, -1040, -2201, -3531, -3711, 594, 1644, -981, 
-    -1505, 1194, 2018, 2362, 1511, -233, 420, 2118, 2261, 1475, 
-    2244, 3142, 3248, 3089, 1556, 489, -422, -700, -86, 213, 
-    1826, 2702, 1128, 608, 2472, 2405, -1561, -2347, -57, -174, 
-    -2625, -2838, -1135, -1207, -2019, -1730, -1143, -1174, -1355, -2287, 
-    -2648, -2550, -2029, -274, 919, 2461, 3241, 1818, 784, -22, 
-    -817, -1689, -1992, -3128, -2026, 460, 1411, 2051, 1770, 1521, 
-    1771, 1736, 3218, 4687, 2397, 419, -936, -2055, -273, 464, 
-    -230, -847, -2552, -2514, -1321, -293, 849, 905, 1554, -106, 
-    -3474, -3205, -2361, -708, 1593, 837, 187, -386, -761, 1295, 
-    3031, 3472, 3424, 3462, 3245, 2275, 1314, 176, -730, -1448, 
-    -1591, -1550, -1360, 638, -185, -2729, -3141, -3345, -2355, -1435, 
-    -1646, -1685, -2647, -3388, -1800, -131, 1060, 1915, 2748, 3402, 
-    3387, 3059, 1713, 792, -189, -880, 867, 165, -1551, -2035, 
-    -2982, -1541, 464, -935, -2848, -1234, 1559, 1791, 1233, 1867, 
-    2527, 2872, 2804, 1557, 693, 270, -231, 960, 1074, -1669, 
-    -2467, 116, 580, -1932, -1935, 236, 681, 20, -383, -632, 
-    -733, -740, -1140, -1381, -603, -106, 1427, 2473, 2009, 1502, 
-    -261, -1340, -973, -922, -1698, -1802, -423, 242, 760, 414, 
-    -394, -945, -1909, -1693, -1318, -974, -812, -255, 300, 1215, 
-    1891, 1858, 1994, 491, -619, 1227, 2163, 1328, 575, 336, 
-    326, -67, -132, 422, 384, 108, -183, -45, 4, -1014, 
-    346, 2761, 2012, 838, -271, -1260, -1131, -1229, -2042, -2622, 
-    -2621, -2554, -1275, -757, -1956, -1656, -179, 1187, 2628, 3025, 
-    3351, 2850, 775, 792, 1849, 700, -1077, -1710, -2139, -1255, 
-    -147, -1112, -1496, -851, -82, 1858, 2712, 2260, 1414, -1048, 
-    -1883, -2205, -1652, 199, 508, 583, 370, 276, 688, 948, 
-    707, -1155, -950, -238, -55, -105, 337, 817, -44, -525, 
-    -1755, -2068, -1344, -544, -246, -24, 1113, 802, -1239, -1113, 
-    765, 1356, 973, 803, 994, 1179, 955, 1572, 2458, 1980, 
-    1781, 327, -1531, -577, -402, -1535, -2292, -3478, -3500, -1223, 
-    81, 880, 865, -240, -345, -226, -148, 30, -136, -398, 
-    173, 633, 1753, 3111, 2754, 1899, 2058, 2035, 157, -1162, 
-    -795, -864, -385, -477, -272, -300, -1199, -1374, -500, -491, 
-    -1161, -1407, -1967, -1404, -1689, -783, 1169, 1103, 743, 676, 
-    476, 1310, 1902, 1002, 156, -185, -417, -43, 115, -623, 
-    -932, -535, -364, -1533, -2002, -597, -305, -417, -891, -2205, 
-    -1135, 947, 1362, 670, 1921, 3924, 2726, 1268, 1462, 1579, 
-    2150, 2145, -131, -1216, -1812, -1725, -87, -84, -964, -1086, 
-    -1061, -565, 284, 516, 600, 246, -478, -262, -35, -21, 
-    7, -810, -1465, -1468, -1281, -1005, -790, -161, 677, 205, 
-    116, 1506, 2168, 791, 147, 1501, 1401, 271, -441, -639, 
-    -847, -847, -812, -1084, -298, 828, 723, 284, 739, 1262, 
-    615, 64, -1133, -1665, -1063, -735, -102, -100, -479, -649, 
-    -1323, -1115, -101, -89, -977, -551, 349, 988, 1470, 1530, 
-    1838, 2111, 2169, 1860, 1194, 928, 699, -977, -1971, -684, 
-    -54, -471, -901, -856, -948, -2185, -2033, -1183, -662, 118, 
-    999, 2335, 1965, 566, 436, 418, 512, 428, -305, -890, 
-    -670, -532, 65, 193, -557, -1002, -1721, -1607, -1241, -716, 
-    1308, 1648, 1256, 841, -96, 136, 666, 471, 118, -428, 
-    -916, -769, -470, -658, -582, -549, -441, 902, 1704, 1349, 
-    1162, 425, 135, 1250, 1197, -344, -607, 631, 1201, 747, 
-    1081, 1302, 663, 15, -692, -875, -648, -621, -807, -1014, 
-    -1264, -1500, -1591, -1532, -1962, -1949, -949, -465, -135, -116, 
-    -957, -811, 122, 350, 294, 2, -195, -102, -33, 1006, 
-    2166, 2364, 2387, 1740, 1057, 530, 101, 57, -89, -2083, 
-    -2944, 335, 2004, 725, 487, 1239, 1845, 998, 929, 1652, 
-    1068, 385, 537, 797, 587, 114, -715, -1353, -1875, -2371, 
-    -1491, -795, -898, -963, -1041, -989, -545, -239, -1046, -872, 
-    420, 880, 1068, 675, -52, -475, -709, -938, -1338, -1014, 
-    -369, -111, 72, 452, 934, 728, 459, 443, 375, 49, 
-    -183, -254, -316, 401, 424, -73, -305, -710, -400, 330, 
-    611, 785, 624, 458, 276, -110, 206, 621, 482, 222, 
-    338, 645, 215, -130, 668, 1085, 773, 597, -71, -233, 
-    892, 909, -238, -597, -291, -168, -318, -234, 33, 9, 
-    -208, -311, -405, -945, -1068, -438, -162, 39, 163, -517, 
-    -901, -246, 37, -506, -720, -699, -436, -277, -140, 21, 
-    -247, -621, -1208, -1375, -703, -178, 663, 1538, 1230, 959, 
-    431, -72, 360, 532, 272, -13, -244, -264, -123, 35, 
-    488, 620, 682, 626, 353, 552, 649, 1017, 1828, 1277, 
-    207, 137, 21, 344, 307, -34, -181, -1004, -843, -41, 
-    -16, 233, 57, -860, -1342, -1223, -1084, -1402, -1174, -49, 
-    47, -735, -798, -428, -719, -1416, -1309, -1148, -448, 289, 
-    508, 710, 1187, 1609, 1706, 1752, 1159, 872, 701, 563, 
-    1086, 1007, 22, -233, 272, 223, -250, -440, -462, -391, 
-    10, 499, 57, 380, 1199, 22, -1055, -305, 327, -254, 
-    -812, -543, -425, -290, -476, -1432, -1725, -1284, -1044, -1170, 
-    -1012, -200, -207, -684, -317, 130, 939, 1775, 1548, 1453, 
-    529, -523, 543, 1169, 683, 384, 119, 566, 1081, 1091, 
-    1217, 1029, 644, 297, -449, -619, -134, -541, -1124, -1421, 
-    -2027, -1030, 688, 53, -977, -627, -106, 208, 248, -15, 
-    -180, -102, -82, 115, 76, -123, -284, -566, -518, -352, 
-    -95, 288, 403, 485, 348, 202, 74, -108, 171, 291, 
-    720, 1110, 185, -390, -800, -1068, 392, 1052, 120, -401, 
-    -402, -173, -3, 95, 331, 414, 414, 466, 452, 498, 
-    640, 388, 37, -89, -155, -31, -43, 188, 457, -286, 
-    -784, -574, -356, -220, -207, -83, 64, -169, -91, 543, 
-    488, -203, -412, -456, -436, -201, -531, -1038, -567, -89, 
-    520, 1125, 172, -610, -523, -445, 194, 448, -50, -295, 
-    2, 170, 79, 17, -49, 120, 12, 339, 1377, 987, 
-    -10, -283, -344, -15, 186, 493, 858, 458, 134, -72, 
-    -261, -252, -287, -1036, -1337, -751, -317, -249, -12, 541, 
-    732, 874, 560, -315, -339, -301, -8, 445, 146, -331, 
-    -266, 149, -309, -786, -291, 255, 249, 154, 746, 944, 
-    270, -177, -448, -476, -529, -422, 322, 284, -171, -252, 
-    -151, -121, 3, -294, -791, -296, 174, 499, 757, -30, 
-    -492, -477, -235, 250, 373, 1196, 1172, -302, -874, -928, 
-    -640, -203, 81, 272, 594, 1300, 1132, 452, 572, 821, 
-    783, 480, 447, 442, -122, -410, -1060, -1332, -725, -541, 
-    -607, -528, -39, 442, 507, 533, 222, 30, -189, -532, 
-    -1056, -1116, -938, -630, -189, 149, 627, 535, 566, 21, 
-    -373, -250, -237, 50, 87, -306, -427, -394, -224, 363, 
-    553, 71, 244, 884, 1032, 960, 538, -20, -247, -428, 
-    -402, -350, -288, -68, -271, -245, 7, 127, 992, 1205, 
-    323, -265, -1034, -1172, -444, -189, 43, 103, 412, 423, 
-    198, 171, 158, 124, -144, 59, 304, 208, 35, 137, 
-    151, 262, 263, -361, -667, -696, -539, 12, 159, 468, 
-    327, -744, -709, -117, 275, 699, 545, 335, 188, -8, 
-    145, 268, 290, 229, -68, -279, -832, -1136, -916, -695, 
-    -144, 196, 38, 84, 524, 671, 342, 222, 203, 179, 
-    108, 5, -12, -152, -305, -321, -215, -283, -310, -227, 
-    -40, 123, 266, 637, 824, 757, 586, 232, -62, -284, 
-    -408, -640, -448, -125, 268, 1188, 880, -131, -199, -136, 
-    -32, -82, -302, -588, -310, 2, -84, -174, -106, 17, 
-    -72, -100, 26, 60, 18, 62, -389, -260, 503, 582, 
-    619, 25, -984, -910, -630, -290, 53, -25, -157, -18, 
-    173, -248, -606, -502, -329, -210, -154, 400, 617, 345, 
-    171, 199, 170, -281, -145, 424, 626, 845, 736, 556, 
-    620, 701, 710, 660, 456, 275, 136, -32, 4, -79, 
-    -324, -460, -857, -896, -347, -113, 154, -12, -2, -262, 
-    -1015, -680, 38, 303, -158, -46, 622, 536, 379, -138, 
-    -515, -525, -619, -156, 147, -196, -426, 90, 277, -68, 
-    -325, -639, -716, -584, -555, -701, -570, 10, -104, -491, 
-    -309, 12, 368, 653, 682, 637, 629, 615, 232, -49, 
-    93, 213, 530, 675, 842, 874, 921, 860, 515, 443, 
-    559, 527, 399, 346, 149, 262, 501, -2, -549, -821, 
-    -390, -33, -464, -225, 70, -365, -650, -496, -423, -515, 
-    -748, -814, -1042, -1564, -1623, -1352, -1085, -761, -455, -133, 
-    248, 635, 732, 753, 561, 384, 316, 181, 549, 840, 
-    618, 524, 743, 927, 1056, 1041, 831, 646, 576, 355, 
-    -55, -150, -95, -11, 227, -18, -126, -569, -1135, -742, 
-    -316, -306, -384, -585, -711, -553, -462, -604, -676, -632, 
-    -533, -332, -131, -234, 36, 851, 906, 466, 227, 62, 
-    35, -133, 83, 338, 440, 603, 309, 84, 180, 291, 
-    316, 349, 269, 185, 591, 640, -56, -328, -68, -42, 
-    -371, -418, -145, -168, -243, -341, -558, -234, 186, 79, 
-    -89, -322, -525, -309, -156, -253, -280, -362, -250, 8, 
-    210, 652, 765, 445, 341, 379, 375, 328, 351, 268, 
-    499, 826, 637, 515, -154, -850, -613, -414, -96, 81, 
-    -68, -189, -17, 34, -442, -728, -589, -562, -682, -743, 
-    -710, -646, -423, -335, -461, -109, 496, 565, 465, 540, 
-    573, 738, 903, 517, 106, 380, 539, 303, 94, -107, 
-    -113, -19, 56, 283, 186, -176, -418, -725, -693, -530, 
-    -429, -280, -256, -243, -99, 107, 136, 48, 262, 437, 
-    13, -317, -207, -43, -80, -52, 395, 597, 458, 348, 
-    205, 133, -180, -119, 101, 209, 223, 311, 600, 387, 
-    129, 231, 283, 613, 839, 443, 105, -71, -221, -321, 
-    -422, -689, -778, -343, -243, -521, -554, -394, -382, -401, 
-    -648, -1001, -961, -789, -554, -281, -105, 83, 222, 401, 
-    175, 34, 131, 225, 268, 245, 452, 535, 235, 205, 
-    702, 750, 398, 337, 336, 478, 686, 551, 325, 134, 
-    -38, -117, -198, -285, -307, -346, -427, -46, 229, -356, 
-    -597, -124, 180, 232, 214, 301, 256, 39, -66, -167, 
-    -135, -141, -50, 182, -52, -349, -494, -544, -485, -514, 
-    -128, 166, 12, -19, -75, -5, 356, 494, 287, 133, 
-    187, 110, -315, -349, -10, 14, -191, -36, 247, 257, 
-    189, -90, -307, -501, -650, -432, -236, -28, 160, 276, 
-    393, 429, 420, 276, 233, -13, 33, 311, 366, 385, 
-    274, 130, 89, 57, -12, -112, -143, -174, -75, 22, 
-    -1, -22, -37, -17, 78, 159, 44, -41, 120, 53, 
-    -272, -443, -610, -536, -360, -234, 25, 15, -153, 3, 
-    213, 139, 45, -259, -531, -353, -184, -96, -56, 33, 
-    157, 34, 49, 269, 423, 287, 336, 657, 664, 538, 
-    309, 51, -58, -263, 8, 474, 285, 27, -168, -248, 
-    -271, -295, -188, -113, 10, 90, 81, 108, 131, 151, 
-    126, 13, -11, -198, -705, -687, -297, -298, -427, -471, 
-    -371, -344, -331, -222, -105, 20, 148, 193, 229, 353, 
-    386, 363, 293, 94, 58, 9, 110, 457, 529, 561, 
-    376, 71, -15, -187, -48, 143, 170, 121, 202, 332, 
-    163, 56, -109, -244, 205, 409, 84, -174, -318, -367, 
-    -493, -497, -312, -259, -195, -210, -351, -194, 23, 40, 
-    78, -246, -695, -479, -173, -180, -215, -143, -35, 100, 
-    220, 54, 52, 187, 315, 619, 680, 459, 370, 440, 
-    351, 50, 14, 141, 130, 74, -4, 11, -147, -375, 
-    -185, 56, -196, -441, -142, 106, -3, -51, 56, 111, 
-    251, 219, -104, -144, -44, 65, 266, 156, -63, -162, 
-    -194, -215, -317, -145, 89, 20, -80, -20, 58, -121, 
-    -252, -147, -67, 19, 67, -44, -3, 269, 326, 198, 
-    120, 48, 13, -12, -66, -218, -70, 181, 180, 133, 
-    113, 119, 102, 69, 89, 79, 43, 25, -54, -74, 
-    56, 71, 45, -55, -231, -295, -427, -368, -173, -226, 
-    -326, -443, -514, -461, -396, -163, 65, 191, 281, 307, 
-    383, 190, 95, 414, 536, 302, 172, 232, 236, 156, 
-    122, 83, 94, 208, 113, -49, -86, -161, 51, 295, 
-    201, 106, 37, 48, 52, -12, 103, 96, -226, -389, 
-    -421, -417, -293, -300, -459, -422, -144, -31, -47, 68, 
-    243, 292, 284, 207, 104, 22, -77, -89, -127, -193, 
-    -227, -306, -277, -127, 1, 273, 395, 238, 222, 304, 
-    319, 211, 126, 144, 28, -180, -173, -84, -41, 2, 
-    9, -3, 94, 191, 26, -117, -136, -165, -181, -227, 
-    -238, -213, -293, -241, 27, 95, -25, -35, -5, 48, 
-    73, 122, 93, 235, 489, 291, 87, 92, 129, 344, 
-    481, 480, 457, 312, 193, 201, 109, -157, -296, -287, 
-    -282, -235, -247, -231, -268, -238, -342, -519, -436, -394, 
-    -211, -23, -259, -465, -445, -330, -271, -197, 185, 400, 
-    412, 375, 186, 123, 57, 53, 94, 73, 88, 59, 
-    -18, 65, 258, 225, 115, 184, 215, 380, 535, 221, 
-    -30, 69, 128, 253, 226, -36, -194, -268, -297, -346, 
-    -358, -363, -345, -257, -276, -379, -276, -70, 15, 14, 
-    147, 332, 236, 127, 113, 119, 200, 254, 184, 148, 
-    242, 275, 219, 169, 107, 77, 61, 20, -79, -63, 
-    0, 71, 168, 141, 35, -2, 30, -247, -569, -382, 
-    -184, -214, -237, -173, -94, -36, -44, -126, -182, -323, 
-    -326, -235, -177, -166, -81, 51, 151, 281, 222, 107, 
-    103, 57, 192, 306, 230, 132, 108, 95, -35, -123, 
-    -106, -88, -12, 13, -61, -52, 35, 107, 118, 189, 
-    318, 277, 155, 97, 90, 82, 16, 107, 238, 60, 
-    -101, -43, -13, -8, -25, -161, -220, -85, -80, -270, 
-    -356, -309, -277, -272, -257, -189, -201, -265, -235, -190, 
-    -108, -26, 47, 118, 177, 225, 280, 324, 363, 363, 
-    404, 403, 161, 56, 134, 171, 193, 156, 140, 100, 
-    21, 22, 11, 9, 0, -58, -107, -160, -202, -204, 
-    -214, -163, -138, -215, -260, -305, -300, -191, -124, -88, 
-    -38, 37, 83, 71, 38, 56, 0, -125, -33, 119, 
-    188, 235, 231, 252, 170, 87, 74, 48, 84, 82, 
-    65, 43, -79, -135, -37, -22, -118, -170, -134, -135, 
-    -210, -169, -71, -38, -31, -93, -120, -193, -278, -86, 
-    128, 158, 172, 273, 366, 337, 278, 209, 135, -64, 
-    -146, -94, -80, -42, -61, -62, -79, -162, -75, 52, 
-    114, 174, 165, 107, 170, 220, 94, -23, -55, -59, 
-    -46, -40, -12, 24, -6, 4, 223, 227, -75, -95, 
-    33, 117, 216, 74, -124, -226, -286, -288, -267, -303, 
-    -329, -183, -60, -20, 11, -103, -157, -83, -52, -124, 
-    -143, -97, -84, -19, -50, -168, -134, -36, 74, 146, 
-    253, 391, 395, 316, 350, 400, 194, 15, 39, 58, 
-    133, 139, 88, 42, -34, -74, -139, -145, -96, -77, 
-    -16, -20, -56, -18, 62, 123, 154, 201, 234, 187, 
-    140, -66, -243, -158, -93, -10, -5, -18, -44, -179, 
-    -219, -201, -175, -146, -173, -125, -214, -437, -417, -319, 
-    -210, -89, -86, -84, -30, 29, 33, 36, 68, 78, 
-    212, 302, 252, 266, 355, 421, 522, 500, 362, 269, 
-    142, 88, 105, 16, -154, -133, -37, -27, -31, -55, 
-    -80, -83, -97, -157, -222, -198, -181, -245, -260, -242, 
-    -202, -37, 13, -98, -78, 16, 78, 106, 100, 77, 
-    73, 57, 43, 54, -14, -103, -59, -6, -39, -50, 
-    -33, 1, 89, 134, 72, 31, 124, 125, -64, -83, 
-    49, 109, 163, 145, 99, 106, 120, 138, 140, 145, 
-    129, 106, 85, -74, -209, -174, -165, -160, -171, -279, 
-    -302, -213, -157, -135, -110, -91, -79, -81, -93, -93, 
-    -105, -153, -114, -45, -22, 14, 12, 25, 66, 86, 
-    131, 165, 122, 123, 131, 152, 309, 306, 130, 46, 
-    -36, 0, 120, 137, 113, 92, 91, 46, -11, -13, 
-    -22, 21, 58, 40, 30, -16, -44, 16, 43, 35, 
-    7, -47, -82, -98, -107, -118, -109, -140, -86, 64, 
-    83, 57, 71, 84, 56, -14, -48, -89, -91, -100, 
-    -136, -146, -79, -27, 58, 91, -45, -96, -64, -54, 
-    -72, -123, -129, -202, -342, -313, -211, -151, -99, -96, 
-    -90, -31, 42, 79, 119, 192, 252, 302, 294, 306, 
-    273, 92, 27, 71, 123, 190, 233, 358, 349, 216, 
-    212, 276, 171, -8, -68, -119, -146, -178, -201, -206, 
-    -124, -43, -84, -99, -86, -91, -62, -94, -166, -222, 
-    -279, -257, -193, -117, 26, 16, -90, -47, 46, -5, 
-    -127, -116, -95, -69, -57, -61, -32, 58, 145, 195, 
-    234, 316, 326, 180, 116, 32, 23, 28, 37, 83, 
-    72, 72, 44, 12, -4, -22, 22, 61, 113, 154, 
-    49, -56, 14, 52, -3, -53, -131, -164, -197, -218, 
-    -135, -129, -248, -231, -128, -95, -83, -63, -36, 22, 
-    101, 126, 126, 133, 147, 31, -72, 3, 47, 38, 
-    14, -44, -59, -79, -54, 86, 100, 42, -4, -69, 
-    -29, 56, 99, 120, 120, 119, 140, 180, 131, 62, 
-    63, 55, 5, -38, -80, -86, -28, 1, 12, -12, 
-    -65, -116, -166, -186, -256, -175, 2, 84, 172, 117, 
-    39, 2, -33, -74, -110, -145, -169, -95, -36, -62, 
-    -56, -18, 50, 76, 122, 227, 242, 210, 146, 5, 
-    -12, 48, 30, 17, -15, -44, -57, -91, -103, -84, 
-    -140, -165, -74, -28, 18, 34, -69, -77, 5, 61, 
-    123, 101, 44, 15, -32, 4, 75, 72, 52, 14, 
-    -25, -28, -8, -3, -9, 51, 109, 92, 68, 56, 
-    40, 24, 30, -1, 5, 116, 125, 45, -9, -70, 
-    -96, -79, -101, -146, -98, -38, 8, 54, -37, -138, 
-    -100, -48, -107, -160, -94, -40, -18, 1, 28, 42, 
-    42, 41, 60, 64, 12, -5, 29, 27, 5, 35, 
-    85, 50, -16, -38, -35, -27, -16, 10, 29, 42, 
-    40, 17, -10, -45, -54, -56, -24, 39, 73, 127, 
-    109, 20, 19, 29, 43, 50, 27, 8, -15, -30, 
-    -18, -13, -41, -66, -36, 14, 22, 28, 91, 107, 
-    11, 3, 81, 109, 101, 44, -25, -75, -118, -148, 
-    -175, -204, -223, -150, -36, 29, 76, 126, 152, 81, 
-    7, 30, 31, -58, -122, -148, -144, -93, -67, -59, 
-    -49, -41, -2, 34, 69, 111, 54, -30, -21, 15, 
-    6, -26, 0, 37, 28, 36, 43, 66, 115, 129, 
-    98, 72, 52, 48, 55, 60, 90, 65, 0, 16, 
-    83, 83, 52, 54, 55, 34, -5, -54, -93, -110, 
-    -103, -54, -17, 32, 28, 4, -42, -151, -183, -179, 
-    -159, -123, -100, -53, -61, -63, -87, -126, -91, -46, 
-    -8, 22, 32, 50, 113, 164, 172, 177, 163, 144, 
-    113, 74, 54, 19, -11, -22, -51, -15, 94, 66, 
-    -17, -51, -68, -75, -96, -77, -45, -51, -42, 24, 
-    93, 67, 35, 68, 59, 7, -24, -76, -71, 10, 
-    35, 60, 38, -9, -28, -10, -72, -184, -173, -130, 
-    -104, -84, -76, -41, -52, -50, 39, 100, 81, 73, 
-    111, 150, 169, 195, 191, 172, 201, 119, -32, -65, 
-    -56, -36, -23, -52, -61, -84, -90, -65, -46, 30, 
-    73, 34, -8, 9, 19, -23, -62, -140, -150, -47, 
-    -30, -67, -86, -95, -79, -54, -55, -49, -28, -17, 
-    42, 104, 105, 97, 109, 117, 68, 34, 45, 66, 
-    104, 111, 101, 66, -12, -48, -60, -63, -57, -71, 
-    -73, -123, -186, -189, -167, -146, -124, -13, 91, 125, 
-    148, 131, 124, 134, 114, 118, 98, 14, -31, -30, 
-    -38, -40, -28, 4, 38, 61, 51, 26, -7, -42, 
-    -18, 4, 0, -13, -89, -150, -118, -87, -82, -73, 
-    -71, -55, -17, 11, 17, 53, 89, 119, 157, 134, 
-    85, 66, 57, 64, 73, 53, 27, 37, 45, 54, 
-    51, 0, -29, -3, 17, 10, -7, -33, -67, -110, 
-    -138, -150, -144, -113, -101, -103, -91, -65, -75, -114, 
-    -84, -34, 13, 42, 55, 68, 0, -53, -33, -24, 
-    -1, 28, 58, 90, 123, 124, 95, 79, 68, 48, 
-    35, 8, -29, -28, -13, 1, 22, 39, 67, 96, 
-    119, 102, 71, 64, 49, 18, 6, 38, 47, 28, 
-    3, -10, -19, -59, -67, -48, -61, -73, -84, -98, 
-    -69, -37, -47, -61, -67, -59, -63, -79, -81, -89, 
-    -95, -87, -66, -58, -64, -69, -80, -35, 54, 95, 
-    105, 77, 37, 0, -55, -6, 73, 70, 47, 54, 
-    67, 94, 121, 98, 82, 136, 171, 125, 99, 130, 
-    112, 35, -15, -34, -27, -2, 13, 22, 21, 22, 
-    -1, -30, -13, -1, -7, -14, -41, -66, -96, -117, 
-    -98, -82, -83, -73, -59, -59, -83, -86, -68, -76, 
-    -88, -115, -159, -128, -55, -49, -66, -56, -30, 6, 
-    29, 17, 0, 0, 16, 25, 34, 89, 101, 76, 
-    44, 3, 25, 82, 127, 142, 151, 179, 170, 171, 
-    146, 91, 106, 117, 95, 69, 28, -2, -35, -58, 
-    -50, -51, -80, -105, -113, -109, -100, -82, -62, -65, 
-    -75, -99, -138, -107, -38, -9, 1, 30, 59, 76, 
-    81, 42, 3, 25, 44, 28, 20, 18, 7, 8, 
-    -21, -35, -57, -110, -107, -91, -78, -45, -45, -70, 
-    -38, 25, -5, -56, -44, -25, -19, -19, -28, -31, 
-    4, 32, 58, 79, 101, 120, 124, 121, 119, 107, 
-    80, 69, 57, 54, 63, 32, 4, 8, 20, 32, 
-    29, 20, 6, -20, -31, -35, -31, -10, -11, -35, 
-    -58, -53, -51, -88, -81, -38, -41, -68, -95, -111, 
-    -122, -136, -113, -72, -70, -63, -29, 5, 67, 118, 
-    96, 81, 79, 79, 57, 52, 61, 62, 107, 106, 
-    54, 65, 118, 117, 67, 51, 48, 12, -22, -43, 
-    -64, -49, -33, -57, -67, -91, -106, -76, -58, -78, 
-    -77, -53, -30, -19, -4, 59, 75, 47, 52, 69, 
-    65, 57, 53, 44, 30, 7, -20, -38, -54, -61, 
-    -59, -57, -91, -103, -50, -15, -3, 3, -4, -10, 
-    -22, -9, 29, 42, 38, 12, -15, -39, -62, -28, 
-    18, 24, 22, 30, 56, 69, 69, 93, 83, 10, 
-    -19, 21, 26, -10, -29, -28, -6, 27, 37, 40, 
-    21, 11, 7, -9, 12, 30, 28, 25, 10, -4, 
-    -9, -27, -48, -70, -71, -73, -112, -127, -105, -87, 
-    -67, -32, 29, 47, 37, 40, 40, 31, 26, 7, 
-    -16, -3, 16, 39, 58, 55, 41, 40, 34, 1, 
-    -8, 8, 15, 22, 10, -10, -4, 18, 30, 32, 
-    1, -40, -38, -12, 22, 52, 48, 38, 40, 42, 
-    51, 60, 47, 38, 39, 15, -5, -23, -56, -60, 
-    -49, -42, -30, -27, -31, -39, -44, -64, -74, -78, 
-    -93, -71, -61, -61, -60, -69, -69, -53, -27, -21, 
-    -11, 38, 63, 43, 39, 70, 66, 39, 42, 57, 
-    67, 72, 53, 38, 25, 12, 39, 53, 45, 29, 
-    22, 19, -18, -48, -23, -9, -20, -10, 8, 19, 
-    11, 0, -3, -20, -32, -39, -48, -24, 15, 6, 
-    -26, -14, 10, 19, 29, 27, 20, 29, 37, 31, 
-    22, 18, 8, 5, 10, 5, -16, -46, -74, -85, 
-    -87, -76, -55, -43, -10, 22, 21, 25, 23, 23, 
-    19, 7, -12, -28, -9, 8, 5, 0, -4, -12, 
-    -30, -48, -54, -35, -7, 41, 105, 113, 88, 73, 
-    57, 50, 33, 17, 10, 6, 1, -2, -3, -19, 
-    -23, -9, -5, 9, 5, -34, -48, -30, -20, -20, 
-    -29, -45, -46, -34, -27, -23, -21, -22, -31, -34, 
-    -15, 8, 11, 1, 0, -6, -28, -21, 17, 50, 
-    71, 59, 28, 8, -12, 5, 52, 65, 62, 67, 
-    67, 42, 16, 1, 0, 19, 27, 10, -16, -34, 
-    -48, -63, -62, -53, -29, 5, 20, 16, 0, -3, 
-    -6, -28, -30, -19, -25, -30, -6, 16, 15, 5, 
-    -14, -26, -25, -22, -15, -13, -16, -31, -36, -31, 
-    -29, -7, 12, 14, 14, 7, 5, 13, 26, 5, 
-    -26, -18, 12, 20, 19, 26, 29, 43, 54, 60, 
-    66, 56, 48, 31, 13, 8, -6, -26, -28, -27, 
-    -25, -14, -12, -2, 19, 35, 27, 8, -14, -34, 
-    -31, -32, -41, -47, -64, -61, -34, -4, 46, 69, 
-    60, 44, 22, 18, 20, 28, 49, 34, -4, -22, 
-    -22, -35, -53, -47, -33, -23, -17, -21, -28, -26, 
-    -27, -41, -44, -35, -17, 25, 44, 34, 1, -54, 
-    -57, -19, -1, -5, 12, 34, 47, 68, 68, 55, 
-    56, 41, 12, -15, -36, -41, -18, -10, -39, -54, 
-    -26, -4, -9, 4, 42, 57, 53, 64, 81, 78, 
-    61, 31, -10, -34, -50, -73, -74, -67, -48, 18, 
-    60, 41, 16, -10, -33, -35, -32, -30, -12, 15, 
-    27, 32, 27, 19, 15, 13, 11, 16, 9, -3, 
-    -5, -4, 7, 9, 0, -5, -8, -15, -18, -30, 
-    -54, -60, -54, -53, -60, -67, -66, -63, -46, -22, 
-    9, 39, 59, 67, 68, 74, 82, 84, 84, 87, 
-    79, 52, 26, 12, 8, 11, 21, 22, 11, 8, 
-    -13, -39, -39, -38, -37, -34, -55, -82, -94, -93, 
-    -65, -30, -22, -22, -19, -15, -29, -33, -10, 13, 
-    27, 38, 57, 56, 36, 31, 32, 42, 48, 26, 
-    -1, -20, -20, -4, 5, 12, 13, -10, -27, -28, 
-    -17, 11, 31, 42, 40, 24, 13, 15, 10, -11, 
-    -20, -19, -10, 2, 6, 1, -2, 5, 1, 0, 
-    12, 18, 8, -9, -16, -16, 5, 15, -20, -39, 
-    -18, -3, -2, -6, -12, -20, -44, -51, -38, -45, 
-    -50, -39, -19, 4, 22, 36, 46, 48, 42, 38, 
-    39, 31, 21, 19, 9, -11, -22, -17, -9, -8, 
-    1, 7, 4, 3, -3, -8, 13, 41, 30, 3, 
-    -5, -9, -11, -18, -33, -26, 11, 49, 70, 71, 
-    48, 17, -3, -22, -39, -36, -29, -10, 12, 20, 
-    17, 10, 4, 4, -4, -35, -69, -72, -56, -53, 
-    -49, -32, -21, -19, -18, -14, -1, 19, 28, 20, 
-    16, 27, 23, 8, 9, 15, 12, 0, -28, -60, 
-    -62, -43, -11, 21, 34, 39, 32, 20, 22, 21, 
-    13, 18, 33, 56, 75, 84, 97, 86, 59, 48, 
-    41, 22, -11, -64, -109, -103, -67, -29, -5, 16, 
-    30, 16, -6, -28, -44, -37, -29, -34, -34, -21, 
-    -25, -45, -51, -49, -40, -20, -20, -39, -41, -32, 
-    -7, 26, 34, 30, 23, 14, 28, 47, 44, 50, 
-    69, 67, 48, 27, 16, 7, -11, -14, -1, 10, 
-    19, 23, 23, 19, 3, -26, -48, -61, -67, -61, 
-    -46, -28, -12, 10, 33, 51, 64, 67, 59, 51, 
-    33, 3, -15, -21, -19, -15, -24, -36, -42, -43, 
-    -26, 3, 27, 40, 43, 48, 41, 22, 1, -23, 
-    -34, -43, -58, -67, -64, -62, -48, -42, -48, -38, 
-    -28, -28, -17, 5, 28, 39, 38, 39, 40, 29, 
-    20, 29, 36, 23, 7, 0, -3, -2, 6, 24, 
-    54, 81, 89, 78, 40, -6, -27, -29, -21, -9, 
-    -5, -4, -1, 0, -2, -7, -13, -19, -25, -19, 
-    5, 20, 7, -4, 2, -11, -46, -67, -68, -59, 
-    -44, -32, -28, -25, -24, -23, -19, 3, 28, 41, 
-    46, 34, 21, 19, 22, 28, 29, 31, 24, 5, 
-    -7, -10, -4, 3, 6, 5, 1, -2, -11, -28, 
-    -22, -5, -14, -25, -11, 7, 13, 10, 0, -1, 
-    17, 34, 37, 28, 14, 2, -5, -1, 6, -4, 
-    -22, -19, -1, -1, -15, -21, -10, 8, 27, 44, 
-    51, 40, 29, 37, 48, 50, 37, 8, -23, -52, 
-    -62, -49, -45, -43, -35, -32, -23, -15, -14, -15, 
-    -23, -29, -29, -25, -25, -29, -21, -12, -12, -12, 
-    -2, 16, 26, 26, 17, 9, 11, 20, 31, 34, 
-    26, 17, 16, 19, 24, 31, 34, 25, 14, 13, 
-    10, 3, -8, -20, -27, -27, -21, -7, 7, 11, 
-    10, 13, 15, 19, 19, 13, 7, -4, -7, -6, 
-    -9, -4, 7, 10, -1, -21, -37, -39, -29, -17, 
-    -5, -6, -22, -34, -29, -22, -17, -8, 1, 5, 
-    -5, -29, -50, -50, -33, -17, -9, 5, 27, 41, 
-    47, 44, 35, 29, 31, 34, 31, 14, -1, 0, 
-    11, 32, 48, 50, 43, 27, 13, 7, 12, 16, 
-    4, -14, -27, -30, -24, -19, -17, -18, -25, -32, 
-    -31, -26, -22, -16, -8, 2, 14, 23, 21, 12, 
-    1, -17, -37, -40, -27, -17, -10, -5, -7, -18, 
-    -27, -19, 0, 20, 38, 47, 44, 27, 7, -5, 
-    -6, 5, 14, 24, 32, 34, 27, 15, 5, -3, 
-    -4, 1, 5, 6, 1, -16, -45, -65, -71, -56, 
-    -13, 27, 49, 51, 37, 12, -20, -38, -34, -25, 
-    -18, -12, -6, -8, -9, 6, 23, 18, -5, -24, 
-    -28, -25, -19, -4, 11, 22, 31, 41, 46, 39, 
-    28, 14, 2, 0, 1, 7, 22, 36, 41, 34, 
-    16, -6, -25, -32, -33, -32, -24, -21, -26, -27, 
-    -25, -19, -5, -3, -21, -39, -42, -31, -16, 2, 
-    17, 27, 31, 28, 25, 24, 22, 23, 23, 21, 
-    24, 29, 25, 14, -1, -6, 3, 15, 18, 8, 
-    -10, -34, -45, -40, -34, -31, -25, -12, -3, -8, 
-    -15, -24, -25, -13, 1, 12, 19, 14, 2, -8, 
-    -11, -10, -13, -14, -5, 12, 23, 22, 19, 16, 
-    9, 8, 14, 22, 31, 45, 58, 60, 54, 44, 
-    37, 26, 8, -11, -27, -40, -47, -52, -55, -52, 
-    -44, -27, -15, -16, -23, -29, -29, -19, -5, 5, 
-    4, 0, 3, 12, 24, 35, 41, 38, 26, 8, 
-    -6, -11, -9, -6, -7, -15, -29, -38, -36, -21, 
-    1, 17, 16, 8, 1, -7, -7, 8, 31, 46, 
-    41, 28, 16, 5, -1, -1, 5, 13, 22, 24, 
-    13, -6, -19, -26, -34, -41, -39, -25, -6, 6, 
-    11, 15, 19, 23, 26, 25, 18, 7, -9, -23, 
-    -25, -16, -2, 11, 18, 9, -7, -18, -20, -14, 
-    -4, 6, 12, 6, -10, -19, -26, -37, -44, -44, 
-    -35, -15, 10, 26, 28, 21, 15, 17, 23, 26, 
-    27, 29, 30, 26, 20, 13, 3, -8, -18, -25, 
-    -25, -19, -8, 5, 15, 12, -5, -30, -45, -42, 
-    -27, -10, 0, 0, -5, -3, 10, 22, 20, 7, 
-    -8, -19, -18, -2, 19, 40, 55, 56, 42, 22, 
-    4, -11, -26, -41, -49, -43, -21, 6, 30, 41, 
-    40, 32, 23, 18, 13, 1, -14, -26, -29, -21, 
-    0, 29, 49, 49, 36, 22, 11, -3, -29, -58, 
-    -75, -76, -67, -51, -34, -20, -9, -2, -4, -10, 
-    -15, -20, -26, -34, -36, -24, 3, 37, 66, 81, 
-    80, 71, 58, 44, 30, 16, 3, -10, -16, -16, 
-    -11, -1, 9, 15, 18, 17, 16, 16, 11, -1, 
-    -14, -25, -35, -44, -49, -47, -38, -29, -23, -22, 
-    -22, -9, 13, 31, 31, 16, -7, -21, -20, -8, 
-    6, 12, 12, 15, 28, 43, 52, 50, 40, 26, 
-    11, -6, -18, -17, -9, -3, -6, -12, -10, -3, 
-    -4, -16, -29, -34, -32, -32, -35, -31, -14, 15, 
-    38, 42, 26, 3, -14, -22, -19, -11, -8, -13, 
-    -16, -12, -2, 6, 10, 9, 7, 11, 23, 37, 
-    47, 49, 36, 11, -14, -22, -11, 6, 14, 11, 
-    2, -10, -20, -22, -18, -10, -2, 8, 16, 18, 
-    16, 14, 11, 2, -9, -16, -15, -11, -9, -11, 
-    -15, -16, -12, -6, 5, 17, 24, 20, 15, 17, 
-    26, 29, 21, 3, -20, -40, -54, -62, -61, -49, 
-    -30, -10, 10, 25, 29, 27, 29, 34, 35, 33, 
-    31, 21, 3, -9, -6, 5, 12, 7, -6, -19, 
-    -25, -20, -11, -5, -4, -8, -18, -29, -31, -25, 
-    -21, -22, -26, -25, -15, 5, 26, 40, 45, 39, 
-    23, 1, -18, -25, -19, -6, 9, 20, 28, 34, 
-    39, 39, 35, 22, 2, -12, -10, 7, 26, 39, 
-    43, 43, 39, 28, 7, -23, -52, -72, -73, -60, 
-    -45, -35, -29, -26, -26, -28, -29, -28, -24, -20, 
-    -14, -4, 6, 17, 26, 29, 26, 16, 2, -10, 
-    -12, 0, 20, 37, 47, 48, 41, 27, 11, 3, 
-    7, 16, 17, 6, -13, -31, -41, -39, -29, -15, 
-    -7, -4, 0, 3, 5, 5, 3, -3, -12, -19, 
-    -14, 0, 12, 13, 8, 10, 22, 39, 50, 52, 
-    47, 34, 11, -13, -30, -42, -46, -42, -34, -27, 
-    -16, 2, 21, 31, 28, 18, 6, -2, -7, -10, 
-    -14, -13, -5, 4, 10, 15, 19, 16, -1, -23, 
-    -36, -33, -19, -7, -7, -14, -21, -19, -11, -5, 
-    -5, -3, 6, 16, 20, 14, 3, -6, -7, -4, 
-    -1, 2, 1, -4, -13, -23, -27, -20, -1, 21, 
-    34, 31, 15, 1, -1, 6, 15, 19, 16, 12, 
-    11, 14, 18, 23, 30, 34, 30, 20, 13, 12, 
-    12, 6, -6, -16, -15, -10, -14, -29, -39, -37, 
-    -26, -11, 4, 15, 17, 9, -12, -38, -55, -54, 
-    -40, -22, -4, 12, 23, 29, 33, 34, 27, 13, 
-    -3, -19, -33, -39, -34, -19, 0, 18, 29, 29, 
-    22, 12, 5, -1, -9, -15, -17, -13, -3, 7, 
-    14, 17, 18, 19, 20, 17, 8, -2, -10, -14, 
-    -17, -15, -4, 14, 26, 24, 10, -9, -30, -45, 
-    -41, -19, 13, 41, 53, 45, 25, 5, -11, -26, 
-    -36, -37, -26, -12, -2, 5, 9, 7, -6, -19, 
-    -20, -8, 6, 11, 11, 13, 20, 21, 13, 6, 
-    8, 17, 20, 11, -5, -20, -23, -14, -1, 5, 
-    1, -10, -20, -24, -20, -8, 6, 14, 12, 4, 
-    -4, -9, -15, -17, -9, 11, 36, 51, 49, 34, 
-    17, 3, -6, -13, -21, -33, -41, -38, -27, -15, 
-    -6, 1, 6, 14, 25, 34, 35, 24, 6, -13, 
-    -28, -32, -27, -23, -25, -29, -28, -17, 2, 23, 
-    38, 43, 41, 29, 11, -6, -13, -6, 12, 28, 
-    33, 23, 9, 2, 2, 6, 12, 17, 20, 17, 
-    7, -4, -8, -4, -2, -11, -26, -38, -44, -51, 
-    -60, -72, -82, -83, -68, -40, -10, 13, 29, 42, 
-    50, 52, 48, 45, 44, 42, 42, 45, 50, 50, 
-    44, 35, 28, 18, 6, -2, -5, -9, -15, -21, 
-    -27, -36, -43, -41, -32, -26, -28, -33, -36, -36, 
-    -36, -35, -29, -18, -7, 0, 5, 10, 16, 24, 
-    31, 35, 39, 43, 48, 50, 48, 42, 35, 29, 
-    20, 7, -2, -5, -4, -5, -10, -16, -24, -35, 
-    -44, -46, -40, -33, -31, -32, -31, -23, -3, 20, 
-    30, 19, -3, -20, -27, -28, -30, -32, -31, -25, 
-    -11, 10, 34, 47, 49, 44, 36, 29, 27, 28, 
-    29, 26, 24, 26, 27, 24, 24, 26, 25, 18, 
-    6, -4, -13, -21, -30, -35, -38, -41, -44, -48, 
-    -56, -61, -58, -47, -34, -24, -16, -4, 12, 34, 
-    53, 60, 52, 34, 18, 11, 15, 23, 26, 22, 
-    11, -2, -7, 2, 16, 26, 25, 15, 1, -9, 
-    -18, -30, -50, -73, -84, -69, -33, 8, 36, 49, 
-    50, 46, 40, 37, 41, 43, 32, 4, -31, -59, 
-    -70, -62, -41, -20, -6, 4, 15, 28, 37, 36, 
-    29, 20, 8, -7, -19, -24, -22, -14, -2, 7, 
-    14, 21, 25, 25, 21, 11, -3, -17, -26, -30, 
-    -30, -29, -26, -16, 0, 17, 32, 42, 42, 29, 
-    9, -10, -23, -27, -25, -22, -18, -9, 2, 8, 
-    4, -3, -7, -6, -4, -3, -1, 4, 13, 22, 
-    29, 29, 20, 4, -9, -11, -4, 5, 8, 4, 
-    -10, -29, -38, -28, -11, -5, -14, -24, -26, -13, 
-    10, 34, 44, 36, 16, -4, -13, -9, 1, 11, 
-    15, 12, 9, 9, 9, 9, 8, 12, 18, 20, 
-    14, 1, -13, -21, -20, -12, -6, -6, -6, -3, 
-    0, -2, -8, -12, -5, 11, 28, 35, 33, 30, 
-    24, 12, -6, -24, -35, -35, -32, -30, -26, -19, 
-    -15, -24, -38, -48, -49, -40, -26, -9, 4, 11, 
-    10, 7, 10, 22, 39, 51, 52, 43, 33, 27, 
-    30, 33, 28, 18, 9, -1, -10, -15, -14, -8, 
-    0, 2, -2, -6, -9, -13, -24, -38, -44, -33, 
-    -10, 13, 23, 21, 10, -1, -3, 3, 11, 14, 
-    13, 9, 2, -5, -12, -14, -11, -10, -15, -19, 
-    -17, -8, 6, 18, 24, 22, 14, 8, 11, 13, 
-    5, -13, -30, -38, -37, -28, -15, 0, 15, 29, 
-    41, 46, 43, 34, 19, 7, 1, -3, -10, -22, 
-    -32, -38, -39, -33, -19, -4, 4, 2, -5, -10, 
-    -10, -3, 9, 22, 22, 5, -16, -23, -14, -1, 
-    7, 11, 18, 32, 46, 55, 57, 46, 25, 1, 
-    -20, -34, -38, -30, -16, -7, -9, -19, -28, -28, 
-    -23, -14, -5, -2, -2, -1, 1, -1, -7, -15, 
-    -14, -1, 11, 16, 15, 12, 2, -16, -28, -24, 
-    -7, 10, 18, 17, 12, 14, 21, 26, 23, 22, 
-    26, 29, 24, 10, -9, -22, -23, -16, -7, -2, 
-    1, 5, 15, 26, 31, 20, 2, -12, -19, -19, 
-    -14, -5, 0, -5, -13, -17, -17, -21, -29, -36, 
-    -37, -32, -20, -6, 7, 18, 22, 17, 4, -11, 
-    -23, -23, -9, 8, 15, 12, 6, 1, 0, 7, 
-    21, 31, 33, 27, 15, 3, 1, 6, 10, 11, 
-    10, 13, 19, 20, 10, -6, -20, -21, -6, 20, 
-    46, 58, 47, 17, -17, -39, -44, -42, -45, -52, 
-    -53, -50, -47, -46, -45, -40, -30, -11, 13, 36, 
-    47, 49, 48, 51, 54, 51, 41, 27, 14, 7, 
-    5, 5, 0, -10, -20, -23, -24, -26, -31, -40, 
-    -50, -56, -53, -37, -11, 16, 27, 17, 2, -2, 
-    8, 22, 33, 37, 38, 37, 39, 38, 33, 24, 
-    12, -1, -14, -23, -23, -17, -9, -1, 8, 16, 
-    22, 21, 13, -1, -19, -36, -47, -49, -44, -33, 
-    -17, -3, 3, 6, 12, 23, 32, 37, 38, 31, 
-    15, -7, -27, -39, -43, -38, -26, -11, 4, 13, 
-    12, 6, 1, -2, -6, -8, -8, -4, 2, 8, 
-    16, 23, 30, 34, 33, 30, 28, 27, 18, 1, 
-    -15, -21, -17, -9, -2, 3, 1, -9, -25, -39, 
-    -50, -56, -53, -41, -21, 2, 24, 42, 54, 58, 
-    57, 55, 49, 35, 18, 2, -11, -23, -34, -38, 
-    -37, -33, -30, -26, -19, -12, -7, -5, -2, 6, 
-    19, 33, 37, 25, 4, -14, -20, -17, -11, -8, 
-    -11, -17, -15, -7, 0, -1, -6, -13, -18, -21, 
-    -17, -9, -6, -9, -12, -13, -9, 1, 18, 37, 
-    49, 50, 44, 40, 39, 36, 27, 13, -1, -10, 
-    -9, 2, 18, 27, 20, 4, -3, 3, 12, 13, 
-    6, -4, -11, -11, -8, -9, -19, -36, -50, -58, 
-    -61, -55, -40, -28, -27, -31, -29, -12, 14, 33, 
-    39, 38, 37, 39, 45, 47, 34, 13, -5, -16, 
-    -19, -18, -12, -6, -3, 0, 4, 10, 11, -1, 
-    -15, -17, -7, 5, 4, -12, -30, -39, -35, -24, 
-    -11, 2, 16, 26, 29, 30, 33, 36, 31, 22, 
-    18, 21, 28, 30, 24, 12, 0, -11, -16, -11, 
-    1, 9, 9, 2, -5, -12, -19, -25, -26, -25, 
-    -26, -31, -34, -33, -26, -15, 0, 11, 14, 11, 
-    5, -1, -6, -13, -18, -19, -17, -15, -12, -4, 
-    10, 25, 35, 38, 34, 25, 13, 1, -9, -15, 
-    -17, -13, -2, 10, 15, 12, 8, 6, 4, -1, 
-    -7, -9, -8, -6, -1, 1, -2, -7, -8, -4, 
-    3, 10, 15, 23, 32, 32, 20, 6, 4, 12, 
-    21, 25, 20, 6, -14, -31, -37, -33, -24, -17, 
-    -17, -22, -25, -22, -12, 2, 13, 12, 0, -16, 
-    -29, -37, -35, -25, -11, -2, -2, -4, 0, 14, 
-    32, 47, 52, 44, 23, -3, -17, -10, 15, 41, 
-    50, 42, 23, 7, -2, -6, -9, -11, -11, -11, 
-    -11, -8, -2, 5, 11, 15, 12, 2, -11, -22, 
-    -36, -52, -59, -53, -43, -39, -40, -38, -27, -11, 
-    2, 8, 10, 8, 6, 10, 20, 31, 42, 50, 
-    54, 51, 40, 24, 11, 6, 9, 15, 18, 16, 
-    10, 7, 8, 11, 7, -7, -29, -47, -54, -51, 
-    -43, -36, -30, -25, -17, -4, 5, 8, 9, 11, 
-    15, 19, 25, 26, 23, 17, 8, 1, 2, 12, 
-    22, 23, 14, 4, 5, 15, 24, 24, 17, 3, 
-    -16, -35, -42, -37, -31, -31, -33, -31, -24, -17, 
-    -9, -4, -3, -5, -11, -24, -38, -40, -27, -7, 
-    9, 16, 15, 12, 11, 11, 13, 21, 34, 48, 
-    59, 62, 59, 52, 41, 25, 9, -4, -12, -17, 
-    -16, -5, 16, 37, 43, 28, 0, -28, -46, -51, 
-    -48, -37, -23, -13, -13, -23, -37, -43, -38, -25, 
-    -16, -16, -20, -24, -23, -16, -3, 15, 34, 46, 
-    47, 37, 20, 5, -2, -1, 1, 1, -1, -3, 
-    -3, 1, 7, 13, 18, 17, 9, -2, -10, -12, 
-    -4, 12, 23, 20, 6, -10, -19, -16, -4, 11, 
-    19, 20, 13, 3, -5, -9, -11, -10, -7, -2, 
-    5, 15, 25, 32, 35, 35, 32, 27, 16, -3, 
-    -25, -40, -40, -31, -23, -25, -30, -28, -23, -21, 
-    -25, -32, -35, -34, -29, -18, -6, 0, 2, 2, 
-    4, 6, 8, 10, 11, 15, 21, 25, 27, 28, 
-    28, 28, 27, 24, 21, 18, 16, 13, 8, 5, 
-    8, 15, 23, 25, 19, 7, -6, -16, -21, -23, 
-    -24, -24, -23, -20, -11, 0, 6, 0, -18, -36, 
-    -44, -39, -28, -17, -5, 6, 14, 17, 16, 14, 
-    15, 18, 20, 20, 19, 16, 11, 4, -2, -5, 
-    -7, -17, -34, -43, -40, -28, -12, 1, 11, 17, 
-    20, 19, 18, 21, 25, 21, 7, -7, -16, -15, 
-    -8, 2, 13, 27, 40, 45, 35, 12, -8, -13, 
-    -8, -5, -3, 2, 5, -5, -24, -44, -57, -55, 
-    -40, -21, -5, 9, 17, 15, 9, 3, -1, -1, 
-    3, 8, 10, 13, 16, 12, 2, -6, -4, 8, 
-    25, 43, 53, 45, 21, -7, -32, -46, -49, -41, 
-    -27, -9, 7, 17, 21, 20, 16, 13, 10, 4, 
-    -5, -9, -7, -1, 1, 1, 5, 13, 17, 7, 
-    -17, -39, -44, -29, -9, 3, 5, 2, 1, 7, 
-    16, 20, 18, 12, 0, -15, -27, -36, -38, -33, 
-    -20, -7, 2, 6, 7, 9, 11, 14, 19, 25, 
-    30, 29, 19, 4, -5, -8, -8, -5, 0, 7, 
-    13, 15, 13, 7, 0, -7, -15, -22, -25, -16, 
-    -3, 3, 5, 14, 27, 33, 27, 10, -9, -22, 
-    -24, -12, 8, 24, 28, 20, 8, -4, -17, -26, 
-    -26, -19, -9, -2, 4, 7, 2, -11, -28, -41, 
-    -40, -27, -14, -6, 0, 6, 10, 8, 5, 2, 
-    3, 7, 12, 20, 29, 31, 25, 14, 7, 11, 
-    20, 27, 26, 20, 10, -5, -22, -33, -35, -31, 
-    -21, -13, -6, -2, 1, -1, -4, -7, -9, -8, 
-    -5, -6, -11, -15, -15, -13, -8, 0, 9, 17, 
-    25, 29, 27, 19, 11, 6, 3, -3, -10, -16, 
-    -18, -20, -26, -29, -21, -6, 6, 9, 8, 7, 
-    7, 8, 15, 35, 59, 66, 51, 22, -7, -22, 
-    -25, -20, -8, 7, 19, 22, 14, 0, -11, -13, 
-    -9, -7, -10, -13, -15, -16, -22, -32, -35, -26, 
-    -7, 11, 18, 11, -3, -14, -16, -9, -2, -3, 
-    -12, -18, -19, -17, -10, -1, 6, 9, 12, 17, 
-    23, 28, 27, 20, 10, 0, -9, -18, -25, -27, 
-    -23, -15, -4, 11, 24, 29, 28, 27, 32, 35, 
-    25, 3, -18, -25, -16, 4, 22, 26, 11, -14, 
-    -38, -44, -30, -5, 15, 16, 1, -14, -16, -7, 
-    1, -1, -12, -22, -21, -10, 8, 27, 38, 39, 
-    33, 20, 2, -15, -23, -21, -13, -2, 6, 11, 
-    15, 17, 18, 16, 13, 11, 10, 10, 5, -9, 
-    -32, -52, -59, -52, -37, -17, 5, 23, 28, 23, 
-    14, 4, -7, -14, -16, -12, -9, -9, -11, -10, 
-    -8, -5, 1, 12, 24, 35, 43, 44, 31, 6, 
-    -21, -36, -35, -21, 0, 21, 36, 41, 35, 21, 
-    7, -2, -8, -8, -1, 8, 14, 11, 0, -18, 
-    -34, -44, -44, -37, -32, -30, -24, -11, 4, 13, 
-    14, 15, 21, 25, 28, 30, 31, 24, 11, -2, 
-    -13, -21, -26, -24, -18, -10, 2, 13, 21, 28, 
-    31, 24, 7, -7, -11, -8, -7, -12, -19, -23, 
-    -26, -30, -34, -33, -27, -20, -15, -7, 1, 10, 
-    20, 29, 36, 34, 24, 12, 7, 12, 22, 25, 
-    15, -3, -14, -10, 6, 21, 21, 7, -7, -11, 
-    -5, 2, 2, -6, -16, -16, -7, 6, 13, 14, 
-    10, 8, 9, 10, 9, 4, -2, -7, -13, -20, 
-    -26, -25, -13, 4, 15, 14, 4, -6, -13, -19, 
-    -25, -28, -26, -23, -18, -10, 0, 2, -7, -19, 
-    -29, -32, -23, -2, 20, 32, 32, 25, 21, 22, 
-    27, 28, 24, 18, 12, 8, 7, 14, 24, 30, 
-    33, 35, 36, 31, 17, -2, -13, -10, 2, 13, 
-    9, -9, -28, -39, -40, -40, -45, -50, -43, -26, 
-    -9, 1, 2, -5, -15, -23, -24, -15, -1, 5, 
-    -3, -19, -32, -36, -28, -8, 18, 38, 46, 45, 
-    42, 38, 31, 22, 15, 10, 9, 11, 17, 21, 
-    23, 20, 12, 1, -10, -13, -6, 3, 4, -3, 
-    -9, -9, -8, -8, -8, -10, -17, -28, -33, -27, 
-    -17, -8, 0, 7, 13, 17, 16, 16, 21, 28, 
-    34, 33, 23, 5, -17, -35, -37, -18, 4, 8, 
-    -5, -22, -31, -29, -17, 0, 11, 11, 4, -3, 
-    -7, -12, -20, -28, -27, -13, 4, 13, 14, 10, 
-    8, 14, 26, 35, 34, 23, 6, -9, -15, -10, 
-    2, 16, 23, 21, 12, 1, -5, -4, 4, 13, 
-    21, 24, 21, 10, -5, -17, -21, -21, -22, -22, 
-    -21, -23, -28, -29, -23, -14, -10, -14, -23, -30, 
-    -31, -29, -27, -26, -23, -13, 4, 24, 42, 54, 
-    58, 57, 50, 38, 25, 20, 23, 28, 32, 27, 
-    13, -6, -20, -24, -16, -5, -1, -4, -13, -20, 
-    -16, -4, 7, 8, -5, -24, -38, -41, -30, -8, 
-    14, 28, 31, 29, 21, 6, -12, -21, -18, -7, 
-    2, 7, 3, -7, -19, -27, -29, -23, -15, -6, 
-    2, 9, 13, 11, 4, -7, -18, -22, -19, -12, 
-    0, 16, 27, 32, 36, 42, 45, 40, 30, 20, 
-    12, 3, -7, -18, -28, -32, -29, -18, -4, 10, 
-    21, 27, 28, 25, 22, 16, -1, -31, -60, -73, 
-    -71, -56, -32, -4, 16, 22, 13, -2, -18, -29, 
-    -25, -8, 12, 25, 29, 28, 26, 24, 23, 22, 
-    23, 26, 28, 22, 6, -10, -14, -6, 5, 9, 
-    4, -4, -7, -4, 3, 9, 14, 12, 2, -17, 
-    -36, -47, -50, -53, -56, -49, -33, -13, 3, 12, 
-    13, 13, 21, 36, 53, 61, 58, 50, 45, 44, 
-    42, 33, 18, -1, -18, -27, -35, -43, -47, -43, 
-    -28, -9, 4, 7, -2, -20, -38, -49, -51, -46, 
-    -38, -30, -24, -16, 0, 20, 37, 44, 41, 32, 
-    27, 28, 34, 36, 33, 31, 32, 36, 34, 25, 
-    13, 5, 3, 2, 0, -2, 2, 8, 9, -2, 
-    -20, -39, -52, -54, -50, -47, -48, -51, -53, -51, 
-    -44, -34, -23, -13, -6, -2, 3, 18, 40, 57, 
-    64, 62, 59, 59, 58, 51, 34, 12, -8, -21, 
-    -26, -28, -28, -22, -10, 5, 20, 33, 40, 37, 
-    26, 15, 8, -3, -20, -39, -49, -48, -38, -23, 
-    -9, -3, -2, -2, -1, -2, -5, -8, -10, -11, 
-    -10, -4, 3, 6, 2, -7, -12, -7, 6, 19, 
-    24, 20, 11, 1, -7, -9, -2, 8, 19, 25, 
-    22, 14, 7, 5, 5, 1, -10, -21, -25, -24, 
-    -25, -28, -29, -24, -17, -10, 0, 17, 34, 43, 
-    37, 24, 12, 9, 9, 8, 4, -3, -8, -4, 
-    7, 15, 15, 11, 8, 4, -4, -17, -29, -34, 
-    -28, -19, -12, -10, -8, -6, -2, 5, 15, 24, 
-    26, 17, -2, -20, -23, -13, -4, -9, -26, -44, 
-    -53, -51, -40, -18, 12, 36, 49, 48, 40, 31, 
-    25, 23, 23, 26, 28, 26, 16, -3, -20, -21, 
-    -8, 7, 17, 18, 13, 8, 6, 7, 12, 16, 
-    14, 6, -5, -14, -19, -21, -19, -15, -11, -8, 
-    -7, -9, -15, -22, -28, -30, -30, -31, -27, -16, 
-    -1, 9, 5, -10, -22, -23, -14, 0, 10, 16, 
-    21, 27, 32, 38, 46, 51, 46, 33, 21, 16, 
-    11, -3, -24, -36, -27, -2, 19, 22, 9, -8, 
-    -22, -31, -29, -18, -3, 7, 11, 10, 2, -10, 
-    -21, -27, -26, -15, 5, 24, 32, 28, 17, 10, 
-    8, 6, -2, -11, -15, -16, -22, -30, -32, -24, 
-    -9, 2, 6, 3, -3, -9, -13, -12, -6, 0, 
-    1, -2, -6, -12, -18, -18, -9, 5, 17, 26, 
-    36, 45, 48, 45, 37, 29, 23, 21, 19, 18, 
-    21, 26, 26, 20, 11, 1, -7, -17, -27, -39, 
-    -52, -64, -67, -59, -44, -30, -20, -14, -12, -11, 
-    -10, -5, 5, 15, 22, 27, 30, 28, 21, 16, 
-    13, 9, 1, -5, -4, 6, 22, 39, 51, 52, 
-    41, 22, 5, -4, -9, -17, -29, -39, -49, -57, 
-    -60, -56, -44, -28, -12, -2, 4, 6, 4, 3, 
-    6, 10, 11, 11, 13, 20, 25, 25, 23, 24, 
-    25, 23, 17, 10, 6, 3, 0, -2, -3, -2, 
-    -1, 0, -2, -8, -15, -18, -11, 4, 16, 17, 
-    5, -10, -17, -17, -12, -7, -5, -7, -12, -17, 
-    -21, -23, -25, -25, -21, -11, 3, 11, 12, 13, 
-    17, 25, 29, 29, 22, 13, 9, 13, 20, 25, 
-    25, 23, 18, 11, 0, -15, -25, -27, -24, -18, 
-    -13, -10, -9, -6, -4, -9, -19, -28, -30, -25, 
-    -19, -17, -16, -9, 6, 24, 40, 48, 44, 31, 
-    16, 6, 2, 3, 6, 3, -7, -17, -21, -16, 
-    -10, -6, -4, -2, 0, 2, 1, -2, -6, -13, 
-    -23, -30, -29, -16, 2, 18, 30, 36, 35, 28, 
-    19, 15, 17, 17, 12, 1, -7, -6, 5, 18, 
-    28, 28, 18, 1, -16, -26, -28, -22, -17, -15, 
-    -18, -24, -29, -33, -33, -30, -29, -28, -27, -23, 
-    -15, -6, 4, 13, 16, 15, 15, 22, 34, 41, 
-    38, 27, 17, 16, 23, 29, 27, 18, 2, -18, 
-    -35, -40, -30, -8, 14, 26, 28, 24, 18, 10, 
-    -1, -13, -23, -29, -27, -18, -8, 1, 9, 15, 
-    15, 11, 2, -12, -28, -39, -37, -19, 8, 28, 
-    30, 14, -6, -17, -14, 1, 18, 31, 36, 34, 
-    26, 9, -15, -36, -45, -37, -19, 3, 21, 31, 
-    28, 15, -1, -13, -17, -14, -7, -2, 1, 3, 
-    5, 8, 12, 18, 23, 21, 10, -3, -12, -17, 
-    -23, -28, -29, -26, -24, -20, -14, -6, -2, -1, 
-    0, 3, 7, 15, 24, 27, 20, 6, -5, -6, 
-    2, 9, 9, 5, 1, -5, -12, -17, -16, -13, 
-    -8, -3, 3, 9, 15, 19, 21, 21, 20, 20, 
-    16, 6, -7, -17, -15, -7, -1, 1, 2, 3, 
-    1, -6, -14, -18, -17, -16, -14, -12, -9, -3, 
-    6, 17, 25, 28, 28, 23, 15, 9, 9, 13, 
-    18, 20, 16, 5, -10, -25, -36, -42, -42, -36, 
-    -30, -26, -23, -16, -1, 17, 30, 31, 21, 7, 
-    -6, -11, -8, -1, 3, 3, 1, 0, -2, -4, 
-    -3, -1, -2, -5, -5, -1, 2, 3, 6, 15, 
-    22, 19, 3, -14, -21, -15, -1, 13, 23, 24, 
-    16, 3, -7, -9, -3, 7, 13, 9, -1, -13, 
-    -21, -24, -24, -25, -25, -23, -14, 0, 13, 23, 
-    31, 36, 35, 31, 26, 23, 20, 16, 12, 7, 
-    3, 3, 7, 7, -4, -25, -44, -52, -51, -49, 
-    -47, -45, -37, -23, -8, 7, 19, 26, 27, 26, 
-    26, 28, 29, 26, 17, 4, -5, -6, 0, 5, 
-    8, 11, 14, 14, 10, 5, 3, 2, -1, -5, 
-    -11, -15, -16, -16, -16, -17, -19, -17, -12, -7, 
-    -4, -3, -4, -7, -7, -4, -3, -3, -3, -2, 
-    -2, 2, 11, 23, 31, 30, 22, 17, 22, 36, 
-    46, 44, 28, 4, -16, -25, -24, -22, -20, -16, 
-    -12, -8, -5, -1, 3, 5, 2, -6, -17, -24, 
-    -23, -19, -17, -14, -8, 1, 8, 12, 11, 5, 
-    0, 1, 7, 15, 18, 13, 1, -12, -21, -28, 
-    -32, -28, -16, -1, 6, 3, -8, -19, -23, -17, 
-    -2, 13, 23, 28, 32, 33, 29, 20, 10, 2, 
-    -2, -5, -9, -13, -20, -28, -31, -24, -6, 16, 
-    34, 45, 46, 38, 25, 13, 3, -1, -1, 1, 
-    4, 9, 14, 15, 13, 12, 14, 17, 16, 5, 
-    -11, -26, -34, -34, -28, -25, -29, -37, -43, -43, 
-    -36, -24, -10, 4, 14, 18, 17, 16, 15, 16, 
-    18, 20, 20, 18, 12, 1, -9, -17, -18, -13, 
-    -10, -15, -25, -29, -22, -9, 0, 4, 7, 12, 
-    16, 16, 17, 16, 13, 8, 7, 7, 3, -2, 
-    -7, -11, -10, -5, 1, 7, 14, 19, 20, 17, 
-    14, 14, 17, 23, 26, 24, 18, 11, 2, -7, 
-    -15, -19, -17, -12, -4, 2, 3, 1, 0, -1, 
-    -4, -7, -10, -12, -15, -20, -25, -31, -37, -45, 
-    -49, -46, -37, -25, -14, -9, -8, -5, 2, 12, 
-    22, 29, 32, 34, 34, 30, 24, 26, 39, 54, 
-    55, 41, 21, 3, -7, -9, -4, 2, 3, 0, 
-    -2, 1, 6, 6, -1, -13, -23, -29, -33, -33, 
-    -30, -26, -24, -22, -21, -22, -19, -11, 3, 16, 
-    22, 19, 14, 10, 5, -3, -11, -12, -5, 10, 
-    28, 40, 41, 32, 21, 13, 7, 1, -5, -10, 
-    -15, -16, -11, -4, 3, 5, 5, 6, 6, 2, 
-    -6, -20, -34, -42, -42, -37, -31, -27, -21, -13, 
-    -4, 6, 16, 25, 28, 26, 19, 13, 10, 10, 
-    9, 5, 1, 0, 0, -2, -7, -10, -8, 1, 
-    12, 19, 20, 21, 24, 27, 25, 19, 11, 3, 
-    -6, -10, -7, 1, 7, 10, 8, 5, 0, -4, 
-    -4, -4, -7, -15, -28, -42, -56, -63, -60, -47, 
-    -26, -5, 15, 30, 43, 50, 50, 40, 25, 14, 
-    11, 9, 3, -8, -17, -12, 4, 19, 19, 4, 
-    -12, -20, -18, -10, -1, 7, 12, 16, 19, 17, 
-    10, 0, -12, -25, -36, -41, -44, -45, -44, -39, 
-    -26, -9, 8, 23, 37, 47, 50, 46, 38, 29, 
-    17, 5, -2, -7, -6, -1, 4, 3, -3, -10, 
-    -16, -17, -12, -5, 4, 10, 12, 6, -3, -9, 
-    -10, -13, -17, -19, -16, -6, 6, 15, 18, 17, 
-    14, 11, 6, 0, -6, -14, -21, -23, -19, -12, 
-    -7, -1, 5, 10, 9, 4, 3, 8, 13, 12, 
-    6, -1, -5, -7, -9, -12, -17, -18, -12, -1, 
-    13, 28, 41, 51, 52, 44, 31, 18, 5, -9, 
-    -19, -24, -25, -25, -21, -15, -7, 1, 9, 13, 
-    8, -3, -18, -33, -41, -40, -28, -12, 0, 4, 
-    2, -3, -8, -12, -14, -15, -14, -9, -3, 1, 
-    5, 8, 10, 8, 4, 2, 10, 28, 49, 63, 
-    66, 58, 42, 24, 9, -1, -8, -13, -20, -29, 
-    -38, -44, -41, -28, -16, -7, 0, 5, 7, 6, 
-    3, -3, -9, -16, -21, -22, -18, -9, 0, 9, 
-    20, 29, 34, 33, 28, 21, 11, 0, -12, -21, 
-    -22, -13, -3, 2, 1, -2, -3, -3, -3, -5, 
-    -11, -17, -21, -21, -19, -13, -2, 13, 26, 36, 
-    41, 41, 35, 23, 2, -21, -38, -43, -38, -32, 
-    -28, -25, -17, -4, 14, 29, 37, 37, 32, 24, 
-    17, 11, 6, 0, -5, -7, -8, -8, -7, -6, 
-    -4, 3, 13, 21, 26, 24, 14, 2, -4, -2, 
-    -2, -9, -19, -26, -27, -23, -22, -29, -38, -42, 
-    -32, -13, 7, 21, 27, 30, 31, 31, 28, 17, 
-    5, -3, -5, -4, -3, -4, -6, -7, -4, 1, 
-    6, 5, -6, -23, -34, -37, -33, -25, -13, 0, 
-    12, 24, 30, 29, 24, 19, 15, 12, 9, 8, 
-    8, 9, 12, 11, 7, 2, 2, 6, 10, 12, 
-    5, -7, -18, -23, -24, -22, -18, -10, -2, 0, 
-    -3, -4, 5, 19, 29, 30, 24, 13, 4, 3, 
-    7, 6, -4, -17, -23, -19, -11, -5, -5, -6, 
-    -5, -1, 4, 7, 5, -3, -15, -26, -30, -30, 
-    -29, -29, -27, -20, -7, 10, 26, 32, 28, 20, 
-    17, 23, 30, 31, 27, 24, 23, 23, 20, 11, 
-    -2, -13, -19, -22, -22, -24, -26, -27, -26, -25, 
-    -24, -22, -18, -13, -12, -13, -8, 5, 22, 35, 
-    37, 32, 23, 11, -4, -16, -21, -18, -9, 5, 
-    22, 36, 39, 32, 15, -1, -11, -14, -13, -9, 
-    -5, -2, -1, 0, 5, 12, 17, 14, 6, -3, 
-    -12, -17, -17, -13, -7, -5, -9, -17, -23, -26, 
-    -26, -23, -16, -8, 3, 14, 22, 25, 24, 19, 
-    10, 0, -6, -4, 4, 15, 26, 33, 35, 34, 
-    33, 30, 22, 8, -11, -31, -43, -45, -41, -34, 
-    -25, -17, -10, -8, -12, -19, -23, -17, -3, 11, 
-    18, 18, 14, 12, 14, 14, 10, 6, 6, 9, 
-    13, 15, 15, 14, 11, 5, -2, -9, -16, -23, 
-    -27, -26, -20, -14, -10, -9, -9, -11, -11, -5, 
-    7, 22, 34, 36, 27, 10, -6, -14, -13, -7, 
-    -2, 1, 3, 4, 8, 15, 23, 29, 33, 31, 
-    23, 11, -1, -11, -16, -18, -20, -21, -20, -18, 
-    -15, -9, -1, 5, 4, -7, -20, -26, -24, -16, 
-    -6, 1, 6, 9, 11, 6, -5, -16, -20, -17, 
-    -10, -1, 6, 12, 17, 21, 22, 17, 8, 0, 
-    -2, -1, -3, -7, -7, 0, 9, 20, 29, 34, 
-    30, 20, 13, 9, 5, -3, -15, -29, -38, -39, 
-    -34, -29, -24, -19, -12, -3, 3, 1, -3, -1, 
-    8, 20, 30, 34, 31, 26, 22, 20, 18, 11, 
-    0, -7, -8, -5, 0, 3, 5, 3, -1, -7, 
-    -14, -17, -16, -17, -23, -29, -28, -22, -14, -10, 
-    -9, -6, 3, 12, 16, 10, 0, -6, -7, -7, 
-    -11, -15, -16, -12, -5, 5, 18, 27, 31, 35, 
-    42, 50, 54, 49, 35, 16, -3, -19, -29, -32, 
-    -29, -19, -5, 9, 16, 14, 5, -8, -23, -39, 
-    -49, -49, -38, -20, -3, 7, 9, 7, 3, 2, 
-    7, 16, 25, 30, 32, 30, 23, 11, -6, -23, 
-    -34, -39, -37, -32, -26, -19, -11, -3, 3, 9, 
-    14, 20, 28, 38, 42, 36, 24, 16, 15, 14, 
-    12, 7, 3, 1, 1, -2, -10, -19, -26, -29, 
-    -28, -27, -24, -20, -13, -6, -1, 2, 1, -4, 
-    -9, -10, -6, -1, 3, 3, 0, -4, -2, 5, 
-    13, 15, 16, 18, 21, 22, 22, 17, 4, -13, 
-    -26, -30, -22, -7, 8, 18, 19, 13, 5, -2, 
-    -4, -3, 1, 4, 6, 7, 6, 1, -1, 2, 
-    6, 7, 2, -6, -13, -14, -13, -10, -6, -2, 
-    1, 2, 3, 2, -4, -12, -16, -12, -4, 1, 
-    2, 1, 0, 1, 4, 5, 1, -9, -18, -21, 
-    -16, -3, 9, 16, 17, 16, 14, 9, 1, -6, 
-    -8, -5, 1, 2, -2, -8, -12, -12, -4, 6, 
-    14, 14, 12, 13, 22, 34, 42, 45, 39, 23, 
-    2, -16, -26, -28, -27, -27, -29, -28, -23, -16, 
-    -9, -6, -8, -12, -15, -11, -2, 8, 13, 14, 
-    15, 14, 13, 9, 6, 3, -1, -7, -12, -16, 
-    -17, -16, -12, -6, 2, 12, 19, 20, 14, 6, 
-    -3, -9, -9, -5, 1, 9, 13, 9, -1, -12, 
-    -16, -11, -3, 3, 6, 9, 13, 16, 17, 14, 
-    8, -2, -11, -15, -14, -8, 2, 12, 20, 24, 
-    21, 9, -4, -13, -17, -17, -14, -13, -12, -9, 
-    -4, 2, 5, 4, 0, -4, -9, -12, -12, -7, 
-    4, 16, 24, 27, 23, 10, -7, -20, -25, -21, 
-    -13, -3, 4, 6, 7, 10, 13, 12, 6, -1, 
-    -3, 5, 15, 21, 21, 18, 12, 3, -7, -14, 
-    -16, -16, -16, -16, -16, -15, -13, -11, -9, -5, 
-    -4, -7, -14, -21, -24, -23, -17, -9, -1, 5, 
-    8, 7, 4, 4, 7, 12, 17, 24, 32, 39, 
-    40, 33, 20, 7, -3, -9, -10, -7, -1, 5, 
-    9, 12, 15, 14, 12, 9, 5, -1, -9, -17, 
-    -22, -24, -22, -19, -16, -12, -9, -7, -10, -15, 
-    -21, -25, -28, -28, -23, -15, -6, 1, 7, 13, 
-    18, 20, 22, 21, 20, 20, 19, 16, 13, 12, 
-    9, 3, -2, -3, -2, 1, 5, 7, 4, 0, 
-    -2, 0, 3, 5, 3, -1, -5, -6, -5, -3, 
-    -5, -13, -22, -28, -26, -19, -13, -8, -1, 9, 
-    21, 31, 38, 36, 26, 14, 5, -2, -7, -8, 
-    -6, 0, 6, 10, 12, 11, 8, 4, 0, -7, 
-    -19, -38, -57, -67, -64, -49, -28, -4, 14, 24, 
-    29, 30, 30, 28, 30, 32, 28, 18, 5, -5, 
-    -11, -12, -10, -8, -6, -1, 6, 13, 17, 19, 
-    21, 20, 18, 14, 13, 14, 15, 14, 13, 7, 
-    -4, -19, -33, -43, -49, -51, -48, -41, -32, -23, 
-    -17, -13, -7, 3, 14, 23, 23, 17, 11, 7, 
-    6, 5, 5, 2, -2, -4, -3, 1, 8, 18, 
-    28, 33, 30, 23, 19, 19, 19, 19, 18, 17, 
-    12, 3, -9, -19, -27, -30, -29, -26, -24, -26, 
-    -29, -28, -25, -17, -8, 1, 10, 13, 12, 11, 
-    12, 12, 8, 1, -1, 4, 12, 19, 19, 14, 
-    8, 4, 3, 1, 0, 0, 3, 6, 10, 10, 
-    3, -9, -22, -33, -36, -27, -14, -2, 4, 3, 
-    -2, -9, -14, -14, -11, -5, 2, 9, 13, 17, 
-    19, 20, 18, 15, 14, 14, 11, 5, -2, -9, 
-    -11, -11, -9, -7, -4, -1, 0, 1, 2, 7, 
-    13, 16, 16, 15, 15, 14, 8, -2, -14, -28, 
-    -38, -39, -30, -15, 0, 8, 10, 10, 11, 11, 
-    8, 3, -1, -1, 3, 6, 9, 12, 14, 11, 
-    4, -3, -5, -3, 0, 4, 8, 12, 13, 9, 
-    -2, -13, -22, -28, -28, -21, -11, -4, -4, -10, 
-    -15, -11, 0, 11, 14, 11, 6, 3, 3, 4, 
-    5, 6, 8, 8, 4, 1, 0, 2, -1, -9, 
-    -15, -12, -2, 9, 16, 17, 14, 9, 4, 1, 
-    3, 5, 5, -1, -9, -18, -22, -20, -17, -18, 
-    -25, -29, -28, -22, -15, -9, 1, 14, 32, 47, 
-    56, 57, 50, 36, 20, 7, 1, 1, 5, 12, 
-    17, 18, 15, 7, -4, -14, -22, -27, -30, -31, 
-    -35, -40, -46, -46, -39, -29, -20, -13, -5, 4, 
-    14, 23, 27, 25, 20, 13, 6, 3, 1, 3, 
-    7, 11, 13, 13, 14, 14, 19, 26, 32, 30, 
-    23, 14, 7, 0, -5, -8, -7, -6, -8, -14, 
-    -22, -29, -35, -39, -40, -36, -31, -25, -19, -11, 
-    -2, 4, 7, 6, 8, 11, 16, 19, 20, 17, 
-    13, 11, 8, 5, 7, 14, 23, 27, 25, 18, 
-    7, -3, -8, -7, -4, -1, 1, 0, -2, -1, 
-    2, 5, 6, 2, -4, -11, -19, -26, -30, -30, 
-    -28, -26, -25, -25, -20, -9, 7, 25, 40, 44, 
-    39, 29, 19, 10, 3, -4, -13, -20, -21, -17, 
-    -7, 6, 16, 19, 17, 16, 19, 23, 21, 13, 
-    0, -16, -28, -35, -37, -33, -24, -11, 0, 7, 
-    10, 8, 4, 1, 1, 0, -3, -5, -5, -4, 
-    0, 2, 0, -3, -6, -7, -7, -4, -2, -1, 
-    2, 10, 20, 29, 34, 36, 35, 31, 26, 19, 
-    11, 4, -2, -10, -20, -27, -28, -24, -21, -22, 
-    -23, -23, -21, -17, -12, -7, -3, -3, -7, -9, 
-    -5, 1, 5, 2, -5, -7, 0, 13, 25, 27, 
-    22, 15, 10, 8, 9, 10, 12, 13, 10, 4, 
-    -2, -3, -1, 1, -1, -5, -9, -9, -6, 1, 
-    10, 20, 26, 22, 11, -3, -17, -24, -26, -23, 
-    -20, -19, -19, -19, -18, -15, -12, -11, -13, -16, 
-    -16, -9, -1, 5, 9, 12, 15, 19, 23, 25, 
-    24, 20, 14, 8, 3, 2, 4, 6, 6, 5, 
-    3, -2, -10, -18, -21, -19, -10, 2, 8, 8, 
-    6, 4, 1, -4, -8, -9, -5, 6, 17, 23, 
-    25, 27, 26, 22, 14, 6, -3, -8, -11, -11, 
-    -9, -10, -12, -13, -12, -9, -6, -7, -9, -9, 
-    -8, -8, -10, -15, -23, -31, -34, -32, -21, -5, 
-    11, 20, 22, 23, 27, 27, 22, 12, 0, -11, 
-    -16, -15, -11, -6, 0, 10, 20, 25, 24, 20, 
-    14, 6, -3, -12, -15, -12, -6, 0, 4, 7, 
-    8, 5, 2, 1, 3, 7, 9, 9, 8, 8, 
-    8, 8, 8, 7, 5, 4, 3, -2, -7, -11, 
-    -15, -19, -21, -20, -18, -19, -21, -24, -23, -16, 
-    -5, 3, 5, 3, -1, -2, 1, 7, 13, 18, 
-    20, 20, 19, 17, 13, 7, 2, -1, -1, 0, 
-    1, -1, -5, -11, -11, -7, -1, 5, 8, 11, 
-    14, 16, 15, 11, 7, 1, -6, -13, -22, -29, 
-    -32, -28, -19, -10, -3, 5, 14, 19, 21, 18, 
-    12, 6, 2, -1, -2, -3, -7, -13, -17, -16, 
-    -10, -6, -2, 3, 11, 19, 22, 20, 16, 12, 
-    10, 10, 9, 7, 4, 3, 1, -4, -12, -22, 
-    -31, -36, -35, -28, -18, -10, -5, -4, -6, -4, 
-    0, 3, 1, -3, -4, -1, 9, 22, 34, 40, 
-    39, 35, 30, 25, 20, 10, -7, -23, -31, -29, 
-    -21, -10, 4, 15, 23, 27, 25, 17, 6, -7, 
-    -21, -31, -37, -37, -35, -34, -35, -34, -23, -3, 
-    19, 31, 33, 25, 13, 4, -3, -8, -13, -14, 
-    -7, 5, 17, 26, 32, 33, 30, 23, 16, 10, 
-    5, 2, -2, -8, -15, -19, -18, -13, -5, 3, 
-    7, 6, 0, -8, -14, -14, -13, -14, -18, -22, 
-    -24, -21, -14, -6, 1, 3, 4, 6, 10, 16, 
-    22, 26, 28, 26, 19, 9, -1, -7, -10, -12, 
-    -14, -13, -7, 3, 11, 12, 7, 1, -2, 0, 
-    4, 9, 13, 14, 14, 10, 3, -5, -10, -11, 
-    -11, -12, -16, -20, -22, -22, -21, -15, -5, 7, 
-    17, 21, 19, 15, 10, 6, 3, 0, -4, -7, 
-    -9, -13, -17, -15, -8, 2, 11, 17, 19, 19, 
-    16, 12, 5, -4, -12, -15, -11, -4, 1, 2, 
-    2, 3, 5, 2, -4, -8, -6, -4, -4, -6, 
-    -7, -8, -7, -4, 0, 5, 9, 12, 12, 10, 
-    6, 3, 4, 8, 14, 15, 10, 0, -11, -19, 
-    -23, -22, -15, -6, 2, 4, 3, 3, 8, 16, 
-    21, 21, 16, 8, -1, -9, -14, -17, -19, -19, 
-    -16, -10, -4, 1, 5, 6, 4, -2, -7, -10, 
-    -8, -4, -1, 2, 9, 17, 22, 24, 21, 16, 
-    10, 6, 5, 8, 9, 6, -2, -12, -20, -22, 
-    -21, -20, -21, -22, -19, -14, -7, -2, 1, 1, 
-    0, 1, 7, 14, 16, 10, 0, -4, 0, 6, 
-    10, 10, 7, 5, 3, 1, -1, 0, 3, 5, 
-    3, -2, -5, -5, -1, 3, 7, 9, 10, 6, 
-    -1, -10, -13, -11, -7, -5, -3, 0, 4, 8, 
-    8, 4, 1, -1, -1, 1, 3, 5, 5, 3, 
-    -1, -3, -4, -3, -4, -4, -6, -6, -3, -1, 
-    0, -1, -1, 0, -1, -3, -4, -1, 5, 10, 
-    12, 12, 8, 1, -11, -23, -28, -23, -11, 0, 
-    6, 6, 3, 3, 8, 14, 17, 13, 8, 2, 
-    -1, -3, -1, 2, 7, 10, 11, 11, 10, 10, 
-    10, 9, 7, 4, 0, -3, -7, -13, -20, -24, 
-    -25, -26, -28, -30, -30, -25, -17, -4, 9, 18, 
-    23, 25, 25, 23, 17, 9, 1, -4, -6, -7, 
-    -5, 1, 7, 12, 16, 19, 19, 17, 13, 7, 
-    3, 2, 6, 9, 7, 0, -7, -13, -15, -15, 
-    -12, -7, -3, -3, -4, -5, -7, -12, -16, -15, 
-    -10, -4, -1, -3, -5, -5, -7, -11, -15, -16, 
-    -13, -7, 2, 12, 21, 27, 27, 24, 19, 16, 
-    16, 15, 8, -2, -10, -12, -10, -6, -4, -4, 
-    -5, -3, 2, 6, 7, 3, -3, -11, -14, -12, 
-    -8, -6, -6, -5, -5, -5, -4, -4, -2, -1, 
-    -2, -4, -6, -1, 12, 29, 41, 42, 34, 23, 
-    14, 10, 8, 6, 2, -4, -9, -13, -16, -16, 
-    -12, -9, -12, -20, -29, -35, -34, -29, -20, -9, 
-    -2, 1, 1, 0, 1, 3, 6, 9, 11, 12, 
-    10, 5, 0, 0, 7, 16, 24, 27, 25, 21, 
-    18, 18, 17, 12, 0, -14, -25, -29, -27, -21, 
-    -13, -7, -4, -1, 3, 9, 12, 11, 5, -3, 
-    -8, -9, -5, -1, 0, -2, -6, -9, -10, -8, 
-    -4, -1, 1, 5, 9, 12, 15, 17, 18, 17, 
-    14, 10, 6, -1, -10, -17, -21, -24, -28, -30, 
-    -26, -16, -1, 14, 23, 23, 16, 7, 2, 3, 
-    7, 9, 7, 2, -1, 1, 3, 2, -2, -6, 
-    -7, -3, 6, 14, 16, 9, -3, -12, -16, -15, 
-    -14, -13, -13, -11, -8, -4, -1, 2, 4, 4, 
-    2, -1, -3, -6, -10, -13, -12, -6, 2, 7, 
-    7, 3, -2, -2, 1, 6, 12, 18, 22, 24, 
-    26, 27, 26, 25, 26, 25, 23, 17, 7, -5, 
-    -16, -25, -29, -30, -29, -28, -28, -25, -21, -14, 
-    -6, 2, 7, 6, 2, -4, -8, -8, -6, -2, 
-    3, 7, 8, 6, 3, 1, 2, 4, 3, -1, 
-    -5, -8, -9, -9, -8, -4, 2, 7, 11, 12, 
-    13, 12, 13, 16, 18, 17, 12, 3, -11, -23, 
-    -29, -23, -8, 8, 18, 20, 17, 10, 2, -4, 
-    -6, -7, -8, -8, -6, -5, -4, -2, 2, 4, 
-    5, 4, 4, 3, 1, 1, 2, 6, 10, 10, 
-    5, -1, -5, -2, 1, 0, -4, -10, -14, -16, 
-    -19, -23, -25, -26, -23, -18, -9, 0, 7, 13, 
-    15, 16, 14, 13, 13, 13, 12, 11, 16, 21, 
-    22, 14, 3, -5, -6, 1, 11, 16, 12, 2, 
-    -5, -6, -4, -1, 0, -2, -6, -12, -17, -18, 
-    -15, -12, -11, -8, -2, 5, 11, 13, 11, 5, 
-    -3, -9, -13, -14, -12, -9, -5, -3, 0, 1, 
-    0, -2, -4, -5, -5, -2, 1, 5, 8, 11, 
-    14, 17, 17, 15, 10, 6, 2, 1, 1, 2, 
-    1, -2, -7, -8, -8, -9, -12, -14, -13, -9, 
-    -5, 2, 9, 16, 20, 20, 15, 9, 5, 1, 
-    -2, -5, -6, -6, -6, -8, -10, -9, -5, 2, 
-    8, 8, 5, 1, -3, -8, -12, -13, -10, -8, 
-    -7, -7, -5, -2, 3, 9, 12, 9, 0, -8, 
-    -11, -9, -5, 0, 5, 11, 13, 11, 7, 4, 
-    5, 7, 8, 5, 1, 0, 5, 11, 13, 10, 
-    5, 1, 1, 3, 3, 0, -8, -16, -21, -20, 
-    -16, -12, -10, -8, -2, 4, 6, 4, -1, -4, 
-    -4, -1, 4, 8, 9, 7, 4, 2, 0, -1, 
-    -2, -2, -1, 0, 0, 2, 3, 4, 4, 4, 
-    6, 8, 9, 5, -2, -9, -14, -19, -22, -22, 
-    -19, -13, -7, 0, 8, 14, 16, 14, 10, 6, 
-    2, 1, -1, -1, -1, 2, 7, 10, 13, 16, 
-    17, 17, 16, 17, 17, 15, 11, 5, -1, -8, 
-    -16, -24, -27, -26, -22, -17, -14, -14, -16, -19, 
-    -17, -10, -1, 5, 6, 6, 6, 6, 6, 4, 
-    -2, -8, -10, -8, -6, -3, 2, 11, 23, 34, 
-    42, 43, 38, 29, 16, 4, -4, -8, -9, -10, 
-    -15, -24, -34, -40, -40, -36, -30, -23, -15, -10, 
-    -8, -8, -6, -3, 1, 4, 6, 8, 12, 19, 
-    27, 35, 39, 38, 35, 32, 31, 32, 32, 27, 
-    16, 0, -15, -22, -22, -17, -15, -16, -18, -19, 
-    -18, -16, -12, -9, -9, -12, -17, -21, -22, -22, 
-    -20, -16, -11, -5, 0, 2, 1, -1, -2, 0, 
-    5, 11, 15, 18, 17, 14, 13, 12, 10, 5, 
-    -3, -7, -4, 3, 9, 10, 11, 13, 14, 13, 
-    11, 10, 9, 6, 2, 0, 0, -1, -4, -8, 
-    -11, -11, -9, -8, -10, -15, -19, -20, -17, -15, 
-    -14, -13, -9, -3, 4, 10, 15, 20, 22, 20, 
-    15, 8, 4, 3, 2, 4, 7, 11, 13, 14, 
-    10, 4, -2, -4, -4, -7, -12, -18, -22, -21, 
-    -18, -12, -6, -1, 3, 5, 6, 7, 5, -1, 
-    -9, -16, -18, -16, -12, -8, -2, 4, 10, 16, 
-    19, 17, 13, 8, 5, 4, 3, 0, 0, 1, 
-    2, 1, -1, -2, -2, -1, -2, -3, -4, -3, 
-    0, 6, 14, 18, 15, 7, 2, 0, 0, -1, 
-    -2, -1, 3, 7, 7, 0, -10, -17, -17, -13, 
-    -9, -6, -7, -10, -13, -12, -7, -2, 2, 6, 
-    10, 14, 14, 13, 11, 9, 6, 2, -3, -8, 
-    -12, -15, -16, -17, -17, -13, -4, 5, 9, 7, 
-    2, -3, -4, -2, 2, 8, 15, 20, 24, 25, 
-    22, 13, 3, -4, -5, 0, 7, 10, 8, 4, 
-    0, -4, -9, -16, -23, -29, -31, -28, -20, -9, 
-    2, 11, 15, 12, 3, -4, -5, 0, 7, 11, 
-    11, 10, 10, 12, 13, 8, 0, -10, -15, -15, 
-    -12, -8, -7, -7, -6, -4, 0, 1, 2, 1, 
-    2, 5, 9, 12, 14, 13, 11, 10, 12, 12, 
-    8, 2, -2, -2, 2, 6, 8, 7, 5, 2, 
-    1, 0, -1, -6, -14, -20, -21, -17, -13, -10, 
-    -9, -10, -10, -8, -4, 2, 6, 5, 1, -5, 
-    -7, -4, -2, -5, -11, -16, -18, -16, -9, 0, 
-    10, 17, 21, 22, 20, 17, 12, 7, 1, -1, 
-    1, 6, 11, 13, 13, 13, 12, 8, 3, 1, 
-    1, 2, 2, -3, -7, -8, -7, -6, -5, -4, 
-    -1, 4, 6, 3, -7, -17, -23, -24, -22, -21, 
-    -18, -12, -3, 6, 14, 18, 19, 15, 6, -4, 
-    -9, -9, -4, 2, 5, 4, 1, 0, 3, 8, 
-    14, 18, 20, 20, 20, 19, 15, 8, 0, -6, 
-    -7, -6, -6, -10, -18, -29, -37, -36, -26, -16, 
-    -8, -2, 5, 11, 14, 13, 9, 1, -5, -8, 
-    -3, 5, 10, 8, 2, -3, -3, 0, 4, 6, 
-    9, 13, 16, 17, 14, 5, -2, -6, -5, -4, 
-    -5, -8, -11, -10, -5, 2, 7, 6, 0, -8, 
-    -14, -12, -1, 13, 23, 28, 24, 14, 1, -11, 
-    -18, -19, -14, -5, 2, 3, -2, -7, -9, -7, 
-    -6, -5, -3, 2, 6, 5, 2, 0, 0, 1, 
-    3, 5, 5, 3, 1, 1, 5, 10, 13, 14, 
-    12, 10, 6, 1, -5, -10, -15, -20, -25, -26, 
-    -25, -23, -21, -16, -7, 5, 15, 21, 21, 16, 
-    9, 1, -4, -5, -4, -1, 4, 11, 16, 18, 
-    16, 13, 10, 10, 11, 11, 8, 4, 0, -3, 
-    -5, -5, -2, 4, 9, 8, 1, -8, -12, -10, 
-    -7, -7, -10, -13, -14, -12, -11, -13, -17, -22, 
-    -26, -28, -28, -24, -16, -5, 4, 9, 13, 17, 
-    19, 18, 17, 18, 22, 25, 27, 27, 26, 22, 
-    15, 3, -7, -13, -10, -4, 4, 9, 11, 12, 
-    12, 10, 8, 5, 2, -5, -11, -16, -18, -20, 
-    -23, -26, -26, -22, -16, -7, 2, 10, 14, 13, 
-    10, 6, 3, -1, -7, -15, -22, -25, -21, -12, 
-    -1, 8, 14, 20, 22, 20, 14, 8, 2, -3, 
-    -9, -15, -18, -15, -7, 0, 4, 7, 10, 15, 
-    22, 29, 31, 29, 23, 16, 9, 4, 3, 3, 
-    1, -4, -9, -14, -18, -21, -27, -33, -35, -30, 
-    -20, -12, -10, -13, -15, -11, -1, 9, 17, 22, 
-    20, 12, 2, -4, -2, 5, 15, 20, 20, 14, 
-    6, 0, -1, 1, 6, 10, 12, 10, 4, -5, 
-    -12, -14, -13, -9, -6, -6, -5, -1, 7, 16, 
-    22, 21, 14, 5, -4, -10, -16, -22, -24, -23, 
-    -20, -17, -15, -14, -14, -12, -7, -1, 3, 4, 
-    1, -3, -3, 0, 7, 16, 26, 33, 34, 31, 
-    25, 20, 14, 10, 7, 4, 1, -3, -6, -8, 
-    -8, -8, -10, -14, -19, -20, -17, -12, -8, -8, 
-    -11, -13, -14, -14, -12, -6, 1, 6, 8, 10, 
-    15, 22, 27, 26, 20, 14, 10, 9, 7, 4, 
-    2, -1, -3, -7, -11, -16, -21, -22, -20, -16, 
-    -10, -6, -3, -2, 0, 4, 8, 9, 7, 4, 
-    1, 1, 2, 5, 7, 8, 7, 7, 5, 2, 
-    -2, -7, -13, -16, -14, -8, -1, 5, 7, 4, 
-    0, -4, -4, -1, 5, 12, 17, 19, 18, 15, 
-    11, 7, 2, -6, -14, -16, -11, -1, 6, 4, 
-    -5, -13, -17, -15, -9, -2, 1, 0, -2, -3, 
-    -5, -7, -8, -8, -4, 1, 7, 12, 15, 17, 
-    16, 14, 11, 7, 2, -4, -9, -12, -15, -16, 
-    -14, -8, -2, 2, 3, 0, -1, 2, 6, 9, 
-    8, 8, 9, 10, 9, 8, 9, 12, 15, 15, 
-    9, -1, -11, -14, -11, -5, 1, 6, 9, 9, 
-    8, 4, -3, -12, -21, -26, -27, -26, -22, -15, 
-    -7, 3, 12, 17, 16, 10, 3, -1, -2, -4, 
-    -6, -10, -13, -15, -15, -13, -9, -5, -1, -1, 
-    -2, -4, -4, -3, -1, 2, 7, 12, 18, 22, 
-    24, 24, 24, 24, 21, 18, 14, 11, 8, 4, 
-    1, 0, 2, 5, 7, 8, 7, 4, -1, -8, 
-    -15, -18, -18, -18, -18, -17, -15, -11, -8, -7, 
-    -6, -5, -5, -3, 0, 2, 3, 3, 0, -6, 
-    -12, -17, -19, -18, -14, -7, 3, 9, 10, 7, 
-    0, -6, -8, -7, -3, 4, 8, 8, 8, 11, 
-    17, 21, 22, 19, 16, 13, 13, 13, 13, 13, 
-    14, 12, 8, 2, -5, -10, -15, -18, -18, -14, 
-    -7, -3, -6, -13, -19, -21, -19, -17, -15, -11, 
-    -3, 5, 10, 7, 0, -5, -5, -2, 2, 3, 
-    4, 6, 8, 9, 11, 15, 17, 18, 18, 17, 
-    13, 7, -1, -8, -11, -10, -5, 0, 3, 3, 
-    3, 2, -2, -8, -13, -17, -18, -16, -12, -5, 
-    1, 7, 10, 8, 5, 2, -3, -6, -7, -5, 
-    0, 2, 1, -2, -3, -2, -4, -6, -7, -6, 
-    -2, 1, 3, 2, 4, 7, 10, 11, 9, 6, 
-    5, 5, 7, 10, 13, 14, 14, 11, 9, 7, 
-    3, -4, -10, -15, -18, -19, -20, -20, -19, -16, 
-    -13, -10, -6, -1, 5, 11, 15, 14, 9, 5, 
-    4, 3, 2, 1, 1, 2, 3, 3, 3, 2, 
-    1, -1, -2, -3, -3, -1, 1, 3, 3, 2, 
-    0, 0, 2, 3, 3, 1, -1, 0, 1, 3, 
-    3, 1, -2, -6, -12, -16, -17, -12, -6, 2, 
-    9, 13, 11, 5, -2, -6, -6, -2, 1, 3, 
-    3, 0, -1, 0, 3, 7, 10, 12, 10, 4, 
-    -2, -5, -5, -4, -5, -7, -8, -7, -5, -1, 
-    5, 11, 15, 15, 12, 6, 0, -5, -10, -14, 
-    -15, -14, -11, -8, -6, -5, -3, 0, 2, 4, 
-    4, 3, 1, -1, -3, -3, -1, 4, 10, 16, 
-    17, 15, 10, 5, 3, 4, 7, 11, 12, 9, 
-    4, 0, -1, 0, -2, -6, -12, -18, -20, -18, 
-    -12, -6, 0, 3, 4, 3, 1, -2, -6, -11, 
-    -16, -18, -17, -12, -8, -3, 2, 8, 12, 10, 
-    5, 0, -1, 3, 8, 14, 19, 20, 15, 8, 
-    2, 0, 1, 0, -4, -9, -13, -13, -11, -7, 
-    -4, -3, -1, -1, 0, 1, 3, 5, 9, 14, 
-    18, 20, 21, 20, 17, 12, 7, 2, -2, -4, 
-    -5, -8, -11, -13, -13, -11, -9, -10, -14, -18, 
-    -20, -17, -11, -3, 3, 4, -1, -9, -15, -15, 
-    -8, -1, 5, 8, 10, 11, 12, 14, 15, 11, 
-    4, -4, -9, -10, -8, -3, 0, 2, 4, 5, 
-    5, 5, 4, 3, 3, 2, 1, -1, 1, 7, 
-    15, 22, 24, 19, 9, -2, -11, -15, -14, -11, 
-    -9, -9, -9, -6, -2, 0, 1, 1, 2, 4, 
-    4, 2, 2, 3, 5, 4, -1, -7, -13, -17, 
-    -19, -17, -11, -3, 2, 2, -1, -3, -4, -3, 
-    0, 4, 9, 9, 5, 0, -2, 0, 4, 7, 
-    7, 6, 4, 4, 6, 7, 7, 6, 3, -3, 
-    -9, -12, -10, -6, 0, 4, 7, 8, 8, 5, 
-    1, -3, -7, -10, -10, -8, -5, 0, 6, 11, 
-    13, 12, 8, 3, -2, -5, -4, 1, 5, 6, 
-    4, 1, -1, -2, 0, 4, 5, 2, -6, -14, 
-    -19, -21, -18, -13, -7, -3, -1, 0, 2, 5, 
-    10, 12, 10, 6, 1, -2, -3, -1, 5, 11, 
-    14, 13, 10, 3, -6, -11, -12, -8, -3, 1, 
-    5, 8, 9, 6, 1, -4, -8, -12, -13, -11, 
-    -8, -3, 2, 7, 11, 12, 12, 9, 4, -2, 
-    -8, -11, -13, -12, -6, 1, 8, 11, 13, 14, 
-    14, 9, 0, -9, -15, -17, -16, -15, -14, -14, 
-    -14, -12, -7, 2, 14, 26, 33, 32, 25, 14, 
-    3, -8, -18, -21, -17, -9, 0, 6, 10, 11, 
-    13, 14, 13, 10, 6, 2, -3, -9, -14, -18, 
-    -19, -18, -17, -15, -12, -7, 0, 6, 9, 8, 
-    6, 3, 1, 2, 6, 12, 14, 9, 1, -6, 
-    -10, -7, -2, 2, 4, 3, 1, 1, 0, 0, 
-    0, 1, 1, 0, 0, 1, 4, 5, 6, 8, 
-    10, 11, 6, -2, -12, -20, -23, -22, -19, -15, 
-    -11, -6, -1, 7, 15, 20, 21, 18, 13, 8, 
-    5, 3, 0, -3, -4, -2, 0, 1, 0, 0, 
-    0, -1, -4, -11, -17, -19, -15, -8, -3, 1, 
-    2, 3, 2, -1, -3, -2, 3, 10, 15, 16, 
-    12, 6, 3, 5, 9, 11, 8, 1, -5, -8, 
-    -6, 0, 8, 14, 16, 12, 5, -4, -12, -17, 
-    -16, -14, -13, -16, -21, -22, -18, -12, -5, 0, 
-    3, 5, 5, 2, -2, -4, -5, -4, -3, -2, 
-    -2, 0, 4, 9, 16, 23, 30, 32, 28, 18, 
-    6, -3, -6, -7, -7, -5, 0, 6, 9, 7, 
-    2, -2, -5, -5, -3, 2, 7, 10, 9, 4, 
-    -2, -9, -14, -20, -24, -28, -28, -26, -22, -17, 
-    -11, -5, 1, 7, 13, 16, 16, 14, 11, 7, 
-    6, 5, 4, 1, -2, -5, -5, -4, -1, 3, 
-    6, 6, 5, 5, 5, 4, 2, 1, 2, 4, 
-    6, 5, 2, -2, -4, -4, -3, -2, -1, 0, 
-    4, 10, 16, 20, 19, 15, 8, 2, -5, -11, 
-    -18, -26, -29, -28, -24, -18, -13, -8, -2, 4, 
-    10, 14, 14, 10, 4, 0, -5, -7, -5, 1, 
-    11, 22, 30, 31, 23, 11, -2, -12, -17, -21, 
-    -21, -20, -15, -7, 3, 10, 15, 15, 10, 1, 
-    -9, -16, -18, -14, -5, 1, 3, 0, -3, -3, 
-    -1, 2, 4, 5, 5, 4, 1, -3, -5, -2, 
-    3, 8, 12, 13, 11, 10, 10, 11, 11, 11, 
-    9, 5, 0, -5, -10, -12, -13, -12, -9, -5, 
-    -2, -2, -6, -10, -12, -12, -11, -11, -10, -10, 
-    -9, -9, -6, -3, -2, -2, -1, 5, 12, 18, 
-    20, 18, 13, 7, 1, -2, -4, -1, 4, 7, 
-    8, 6, 3, 1, 1, 2, 5, 8, 10, 8, 
-    4, -1, -5, -5, -2, 0, 0, 0, 2, 5, 
-    5, 1, -4, -9, -12, -13, -14, -15, -17, -17, 
-    -13, -7, 0, 5, 8, 7, 3, 0, 1, 4, 
-    4, 2, 1, 4, 12, 20, 23, 19, 9, -2, 
-    -12, -15, -14, -10, -6, -2, 1, 2, 2, 2, 
-    1, -1, -5, -9, -12, -12, -9, -5, -1, 1, 
-    3, 5, 7, 8, 7, 6, 7, 6, 4, 2, 
-    1, 1, 1, 2, 2, 2, 1, -2, -5, -7, 
-    -7, -7, -6, -7, -6, -3, 4, 11, 16, 17, 
-    13, 8, 2, -1, -2, -1, 1, 3, 3, 1, 
-    0, -2, -4, -5, -6, -5, -5, -6, -8, -9, 
-    -8, -7, -8, -10, -10, -8, -3, 0, 2, 2, 
-    2, 0, -2, -3, -2, 1, 5, 9, 10, 9, 
-    7, 2, -2, -6, -6, -3, 1, 5, 6, 7, 
-    12, 17, 19, 17, 13, 10, 8, 5, 1, -3, 
-    -5, -4, -2, -3, -6, -11, -14, -15, -14, -12, 
-    -11, -9, -4, 2, 7, 9, 9, 8, 5, 1, 
-    -1, -1, -1, 0, -1, -5, -9, -12, -12, -9, 
-    -3, 1, 3, 1, -4, -10, -14, -14, -10, -4, 
-    1, 4, 5, 7, 11, 15, 17, 15, 11, 8, 
-    5, 4, 5, 5, 6, 5, 4, 4, 4, 4, 
-    2, 1, -1, -3, -6, -8, -8, -8, -9, -11, 
-    -10, -5, 2, 6, 5, 0, -4, -6, -7, -7, 
-    -6, -4, -1, 3, 6, 9, 13, 18, 19, 15, 
-    8, 4, 3, 5, 7, 7, 3, -1, -6, -11, 
-    -14, -15, -17, -18, -20, -21, -20, -16, -13, -11, 
-    -8, -2, 6, 14, 18, 20, 20, 20, 18, 16, 
-    11, 6, 0, -5, -7, -5, -1, 2, 3, 0, 
-    -5, -8, -8, -8, -8, -8, -7, -2, 5, 11, 
-    16, 17, 15, 10, 5, 1, -2, -4, -5, -7, 
-    -7, -5, -4, -3, -4, -5, -7, -11, -16, -19, 
-    -19, -15, -9, -3, 4, 9, 13, 14, 11, 6, 
-    2, 1, 1, 3, 7, 13, 17, 19, 18, 16, 
-    13, 11, 8, 4, -1, -5, -6, -7, -7, -7, 
-    -8, -8, -8, -9, -12, -17, -21, -21, -19, -14, 
-    -9, -5, -1, 2, 6, 10, 14, 18, 20, 19, 
-    18, 16, 15, 12, 5, -4, -12, -18, -19, -17, 
-    -10, -2, 6, 9, 8, 3, -4, -10, -15, -19, 
-    -19, -13, -3, 7, 12, 11, 8, 7, 6, 6, 
-    6, 6, 6, 6, 6, 5, 3, 0, -4, -7, 
-    -9, -10, -10, -6, 1, 9, 15, 15, 11, 5, 
-    2, 1, 2, 0, -3, -7, -9, -7, -2, 3, 
-    7, 9, 10, 9, 7, 2, -5, -11, -18, -22, 
-    -23, -19, -13, -7, -3, 0, 4, 7, 9, 8, 
-    8, 8, 7, 5, 1, -2, -6, -11, -14, -14, 
-    -8, 1, 11, 18, 18, 16, 11, 7, 5, 4, 
-    3, 2, 0, -2, -6, -10, -12, -11, -7, -2, 
-    5, 9, 9, 5, 1, 0, 2, 4, 4, 2, 
-    -3, -8, -12, -13, -13, -13, -10, -5, 2, 9, 
-    14, 15, 13, 10, 7, 5, 4, 2, 0, -2, 
-    -5, -6, -7, -6, -4, 1, 4, 4, 0, -4, 
-    -6, -3, 0, 3, 5, 6, 3, -1, -5, -7, 
-    -9, -11, -13, -13, -12, -10, -7, -4, 1, 7, 
-    13, 17, 19, 20, 19, 18, 17, 12, 2, -8, 
-    -16, -18, -17, -13, -7, 0, 8, 14, 17, 17, 
-    13, 7, -1, -10, -16, -19, -18, -15, -14, -12, 
-    -10, -7, -4, -1, 2, 5, 8, 10, 12, 14, 
-    15, 15, 12, 7, 1, -3, -4, -3, -1, 0, 
-    0, -2, -4, -5, -5, -4, -3, -4, -6, -7, 
-    -6, -3, 1, 4, 8, 11, 12, 9, 5, 1, 
-    -2, -5, -8, -9, -9, -9, -8, -7, -6, -6, 
-    -6, -6, -5, -2, 0, 0, 1, 3, 7, 9, 
-    9, 6, 4, 3, 2, 1, 2, 5, 10, 16, 
-    20, 23, 23, 21, 17, 12, 6, 0, -6, -14, 
-    -24, -30, -30, -27, -22, -17, -13, -11, -12, -12, 
-    -9, -3, 3, 7, 8, 7, 4, 1, 2, 7, 
-    14, 18, 18, 14, 9, 4, 0, -3, -7, -8, 
-    -7, -5, -2, 0, 2, 2, 3, 2, 1, -1, 
-    -3, -5, -8, -11, -11, -8, -4, -2, -2, -2, 
-    1, 8, 12, 12, 9, 7, 5, 3, 1, 0, 
-    1, 3, 7, 12, 15, 15, 11, 4, -4, -12, 
-    -16, -18, -18, -16, -14, -12, -8, -1, 6, 11, 
-    11, 9, 6, 4, 2, -2, -6, -9, -10, -8, 
-    -6, -4, 0, 3, 6, 8, 9, 10, 10, 8, 
-    2, -6, -12, -15, -14, -11, -7, -3, 2, 6, 
-    9, 11, 13, 14, 14, 15, 14, 12, 8, 3, 
-    -4, -9, -13, -13, -9, -3, 2, 4, 3, 1, 
-    -1, -3, -6, -12, -15, -15, -12, -7, -3, 0, 
-    2, 2, 2, 2, 4, 6, 4, 2, -1, -5, 
-    -7, -6, -3, 1, 3, 3, 3, 2, 2, 4, 
-    5, 7, 9, 8, 4, 1, -2, -3, -2, -2, 
-    -2, -2, 0, 2, 4, 5, 5, 5, 5, 6, 
-    7, 7, 4, -1, -6, -9, -10, -8, -4, 0, 
-    3, 6, 8, 8, 5, 0, -5, -6, -6, -5, 
-    -5, -8, -12, -16, -17, -16, -13, -7, 0, 5, 
-    7, 5, 2, -3, -7, -6, -2, 4, 6, 5, 
-    2, 2, 5, 10, 14, 17, 17, 16, 14, 13, 
-    12, 10, 6, 2, -1, -3, -3, -1, 0, 1, 
-    2, 1, -1, -4, -10, -15, -20, -22, -22, -20, 
-    -17, -14, -10, -5, -1, 1, 1, 3, 6, 8, 
-    10, 10, 11, 11, 10, 10, 8, 5, 2, 0, 
-    2, 5, 7, 6, 2, -3, -9, -13, -15, -14, 
-    -11, -6, -1, 2, 4, 5, 6, 5, 1, -2, 
-    -2, 2, 5, 6, 2, -3, -6, -3, 1, 5, 
-    7, 8, 8, 8, 6, 4, 4, 6, 9, 9, 
-    6, 2, 1, 0, -2, -5, -7, -7, -5, -4, 
-    -5, -9, -12, -14, -15, -15, -15, -14, -12, -9, 
-    -4, 1, 5, 8, 10, 9, 6, 4, 1, -1, 
-    -2, -4, -6, -7, -6, -2, 3, 8, 11, 13, 
-    14, 15, 15, 14, 13, 12, 9, 4, 0, -3, 
-    -6, -8, -8, -5, -1, 2, 4, 4, 3, 0, 
-    -2, -3, -2, 0, 0, -2, -5, -7, -7, -7, 
-    -6, -6, -6, -5, -4, -2, -1, -2, -4, -6, 
-    -6, -4, -1, 3, 5, 6, 5, 2, -2, -4, 
-    -2, 2, 6, 9, 10, 9, 7, 5, 4, 1, 
-    0, -1, -2, -4, -7, -8, -7, -4, -1, 0, 
-    1, 1, 2, 3, 4, 5, 6, 6, 6, 5, 
-    2, -1, -3, -4, -4, -3, -3, -2, -3, -2, 
-    0, 3, 4, 3, 0, -4, -9, -11, -11, -8, 
-    -3, 1, 3, 3, 2, 2, 4, 6, 8, 9, 
-    9, 9, 11, 13, 14, 12, 7, 2, -4, -8, 
-    -13, -17, -20, -22, -22, -19, -15, -9, -3, 2, 
-    8, 13, 15, 13, 7, 1, -3, -4, -3, 0, 
-    2, 4, 4, 2, 1, 0, -1, -1, 0, -1, 
-    -3, -6, -7, -7, -5, -1, 3, 7, 8, 8, 
-    9, 12, 14, 12, 6, -4, -10, -11, -8, -3, 
-    -1, 1, 3, 6, 8, 9, 9, 7, 4, 1, 
-    -2, -2, -2, -2, -4, -6, -11, -14, -14, -12, 
-    -10, -8, -6, -5, -2, 2, 6, 7, 7, 6, 
-    6, 8, 9, 8, 4, -1, -6, -10, -11, -10, 
-    -7, -4, -2, -2, -2, 0, 2, 3, 2, 1, 
-    2, 4, 5, 3, 0, -3, -4, -1, 4, 8, 
-    12, 13, 12, 12, 12, 11, 9, 4, -1, -5, 
-    -6, -4, 1, 4, 5, 1, -5, -11, -14, -14, 
-    -12, -10, -7, -5, -3, -2, -1, 0, -1, -3, 
-    -6, -7, -6, -3, 0, 2, 1, 0, 0, 2, 
-    6, 9, 10, 11, 11, 12, 10, 6, 2, -1, 
-    -2, -3, -3, -5, -4, -3, 0, 1, 1, -1, 
-    -3, -4, -3, -1, 0, 1, 0, -2, -5, -7, 
-    -8, -7, -5, -3, -2, 0, 3, 7, 8, 9, 
-    8, 6, 5, 4, 4, 4, 2, -2, -5, -6, 
-    -6, -5, -3, -1, 0, 0, -1, -2, -4, -6, 
-    -6, -4, 0, 4, 8, 10, 9, 7, 6, 6, 
-    6, 4, 0, -3, -6, -9, -12, -13, -12, -8, 
-    -2, 3, 5, 7, 7, 7, 5, 3, 2, 4, 
-    6, 6, 3, 0, 0, 2, 6, 8, 7, 5, 
-    2, -1, -4, -7, -9, -10, -11, -12, -13, -13, 
-    -11, -8, -7, -9, -11, -10, -6, -2, 0, 0, 
-    0, 0, 2, 6, 11, 16, 19, 20, 19, 16, 
-    13, 11, 9, 8, 5, 2, 1, 1, 3, 5, 
-    5, 4, 2, 0, -4, -7, -9, -9, -8, -7, 
-    -8, -10, -14, -18, -19, -18, -14, -10, -7, -5, 
-    -3, -2, -1, 1, 5, 10, 12, 12, 9, 6, 
-    3, 3, 4, 3, 2, 0, -1, 1, 6, 10, 
-    11, 11, 9, 7, 6, 6, 6, 4, 0, -6, 
-    -11, -14, -15, -14, -11, -7, -3, 0, 1, 1, 
-    -1, -3, -4, -4, -2, -1, -1, 0, 3, 7, 
-    11, 13, 12, 10, 6, 3, 1, -1, -3, -6, 
-    -8, -8, -7, -6, -5, -5, -4, -2, -1, 0, 
-    0, 0, 0, 2, 5, 7, 6, 2, -2, -3, 
-    -3, -1, 0, 2, 4, 5, 5, 4, 2, 2, 
-    2, 3, 4, 5, 4, 3, 2, 1, -1, -4, 
-    -6, -6, -4, -2, 0, 0, 0, -1, -2, -2, 
-    -2, -1, -1, -1, -2, -4, -6, -7, -8, -7, 
-    -5, -3, 0, 1, 0, -3, -6, -6, -2, 3, 
-    6, 8, 9, 9, 8, 7, 6, 5, 3, 2, 
-    1, 1, 2, 4, 7, 8, 8, 5, 3, -1, 
-    -5, -7, -7, -6, -3, -1, 0, 1, 1, 1, 
-    1, 0, -2, -5, -7, -10, -12, -11, -8, -5, 
-    -3, -2, 0, 1, 0, 0, 2, 4, 6, 6, 
-    6, 7, 9, 9, 8, 6, 3, 1, 0, -1, 
-    -2, -3, -2, -1, -1, 0, 0, 0, 1, 0, 
-    -1, -1, -2, -3, -5, -6, -7, -6, -4, -3, 
-    -2, -1, -2, -3, -3, 0, 4, 7, 9, 9, 
-    7, 5, 5, 5, 4, 2, -1, -3, -4, -3, 
-    -3, -2, -2, -3, -3, -2, 0, 5, 8, 9, 
-    8, 6, 3, 1, 0, -1, -3, -5, -8, -10, 
-    -11, -10, -9, -7, -5, -3, -3, -2, -1, 2, 
-    4, 7, 8, 7, 6, 5, 5, 7, 7, 4, 
-    0, -4, -6, -4, -1, 1, 3, 4, 5, 5, 
-    5, 4, 2, 0, -2, -3, -4, -6, -10, -13, 
-    -14, -10, -3, 2, 4, 3, 1, -1, -2, -1, 
-    2, 6, 10, 10, 7, 6, 6, 7, 6, 4, 
-    0, -4, -8, -11, -11, -11, -10, -7, -3, 1, 
-    5, 8, 7, 4, 1, 0, 2, 5, 8, 10, 
-    10, 8, 4, 1, -1, 0, 1, 1, 1, -1, 
-    -4, -8, -10, -12, -12, -11, -9, -6, -2, 2, 
-    3, 2, 0, -3, -4, -3, -3, -2, 0, 4, 
-    10, 15, 15, 10, 3, -3, -8, -10, -9, -7, 
-    -5, -2, -1, 0, 1, 2, 1, 0, -1, 0, 
-    3, 6, 8, 8, 7, 6, 5, 4, 5, 6, 
-    5, 3, 0, -2, -4, -5, -6, -6, -8, -10, 
-    -10, -9, -7, -6, -5, -7, -8, -7, -2, 5, 
-    11, 14, 13, 12, 11, 10, 10, 11, 9, 5, 
-    0, -5, -7, -7, -6, -6, -7, -8, -7, -5, 
-    -2, 1, 1, 0, -3, -4, -3, -2, 0, 0, 
-    0, -2, -3, -4, -5, -7, -7, -6, -3, 2, 
-    7, 11, 12, 11, 8, 7, 7, 9, 9, 7, 
-    4, 2, -1, -4, -6, -8, -9, -9, -6, -4, 
-    -2, -2, -2, 0, 2, 4, 5, 5, 3, 2, 
-    1, 1, 1, 2, 3, 4, 3, 0, -3, -7, 
-    -9, -9, -8, -8, -10, -14, -16, -14, -8, -1, 
-    6, 12, 17, 19, 17, 13, 9, 5, 3, 1, 
-    -1, -2, -1, 0, 2, 2, 1, -1, -3, -4, 
-    -3, -2, -2, -1, 0, 2, 5, 6, 4, 0, 
-    -4, -6, -7, -7, -5, -2, -1, 0, 0, 1, 
-    2, 4, 4, 3, 2, 1, 0, 0, 2, 4, 
-    3, 1, -2, -4, -5, -5, -5, -4, -4, -2, 
-    -1, 1, 3, 3, 2, 0, -2, -5, -7, -7, 
-    -5, -1, 3, 6, 9, 10, 11, 9, 6, 2, 
-    0, 1, 5, 9, 10, 8, 4, 1, -2, -6, 
-    -10, -13, -13, -10, -6, -1, 2, 1, -3, -9, 
-    -13, -14, -12, -10, -8, -7, -6, -4, 0, 3, 
-    4, 3, 3, 5, 8, 10, 11, 11, 11, 10, 
-    9, 8, 8, 7, 7, 6, 6, 6, 6, 5, 
-    5, 4, 4, 2, 0, -2, -3, -4, -6, -8, 
-    -11, -12, -12, -12, -11, -10, -9, -8, -7, -7, 
-    -6, -3, -1, 1, 2, 5, 8, 9, 9, 7, 
-    3, -1, -4, -2, 2, 6, 7, 6, 4, 2, 
-    1, 1, 1, 0, -2, -3, -3, -2, -1, -1, 
-    0, 1, 3, 5, 5, 4, 1, -2, -4, -5, 
-    -6, -5, -4, -4, -3, -3, -2, -3, -4, -5, 
-    -6, -5, -3, 0, 3, 3, 3, 3, 5, 7, 
-    7, 5, 3, 2, 3, 6, 10, 13, 14, 13, 
-    9, 4, -1, -4, -6, -5, -5, -5, -6, -7, 
-    -9, -11, -11, -10, -9, -9, -10, -11, -11, -9, 
-    -5, 1, 7, 13, 15, 14, 9, 3, -3, -7, 
-    -8, -5, -1, 3, 4, 5, 5, 5, 5, 7, 
-    10, 11, 10, 7, 4, -1, -5, -8, -9, -8, 
-    -7, -6, -4, -2, 0, 1, 2, 2, 1, 0, 
-    -1, -1, 1, 3, 3, 2, -1, -4, -7, -9, 
-    -9, -7, -5, -1, 3, 6, 8, 10, 11, 10, 
-    7, 3, 0, -2, -4, -6, -7, -5, -2, 0, 
-    1, 0, 0, 0, 0, -1, -2, -3, -5, -7, 
-    -9, -9, -8, -6, -3, 0, 1, 2, 3, 4, 
-    7, 9, 9, 8, 6, 6, 7, 9, 11, 12, 
-    10, 8, 6, 3, 0, -3, -6, -9, -12, -14, 
-    -15, -13, -11, -8, -4, -1, 2, 3, 2, 0, 
-    -2, -2, -2, 0, 3, 4, 3, 0, -3, -4, 
-    -2, 0, 2, 4, 6, 7, 8, 9, 9, 8, 
-    5, 2, -1, -2, -2, -1, -1, -2, -3, -2, 
-    -2, -2, -4, -5, -5, -4, -2, -1, 0, 1, 
-    1, 0, -3, -8, -10, -9, -6, -3, 0, 2, 
-    3, 4, 3, 3, 2, 2, 2, 1, 1, 1, 
-    2, 2, 3, 4, 5, 6, 8, 8, 8, 6, 
-    4, 1, -1, -2, -3, -3, -3, -3, -4, -4, 
-    -5, -5, -5, -3, -1, 0, 0, -3, -6, -7, 
-    -5, -1, 4, 8, 8, 7, 6, 5, 4, 4, 
-    3, 2, 0, -1, -5, -8, -10, -10, -10, -9, 
-    -9, -7, -6, -4, -1, 2, 5, 6, 6, 5, 
-    3, 2, 2, 2, 3, 4, 4, 4, 2, 1, 
-    2, 4, 7, 8, 8, 7, 6, 5, 3, 3, 
-    4, 4, 1, -3, -8, -12, -14, -14, -13, -10, 
-    -8, -6, -6, -7, -7, -5, -1, 4, 6, 4, 
-    1, -2, -4, -5, -4, -2, 2, 5, 6, 6, 
-    7, 10, 13, 13, 12, 10, 8, 9, 10, 9, 
-    7, 4, 2, 0, -3, -6, -9, -11, -10, -8, 
-    -5, -4, -4, -5, -8, -9, -8, -5, -2, -2, 
-    -3, -7, -10, -9, -6, -2, 1, 4, 5, 5, 
-    7, 10, 14, 15, 13, 10, 7, 3, -1, -5, 
-    -6, -5, -2, -1, -2, -5, -8, -10, -10, -7, 
-    -5, -4, -6, -8, -8, -6, -4, -1, 2, 3, 
-    4, 5, 6, 7, 9, 10, 10, 10, 9, 9, 
-    8, 9, 10, 11, 10, 7, 3, -1, -2, -2, 
-    -1, -1, -3, -4, -7, -9, -12, -12, -12, -10, 
-    -8, -6, -6, -6, -5, -5, -3, 0, 2, 1, 
-    -2, -5, -8, -7, -5, -1, 3, 6, 6, 5, 
-    4, 4, 4, 3, 2, 2, 3, 5, 8, 9, 
-    7, 5, 2, 2, 2, 2, 1, 2, 4, 6, 
-    6, 2, -3, -8, -10, -9, -8, -6, -4, -3, 
-    0, 2, 2, 0, -2, -2, 0, 2, 5, 6, 
-    7, 7, 5, 2, -2, -5, -7, -7, -6, -5, 
-    -4, -3, -2, -2, 0, 1, 3, 3, 2, 1, 
-    2, 3, 3, 2, 1, 0, -1, -2, -5, -7, 
-    -9, -8, -6, -4, -1, 0, 1, 2, 4, 6, 
-    7, 7, 4, 2, 1, 1, 1, 1, 1, 1, 
-    0, 0, -1, -2, -2, -2, -1, 1, 3, 6, 
-    9, 12, 13, 12, 10, 7, 4, 1, -2, -5, 
-    -7, -9, -12, -13, -14, -13, -12, -11, -8, -5, 
-    -2, 0, 1, 2, 2, 3, 5, 7, 6, 4, 
-    1, -2, -2, 0, 2, 3, 2, 2, 3, 4, 
-    5, 5, 5, 5, 6, 6, 5, 2, -1, -4, 
-    -6, -7, -6, -5, -4, -4, -4, -3, -2, 0, 
-    1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 
-    0, 1, 1, 1, 1, 1, 1, 0, -2, -3, 
-    -4, -3, 0, 3, 5, 6, 4, 3, 3, 5, 
-    7, 7, 5, 2, -1, -2, -2, 0, -1, -3, 
-    -5, -6, -7, -6, -4, -3, -1, -1, -1, -1, 
-    0, 1, 1, 1, 1, 0, -2, -2, -1, 2, 
-    4, 5, 4, 4, 2, 1, -1, -2, -3, -4, 
-    -5, -5, -3, -1, 1, 2, 4, 6, 8, 10, 
-    9, 5, 0, -4, -7, -8, -8, -7, -5, -3, 
-    -1, 1, 2, 3, 3, 2, 2, 1, 0, -1, 
-    -3, -4, -4, -1, 2, 4, 5, 4, 3, 3, 
-    2, 0, -4, -7, -8, -7, -5, -2, 1, 2, 
-    3, 2, 2, 1, 1, 0, -1, -2, -2, 0, 
-    2, 5, 7, 7, 6, 4, 3, 0, -2, -3, 
-    -1, 1, 3, 4, 5, 4, 4, 3, 2, 1, 
-    0, 0, -1, -1, -2, -4, -5, -4, -2, 0, 
-    0, -3, -7, -9, -10, -9, -8, -7, -6, -6, 
-    -6, -4, 0, 4, 6, 8, 8, 7, 5, 3, 
-    2, 1, 0, 0, 0, 0, 1, 2, 3, 5, 
-    5, 4, 1, -4, -8, -10, -8, -3, 2, 5, 
-    6, 8, 10, 10, 7, 3, -1, -3, -4, -3, 
-    -2, -1, 1, 3, 5, 6, 4, 1, -1, -2, 
-    -2, -2, -1, -2, -2, -2, 0, 1, 1, -1, 
-    -3, -4, -4, -3, -1, 1, 2, 2, 1, -2, 
-    -5, -9, -12, -14, -12, -8, -3, -1, -1, -3, 
-    -5, -4, -1, 4, 9, 11, 12, 12, 10, 9, 
-    8, 7, 6, 5, 2, 0, -1, -1, -1, 0, 
-    1, 3, 4, 2, -2, -7, -11, -12, -12, -8, 
-    -4, 2, 7, 10, 11, 11, 8, 5, 2, -1, 
-    -2, -3, -2, -1, -2, -4, -5, -6, -6, -3, 
-    0, 3, 4, 3, -1, -4, -5, -5, -5, -4, 
-    -4, -3, -3, -3, -3, -2, 0, 2, 4, 5, 
-    6, 7, 8, 7, 4, 2, 1, 2, 2, 3, 
-    4, 4, 2, -1, -5, -9, -11, -11, -9, -6, 
-    -4, -1, 2, 4, 5, 4, 2, 1, 2, 4, 
-    6, 7, 6, 5, 3, 3, 2, 1, -1, -4, 
-    -7, -8, -7, -5, -1, 2, 3, 3, 2, 1, 
-    0, -1, -1, -2, -3, -5, -5, -3, -1, 1, 
-    2, 1, 0, -1, -1, -1, 0, 1, 2, 2, 
-    1, 0, 0, -1, -1, 0, 1, 1, 0, -2, 
-    -2, -1, 0, 1, 1, 1, 1, 1, 2, 2, 
-    3, 4, 6, 6, 5, 3, 1, 0, -1, -2, 
-    -5, -7, -8, -7, -4, 0, 3, 5, 6, 6, 
-    4, 3, 2, 0, 0, -1, -2, -3, -5, -6, 
-    -7, -7, -6, -6, -6, -7, -5, -3, -1, 1, 
-    3, 5, 7, 9, 9, 8, 8, 7, 6, 4, 
-    1, -1, -3, -4, -4, -2, 0, 3, 4, 4, 
-    4, 4, 5, 5, 3, 1, -2, -5, -7, -6, 
-    -4, -3, -3, -4, -7, -10, -10, -10, -8, -5, 
-    -2, 1, 6, 9, 9, 9, 7, 4, 1, -3, 
-    -5, -6, -5, -4, -2, 1, 3, 4, 4, 3, 
-    3, 2, 3, 4, 4, 4, 2, 0, -3, -5, 
-    -5, -5, -3, -1, 1, 3, 4, 5, 4, 4, 
-    3, 2, 2, 1, 0, -2, -2, -1, 0, 1, 
-    0, -1, -1, -1, -1, 0, 1, 2, 2, 0, 
-    -2, -2, -2, -1, -1, -3, -5, -6, -7, -7, 
-    -5, -3, -2, -2, -3, -3, -2, 1, 4, 6, 
-    8, 8, 6, 4, 2, 1, 1, 2, 5, 8, 
-    11, 12, 11, 8, 5, 2, 0, -2, -4, -6, 
-    -9, -11, -12, -13, -11, -9, -7, -4, -2, -1, 
-    -2, -4, -5, -6, -6, -5, -6, -6, -4, -1, 
-    3, 7, 10, 11, 10, 10, 11, 14, 15, 14, 
-    9, 5, 1, 0, 0, 1, 0, -1, -3, -4, 
-    -3, -1, 1, 1, -1, -4, -6, -6, -5, -2, 
-    0, 0, 0, -1, -3, -6, -7, -6, -4, -2, 
-    0, 1, 0, -3, -7, -9, -10, -8, -4, -1, 
-    2, 4, 6, 8, 10, 10, 8, 5, 2, 0, 
-    1, 3, 6, 7, 7, 5, 1, -2, -4, -5, 
-    -4, -2, 1, 2, 1, -1, -3, -5, -8, -8, 
-    -7, -5, -1, 1, 3, 5, 6, 6, 5, 3, 
-    1, 0, -2, -3, -4, -3, -1, 2, 4, 4, 
-    2, 0, -1, -2, -3, -5, -6, -6, -5, -2, 
-    0, 1, 1, 0, 0, -1, -2, -2, -2, -1, 
-    1, 4, 6, 7, 7, 6, 5, 3, 1, -1, 
-    0, 1, 3, 4, 4, 4, 2, -1, -2, -1, 
-    1, 1, -1, -4, -6, -6, -6, -5, -5, -5, 
-    -5, -6, -7, -7, -7, -6, -4, -1, 2, 3, 
-    3, 2, 2, 3, 5, 6, 6, 6, 5, 5, 
-    4, 4, 4, 4, 4, 3, 1, 0, 0, 1, 
-    2, 2, 1, 0, -1, -1, -2, -3, -5, -7, 
-    -8, -8, -6, -3, 0, 2, 3, 3, 2, 1, 
-    1, -1, -4, -5, -5, -3, 1, 4, 6, 6, 
-    4, 2, 2, 2, 2, 2, 1, -1, -3, -5, 
-    -5, -4, -3, -1, 1, 2, 2, 2, 1, 0, 
-    -2, -2, -2, -2, -3, -4, -5, -6, -5, -3, 
-    0, 2, 5, 7, 8, 9, 9, 9, 7, 5, 
-    2, -1, -3, -3, -2, -1, -2, -3, -4, -5, 
-    -6, -6, -6, -5, -2, 1, 4, 5, 4, 3, 
-    1, -1, -3, -4, -4, -4, -3, -1, 3, 6, 
-    7, 5, 2, 0, -2, -4, -5, -6, -7, -6, 
-    -4, -2, 2, 5, 7, 7, 6, 6, 7, 8, 
-    7, 5, 3, 1, 0, -1, 0, 1, 2, 2, 
-    0, -2, -4, -6, -6, -6, -5, -3, -3, -2, 
-    -3, -3, -2, -2, -1, -1, 0, 0, 0, 0, 
-    0, -1, -3, -4, -5, -5, -3, -1, 0, 1, 
-    2, 2, 3, 3, 4, 4, 5, 5, 5, 5, 
-    5, 6, 7, 7, 6, 5, 2, -1, -4, -6, 
-    -7, -8, -8, -7, -4, -1, 1, 0, -2, -4, 
-    -6, -7, -7, -5, -2, 1, 3, 4, 5, 4, 
-    3, 2, 1, 0, -1, -1, 0, 2, 3, 4, 
-    4, 4, 5, 5, 4, 3, 2, 1, 0, -1, 
-    -3, -4, -5, -6, -7, -7, -6, -5, -4, -2, 
-    0, 3, 4, 5, 5, 4, 3, 1, 1, 1, 
-    1, 1, 0, 0, 0, 0, 1, 2, 2, 1, 
-    1, 2, 3, 4, 5, 3, -1, -5, -8, -10, 
-    -11, -12, -13, -11, -7, -3, 1, 4, 5, 6, 
-    7, 8, 9, 9, 7, 6, 4, 3, 2, 1, 
-    1, 1, 0, 0, -1, -2, -2, -1, 1, 2, 
-    2, 0, -1, -1, -1, -1, -1, -2, -3, -2, 
-    -1, -1, -1, -2, -2, -3, -4, -6, -6, -6, 
-    -4, -3, -3, -2, 0, 2, 5, 6, 6, 5, 
-    3, 1, -1, -3, -5, -5, -3, -1, 0, 0, 
-    0, 1, 4, 7, 10, 12, 12, 11, 8, 6, 
-    5, 4, 2, 0, -3, -6, -9, -11, -11, -9, 
-    -7, -6, -5, -3, -2, 0, 2, 3, 3, 2, 
-    1, -2, -5, -6, -6, -5, -4, -3, -2, 0, 
-    2, 4, 5, 6, 7, 8, 8, 8, 7, 4, 
-    -1, -5, -6, -5, -2, 1, 4, 4, 3, 2, 
-    1, -1, -3, -5, -6, -4, -1, 2, 2, 1, 
-    -1, -2, -3, -3, -4, -5, -7, -7, -7, -5, 
-    -3, -1, 1, 3, 3, 4, 5, 5, 4, 4, 
-    4, 6, 7, 7, 5, 3, 2, 2, 3, 4, 
-    3, 2, 1, 0, 1, 1, 0, -1, -3, -4, 
-    -4, -3, -3, -3, -3, -2, -1, -1, -2, -4, 
-    -5, -5, -3, 0, 2, 4, 4, 2, 0, -1, 
-    0, 0, 0, 0, 1, 3, 4, 3, 0, -2, 
-    -3, -4, -3, -3, -2, -1, 0, 1, 2, 3, 
-    4, 4, 3, 1, -3, -6, -8, -7, -5, -3, 
-    0, 2, 4, 5, 6, 6, 6, 5, 3, 0, 
-    -3, -5, -6, -6, -5, -3, -2, 0, 1, 1, 
-    1, 1, 2, 4, 7, 9, 9, 9, 8, 6, 
-    3, 0, -4, -6, -7, -7, -5, -3, 0, 1, 
-    1, 0, -2, -2, -1, 1, 1, 0, -2, -4, 
-    -5, -5, -4, -2, -1, 0, 1, 1, 0, -1, 
-    -2, -3, -4, -4, -4, -3, -1, 2, 3, 4, 
-    4, 3, 3, 2, 1, 2, 3, 4, 5, 5, 
-    5, 4, 4, 3, 1, -2, -3, -4, -3, -3, 
-    -3, -2, -1, 0, 1, 1, 2, 2, 1, 0, 
-    0, -1, -1, -1, -2, -3, -4, -4, -3, -2, 
-    0, 3, 5, 6, 6, 5, 4, 3, 1, -1, 
-    -2, -3, -3, -3, -3, -2, -1, 0, 0, 1, 
-    0, 0, -2, -4, -6, -6, -5, -3, -2, -2, 
-    -2, -2, 0, 2, 4, 6, 7, 7, 6, 5, 
-    3, 0, -2, -3, -3, -3, -1, 1, 3, 3, 
-    3, 2, 1, 0, 0, -1, -1, -1, 0, -1, 
-    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 
-    -1, -2, -2, -2, 0, 1, 2, 2, 2, 1, 
-    1, 1, 0, 0, 0, -1, -1, -1, 0, 2, 
-    2, 2, 1, 1, 1, 1, 1, 0, 0, -1, 
-    -1, -1, -2, -2, -1, -1, -1, 0, 0, 0, 
-    0, -2, -3, -4, -5, -4, -3, -2, 0, 2, 
-    3, 4, 4, 3, 3, 2, 2, 2, 2, 2, 
-    1, 1, 0, -1, -2, -2, -3, -3, -2, -1, 
-    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 
-    1, 1, 0, -1, -1, -2, -2, -2, -2, -1, 
-    0, 1, 2, 1, 0, -2, -3, -3, -3, -2, 
-    -1, -1, -1, -1, -1, 0, 1, 2, 3, 3, 
-    3, 2, 1, 1, 1, 2, 2, 2, 1, 1, 
-    1, 0, -1, -2, -2, -3, -3, -4, -3, -2, 
-    -2, -2, -2, -2, -1, 0, 1, 2, 3, 3, 
-    2, 1, 0, 0, -1, 0, 0, 0, 1, 1, 
-    1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 1, 0, -2, -3, -3, -3, -2, -2, -1, 
-    -1, -1, -2, -3, -4, -4, -3, -2, -1, 0, 
-    0, 0, 1, 2, 3, 3, 2, 1, 0, 0, 
-    0, 1, 2, 3, 3, 2, 1, 0, 0, 0, 
-    0, 1, 1, 0, 0, -1, -1, 0, 0, 1, 
-    0, 0, 0, -1, -1, -2, -2, -3, -3, -2, 
-    -2, -1, -1, -1, -1, -1, -1, 0, 1, 2, 
-    2, 3, 2, 2, 1, 1, 1, 1, 1, 0, 
-    0, 0, 0, 0, 1, 1, 1, 0, -1, -1, 
-    -2, -2, -2, -2, -1, -1, 0, 1, 1, 2, 
-    2, 1, 1, 1, 0, -1, -1, -1, -2, -2, 
-    -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 
-    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 
-    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
-    -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 
-    0, 1, 1, 2, 2, 2, 2, 1, 1, 1, 
-    0, 0, 0, -1, -1, -1, 0, 0, 1, 2, 
-    2, 1, 1, 0, 0, -1, -1, -2, -2, -2, 
-    -1, -1, 0, 0, 0, 1, 1, 1, 1, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 
-    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 1, 1, 1, 0, 0, 0, -1, -1, 
-    -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 
-    0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 
-    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 
-    -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 
+const int clap_packed_len = 15483;
+const uint8_t clap_packed[] = {
+    0x56, 0x03, 0x80, 0xda, 0x16, 0xc1, 0xda, 0x04, 0x07, 0x7d, 0x12, 0x11, 0x40, 0xb4, 0x81, 0x3e,
+    0xaa, 0xf6, 0x80, 0xbf, 0x0f, 0x76, 0x2e, 0xd4, 0xa3, 0xe6, 0x69, 0x27, 0xa8, 0xfd, 0xf5, 0x84,
+    0x5d, 0xc3, 0x01, 0xd6, 0x07, 0xff, 0x45, 0xba, 0x99, 0xf1, 0x1a, 0x0c, 0xaf, 0xeb, 0xcd, 0xf8,
+    0x18, 0xff, 0x8d, 0x2f, 0xcd, 0x1b, 0xd6, 0x1b, 0x2d, 0x47, 0xd2, 0xe7, 0x63, 0xc6, 0xf6, 0x5c,
+    0x5f, 0x57, 0xcf, 0x7d, 0x62, 0x35, 0xd2, 0x41, 0xc2, 0x34, 0x0b, 0xa4, 0xab, 0x07, 0xe3, 0x03,
+    0xfc, 0x80, 0x76, 0x95, 0xb7, 0xa2, 0x7b, 0x8a, 0xa0, 0x0c, 0xf1, 0xb4, 0x74, 0x20, 0x61, 0x48,
+    0xa8, 0xec, 0x6b, 0x2f, 0xc0, 0x06, 0xbf, 0x0f, 0x49, 0xe5, 0xa9, 0x80, 0x47, 0xca, 0xbf, 0xaa,
+    0xcc, 0x72, 0x07, 0xf9, 0x4d, 0xce, 0x4a, 0x95, 0xb3, 0xac, 0xfe, 0x8e, 0x51, 0xe8, 0xf1, 0x47,
+    0x0e, 0xd9, 0x71, 0x1e, 0xa5, 0xf9, 0x59, 0x04, 0xbc, 0x1d, 0xec, 0x84, 0x9b, 0x20, 0x0e, 0xb5,
+    0xce, 0xcc, 0xe2, 0x92, 0xb3, 0x39, 0x9c, 0xba, 0x75, 0xa1, 0xa9, 0x6c, 0xc9, 0xdc, 0x72, 0x32,
+    0xea, 0x87, 0xe2, 0xca, 0x07, 0xd0, 0x95, 0x88, 0xfa, 0xe5, 0xad, 0x9b, 0x64, 0xcc, 0x16, 0xac,
+    0xa1, 0xe0, 0x95, 0x12, 0x94, 0x8a, 0x82, 0x2a, 0x3b, 0xf5, 0x93, 0x64, 0x7a, 0x5c, 0x00, 0xa5,
+    0x7f, 0xf9, 0x91, 0x92, 0x48, 0x88, 0x82, 0xc9, 0x66, 0x17, 0x14, 0x2c, 0xaf, 0xcc, 0xbd, 0x4f,
+    0xc8, 0xf9, 0xb3, 0x51, 0x0e, 0x70, 0x82, 0x97, 0x20, 0xb0, 0x62, 0x15, 0x76, 0x2e, 0x9d, 0x39,
+    0x68, 0xcb, 0x94, 0x44, 0xb8, 0xe8, 0x61, 0xad, 0x81, 0xa3, 0xf5, 0x08, 0x40, 0xd6, 0x4d, 0x04,
+    0xc3, 0x5e, 0x21, 0xb3, 0xe9, 0xc3, 0x02, 0xb9, 0xf1, 0xc1, 0xfb, 0x12, 0x41, 0x11, 0x29, 0x1b,
+    0x0e, 0xd8, 0x15, 0xa6, 0xda, 0x44, 0x87, 0x80, 0x95, 0x0e, 0x86, 0x71, 0x08, 0x86, 0x01, 0x3a,
+    0xd0, 0x24, 0x71, 0x46, 0x75, 0x88, 0xc1, 0x76, 0x1e, 0xc7, 0xf0, 0x0d, 0x2c, 0xd9, 0x33, 0xa7,
+    0x0e, 0xa8, 0x24, 0xc9, 0xf0, 0xc9, 0x45, 0xf2, 0xcf, 0x0d, 0xb8, 0x40, 0xcb, 0x2a, 0xaf, 0x0a,
+    0xaa, 0x67, 0xad, 0x62, 0x40, 0x8c, 0x06, 0x04, 0xbc, 0x97, 0x27, 0xc8, 0xce, 0xe9, 0x4a, 0x89,
+    0xc8, 0xf3, 0x93, 0x58, 0xed, 0xa8, 0x82, 0xc3, 0x2e, 0x30, 0x4f, 0x81, 0xe3, 0x0b, 0xa3, 0xaa,
+    0x4b, 0xb6, 0x0c, 0xf6, 0xa7, 0x44, 0x5f, 0x69, 0xf3, 0x40, 0x48, 0x87, 0x49, 0x35, 0x38, 0xc9,
+    0x88, 0x5b, 0x1e, 0xd1, 0x12, 0xf0, 0xd9, 0x58, 0xd0, 0xf4, 0x39, 0xa3, 0x64, 0x2b, 0xc7, 0xe0,
+    0x2c, 0x36, 0x97, 0x06, 0x40, 0xa0, 0x01, 0x81, 0xd1, 0x6c, 0x36, 0x6d, 0x93, 0xf3, 0xab, 0x0d,
+    0x48, 0xc2, 0x03, 0xf9, 0xa2, 0x92, 0x40, 0x33, 0x1e, 0x78, 0xf1, 0xa6, 0xa8, 0x0b, 0xa5, 0x00,
+    0x30, 0x82, 0x99, 0xf2, 0xb6, 0x48, 0xa0, 0x83, 0xa2, 0xe4, 0x40, 0x68, 0x17, 0xc8, 0x4c, 0xb3,
+    0x8b, 0xc8, 0x4a, 0xc5, 0xfc, 0xed, 0x4b, 0x25, 0x04, 0x07, 0xc8, 0xc8, 0xc5, 0xec, 0xb4, 0x08,
+    0x00, 0xa7, 0x47, 0x39, 0x50, 0x0b, 0x60, 0xb0, 0x83, 0xc4, 0xd8, 0x44, 0xb8, 0x8a, 0x07, 0x58,
+    0x3d, 0x00, 0x80, 0x6e, 0x0f, 0x95, 0x50, 0x50, 0xe0, 0xdf, 0x1e, 0xad, 0x70, 0xc5, 0x0c, 0x2d,
+    0x05, 0x80, 0x1c, 0x0f, 0x70, 0x09, 0x0e, 0x2c, 0x75, 0xce, 0x34, 0x0e, 0x91, 0x60, 0x5d, 0x50,
+    0x04, 0x0c, 0x43, 0xc0, 0xc7, 0x0f, 0x60, 0x18, 0xc3, 0xac, 0x0a, 0x83, 0x74, 0x03, 0x00, 0xf9,
+    0xce, 0xd2, 0x55, 0x31, 0x8c, 0x98, 0xca, 0x04, 0xb0, 0xd2, 0xc1, 0xd8, 0xbf, 0x8b, 0xc8, 0x01,
+    0x07, 0x11, 0x14, 0x80, 0x3c, 0xcf, 0x43, 0x7c, 0x06, 0x41, 0x44, 0x25, 0x43, 0xbc, 0x0f, 0x87,
+    0x3c, 0x4d, 0x43, 0xb0, 0x40, 0x80, 0x10, 0x1f, 0x0e, 0x7c, 0x89, 0xd2, 0xb8, 0x64, 0x8b, 0x5c,
+    0x95, 0xc2, 0x90, 0x01, 0xc8, 0x1c, 0x00, 0x54, 0x88, 0x2b, 0xd4, 0x04, 0x45, 0x8f, 0xd0, 0x33,
+    0x85, 0x14, 0x05, 0xc0, 0x0c, 0x0c, 0x05, 0xbc, 0xa1, 0x86, 0xd8, 0xa4, 0x49, 0x74, 0x05, 0x81,
+    0x88, 0x1c, 0xc1, 0x10, 0x3d, 0x43, 0x20, 0xb3, 0x04, 0x68, 0x2a, 0xc1, 0x3c, 0x85, 0x43, 0x50,
+    0x74, 0x82, 0x88, 0x1b, 0x83, 0x24, 0x00, 0x06, 0x54, 0x31, 0xc4, 0x4c, 0x1c, 0x44, 0x18, 0x37,
+    0x83, 0xf8, 0x1d, 0x86, 0xd4, 0x4a, 0x42, 0xd4, 0x0a, 0x45, 0xc8, 0x2b, 0x08, 0x58, 0x2b, 0x80,
+    0x88, 0x0a, 0x82, 0xc0, 0x23, 0xc7, 0x84, 0x45, 0x42, 0x94, 0x3d, 0xc7, 0xa4, 0x48, 0x08, 0x88,
+    0x13, 0xc1, 0x44, 0x05, 0x40, 0xd8, 0x01, 0x4d, 0xb9, 0xd0, 0xcd, 0x5e, 0x7c, 0x0d, 0x58, 0x50,
+    0xcd, 0x3b, 0x09, 0x7c, 0x10, 0x42, 0x9d, 0x02, 0x6f, 0xe5, 0xf2, 0x4a, 0xcb, 0x7b, 0x85, 0x0f,
+    0x9e, 0xbf, 0xaa, 0xbf, 0xe6, 0x43, 0xf5, 0x8c, 0xff, 0xc3, 0xeb, 0x8b, 0x5e, 0xaa, 0x36, 0x62,
+    0x1e, 0x0b, 0xe2, 0x0a, 0xd5, 0xa3, 0x34, 0xa8, 0x83, 0x78, 0x3e, 0xf0, 0x3b, 0xc6, 0x37, 0x9e,
+    0xc6, 0x18, 0xbf, 0xfc, 0x0e, 0xee, 0x5f, 0xf9, 0xa7, 0x73, 0xbe, 0xde, 0x02, 0x3e, 0x27, 0xd2,
+    0x82, 0x7f, 0xb3, 0xff, 0xed, 0x9d, 0xff, 0xc9, 0x2b, 0xdd, 0x77, 0xf4, 0x0b, 0xe8, 0xe7, 0x71,
+    0x3f, 0x2a, 0x6d, 0x49, 0x85, 0x9c, 0x26, 0xb9, 0xa6, 0x81, 0x6f, 0xaa, 0x66, 0x21, 0xdf, 0x2f,
+    0xca, 0x31, 0xff, 0xbf, 0xee, 0x7b, 0x3c, 0x1c, 0x78, 0xaa, 0x7e, 0x03, 0x92, 0xd6, 0xcc, 0x13,
+    0xf4, 0x93, 0xfa, 0x76, 0xe1, 0xed, 0xd1, 0xcb, 0x8d, 0xd5, 0x9f, 0x30, 0x5f, 0xe2, 0xc3, 0x0f,
+    0x0c, 0x04, 0xa9, 0xeb, 0x0b, 0xb6, 0xf3, 0x8f, 0x3c, 0x27, 0xa0, 0x97, 0x8d, 0xaa, 0x52, 0xfa,
+    0x35, 0xd3, 0xa3, 0xfe, 0x73, 0x8b, 0x0d, 0xe2, 0x7b, 0x66, 0x51, 0xd0, 0x6d, 0x44, 0xdf, 0xdb,
+    0x83, 0x4c, 0x2e, 0x90, 0x16, 0x58, 0xc7, 0xc6, 0x56, 0xbe, 0x8b, 0x7a, 0x64, 0xb1, 0x4a, 0xc7,
+    0xfe, 0x07, 0x5b, 0xcf, 0x04, 0xcb, 0x77, 0xe5, 0x46, 0x62, 0x16, 0x7a, 0xd3, 0xe0, 0xbc, 0xa3,
+    0x4e, 0xfb, 0xd0, 0x59, 0xc3, 0x46, 0xc7, 0x79, 0x55, 0xab, 0xc8, 0x5d, 0x5b, 0xbd, 0x9f, 0xf7,
+    0xad, 0xe5, 0x2b, 0xe5, 0x29, 0xdb, 0x8a, 0xc3, 0x2e, 0x06, 0xa5, 0xe7, 0xc1, 0xeb, 0xc5, 0x7c,
+    0x4d, 0x79, 0xc7, 0x52, 0xe7, 0xd9, 0x41, 0x77, 0xde, 0x34, 0x48, 0x14, 0xdf, 0x9f, 0xa7, 0x1b,
+    0xbf, 0xd0, 0xff, 0x50, 0x0e, 0xc8, 0x4c, 0xf2, 0xf7, 0xf5, 0xf3, 0x97, 0xc9, 0x8e, 0x16, 0x09,
+    0xd8, 0xb3, 0x4e, 0x8c, 0x35, 0x91, 0xe6, 0x59, 0x3e, 0x4e, 0x2b, 0x77, 0x05, 0x73, 0xf8, 0x6f,
+    0x6d, 0xd9, 0x2d, 0x85, 0x72, 0x46, 0x28, 0x18, 0x13, 0x91, 0xb6, 0xa1, 0xb1, 0x0c, 0x26, 0xb3,
+    0xe9, 0x51, 0x0e, 0xfe, 0x30, 0xfe, 0x8e, 0xc5, 0x19, 0x60, 0x73, 0x0a, 0xea, 0x0d, 0x49, 0x31,
+    0xf4, 0x30, 0xc4, 0x03, 0x15, 0x71, 0x83, 0x6f, 0x86, 0xfe, 0xa0, 0x7a, 0x3a, 0x81, 0x26, 0xdb,
+    0xc1, 0x91, 0xbd, 0x36, 0x29, 0x7d, 0x77, 0xe8, 0x6d, 0xa8, 0x12, 0x78, 0x37, 0xac, 0x49, 0xa2,
+    0xc9, 0x31, 0x19, 0xf0, 0xce, 0x51, 0xcf, 0x02, 0x64, 0x07, 0xd5, 0xf4, 0x77, 0x73, 0x8e, 0x22,
+    0xff, 0x12, 0x98, 0x43, 0xaa, 0xf2, 0xf1, 0x35, 0xf1, 0xf1, 0x81, 0xc0, 0xf7, 0xb3, 0xfc, 0x5e,
+    0xac, 0xf8, 0x7b, 0xb1, 0x65, 0x55, 0x87, 0x92, 0x66, 0xd8, 0x77, 0xb9, 0xd2, 0x84, 0x55, 0xc5,
+    0x8e, 0xe8, 0xd4, 0xad, 0xd2, 0x32, 0x33, 0x3c, 0xde, 0x44, 0xf8, 0x4f, 0x2b, 0xc1, 0xae, 0xa4,
+    0xa7, 0xf5, 0x87, 0x52, 0x50, 0xa6, 0x29, 0x22, 0x72, 0x18, 0x40, 0xb2, 0x94, 0x55, 0x99, 0x1e,
+    0xf5, 0xb0, 0xe8, 0x99, 0x0c, 0x43, 0x6d, 0x72, 0x7b, 0x19, 0xbe, 0x3b, 0xc1, 0x92, 0x8c, 0xc6,
+    0x18, 0xe1, 0x9e, 0x01, 0x98, 0x39, 0x4c, 0x16, 0x33, 0x23, 0x6a, 0x10, 0x03, 0x24, 0x30, 0xc9,
+    0x9e, 0x7e, 0x66, 0x7e, 0x01, 0x41, 0x26, 0x2e, 0x32, 0xf8, 0x86, 0x65, 0x7b, 0xd8, 0xed, 0xeb,
+    0x15, 0x31, 0x0d, 0x81, 0xe5, 0x9a, 0x40, 0x11, 0xfd, 0x09, 0xa8, 0x2e, 0x89, 0x3c, 0xa6, 0x10,
+    0xc5, 0xfd, 0xc9, 0xe0, 0x62, 0x53, 0x99, 0xd1, 0x05, 0xc8, 0xf2, 0x26, 0xf7, 0x03, 0x13, 0xfe,
+    0x23, 0xc6, 0x80, 0x1c, 0x08, 0xdd, 0x9d, 0x6a, 0x30, 0x0f, 0xf2, 0x45, 0x0a, 0xdd, 0x6c, 0xc8,
+    0x8a, 0x80, 0x88, 0xd0, 0x8d, 0x4c, 0xf3, 0x24, 0xb3, 0xf2, 0x53, 0x44, 0x34, 0x45, 0x47, 0x11,
+    0x7f, 0xd3, 0x58, 0x1f, 0x26, 0xfb, 0x6e, 0x95, 0xc4, 0x58, 0x03, 0x78, 0x0b, 0x73, 0x49, 0x33,
+    0x62, 0xf5, 0x12, 0x72, 0x04, 0x0b, 0x63, 0x7c, 0x5d, 0x98, 0xe1, 0x9f, 0x09, 0x5b, 0xa1, 0x31,
+    0xdb, 0x34, 0xe4, 0x83, 0x15, 0x45, 0x54, 0x48, 0x90, 0x94, 0x0e, 0xd8, 0x1e, 0x8c, 0x0c, 0xca,
+    0x52, 0x24, 0x63, 0x47, 0x14, 0x2e, 0x21, 0xb0, 0x5f, 0x08, 0x86, 0x07, 0x0d, 0x48, 0x13, 0x8d,
+    0xde, 0x3f, 0x8a, 0x60, 0x1c, 0x82, 0xfc, 0xb6, 0xef, 0xa2, 0x85, 0x0d, 0x5c, 0x88, 0x6a, 0xbe,
+    0x61, 0x46, 0xac, 0x89, 0x66, 0x72, 0x12, 0x41, 0x88, 0x01, 0x61, 0x4a, 0x42, 0x40, 0xae, 0x70,
+    0xa2, 0x5e, 0x43, 0x01, 0x92, 0x4c, 0x21, 0xde, 0x00, 0x62, 0x0c, 0x12, 0xc3, 0xd8, 0x59, 0x01,
+    0x86, 0x20, 0xe4, 0x8c, 0x4e, 0x84, 0x7c, 0x24, 0xc3, 0xc8, 0x38, 0x44, 0x3a, 0x19, 0xe7, 0x5c,
+    0x20, 0x47, 0xe2, 0x45, 0xa0, 0x00, 0x0f, 0x22, 0x92, 0x23, 0x20, 0x08, 0x16, 0x62, 0xb6, 0x1f,
+    0xc2, 0xd0, 0x32, 0xc2, 0x0c, 0x43, 0xe3, 0x2e, 0x80, 0xe8, 0x06, 0x5e, 0x45, 0x60, 0x2c, 0x22,
+    0x66, 0x6c, 0xc4, 0xf0, 0x4c, 0x60, 0x66, 0x01, 0x62, 0x40, 0x69, 0x00, 0xee, 0x97, 0xa2, 0xea,
+    0x0f, 0x40, 0x0a, 0x21, 0xa1, 0x38, 0x40, 0xc0, 0x78, 0x1a, 0x82, 0xd2, 0x11, 0xa0, 0xbe, 0x08,
+    0xc4, 0x28, 0x3f, 0xc2, 0x0c, 0x12, 0xc2, 0x58, 0x16, 0xc3, 0xa2, 0x2f, 0xe3, 0xd8, 0x1d, 0x29,
+    0x72, 0x3b, 0xe1, 0x58, 0x1b, 0x01, 0x50, 0x16, 0x43, 0xd4, 0x23, 0xe4, 0x6e, 0x1e, 0xe3, 0xfe,
+    0x44, 0x83, 0x10, 0x0d, 0xc0, 0xa4, 0x0e, 0xe1, 0x52, 0x92, 0x05, 0xc8, 0x2d, 0xa2, 0x0a, 0x54,
+    0x60, 0x18, 0x1e, 0x62, 0xbc, 0x48, 0x43, 0x14, 0x03, 0x60, 0x5e, 0x37, 0xe1, 0xae, 0x38, 0xc4,
+    0x3a, 0x43, 0x44, 0x5e, 0x49, 0x0e, 0x75, 0x80, 0x88, 0x74, 0xfb, 0xb3, 0xfc, 0x88, 0x3f, 0xd9,
+    0x8b, 0xea, 0xe7, 0xe4, 0x17, 0x7f, 0xea, 0x77, 0x7e, 0x38, 0x3d, 0x3e, 0x7f, 0xbe, 0x76, 0x0a,
+    0xde, 0xba, 0x73, 0x15, 0xb5, 0x15, 0x91, 0x23, 0x43, 0x5f, 0x2f, 0x26, 0x64, 0xa4, 0x80, 0xcd,
+    0x55, 0xe2, 0x02, 0x12, 0xab, 0x0b, 0x99, 0xcf, 0x01, 0x3c, 0x45, 0x39, 0x43, 0x66, 0x23, 0x52,
+    0xdf, 0xde, 0x83, 0xc8, 0xfb, 0xdf, 0xcf, 0xa8, 0x3f, 0x91, 0x08, 0xa1, 0x74, 0xb6, 0xbd, 0xf6,
+    0x97, 0x02, 0x2b, 0xa7, 0x88, 0xcf, 0xed, 0x35, 0x9e, 0xdf, 0xf6, 0x0d, 0xe3, 0x35, 0xfe, 0x15,
+    0x1a, 0x58, 0xfd, 0x10, 0x40, 0x2a, 0xed, 0x05, 0x42, 0x5a, 0x77, 0x2a, 0xa2, 0xf6, 0xd7, 0x16,
+    0x0e, 0x94, 0x4c, 0x84, 0xfa, 0xc9, 0x90, 0xa6, 0xd7, 0x05, 0xb9, 0xc1, 0x93, 0x74, 0x1f, 0xc2,
+    0x57, 0x84, 0x1e, 0xf3, 0x7b, 0x25, 0x79, 0xe1, 0x6b, 0x59, 0x19, 0x4b, 0x3b, 0x02, 0x0b, 0xdc,
+    0x18, 0x36, 0xa1, 0x7f, 0x28, 0x16, 0x55, 0xe0, 0x54, 0x36, 0x94, 0x50, 0xe0, 0xbb, 0xd4, 0x16,
+    0x43, 0x56, 0xf0, 0xbe, 0xb2, 0x8b, 0x62, 0x5c, 0xed, 0x50, 0x44, 0x41, 0x6e, 0xca, 0x38, 0x9d,
+    0x77, 0xee, 0x2b, 0x49, 0xef, 0xcc, 0x7e, 0x50, 0xf7, 0x0f, 0xb0, 0xf9, 0x99, 0x02, 0xf0, 0x02,
+    0x08, 0x76, 0xc0, 0xf2, 0xfb, 0xcf, 0x5a, 0xec, 0x8a, 0xfa, 0xa0, 0xcc, 0x17, 0xdf, 0x50, 0xf4,
+    0xbe, 0x17, 0x71, 0x11, 0xcd, 0xc1, 0xd2, 0x06, 0x94, 0x8e, 0x02, 0x0e, 0x95, 0x9c, 0xe2, 0xb8,
+    0xd5, 0xf9, 0x2e, 0xa7, 0x86, 0x2b, 0x87, 0x50, 0x75, 0xfa, 0xfc, 0x55, 0x38, 0x4a, 0x93, 0x5f,
+    0xcb, 0x2e, 0xc3, 0xab, 0x32, 0xb7, 0x9b, 0x78, 0x50, 0xc1, 0xb4, 0x9c, 0xc9, 0xc6, 0x12, 0xe9,
+    0xea, 0x8a, 0x9c, 0x82, 0xf4, 0x0c, 0x11, 0x2a, 0xd1, 0x5a, 0x9b, 0x0c, 0x7a, 0xfc, 0xeb, 0x1b,
+    0x9e, 0x9a, 0xe4, 0x02, 0xc6, 0x94, 0xb9, 0xfb, 0xc4, 0x85, 0x9a, 0x61, 0x14, 0xb3, 0xd9, 0x98,
+    0x92, 0x3e, 0xcf, 0x53, 0xfb, 0xe8, 0x6a, 0x45, 0x22, 0xb1, 0xbb, 0x77, 0xb8, 0xf4, 0x28, 0x0b,
+    0xb0, 0xa0, 0x9c, 0xf1, 0x06, 0x86, 0xa6, 0x37, 0x06, 0x70, 0x9e, 0x45, 0x65, 0xb3, 0x2d, 0x74,
+    0x6a, 0x30, 0x8d, 0x86, 0x4e, 0x1d, 0xae, 0x9a, 0x44, 0x62, 0x4c, 0x5f, 0x30, 0x6f, 0x25, 0x3b,
+    0x5d, 0x54, 0x2f, 0xc2, 0xce, 0x15, 0x1c, 0x58, 0x9d, 0x20, 0xac, 0x22, 0x07, 0x36, 0x72, 0x94,
+    0x2a, 0x2b, 0x87, 0xd5, 0xed, 0x96, 0x0f, 0xda, 0xac, 0x8a, 0x94, 0xfe, 0xa8, 0x86, 0x3f, 0xc0,
+    0xe8, 0xdb, 0x24, 0x04, 0xca, 0x10, 0xe0, 0xbf, 0xe1, 0xa4, 0x05, 0xb1, 0x1a, 0x0a, 0xbc, 0x57,
+    0x22, 0xd0, 0x10, 0x02, 0x25, 0x7d, 0x3c, 0x65, 0xe2, 0xf1, 0x14, 0x64, 0xcf, 0x78, 0x35, 0x12,
+    0x6c, 0x8c, 0xe7, 0x56, 0x97, 0x57, 0xc8, 0x76, 0x0d, 0xe3, 0x2f, 0xe4, 0x32, 0xc3, 0xa5, 0x50,
+    0xc0, 0xb1, 0x8f, 0x70, 0x55, 0x3d, 0x3b, 0x88, 0x26, 0x10, 0x31, 0x00, 0x2a, 0x31, 0x9a, 0x18,
+    0xe2, 0x6e, 0x04, 0x90, 0x0e, 0xab, 0xd0, 0x27, 0x95, 0x32, 0x0e, 0xf0, 0x1b, 0x70, 0x79, 0x9a,
+    0x36, 0xf4, 0x7a, 0x81, 0x42, 0x49, 0xe8, 0x0d, 0x24, 0x20, 0x64, 0x1e, 0xe3, 0x11, 0x4e, 0x71,
+    0x8b, 0x3e, 0xf4, 0xb8, 0x2b, 0x40, 0x16, 0x03, 0x8c, 0xa1, 0x65, 0xb2, 0xad, 0x4a, 0x45, 0x24,
+    0x84, 0x44, 0x6a, 0x50, 0xaf, 0x3b, 0xc2, 0xf2, 0x3e, 0xe2, 0x89, 0x53, 0x11, 0x49, 0x45, 0xb8,
+    0x18, 0x61, 0x04, 0x54, 0x86, 0xaa, 0x10, 0x63, 0x44, 0x84, 0x31, 0x1d, 0x02, 0xa0, 0xb5, 0x76,
+    0x53, 0xb7, 0x10, 0xd4, 0xd2, 0x60, 0xe1, 0x88, 0x8a, 0x90, 0x3b, 0x47, 0x9d, 0x65, 0x62, 0xaa,
+    0x13, 0x4b, 0xdc, 0x70, 0x45, 0x88, 0x02, 0xcb, 0x98, 0x9e, 0x35, 0x81, 0x83, 0x75, 0x71, 0x0a,
+    0x5d, 0x94, 0x46, 0x9c, 0x02, 0x09, 0xf8, 0x41, 0x00, 0x10, 0x50, 0xc5, 0x60, 0x16, 0x1d, 0x2c,
+    0x88, 0xd5, 0x98, 0xe9, 0x00, 0xac, 0x29, 0x19, 0x40, 0x3c, 0xe1, 0x6e, 0x11, 0xe8, 0x1c, 0x27,
+    0xe7, 0x82, 0x34, 0x62, 0x32, 0x27, 0xc4, 0x84, 0x61, 0x25, 0x32, 0x10, 0x84, 0x68, 0x0e, 0x21,
+    0x7a, 0xe9, 0x06, 0xe0, 0xce, 0xa7, 0x96, 0x1d, 0x00, 0xd8, 0x5c, 0x21, 0x4e, 0x96, 0x80, 0x74,
+    0x83, 0xe3, 0x10, 0xb4, 0x42, 0xb0, 0x3a, 0xe1, 0xa8, 0x70, 0x07, 0x12, 0xcd, 0xac, 0x8c, 0xc5,
+    0xc0, 0xae, 0x43, 0x24, 0x22, 0x27, 0x61, 0xd6, 0x2b, 0xc4, 0x3a, 0x11, 0x0e, 0x78, 0x5f, 0x04,
+    0x7c, 0x1e, 0x63, 0xaa, 0x64, 0xac, 0x2a, 0x30, 0xa1, 0x32, 0x0c, 0xe3, 0x44, 0x7f, 0x2a, 0x32,
+    0x1f, 0xc4, 0x24, 0x12, 0x80, 0x40, 0x5c, 0x23, 0xfa, 0x16, 0xa0, 0x08, 0x2c, 0x43, 0xe0, 0x34,
+    0x86, 0x0c, 0xa3, 0x47, 0x58, 0x9b, 0x81, 0x84, 0x91, 0x22, 0x12, 0x2a, 0xa1, 0x74, 0x43, 0x83,
+    0x42, 0x4b, 0x63, 0x5e, 0x0e, 0x83, 0x2e, 0x49, 0x65, 0x44, 0x69, 0x02, 0xbe, 0x24, 0xa4, 0xd2,
+    0x2e, 0xe3, 0x44, 0x00, 0x02, 0xae, 0x34, 0x62, 0x92, 0x12, 0xa1, 0x1c, 0x09, 0x81, 0xe0, 0x0a,
+    0x01, 0xd4, 0x1f, 0x82, 0xaa, 0x65, 0x0b, 0xfc, 0x21, 0x26, 0xfe, 0x21, 0xa1, 0x62, 0x0d, 0x81,
+    0x56, 0x0b, 0x20, 0x70, 0x6a, 0x23, 0xa2, 0x4c, 0x44, 0x6c, 0x23, 0x40, 0x34, 0x32, 0x80, 0xd4,
+    0x8c, 0x20, 0x6a, 0x6c, 0x83, 0x64, 0x3d, 0xc1, 0xf2, 0x32, 0xa1, 0xe6, 0x36, 0xa1, 0xa4, 0x13,
+    0x00, 0x88, 0x08, 0xc3, 0x2a, 0x3c, 0x23, 0x18, 0x26, 0xc3, 0x18, 0x1c, 0xc1, 0xb2, 0x17, 0x20,
+    0x4e, 0x0b, 0x67, 0x56, 0x26, 0xa0, 0xde, 0x1c, 0x05, 0x14, 0x15, 0x81, 0x7a, 0x16, 0xc2, 0x6c,
+    0x49, 0x03, 0x0c, 0x1b, 0x72, 0x66, 0xb6, 0x1f, 0xc4, 0xff, 0xf0, 0x12, 0xff, 0x4f, 0xcf, 0xdf,
+    0xcf, 0xf9, 0x46, 0xa5, 0xc5, 0x57, 0xba, 0x8e, 0x3e, 0xb2, 0x8d, 0xda, 0x27, 0xe5, 0xfa, 0xad,
+    0x9a, 0xb7, 0x0d, 0xbf, 0xf8, 0xf0, 0x58, 0xbb, 0xc5, 0xae, 0x0d, 0xf4, 0x11, 0x49, 0x9b, 0x84,
+    0x90, 0x88, 0xd7, 0x22, 0x8d, 0x6e, 0xf3, 0x94, 0x89, 0xdf, 0x74, 0xef, 0x7b, 0x81, 0xa6, 0xd2,
+    0xcb, 0xf8, 0x65, 0xff, 0x18, 0x90, 0x70, 0x34, 0x4b, 0x5c, 0x24, 0x3f, 0xfa, 0x62, 0x4c, 0x13,
+    0xe7, 0x97, 0x28, 0x1a, 0x99, 0x1b, 0x45, 0xa1, 0x4f, 0x62, 0x8f, 0x7c, 0x49, 0xba, 0xda, 0x5e,
+    0xf7, 0x88, 0x4e, 0x69, 0xf4, 0x3f, 0x7d, 0x20, 0xe6, 0xd9, 0x43, 0x55, 0x0b, 0x74, 0xcc, 0x85,
+    0xdd, 0x91, 0x0b, 0xeb, 0xf3, 0x52, 0xdd, 0xd4, 0xb5, 0x94, 0x42, 0xb5, 0xd8, 0xe8, 0x04, 0x5a,
+    0xbc, 0x97, 0xcb, 0xf7, 0x96, 0x96, 0x85, 0x7e, 0xb4, 0x30, 0xf7, 0xca, 0x1f, 0xee, 0x85, 0xfa,
+    0x05, 0x2e, 0xd4, 0x72, 0xbc, 0xf7, 0x72, 0xad, 0xd4, 0x01, 0x8d, 0xa4, 0xf8, 0xaa, 0x72, 0x68,
+    0x79, 0x0c, 0x4c, 0xe6, 0x16, 0xb3, 0x0b, 0xeb, 0x97, 0xdd, 0x9d, 0x51, 0x7b, 0x1d, 0x3f, 0x93,
+    0xad, 0x8f, 0x3b, 0x52, 0x0e, 0x2f, 0xba, 0x8f, 0x86, 0xb7, 0xec, 0x25, 0x9e, 0xc6, 0xe9, 0x9f,
+    0xb7, 0x1f, 0xe5, 0x96, 0xfb, 0x92, 0x7c, 0xd6, 0xc9, 0x3c, 0x3e, 0x1d, 0x40, 0x01, 0xc7, 0xaf,
+    0xc0, 0x7d, 0x0f, 0x69, 0x21, 0xb8, 0xa7, 0xe2, 0x0d, 0xc5, 0xab, 0x5b, 0x9f, 0xe1, 0xbb, 0xbe,
+    0x8f, 0xbe, 0xcf, 0x68, 0x8f, 0x6a, 0x2c, 0x06, 0xb4, 0x16, 0xfa, 0xa9, 0xf1, 0x8d, 0xbe, 0x10,
+    0x15, 0xe1, 0x7d, 0x3e, 0xe3, 0xed, 0x79, 0x57, 0x21, 0x02, 0xef, 0xca, 0x8c, 0x44, 0x7f, 0xe4,
+    0xf9, 0x2b, 0x3f, 0xfa, 0x79, 0xed, 0xab, 0x8d, 0x36, 0x6c, 0xdd, 0x03, 0x0a, 0x7d, 0xcb, 0xbc,
+    0x14, 0x8e, 0x53, 0x6d, 0xbd, 0x02, 0x67, 0x22, 0xed, 0xaa, 0xf6, 0x3f, 0x53, 0x18, 0xce, 0xbb,
+    0xad, 0x26, 0xd1, 0x14, 0xaa, 0x98, 0x07, 0x28, 0x79, 0x33, 0xf4, 0x02, 0x8f, 0xef, 0x9d, 0xce,
+    0x0f, 0xad, 0x26, 0x05, 0x1a, 0x3d, 0x64, 0x20, 0x31, 0x8b, 0xb9, 0xd3, 0xcb, 0x4c, 0x1f, 0x90,
+    0xfb, 0x0d, 0x89, 0x9c, 0xef, 0x0f, 0x8b, 0xb2, 0xaf, 0x46, 0x70, 0x5f, 0x01, 0x28, 0x0f, 0x3a,
+    0x75, 0x63, 0xc3, 0x2b, 0xf1, 0x88, 0x84, 0x37, 0x42, 0xf8, 0xa0, 0x83, 0xdd, 0x22, 0x1a, 0xd7,
+    0xe5, 0xc9, 0x5a, 0x8d, 0x4d, 0xe7, 0x5d, 0xf7, 0x61, 0xfc, 0x98, 0x7b, 0xd7, 0x7b, 0x8f, 0x72,
+    0xf6, 0xc4, 0xa2, 0x14, 0x91, 0xd6, 0x03, 0x24, 0x57, 0xf3, 0xf7, 0xb4, 0x6e, 0x77, 0x03, 0x6c,
+    0x44, 0xb5, 0xc1, 0xe6, 0x07, 0x26, 0x32, 0x19, 0x0f, 0x54, 0xa8, 0x95, 0x1d, 0x19, 0xe5, 0x51,
+    0x86, 0x83, 0x69, 0x42, 0x8a, 0xf4, 0x85, 0x37, 0xf0, 0x9c, 0xfc, 0xbf, 0xbf, 0x3e, 0xff, 0x54,
+    0x39, 0xd5, 0x37, 0xb3, 0x4b, 0xeb, 0x5b, 0xfc, 0x15, 0xf0, 0xff, 0xfd, 0xfe, 0x38, 0xe6, 0x63,
+    0x6e, 0x60, 0xbd, 0x5f, 0x87, 0x3b, 0xe8, 0xe2, 0xbf, 0x9e, 0x1c, 0x48, 0x07, 0x41, 0x7f, 0x12,
+    0xdb, 0x14, 0xe4, 0xfc, 0x4b, 0x7e, 0xa3, 0x5f, 0x51, 0x2e, 0xb0, 0xfc, 0x66, 0xe3, 0x0d, 0x03,
+    0x08, 0xac, 0xe4, 0x3b, 0xe4, 0x6a, 0xdd, 0x7c, 0x20, 0x2e, 0xe1, 0xe3, 0x8c, 0xd1, 0x99, 0xfc,
+    0x98, 0x7e, 0x5f, 0xf8, 0x90, 0x7a, 0x4c, 0x3e, 0x9e, 0xa3, 0x31, 0x29, 0x1d, 0xc6, 0xb0, 0x74,
+    0xde, 0x9b, 0x1f, 0x21, 0xcf, 0x84, 0x4e, 0xdd, 0xb3, 0xea, 0x80, 0x98, 0x66, 0xdc, 0x00, 0x40,
+    0xdd, 0xb6, 0x3c, 0x8a, 0x3d, 0x33, 0x5b, 0x67, 0xc1, 0x5f, 0x19, 0x9e, 0x74, 0xa5, 0x46, 0x6d,
+    0x1f, 0x33, 0xa9, 0xca, 0x75, 0xfd, 0x40, 0x0f, 0x56, 0xdf, 0x43, 0xfe, 0x2c, 0x5c, 0x5f, 0x33,
+    0x14, 0xe5, 0xd5, 0x55, 0x43, 0xe0, 0xf4, 0xf8, 0xcf, 0x23, 0xc8, 0x1f, 0x88, 0x9a, 0x34, 0x1b,
+    0x5e, 0xf0, 0xfb, 0x41, 0xe2, 0xd6, 0x0a, 0xa8, 0x5d, 0x9a, 0x17, 0xe3, 0x78, 0x17, 0x5c, 0xe2,
+    0x70, 0xac, 0xce, 0x3a, 0xaa, 0x8e, 0x15, 0xd4, 0x7f, 0xdb, 0xc5, 0xb1, 0x5e, 0x93, 0x7d, 0xdc,
+    0xec, 0x7f, 0xde, 0x13, 0xe1, 0x35, 0xc8, 0x57, 0x80, 0xff, 0xcd, 0x5c, 0x1d, 0xfe, 0x06, 0xdb,
+    0xff, 0x4a, 0x3d, 0xaf, 0x7a, 0x2c, 0x77, 0x0f, 0xfe, 0x66, 0x6c, 0x22, 0x76, 0x7e, 0x72, 0x9f,
+    0x88, 0xa1, 0x29, 0x17, 0x96, 0x98, 0x7a, 0xdf, 0xd0, 0x91, 0xcd, 0x0e, 0x35, 0x38, 0x6b, 0x5b,
+    0x31, 0xd7, 0x42, 0x26, 0xdf, 0x10, 0xb7, 0x95, 0xe8, 0xe9, 0x31, 0x00, 0x05, 0x5d, 0xa5, 0x8c,
+    0xbf, 0xc7, 0xd3, 0xe8, 0x23, 0x38, 0xda, 0xb9, 0x2f, 0x51, 0xfd, 0xe3, 0x3e, 0x0e, 0x11, 0x25,
+    0x16, 0xcf, 0x27, 0x5d, 0xe6, 0xcd, 0xf8, 0x7d, 0xb2, 0xf6, 0x81, 0x56, 0x4e, 0xf4, 0xbf, 0x4b,
+    0x80, 0xa0, 0x7b, 0xbc, 0x42, 0xe2, 0xe3, 0x1d, 0xf3, 0x2d, 0xd6, 0x50, 0x0f, 0xff, 0x1e, 0xcf,
+    0xfc, 0x4d, 0x3b, 0x12, 0xfd, 0xe3, 0x7a, 0x06, 0xf8, 0x59, 0xfa, 0x63, 0x77, 0xf0, 0x0f, 0x83,
+    0x69, 0xc6, 0x26, 0x5a, 0xf3, 0x92, 0x7f, 0x2d, 0xd3, 0xe1, 0x83, 0x31, 0x66, 0x08, 0xe4, 0x20,
+    0xe0, 0xfe, 0xff, 0xb4, 0xc5, 0x82, 0x9c, 0xa2, 0x3b, 0x95, 0x1c, 0xbe, 0x6c, 0x2d, 0x99, 0xc8,
+    0xb0, 0xd8, 0x76, 0xd1, 0xc8, 0x53, 0x2d, 0x63, 0x04, 0x2d, 0x8f, 0x98, 0x3f, 0x1c, 0x19, 0x91,
+    0xa8, 0x5f, 0xcc, 0x02, 0xb7, 0xdd, 0x02, 0xd7, 0x9f, 0xbe, 0x46, 0xbf, 0xd8, 0xca, 0x06, 0x76,
+    0xf2, 0x2f, 0x6f, 0x93, 0x16, 0x40, 0xbf, 0xa6, 0x2c, 0x14, 0x3d, 0xd9, 0xa0, 0x6b, 0x91, 0x79,
+    0xd4, 0x5a, 0x4a, 0x08, 0x07, 0x75, 0x79, 0x2a, 0x3f, 0x74, 0x69, 0xb1, 0x9e, 0x81, 0x98, 0x14,
+    0x58, 0x10, 0x78, 0x69, 0x8c, 0x66, 0xfc, 0x14, 0xe8, 0xcf, 0xd3, 0x15, 0x56, 0x7c, 0x8f, 0x3c,
+    0x63, 0x7f, 0xa4, 0xa9, 0xed, 0x68, 0x09, 0xd9, 0x63, 0xc0, 0x38, 0x57, 0x8a, 0x70, 0xc5, 0x5d,
+    0x1e, 0x30, 0x00, 0x8d, 0xcd, 0xb7, 0x05, 0xb4, 0x85, 0x1e, 0xce, 0x93, 0x19, 0x05, 0x56, 0xf1,
+    0xe6, 0x0a, 0xb8, 0xbb, 0x62, 0xf3, 0x68, 0x3c, 0xe1, 0x6b, 0x53, 0xbc, 0x6d, 0x96, 0xbe, 0x66,
+    0xc6, 0x90, 0x91, 0x19, 0x05, 0xbe, 0x69, 0xc0, 0xa0, 0xe5, 0x73, 0xa2, 0xad, 0x68, 0x01, 0xb8,
+    0xcd, 0x43, 0x01, 0x6e, 0x33, 0x76, 0x83, 0x8b, 0x72, 0x8b, 0xe6, 0x9f, 0xb4, 0x4e, 0xdc, 0xf0,
+    0xe9, 0x25, 0x02, 0x45, 0x15, 0xe4, 0xa8, 0x1b, 0x2d, 0x77, 0xbb, 0x1f, 0x4d, 0x62, 0x04, 0x1e,
+    0x33, 0x3c, 0x59, 0x62, 0x3c, 0xff, 0xda, 0xb8, 0x30, 0x51, 0x7d, 0x15, 0x6f, 0x8a, 0xfc, 0xe3,
+    0xeb, 0x7d, 0x09, 0x2c, 0x9b, 0x58, 0x33, 0xda, 0x69, 0xec, 0x19, 0xd3, 0x70, 0xbf, 0xdc, 0x0e,
+    0x53, 0x5e, 0x39, 0xc0, 0x0c, 0xe9, 0x36, 0x51, 0xf4, 0x69, 0xfd, 0x09, 0x3f, 0xc4, 0x53, 0xdd,
+    0xbf, 0xa4, 0xaf, 0x18, 0xbd, 0x04, 0xff, 0x6a, 0x8e, 0x52, 0x1b, 0x79, 0xe8, 0x0f, 0x2e, 0x16,
+    0x2a, 0xb7, 0x3b, 0xa7, 0x7d, 0xea, 0xa8, 0x70, 0xe2, 0xa8, 0x97, 0x9b, 0xdd, 0xcd, 0x3e, 0x8c,
+    0x1c, 0x92, 0xff, 0x3a, 0x97, 0xe7, 0x0e, 0xda, 0x22, 0x4e, 0xe0, 0x6c, 0x9d, 0x02, 0x74, 0x0c,
+    0x0d, 0x2c, 0x11, 0xd6, 0x5d, 0xe3, 0x29, 0xcd, 0x0e, 0xdc, 0x78, 0xaf, 0xe8, 0xb7, 0xb6, 0x68,
+    0xf0, 0xe4, 0x8d, 0x58, 0x2b, 0xca, 0x4d, 0x83, 0xa3, 0xa1, 0xee, 0x64, 0xd7, 0x9e, 0xf7, 0x8b,
+    0x06, 0x3a, 0xfd, 0xc8, 0x46, 0xd1, 0x37, 0xb0, 0xbd, 0xba, 0x8c, 0xf8, 0xa7, 0x98, 0x06, 0x2b,
+    0x21, 0x47, 0x29, 0x90, 0x2a, 0x30, 0x68, 0x2e, 0x5c, 0x69, 0xcb, 0xce, 0xee, 0xbc, 0x5c, 0x66,
+    0x96, 0xb3, 0xed, 0xd1, 0x13, 0xa5, 0x16, 0x56, 0xce, 0x4b, 0xc0, 0xbf, 0x18, 0x62, 0xc7, 0xf6,
+    0xa9, 0xda, 0x23, 0x65, 0x14, 0x4e, 0xbd, 0xe4, 0xab, 0x05, 0xc5, 0x17, 0x3d, 0x91, 0x28, 0x75,
+    0x1e, 0x32, 0x38, 0x13, 0xf0, 0xbd, 0x87, 0x17, 0xc9, 0x50, 0x9c, 0x0f, 0x26, 0x51, 0xb2, 0x21,
+    0xb0, 0x74, 0x88, 0x25, 0xc0, 0x48, 0x11, 0xbb, 0x71, 0xbe, 0x75, 0xb8, 0xff, 0xdd, 0x42, 0xb2,
+    0xcf, 0xc4, 0x6e, 0x13, 0xc4, 0x59, 0x0a, 0xcf, 0x95, 0x5a, 0x5b, 0x2a, 0x80, 0xa4, 0x89, 0x66,
+    0x68, 0x8a, 0xdb, 0x94, 0xb9, 0x16, 0x54, 0x88, 0x25, 0x24, 0x72, 0xb8, 0x91, 0xfe, 0x89, 0x21,
+    0x0b, 0xf7, 0x93, 0x92, 0x3a, 0x78, 0xa0, 0x4f, 0xf2, 0x7c, 0xc3, 0x33, 0xf2, 0x5d, 0xe1, 0x63,
+    0xbe, 0x56, 0x1a, 0x91, 0x99, 0x85, 0x0b, 0x88, 0x8c, 0x8c, 0xed, 0xca, 0xa2, 0xf5, 0xcd, 0x27,
+    0x68, 0x13, 0x9f, 0x5b, 0xa0, 0x71, 0x9a, 0x7e, 0xa4, 0x5c, 0x00, 0xb8, 0x3a, 0xe7, 0xd3, 0x15,
+    0x08, 0xfc, 0x15, 0xa9, 0x13, 0x0d, 0xa8, 0xe9, 0x79, 0x47, 0x32, 0x86, 0x07, 0x2c, 0x37, 0x90,
+    0x9d, 0x4f, 0xb4, 0x84, 0xc7, 0x7b, 0xbc, 0xd4, 0x8f, 0x7b, 0xec, 0x8d, 0x75, 0x5b, 0xa6, 0xeb,
+    0xa5, 0xcc, 0xc5, 0xe5, 0xe3, 0x2a, 0xa9, 0x59, 0x65, 0x23, 0x5f, 0x18, 0x4b, 0x83, 0x72, 0x08,
+    0x99, 0x2e, 0xea, 0x80, 0xe3, 0xc7, 0x75, 0x30, 0x63, 0xe5, 0x81, 0x02, 0x7d, 0x58, 0xb3, 0xe7,
+    0x8d, 0x9a, 0x6f, 0xd5, 0x75, 0x8d, 0xaf, 0xd5, 0x8c, 0x34, 0xc1, 0x29, 0x9f, 0x0c, 0xd9, 0x10,
+    0xbc, 0x8f, 0x1e, 0x6c, 0x3f, 0x25, 0x98, 0x22, 0x1a, 0x70, 0xcf, 0x8e, 0x60, 0x71, 0x79, 0x50,
+    0xe8, 0x11, 0xf9, 0x52, 0x87, 0xf7, 0xe3, 0x8c, 0x62, 0x19, 0x36, 0x8c, 0x08, 0x0e, 0x50, 0x7b,
+    0x2e, 0xc1, 0x3f, 0x84, 0xbf, 0x66, 0x5f, 0x09, 0xbd, 0xf7, 0x30, 0xd6, 0xc0, 0xa2, 0xa7, 0x8e,
+    0x9a, 0x27, 0xfc, 0x0a, 0xee, 0x9f, 0x7d, 0x25, 0x24, 0x3f, 0x54, 0x57, 0x12, 0x68, 0x16, 0x67,
+    0xc4, 0xd7, 0x90, 0x22, 0x24, 0x98, 0x5b, 0xa2, 0x42, 0x7f, 0x0e, 0x6a, 0xd2, 0xb1, 0x0a, 0xa8,
+    0xcb, 0xba, 0x17, 0x82, 0x12, 0x6e, 0x33, 0x9b, 0x8f, 0x6e, 0x73, 0x2c, 0x27, 0x35, 0x08, 0xf7,
+    0x4a, 0x80, 0xc4, 0xb4, 0xfe, 0x25, 0xbf, 0x07, 0xd4, 0xbf, 0x22, 0x25, 0x99, 0xa4, 0xdd, 0x67,
+    0xd1, 0xd5, 0xef, 0x25, 0xd9, 0x5c, 0x6b, 0x89, 0x75, 0x09, 0xba, 0xfe, 0x2d, 0x16, 0xc6, 0xf3,
+    0xbe, 0xcf, 0x8b, 0x12, 0x15, 0xd1, 0x3b, 0x91, 0x78, 0xe8, 0x84, 0x4d, 0x5e, 0x55, 0x2b, 0x7b,
+    0x7a, 0xe1, 0x9f, 0x88, 0x9c, 0xd5, 0x6a, 0x62, 0x6a, 0xa6, 0x40, 0xec, 0x75, 0x5d, 0xc5, 0x6b,
+    0x71, 0xe9, 0x95, 0xbd, 0x1e, 0xe0, 0x39, 0x28, 0xfb, 0xb5, 0x71, 0x94, 0x0b, 0x18, 0x17, 0xfb,
+    0xb1, 0xcf, 0xe7, 0x95, 0xf4, 0xb8, 0x0d, 0xc4, 0xa5, 0x41, 0x9d, 0x96, 0x98, 0x48, 0xf0, 0x96,
+    0xe2, 0x60, 0x92, 0xd0, 0x05, 0x52, 0x57, 0xd2, 0x6f, 0x85, 0xdc, 0xd5, 0x09, 0x3b, 0x78, 0x4d,
+    0xfe, 0x3e, 0x00, 0x7d, 0xc9, 0xea, 0xc1, 0x48, 0x83, 0x93, 0x0a, 0x55, 0x1c, 0x7b, 0x4d, 0x1e,
+    0x08, 0xe9, 0x98, 0x6a, 0x0b, 0x84, 0xfc, 0x15, 0x43, 0x1d, 0xb2, 0x93, 0xaf, 0x7b, 0x4f, 0x34,
+    0xac, 0xcd, 0xf6, 0x79, 0xd1, 0x0e, 0xc3, 0xe8, 0x5a, 0x2f, 0x45, 0x2a, 0x29, 0x1d, 0xeb, 0xb3,
+    0xa4, 0xa6, 0x11, 0x58, 0x7c, 0x17, 0x5f, 0xdf, 0x44, 0x28, 0xf6, 0x15, 0x93, 0x77, 0xa8, 0xdb,
+    0x98, 0xc4, 0xcd, 0x12, 0x86, 0xe7, 0x23, 0xaf, 0x08, 0x6d, 0xa2, 0x79, 0x95, 0x9e, 0x38, 0xa5,
+    0xe5, 0x7d, 0x43, 0x0d, 0xf6, 0xf0, 0x47, 0xd2, 0xb2, 0xef, 0x49, 0x54, 0x0d, 0x19, 0x16, 0x86,
+    0x0a, 0x54, 0x10, 0x4c, 0x99, 0x52, 0xc4, 0xcc, 0x8b, 0xad, 0xde, 0xcd, 0xb2, 0x45, 0x44, 0x16,
+    0xd0, 0xb9, 0xd6, 0xe2, 0x53, 0x39, 0x2e, 0x0e, 0x92, 0xea, 0x1e, 0x6e, 0xaa, 0xdc, 0x36, 0x20,
+    0xd7, 0x13, 0xd3, 0x29, 0x16, 0x15, 0xc9, 0x11, 0xb6, 0x05, 0x36, 0x98, 0x10, 0x5e, 0xaf, 0x60,
+    0x16, 0x2f, 0x27, 0x28, 0x17, 0x0e, 0x3e, 0x05, 0x1c, 0x6e, 0x03, 0x84, 0xe1, 0x6c, 0x2f, 0x43,
+    0x56, 0x8b, 0x33, 0x97, 0x1d, 0x9e, 0x1d, 0x73, 0x1d, 0x1a, 0x59, 0x21, 0xd6, 0x03, 0xc4, 0xb0,
+    0x9a, 0x8b, 0x9c, 0x55, 0xf1, 0x5a, 0xc0, 0xea, 0x02, 0x56, 0x38, 0x7f, 0xde, 0x21, 0x63, 0x99,
+    0x2f, 0xca, 0x84, 0xdd, 0x84, 0xfb, 0xd1, 0x4f, 0x9f, 0x07, 0x14, 0x0d, 0x3a, 0x6f, 0xbe, 0x06,
+    0x03, 0xe8, 0x1d, 0x40, 0x43, 0x41, 0x43, 0x9e, 0x71, 0xf6, 0x25, 0x66, 0xd2, 0xa5, 0x3a, 0xb1,
+    0xa9, 0xa9, 0x20, 0x66, 0x71, 0x91, 0xd8, 0xd3, 0xf3, 0xa8, 0xc7, 0x5f, 0x95, 0x0d, 0xd7, 0xf2,
+    0x4f, 0xf0, 0x60, 0xe9, 0xa1, 0x62, 0x7b, 0x32, 0xa8, 0xd8, 0xb7, 0xad, 0x93, 0x33, 0x76, 0xef,
+    0xa2, 0x3f, 0xe8, 0xf4, 0xf2, 0x5e, 0xdb, 0x34, 0x9d, 0x66, 0x89, 0x83, 0x04, 0x52, 0x3a, 0x43,
+    0x99, 0xee, 0xad, 0x15, 0x37, 0x3b, 0xc5, 0x9d, 0x29, 0x5c, 0xa6, 0x80, 0x71, 0x11, 0x73, 0x32,
+    0x41, 0x65, 0x6a, 0xf9, 0x47, 0x60, 0x05, 0xde, 0x97, 0x55, 0x18, 0x23, 0x8e, 0x71, 0x6e, 0x29,
+    0x86, 0x3d, 0x4b, 0xbc, 0x84, 0xa6, 0xfd, 0x40, 0xc4, 0xf3, 0x8a, 0xec, 0xa6, 0x73, 0x3b, 0xa2,
+    0x66, 0x30, 0xd8, 0xf9, 0xe1, 0xba, 0xd0, 0x13, 0x34, 0x7a, 0x64, 0x98, 0x40, 0x90, 0xee, 0x62,
+    0x47, 0xe6, 0x05, 0x50, 0xc4, 0x4f, 0xc1, 0x1d, 0x2c, 0x17, 0x33, 0x71, 0x94, 0x4d, 0x38, 0x94,
+    0x24, 0x6e, 0x25, 0xa2, 0x2a, 0xe1, 0x92, 0x4e, 0xee, 0x1c, 0x7b, 0x4f, 0x92, 0x52, 0xd3, 0x47,
+    0x88, 0x57, 0x38, 0x2a, 0x54, 0x83, 0x46, 0x38, 0xbe, 0xea, 0x5d, 0x20, 0x2b, 0x85, 0xae, 0xca,
+    0xbc, 0x3e, 0xfe, 0x15, 0xaf, 0x2a, 0x01, 0x63, 0xb8, 0x37, 0xf3, 0xda, 0xc9, 0x20, 0x42, 0x8c,
+    0x2d, 0x06, 0x16, 0xb0, 0x00, 0x86, 0x24, 0xaa, 0xe2, 0x36, 0xd7, 0xc8, 0x53, 0xf3, 0x4f, 0xc2,
+    0x06, 0x67, 0xd4, 0x62, 0xd8, 0xd8, 0xb0, 0x08, 0xcc, 0x54, 0x02, 0x59, 0x66, 0xa9, 0xbb, 0x67,
+    0xce, 0x18, 0x56, 0x17, 0xe3, 0x9e, 0x01, 0x13, 0x0a, 0x7f, 0xf9, 0xb7, 0xc3, 0xca, 0x3b, 0x8c,
+    0xec, 0x8f, 0x52, 0x39, 0x3a, 0x66, 0xb1, 0x02, 0xbe, 0x78, 0x14, 0xc2, 0x57, 0x42, 0xc3, 0xb0,
+    0x68, 0x35, 0xbd, 0x38, 0x70, 0xe6, 0x9d, 0xc3, 0x6f, 0xec, 0x8a, 0x9a, 0x96, 0x6e, 0xc0, 0x1a,
+    0xd3, 0x11, 0xc3, 0x5b, 0x52, 0xa8, 0x06, 0x43, 0x2d, 0x4c, 0x5c, 0x57, 0xe6, 0xfb, 0x27, 0x05,
+    0xf8, 0x90, 0x18, 0x1d, 0xd5, 0xf2, 0x32, 0x8f, 0x7c, 0x01, 0x0f, 0x1a, 0x21, 0xe1, 0x5e, 0x87,
+    0x41, 0x43, 0x05, 0xec, 0x82, 0x9e, 0x4f, 0x4e, 0xb9, 0xee, 0x67, 0xad, 0x84, 0xde, 0x6c, 0xeb,
+    0xad, 0x3b, 0x61, 0xcd, 0x22, 0xc3, 0xbc, 0x1c, 0x84, 0x4f, 0x4c, 0x19, 0x1c, 0x31, 0x7e, 0xdd,
+    0x6d, 0xb6, 0x8e, 0xb0, 0x64, 0xe7, 0x44, 0x51, 0x35, 0xd9, 0x45, 0x47, 0xf2, 0x9d, 0x54, 0xe8,
+    0x28, 0x03, 0x69, 0x32, 0x69, 0x57, 0xd9, 0xd4, 0x1d, 0xe3, 0xf3, 0x9d, 0x3c, 0xcf, 0xce, 0xa6,
+    0x0d, 0xcc, 0xe4, 0x78, 0xe3, 0x66, 0xcf, 0x45, 0x70, 0x21, 0x90, 0x0b, 0x27, 0x5a, 0xdd, 0xe2,
+    0x67, 0x22, 0x6a, 0xfe, 0x5d, 0x6a, 0x77, 0x8c, 0xa5, 0x0e, 0x0a, 0x6e, 0xd7, 0xc4, 0x2e, 0x83,
+    0xb0, 0x6b, 0xc4, 0xb4, 0xe7, 0x0d, 0x02, 0x66, 0x4d, 0x79, 0x97, 0xbc, 0x06, 0x56, 0x51, 0xeb,
+    0xb2, 0x24, 0x3c, 0x20, 0xe4, 0x99, 0xce, 0xf3, 0xa5, 0xd2, 0xab, 0x60, 0xf5, 0x00, 0x8d, 0x6a,
+    0x75, 0x6d, 0x18, 0x16, 0x54, 0x69, 0x62, 0x9a, 0xc9, 0x83, 0x2c, 0xcb, 0xc0, 0xc4, 0x46, 0x4c,
+    0x62, 0xcf, 0xe3, 0x45, 0x03, 0x4d, 0x20, 0x50, 0x5f, 0x51, 0x66, 0x70, 0x2b, 0x06, 0xa5, 0xac,
+    0xfa, 0x8d, 0x55, 0x10, 0x47, 0x98, 0x8d, 0x80, 0x9c, 0x10, 0x35, 0x04, 0xf6, 0x7f, 0x30, 0x55,
+    0x71, 0xd2, 0x2b, 0x4c, 0xc2, 0x56, 0xa4, 0xd3, 0x6c, 0x51, 0x2d, 0x03, 0xed, 0x20, 0x10, 0xbd,
+    0xbe, 0xd8, 0x8f, 0x1e, 0x40, 0xe9, 0xcc, 0x94, 0x6a, 0x6a, 0x9c, 0x11, 0xec, 0xae, 0x48, 0x49,
+    0x2c, 0x07, 0xa2, 0xd2, 0xe8, 0xe5, 0xa2, 0x18, 0x88, 0x25, 0x5b, 0x68, 0xa9, 0x50, 0x31, 0x86,
+    0x26, 0x3b, 0x01, 0x36, 0x4b, 0x63, 0x56, 0xcf, 0x25, 0xd8, 0x6f, 0xc2, 0x73, 0x36, 0xc7, 0x6e,
+    0x50, 0x02, 0x31, 0x1f, 0x11, 0xf4, 0x04, 0x59, 0xca, 0x4d, 0xeb, 0x1e, 0x3b, 0xb9, 0xca, 0x56,
+    0x17, 0xb5, 0xec, 0x5c, 0x25, 0x6b, 0x4d, 0x1a, 0xa8, 0x82, 0x64, 0x54, 0xa0, 0x11, 0x0e, 0xc0,
+    0x70, 0x51, 0x2a, 0x7b, 0xf2, 0x4f, 0x21, 0xa6, 0x98, 0xa7, 0x56, 0x3f, 0x4b, 0xce, 0xa2, 0x68,
+    0xf2, 0x5d, 0xb8, 0x08, 0x56, 0x40, 0xdc, 0x81, 0x7c, 0x13, 0x06, 0xc5, 0xe4, 0xde, 0x06, 0x1c,
+    0x6e, 0x26, 0xb3, 0x62, 0x3a, 0x0a, 0x42, 0xf9, 0x79, 0xc6, 0x6d, 0xcf, 0x7c, 0xcd, 0xc6, 0x5d,
+    0xef, 0x1c, 0xc0, 0x69, 0x41, 0x35, 0xe0, 0xd7, 0x26, 0x8d, 0x15, 0x0a, 0x8a, 0x73, 0x57, 0x34,
+    0x12, 0x8e, 0x00, 0xe9, 0x47, 0xca, 0x0d, 0xcc, 0x5e, 0xa5, 0x59, 0x6b, 0x4c, 0xaf, 0x75, 0x67,
+    0x3c, 0x77, 0x65, 0x9a, 0x15, 0xea, 0xa5, 0xdb, 0x6f, 0x1a, 0x4e, 0x6b, 0xa4, 0x3a, 0x08, 0xb6,
+    0x9e, 0x8a, 0x50, 0x56, 0x41, 0x0f, 0x1b, 0xd6, 0xbf, 0x34, 0xd3, 0xe9, 0x8a, 0x70, 0x72, 0x6a,
+    0xda, 0xc7, 0x7a, 0x17, 0x1d, 0x06, 0x73, 0xe0, 0x0b, 0x87, 0xb1, 0xbd, 0x29, 0x49, 0x92, 0x8f,
+    0x88, 0x64, 0x80, 0x69, 0x8f, 0x8f, 0x0b, 0x0a, 0x1f, 0x14, 0xfe, 0xa0, 0x58, 0x73, 0xe7, 0xeb,
+    0x5c, 0x58, 0x36, 0x96, 0xf0, 0x33, 0x30, 0x78, 0x67, 0xcb, 0x19, 0x4c, 0x90, 0x30, 0xac, 0xd9,
+    0x3d, 0x13, 0x5e, 0x1c, 0x6c, 0x0b, 0xb8, 0xac, 0x05, 0x11, 0x16, 0x91, 0x59, 0xc9, 0x95, 0x20,
+    0x10, 0x44, 0x42, 0x77, 0xb0, 0xab, 0xb3, 0x63, 0xa8, 0x34, 0x2a, 0xf0, 0x8e, 0xe8, 0x09, 0x98,
+    0x88, 0x40, 0xa2, 0xa0, 0x25, 0x91, 0x39, 0x22, 0x88, 0xa0, 0x31, 0x3f, 0x9c, 0xa8, 0x32, 0xde,
+    0x5d, 0x98, 0x95, 0xc2, 0xa5, 0xee, 0x44, 0x08, 0x30, 0xd9, 0x65, 0x21, 0xc0, 0x08, 0x21, 0xa3,
+    0xfc, 0x81, 0x91, 0x5d, 0x25, 0x89, 0xc5, 0x4a, 0xb2, 0x68, 0x46, 0x34, 0x51, 0x87, 0xd3, 0x81,
+    0xa8, 0x11, 0x41, 0x0a, 0x1f, 0x35, 0xe1, 0x4f, 0x13, 0x59, 0x6e, 0x88, 0x54, 0x3c, 0x49, 0x7f,
+    0xa8, 0x53, 0x01, 0x5c, 0xa1, 0xab, 0x0e, 0x1d, 0xa6, 0xf3, 0x3b, 0x68, 0x52, 0x83, 0x45, 0x2b,
+    0x3b, 0x13, 0x50, 0x4b, 0x0d, 0x48, 0x5d, 0x99, 0xc1, 0x04, 0x0f, 0x0d, 0xa2, 0xc6, 0x69, 0x64,
+    0x05, 0xb8, 0x18, 0xcd, 0xd0, 0xf0, 0x1a, 0xe4, 0xf0, 0x63, 0x36, 0x4e, 0x2b, 0x50, 0xc8, 0x04,
+    0xa8, 0x37, 0x90, 0xe2, 0x26, 0xdb, 0xf8, 0x87, 0xe5, 0xab, 0x12, 0x78, 0xbf, 0x45, 0x4c, 0x5f,
+    0x85, 0xc8, 0x6f, 0xd3, 0x49, 0xbb, 0x0e, 0xec, 0x63, 0x66, 0xb7, 0x68, 0x37, 0x74, 0x15, 0xe8,
+    0x6c, 0xaf, 0x4c, 0x50, 0xc0, 0xaf, 0x1c, 0xa9, 0x18, 0x31, 0xf0, 0x0e, 0xc2, 0x84, 0x34, 0x43,
+    0xb8, 0x27, 0x05, 0x90, 0x52, 0xc8, 0x2d, 0x1d, 0x8e, 0x62, 0x18, 0x12, 0x9c, 0x2c, 0x96, 0xad,
+    0x13, 0xe0, 0x2d, 0xb5, 0x5c, 0x93, 0x4b, 0x78, 0x22, 0x4e, 0xf8, 0x2d, 0xc6, 0x68, 0x0d, 0xdc,
+    0x14, 0x57, 0x5b, 0x50, 0x04, 0x94, 0xec, 0x7a, 0xd1, 0x7d, 0x19, 0x88, 0xe5, 0xc5, 0x2e, 0x80,
+    0x10, 0x65, 0x9e, 0x10, 0xa3, 0x1e, 0xd0, 0x89, 0x40, 0xe0, 0xed, 0x36, 0x55, 0x23, 0x9e, 0x5d,
+    0x82, 0x78, 0xb8, 0x64, 0xd2, 0x63, 0x4a, 0x55, 0x6f, 0x48, 0x6d, 0x4f, 0xcf, 0xa8, 0x90, 0x6f,
+    0xdb, 0x3f, 0x88, 0x7e, 0x2e, 0x7f, 0x88, 0x94, 0xfb, 0x59, 0xfd, 0xc6, 0xfe, 0xd3, 0x7a, 0xb7,
+    0xf5, 0x8d, 0x84, 0x3a, 0xb1, 0xd8, 0x09, 0xff, 0x71, 0xfc, 0x79, 0xca, 0x72, 0xbb, 0xf3, 0x30,
+    0x06, 0xe6, 0xf9, 0xe6, 0x19, 0x5e, 0x0e, 0x51, 0x3a, 0x05, 0x44, 0xc3, 0xda, 0x76, 0xc1, 0xc6,
+    0x07, 0x03, 0x8e, 0x30, 0xe8, 0xe8, 0x0a, 0xbb, 0x42, 0x86, 0xbb, 0x3a, 0xb9, 0x19, 0x6b, 0xcb,
+    0x1f, 0x9b, 0x9a, 0x59, 0xf3, 0x07, 0x41, 0xfe, 0x4a, 0x18, 0xfe, 0x69, 0xec, 0x7b, 0x16, 0xcf,
+    0x80, 0x02, 0x34, 0x1f, 0xe1, 0x27, 0x99, 0x86, 0x8d, 0x6d, 0xb1, 0xd8, 0x2d, 0xa1, 0xb8, 0x9b,
+    0xea, 0xce, 0x13, 0xe5, 0xa4, 0x90, 0xcf, 0x20, 0x12, 0x7a, 0xaa, 0x7a, 0x86, 0xd0, 0x77, 0xb0,
+    0x18, 0xe7, 0x7d, 0x54, 0xe8, 0x46, 0x7f, 0x5c, 0x41, 0xe2, 0x34, 0x42, 0x21, 0xd2, 0x34, 0xe9,
+    0x9c, 0x13, 0x72, 0x7f, 0x45, 0xfb, 0x87, 0xf0, 0x3b, 0x3b, 0x2a, 0x0d, 0x5b, 0x16, 0x8b, 0x7f,
+    0x6a, 0x53, 0x0e, 0x52, 0x60, 0x97, 0x06, 0x39, 0xc5, 0xf1, 0xc2, 0x71, 0xfc, 0xed, 0x40, 0xc2,
+    0x32, 0xf0, 0xa7, 0xdb, 0x9c, 0x91, 0x6e, 0x11, 0x4c, 0xaa, 0x40, 0x37, 0x6e, 0xbc, 0xec, 0xe9,
+    0xc9, 0x37, 0x30, 0x6b, 0xfb, 0xa1, 0x2a, 0x28, 0x7d, 0x3d, 0xea, 0x8b, 0xa1, 0x84, 0x8c, 0x2c,
+    0xc1, 0xc4, 0x3b, 0x9e, 0x93, 0x45, 0x65, 0xdc, 0x98, 0x10, 0x8d, 0x8f, 0x8f, 0xdc, 0x44, 0x98,
+    0xab, 0xae, 0xe0, 0xc4, 0x3f, 0x2d, 0x86, 0x9f, 0xc0, 0x98, 0x1b, 0xed, 0x66, 0x3a, 0x58, 0xb9,
+    0x38, 0xdd, 0x67, 0xee, 0x87, 0xec, 0x2a, 0xda, 0xe3, 0x06, 0xcb, 0x9b, 0x3a, 0xf9, 0xba, 0xe5,
+    0xa8, 0xed, 0x56, 0xc1, 0xae, 0xe8, 0x5c, 0x89, 0x28, 0x13, 0x72, 0x45, 0x24, 0xea, 0x53, 0x90,
+    0x37, 0xc4, 0x76, 0x24, 0xba, 0x22, 0xbc, 0x1e, 0xf4, 0x41, 0x8c, 0x0b, 0xb4, 0x37, 0x55, 0x70,
+    0x76, 0xac, 0x8a, 0xe9, 0x1f, 0xf6, 0x4f, 0x97, 0x3f, 0xfe, 0xcf, 0x7e, 0x85, 0x7b, 0xfa, 0xed,
+    0xef, 0x06, 0x5e, 0x72, 0x74, 0x89, 0xda, 0x6c, 0x8f, 0xd5, 0x54, 0xc2, 0x04, 0x34, 0x76, 0xc7,
+    0x8f, 0x39, 0xf7, 0x82, 0x77, 0x7f, 0x9c, 0x1a, 0xe0, 0x66, 0x90, 0x24, 0xd8, 0xd1, 0x5e, 0x23,
+    0x27, 0x13, 0x55, 0xcf, 0x83, 0x16, 0x61, 0x78, 0xa2, 0x3b, 0x5b, 0x53, 0x5d, 0x37, 0x26, 0x8f,
+    0xc8, 0x8d, 0x0a, 0x80, 0x8b, 0x74, 0xf8, 0xb8, 0x8c, 0xdc, 0x19, 0x07, 0xc8, 0x79, 0x16, 0xe7,
+    0x91, 0xa3, 0xde, 0xcd, 0x05, 0xd7, 0x85, 0xcf, 0xa5, 0x31, 0xb3, 0x6d, 0x21, 0x92, 0xb8, 0xa0,
+    0xa9, 0x6b, 0x5d, 0x03, 0x8f, 0x14, 0xf9, 0x15, 0x80, 0xe7, 0x44, 0x66, 0xab, 0x72, 0xc7, 0x87,
+    0x95, 0x0a, 0x37, 0xab, 0xfa, 0x6e, 0xa1, 0xf9, 0x94, 0x11, 0x79, 0xeb, 0x33, 0x63, 0x21, 0xec,
+    0x95, 0x95, 0x10, 0x58, 0x2f, 0x6c, 0x4c, 0xd2, 0xef, 0x0d, 0xcf, 0x5c, 0xec, 0x85, 0x0c, 0x91,
+    0xf1, 0xa9, 0xf3, 0xff, 0x47, 0xa1, 0xb6, 0x1e, 0xb5, 0x61, 0x54, 0x0e, 0x4f, 0x91, 0x25, 0x0a,
+    0x0b, 0xce, 0xbc, 0x95, 0x53, 0x75, 0x03, 0x06, 0xb9, 0x25, 0xcd, 0x68, 0xcf, 0x07, 0x70, 0x7e,
+    0xf6, 0xd6, 0x05, 0x62, 0x03, 0xc3, 0x97, 0x34, 0x27, 0x46, 0x93, 0xcb, 0x14, 0x84, 0x0f, 0x83,
+    0x7c, 0x21, 0x63, 0x8c, 0x29, 0xc1, 0xc5, 0x6c, 0x4d, 0xf1, 0x6c, 0x8b, 0x39, 0xe4, 0x30, 0x93,
+    0x2a, 0x52, 0x5e, 0x36, 0xa8, 0x5c, 0x44, 0x0c, 0x9f, 0x25, 0x7f, 0xa5, 0x37, 0x0c, 0xee, 0x45,
+    0xa3, 0xdb, 0x91, 0xe6, 0x51, 0x81, 0xc1, 0xb1, 0xf6, 0x72, 0x44, 0x5d, 0x71, 0x35, 0x94, 0x2d,
+    0x78, 0xdc, 0x26, 0xd9, 0x94, 0xb7, 0x55, 0x30, 0xc2, 0x17, 0x32, 0x86, 0x1e, 0xaa, 0xa8, 0x9e,
+    0x0b, 0x13, 0xbd, 0xb1, 0x7f, 0x6f, 0x90, 0xc3, 0x6c, 0x57, 0xb0, 0xac, 0x8e, 0xa4, 0x57, 0x4a,
+    0xb9, 0xc8, 0x6e, 0x33, 0x7a, 0x63, 0xe3, 0x4e, 0xee, 0x67, 0x86, 0x44, 0xe2, 0xdc, 0x1a, 0x3b,
+    0x10, 0xe5, 0xcf, 0xae, 0xf1, 0x26, 0xb9, 0x3c, 0x07, 0xda, 0x79, 0xc5, 0x80, 0x36, 0xdc, 0xcd,
+    0xea, 0xfd, 0xc5, 0x2e, 0x44, 0x38, 0xa5, 0xef, 0x4d, 0xfc, 0x37, 0xf1, 0x53, 0x39, 0x2e, 0x5c,
+    0x55, 0x82, 0x35, 0xfb, 0x01, 0x81, 0x43, 0xf1, 0x77, 0xa0, 0x32, 0xd7, 0x74, 0xd5, 0x3b, 0x95,
+    0x4b, 0x72, 0x36, 0x28, 0xe5, 0xdf, 0x72, 0xbf, 0x5b, 0x33, 0xd7, 0xc0, 0xb9, 0x79, 0x82, 0x51,
+    0xd0, 0x50, 0x81, 0xaa, 0x49, 0x38, 0x14, 0x31, 0x42, 0x6b, 0x1a, 0xa0, 0xc3, 0x31, 0x81, 0x4c,
+    0x80, 0x53, 0xf8, 0xe6, 0x29, 0x11, 0x14, 0x8c, 0xff, 0x5a, 0xe1, 0x71, 0xe1, 0x56, 0xa8, 0x67,
+    0x4e, 0x71, 0xf6, 0x99, 0xc1, 0x7f, 0xad, 0x1a, 0x51, 0xd4, 0x7c, 0x11, 0x00, 0x5c, 0xa5, 0x50,
+    0xc4, 0x76, 0x0a, 0x60, 0x00, 0x68, 0x06, 0xc5, 0xc4, 0x71, 0xf7, 0x97, 0xa7, 0xd9, 0x06, 0x7c,
+    0x02, 0xee, 0x74, 0x1a, 0xdc, 0xdb, 0xc6, 0xd2, 0x36, 0x88, 0x80, 0x34, 0x7c, 0x24, 0xce, 0x89,
+    0x39, 0x9e, 0x83, 0x6e, 0xb2, 0xb4, 0x22, 0xb8, 0x50, 0xeb, 0x49, 0x3b, 0xeb, 0x6b, 0xad, 0xe6,
+    0x61, 0x65, 0xd7, 0x5c, 0x78, 0x36, 0x57, 0x13, 0x99, 0xfc, 0xfe, 0x5e, 0x37, 0xa6, 0x29, 0x2a,
+    0x05, 0xa8, 0xf6, 0x41, 0xaa, 0x46, 0xbc, 0x8e, 0xf0, 0x72, 0x85, 0xf7, 0x26, 0x10, 0x8f, 0x32,
+    0x49, 0x92, 0x8c, 0xd3, 0x6a, 0x8f, 0xc8, 0x76, 0x6d, 0x79, 0x04, 0x84, 0x5d, 0xd9, 0x8b, 0x39,
+    0x29, 0x59, 0x08, 0x87, 0x6b, 0x14, 0x97, 0xe4, 0x72, 0x39, 0xf3, 0x54, 0x2f, 0x13, 0x22, 0x55,
+    0x8a, 0x8a, 0xb6, 0xe4, 0x82, 0xa7, 0xd6, 0x4e, 0xdc, 0xdd, 0xec, 0x44, 0x02, 0xcb, 0xdc, 0xa0,
+    0x63, 0x35, 0x0e, 0xbe, 0xc1, 0xd0, 0xdc, 0x69, 0x35, 0xb7, 0x40, 0x4b, 0xb1, 0xa5, 0x09, 0x94,
+    0x1e, 0x1f, 0x11, 0x46, 0xf0, 0xdd, 0xeb, 0x59, 0x22, 0xa0, 0x27, 0x09, 0x6c, 0xd8, 0x3c, 0xf2,
+    0x5c, 0xa3, 0xdb, 0x8d, 0xc1, 0x7f, 0xd8, 0x3c, 0x77, 0x1a, 0xe2, 0x05, 0x6a, 0x87, 0x0b, 0xf4,
+    0x84, 0xd8, 0x45, 0x3f, 0x53, 0xcf, 0x07, 0xc8, 0x4b, 0x8b, 0xa2, 0x08, 0x13, 0x8c, 0xf0, 0xff,
+    0x44, 0xe0, 0xfe, 0x5f, 0x2e, 0x04, 0x19, 0x3d, 0x74, 0xae, 0x11, 0x04, 0x1a, 0x46, 0xd5, 0xfd,
+    0xb5, 0x95, 0xb8, 0x2e, 0x3b, 0xac, 0x91, 0xa2, 0xb9, 0x4a, 0x4b, 0x78, 0x5b, 0x87, 0xd8, 0x83,
+    0x44, 0xcf, 0x60, 0x6a, 0x1f, 0x09, 0x54, 0x44, 0xf1, 0x10, 0x95, 0x4c, 0x96, 0x5f, 0x2e, 0x1a,
+    0xb5, 0xa0, 0x09, 0x41, 0x1f, 0x52, 0xf1, 0x6d, 0xc5, 0x5a, 0x43, 0x41, 0xa0, 0x7c, 0x6e, 0x19,
+    0x50, 0xd1, 0xf8, 0x3c, 0x39, 0x84, 0xd5, 0x73, 0x8f, 0x25, 0xf8, 0x02, 0x89, 0xed, 0x83, 0xfc,
+    0xe8, 0x0f, 0x11, 0xa8, 0x16, 0x70, 0x43, 0x50, 0x64, 0x43, 0x82, 0xec, 0xb3, 0xd4, 0x5f, 0xab,
+    0x26, 0x60, 0x38, 0x6f, 0x00, 0x59, 0xbf, 0x18, 0xc3, 0x94, 0xeb, 0x13, 0x92, 0x68, 0xd4, 0x8c,
+    0xf8, 0xba, 0x23, 0x65, 0x05, 0x10, 0xaa, 0x09, 0x9b, 0x46, 0x92, 0xb0, 0xe9, 0x91, 0xec, 0x16,
+    0x0f, 0x31, 0x45, 0xa5, 0xc5, 0x18, 0xbe, 0xdc, 0x37, 0x58, 0x9d, 0x2a, 0x13, 0xb1, 0x72, 0xb8,
+    0x24, 0xd2, 0x44, 0xef, 0x09, 0x42, 0xf2, 0x34, 0xcd, 0x08, 0x51, 0x74, 0xc4, 0x1f, 0x35, 0x08,
+    0x70, 0xd4, 0xa6, 0x5d, 0x94, 0x64, 0x7a, 0x73, 0x2e, 0xc4, 0x2a, 0xab, 0x30, 0xe2, 0x5b, 0x76,
+    0x7b, 0xb9, 0xec, 0x04, 0x86, 0xa2, 0x5d, 0x30, 0x8c, 0xfd, 0xe5, 0x21, 0xc7, 0xe3, 0x40, 0x63,
+    0x6d, 0xe1, 0xdc, 0x2c, 0x8e, 0x05, 0x59, 0x66, 0x44, 0x1e, 0xc5, 0x88, 0x6e, 0x7e, 0x08, 0x82,
+    0x98, 0xb1, 0x61, 0x50, 0x2d, 0xf6, 0x27, 0x84, 0xac, 0xa3, 0xef, 0x09, 0x29, 0x0c, 0x25, 0x44,
+    0xae, 0x26, 0xd0, 0x74, 0x59, 0x7e, 0xa9, 0x33, 0x2c, 0xd0, 0x56, 0x8e, 0xe1, 0xc3, 0x15, 0x1b,
+    0x28, 0x3e, 0xad, 0x87, 0x01, 0xcd, 0x85, 0x44, 0x31, 0xc9, 0x94, 0x6d, 0x8d, 0x95, 0x9c, 0x80,
+    0x28, 0x81, 0x21, 0x8d, 0x97, 0x5a, 0x51, 0x55, 0x3c, 0x48, 0x29, 0x5e, 0x94, 0x3e, 0x8c, 0x89,
+    0xb8, 0x94, 0xea, 0x41, 0x65, 0x2c, 0x14, 0x80, 0xfb, 0xc3, 0x27, 0xb6, 0x72, 0x09, 0x59, 0x93,
+    0x83, 0x4e, 0x0a, 0xb4, 0xe7, 0x02, 0x67, 0x88, 0x26, 0x5d, 0xd9, 0xe8, 0xbd, 0x2b, 0x5c, 0xbc,
+    0x08, 0x5d, 0xa5, 0x8c, 0x01, 0x8e, 0x64, 0xca, 0x10, 0x1d, 0x24, 0x68, 0x36, 0x44, 0x1c, 0x74,
+    0x15, 0x6c, 0x90, 0x53, 0x22, 0x1d, 0x07, 0x42, 0xc8, 0x1e, 0x0d, 0xcf, 0xd8, 0x62, 0x8e, 0x1e,
+    0x11, 0xe9, 0x22, 0x53, 0x84, 0x01, 0x78, 0x79, 0x96, 0x24, 0x79, 0xd0, 0x1f, 0x9f, 0xe3, 0x4b,
+    0x12, 0x71, 0x3b, 0xd7, 0xb7, 0x11, 0x60, 0xfd, 0x5e, 0x99, 0x55, 0x75, 0xde, 0x89, 0xd5, 0x96,
+    0x1c, 0xa6, 0x84, 0x91, 0x6e, 0xe8, 0x90, 0x6e, 0x3e, 0x09, 0x8e, 0xb0, 0x7a, 0x0b, 0x48, 0x88,
+    0xc9, 0x21, 0x27, 0xd5, 0x06, 0x30, 0x82, 0xa5, 0xfd, 0x61, 0x21, 0xd0, 0xd9, 0xc1, 0x11, 0x9b,
+    0xb2, 0xed, 0xb6, 0x5c, 0x10, 0x20, 0x75, 0xa3, 0x5c, 0x48, 0xb6, 0xe6, 0x99, 0x97, 0xa3, 0x71,
+    0x50, 0xee, 0x3d, 0x26, 0xbd, 0x75, 0xc6, 0xba, 0x25, 0x55, 0x01, 0x42, 0x6d, 0x91, 0x3e, 0xd3,
+    0xc2, 0xd9, 0x1b, 0x23, 0xc5, 0x83, 0x19, 0x92, 0x64, 0x8c, 0xd8, 0x39, 0xc5, 0xe1, 0xba, 0xb7,
+    0xbb, 0xaa, 0x48, 0x6a, 0xa7, 0xb6, 0x0f, 0xf1, 0x98, 0xa3, 0x44, 0xb7, 0x04, 0xc0, 0x37, 0x83,
+    0x21, 0x08, 0x9f, 0x29, 0xe9, 0x60, 0xc5, 0xad, 0xf0, 0x7e, 0x04, 0x06, 0x92, 0x44, 0x5d, 0x84,
+    0x41, 0x69, 0x2a, 0x61, 0xb6, 0x32, 0x22, 0xa4, 0x1a, 0xaa, 0x7b, 0xa2, 0xca, 0xb6, 0x09, 0x91,
+    0x82, 0x1a, 0x94, 0x67, 0x04, 0x04, 0x65, 0x2b, 0xa1, 0xc5, 0x1f, 0xcc, 0xf1, 0x30, 0x07, 0x17,
+    0x42, 0xe2, 0x95, 0xce, 0x91, 0xcb, 0xc9, 0xe7, 0xa7, 0x3a, 0xde, 0x9f, 0xad, 0x70, 0xef, 0x7c,
+    0xd8, 0xb2, 0x9b, 0x8e, 0xb0, 0xcd, 0xfc, 0xdf, 0xce, 0xf1, 0x63, 0x6b, 0x7b, 0xca, 0x14, 0x03,
+    0x9f, 0x4c, 0x2f, 0x7f, 0x40, 0xff, 0x9d, 0x42, 0xa8, 0xf1, 0x64, 0x2d, 0x2b, 0x4a, 0xfc, 0x0f,
+    0xf3, 0x5f, 0x24, 0xcf, 0xba, 0xbf, 0x21, 0xe2, 0x21, 0x73, 0xc8, 0xb7, 0x46, 0xa0, 0xfd, 0x4f,
+    0xb1, 0xfb, 0x2a, 0x06, 0x8d, 0x4a, 0xca, 0x8c, 0x06, 0xb2, 0x0e, 0x38, 0x75, 0x2f, 0xe5, 0x9a,
+    0xf7, 0xe9, 0xff, 0x13, 0xae, 0x69, 0x09, 0x27, 0x1f, 0xbf, 0x71, 0x4c, 0x56, 0xb7, 0x8e, 0xc3,
+    0xfd, 0xc5, 0xeb, 0x9c, 0x56, 0x07, 0x26, 0x1e, 0x85, 0xca, 0x7c, 0x0e, 0x98, 0xd1, 0xf1, 0x4e,
+    0x89, 0xf8, 0xbf, 0xc8, 0xf5, 0xfc, 0xae, 0x8f, 0x49, 0xf1, 0x59, 0x8f, 0xec, 0xd4, 0x8f, 0x2b,
+    0x41, 0xd0, 0x06, 0x09, 0x7b, 0x6f, 0xd0, 0x54, 0x35, 0x8e, 0xad, 0xe4, 0x5b, 0x06, 0xf1, 0x8b,
+    0x6c, 0xdd, 0x0f, 0x19, 0xa1, 0x4f, 0x15, 0x8b, 0x78, 0xf4, 0x9b, 0xd5, 0xce, 0xff, 0xb1, 0x30,
+    0x7c, 0xfd, 0xe4, 0x07, 0x1c, 0xe4, 0x18, 0x6f, 0x43, 0xdf, 0x75, 0x78, 0xec, 0x86, 0x5a, 0x56,
+    0x9b, 0x21, 0xfb, 0xd7, 0x93, 0x7f, 0xc4, 0x7b, 0x0f, 0xf3, 0x2f, 0x60, 0x68, 0x23, 0x97, 0x2c,
+    0xf3, 0x1a, 0x8d, 0x25, 0x00, 0x2e, 0x6d, 0xd4, 0x3a, 0x9f, 0xa8, 0xe4, 0x2c, 0x6e, 0xc7, 0x3f,
+    0x82, 0x7a, 0x66, 0x66, 0x7a, 0xdf, 0x0c, 0xfa, 0x96, 0x29, 0xc7, 0x73, 0x36, 0xc8, 0xcf, 0xea,
+    0x28, 0x7f, 0x26, 0x30, 0xe3, 0x39, 0xb7, 0x9b, 0x0a, 0x41, 0xfc, 0xb7, 0x98, 0xf0, 0x3c, 0xa7,
+    0x9a, 0x70, 0x8e, 0x41, 0xbc, 0x5a, 0x2d, 0x49, 0x02, 0x38, 0xfa, 0xaf, 0x6b, 0x5c, 0xf2, 0xc6,
+    0xe2, 0x6a, 0xee, 0x3e, 0xa2, 0x7f, 0x09, 0xa3, 0x9e, 0x9e, 0xd1, 0xa8, 0x45, 0xa5, 0x23, 0xa5,
+    0x13, 0xe9, 0x15, 0x96, 0x53, 0xa1, 0x41, 0x7e, 0x13, 0xaa, 0xe9, 0xb1, 0x4d, 0x82, 0xf9, 0xe0,
+    0xc2, 0x7a, 0x7e, 0x71, 0xc9, 0x22, 0x73, 0xbf, 0x5f, 0xf1, 0xfd, 0x93, 0x52, 0x98, 0x28, 0x4c,
+    0xaf, 0x17, 0x51, 0xee, 0x71, 0x9a, 0x61, 0xec, 0x5f, 0x02, 0x0e, 0xbd, 0xf4, 0x9f, 0x03, 0xac,
+    0xf1, 0x9f, 0x1e, 0xfe, 0x49, 0xbc, 0xf8, 0x1f, 0x05, 0x8f, 0x96, 0x97, 0xd5, 0xa2, 0xd7, 0x69,
+    0x00, 0x89, 0xb1, 0x71, 0x41, 0x8d, 0x84, 0xbf, 0x75, 0xfe, 0xea, 0x49, 0xf8, 0x60, 0x0e, 0x02,
+    0xaf, 0x48, 0x36, 0x1a, 0xad, 0x5a, 0xaf, 0x58, 0x02, 0xd2, 0x45, 0xe1, 0x08, 0xb6, 0x17, 0xc3,
+    0x51, 0xd8, 0x69, 0x5f, 0x36, 0x88, 0x20, 0x6e, 0x3e, 0xc3, 0x2b, 0xd5, 0xf1, 0x6d, 0xf8, 0xd9,
+    0x86, 0x45, 0x82, 0x6a, 0x35, 0x5d, 0x27, 0x0d, 0xfe, 0x05, 0xc6, 0x3e, 0x13, 0xe0, 0x78, 0xfb,
+    0x0d, 0xec, 0x1f, 0x72, 0x6a, 0x80, 0x0e, 0xe3, 0x39, 0xd7, 0x32, 0x22, 0x4c, 0xf8, 0x3f, 0xf0,
+    0x1e, 0x61, 0xec, 0x81, 0xa8, 0xb1, 0x0a, 0xc6, 0x1d, 0x70, 0xd2, 0xc0, 0xf0, 0xec, 0x03, 0xd8,
+    0x1e, 0xb9, 0xcc, 0xc6, 0x19, 0x31, 0xf5, 0x94, 0x7b, 0xf0, 0xab, 0x7c, 0x6c, 0x7b, 0x3b, 0xe8,
+    0xfb, 0xe7, 0x62, 0xee, 0xfd, 0xa7, 0xd5, 0xbb, 0x85, 0x65, 0x7e, 0xac, 0xdd, 0x8c, 0x1f, 0xfc,
+    0x15, 0x3e, 0x91, 0x5a, 0xe2, 0x55, 0xbe, 0x6b, 0x45, 0x3f, 0x29, 0xa5, 0xeb, 0x1d, 0x52, 0x13,
+    0x47, 0x78, 0x8e, 0x6c, 0xb8, 0x2d, 0x4a, 0x41, 0x2c, 0x60, 0xae, 0xa9, 0x79, 0x03, 0x95, 0xfe,
+    0x37, 0x0f, 0x45, 0x31, 0x6b, 0xcb, 0xf2, 0x8e, 0xec, 0x02, 0xba, 0x4e, 0x18, 0x42, 0x82, 0x50,
+    0x26, 0x8e, 0x47, 0x1d, 0x27, 0xc1, 0x07, 0x8c, 0xe8, 0xfa, 0xfb, 0xfe, 0x0e, 0xed, 0xc1, 0x9a,
+    0x68, 0xf6, 0x98, 0x6b, 0x54, 0x0b, 0xa9, 0x74, 0x8b, 0xe4, 0xd0, 0xd2, 0x31, 0xc0, 0x67, 0xbe,
+    0xfd, 0x74, 0xea, 0x78, 0x1b, 0xc0, 0x44, 0x7d, 0x0d, 0x34, 0x5a, 0xc9, 0x3d, 0xd0, 0xd2, 0x62,
+    0xbc, 0xa3, 0xb4, 0x4e, 0xe7, 0xb0, 0x91, 0x60, 0x87, 0xfb, 0x30, 0x6f, 0xc0, 0xf4, 0x53, 0xf0,
+    0x8b, 0xc0, 0x6e, 0x7a, 0x95, 0xe5, 0x96, 0x21, 0xfb, 0x36, 0xbc, 0xc4, 0x1f, 0x19, 0xa6, 0xc8,
+    0xe8, 0xa2, 0xe9, 0x70, 0x34, 0x38, 0xe9, 0xd6, 0x59, 0x80, 0x79, 0x05, 0xd3, 0x39, 0x1f, 0x92,
+    0x0f, 0x55, 0xe5, 0x24, 0x96, 0x7e, 0x3e, 0x1d, 0x32, 0x56, 0x56, 0x0e, 0x17, 0xa1, 0x50, 0xb4,
+    0x9c, 0x74, 0x94, 0xe4, 0x7d, 0x6c, 0x54, 0xca, 0x3e, 0xd1, 0xe3, 0x10, 0x8b, 0x78, 0x99, 0xe3,
+    0x51, 0x93, 0x11, 0xce, 0x39, 0xdf, 0x38, 0x5f, 0x17, 0x0a, 0x4a, 0xe5, 0xd8, 0x90, 0x09, 0x6e,
+    0x43, 0x6d, 0x10, 0x9b, 0xf8, 0x9e, 0x2a, 0x24, 0x14, 0xbc, 0x2e, 0x40, 0x92, 0x79, 0x4f, 0xd8,
+    0x64, 0xca, 0x9b, 0x76, 0xf1, 0xd5, 0xf8, 0xd9, 0x45, 0x99, 0xda, 0x29, 0xf7, 0xce, 0x5c, 0x30,
+    0x93, 0xbc, 0xbe, 0xc0, 0xc1, 0xd4, 0x8a, 0x47, 0x8e, 0x63, 0x32, 0x6e, 0x04, 0x83, 0x5b, 0x85,
+    0x1f, 0x69, 0x59, 0xb7, 0xb9, 0xf7, 0x5a, 0x33, 0xb5, 0xe8, 0xd7, 0xc2, 0xf3, 0xb8, 0x99, 0xcb,
+    0x08, 0xb8, 0x49, 0x24, 0xc0, 0x96, 0x9b, 0x4e, 0xe3, 0x92, 0xa0, 0x1c, 0x2b, 0x72, 0x9f, 0xd6,
+    0x46, 0xc3, 0x24, 0x4d, 0x90, 0xb4, 0x79, 0xe2, 0x13, 0x7b, 0x1b, 0xd9, 0xd8, 0xfa, 0x8d, 0x14,
+    0x81, 0xfa, 0x1d, 0x42, 0x35, 0xa9, 0xa4, 0xa0, 0x79, 0x4f, 0xc0, 0xf7, 0x6e, 0x18, 0x76, 0x5b,
+    0x00, 0x8f, 0x3a, 0x07, 0xc8, 0xdb, 0xf1, 0x90, 0x59, 0xb3, 0xa0, 0xb4, 0xab, 0x08, 0xa4, 0x60,
+    0x8e, 0xb6, 0x50, 0x75, 0xbc, 0x3a, 0xc9, 0x17, 0xa1, 0x97, 0x8c, 0xe0, 0x72, 0xf2, 0x22, 0x48,
+    0xc1, 0x94, 0x4c, 0x4a, 0x5d, 0x10, 0x16, 0x87, 0x60, 0x4a, 0x37, 0x37, 0x30, 0xd0, 0xf8, 0x1c,
+    0xdb, 0x06, 0xd8, 0xf4, 0x17, 0x43, 0xc0, 0xa2, 0x1c, 0x3d, 0xd7, 0x0e, 0x0a, 0xde, 0xe5, 0x6b,
+    0xc8, 0x01, 0x43, 0xd0, 0x81, 0x77, 0xf3, 0xc5, 0xa9, 0x24, 0x92, 0x25, 0x0e, 0x76, 0x60, 0x6e,
+    0x58, 0x4e, 0x00, 0x52, 0x01, 0xec, 0x75, 0x18, 0xe2, 0x51, 0x62, 0x48, 0xfa, 0x7c, 0x74, 0x08,
+    0x54, 0x0c, 0x45, 0xcd, 0x85, 0xa5, 0x4c, 0x0c, 0x4d, 0x98, 0xca, 0x32, 0xb2, 0xb2, 0x15, 0x5a,
+    0x83, 0x24, 0x32, 0x45, 0x97, 0x05, 0xd0, 0x49, 0x1b, 0xef, 0x33, 0x8c, 0xc2, 0x14, 0xbc, 0x0e,
+    0x55, 0x23, 0x92, 0x8c, 0x99, 0xa4, 0x01, 0x90, 0x95, 0xdc, 0xdb, 0xe8, 0x83, 0xd3, 0xf6, 0x74,
+    0x80, 0x18, 0xaa, 0x95, 0x11, 0x08, 0x39, 0xec, 0xd6, 0x23, 0x29, 0xe0, 0x1c, 0xb0, 0xf0, 0x72,
+    0x95, 0x3a, 0x39, 0x75, 0x84, 0xc4, 0xf8, 0x6c, 0x8d, 0xa0, 0x71, 0x30, 0x94, 0x04, 0x86, 0x4b,
+    0x2e, 0xbf, 0x3e, 0x3c, 0x08, 0xb9, 0xbf, 0x32, 0x5e, 0xed, 0x27, 0xe0, 0xe3, 0x41, 0x87, 0x09,
+    0x07, 0x62, 0x9c, 0xd8, 0x23, 0xd6, 0xc9, 0xf0, 0x09, 0x45, 0x1b, 0x1b, 0xe1, 0x74, 0xb7, 0x70,
+    0x32, 0xa4, 0x73, 0x3c, 0x92, 0xec, 0xa0, 0x7d, 0x63, 0x6b, 0x8a, 0x1f, 0x43, 0xc9, 0x57, 0x06,
+    0xa0, 0x47, 0xb6, 0xb4, 0x4a, 0x25, 0x72, 0x21, 0x56, 0xc5, 0x02, 0x23, 0xa8, 0x8c, 0x9c, 0x6f,
+    0x65, 0x30, 0x26, 0x8b, 0x06, 0x32, 0xad, 0xc5, 0xd3, 0xe0, 0x21, 0x6c, 0x44, 0xcf, 0x40, 0xe8,
+    0xe9, 0x92, 0x07, 0xa3, 0xe5, 0xe4, 0x25, 0xd5, 0xde, 0x37, 0xb0, 0xca, 0xa0, 0x52, 0x60, 0xa1,
+    0x93, 0x3c, 0x35, 0x3c, 0x90, 0xd0, 0xe8, 0xd5, 0x82, 0x63, 0xcf, 0x4a, 0x28, 0x95, 0xab, 0x90,
+    0x30, 0x23, 0x63, 0xb0, 0x40, 0x32, 0x00, 0xa6, 0x19, 0x34, 0x63, 0x1c, 0x99, 0x41, 0x29, 0x45,
+    0x78, 0x9c, 0xe6, 0xfa, 0xd6, 0x45, 0x31, 0xd4, 0xca, 0xa8, 0x02, 0x80, 0xe5, 0xe6, 0x20, 0xa3,
+    0x6e, 0xf0, 0x13, 0x02, 0x27, 0xf1, 0xd2, 0x45, 0x0d, 0x29, 0x92, 0xba, 0x51, 0x3c, 0x7c, 0x38,
+    0x0b, 0x2d, 0x07, 0x1f, 0x1b, 0x16, 0x83, 0xcc, 0x56, 0x1a, 0x90, 0x45, 0x48, 0x91, 0x26, 0x0b,
+    0x4f, 0x6a, 0x33, 0xa0, 0x2d, 0xe4, 0x97, 0x08, 0x78, 0x6c, 0x23, 0x5b, 0x0e, 0x1c, 0x24, 0x04,
+    0x0a, 0x1f, 0x2d, 0x29, 0xcf, 0x70, 0xd4, 0x61, 0x20, 0xa1, 0x5a, 0xb9, 0x6c, 0xc9, 0xc0, 0xb0,
+    0xc8, 0x98, 0x60, 0x0c, 0x5c, 0x00, 0x5d, 0x7d, 0x3a, 0x14, 0x5c, 0x90, 0x06, 0x34, 0xa4, 0x50,
+    0xb4, 0x88, 0xaa, 0x04, 0x20, 0x55, 0x9d, 0x02, 0xeb, 0xf2, 0x74, 0xbf, 0x0f, 0x23, 0xfa, 0x10,
+    0xa7, 0xc9, 0x07, 0x67, 0xa2, 0x1a, 0x3a, 0xd9, 0x50, 0xd3, 0xdb, 0xaf, 0xd8, 0xac, 0x7d, 0x7e,
+    0x5e, 0x2b, 0xe8, 0xaa, 0x95, 0xde, 0x67, 0xfc, 0xc8, 0xd4, 0xdc, 0x6a, 0xbf, 0x97, 0x87, 0xa2,
+    0x1a, 0x38, 0xe9, 0xf8, 0xdc, 0x8f, 0x95, 0x85, 0xfe, 0x7f, 0x17, 0x01, 0x48, 0x7c, 0x52, 0xfd,
+    0x1f, 0xf5, 0xed, 0x7e, 0x67, 0x63, 0x90, 0x31, 0x9d, 0x6f, 0x4b, 0x2b, 0x43, 0xd2, 0xec, 0x71,
+    0x0f, 0x63, 0x07, 0xff, 0x93, 0xe0, 0xec, 0x72, 0x3c, 0x6d, 0x6f, 0xed, 0x23, 0xfe, 0x48, 0xfe,
+    0x07, 0xe8, 0xff, 0xf1, 0x7a, 0xfc, 0x5a, 0xb7, 0xe6, 0x93, 0xf1, 0x3e, 0x16, 0x8b, 0xad, 0x13,
+    0x6a, 0xff, 0x9f, 0xcf, 0xe8, 0xcc, 0xf0, 0x3d, 0x8f, 0xf7, 0x93, 0xfd, 0x3d, 0x6f, 0xb5, 0xc5,
+    0xfe, 0x9a, 0xd2, 0xaa, 0x30, 0x3d, 0xaf, 0xa9, 0xf3, 0xb8, 0x99, 0xdf, 0x11, 0x4f, 0xf8, 0x7d,
+    0xff, 0x8e, 0x89, 0x49, 0x6e, 0x2a, 0x05, 0x7b, 0xef, 0xc3, 0xd8, 0xce, 0xe4, 0x69, 0x7e, 0x8f,
+    0xe8, 0xf9, 0x99, 0x9c, 0xde, 0x1f, 0xb7, 0x83, 0x83, 0x27, 0xe3, 0x19, 0xfc, 0xd8, 0x5f, 0x9d,
+    0x84, 0xc4, 0x8a, 0xdd, 0x4f, 0x7a, 0x90, 0x07, 0x39, 0xfc, 0x7f, 0xcd, 0xf5, 0xb6, 0x11, 0x9f,
+    0xd3, 0x76, 0x3d, 0x2f, 0xf6, 0x1c, 0xe9, 0xed, 0xf8, 0x3a, 0x1f, 0x2b, 0x5a, 0x50, 0x00, 0xca,
+    0xd0, 0xe0, 0xf9, 0x21, 0x1f, 0xc3, 0xd5, 0xd3, 0x2f, 0xa9, 0x69, 0x69, 0xfc, 0x9e, 0x2f, 0x0e,
+    0x3f, 0x97, 0xf0, 0xbf, 0xf8, 0x5f, 0x13, 0xe8, 0x73, 0x7d, 0xbc, 0x9c, 0x5d, 0x1c, 0x7c, 0x59,
+    0xfe, 0xa7, 0x5a, 0x99, 0x99, 0x9e, 0x45, 0x4d, 0xcf, 0xd2, 0x7a, 0xff, 0x7f, 0xfd, 0x98, 0x3d,
+    0x88, 0x6c, 0xdf, 0xb2, 0xce, 0x1a, 0xf1, 0xb9, 0xf4, 0x7e, 0xb6, 0xe6, 0xe4, 0x0f, 0xcd, 0x3f,
+    0xe2, 0x74, 0x3b, 0x92, 0xfa, 0x36, 0x77, 0x72, 0x3c, 0xe1, 0x63, 0xe5, 0xe6, 0x8b, 0x20, 0xa2,
+    0xfb, 0x1d, 0x48, 0x33, 0xd7, 0x7d, 0xf3, 0x2e, 0x99, 0xfb, 0xc9, 0x7b, 0xfc, 0xbe, 0xcd, 0x38,
+    0x52, 0xf6, 0x78, 0x1d, 0x8d, 0xcd, 0xcf, 0xab, 0xf9, 0x39, 0x9c, 0x8e, 0xaf, 0x27, 0xc4, 0xe6,
+    0x4c, 0x8d, 0x59, 0xc0, 0x01, 0x8c, 0x47, 0x1e, 0x0e, 0x20, 0x72, 0xee, 0x71, 0x31, 0x7c, 0x39,
+    0x63, 0x20, 0xb5, 0x48, 0xcd, 0x07, 0x36, 0xae, 0x2a, 0x21, 0xe0, 0x77, 0xb1, 0x39, 0x90, 0xfe,
+    0x88, 0x2a, 0x38, 0x74, 0xd8, 0xb3, 0x5d, 0x60, 0xaa, 0xf4, 0x6e, 0x71, 0x10, 0x33, 0xbd, 0x03,
+    0xef, 0x9f, 0xee, 0x58, 0x3f, 0xa3, 0xe4, 0xf0, 0xf5, 0x6d, 0xd5, 0xb3, 0x17, 0xd2, 0xfe, 0x27,
+    0x85, 0xbd, 0xc4, 0xa9, 0xe6, 0xfa, 0x73, 0x82, 0xfa, 0x3d, 0xfa, 0x64, 0x71, 0xaa, 0x20, 0xa2,
+    0x19, 0xd9, 0x18, 0xda, 0x9d, 0x1f, 0x8e, 0x96, 0x42, 0x37, 0xea, 0x65, 0x22, 0x81, 0xd3, 0xb8,
+    0x4e, 0x5d, 0xa7, 0x1c, 0x73, 0x8a, 0xb9, 0x47, 0xc1, 0x81, 0xe3, 0x01, 0x74, 0x40, 0xa4, 0xe6,
+    0xf0, 0x73, 0x60, 0x9d, 0xc2, 0xca, 0xe1, 0x0f, 0x3f, 0x6f, 0xf6, 0x6f, 0x91, 0x23, 0x22, 0x76,
+    0xf1, 0xe1, 0xcf, 0xcd, 0xc6, 0xda, 0xcc, 0xb8, 0xa4, 0x4e, 0xf7, 0x19, 0x02, 0x9b, 0x8b, 0x77,
+    0x36, 0x3e, 0x2d, 0xb5, 0x6c, 0xe4, 0x7e, 0xd5, 0x7f, 0x8b, 0x87, 0x04, 0xd9, 0x31, 0xb0, 0x0b,
+    0x4b, 0xc4, 0xf2, 0xa9, 0xdf, 0xc2, 0x47, 0x8f, 0x77, 0x8e, 0x57, 0xc2, 0xa5, 0x4a, 0x5e, 0xec,
+    0x58, 0x9d, 0xbf, 0xdf, 0x5b, 0x5a, 0xa4, 0x84, 0x31, 0x95, 0x13, 0xe9, 0x76, 0xa2, 0x9f, 0x99,
+    0x9d, 0x1a, 0xa0, 0xf1, 0x6d, 0x7c, 0x3f, 0xf9, 0xb8, 0x29, 0x48, 0x6a, 0xca, 0x33, 0x4b, 0xa5,
+    0x1b, 0xd8, 0xd6, 0xcd, 0xd3, 0x84, 0xa6, 0x9e, 0x6f, 0xb6, 0x9f, 0xe7, 0x42, 0xc9, 0x8a, 0x8c,
+    0x0a, 0x40, 0x99, 0x29, 0x6e, 0xb7, 0x70, 0x23, 0xd8, 0x43, 0x83, 0x86, 0xb4, 0xac, 0xc3, 0x93,
+    0xc5, 0xf6, 0xf1, 0xd7, 0x14, 0xc6, 0xc3, 0xe1, 0xf7, 0x45, 0x99, 0x2a, 0x67, 0xef, 0x7e, 0x86,
+    0x24, 0xe8, 0x26, 0xa9, 0x1c, 0x88, 0xff, 0x1f, 0x64, 0x23, 0xc3, 0x63, 0x03, 0x12, 0x72, 0x74,
+    0x70, 0x71, 0x68, 0x4c, 0x1d, 0x9f, 0x5f, 0xb3, 0x81, 0x78, 0xa4, 0x84, 0x81, 0x99, 0x60, 0xcc,
+    0x8c, 0x8b, 0x99, 0x93, 0x78, 0x31, 0x51, 0x39, 0x28, 0xf4, 0xd4, 0x41, 0x21, 0x78, 0xb6, 0x6a,
+    0x48, 0x36, 0x0d, 0x3c, 0x3d, 0x5a, 0xeb, 0x99, 0x79, 0x80, 0xd8, 0xa8, 0x9e, 0x6d, 0xce, 0x26,
+    0xf5, 0xa6, 0x9a, 0xf1, 0xf9, 0x32, 0x12, 0x9d, 0x6a, 0xe6, 0x06, 0x10, 0x56, 0x5f, 0x56, 0x3b,
+    0x35, 0x72, 0x42, 0x79, 0xc9, 0x50, 0xac, 0x5a, 0x9d, 0x06, 0xe9, 0xae, 0xdd, 0x5f, 0x01, 0x28,
+    0xb4, 0x59, 0x47, 0x3c, 0xf8, 0xcc, 0xae, 0xab, 0x76, 0xb0, 0x13, 0x6c, 0xb4, 0x07, 0x7c, 0x33,
+    0xcb, 0x42, 0x52, 0x05, 0x92, 0xae, 0xd7, 0xd2, 0xd2, 0x52, 0xbe, 0x7e, 0x4f, 0x37, 0x85, 0xef,
+    0x0b, 0x34, 0xe6, 0xab, 0x56, 0x9a, 0xff, 0x33, 0x1b, 0x6e, 0x9d, 0xe8, 0x7e, 0xcf, 0x0e, 0x29,
+    0xd4, 0x9e, 0x48, 0x10, 0xa6, 0xd9, 0x84, 0xc1, 0x66, 0xd5, 0xa3, 0x6e, 0x4c, 0x68, 0x00, 0xa8,
+    0xe0, 0x13, 0xc5, 0x88, 0x7a, 0xf5, 0x75, 0xef, 0x7a, 0x46, 0x41, 0x52, 0xa6, 0x44, 0xe5, 0xe0,
+    0x81, 0x01, 0x24, 0xb9, 0xcc, 0x51, 0xbf, 0xa3, 0x33, 0xa5, 0xb4, 0xf2, 0x56, 0x11, 0x0a, 0x8f,
+    0x35, 0xe5, 0xa5, 0xd3, 0xd1, 0xb7, 0x83, 0x35, 0x00, 0x6c, 0xd1, 0x3c, 0x84, 0xa2, 0x48, 0x15,
+    0x39, 0xf9, 0xb7, 0xbc, 0xab, 0x4a, 0x5a, 0xb5, 0x08, 0xac, 0xdc, 0xd9, 0x91, 0x9f, 0x3c, 0x35,
+    0x42, 0xb2, 0xdc, 0xbe, 0x48, 0xd0, 0x1a, 0xc2, 0x02, 0x8e, 0x07, 0x7a, 0xdf, 0x15, 0x88, 0xc6,
+    0x00, 0x88, 0xb8, 0xd6, 0x2a, 0x4a, 0x99, 0x18, 0x81, 0x43, 0x5e, 0xaa, 0xab, 0x8a, 0x95, 0xda,
+    0xe4, 0x30, 0xc0, 0xa8, 0xb7, 0x4d, 0x51, 0xc8, 0x94, 0x0c, 0xf9, 0xa5, 0x09, 0x92, 0x76, 0xb0,
+    0xb5, 0x6a, 0xbe, 0xab, 0x73, 0xb4, 0x84, 0x3b, 0x13, 0x13, 0xb9, 0xc6, 0x96, 0xe8, 0x60, 0x4b,
+    0x25, 0x20, 0xb6, 0x81, 0xe3, 0xad, 0xca, 0x07, 0x86, 0xf8, 0xb8, 0xf8, 0x72, 0x64, 0xbd, 0x02,
+    0x7a, 0x73, 0xdd, 0xb9, 0x12, 0x38, 0x54, 0x27, 0x2c, 0xf7, 0x7a, 0x05, 0x72, 0xa1, 0x0e, 0x78,
+    0xe8, 0xb7, 0x36, 0xac, 0x37, 0xcd, 0x10, 0x4c, 0x35, 0xf9, 0x58, 0xcc, 0x18, 0x69, 0x6b, 0xb5,
+    0x98, 0xd0, 0xf4, 0xea, 0xcf, 0x9b, 0x89, 0xb8, 0x60, 0x68, 0x54, 0x68, 0x0a, 0x09, 0xfa, 0x36,
+    0x74, 0x0a, 0xc7, 0x8a, 0x14, 0xcc, 0x25, 0x06, 0x8a, 0x98, 0xef, 0xca, 0x88, 0x18, 0xae, 0xb6,
+    0x4c, 0x39, 0x32, 0xc1, 0x0f, 0x35, 0xd9, 0x91, 0x24, 0x63, 0x76, 0xa2, 0x26, 0x30, 0x08, 0x93,
+    0x16, 0x6b, 0x51, 0xa7, 0x44, 0x3e, 0xb9, 0x6a, 0x4f, 0x2f, 0x07, 0x14, 0x20, 0xca, 0xfe, 0x4c,
+    0x11, 0xc7, 0xe1, 0x8f, 0xe6, 0xe0, 0x80, 0xfe, 0x35, 0xd0, 0x07, 0x03, 0x5a, 0x24, 0xe1, 0x41,
+    0x2d, 0xea, 0xb8, 0xea, 0x85, 0xa7, 0x35, 0xb2, 0x32, 0x5f, 0x54, 0xf1, 0x8a, 0x38, 0xb0, 0x49,
+    0x9d, 0x1e, 0xed, 0xff, 0x4e, 0x0f, 0x37, 0x97, 0x6f, 0x65, 0x09, 0x4e, 0xf4, 0x10, 0x1f, 0x05,
+    0x3a, 0xdf, 0x12, 0x3c, 0x6e, 0xfd, 0xd2, 0xf0, 0xea, 0x81, 0xb9, 0x4b, 0x05, 0x6a, 0x50, 0xfc,
+    0x57, 0x7d, 0xfb, 0x7e, 0x8a, 0x2d, 0x14, 0xe9, 0xc0, 0x1a, 0xca, 0xa5, 0xba, 0x08, 0xef, 0x84,
+    0x98, 0xa2, 0xaa, 0x48, 0x75, 0x07, 0xc2, 0xa5, 0x90, 0xef, 0x69, 0xbc, 0xc3, 0xce, 0x31, 0x1e,
+    0x30, 0x51, 0xc5, 0x16, 0x8c, 0x1f, 0xbf, 0xc3, 0x20, 0x62, 0x8c, 0x51, 0x18, 0x24, 0x25, 0xb4,
+    0x64, 0x8e, 0x4c, 0x7e, 0x5e, 0x2f, 0x03, 0xe3, 0x85, 0xb7, 0x54, 0x92, 0x8c, 0xaf, 0x66, 0xc4,
+    0x67, 0xa6, 0x24, 0xdf, 0xd5, 0xdc, 0x99, 0xfc, 0x39, 0x66, 0x07, 0xab, 0xb3, 0xc7, 0x7c, 0x09,
+    0xe1, 0x0c, 0xd6, 0x68, 0x97, 0x86, 0x18, 0x10, 0x1c, 0x10, 0x5d, 0x26, 0x5c, 0xb3, 0xd4, 0x0c,
+    0xba, 0x2a, 0xc2, 0x2e, 0xa1, 0xed, 0x86, 0x17, 0x54, 0x44, 0x25, 0x33, 0xc9, 0x21, 0x74, 0x17,
+    0x08, 0xda, 0xa9, 0x15, 0xe3, 0x8f, 0xdd, 0xb3, 0x5c, 0x30, 0x1e, 0x62, 0xa4, 0x17, 0x92, 0x10,
+    0xd5, 0x0a, 0xf2, 0x18, 0x51, 0x43, 0x04, 0xc9, 0xdf, 0x29, 0x49, 0xb8, 0xef, 0x34, 0xba, 0x38,
+    0x0d, 0xa3, 0x97, 0xbd, 0xab, 0xc8, 0xc6, 0x55, 0xe7, 0xdb, 0xa3, 0x25, 0x29, 0xe0, 0x80, 0xe7,
+    0x8c, 0xb1, 0x16, 0x99, 0xa8, 0x8b, 0x83, 0x6f, 0x4e, 0xdd, 0x7f, 0xa3, 0xe2, 0xcf, 0xaf, 0x52,
+    0xa1, 0x83, 0x4d, 0x36, 0x5f, 0x59, 0x19, 0x83, 0xa2, 0xdf, 0x4d, 0x9f, 0x32, 0xf9, 0x72, 0x71,
+    0x6d, 0xcb, 0x73, 0x33, 0xd7, 0x4c, 0xb8, 0xa0, 0x6e, 0xc8, 0x28, 0xfb, 0xb7, 0xff, 0x4a, 0xc2,
+    0x6d, 0x4a, 0x0e, 0x08, 0xad, 0x6c, 0x65, 0x41, 0x00, 0xe9, 0xd3, 0x21, 0xa4, 0x86, 0x54, 0x10,
+    0xe8, 0x86, 0x7c, 0x94, 0x25, 0xe0, 0x80, 0x96, 0x39, 0xc1, 0x8e, 0x76, 0xa8, 0x8b, 0x19, 0xa5,
+    0xca, 0x2a, 0x24, 0x73, 0xa1, 0x9e, 0x0c, 0x69, 0xe4, 0x10, 0x09, 0xbd, 0x77, 0x55, 0xcc, 0xee,
+    0x57, 0x98, 0x58, 0xe4, 0xe6, 0x04, 0x25, 0x83, 0x3e, 0x5b, 0x99, 0x11, 0xf9, 0xd3, 0x06, 0x6c,
+    0x0d, 0x1a, 0xf7, 0xb3, 0x05, 0x18, 0x9f, 0x0d, 0x35, 0xaa, 0xa6, 0xdf, 0x44, 0x90, 0x19, 0xf0,
+    0x92, 0x49, 0x4d, 0x52, 0xef, 0x6c, 0x8e, 0xd5, 0x2f, 0xd3, 0x83, 0xe0, 0x5d, 0x69, 0x18, 0xef,
+    0xc5, 0xa3, 0x39, 0x30, 0x44, 0x64, 0x9c, 0xef, 0x79, 0x15, 0x08, 0xe0, 0x7c, 0x71, 0x60, 0x33,
+    0x60, 0x2c, 0x24, 0x48, 0xb9, 0x1d, 0xed, 0xbf, 0x32, 0x08, 0x97, 0xec, 0xec, 0x16, 0x1c, 0xfb,
+    0xdf, 0x30, 0x89, 0xa1, 0x14, 0x1a, 0xb9, 0x4e, 0x26, 0x3f, 0x69, 0x7b, 0xb3, 0x52, 0x2a, 0x97,
+    0x08, 0x4d, 0x13, 0xa5, 0xc2, 0x8b, 0xad, 0x97, 0x02, 0xa1, 0x86, 0xf3, 0xf6, 0x6a, 0xa8, 0x19,
+    0x5f, 0x3a, 0x6c, 0x2b, 0x6a, 0x92, 0x03, 0xc6, 0x8d, 0xf7, 0xe0, 0x44, 0xf5, 0xe7, 0x83, 0xf3,
+    0x76, 0x12, 0xb2, 0xb7, 0x9d, 0xe0, 0x66, 0xe1, 0x52, 0xaa, 0xb0, 0xdf, 0x64, 0x0e, 0x9b, 0x3e,
+    0x5c, 0x53, 0x60, 0x83, 0x86, 0x72, 0x8f, 0x72, 0xb5, 0xc5, 0x56, 0x9c, 0x23, 0x90, 0x90, 0xdd,
+    0x80, 0x63, 0x49, 0xcf, 0x3d, 0x2e, 0x89, 0xd4, 0x44, 0x61, 0xb0, 0x49, 0x4c, 0x72, 0x82, 0x39,
+    0xe8, 0xa2, 0x02, 0x52, 0x56, 0x2b, 0x25, 0x09, 0x96, 0x32, 0x4f, 0x38, 0xcb, 0x51, 0x16, 0xca,
+    0x03, 0x43, 0xe7, 0xc0, 0x08, 0xe6, 0x98, 0x53, 0xce, 0x40, 0x4e, 0x4c, 0x83, 0xce, 0x58, 0x90,
+    0x87, 0x49, 0x41, 0x72, 0xe5, 0xe5, 0x7f, 0x16, 0x69, 0x10, 0xf2, 0x90, 0x65, 0x28, 0x40, 0x0a,
+    0x32, 0x43, 0xce, 0x4c, 0x59, 0x75, 0xd9, 0xa2, 0x46, 0x15, 0xe1, 0x18, 0x0d, 0x90, 0xd3, 0xbf,
+    0x08, 0x66, 0x51, 0x92, 0x28, 0x67, 0x74, 0x51, 0x08, 0xe7, 0x28, 0x96, 0xfd, 0xd3, 0x71, 0x8f,
+    0x89, 0x13, 0xc2, 0xd8, 0xb3, 0x06, 0xb9, 0xd2, 0x45, 0x4c, 0x6c, 0x2f, 0xd5, 0x76, 0x3a, 0xe0,
+    0xc4, 0xe1, 0x0e, 0x3c, 0x60, 0xcc, 0x68, 0x6d, 0xbc, 0x64, 0xcd, 0xba, 0x11, 0xb1, 0x2c, 0x0b,
+    0x46, 0xd2, 0x31, 0x07, 0x3d, 0x02, 0x84, 0x12, 0x40, 0xf8, 0xe1, 0x14, 0x8e, 0x23, 0xe5, 0x0c,
+    0x08, 0x21, 0x0f, 0x38, 0xe4, 0x19, 0xce, 0x15, 0x39, 0x90, 0x02, 0x34, 0xa0, 0x24, 0x3a, 0xc0,
+    0x98, 0x10, 0x78, 0x18, 0xfa, 0xe1, 0x45, 0x94, 0x10, 0x14, 0xda, 0x8c, 0x44, 0x1a, 0x00, 0x9a,
+    0xeb, 0x36, 0xac, 0x41, 0x7b, 0x20, 0x7b, 0xe1, 0x59, 0xa0, 0x12, 0xeb, 0x26, 0x09, 0x24, 0x4d,
+    0x70, 0xc2, 0x48, 0x26, 0x0d, 0xeb, 0x54, 0x91, 0x04, 0xa5, 0x58, 0x20, 0x40, 0x48, 0x42, 0x10,
+    0xb2, 0xb4, 0x6d, 0x1e, 0x2c, 0x05, 0x28, 0xdb, 0x09, 0x31, 0x4c, 0x21, 0xc3, 0x3d, 0x65, 0x82,
+    0x6a, 0x06, 0x21, 0xae, 0x14, 0x90, 0x8e, 0x60, 0x4a, 0xb9, 0xe7, 0x8a, 0xcd, 0x5d, 0x05, 0xc7,
+    0x9e, 0xf9, 0x5b, 0x66, 0xc5, 0x0c, 0x20, 0x78, 0xb0, 0x13, 0x5e, 0x34, 0x5c, 0xe3, 0x44, 0x03,
+    0x8c, 0x49, 0x9c, 0xe5, 0x24, 0x86, 0x54, 0x41, 0xc7, 0x75, 0x2b, 0x5b, 0x29, 0xbc, 0xb7, 0x5e,
+    0x02, 0x50, 0xf7, 0xbf, 0xc3, 0xb0, 0xe6, 0x33, 0x31, 0x1b, 0x22, 0xc1, 0xc6, 0xcb, 0xaa, 0x37,
+    0x48, 0x6b, 0xbb, 0xc9, 0x3d, 0x9b, 0xab, 0xd2, 0x1a, 0xe7, 0xc0, 0x34, 0x96, 0xb1, 0x1b, 0xcb,
+    0x29, 0x2d, 0xe9, 0x81, 0xf3, 0x9e, 0x88, 0xfa, 0x14, 0x46, 0x13, 0xcd, 0xa1, 0x6a, 0xad, 0x20,
+    0x0c, 0xe1, 0x01, 0x87, 0x3b, 0xda, 0xd2, 0x84, 0xef, 0x5c, 0x34, 0x15, 0x77, 0x70, 0x6d, 0x24,
+    0x73, 0x8a, 0x96, 0xd4, 0x49, 0xf1, 0xd7, 0x4c, 0x0f, 0x2b, 0x57, 0xbe, 0xfc, 0x32, 0x08, 0x10,
+    0x38, 0xde, 0x72, 0xe8, 0x15, 0x4c, 0x1a, 0xbb, 0x85, 0x08, 0x05, 0x4d, 0x06, 0xda, 0x0c, 0xe7,
+    0x1c, 0xf2, 0xe1, 0x01, 0x77, 0x7b, 0xa7, 0x94, 0x67, 0x83, 0x22, 0x4f, 0x9c, 0x65, 0xa5, 0x9e,
+    0xa4, 0xc6, 0xec, 0x46, 0x88, 0x90, 0x11, 0x58, 0xe6, 0x34, 0xf4, 0xc2, 0x79, 0xe2, 0xb2, 0xe1,
+    0x0d, 0xf8, 0xb6, 0x54, 0xc1, 0xb3, 0x8c, 0xee, 0x39, 0x60, 0x4a, 0x16, 0xb2, 0x6b, 0x7c, 0xca,
+    0x54, 0x93, 0xd6, 0x14, 0xa2, 0x24, 0x7c, 0x75, 0xb7, 0x08, 0x4f, 0x1c, 0xbb, 0x42, 0x6b, 0x37,
+    0x01, 0x8c, 0xa4, 0x22, 0x38, 0x60, 0x57, 0xdf, 0x13, 0xc2, 0x0c, 0x40, 0x43, 0x61, 0x10, 0x8b,
+    0x90, 0xc0, 0xa6, 0x74, 0x61, 0x06, 0x60, 0xaa, 0x9c, 0x3a, 0x3f, 0x1e, 0x6d, 0x6f, 0x2a, 0x3e,
+    0x39, 0xa6, 0x56, 0xbd, 0xe2, 0xd0, 0x61, 0xb6, 0x13, 0xc6, 0xb4, 0xd9, 0x78, 0xae, 0x99, 0x0e,
+    0x23, 0xa5, 0x07, 0xcf, 0x88, 0xf2, 0xe4, 0xc9, 0x3c, 0xd7, 0x49, 0x0d, 0xcc, 0x61, 0x64, 0x9c,
+    0xde, 0xad, 0xc3, 0xc9, 0x38, 0xf5, 0x39, 0x34, 0xa8, 0x66, 0xe8, 0xee, 0x90, 0x18, 0xc2, 0x90,
+    0x8c, 0x4d, 0x24, 0x8a, 0xcf, 0x39, 0xe9, 0x80, 0x71, 0x89, 0x4b, 0x06, 0x06, 0x47, 0x98, 0xc6,
+    0x72, 0xd0, 0x6a, 0x4d, 0x70, 0xe9, 0x95, 0x77, 0xbc, 0x30, 0xb4, 0x2b, 0x53, 0x01, 0x96, 0x83,
+    0x9a, 0xa6, 0x10, 0x2c, 0x6e, 0x66, 0x50, 0xcb, 0x22, 0x9c, 0x66, 0x44, 0x4e, 0x51, 0x4e, 0x5a,
+    0x0f, 0x1b, 0xac, 0x81, 0x54, 0xb4, 0xc3, 0x48, 0xef, 0x52, 0x20, 0x26, 0x22, 0x54, 0x47, 0x25,
+    0x70, 0x16, 0xa6, 0x10, 0x9e, 0xae, 0x64, 0x52, 0xd2, 0x15, 0xe2, 0xf0, 0xca, 0xd0, 0x77, 0xcc,
+    0xa8, 0x60, 0x20, 0x65, 0x2d, 0x17, 0x5c, 0x65, 0xc9, 0xa3, 0xaa, 0xa0, 0x9e, 0x58, 0x1b, 0x03,
+    0xc6, 0x4d, 0x3c, 0xde, 0x92, 0xa0, 0x8a, 0xd1, 0x26, 0xe8, 0x13, 0xae, 0x5d, 0x2d, 0x1e, 0x39,
+    0xca, 0xd9, 0x2d, 0xdf, 0x09, 0x4e, 0xaf, 0x2b, 0x51, 0xdc, 0x1c, 0x01, 0xad, 0x22, 0xc7, 0x7a,
+    0xb7, 0x6d, 0x16, 0xb5, 0x3a, 0x40, 0x94, 0x0a, 0x31, 0x4c, 0x9a, 0x35, 0x0c, 0x32, 0xaf, 0x13,
+    0xf0, 0xb2, 0xc5, 0xde, 0x22, 0xb8, 0x74, 0xca, 0x38, 0xb9, 0xa8, 0x30, 0xc4, 0xa4, 0x89, 0x46,
+    0x19, 0xc6, 0x6f, 0x08, 0x50, 0xd6, 0x08, 0x81, 0x35, 0x14, 0x40, 0x73, 0x93, 0x22, 0xc2, 0x07,
+    0xc6, 0xe9, 0x66, 0xc3, 0x90, 0xdf, 0x9e, 0xef, 0x87, 0x08, 0x2c, 0x20, 0xd8, 0xd4, 0x81, 0x63,
+    0xb7, 0x02, 0xd7, 0x58, 0x59, 0xb5, 0x5d, 0x30, 0x3e, 0x33, 0x96, 0x1b, 0x05, 0xf5, 0x56, 0xc2,
+    0x48, 0x13, 0xbb, 0xc2, 0x8c, 0xf2, 0xa2, 0x57, 0xad, 0x61, 0xb4, 0x91, 0x55, 0x70, 0xb2, 0xd5,
+    0xc8, 0x24, 0x11, 0x9b, 0xca, 0x92, 0xb1, 0xe7, 0x18, 0x5a, 0x47, 0x3b, 0xbb, 0x2c, 0x2d, 0x94,
+    0x17, 0x8e, 0x2f, 0xb6, 0xc0, 0xa6, 0xa2, 0xe3, 0x4c, 0x0b, 0x3c, 0x65, 0x93, 0x54, 0x46, 0x56,
+    0xb2, 0xeb, 0x88, 0x40, 0xc4, 0x2c, 0x4a, 0xc4, 0x35, 0x16, 0x94, 0x4a, 0x85, 0x31, 0x40, 0x59,
+    0x58, 0xf3, 0x8c, 0xa4, 0x4a, 0x50, 0x08, 0xba, 0x21, 0x12, 0x9b, 0x01, 0x38, 0x83, 0x23, 0x8e,
+    0x08, 0x73, 0x36, 0x11, 0x94, 0x8a, 0xb3, 0x49, 0x4a, 0x58, 0xf7, 0xbe, 0x9e, 0x12, 0x7a, 0x93,
+    0x23, 0x0b, 0xf3, 0x08, 0x42, 0x10, 0x35, 0x79, 0x34, 0x56, 0xc3, 0x15, 0x2b, 0x08, 0x1c, 0x8c,
+    0xc0, 0x56, 0xd2, 0x09, 0xc4, 0xa8, 0x09, 0x8e, 0x2b, 0x2e, 0x16, 0x4a, 0xe2, 0x61, 0x2d, 0x29,
+    0x8e, 0x35, 0x49, 0x60, 0xaf, 0x19, 0x76, 0xe9, 0x1e, 0xfe, 0x66, 0xd6, 0x69, 0x43, 0x1d, 0x5f,
+    0x4e, 0x9a, 0x24, 0xf8, 0xd5, 0xa4, 0x53, 0x9c, 0x20, 0x21, 0x48, 0x00, 0x9d, 0x49, 0x14, 0x40,
+    0xd2, 0x12, 0x01, 0x5c, 0x65, 0x21, 0x8a, 0xac, 0x56, 0x98, 0x49, 0x96, 0x21, 0x05, 0xac, 0x6d,
+    0x44, 0x73, 0x44, 0x27, 0x38, 0x9a, 0x69, 0x81, 0xd6, 0xe2, 0xb2, 0xed, 0x96, 0xfe, 0x6f, 0xd3,
+    0x2b, 0x47, 0x1e, 0xaf, 0x4e, 0x1b, 0x25, 0x67, 0x31, 0xb3, 0x28, 0x0d, 0x16, 0x6e, 0x54, 0xb3,
+    0x1e, 0x2f, 0x46, 0x58, 0x95, 0x32, 0x3b, 0xea, 0x58, 0x1a, 0x85, 0x2d, 0x0b, 0xbb, 0x14, 0xf3,
+    0xc3, 0x29, 0x14, 0x4e, 0xa6, 0x74, 0xc1, 0x9f, 0x39, 0x96, 0x52, 0x96, 0x37, 0x6a, 0x1a, 0x32,
+    0x0a, 0xdc, 0x28, 0x47, 0x38, 0x6d, 0x94, 0x77, 0xe2, 0x4d, 0x96, 0x43, 0x3a, 0x91, 0x03, 0x04,
+    0x82, 0xaf, 0x69, 0x11, 0xd5, 0xcd, 0x30, 0xb6, 0x78, 0x86, 0xd8, 0x00, 0xb9, 0x98, 0x8c, 0x45,
+    0x03, 0x26, 0x78, 0x9d, 0x90, 0x90, 0xab, 0x75, 0x95, 0x99, 0x0d, 0xf9, 0xbf, 0x2f, 0x44, 0xdf,
+    0x12, 0xb4, 0x2b, 0x13, 0x9b, 0x5a, 0x90, 0x64, 0x9e, 0xb3, 0x6c, 0xb0, 0x71, 0x79, 0xb4, 0x02,
+    0x20, 0x9b, 0x37, 0x19, 0x94, 0x22, 0x3d, 0x34, 0x5e, 0x38, 0x84, 0xb6, 0x3a, 0xcf, 0x46, 0x9d,
+    0x46, 0x1b, 0x51, 0xe7, 0x34, 0x69, 0x46, 0xb9, 0xe5, 0xb3, 0x01, 0x8d, 0xe7, 0x6b, 0x05, 0xc2,
+    0x52, 0x02, 0x8a, 0x8c, 0x4c, 0xa9, 0x2c, 0x93, 0x5e, 0x21, 0x68, 0x34, 0x07, 0x57, 0x04, 0xa6,
+    0x8b, 0x73, 0x2a, 0x0d, 0xe7, 0x2c, 0x36, 0x68, 0xeb, 0xcf, 0x18, 0x76, 0xf0, 0x96, 0x7b, 0x96,
+    0x86, 0xe6, 0x90, 0x28, 0x3c, 0xf5, 0x6a, 0x59, 0xe6, 0x2d, 0x29, 0x0a, 0xd4, 0x25, 0x68, 0xa9,
+    0x8b, 0x4a, 0x50, 0x5c, 0x7c, 0x63, 0xe1, 0xe0, 0xd9, 0xd5, 0xe0, 0x52, 0x98, 0x81, 0x21, 0x42,
+    0x4a, 0xe6, 0x46, 0x31, 0x02, 0x49, 0x49, 0x8c, 0x46, 0xb3, 0x95, 0x12, 0xa6, 0x0e, 0x2d, 0x85,
+    0x00, 0x8d, 0xd6, 0x6f, 0x2a, 0x12, 0xb0, 0x21, 0x9a, 0x29, 0x29, 0xb3, 0x06, 0x21, 0x96, 0x41,
+    0x38, 0x8c, 0x45, 0x30, 0x24, 0x80, 0x0c, 0x5d, 0x4c, 0xda, 0x0a, 0xf2, 0x82, 0x18, 0x50, 0xcd,
+    0xd1, 0x14, 0xc6, 0x10, 0x07, 0xd6, 0x76, 0xe1, 0x92, 0xce, 0x6a, 0xdb, 0x1d, 0x6b, 0x04, 0x80,
+    0x49, 0x71, 0x1a, 0x23, 0x11, 0x47, 0x17, 0x86, 0x45, 0x17, 0x29, 0x4a, 0x41, 0x1d, 0xf1, 0xb7,
+    0xa4, 0x33, 0xd4, 0x25, 0x48, 0x3d, 0x62, 0x9a, 0x30, 0xc0, 0x37, 0xbd, 0x36, 0xca, 0x7d, 0xe7,
+    0x4b, 0x31, 0x5f, 0x5b, 0x6d, 0x02, 0x72, 0x8a, 0xb1, 0x15, 0x6f, 0xb7, 0x40, 0xcf, 0xa9, 0xf2,
+    0xda, 0x13, 0x89, 0x94, 0x56, 0x50, 0x3b, 0xc3, 0x24, 0x5c, 0x55, 0x28, 0x52, 0x82, 0xea, 0xe5,
+    0x60, 0x02, 0x82, 0xb9, 0xd1, 0x10, 0xc2, 0xee, 0x8c, 0xc4, 0xb0, 0x41, 0x52, 0x81, 0x46, 0x66,
+    0x08, 0x8c, 0x88, 0x08, 0x53, 0xb8, 0xd9, 0x8d, 0x52, 0x42, 0x69, 0x33, 0x6a, 0x11, 0xa9, 0xc8,
+    0xf3, 0x5d, 0x3a, 0x1e, 0x33, 0x70, 0x6c, 0xb0, 0x18, 0xd6, 0x29, 0x68, 0x12, 0xd7, 0x12, 0xb5,
+    0x92, 0x46, 0xf8, 0xbd, 0xb0, 0x84, 0xeb, 0x55, 0x0c, 0x3c, 0xb2, 0x5f, 0x1f, 0x30, 0xa7, 0x48,
+    0x1b, 0x81, 0x18, 0x30, 0x19, 0x8c, 0x42, 0x12, 0x89, 0x6d, 0x0c, 0x73, 0x2c, 0x28, 0xf7, 0x76,
+    0x08, 0x50, 0x22, 0x2a, 0x2a, 0x2d, 0x84, 0x82, 0x33, 0x32, 0xb1, 0x1e, 0x2a, 0x9c, 0x2c, 0x31,
+    0x98, 0x04, 0x13, 0x13, 0x83, 0x11, 0xa5, 0x48, 0x82, 0x54, 0x2c, 0x71, 0x1c, 0xb8, 0x1e, 0x77,
+    0x40, 0x49, 0x70, 0x0d, 0x6b, 0x0a, 0x14, 0x49, 0xc4, 0x85, 0x69, 0xc9, 0xaf, 0xac, 0x4a, 0x90,
+    0x12, 0x80, 0xbb, 0xc5, 0x10, 0x06, 0x4c, 0x86, 0xd0, 0x0c, 0xfa, 0xcf, 0x0e, 0x5a, 0x34, 0x42,
+    0x35, 0x98, 0x53, 0x83, 0x2e, 0xf1, 0x94, 0x24, 0x40, 0x2f, 0x77, 0x08, 0x65, 0x40, 0xaa, 0x82,
+    0x22, 0x19, 0x8c, 0x46, 0x14, 0x68, 0x1f, 0x1c, 0x5b, 0x2c, 0xa4, 0xb3, 0xcc, 0x06, 0x52, 0x43,
+    0x21, 0x00, 0x25, 0x51, 0x20, 0x27, 0x39, 0x69, 0x84, 0xf3, 0xc6, 0xda, 0x3c, 0xd5, 0xac, 0x00,
+    0x91, 0xaa, 0x24, 0x0c, 0x00, 0x60, 0x2e, 0x04, 0x04, 0x22, 0x80, 0x46, 0x30, 0x81, 0xad, 0x4d,
+    0x25, 0x04, 0x33, 0x00, 0x28, 0x3d, 0x6a, 0x1c, 0x34, 0x6a, 0xcc, 0x8c, 0xcc, 0x9a, 0x02, 0xa2,
+    0x42, 0x00, 0xc8, 0x78, 0x97, 0x68, 0x2c, 0x6a, 0x02, 0x43, 0x08, 0x2e, 0x38, 0xcf, 0x49, 0x49,
+    0xd4, 0xd1, 0xeb, 0x54, 0xf0, 0xe1, 0x1d, 0xca, 0x11, 0xd6, 0x18, 0x61, 0x81, 0xe3, 0x52, 0x77,
+    0xa4, 0x11, 0x01, 0x5e, 0x03, 0x52, 0xc3, 0x00, 0x8b, 0xe3, 0x9a, 0x70, 0xb6, 0x00, 0x11, 0x39,
+    0xb8, 0x12, 0x40, 0x54, 0x30, 0x23, 0xba, 0x50, 0x2f, 0x98, 0x78, 0x76, 0x6e, 0xbc, 0x4e, 0x56,
+    0x93, 0xdc, 0x50, 0xda, 0x81, 0x00, 0x2b, 0xb8, 0xa4, 0x04, 0x88, 0x4e, 0x2b, 0x0d, 0x81, 0x40,
+    0x41, 0x54, 0x01, 0x88, 0x51, 0xb0, 0xbe, 0xad, 0xb2, 0xeb, 0x12, 0xcb, 0x09, 0x34, 0xf7, 0xb8,
+    0x61, 0x01, 0x94, 0x8d, 0xe6, 0x87, 0x10, 0x86, 0x1a, 0x1e, 0xf1, 0x64, 0x37, 0x91, 0x40, 0x4d,
+    0x0e, 0xe2, 0xd9, 0x5a, 0x75, 0x9b, 0x10, 0xb6, 0x0c, 0xa1, 0x72, 0x34, 0x78, 0x11, 0x20, 0xcc,
+    0x24, 0xc6, 0x40, 0x66, 0x4e, 0x61, 0x46, 0x18, 0xa2, 0x33, 0xbd, 0xb0, 0x7c, 0xe7, 0x28, 0x10,
+    0x4a, 0xd8, 0xfc, 0x63, 0x87, 0x4e, 0x86, 0xe2, 0xf3, 0x99, 0xcb, 0x2a, 0x2d, 0xd6, 0x44, 0x13,
+    0x2d, 0xa4, 0x7a, 0xe6, 0xb6, 0xd2, 0x81, 0x8d, 0xc3, 0x64, 0x34, 0x57, 0x38, 0x20, 0x9c, 0x41,
+    0x98, 0x85, 0x18, 0x8c, 0x4a, 0x73, 0x4a, 0x52, 0xfa, 0x97, 0x2e, 0x49, 0x1e, 0x3b, 0xc7, 0x2d,
+    0xbc, 0x93, 0x1e, 0xfc, 0xdb, 0xc3, 0x91, 0xef, 0x89, 0x69, 0xa0, 0xac, 0xf1, 0x36, 0x04, 0xa6,
+    0x04, 0xeb, 0x30, 0x41, 0x23, 0x44, 0x00, 0x9b, 0x87, 0x0d, 0x0a, 0x6a, 0xb3, 0xc5, 0xa8, 0xc1,
+    0x22, 0x2a, 0x99, 0x48, 0xc1, 0x11, 0xcc, 0xde, 0xa9, 0xa7, 0x48, 0x2c, 0xeb, 0x37, 0x16, 0xc2,
+    0x46, 0xc5, 0x18, 0xcc, 0x8b, 0x28, 0x41, 0x71, 0x1b, 0x34, 0x6e, 0x78, 0x4a, 0xa4, 0x01, 0x54,
+    0xa2, 0x10, 0x41, 0x4d, 0x22, 0x68, 0xb3, 0x0e, 0x56, 0x5c, 0x5e, 0x12, 0x33, 0x29, 0x03, 0xac,
+    0x94, 0x80, 0xc6, 0xa5, 0x4c, 0x9a, 0x3b, 0xce, 0x5d, 0xb0, 0x5e, 0x3c, 0xcb, 0xa6, 0x81, 0x8d,
+    0xc6, 0x9c, 0x06, 0x39, 0x81, 0x58, 0x94, 0xcd, 0x90, 0xc1, 0x29, 0x09, 0xeb, 0x36, 0xc9, 0x8c,
+    0x59, 0x1c, 0x88, 0x73, 0x5c, 0x25, 0x29, 0x06, 0xba, 0x9c, 0xb4, 0x41, 0xb8, 0xb2, 0x21, 0x4a,
+    0x35, 0x24, 0x08, 0xac, 0x39, 0x52, 0x39, 0xf3, 0x2e, 0x59, 0x26, 0x33, 0x97, 0x03, 0xce, 0xa6,
+    0x52, 0x94, 0x9a, 0x3c, 0x67, 0x4d, 0xa8, 0xc1, 0x3d, 0xe6, 0xd6, 0x23, 0x28, 0x02, 0x09, 0x4c,
+    0x14, 0x11, 0xb0, 0x4b, 0xe6, 0x19, 0x4a, 0x26, 0x46, 0xa5, 0xa4, 0xab, 0x10, 0x00, 0x15, 0xa4,
+    0x15, 0x66, 0x65, 0x0c, 0x38, 0x4b, 0xcf, 0xe2, 0x5c, 0xb8, 0x30, 0xc7, 0x58, 0xc2, 0xcc, 0xe6,
+    0xd9, 0x43, 0x3d, 0x41, 0xad, 0x43, 0xc6, 0xa1, 0x0c, 0x2c, 0x8f, 0x1c, 0x4d, 0x25, 0x64, 0x09,
+    0x9b, 0x89, 0xc2, 0xd2, 0x78, 0xa0, 0x38, 0x59, 0x9e, 0xea, 0xd6, 0x82, 0xa8, 0xb4, 0x81, 0xe2,
+    0xe6, 0xc2, 0x50, 0xc8, 0x26, 0xb7, 0x08, 0x69, 0x24, 0xc7, 0x30, 0x2c, 0x32, 0x5c, 0x71, 0x7c,
+    0x36, 0xa3, 0x2e, 0xb7, 0x5a, 0x08, 0xc3, 0x83, 0x3e, 0x67, 0x16, 0x85, 0x11, 0x26, 0x26, 0x06,
+    0xa4, 0x50, 0xb0, 0x29, 0x0e, 0x23, 0x26, 0x8c, 0x5a, 0x48, 0xa0, 0x09, 0x22, 0x28, 0xaa, 0x98,
+    0x14, 0x16, 0xe7, 0xd3, 0xb0, 0x9b, 0xc7, 0x79, 0x8e, 0x52, 0xa6, 0x87, 0x9e, 0x67, 0x08, 0x11,
+    0x0a, 0x02, 0xd4, 0xf4, 0xe0, 0x18, 0xe6, 0x74, 0xc0, 0x8e, 0x21, 0x31, 0x1c, 0xb0, 0x0b, 0x86,
+    0x83, 0x1b, 0xa8, 0xdb, 0x21, 0x8e, 0xa7, 0x4c, 0x0a, 0x33, 0x24, 0xa5, 0x2a, 0x30, 0x83, 0x57,
+    0x37, 0x36, 0xca, 0xc8, 0x6e, 0xa7, 0x0a, 0x3d, 0x6a, 0x10, 0xd1, 0x07, 0x11, 0xa2, 0x06, 0x23,
+    0x0b, 0x24, 0x4c, 0xa8, 0xf5, 0xac, 0xa9, 0x69, 0x46, 0xaa, 0x8c, 0xc4, 0x66, 0x66, 0x10, 0xc9,
+    0x77, 0x89, 0x61, 0x07, 0x8b, 0xca, 0xd2, 0x28, 0x8c, 0x01, 0x54, 0xdd, 0xd3, 0x08, 0x5c, 0xe1,
+    0xb2, 0x1b, 0xce, 0xad, 0x04, 0x50, 0x42, 0x02, 0x67, 0x8a, 0xa6, 0x54, 0x3b, 0xdc, 0x61, 0x06,
+    0x83, 0x4c, 0xe6, 0xf0, 0xa4, 0x16, 0x6b, 0x6b, 0x1d, 0x42, 0x10, 0x73, 0x68, 0x56, 0xf5, 0xc3,
+    0x0c, 0x26, 0xe6, 0x12, 0xb1, 0xe7, 0x18, 0x48, 0xd4, 0x69, 0x48, 0x5e, 0x2b, 0x20, 0x42, 0x07,
+    0x9b, 0x96, 0xdd, 0x0f, 0x9f, 0x14, 0xdb, 0x17, 0xc4, 0x38, 0x9f, 0xde, 0x67, 0xae, 0x30, 0x9a,
+    0xb9, 0xb3, 0xf5, 0xfc, 0x3f, 0xbe, 0x6e, 0xb8, 0xa0, 0xb3, 0x91, 0x5a, 0x82, 0x9b, 0x24, 0x9a,
+    0x8a, 0x73, 0xc4, 0x4f, 0x9f, 0x35, 0xfc, 0x78, 0x39, 0xf2, 0x2a, 0x1c, 0x2c, 0xf3, 0x1e, 0xb8,
+    0xe7, 0xcc, 0x7f, 0x8f, 0xc6, 0x7f, 0xef, 0xf7, 0x1f, 0x8e, 0xa3, 0x87, 0x9f, 0x25, 0x3a, 0xd6,
+    0x22, 0x8f, 0xbf, 0x67, 0x5f, 0x4b, 0x3b, 0xd7, 0x0f, 0xba, 0xf1, 0x89, 0xf9, 0x91, 0x8a, 0x8a,
+    0x19, 0xca, 0xa3, 0x1c, 0x55, 0xf2, 0x70, 0xf2, 0x16, 0xa2, 0x2d, 0x53, 0xe4, 0xd4, 0x55, 0xc3,
+    0x51, 0xe2, 0x2f, 0xb9, 0x02, 0x96, 0x16, 0x65, 0x09, 0x1d, 0x09, 0x9e, 0x35, 0x13, 0x9d, 0xec,
+    0xe3, 0xe3, 0x8b, 0xe4, 0xf0, 0xe2, 0xa1, 0x5d, 0xee, 0x00, 0xd5, 0x4d, 0xc5, 0x57, 0x33, 0x5a,
+    0x99, 0x35, 0x86, 0x50, 0x4c, 0x49, 0xad, 0x70, 0xfe, 0x7b, 0x7f, 0x1f, 0x45, 0xe6, 0x4a, 0xa4,
+    0x9c, 0x44, 0x3f, 0x67, 0xaa, 0x5d, 0x89, 0xd7, 0x55, 0x9c, 0xcd, 0x14, 0xc7, 0xaa, 0x97, 0x64,
+    0x62, 0x77, 0x1c, 0x70, 0x37, 0x9a, 0xea, 0x33, 0x9d, 0xdd, 0x75, 0xd2, 0x33, 0xd9, 0xeb, 0x8a,
+    0xee, 0x44, 0x01, 0x29, 0x31, 0xc6, 0xb1, 0xcf, 0x2d, 0x95, 0x8e, 0x97, 0x72, 0x7d, 0x70, 0xbb,
+    0xcf, 0x22, 0xba, 0xe9, 0x0f, 0x2d, 0xc6, 0x05, 0x1c, 0xc0, 0xa5, 0x21, 0xe6, 0x35, 0xc3, 0xf7,
+    0x98, 0xf5, 0xe0, 0xf9, 0xe5, 0x0a, 0xeb, 0xd5, 0x4f, 0xdf, 0xb1, 0x8c, 0x03, 0x15, 0x18, 0x3b,
+    0x60, 0xdc, 0x11, 0x5d, 0x78, 0xae, 0x7f, 0xbf, 0x91, 0xfc, 0x7e, 0xb4, 0xfd, 0xee, 0xd2, 0x98,
+    0xf8, 0xf5, 0xae, 0x77, 0xdd, 0xe6, 0xba, 0xeb, 0x06, 0x76, 0x12, 0x41, 0x4e, 0xdf, 0x5c, 0x0c,
+    0xc5, 0x0c, 0xd0, 0x1b, 0x55, 0x06, 0xa7, 0x9b, 0xaf, 0x8e, 0x8f, 0xbd, 0xd6, 0x1a, 0xac, 0x58,
+    0x68, 0x86, 0x02, 0x8c, 0xba, 0xe3, 0xd6, 0xfb, 0x74, 0xa5, 0xe3, 0x4b, 0x28, 0xa8, 0x07, 0x2e,
+    0x1c, 0x6b, 0x0e, 0x6e, 0x4d, 0x63, 0x09, 0x0d, 0xb5, 0xac, 0x67, 0xbe, 0x57, 0x5a, 0xe8, 0x5f,
+    0x26, 0x29, 0xaa, 0x76, 0xb4, 0xb2, 0x71, 0x8e, 0xfb, 0x9f, 0xc7, 0xd5, 0x67, 0xbb, 0xc8, 0xc7,
+    0x8d, 0x0b, 0xef, 0x78, 0xc7, 0x09, 0xdc, 0x2d, 0x3d, 0xb4, 0x66, 0xa2, 0x99, 0x46, 0x28, 0x77,
+    0xca, 0xfc, 0x7a, 0x7d, 0x91, 0xc0, 0xc9, 0x96, 0x71, 0x4a, 0x65, 0xc7, 0x8c, 0x1e, 0xcc, 0x09,
+    0x35, 0x87, 0x28, 0xe1, 0x32, 0x46, 0x8c, 0xb0, 0x06, 0x86, 0x52, 0x4f, 0x49, 0xf3, 0x98, 0xf8,
+    0xe8, 0xfe, 0x7b, 0x7c, 0x7e, 0x3a, 0x3e, 0x4c, 0x30, 0x60, 0xb9, 0x11, 0xd6, 0x33, 0x9a, 0x81,
+    0x92, 0xc7, 0x1a, 0x33, 0xcc, 0xae, 0x34, 0xd6, 0x86, 0x7e, 0x5c, 0x78, 0xea, 0x8f, 0x9c, 0x8c,
+    0x36, 0x31, 0x51, 0x2d, 0x4c, 0x71, 0xa5, 0xcf, 0x73, 0x2b, 0x1c, 0x2c, 0x36, 0x53, 0xb5, 0x88,
+    0x79, 0xde, 0xb8, 0xe1, 0x3f, 0x37, 0x5c, 0x61, 0x39, 0x76, 0xd6, 0x84, 0x12, 0xc3, 0x3c, 0x2d,
+    0x1e, 0xf7, 0x5f, 0x5a, 0xcf, 0xb3, 0x8a, 0x99, 0xd4, 0x81, 0xc4, 0xe6, 0x92, 0xc1, 0x92, 0xa5,
+    0x8c, 0x50, 0x1b, 0x6a, 0x8c, 0x2a, 0x89, 0x19, 0x98, 0xc1, 0x70, 0x13, 0x30, 0x53, 0xe2, 0x8c,
+    0xde, 0x63, 0x88, 0x33, 0x26, 0x8b, 0x8f, 0x8a, 0xf3, 0xfd, 0x9f, 0x5e, 0x38, 0x07, 0x7b, 0x5a,
+    0xc4, 0xf2, 0xe3, 0xa8, 0x70, 0x5c, 0xc1, 0x3c, 0x25, 0xce, 0xdf, 0x54, 0xdd, 0x74, 0x86, 0x7c,
+    0xe5, 0x78, 0xd1, 0x61, 0x1c, 0x45, 0xbc, 0xd5, 0x39, 0x0f, 0x8e, 0x22, 0x6e, 0x70, 0x08, 0x27,
+    0x28, 0x71, 0x02, 0xdd, 0x53, 0x93, 0xaa, 0x8c, 0xed, 0xf1, 0x0f, 0x2a, 0x20, 0xf1, 0x0f, 0x92,
+    0xf0, 0x6a, 0xae, 0x58, 0xc2, 0xea, 0x83, 0xec, 0xdd, 0x59, 0x9d, 0x7a, 0xc7, 0x39, 0x3d, 0x7e,
+    0x27, 0xef, 0xf6, 0x3f, 0x8f, 0x51, 0x79, 0x6e, 0x05, 0x88, 0x4a, 0xb1, 0x60, 0x46, 0x2e, 0xde,
+    0x25, 0x32, 0x2a, 0x9d, 0x6a, 0x70, 0xef, 0x6b, 0x11, 0x85, 0x63, 0x26, 0xf5, 0xc4, 0x72, 0xaa,
+    0xa3, 0x39, 0x98, 0x88, 0x69, 0x3a, 0xc2, 0x9c, 0xd1, 0x39, 0x8f, 0x11, 0xbd, 0xac, 0x60, 0xb2,
+    0x78, 0xa6, 0xdc, 0x9d, 0x8c, 0x68, 0x1d, 0x23, 0x34, 0xc3, 0x17, 0x9a, 0x8c, 0x75, 0x11, 0xcf,
+    0x77, 0x15, 0x49, 0x15, 0x13, 0x30, 0x44, 0xc6, 0x3c, 0x0e, 0x7d, 0xd8, 0xae, 0x35, 0x0c, 0xd8,
+    0x8a, 0xe1, 0x7c, 0xb4, 0x08, 0x46, 0x8d, 0x42, 0x19, 0x11, 0x6d, 0xc4, 0x18, 0x18, 0xd4, 0x79,
+    0xd9, 0xc6, 0x09, 0x6f, 0x11, 0x0e, 0x11, 0xd9, 0x60, 0x89, 0xeb, 0xc7, 0x0f, 0xcc, 0xae, 0x00,
+    0xee, 0xcd, 0x46, 0x00, 0x71, 0x0c, 0x02, 0xb0, 0xf2, 0x6c, 0xf1, 0xe2, 0x3d, 0xe7, 0x1c, 0x51,
+    0xef, 0x3c, 0x75, 0xeb, 0x3d, 0xf2, 0xf4, 0x93, 0xcf, 0x5a, 0x89, 0x96, 0xa2, 0x9b, 0xdd, 0xe3,
+    0xf1, 0x06, 0x44, 0xb5, 0xb3, 0x58, 0x40, 0xc1, 0x0b, 0x6a, 0x38, 0x36, 0xf9, 0xc7, 0x1a, 0x64,
+    0xc5, 0xed, 0x75, 0xe3, 0x3e, 0x73, 0x11, 0xd7, 0x13, 0xee, 0xf8, 0xf8, 0xad, 0xee, 0xf5, 0x49,
+    0xcc, 0x98, 0xd7, 0x13, 0x2e, 0xa9, 0x3c, 0xf9, 0x1c, 0x7a, 0xc7, 0x7c, 0xae, 0x11, 0xb9, 0x8e,
+    0x29, 0x8c, 0xc2, 0x4c, 0x24, 0x73, 0x1e, 0x22, 0xfb, 0xe7, 0x14, 0x87, 0x18, 0x4c, 0xbd, 0xf6,
+    0x87, 0xd6, 0x94, 0x99, 0x26, 0x30, 0xef, 0x75, 0x85, 0x84, 0x5e, 0xdc, 0x70, 0x80, 0x53, 0x13,
+    0x2d, 0x01, 0x5a, 0xc3, 0x99, 0xb3, 0x14, 0xe4, 0xac, 0x7a, 0x8b, 0x93, 0x22, 0xcd, 0x71, 0xd3,
+    0xef, 0x91, 0x5c, 0x46, 0xde, 0x30, 0x5c, 0x84, 0x4c, 0x20, 0x2a, 0x06, 0x59, 0x83, 0x8c, 0x09,
+    0xdf, 0x26, 0xbd, 0x74, 0xaf, 0x65, 0x0c, 0x07, 0x22, 0xc4, 0x62, 0x29, 0xca, 0x44, 0x41, 0xbc,
+    0xcf, 0x8f, 0x49, 0xde, 0x50, 0x5b, 0x5c, 0x74, 0x25, 0xda, 0x01, 0xcc, 0x6b, 0x53, 0xb5, 0xc5,
+    0x64, 0x5b, 0xcd, 0x7a, 0x13, 0x62, 0x3a, 0xa7, 0xb0, 0x20, 0x67, 0x3c, 0x78, 0x57, 0x9b, 0x3a,
+    0xa4, 0xf2, 0xbc, 0x43, 0x76, 0xa6, 0x02, 0xd0, 0xdc, 0xeb, 0xa7, 0x3b, 0x5a, 0xc6, 0xf3, 0x9e,
+    0x3c, 0x2b, 0xce, 0x2a, 0x18, 0x1c, 0x9d, 0x53, 0xce, 0x46, 0x35, 0x54, 0x8a, 0x9b, 0xe5, 0xc5,
+    0x42, 0xeb, 0x0a, 0xfb, 0xd9, 0xc4, 0x6a, 0x9d, 0xda, 0x24, 0x0d, 0x70, 0x15, 0xb0, 0x0b, 0x83,
+    0x08, 0x77, 0x78, 0xf8, 0xae, 0x4b, 0xc2, 0x19, 0x78, 0xa8, 0x17, 0x06, 0x25, 0x86, 0x31, 0x85,
+    0x6e, 0x54, 0x74, 0x6f, 0x9d, 0x40, 0x95, 0x73, 0x8f, 0x1a, 0xac, 0xf3, 0x9b, 0x8d, 0x56, 0x18,
+    0xb0, 0x0b, 0xea, 0x2e, 0xe6, 0xb1, 0xab, 0x04, 0x93, 0x0e, 0x6b, 0x8c, 0x5f, 0x26, 0x22, 0x05,
+    0xc9, 0xeb, 0x50, 0x3c, 0xd9, 0xc2, 0x63, 0x18, 0x0f, 0xb1, 0x58, 0x8c, 0x6e, 0xf7, 0xc6, 0xb5,
+    0x9e, 0x4d, 0x9d, 0x78, 0xd0, 0xcd, 0x9d, 0x26, 0xec, 0xd5, 0x70, 0xef, 0x6b, 0x0e, 0x27, 0x04,
+    0x9a, 0x10, 0x51, 0x03, 0x32, 0x74, 0xb1, 0x4d, 0x8d, 0xdc, 0x6b, 0xc4, 0x6f, 0x26, 0x93, 0x2d,
+    0x1d, 0x60, 0x03, 0x6d, 0xcb, 0xf1, 0xa4, 0x4e, 0x62, 0x01, 0xb2, 0xa8, 0xd2, 0x85, 0x9c, 0x96,
+    0xf5, 0xe3, 0x0b, 0x2f, 0x2f, 0x14, 0xec, 0xe3, 0x8d, 0x77, 0xb7, 0x40, 0x46, 0x22, 0x58, 0x08,
+    0x11, 0x19, 0x23, 0x18, 0x0a, 0x5b, 0x26, 0x34, 0x0b, 0x82, 0xf2, 0xe3, 0x8a, 0x48, 0x99, 0x69,
+    0x5d, 0x00, 0x44, 0x50, 0x52, 0x53, 0x17, 0x4a, 0x8c, 0x43, 0x72, 0x91, 0x75, 0x34, 0x99, 0x88,
+    0xb3, 0x8a, 0x60, 0xcc, 0xe2, 0xa2, 0x5c, 0xc4, 0x51, 0x39, 0x7a, 0xc6, 0xa7, 0x62, 0x91, 0xb3,
+    0xb5, 0xc6, 0x8e, 0x21, 0x05, 0x5b, 0x05, 0x25, 0x2d, 0xf5, 0xeb, 0x07, 0x73, 0xe5, 0xd2, 0xa3,
+    0xc5, 0xec, 0x57, 0x09, 0x39, 0x14, 0x5c, 0xa8, 0x98, 0x3a, 0x2d, 0xc6, 0x42, 0xd5, 0x00, 0x8b,
+    0x72, 0xb1, 0x13, 0x3c, 0xd7, 0x10, 0xa5, 0x5c, 0x52, 0x00, 0x4e, 0x67, 0x1d, 0x2b, 0x05, 0x58,
+    0x5a, 0x14, 0x5c, 0xcd, 0x69, 0xd5, 0x91, 0xb8, 0xc4, 0x4c, 0xaf, 0x11, 0x77, 0xb8, 0xc5, 0x2b,
+    0x81, 0x12, 0xb3, 0x31, 0x8a, 0xe3, 0x1d, 0xe7, 0x26, 0xa3, 0x14, 0xc3, 0x33, 0x4d, 0x38, 0xa3,
+    0x62, 0x16, 0xa4, 0x34, 0x5c, 0x0c, 0x4d, 0x88, 0x87, 0x6a, 0x07, 0x1a, 0x57, 0xbe, 0x56, 0x29,
+    0xb5, 0x54, 0x32, 0x81, 0xb5, 0x8d, 0x19, 0x04, 0x4b, 0x7d, 0x42, 0xa5, 0x7b, 0xb5, 0xd7, 0x87,
+    0xcf, 0x71, 0x8c, 0x26, 0x42, 0x97, 0xa4, 0xbb, 0x1d, 0x74, 0xf7, 0x97, 0x11, 0x11, 0x59, 0x77,
+    0x85, 0xc2, 0xce, 0x5f, 0xa8, 0x16, 0xf4, 0x63, 0xb9, 0x61, 0x6b, 0x58, 0x2c, 0xe5, 0x83, 0x18,
+    0x48, 0x8c, 0xc0, 0xe9, 0x5d, 0x9a, 0x01, 0xd9, 0xa5, 0x18, 0x9a, 0x6d, 0x8a, 0x7c, 0x4c, 0xf3,
+    0x55, 0x87, 0x02, 0x2e, 0x4c, 0x50, 0x4a, 0x2c, 0x18, 0x36, 0x0f, 0x4d, 0x58, 0x75, 0x52, 0xb4,
+    0x27, 0x92, 0x96, 0xb0, 0xad, 0x97, 0x18, 0x2d, 0xcd, 0x21, 0x10, 0x9b, 0x23, 0x84, 0x67, 0x3d,
+    0xc6, 0x34, 0x93, 0x78, 0xc1, 0x53, 0xbb, 0x8e, 0x2a, 0x79, 0x0a, 0x3a, 0x41, 0x13, 0xb6, 0x0d,
+    0x54, 0x59, 0xa4, 0x63, 0x2e, 0x94, 0x18, 0xb1, 0x55, 0x33, 0x28, 0x08, 0x2a, 0x04, 0x8d, 0x51,
+    0xdc, 0xe1, 0x20, 0x49, 0x91, 0xc6, 0x2e, 0xf3, 0x5e, 0xb1, 0x3c, 0xf9, 0xad, 0x61, 0x09, 0x4e,
+    0x55, 0x69, 0xcd, 0xc4, 0x60, 0xa6, 0x73, 0xba, 0xc5, 0x74, 0xc6, 0x5a, 0x49, 0x36, 0x63, 0x18,
+    0xdc, 0x84, 0x91, 0x64, 0x28, 0x54, 0x65, 0xa0, 0xc5, 0x68, 0x45, 0xf9, 0x18, 0x82, 0x6a, 0x22,
+    0x39, 0xca, 0xc4, 0x83, 0x83, 0xa6, 0x8e, 0x62, 0x10, 0x77, 0x54, 0x59, 0x22, 0xb4, 0x31, 0x79,
+    0xe4, 0x71, 0x8e, 0x48, 0xaa, 0xd0, 0x96, 0x2a, 0xf2, 0x69, 0x04, 0xb8, 0x13, 0x2d, 0x17, 0x88,
+    0x46, 0xc2, 0x82, 0x01, 0x10, 0x6f, 0x08, 0x88, 0x4e, 0xe0, 0x6a, 0x1f, 0x33, 0x11, 0xa4, 0x64,
+    0xb4, 0x81, 0x14, 0x93, 0x32, 0x87, 0x86, 0xdc, 0xd0, 0x2c, 0x53, 0x49, 0xe2, 0x29, 0xe5, 0xd0,
+    0xca, 0x71, 0x50, 0x53, 0x95, 0x8a, 0x1c, 0xc2, 0x89, 0xc8, 0xa8, 0x81, 0x20, 0x54, 0xb0, 0xaa,
+    0xa0, 0x4e, 0x49, 0x5d, 0x39, 0xba, 0xd2, 0xab, 0xbc, 0x9c, 0x42, 0x19, 0x7e, 0x3a, 0x8b, 0x91,
+    0xb0, 0x58, 0xa4, 0xb4, 0x22, 0xe4, 0xe3, 0xc1, 0xe7, 0xec, 0x0e, 0x3a, 0x21, 0xe3, 0x13, 0x99,
+    0x0d, 0x0c, 0x20, 0xa4, 0xac, 0x41, 0x33, 0x64, 0x56, 0x31, 0x99, 0x35, 0x14, 0x65, 0xde, 0x21,
+    0x06, 0xc3, 0x31, 0x58, 0x2c, 0xd4, 0x1d, 0xe5, 0x6b, 0x11, 0x25, 0xb8, 0x95, 0x18, 0x52, 0xdd,
+    0x40, 0x38, 0x2e, 0xec, 0x61, 0x40, 0x26, 0x04, 0xc7, 0x05, 0xdb, 0x30, 0x61, 0xaa, 0xc4, 0x5e,
+    0x5d, 0x40, 0xdc, 0x6b, 0x1b, 0x62, 0x8c, 0x02, 0x18, 0x68, 0x55, 0x13, 0xc9, 0x58, 0xc2, 0x4a,
+    0xe7, 0x35, 0x8c, 0x3d, 0xb1, 0x11, 0x10, 0x4a, 0x42, 0x48, 0x60, 0xe9, 0x54, 0xca, 0xc4, 0xd8,
+    0x74, 0xa9, 0x2d, 0xb3, 0x58, 0xc4, 0xcb, 0x8c, 0x31, 0x60, 0xc5, 0x55, 0xee, 0x71, 0xf1, 0x1b,
+    0xb6, 0xb0, 0x40, 0xa3, 0x32, 0xb4, 0x95, 0x86, 0xae, 0x16, 0x2f, 0x06, 0x6e, 0x10, 0x36, 0x34,
+    0x10, 0x61, 0x81, 0x82, 0xae, 0xa7, 0x0a, 0xc1, 0xa1, 0x2a, 0x28, 0xdb, 0x4d, 0x3d, 0x75, 0x53,
+    0xdd, 0x9a, 0xe2, 0x2e, 0xef, 0x81, 0x87, 0x52, 0xac, 0x21, 0x04, 0x80, 0x21, 0x95, 0x81, 0x25,
+    0x45, 0x38, 0xcd, 0x84, 0x83, 0x88, 0xa0, 0xe1, 0x59, 0x01, 0xa0, 0x30, 0xa3, 0x76, 0x34, 0xa9,
+    0xa3, 0x33, 0x48, 0xbc, 0x60, 0xcd, 0xbd, 0x45, 0x88, 0xa4, 0x43, 0x6e, 0x69, 0x61, 0x5e, 0x6b,
+    0x58, 0x6e, 0xc2, 0xc0, 0xb6, 0xe8, 0x74, 0x26, 0xc5, 0x34, 0x9d, 0x49, 0x4b, 0xa5, 0x7e, 0x77,
+    0x1c, 0x6a, 0xa5, 0xb1, 0x40, 0x42, 0xce, 0x56, 0x31, 0x89, 0x0f, 0x61, 0x45, 0x10, 0x48, 0x62,
+    0xb5, 0x19, 0x9b, 0x15, 0x51, 0x73, 0x3a, 0xd6, 0x0b, 0x76, 0x69, 0x2c, 0x93, 0x5a, 0x4b, 0x32,
+    0x15, 0x24, 0x64, 0x53, 0x28, 0x82, 0x12, 0x95, 0x84, 0xdd, 0x60, 0x1c, 0xee, 0x63, 0x5c, 0x44,
+    0xe5, 0xad, 0x56, 0x64, 0x55, 0x40, 0xde, 0x67, 0x1e, 0x20, 0x64, 0x1a, 0x21, 0xa2, 0x42, 0x86,
+    0x22, 0x94, 0xe5, 0xaa, 0xe1, 0x92, 0x58, 0x82, 0x62, 0x2d, 0x48, 0x8a, 0x54, 0xcb, 0x38, 0x70,
+    0xcc, 0xcd, 0x2c, 0x43, 0x05, 0xb1, 0x11, 0x0e, 0xc5, 0x24, 0x44, 0x19, 0x0e, 0x9e, 0x04, 0xb2,
+    0x0f, 0x58, 0xe2, 0x7b, 0xe5, 0xd2, 0xaa, 0x89, 0x29, 0x4a, 0x4a, 0xd1, 0xa6, 0x28, 0xc4, 0xd9,
+    0xc5, 0x6b, 0x9b, 0x4b, 0x02, 0x45, 0x1a, 0x71, 0x6d, 0x4d, 0x3c, 0x02, 0x57, 0x1b, 0xbc, 0xf1,
+    0xc6, 0x16, 0x7b, 0xba, 0xf5, 0x52, 0xe4, 0xa1, 0x54, 0x2d, 0xe1, 0x37, 0x20, 0x46, 0x02, 0x0c,
+    0x4d, 0x48, 0x49, 0x08, 0x94, 0xd0, 0x12, 0x8e, 0x0d, 0x31, 0x20, 0x71, 0x2c, 0xd4, 0x09, 0xa9,
+    0x12, 0x4e, 0x29, 0xa3, 0x04, 0xb8, 0xa0, 0x2f, 0x35, 0x08, 0xc4, 0x2c, 0x81, 0x45, 0x1b, 0x91,
+    0xd6, 0x04, 0x92, 0xb2, 0x22, 0xaa, 0x5c, 0xd6, 0x2b, 0x39, 0x35, 0x54, 0xec, 0xbd, 0x55, 0x4c,
+    0xb8, 0xc5, 0xd8, 0x5a, 0x40, 0xcb, 0x11, 0x05, 0x14, 0x09, 0xa9, 0x45, 0x43, 0x37, 0x15, 0x0e,
+    0x10, 0x12, 0x84, 0xb1, 0x10, 0x2a, 0xe9, 0xd1, 0xb8, 0x0d, 0x0a, 0x92, 0x04, 0x10, 0xb4, 0x4b,
+    0x92, 0x97, 0x02, 0x72, 0xf0, 0x80, 0x6f, 0x18, 0x16, 0x94, 0x1b, 0x76, 0xa0, 0x6a, 0x81, 0x9b,
+    0x15, 0xa8, 0x6c, 0x8b, 0x0b, 0x04, 0x30, 0xa1, 0x33, 0x66, 0xa2, 0x04, 0xd9, 0x5c, 0x74, 0x5f,
+    0x62, 0x21, 0x15, 0x2c, 0x2a, 0x86, 0x81, 0x0d, 0x88, 0x88, 0x0e, 0x54, 0xc6, 0x19, 0x63, 0xaa,
+    0x9c, 0xde, 0x93, 0x2a, 0x0b, 0x54, 0x24, 0xa8, 0x83, 0x2c, 0x62, 0x16, 0x42, 0xa2, 0x58, 0x52,
+    0x52, 0xd0, 0x9a, 0x62, 0x55, 0xd4, 0x61, 0xe5, 0x2a, 0xa9, 0x52, 0x41, 0x4a, 0x4c, 0x56, 0x0b,
+    0x70, 0xc0, 0x97, 0x4a, 0x83, 0x7a, 0x65, 0xa8, 0x02, 0x60, 0x40, 0x47, 0x73, 0x1e, 0x01, 0x95,
+    0x0a, 0x6e, 0x71, 0xc6, 0x26, 0xcc, 0xc4, 0x60, 0x59, 0x40, 0x5d, 0x04, 0x40, 0x48, 0x26, 0xa9,
+    0x67, 0x26, 0xab, 0x04, 0x83, 0x29, 0x97, 0xac, 0x50, 0xbd, 0x9a, 0x80, 0x4c, 0x2a, 0x41, 0xcb,
+    0x96, 0xbc, 0x60, 0x5e, 0x4d, 0x42, 0x9c, 0xd2, 0xe8, 0x37, 0x71, 0x01, 0x66, 0x9e, 0x01, 0x61,
+    0xc4, 0x46, 0x5c, 0x62, 0x05, 0xb3, 0x02, 0x98, 0xb5, 0xaa, 0x19, 0x24, 0x52, 0x03, 0x15, 0xcc,
+    0x2e, 0x16, 0xee, 0x31, 0x09, 0x49, 0xb0, 0x04, 0x18, 0x3a, 0x06, 0x65, 0x41, 0x71, 0x82, 0x5d,
+    0xf1, 0x05, 0x81, 0x03, 0x2d, 0xf5, 0x84, 0xee, 0x90, 0x93, 0x29, 0x8c, 0x70, 0x05, 0xd9, 0x8c,
+    0x43, 0x32, 0x04, 0x16, 0x22, 0xaa, 0x66, 0x42, 0xe3, 0x81, 0xe5, 0x8a, 0x6c, 0xa3, 0xc2, 0xd6,
+    0x77, 0x75, 0xac, 0x37, 0x34, 0x19, 0x6f, 0xc2, 0x8c, 0xb1, 0x18, 0x0e, 0xed, 0x56, 0x38, 0x5b,
+    0xe4, 0xdd, 0x56, 0x30, 0x83, 0xdd, 0x8e, 0x29, 0x65, 0x28, 0xbb, 0xaa, 0x44, 0x16, 0x22, 0x22,
+    0x64, 0x1a, 0x68, 0x41, 0x03, 0x0c, 0x9a, 0x47, 0x2d, 0xaa, 0x58, 0x4c, 0x01, 0x64, 0xd2, 0xa6,
+    0xdc, 0x24, 0x12, 0x17, 0x91, 0x8e, 0x96, 0x6c, 0x54, 0x2b, 0x69, 0x42, 0x10, 0x0e, 0x5d, 0x26,
+    0x6a, 0x15, 0x82, 0x98, 0x7d, 0x46, 0xb6, 0x72, 0x20, 0x18, 0x2a, 0xf4, 0x22, 0x4a, 0xa4, 0xd4,
+    0x99, 0x34, 0xa1, 0x91, 0x55, 0x4e, 0x6c, 0xd5, 0x81, 0x80, 0x9a, 0xaa, 0x3b, 0x70, 0xa0, 0x3c,
+    0xa1, 0x4a, 0x22, 0x64, 0xd0, 0x42, 0xeb, 0x14, 0xf9, 0xb5, 0xc6, 0x86, 0xd9, 0xb5, 0x8e, 0x31,
+    0x2f, 0xb0, 0x71, 0x8a, 0x62, 0xcb, 0x0b, 0x54, 0xc5, 0xbc, 0x42, 0x9b, 0xb5, 0x88, 0xa9, 0x18,
+    0x25, 0x90, 0x29, 0x39, 0x26, 0xb4, 0x53, 0x37, 0x30, 0xb0, 0xe8, 0x90, 0x60, 0x26, 0xc2, 0xd0,
+    0x73, 0x2b, 0x00, 0x28, 0x99, 0x35, 0x46, 0xed, 0x6a, 0x15, 0x88, 0x71, 0x30, 0x56, 0x09, 0x16,
+    0x8d, 0x27, 0x22, 0x15, 0x35, 0x20, 0xd4, 0xa0, 0x06, 0x20, 0xcb, 0x93, 0x85, 0x82, 0x1c, 0x90,
+    0x92, 0x2e, 0xb8, 0x4f, 0xbd, 0xc7, 0x8a, 0x87, 0x39, 0x15, 0x0d, 0x21, 0x52, 0x19, 0x4e, 0x00,
+    0x02, 0x13, 0x84, 0xad, 0x93, 0xc4, 0x4b, 0x9d, 0x02, 0xe2, 0x03, 0x99, 0x8c, 0x74, 0x66, 0x49,
+    0x30, 0xc2, 0x8c, 0x06, 0x83, 0x53, 0x2d, 0x63, 0x02, 0xd3, 0xa0, 0x80, 0x62, 0xe8, 0x51, 0x01,
+    0x35, 0x20, 0x40, 0x9a, 0x30, 0x4c, 0x24, 0xd8, 0x20, 0x08, 0xc1, 0x90, 0x82, 0x93, 0x00, 0xd1,
+    0x60, 0x31, 0x4a, 0x00, 0x03, 0x92, 0x86, 0xa8, 0x81, 0xb3, 0x8a, 0x19, 0x27, 0x02, 0xa4, 0x05,
+    0x68, 0x2a, 0x70, 0x91, 0xdd, 0xd6, 0xa8, 0x58, 0x88, 0xb9, 0xce, 0x38, 0xa6, 0xee, 0x91, 0x30,
+    0xad, 0x00, 0xd0, 0xaa, 0x02, 0xd9, 0xa2, 0xd5, 0x08, 0x05, 0x5a, 0x97, 0x84, 0xf0, 0x10, 0xd8,
+    0x58, 0x19, 0xa4, 0x95, 0x87, 0xc3, 0x2c, 0xc5, 0x14, 0x4b, 0x4f, 0x05, 0x9c, 0x04, 0x1a, 0x09,
+    0x84, 0x01, 0x72, 0xb5, 0x12, 0x02, 0x04, 0xa2, 0x8c, 0x14, 0x98, 0x68, 0x50, 0x90, 0x62, 0xa5,
+    0x48, 0x40, 0xe1, 0x56, 0x54, 0xb9, 0x8a, 0xc2, 0x19, 0x04, 0xe8, 0x02, 0xc4, 0x8c, 0x50, 0x72,
+    0xa1, 0x14, 0x1b, 0x68, 0x52, 0x2a, 0x08, 0x64, 0x40, 0x69, 0xa0, 0x84, 0x04, 0xce, 0x60, 0x55,
+    0x02, 0x6c, 0xc5, 0x41, 0xca, 0x11, 0x80, 0x2c, 0x4a, 0x08, 0x00, 0xa8, 0x2c, 0xc1, 0x53, 0x75,
+    0x58, 0x56, 0x1c, 0xbc, 0x55, 0x1c, 0x98, 0x8a, 0x62, 0x4d, 0x4d, 0x14, 0x60, 0xb2, 0x88, 0x10,
+    0x12, 0x33, 0x09, 0x07, 0x22, 0xa2, 0x99, 0xb9, 0x35, 0xac, 0x2e, 0x4b, 0x80, 0x93, 0xb8, 0x8c,
+    0x22, 0x32, 0x91, 0x08, 0xa4, 0xd1, 0xd0, 0xc3, 0x77, 0xb7, 0x3c, 0xe7, 0x0d, 0xd7, 0x39, 0x76,
+    0x18, 0x69, 0xe2, 0x75, 0xe4, 0xc3, 0x0b, 0xed, 0xcf, 0x08, 0x27, 0xd9, 0xcf, 0x25, 0xdb, 0x87,
+    0x0d, 0x05, 0xe7, 0x33, 0x4e, 0xc6, 0x5c, 0x84, 0xc5, 0x8d, 0xa1, 0x93, 0x30, 0xf6, 0x99, 0x86,
+    0x3e, 0xaf, 0xce, 0x19, 0xae, 0x93, 0x09, 0xeb, 0x93, 0x84, 0x9d, 0xd7, 0x2e, 0x7e, 0x13, 0xb6,
+    0x2d, 0xcc, 0x8f, 0x0b, 0x28, 0xdc, 0xb2, 0x4e, 0x5c, 0xce, 0xbd, 0xe0, 0x76, 0x79, 0xc8, 0xe8,
+    0xcc, 0x91, 0xdf, 0x77, 0x33, 0xc2, 0x7e, 0x1b, 0xbd, 0x8f, 0x95, 0x24, 0x4c, 0x31, 0xb0, 0x86,
+    0xd7, 0x86, 0x60, 0xfd, 0xdf, 0x3c, 0xcf, 0x3d, 0xd5, 0xce, 0x6e, 0x32, 0x98, 0x4e, 0xe4, 0x5f,
+    0x79, 0x3c, 0xe3, 0x56, 0x3c, 0xdd, 0x4c, 0xcc, 0x6c, 0xc9, 0xab, 0xc5, 0x6f, 0xce, 0x66, 0xfb,
+    0x2f, 0x29, 0xcc, 0x97, 0xb5, 0xe7, 0xcc, 0xde, 0xec, 0xf9, 0x98, 0xde, 0xdb, 0xc9, 0xcc, 0xe7,
+    0xb7, 0x73, 0xf2, 0x6b, 0xa4, 0x5c, 0xe3, 0x28, 0xf0, 0x65, 0x3d, 0x4f, 0x3e, 0x73, 0xac, 0x97,
+    0xb7, 0x3c, 0x31, 0x9b, 0x69, 0xc3, 0x9b, 0xcb, 0xe5, 0x11, 0x03, 0x49, 0x0f, 0x34, 0xb8, 0x72,
+    0xc6, 0xdc, 0xc5, 0x32, 0x2e, 0xc9, 0xc1, 0x43, 0x8d, 0xbb, 0x87, 0x97, 0x29, 0xf8, 0xae, 0xc8,
+    0x96, 0x99, 0xe6, 0xf9, 0x03, 0x7b, 0xdb, 0xf3, 0x9e, 0x67, 0x79, 0xbc, 0x5f, 0x66, 0x93, 0x9e,
+    0x64, 0x7f, 0xab, 0xf3, 0x8b, 0x40, 0x67, 0x39, 0xb5, 0xa7, 0x81, 0x65, 0x24, 0x39, 0x60, 0xda,
+    0xf9, 0x83, 0x72, 0xe5, 0xf3, 0x6c, 0xcf, 0x3b, 0x74, 0x99, 0x39, 0x7c, 0xde, 0x8e, 0x64, 0x65,
+    0x77, 0x26, 0x71, 0xeb, 0x98, 0xf5, 0xe4, 0xc2, 0x8f, 0x32, 0xba, 0x59, 0xe7, 0x2f, 0xb3, 0x9c,
+    0x9e, 0xfb, 0x67, 0xcc, 0xfc, 0xd7, 0x45, 0x91, 0x1c, 0x98, 0x56, 0xe0, 0x2e, 0x67, 0x64, 0x83,
+    0x2c, 0x5c, 0x92, 0xcd, 0xf0, 0xce, 0xda, 0xf8, 0x78, 0x8b, 0x4e, 0x59, 0x1c, 0xd0, 0xc9, 0x6c,
+    0xe1, 0x3d, 0x8e, 0x5c, 0x90, 0x5d, 0x92, 0xf8, 0xf8, 0xd7, 0x79, 0xe7, 0x75, 0xce, 0x14, 0x99,
+    0x2f, 0x61, 0xe0, 0x37, 0x32, 0xdb, 0x23, 0x38, 0x59, 0xaf, 0x26, 0x07, 0xa5, 0x99, 0xcc, 0x2e,
+    0xa7, 0x25, 0xb7, 0x38, 0xe1, 0xb9, 0xb9, 0x12, 0xf2, 0xc7, 0x25, 0x4f, 0x25, 0xf6, 0xcf, 0x91,
+    0x00, 0x2c, 0x87, 0xae, 0x7e, 0x06, 0xdb, 0xe3, 0x30, 0xdc, 0xb9, 0x27, 0x4c, 0xc6, 0xf7, 0x0c,
+    0xb9, 0xbc, 0x73, 0x25, 0xd6, 0xe7, 0x93, 0x42, 0x72, 0xe9, 0xb0, 0xe4, 0x02, 0xf0, 0xd9, 0x71,
+    0x67, 0x24, 0xb6, 0x6c, 0xae, 0x73, 0x2c, 0x0e, 0x8e, 0x19, 0x43, 0x33, 0x62, 0xe2, 0xa7, 0x39,
+    0x66, 0xb1, 0xc4, 0x2b, 0xc7, 0x36, 0xe7, 0x27, 0x2e, 0x75, 0xf6, 0x19, 0xc0, 0xe6, 0x5e, 0xfa,
+    0xf9, 0xe5, 0x88, 0x02, 0x06, 0x01, 0xc6, 0xef, 0x73, 0x3e, 0x27, 0xb8, 0x73, 0x1d, 0x58, 0xcb,
+    0x39, 0x7c, 0x33, 0x6d, 0x99, 0x4b, 0xe2, 0x8f, 0x29, 0xc9, 0xcd, 0xbd, 0xef, 0xc7, 0xc8, 0xa3,
+    0x2e, 0x64, 0x2c, 0xf5, 0x3c, 0xe1, 0xb4, 0x79, 0x33, 0x0d, 0x78, 0x96, 0xd9, 0x92, 0x16, 0x0f,
+    0x2e, 0x39, 0xea, 0xf9, 0x9c, 0xf4, 0x4d, 0xe4, 0xca, 0x18, 0x83, 0x8b, 0x48, 0xe1, 0xd7, 0xe6,
+    0x79, 0xa2, 0x9a, 0x8e, 0x13, 0xc2, 0x5e, 0xf1, 0x88, 0x03, 0x04, 0xb2, 0x72, 0x2d, 0x1c, 0x80,
+    0xd9, 0x90, 0x6e, 0x56, 0xf2, 0x44, 0xc5, 0x88, 0xc2, 0x4d, 0x78, 0x4e, 0x8f, 0x82, 0x60, 0x3b,
+    0x2c, 0x21, 0x0a, 0x7e, 0x66, 0xb5, 0x5f, 0x30, 0xda, 0xc3, 0x3c, 0x2f, 0xa9, 0xc9, 0x0b, 0xe2,
+    0x96, 0x5e, 0x6e, 0x30, 0x67, 0x0b, 0xa6, 0x72, 0x7e, 0xb3, 0xc4, 0x24, 0x63, 0xab, 0x32, 0x79,
+    0x42, 0x99, 0x36, 0xef, 0x26, 0x37, 0x24, 0x9a, 0x66, 0xc4, 0x8b, 0x73, 0xc9, 0x2a, 0xca, 0x11,
+    0x33, 0x63, 0x1f, 0x1e, 0x17, 0x69, 0x90, 0x6f, 0xe0, 0x3a, 0x0e, 0x19, 0x7b, 0xe2, 0x72, 0x2e,
+    0x98, 0xe4, 0xdc, 0x74, 0xf1, 0xc3, 0x61, 0x94, 0x48, 0x45, 0xb3, 0x30, 0x8d, 0x62, 0xb3, 0x3c,
+    0xd2, 0xdc, 0x9c, 0x49, 0x75, 0x78, 0xf3, 0xca, 0xfd, 0x93, 0xe0, 0xe9, 0x70, 0xc5, 0x72, 0x10,
+    0xd8, 0x58, 0x5f, 0x1e, 0x22, 0xc2, 0xa7, 0x8d, 0x97, 0x94, 0xcd, 0x92, 0x73, 0x6d, 0x30, 0xe1,
+    0x12, 0xd8, 0x4a, 0xf9, 0x93, 0xd7, 0x7c, 0xe7, 0x9e, 0xb6, 0x12, 0xe6, 0x0f, 0x4c, 0xf3, 0x53,
+    0x21, 0xab, 0xe0, 0x0c, 0x09, 0x50, 0xb3, 0x97, 0x0b, 0x24, 0x95, 0xb0, 0x89, 0x0a, 0x70, 0x64,
+    0x96, 0x8c, 0x78, 0x47, 0x49, 0x92, 0xcb, 0x23, 0x2b, 0x26, 0x09, 0xb1, 0x27, 0x32, 0xd5, 0x24,
+    0x9b, 0xe5, 0x13, 0x81, 0x6e, 0x38, 0x80, 0xc5, 0xc8, 0x05, 0xcd, 0xf1, 0x34, 0x21, 0xe3, 0x1d,
+    0x49, 0x92, 0x89, 0x32, 0xb4, 0xe3, 0xcd, 0xc0, 0x92, 0xca, 0xe5, 0xa9, 0xe6, 0x44, 0xd9, 0x4e,
+    0x24, 0x36, 0x1c, 0x61, 0x4d, 0xcc, 0x9b, 0xa1, 0xfe, 0x46, 0xfb, 0xc2, 0x50, 0x64, 0x39, 0xa5,
+    0xcd, 0xf9, 0x1a, 0x0f, 0x17, 0x70, 0xc9, 0xab, 0x92, 0x62, 0x55, 0xcc, 0xab, 0x98, 0xdb, 0x93,
+    0x32, 0xec, 0xd9, 0xc5, 0x2f, 0x26, 0x07, 0xa6, 0xf3, 0x38, 0x36, 0x58, 0xc2, 0xc3, 0x81, 0x5b,
+    0xc9, 0x0d, 0x71, 0xce, 0xcc, 0x92, 0xcd, 0xf9, 0xb9, 0xd8, 0xe4, 0x8d, 0x96, 0x18, 0x45, 0x70,
+    0x3b, 0xcb, 0x31, 0x8d, 0x39, 0x10, 0x50, 0x8c, 0xc0, 0xa5, 0x73, 0x06, 0x9c, 0x43, 0x08, 0xed,
+    0xe5, 0xcb, 0x93, 0x36, 0xbc, 0xe2, 0x75, 0xc2, 0x04, 0x10, 0x91, 0xd7, 0x9c, 0x36, 0x98, 0x60,
+    0xb4, 0x0c, 0x8c, 0xdc, 0xc6, 0x5b, 0x09, 0x78, 0x45, 0xb1, 0xce, 0x33, 0x52, 0x32, 0x47, 0xb1,
+    0xe1, 0xcb, 0xb8, 0xe6, 0x1d, 0xb8, 0xe4, 0x1a, 0x1c, 0x80, 0x2a, 0xc7, 0x21, 0x34, 0xc8, 0xb5,
+    0xc7, 0x82, 0x39, 0x14, 0x70, 0xb1, 0x86, 0x36, 0x9c, 0xe5, 0x9b, 0x8a, 0x10, 0x5c, 0x20, 0x50,
+    0x16, 0x66, 0x05, 0x12, 0x11, 0x14, 0x86, 0x42, 0x5b, 0x4e, 0x79, 0x2a, 0xa8, 0x0c, 0x24, 0x92,
+    0xbb, 0x29, 0x99, 0x31, 0x44, 0x15, 0x8c, 0xe6, 0x0b, 0x1b, 0x30, 0x29, 0x25, 0x56, 0x40, 0x30,
+    0x62, 0x4a, 0x44, 0x61, 0x91, 0x0a, 0x4e, 0x45, 0xb4, 0xc1, 0x59, 0x31, 0x8b, 0x24, 0xe5, 0xb5,
+    0x64, 0x11, 0x93, 0x08, 0x16, 0x18, 0xcb, 0x42, 0x65, 0xd4, 0xcf, 0x22, 0x22, 0x28, 0x41, 0xb3,
+    0x3e, 0x72, 0xee, 0xa4, 0xcc, 0x87, 0x77, 0x24, 0xad, 0x09, 0xc2, 0x64, 0x07, 0xb4, 0xce, 0x41,
+    0xb6, 0xc9, 0xc1, 0x2a, 0xe1, 0x92, 0x48, 0x6d, 0x5c, 0xc6, 0x4c, 0xc7, 0xdf, 0x6c, 0x9c, 0xe4,
+    0x25, 0x02, 0x86, 0x60, 0xd4, 0x0c, 0x2a, 0xc2, 0x12, 0x99, 0x22, 0x6c, 0xcf, 0x31, 0xde, 0x81,
+    0x26, 0xd4, 0xe6, 0x45, 0x32, 0x43, 0x5b, 0x98, 0x4a, 0x58, 0x0e, 0x4c, 0xc1, 0xdb, 0x72, 0x65,
+    0xac, 0x48, 0x49, 0xc4, 0xa6, 0x02, 0xd8, 0x42, 0x05, 0xa3, 0x99, 0x1b, 0x73, 0xcf, 0x20, 0xbb,
+    0xda, 0x18, 0x13, 0x09, 0x54, 0x98, 0x30, 0x92, 0xed, 0x32, 0x4c, 0x94, 0x61, 0x2a, 0x04, 0xc3,
+    0x56, 0x48, 0x47, 0x18, 0x55, 0x19, 0x99, 0x82, 0x53, 0x57, 0x39, 0xc3, 0x76, 0xc1, 0x27, 0x39,
+    0x25, 0xee, 0xdc, 0xe7, 0x01, 0x26, 0x36, 0xcc, 0x8a, 0x88, 0x46, 0x30, 0x18, 0xca, 0x10, 0x47,
+    0x21, 0x00, 0x19, 0x88, 0xe1, 0x5b, 0x49, 0xf3, 0x0d, 0xa9, 0x20, 0xb2, 0x41, 0x84, 0x2b, 0x49,
+    0x0c, 0x18, 0xca, 0x06, 0x48, 0x68, 0x61, 0x69, 0x33, 0x23, 0x6e, 0xa6, 0x4e, 0x22, 0x26, 0x41,
+    0x49, 0x99, 0x81, 0xdd, 0xea, 0x67, 0x3c, 0x86, 0x88, 0x64, 0xb6, 0x96, 0x4c, 0xc0, 0x80, 0x8a,
+    0x13, 0x0a, 0xd0, 0x99, 0x86, 0x0a, 0x36, 0xb2, 0x04, 0xe4, 0x5b, 0x01, 0x04, 0x32, 0x48, 0x50,
+    0x31, 0xab, 0x92, 0x0e, 0x82, 0x00, 0x49, 0xc2, 0x44, 0xb5, 0x30, 0xc9, 0x6d, 0x33, 0x80, 0x08,
+    0x2d, 0x0c, 0x91, 0x4c, 0x4b, 0x24, 0x88, 0x2d, 0xbc, 0xe6, 0x02, 0x96, 0x30, 0x61, 0x18, 0x04,
+    0xa5, 0x19, 0x08, 0x0c, 0x61, 0x82, 0xe9, 0x9c, 0xc8, 0xf5, 0x02, 0x23, 0x36, 0x4c, 0x23, 0x8c,
+    0x81, 0x55, 0x90, 0x82, 0x59, 0x92, 0x55, 0x07, 0x23, 0xab, 0x33, 0x26, 0x25, 0x66, 0x64, 0xde,
+    0xa4, 0x99, 0x31, 0xac, 0xc3, 0x54, 0xe1, 0x56, 0x08, 0x4e, 0x49, 0x56, 0xe6, 0x61, 0xae, 0xcf,
+    0x32, 0x25, 0x72, 0x4d, 0xd4, 0x43, 0x99, 0x96, 0xd2, 0x67, 0x17, 0x4c, 0xc2, 0x14, 0x02, 0x28,
+    0xc7, 0x20, 0x1d, 0xd3, 0xf6, 0xd7, 0x6e, 0xd7, 0xe7, 0x8e, 0x6b, 0xda, 0xfb, 0x8f, 0xf6, 0xf2,
+    0xfa, 0x64, 0xdb, 0x6e, 0xf9, 0x7e, 0x2f, 0x67, 0x7f, 0x4f, 0xdf, 0x99, 0x7a, 0xee, 0x7b, 0xcd,
+    0xcb, 0xab, 0x6f, 0x60, 0xbd, 0x6e, 0x9e, 0x50, 0x76, 0x7e, 0xcd, 0xc6, 0x57, 0xdb, 0x60, 0xb4,
+    0xcd, 0x98, 0xee, 0xa0, 0xcb, 0xcf, 0x1e, 0x29, 0x6c, 0xfa, 0x9f, 0xbc, 0xbb, 0x62, 0x35, 0x71,
+    0xb7, 0x89, 0x9a, 0xe6, 0xd5, 0x9a, 0xd0, 0x56, 0x7b, 0xca, 0xfb, 0x6f, 0x3b, 0xa7, 0xb7, 0xbe,
+    0x99, 0xed, 0x6e, 0x32, 0x2b, 0xdb, 0xd5, 0xdb, 0xb5, 0x86, 0xf1, 0x61, 0xf7, 0xd6, 0xde, 0xdb,
+    0x09, 0x5a, 0x2d, 0xbf, 0x2b, 0x9a, 0xbb, 0x7b, 0xdb, 0x39, 0xda, 0xd1, 0xbc, 0xd7, 0x56, 0xed,
+    0xbf, 0x13, 0xb4, 0x35, 0xab, 0x7b, 0x3b, 0xeb, 0xdb, 0xc2, 0x7b, 0xce, 0x75, 0x31, 0x8c, 0x6e,
+    0xbb, 0xb7, 0xbf, 0xdf, 0x9d, 0xd9, 0xdf, 0x4f, 0x6f, 0x18, 0xbe, 0xb6, 0xcd, 0xd9, 0xea, 0xe6,
+    0xdb, 0x2a, 0xe5, 0xb7, 0xfb, 0xdb, 0xee, 0xe7, 0xef, 0x79, 0xf5, 0x76, 0x0e, 0xdb, 0x33, 0x5f,
+    0x75, 0xbf, 0x6f, 0xf3, 0xd7, 0x75, 0xf0, 0xf3, 0xce, 0xb3, 0x7e, 0x3b, 0xbe, 0xde, 0xcd, 0x68,
+    0xd8, 0x87, 0x76, 0xde, 0xb2, 0xea, 0x7b, 0xde, 0xd6, 0x57, 0x5b, 0xd9, 0x72, 0xf4, 0xa7, 0xbd,
+    0xbd, 0x75, 0x0d, 0x2f, 0x78, 0xb8, 0xcc, 0x53, 0x5b, 0x2a, 0xf6, 0x21, 0xac, 0xdd, 0x4c, 0x76,
+    0xde, 0xf6, 0xaa, 0xec, 0xbd, 0x16, 0x6d, 0x2f, 0xc0, 0x3a, 0xd2, 0xb3, 0x6f, 0x37, 0x46, 0xb9,
+    0x37, 0xed, 0x57, 0x3f, 0x3d, 0x8f, 0x77, 0xce, 0x97, 0xb7, 0x9b, 0x55, 0x6b, 0xc9, 0xcb, 0x79,
+    0xe1, 0x3b, 0x4d, 0x2f, 0x63, 0x98, 0xc5, 0xcf, 0x35, 0xcc, 0xde, 0x55, 0xb7, 0x93, 0xb8, 0xdb,
+    0x78, 0xee, 0xe3, 0x0b, 0x67, 0xe3, 0x57, 0x59, 0xb7, 0x6f, 0x6c, 0xbb, 0xb6, 0xf7, 0x77, 0xf6,
+    0x7e, 0xdb, 0x96, 0xf6, 0x77, 0x5b, 0xdb, 0xd7, 0x2a, 0xf7, 0xb1, 0x77, 0x5e, 0xdf, 0xbd, 0x21,
+    0xdd, 0x37, 0xed, 0xba, 0xee, 0xdb, 0x7b, 0x6e, 0xe8, 0xbf, 0x6d, 0xee, 0x2a, 0x9a, 0xcf, 0x6d,
+    0x77, 0x31, 0x6d, 0xbd, 0x55, 0xa6, 0x6d, 0xaa, 0x91, 0xf9, 0xa9, 0xd7, 0xbd, 0xbb, 0xad, 0xe6,
+    0x89, 0x9b, 0x67, 0x56, 0xda, 0x96, 0xb0, 0xad, 0xb2, 0x8d, 0x26, 0xde, 0xca, 0xa6, 0xeb, 0xdb,
+    0xde, 0xae, 0xe7, 0x84, 0x0a, 0x3d, 0x99, 0x49, 0x78, 0x87, 0xb6, 0xb5, 0x27, 0x26, 0xf6, 0x70,
+    0x66, 0xf1, 0xdc, 0x8d, 0x9b, 0x7a, 0xef, 0xac, 0x63, 0xd9, 0xea, 0xeb, 0x67, 0x46, 0x78, 0xb8,
+    0x79, 0xb7, 0x6e, 0xda, 0xd6, 0x85, 0x66, 0xf2, 0x2d, 0x6b, 0x43, 0x29, 0xc6, 0xcd, 0xbc, 0xbe,
+    0x8d, 0xbd, 0x94, 0xe0, 0x6d, 0xa4, 0xd4, 0x0b, 0x0d, 0x8c, 0xdc, 0xa5, 0xe1, 0x63, 0x2b, 0x61,
+    0xf7, 0x36, 0xc7, 0xef, 0x17, 0x05, 0xda, 0xc6, 0x5a, 0x6d, 0xab, 0xb6, 0x13, 0xc9, 0x69, 0x79,
+    0xea, 0xd9, 0xba, 0xa0, 0xf7, 0x94, 0xde, 0x2e, 0xbb, 0x64, 0x8d, 0xef, 0x26, 0xb2, 0xa7, 0x3d,
+    0xb0, 0xc4, 0x25, 0xdd, 0xbf, 0x7b, 0xc7, 0xd1, 0x1b, 0xf6, 0x7d, 0x59, 0xa5, 0xe7, 0x83, 0xb2,
+    0xb3, 0xd5, 0xcd, 0xb3, 0x87, 0xa9, 0x6d, 0xa3, 0x2a, 0xdb, 0xda, 0x77, 0x37, 0xa3, 0x6b, 0xbb,
+    0x67, 0xac, 0x05, 0x5d, 0xb7, 0xec, 0xd2, 0x4a, 0x9b, 0x6d, 0xad, 0x46, 0xda, 0xe5, 0x4b, 0xdb,
+    0x79, 0xba, 0xaf, 0x6d, 0xd4, 0xdb, 0x68, 0xa0, 0xcd, 0xb7, 0x2b, 0x4f, 0x09, 0x6a, 0xbc, 0xf4,
+    0xc2, 0xd4, 0xd6, 0x46, 0xcd, 0xaa, 0x89, 0x98, 0xc5, 0xbb, 0x71, 0xed, 0xa8, 0xf0, 0xa9, 0x5b,
+    0x67, 0x8e, 0x46, 0xb3, 0x76, 0x06, 0x89, 0x9e, 0x92, 0xcb, 0x2c, 0xdb, 0x96, 0x16, 0xb2, 0xda,
+    0x68, 0xec, 0x78, 0xc9, 0x5a, 0xc2, 0xd1, 0xad, 0x9b, 0xb4, 0x05, 0xa6, 0xb1, 0x87, 0x2d, 0x99,
+    0x0c, 0x24, 0xcd, 0x2c, 0x8d, 0x6b, 0xc8, 0x60, 0xa3, 0x5e, 0x9a, 0x34, 0x02, 0x5b, 0x35, 0xa4,
+    0x6c, 0x26, 0x28, 0xcc, 0x51, 0x8d, 0x5a, 0xda, 0xdd, 0x96, 0xb5, 0xb5, 0xa0, 0xc5, 0xbb, 0x58,
+    0x58, 0x69, 0x35, 0x8d, 0x65, 0xab, 0x26, 0x5b, 0x5a, 0x6e, 0xc0, 0x34, 0x2f, 0x45, 0x80, 0x05,
+    0x8d, 0x00, 0xb6, 0x81, 0x60, 0x68, 0xd6, 0x8b, 0x2c, 0xb3, 0x59, 0x5a, 0xd6, 0xb3, 0x5a, 0x68,
+    0x58, 0x01, 0x00, 0x13, 0x00, 0x60, 0x80, 0x00, 0x0c, 0x22, 0x03, 0x02, 0x30, 0x01, 0x84, 0x01,
+    0x84, 0x80, 0xc0, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9,
+    0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x80,
 };
 
 #endif // CLAP_SAMPLE_H
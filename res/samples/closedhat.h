@@ -3,4462 +3,788 @@
 
 #include <stdint.h>
 
+// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).
 const int closedhat_sample_len = 44538;
-const int16_t closedhat_sample[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, -1, 0, 0, 0, 2, 5, 5, -3, -25, 
-    -60, -81, -13, 243, 514, 190, -855, -1167, 397, 1605, 
-    -139, -2074, -127, 2936, 1849, -2016, -3140, -82, 2682, 1174, 
-    -2198, -2669, 654, 3692, 1983, -736, -336, -1657, -3339, -831, 
-    461, 1005, 3788, 2504, -2511, -4932, -1319, 6492, 5829, -5683, 
-    -7050, 3438, 4668, -194, -2382, -3807, 979, 2343, 1182, 2676, 
-    -5153, -4292, 5189, 2555, 276, -1183, -2151, -2845, -2962, 5650, 
-    6675, -1665, -3734, -628, -385, -2805, 2043, 3229, -2101, -708, 
-    5106, 3560, -6639, -6260, 2154, -137, -1372, 3348, 4366, 2272, 
-    -993, -1957, -660, -4010, -4583, 2962, 6974, -311, -2817, 2978, 
-    -2118, -4839, 2146, 2387, 1686, 640, -1097, -2139, -809, -139, 
-    -4996, 126, 8819, 5396, 168, -2394, -4095, -4800, -3923, -1889, 
-    1947, 7107, 5532, -624, -2499, -3361, -4507, 175, 6432, 3143, 
-    -4706, -4185, -749, 5560, 8469, -39, -2740, -2892, -5784, -460, 
-    3762, -1469, -6575, 3662, 11290, -183, -5895, -4636, -4452, 1696, 
-    3804, 2397, 3868, 1651, -5812, -4207, 3063, 2601, 99, -137, 
-    301, 1460, -1490, -5120, 399, 5286, -744, -4656, -3959, -1845, 
-    2834, 6802, 3531, -4352, -959, 5985, 1017, -4660, 45, -69, 
-    -491, 233, -4813, -3450, 7192, 8481, -2008, -4705, -1187, 2695, 
-    -1000, -5774, -2075, 2868, 4841, -3195, -4576, 5403, 4619, -310, 
-    -3813, -203, -1302, -3386, 5878, 7639, -2992, -8005, -4166, 346, 
-    3573, 2654, -1310, 2116, 2689, -2899, -3393, 134, 1881, 4832, 
-    2843, -2216, -3347, -6731, -1343, 7346, 2495, -3708, -4242, 1720, 
-    4536, -2780, -4395, 3645, 4848, -883, -979, -2772, -3662, 1959, 
-    4892, 5251, 603, -1699, -5531, -6257, 2232, 2096, 3057, 2994, 
-    -1127, -2484, -2180, 473, 2369, 1791, -2276, -1678, 619, -3765, 
-    -2053, 1199, 4141, 5407, 1103, -920, -4047, -3753, -2854, 2256, 
-    7220, 720, -3051, -5655, 2100, 4865, -5928, -194, 2970, 1945, 
-    3224, -2654, -239, 286, -2022, 47, -1680, 818, 2968, -3129, 
-    -3524, 1733, 2546, 192, -666, -563, 1150, 2296, -803, 864, 
-    -258, -8453, 472, 9186, 1105, -4543, -3418, 1622, 3243, 643, 
-    1188, -799, -2583, 1758, -119, -1836, -834, 1638, 2093, -5490, 
-    -1923, 6830, 1527, -4056, -1015, 2975, 1111, -5106, -153, 4266, 
-    -1411, -1969, -45, 1558, -917, -5550, 2427, 9288, 4648, -2059, 
-    -1708, -2931, -4333, -4170, -2053, 7219, 7685, -380, -8354, -6108, 
-    5188, 4367, 301, -1794, -4442, 1318, 7285, 388, -6392, -114, 
-    -824, -1469, 4095, -831, -2518, 2801, 4229, 1636, -4769, -4746, 
-    482, 1371, 598, 354, 2666, 4099, -2798, -4907, 353, 351, 
-    4298, 4782, -5788, -3977, 2939, -509, -3864, -2160, 3846, 5553, 
-    -394, -2225, -51, 209, -2194, -749, 3580, -296, -2644, -1722, 
-    -1227, 937, 2206, 1864, -723, -518, 864, 340, 1150, -528, 
-    -496, -2642, -2291, 1269, 2403, 3094, 1172, -3418, -3336, 3108, 
-    3255, -3086, -224, 3001, -3337, -3862, -738, 2560, 1534, 762, 
-    3754, -3307, -2638, 3524, -1340, 182, 2949, 1277, -3438, -5852, 
-    -806, 2912, 546, -2513, 3368, 6552, -1061, -442, 2444, -7731, 
-    -6942, 5025, 3919, 1548, -644, -3491, 172, 1126, 3207, 664, 
-    -5040, -4064, 3748, 5401, -1929, -177, 1219, -2489, -2495, -2596, 
-    2516, 3464, 2841, 895, -2805, 1322, 1729, -4991, -5656, -559, 
-    3106, 2089, 995, 1002, 0, 222, 1543, -2718, -1095, 3310, 
-    -1443, -2717, -507, 652, 182, -888, 2603, -638, 222, 5120, 
-    2385, -3648, -6598, -1616, 1698, 1988, 976, 25, 4560, -2602, 
-    -4683, 3164, 3640, 208, -2662, -909, 2148, 299, -1923, -713, 
-    -113, -2600, -369, 1214, -854, 2841, 275, -3555, 3884, 3317, 
-    -3923, -5047, -1008, 5089, 2691, -2139, -3086, -1336, 4172, 3886, 
-    -2679, -2267, 1485, -1445, -3747, 1788, 6531, 239, -4497, -6, 
-    2171, 823, 1128, 1534, -2450, -4936, -1951, 136, 3520, 1752, 
-    1365, -754, -2217, -3050, 118, 4294, -1237, 1351, 1289, -1165, 
-    3647, -4576, -4376, 1598, 2375, 2364, -2109, -1200, 217, 1017, 
-    1766, -1709, 480, 3814, 1184, -4110, -1782, -1463, -3777, 4083, 
-    4212, -911, -365, -1168, 1351, -54, -1088, -1311, -1411, 745, 
-    320, 359, -1939, 467, 4586, 1244, 1019, -2376, 937, -518, 
-    -4419, 1822, 2747, -2355, -4762, -927, 3330, 2407, 2100, 235, 
-    -3922, -4242, 4555, 3363, -1605, 7, 401, 300, -4747, -2303, 
-    4478, 2215, 1999, -1275, -3101, -449, 1199, 1767, 2126, -1542, 
-    -2601, 2671, -371, -1652, -2759, -2649, 5759, 1127, -4975, -220, 
-    5618, 2120, -3052, 540, -3275, -3867, 158, 4986, 6078, -1469, 
-    -682, -2240, -3818, 819, -676, 2429, 2571, 645, 758, -4264, 
-    -2345, 1522, 1712, 2345, 1039, -1930, -3387, -1158, 1532, 2435, 
-    -982, -1939, 1009, -63, 1876, 919, -3356, -69, 1391, -1246, 
-    -3414, -840, 4833, 3379, 619, -3132, -3079, -665, 406, 2913, 
-    1969, 376, 857, -137, -1163, -76, 211, -775, -482, 420, 
-    -332, -2999, -1535, 1308, 1643, 1084, -1302, -83, 50, 1438, 
-    3705, -1149, -3012, -73, -567, -1515, -654, 1890, 3305, 1718, 
-    -1944, -5246, -1391, 4852, 661, -1659, -192, -2656, -1495, 3609, 
-    6638, 745, -5272, -3346, -200, 1250, -1733, -274, 3767, 2772, 
-    2308, -1594, -2150, 1064, -4018, -5779, 1591, 6782, 3538, -648, 
-    -3119, -2754, -2329, 554, 6598, 890, -2713, 1057, 1347, -128, 
-    -5849, -3896, 3630, 2344, 564, 558, 1155, 1264, -1820, -553, 
-    2873, -2875, -4689, 294, 1895, 1608, 1100, -987, -1953, 1516, 
-    897, -2527, 71, 985, 3066, 3077, -1641, -3918, -1711, -125, 
-    -1049, 1766, 2392, 1749, 1638, -4295, -4743, 1123, 3366, 312, 
-    -907, 395, 1055, 2503, -2555, -4327, 889, -503, 1301, 4553, 
-    1055, -1822, -1168, -642, -1424, 131, 1491, 181, 367, 3366, 
-    2053, -4689, -3122, 959, -1264, -699, 1885, 450, 255, 2967, 
-    -574, -4546, -1397, 2680, 3289, -276, -2972, -1966, -1036, 1053, 
-    3011, 2673, 1145, -2365, -3071, 197, -136, 1082, 2199, -527, 
-    -618, 991, 42, -2511, -591, 2197, 389, -1402, -170, 2364, 
-    -339, -3355, -618, 2179, 521, -2159, 1770, 3125, -1263, -2544, 
-    -2817, -78, 1416, 366, 2659, 2765, -1665, -3266, -516, 462, 
-    3997, 3370, -6321, -4462, 2759, 1987, 1120, -403, -1513, -48, 
-    2372, 2150, -2539, -1376, 1461, -2047, -1433, 1350, 182, -604, 
-    5, 956, -311, -9, 1787, -1043, -203, 1076, -2823, -1109, 
-    3885, 1749, -2014, 1037, 1727, -3838, -2336, 1591, 525, 1564, 
-    128, -3597, -845, 2038, 620, -467, 1039, 2406, -263, -1984, 
-    419, 1504, -116, 1266, 579, -2778, -1770, -964, -1582, -1019, 
-    1698, 4579, 985, -1560, 241, 286, -896, 1219, 1936, -4020, 
-    -3514, 1395, -841, 354, 2709, 682, -1474, -1243, 1711, 2660, 
-    -654, -9, 1578, -2267, -2830, -1506, 190, 4356, 333, -2800, 
-    -127, -881, -1699, 2141, 3398, 697, 1833, -65, -3639, -755, 
-    1428, -3, -3930, -1654, 331, 171, 4355, 1855, 86, 833, 
-    -2210, -1069, -141, -2005, 416, 2711, 1782, -860, -4905, -1611, 
-    5747, 2721, -1387, -1564, -4613, -1727, 3362, 3066, 3272, 194, 
-    -3609, -2868, -129, 2526, -64, -921, 602, -1661, 590, 3430, 
-    -251, -3181, 846, 2592, -799, -935, -1610, -648, 454, 465, 
-    1787, 2015, 31, -111, -755, -3292, -218, 223, -3052, 1404, 
-    1529, -28, 1864, 790, -1262, 542, 357, -1436, -216, 450, 
-    312, 137, 1267, -883, -2999, 36, -905, 727, 2432, -90, 
-    1880, 1169, -794, -668, -2040, -1970, 1193, 3035, 1368, -2431, 
-    -4486, -55, 3792, 2748, 7, -3112, -1083, -295, 295, 3272, 
-    1185, -3431, -1565, 2268, -538, -754, 2606, 765, -995, -3230, 
-    -2159, 2220, 2956, 1133, 61, -1304, -1711, 1333, 919, -3394, 
-    -2298, 1615, 2851, 308, -767, 1151, 1786, -630, -2729, -134, 
-    1124, -1094, 716, 1336, -1384, 332, 893, -596, -254, -2174, 
-    -1302, 2966, 3623, -545, -4558, -824, 2694, 1263, 337, -1118, 
-    -3204, -1228, 2576, 1264, 465, 2218, -723, -2677, -529, 2459, 
-    723, -4583, -2003, 2974, 2095, 312, -503, -324, -1547, 146, 
-    3967, -668, -2332, 245, 1173, 607, -937, -375, -196, -767, 
-    -2789, -1854, 3749, 2983, 429, -2221, 411, 2644, -939, -1464, 
-    -1083, 149, 687, -909, -126, -395, -162, 1984, 2255, -1942, 
-    -2250, 324, -412, 2249, 1885, -3091, -1260, 856, 221, 2213, 
-    1916, 226, -2133, -2264, -323, 276, 1923, -1172, -1012, 3808, 
-    -579, -1593, -1537, -63, 190, -2512, 1983, 1991, -1678, -764, 
-    361, 1925, 259, -288, 691, -1922, -497, 3395, 1028, -3720, 
-    -2168, 2013, 967, -701, -1051, -493, 723, 1085, 2809, -656, 
-    -2723, 645, 444, -421, -1057, 106, 1833, 1361, -185, -2460, 
-    -1602, 1140, 1400, 155, 386, 435, -2516, -1678, 1961, 581, 
-    -616, 1341, -272, 818, 2140, -1728, -3438, -1088, 1765, 1675, 
-    100, -1176, 173, 2701, 165, -1737, -478, 924, 18, -1931, 
-    -651, 401, 739, -464, -1317, 1170, 1584, 1734, 629, -1503, 
-    -2533, -2463, 1108, 2551, 536, -1036, 234, 1177, -2720, -1106, 
-    3492, 3180, 323, -2690, -2920, -1694, -824, -795, 2282, 5750, 
-    1916, -1308, -2210, -1369, 382, -2171, -1643, 2329, 3179, 286, 
-    -2985, -1634, -1497, -116, 2807, 1697, 1349, -1270, -1578, 2154, 
-    -909, -1259, 1002, -2179, -2590, 574, 1913, 2035, 1262, -529, 
-    -212, 1604, 303, -2164, -1355, 681, 449, 2470, 1135, -4917, 
-    -3263, 2301, 2495, -708, 461, 2198, -2070, -1948, -865, -433, 
-    2870, 2740, -541, -2230, 597, 1454, -3013, -1673, 1355, 498, 
-    1524, 448, -2187, -1098, 495, 1914, 1876, -1578, -2231, 532, 
-    306, 517, 1866, -785, -1155, -445, 1028, 864, -1466, -53, 
-    1907, 977, -1935, -2688, -224, 2766, 1535, -2455, 1127, 717, 
-    -3258, -35, 2202, 1180, -673, -523, -1012, -1470, 1599, 2479, 
-    169, -1213, -729, -1328, -25, 2202, -956, -1066, 1931, 686, 
-    -1798, -1869, -166, 1705, 2150, -754, -1944, 1796, 1124, -1583, 
-    231, -580, -1836, 478, 569, 774, 1585, 100, -555, 136, 
-    -214, -146, 192, -1712, -1670, -291, 530, 2366, 2323, -183, 
-    -2869, -724, 2214, -1081, -1397, 866, -183, -18, 1523, 1433, 
-    -1254, -1564, 647, 559, 538, -99, -1529, -1244, 100, 1895, 
-    1323, -355, 439, 31, -1642, -1365, -296, 1714, 1982, -571, 
-    -949, -1116, -2000, 9, 2526, 1816, -850, -683, 921, -311, 
-    -1228, -308, -352, -500, 932, 1119, 1400, -142, -2729, 1153, 
-    2801, -1502, -1842, -679, -735, 124, 1393, 826, 187, 1047, 
-    471, -807, -2138, -2782, 98, 2697, 1786, -135, -831, -542, 
-    709, 998, -261, -22, -1723, -1781, 1439, 897, 1139, 499, 
-    -1456, 740, 2275, -397, -3988, -1912, 919, 420, 1910, 2896, 
-    435, -2861, -1171, -70, -1629, 343, 1094, -800, -80, 1922, 
-    798, 349, 1924, 219, -505, -1813, -2257, -195, -865, 474, 
-    2863, 1170, -209, -1770, -1910, 558, 290, -465, 187, 931, 
-    935, -247, 128, -946, -1799, 1451, 1847, 205, 371, -667, 
-    -1673, -231, -553, 1230, 2198, -1724, -1101, 589, -928, -352, 
-    577, 1522, 877, -1385, -736, 743, 443, 250, -874, -783, 
-    510, -95, 535, 349, -754, 415, -163, -589, 1004, 191, 
-    -89, 498, -1384, -1797, 11, 1209, 1497, 106, -726, 757, 
-    1364, -394, -1955, -1354, -568, 683, 1688, 365, 1167, 958, 
-    -2085, -624, 1281, -824, -2191, -283, 1383, 1193, 660, -1086, 
-    -1414, -352, 344, 194, 592, 1631, 410, -114, -221, -1785, 
-    -437, 1379, 744, -12, 418, -390, -1857, -1837, 17, 2094, 
-    1823, 788, -333, -2549, -1385, 1623, -3, -1670, 965, 2694, 
-    1661, -1512, -2569, -173, 1214, 1374, 259, -991, -2080, -1489, 
-    860, 2192, 1285, 266, 688, -1177, -2671, -68, 634, -264, 
-    -217, 145, 971, 1723, -292, -1283, 53, 479, 1261, -176, 
-    -2362, -249, 923, -370, 130, 875, -700, -859, -151, 61, 
-    1637, 1265, -775, -801, -239, -1125, -726, 2059, 1518, -803, 
-    -841, -168, 467, -825, -1282, 787, 1367, 1407, -319, -2140, 
-    -969, 91, 1152, 1527, -551, -631, 1269, 379, -1726, -1219, 
-    888, 1542, -236, -1810, -624, 967, 220, 454, 1182, -1764, 
-    -2169, 2737, 4058, -260, -3742, -2580, 577, 1091, 942, 1073, 
-    -1085, -2392, -563, 1696, 1531, -93, 186, 1692, 324, -763, 
-    -68, -1833, -2306, 111, 988, 622, 399, 851, 83, 108, 
-    1200, -451, -1217, -157, 24, 104, -1607, -2072, 1410, 2720, 
-    952, -167, 199, -723, -1841, -128, 298, -31, 1415, 391, 
-    -1965, -890, 1829, 268, -1567, 613, 793, -164, 58, 712, 
-    953, -947, -548, 651, 143, -1270, -1003, 297, 270, 654, 
-    130, -944, 75, 1568, 1394, -1236, -1470, 3, 665, 446, 
-    -332, -858, -219, 614, 238, 3, -116, 276, 562, -308, 
-    316, -760, -1637, -223, 113, 1869, 2060, -962, -1692, -584, 
-    668, 814, 395, 724, -975, -2273, -135, 1162, 954, 1465, 
-    241, -2075, -947, 613, 154, 476, 257, -705, -135, 263, 
-    395, -65, -1761, -515, 2200, 1943, 585, -871, -1623, -1251, 
-    -965, -243, 916, 1581, 600, -304, 701, 6, -1023, 644, 
-    112, -1810, -385, 1267, 565, -1204, -1565, 371, 723, 340, 
-    1966, 1263, -409, -481, -1808, -1736, 291, 963, 1689, 1107, 
-    -1656, -1699, 777, 785, -1469, -106, 2816, 1164, -1884, -2594, 
-    -1144, 996, 1431, 602, 224, 692, -542, -891, 270, 742, 
-    519, -180, 81, -472, -1157, 255, 139, -511, -24, -580, 
-    -339, 1768, 558, -602, 1021, -78, -1263, -485, -172, 114, 
-    1605, 655, -1618, 203, 1208, -423, -1331, -1338, 707, 880, 
-    -347, 604, 703, 107, -691, -1091, 795, 1087, -113, -813, 
-    -1757, 322, 2286, 202, -889, -938, -465, 131, 953, 2018, 
-    -57, -1543, -473, -208, 363, 636, -93, -776, -101, 392, 
-    -75, -297, -565, -250, 921, 985, -343, -1034, -731, 422, 
-    1845, 434, -651, -449, -1077, -276, 1188, 1402, -582, -2038, 
-    66, 1332, 212, -761, -18, 199, -16, 85, -589, 742, 
-    1679, -305, -1768, -1239, 938, 967, 43, 166, 40, -795, 
-    -2223, -929, 1983, 2813, 1475, -1060, -1515, -619, 30, -114, 
-    -137, 643, 185, -339, -52, -222, -577, -539, 144, 796, 
-    722, 172, 281, -29, -1337, -223, 1604, 644, -636, -1147, 
-    -781, 140, 291, 400, 997, -31, -703, 751, 501, -970, 
-    -667, -324, -1021, 55, 1618, 837, -606, -778, 96, 368, 
-    927, 838, -941, -512, -171, -93, 280, -585, 667, 727, 
-    -889, -444, -1055, -309, 1725, 557, -570, 111, 266, 251, 
-    -22, 125, -491, -1343, -172, 220, 184, 830, 749, 685, 
-    -465, -1674, -412, 1361, 956, -1021, -1054, 439, 217, -220, 
-    286, -72, -731, 411, 739, 318, 334, 58, 303, -621, 
-    -1273, 29, 49, 282, 1000, 211, -723, -339, -471, -816, 
-    149, 1465, 1695, -253, -1202, 541, 451, -1463, -1175, 569, 
-    650, -80, -125, 202, 625, 99, -905, -753, -23, -309, 
-    -174, 1127, 1296, -444, -740, 544, 235, -306, -397, -578, 
-    412, 682, -54, 466, 359, -1009, -1000, -153, 293, 686, 
-    680, 146, -24, 219, -806, -1462, -808, 342, 1990, 1987, 
-    -100, -1616, -1198, 92, 595, 222, -482, 96, 165, -506, 
-    414, 1102, 59, -1255, -1124, -166, 856, 1864, 608, -675, 
-    -596, -919, -406, -82, -384, 355, 557, -245, -231, 858, 
-    770, -195, -125, -423, -1032, 309, 1659, 184, -1301, -626, 
-    137, 403, 352, 653, -130, -1264, -226, 1183, 956, -503, 
-    -1525, -527, 790, 348, -352, 10, 329, 354, 201, -870, 
-    -1383, 660, 1885, 706, -262, -1256, -984, 317, 249, -78, 
-    454, 777, 628, 110, -1046, -1448, -295, 314, 7, 168, 
-    869, 1306, 769, -416, -1357, -1681, -95, 1350, -68, -631, 
-    633, 910, 247, -518, -424, 435, 235, -750, -1005, -9, 
-    1053, 226, -801, 148, 756, -86, -570, -310, 174, 186, 
-    -285, -180, 560, 1130, 343, -939, -442, 99, -117, -204, 
-    -435, -424, 121, 863, 967, 512, -259, -829, -104, -129, 
-    -10, 48, -818, 19, 742, 54, -119, 107, 500, 92, 
-    -469, -166, -390, -676, 66, 874, 915, -322, -1024, 288, 
-    931, -278, -931, 172, 661, -210, -135, 629, 863, -354, 
-    -1288, -241, -17, -234, 481, 898, 311, -652, -950, -224, 
-    542, 518, 84, -595, -1074, -408, 776, 1308, 555, -543, 
-    -938, 193, 1498, 78, -1515, -480, 540, 400, 468, 469, 
-    -632, -967, -69, 533, 208, 15, -186, -423, 670, 715, 
-    -616, -456, -281, -590, 255, 1272, 450, -462, -685, -728, 
-    399, 542, -12, 441, -270, -651, 592, 53, -318, 514, 
-    329, 333, -364, -996, -110, -197, -28, 522, 80, 83, 
-    904, 199, -1123, -637, -277, -746, -165, 1237, 1592, 246, 
-    -251, 50, -746, -1406, -727, 877, 1295, 284, 27, -107, 
-    -219, -40, -307, -38, -79, -592, -243, 291, 521, 943, 
-    786, -341, -1111, -1218, 82, 1141, -72, -709, 50, 812, 
-    557, -438, -487, -388, -214, 194, 559, 1090, 589, -1399, 
-    -1795, -135, 765, 1121, 1280, 208, -850, -1033, -725, -90, 
-    245, 195, -1, -256, 563, 780, -313, -152, -4, -394, 
-    -10, 486, 735, -28, -770, -591, -144, 166, 212, 827, 
-    526, -532, -322, -610, -501, 412, 293, 161, 200, 71, 
-    82, 133, -254, -1045, -357, 842, 838, 97, -709, -381, 
-    328, 127, -52, -542, -575, 709, 978, 257, -380, -691, 
-    -193, 402, 449, 515, -72, -640, -150, -115, -58, 9, 
-    -425, 267, 596, -285, -369, 238, 458, -317, -782, 178, 
-    421, -22, 204, -172, -291, 547, 272, -316, -34, 32, 
-    -107, -37, 220, 104, -433, -128, 201, -43, 213, 358, 
-    -8, 76, 363, -193, -1134, -802, 576, 863, -60, -325, 
-    167, 271, 89, -150, -277, 22, 262, -269, -841, 30, 
-    713, 241, 294, 713, 264, -848, -1540, -509, 908, 746, 
-    512, 256, -458, -39, -108, -986, -469, 806, 930, 41, 
-    -317, -401, -709, -328, 673, 1042, 698, 135, -633, -777, 
-    -544, -483, 171, 696, 780, 818, -3, -1149, -1211, -544, 
-    409, 998, 417, -392, -313, 319, 523, -80, -457, 175, 
-    413, -269, -620, -217, 129, 97, 168, 315, 91, -530, 
-    -511, 563, 1039, 417, -404, -345, -245, -420, -247, 66, 
-    602, 12, -527, 316, 424, 0, -234, -173, -407, -508, 
-    352, 515, 169, -307, -446, 438, 428, -207, -150, 479, 
-    400, -572, -361, 188, -357, -489, 159, 580, 511, 44, 
-    -257, -119, 119, 81, -299, -325, 23, 88, -141, -206, 
-    354, 441, -34, -171, -52, 200, 62, -31, 256, -160, 
-    -426, -60, -148, -187, 121, 330, 542, -10, -613, 216, 
-    650, -495, -828, 51, 70, -10, 349, 145, -460, -110, 
-    849, 298, -362, 244, 0, -830, -481, 478, 97, -75, 
-    483, 157, -168, -133, 89, 203, -325, -245, 171, -77, 
-    -294, 320, 766, 233, -796, -776, 124, 222, 421, 603, 
-    -296, -578, 38, 446, 246, -93, -605, -576, 279, 387, 
-    215, 277, 276, 188, -658, -911, -250, 338, 485, 15, 
-    -113, 117, 2, 176, 423, -271, -756, 162, 660, -85, 
-    -715, -203, 808, 543, -441, -390, 221, 243, -310, -454, 
-    111, 448, 362, 3, -661, -145, 587, -47, -188, 35, 
-    -180, -217, 307, 541, 78, -9, -294, -578, -237, -122, 
-    114, 187, -22, -218, 210, 889, 141, -777, -387, 402, 
-    599, -19, -157, 133, -194, -411, -147, 152, 340, 57, 
-    -268, -158, -17, 119, -14, -294, 57, 470, 460, 241, 
-    -235, -438, -656, -127, 699, 40, -480, -70, 248, 223, 
-    102, -159, -26, 483, -10, -651, -313, 239, 333, -122, 
-    -124, 342, 208, -652, -418, 455, 674, 463, -157, -393, 
-    -488, -325, 607, 296, -500, -448, -112, 438, 332, -16, 
-    -188, -290, 239, 240, -159, -28, 232, 293, -223, -286, 
-    -99, -128, -43, 77, 368, -10, -281, 119, 40, 200, 
-    -43, -289, 282, 160, -159, 93, -162, -278, 135, 94, 
-    -1, -86, -20, 364, -188, -461, 354, 540, -175, -610, 
-    -163, 170, 66, 209, 312, -97, -450, -275, -47, 75, 
-    280, 415, 111, -273, -187, -163, -47, 29, 25, 215, 
-    56, 51, 393, 425, -1, -586, -580, -253, 46, 21, 
-    -62, 186, 325, 489, 352, -40, -468, -806, -170, 436, 
-    430, -179, -711, -137, 663, 729, 28, -455, -154, 202, 
-    150, -446, -483, 53, 371, 463, 161, -15, 113, -531, 
-    -798, 152, 418, 91, 97, 123, 278, 86, 9, -93, 
-    -396, -211, 55, 61, -269, -437, -76, 470, 812, 277, 
-    -496, -405, 149, 185, -317, -297, 187, 144, -86, 136, 
-    352, 111, -74, 170, -141, -593, -8, 442, -27, -105, 
-    199, -186, -302, 99, 296, -139, -376, 226, 305, -90, 
-    22, 32, -221, -106, 207, 29, 49, 133, -225, -341, 
-    92, 259, 4, -36, -30, 0, 18, -21, 24, -62, 
-    -172, 126, 436, 191, -177, -361, -179, 162, -133, -161, 
-    196, 307, 301, -258, -533, -93, 167, 426, 424, 51, 
-    -295, -461, -74, 199, -93, -235, 85, 347, 148, -153, 
-    -256, 84, 406, 66, -111, -423, -738, -125, 634, 690, 
-    262, -311, -721, -425, 434, 694, 241, -84, -311, -390, 
-    198, 200, -313, 76, 506, 82, -705, -589, 359, 747, 
-    355, -377, -306, 261, -161, -575, -142, 405, 495, 98, 
-    -229, -395, -114, 404, 195, -236, -196, -62, 277, 344, 
-    -197, -99, 386, 111, -560, -620, 196, 518, -253, -515, 
-    282, 716, 224, -176, -36, 186, 39, -429, -556, -260, 
-    -63, 213, 281, 290, 558, 62, -339, -163, -456, -192, 
-    97, -58, 313, 237, -82, 395, 494, -354, -744, -88, 
-    239, -169, -87, 127, -66, 123, 148, -147, 38, 277, 
-    414, 158, -766, -996, -10, 625, 498, 243, -27, -123, 
-    -27, -172, -416, -11, 595, 414, -143, -480, -69, 373, 
-    -22, -305, -278, -193, 191, 188, -282, -215, 257, 593, 
-    476, 21, -291, -684, -662, 132, 675, 531, -37, -371, 
-    -336, 42, 385, 208, 196, -66, -410, -115, -185, -70, 
-    337, 199, 89, 5, -348, -505, -176, 265, 309, 238, 
-    162, -76, -185, -118, 156, 392, -87, -463, -210, -86, 
-    54, 360, 392, -17, -429, -213, 229, 325, 29, -360, 
-    -157, 284, 182, 28, 142, 102, -215, -450, -186, 136, 
-    -93, -431, -221, 275, 470, 383, 247, 116, -140, -515, 
-    -405, -14, 3, 329, 579, 59, -241, -225, -249, 149, 
-    493, -72, -681, -314, 80, 130, 275, 288, 267, 86, 
-    -265, -320, -155, 76, 210, 140, -289, -398, 406, 646, 
-    -131, -497, -188, 133, 125, 146, 213, -53, -176, -131, 
-    101, 516, 119, -467, -421, -254, -26, 161, 239, 61, 
-    -25, 260, 56, -458, -307, 88, 138, 160, 253, 278, 
-    63, -338, -298, -286, -235, 346, 448, 135, -10, -202, 
-    -114, 12, -78, 32, 101, -79, -154, -21, 2, -46, 
-    180, 317, 234, 72, -298, -425, -210, 4, 18, 43, 
-    168, 319, 358, -163, -344, -4, -32, 80, -85, -275, 
-    110, 299, 150, -197, -363, -68, 353, 513, 48, -391, 
-    -269, 27, 103, 26, -141, -194, 110, 252, -37, -14, 
-    78, -305, -360, 158, 508, 176, -317, -67, 287, 93, 
-    -174, -316, -120, 251, 167, 1, 68, -159, -221, 113, 
-    172, 20, -72, -42, 0, -86, -21, 164, 153, -57, 
-    -112, -116, -60, 183, 99, -70, 96, -99, -512, -88, 
-    616, 461, 99, -304, -565, -115, 95, -28, 169, 416, 
-    381, -194, -505, -214, -117, 50, 141, -263, -217, 292, 
-    307, 149, 203, 25, -155, -130, -213, -175, 92, 272, 
-    126, 37, 106, -235, -347, 213, 409, -26, -338, -77, 
-    187, -14, -248, -123, 119, 160, 79, -54, -92, 30, 
-    -16, -152, -131, -85, 38, 208, 315, 418, 212, -288, 
-    -601, -442, 146, 340, 134, 292, 250, -263, -264, -59, 
-    -344, -291, 398, 691, 42, -588, -207, 212, 7, -39, 
-    27, -94, -72, 109, 186, 84, 10, 25, -12, -18, 
-    -4, -29, -107, -127, 38, 171, -11, -332, -188, 168, 
-    130, 125, 240, -83, -452, -145, 468, 430, -117, -160, 
-    95, -87, -408, -466, 41, 506, 366, -15, -377, -369, 
-    117, 599, 561, 46, -431, -529, -262, -40, 204, 490, 
-    361, -78, -381, -372, -217, 88, 368, 166, -173, -138, 
-    44, 89, 135, 71, -90, -37, -137, -353, -100, 367, 
-    375, 85, -64, -61, -54, -153, -82, 83, -6, -52, 
-    -41, 81, 237, 122, 14, -110, -307, -129, 180, 103, 
-    -60, -37, -188, -286, 172, 659, 212, -413, -381, -223, 
-    61, 430, 246, -200, -198, 15, 46, -1, -25, 23, 
-    141, 154, 36, 27, -122, -276, 6, -28, -137, 97, 
-    176, 79, -115, -168, 22, 111, 100, 47, 14, 2, 
-    -35, 6, 62, 71, -127, -348, -75, 283, 152, -149, 
-    -124, 94, 73, 55, 202, 147, 7, -81, -160, -190, 
-    -329, -290, 173, 439, 184, -86, -67, -114, -154, 280, 
-    456, -235, -556, -83, 147, 111, 174, 250, 112, -290, 
-    -313, 48, 199, 202, 73, -277, -434, -135, 235, 352, 
-    227, 15, 25, 3, -121, -101, -132, -87, 181, 216, 
-    -92, -133, 40, -207, -514, -251, 297, 483, 174, -32, 
-    134, 85, -135, 41, 146, -160, -403, -160, 115, -3, 
-    -6, 162, 174, 114, 16, 78, 211, -73, -502, -396, 
-    -40, 214, 382, 327, -120, -552, -165, 480, 422, -60, 
-    -288, -158, -88, -44, 109, -54, -218, 140, 355, 21, 
-    -258, -113, 242, 310, 27, -150, -59, -76, -221, -235, 
-    -182, 158, 540, 380, 46, -185, -364, -382, -242, 99, 
-    341, 158, -18, 28, 10, 26, 109, 98, -66, -218, 
-    -171, -13, 179, 170, -9, 25, -1, -170, -208, -83, 
-    188, 185, -52, -39, -9, -56, -51, -115, -51, 228, 
-    346, 151, -149, -244, -130, -192, -269, 25, 388, 387, 
-    31, -239, -60, 213, -135, -497, 65, 558, 255, -173, 
-    -335, -109, 78, -34, 55, 132, -5, -116, -120, 142, 
-    260, -92, -332, 41, 476, 143, -266, -92, 35, -192, 
-    -332, -93, 105, 222, 294, 85, -65, -201, -267, 42, 
-    427, 359, -158, -372, -302, -156, 196, 344, 176, -168, 
-    -374, -226, 161, 518, 357, -186, -453, -152, 158, 124, 
-    98, 35, -82, -261, -268, 87, 345, 357, 140, -202, 
-    -437, -346, 197, 494, 99, -228, 48, 102, -324, -413, 
-    3, 476, 498, 17, -324, -253, -73, 77, 177, 60, 
-    -104, -178, -155, 28, 165, 96, -127, -122, 287, 376, 
-    -13, -291, -245, 34, 158, -69, -124, 56, 87, -2, 
-    -70, -102, -82, 119, 200, 45, 40, 7, -147, -61, 
-    189, 204, -207, -497, -151, 333, 348, -59, -169, 122, 
-    46, -162, 82, 250, -72, -350, -180, 144, 258, 0, 
-    -174, -100, -116, 87, 326, 140, -97, -89, 49, -45, 
-    -190, -103, -53, -82, 99, 264, 168, -21, -103, -16, 
-    -6, -130, -114, -12, 76, 276, 378, -116, -558, -345, 
-    61, 344, 273, 64, -45, -75, -35, -8, -115, -137, 
-    61, 179, 99, -88, -154, -111, -132, 190, 345, 33, 
-    -74, -6, -54, -198, -231, 13, 223, 52, -254, -120, 
-    217, 218, 55, 0, 33, -28, -92, 20, 49, -112, 
-    -220, -69, 130, 262, 326, 71, -237, -296, -38, 202, 
-    32, -116, -185, -190, -13, 176, 150, 9, 132, 307, 
-    108, -292, -493, -337, 64, 521, 519, 6, -404, -458, 
-    -149, 317, 316, -84, -258, -165, -19, 237, 533, 334, 
-    -262, -453, -203, -64, -141, -53, 263, 282, 109, 160, 
-    -40, -421, -255, 119, 167, 132, 83, -117, -179, -33, 
-    144, 260, 31, -275, -275, -17, 227, 298, 189, -14, 
-    -180, -260, -119, 59, -19, -50, -15, -8, 34, 79, 
-    94, 181, 242, 57, -162, -257, -318, -260, -10, 182, 
-    232, 227, 170, 40, -102, -205, -233, -89, 3, -77, 
-    80, 411, 432, -40, -286, -54, -58, -388, -466, -47, 
-    371, 480, 262, -198, -265, -88, 40, 212, 157, -21, 
-    -103, -185, -181, 146, 454, 148, -247, -236, -73, 49, 
-    32, -76, -162, -36, 259, 286, 49, -182, -162, -4, 
-    -111, -275, 26, 373, 155, -79, 30, 40, 21, 31, 
-    -157, -283, -16, 152, -39, -58, 217, 286, -26, -203, 
-    -50, 68, 26, -129, -177, 70, 303, 158, -107, -171, 
-    -164, -112, -27, -12, 77, 199, 159, 30, -97, -200, 
-    -170, 45, 210, 63, -110, -32, 9, 89, 214, -24, 
-    -316, -160, 155, 102, -92, -27, 16, -4, 55, 138, 
-    202, 43, -130, -101, -122, -203, -177, -16, 129, 226, 
-    339, 275, -44, -334, -237, 26, 32, -116, -121, 26, 
-    140, 226, 167, -159, -274, -41, 104, 0, -137, -147, 
-    -54, 189, 385, 187, -184, -296, -134, 64, 115, 68, 
-    3, -36, 36, 144, 123, -81, -292, -216, 66, 162, 
-    41, 94, 118, -105, -169, 80, 298, 66, -318, -282, 
-    24, 284, 184, -197, -243, 66, 182, 69, -55, -132, 
-    -32, 131, 126, -83, -273, -152, 167, 228, 29, -112, 
-    -102, 81, 134, -116, -131, 116, 164, 2, -31, -18, 
-    -167, -180, 16, 86, 36, 174, 416, 253, -247, -430, 
-    -242, -185, -145, 160, 438, 325, -90, -265, -100, 15, 
-    8, 23, 39, -19, -44, -60, -33, 39, 37, 53, 
-    -36, -86, 35, 124, 79, -122, -63, 152, -2, -193, 
-    -66, 133, 153, 54, -135, -77, 173, 173, -15, -167, 
-    -80, 111, 54, -140, -254, -253, -166, 105, 250, 187, 
-    278, 235, -52, -103, -131, -286, -99, 251, 211, -115, 
-    -267, -197, -36, 163, 228, 193, 13, -277, -187, 130, 
-    192, 63, -2, -95, -270, -208, 72, 246, 162, -93, 
-    -70, 233, 278, -10, -334, -352, 20, 291, 138, -169, 
-    -215, 23, 207, 218, 102, -57, -122, -152, -114, 42, 
-    119, 72, 43, 25, -85, -202, -173, -97, -60, 61, 
-    191, 135, 102, 108, -37, -78, -35, -60, -9, -17, 
-    -38, 81, 132, 75, 5, -160, -180, -21, 27, 138, 
-    304, 192, -145, -265, -75, -55, -137, -80, -68, 34, 
-    221, 151, 24, 85, -1, -173, -65, 81, -21, -184, 
-    -132, 100, 192, 16, -110, 62, 209, 17, -300, -315, 
-    111, 410, 151, -186, -157, 56, 130, 64, -24, -78, 
-    10, 36, -138, -193, -54, 96, 155, 109, 139, 199, 
-    14, -258, -275, -72, 40, 13, -17, -6, 51, 138, 
-    179, 52, -131, -187, -167, -104, 2, 216, 311, 82, 
-    -181, -251, -118, 89, 176, 87, -55, -130, -98, 81, 
-    220, 180, 26, -101, -141, -266, -359, -121, 345, 536, 
-    243, -134, -200, -127, -124, -31, 109, 70, -67, -122, 
-    -90, -17, 178, 287, 84, -133, -130, -105, -113, -61, 
-    -11, 129, 324, 220, -68, -166, -156, -137, -2, 94, 
-    71, 71, -62, -220, -32, 186, 106, 11, -11, -158, 
-    -209, 85, 282, 65, -186, -163, -36, 10, 64, 89, 
-    82, 105, 28, -51, 20, 64, -93, -262, -127, 78, 
-    14, -100, 88, 316, 181, -25, -49, -34, -40, -123, 
-    -166, -67, 21, 57, 48, -8, 2, 137, 196, 107, 
-    4, -216, -356, -77, 167, 39, -91, 28, 190, 166, 
-    19, -42, -47, -175, -273, -102, 132, 196, 217, 140, 
-    -133, -326, -183, 156, 301, 158, -8, -44, -37, -147, 
-    -241, -135, 113, 233, 113, -86, -197, -1, 286, 218, 
-    -15, -166, -160, -61, -43, -56, -27, 62, 104, -16, 
-    -88, 28, 172, 98, -113, -139, -77, -147, -81, 280, 
-    500, 206, -232, -297, -163, -137, -80, 112, 278, 217, 
-    -52, -233, -66, 151, 76, -32, -26, -99, -261, -186, 
-    211, 365, 135, -89, -174, -118, 36, 34, -138, -93, 
-    88, 138, 97, 19, -13, -45, -95, -80, 39, 128, 
-    15, -31, 45, 2, -87, -68, -14, -40, -45, 60, 
-    150, 117, -2, -86, -92, -36, 24, 105, 107, 23, 
-    -59, -144, -134, -8, 94, 88, 38, 21, -37, -134, 
-    -96, 151, 200, -105, -228, 11, 225, 145, -68, -124, 
-    -100, -94, -37, 67, 158, 135, -18, -118, -73, 9, 
-    52, 19, -23, -6, -35, -53, 68, 88, -82, -114, 
-    110, 252, 58, -212, -252, -107, 60, 131, 108, 86, 
-    61, -63, -223, -149, 149, 240, 2, -160, 17, 227, 
-    -1, -320, -202, 76, 204, 172, -37, -211, -114, 80, 
-    170, 138, 22, -27, -32, -165, -313, -140, 247, 249, 
-    -58, -82, 101, 152, 142, 64, -156, -294, -181, 32, 
-    139, 47, -71, 61, 270, 153, -138, -154, 15, -32, 
-    -170, -71, 82, 72, 38, -2, -98, -6, 188, 176, 
-    95, -8, -224, -301, -54, 200, 141, -63, -154, -27, 
-    88, -32, -104, 33, 155, 140, 56, -110, -260, -105, 
-    125, 150, 73, -40, -9, 78, 24, -23, -26, -30, 
-    10, 43, -58, -122, -52, -78, -88, 94, 214, 100, 
-    -25, -33, -51, 40, 193, 80, -199, -307, -189, 17, 
-    184, 198, 85, -16, -105, -111, 54, 177, 60, -108, 
-    -129, -91, 1, 54, -1, 35, 129, 78, -116, -201, 
-    -46, 155, 202, 50, -71, -58, -75, -112, -77, 36, 
-    187, 240, 32, -244, -242, -26, 205, 212, 5, -99, 
-    -110, -151, -111, 119, 300, 132, -108, -130, -97, -108, 
-    -52, 123, 245, 80, -203, -198, -16, 28, 20, 32, 
-    83, 113, -14, -76, 44, 21, -137, -85, 85, 66, 
-    -50, -34, 87, 74, -123, -111, 164, 204, -56, -209, 
-    -136, -52, -18, 2, 46, 229, 294, 46, -184, -255, 
-    -182, 42, 169, 113, 28, -82, -152, -15, 159, 103, 
-    -27, -28, -31, -105, -82, 84, 147, 30, -61, -126, 
-    -124, 19, 126, 115, 45, 41, 80, -33, -163, -185, 
-    -155, -4, 197, 207, 0, -153, -62, 127, 165, 51, 
-    -30, -82, -135, -124, -18, 82, 36, -40, -5, 64, 
-    49, 3, 44, -4, -72, 36, 41, -107, -103, 27, 
-    73, 37, -53, -122, 10, 199, 235, 103, -144, -292, 
-    -187, 16, 106, 91, 77, 42, -80, -183, -68, 169, 
-    219, 25, -103, -34, -25, -99, -85, 48, 219, 151, 
-    -134, -276, -130, 154, 295, 134, -106, -165, -85, -40, 
-    -87, -65, 79, 139, 68, -20, 4, 44, -37, -138, 
-    -109, 96, 260, 130, -157, -223, -47, 37, 17, 53, 
-    116, 66, -78, -77, 20, 26, 27, 76, 42, -67, 
-    -120, -108, -23, 153, 200, -34, -234, -122, 77, 109, 
-    52, -14, -93, -46, 60, 29, -35, 10, 37, -96, 
-    -158, 85, 296, 135, -124, -133, -36, -7, 48, 51, 
-    -104, -183, -50, 60, 44, 20, -15, -7, 130, 195, 
-    35, -93, -33, 1, -56, -48, 0, -61, -83, 67, 
-    192, 155, -42, -184, -65, 41, -22, -29, 21, -44, 
-    -158, -76, 213, 313, 87, -106, -72, -16, -112, -218, 
-    -126, 128, 243, 103, -22, -26, -71, -101, 5, 45, 
-    -41, 5, 113, 18, -141, -45, 171, 209, -4, -262, 
-    -235, 13, 208, 272, 141, -168, -382, -239, 126, 305, 
-    137, -100, -141, -54, 28, 61, 50, 61, 86, 43, 
-    -23, -99, -216, -241, -51, 192, 241, 115, -46, -137, 
-    -72, 31, 40, 29, -28, -116, -9, 213, 233, 15, 
-    -206, -253, -108, 155, 281, 129, -116, -192, -68, 27, 
-    -3, -6, 0, -52, 1, 139, 78, -56, 20, 82, 
-    -75, -152, -14, 82, 41, -51, -115, -49, 81, 122, 
-    42, -23, 7, 17, -32, -54, -14, 36, 15, -38, 
-    -49, -30, -17, 16, 97, 120, 58, -12, -73, -61, 
-    23, 25, -78, -117, -63, -11, 14, 72, 127, 72, 
-    13, 15, -50, -130, -100, 22, 64, 10, 26, 58, 
-    0, -19, 14, -90, -150, 83, 233, 74, -49, 7, 
-    -32, -171, -109, 37, 58, 58, 55, 60, 63, -34, 
-    -125, -125, -98, -90, 15, 236, 225, -26, -88, 52, 
-    70, -57, -132, -128, -70, -6, 32, 94, 131, 137, 
-    89, -99, -218, -125, -8, 67, 144, 65, -118, -83, 
-    43, 22, 45, 132, 51, -152, -177, -2, 101, 91, 
-    90, 103, 6, -207, -258, -70, 81, 87, 142, 243, 
-    125, -134, -266, -233, -71, 144, 201, 47, -71, -85, 
-    -75, 32, 166, 132, -77, -195, -40, 79, -60, -86, 
-    127, 160, -54, -202, -127, 74, 183, 130, 23, -15, 
-    -6, -59, -91, 10, 100, 14, -97, -89, -29, 59, 
-    129, 4, -172, -55, 145, 71, -67, -28, 1, -76, 
-    -58, 58, 117, 89, 8, -59, -30, 16, -46, -54, 
-    39, 18, -52, 3, 53, -39, -74, 78, 165, 52, 
-    -82, -81, -19, 0, 45, 84, 12, -68, -54, -13, 
-    -42, -80, -21, 73, 124, 74, -93, -204, -111, 100, 
-    173, 14, -110, -17, 134, 144, 10, -152, -146, 40, 
-    128, 26, -119, -176, -119, 42, 257, 260, -4, -189, 
-    -123, 38, 90, 11, -75, -114, -95, 22, 116, 43, 
-    -24, 90, 192, 74, -116, -117, -25, -73, -98, 83, 
-    176, -39, -189, -19, 109, 40, 21, 61, 8, -91, 
-    -108, -50, 6, 59, 78, 9, -17, 41, 44, 15, 
-    12, -52, -163, -127, 84, 191, 34, -144, -90, 106, 
-    192, 66, -124, -165, -70, 41, 116, 76, -65, -131, 
-    -19, 128, 93, -94, -198, -58, 191, 236, 43, -127, 
-    -111, -19, -43, -80, 8, 78, 36, 15, 78, 54, 
-    -101, -121, 51, 153, 60, -21, 10, -38, -154, -123, 
-    40, 150, 48, -167, -147, 111, 224, 79, -110, -186, 
-    -111, 109, 266, 92, -171, -139, -13, -25, -35, -13, 
-    45, 212, 290, 45, -341, -434, -87, 285, 253, 1, 
-    -103, -75, -70, -26, 103, 148, 70, -54, -155, -81, 
-    101, 118, -59, -160, -26, 122, 48, -50, 29, 84, 
-    -6, -39, 25, -6, -97, -58, 72, 94, -24, -96, 
-    -31, 31, 23, 56, 66, -74, -154, -6, 141, 79, 
-    -33, -27, -16, -77, -69, 45, 83, 34, 50, 31, 
-    -92, -80, 44, 20, -127, -142, 74, 259, 163, -103, 
-    -241, -134, 38, 135, 150, 36, -102, -84, -48, -71, 
-    31, 175, 169, 73, -65, -178, -150, -22, 103, 103, 
-    -52, -112, 3, 92, 79, -2, -33, -4, -47, -102, 
-    -16, 120, 110, -7, -86, -95, -15, 97, 104, 15, 
-    -1, 30, -81, -235, -142, 115, 198, 85, -11, -13, 
-    -5, -2, 21, -33, -95, -42, 15, 26, 52, 78, 
-    24, -103, -129, 23, 171, 90, -88, -100, -55, -76, 
-    -49, 17, 70, 165, 167, -56, -233, -144, 81, 205, 
-    88, -107, -143, -21, 142, 156, -17, -117, -68, -37, 
-    -37, -6, 22, 72, 122, 8, -174, -134, 72, 148, 
-    12, -120, -71, 68, 118, 0, -161, -128, 77, 197, 
-    119, -42, -127, -81, 26, 96, 76, -8, -60, -43, 
-    -13, -22, -15, 54, 79, 3, -69, -47, -8, -14, 
-    15, 28, -14, -4, 8, -28, -13, 45, 49, 51, 
-    79, 3, -138, -147, -13, 78, 57, 5, -43, -47, 
-    -14, -9, -25, 18, 106, 140, 116, 28, -157, -276, 
-    -187, 31, 211, 185, -7, -102, -57, -30, 39, 156, 
-    98, -68, -98, -16, 43, -12, -107, -87, 6, 63, 
-    56, 21, 2, -19, 31, 108, 5, -110, -7, 67, 
-    -64, -149, 5, 137, -1, -131, -35, 31, -19, 43, 
-    173, 123, -69, -173, -98, 59, 146, 100, -23, -141, 
-    -141, 17, 105, 6, -20, 76, 56, -48, -69, -12, 
-    25, 13, 6, -20, -67, -44, 39, 65, 25, 33, 
-    45, -53, -117, 10, 137, 47, -98, -119, -71, 26, 
-    155, 149, 0, -122, -142, -69, 41, 99, 85, 50, 
-    -12, -109, -117, -23, 43, 75, 82, 2, -69, 7, 
-    80, -17, -115, -85, -27, 24, 99, 107, 20, -26, 
-    -8, -17, -28, -4, 26, 40, 1, -68, -98, -90, 
-    -4, 128, 113, -16, -53, -13, 5, 29, 71, 65, 
-    8, -83, -152, -40, 181, 163, -114, -235, -86, 18, 
-    45, 148, 141, -57, -83, 87, 50, -148, -160, 2, 
-    125, 101, -7, -85, -81, 30, 164, 104, -125, -191, 
-    -35, 92, 105, 42, -34, -10, 30, -35, -94, -36, 
-    29, 0, -4, 48, 26, -46, 3, 191, 215, -84, 
-    -332, -241, 9, 154, 121, 56, 70, 48, -34, -41, 
-    -9, -90, -164, -72, 60, 94, 34, -29, -10, 63, 
-    121, 80, -56, -155, -164, -86, 79, 217, 195, 37, 
-    -97, -114, -75, -64, -58, -5, 94, 179, 133, -65, 
-    -209, -126, 41, 86, 76, 86, 33, -98, -185, -109, 
-    62, 148, 122, 76, 24, -91, -224, -157, 83, 178, 
-    66, -22, 14, 33, -71, -161, -84, 74, 122, 44, 
-    -1, 15, 0, -24, 10, 52, 3, -99, -126, -27, 
-    142, 199, 27, -151, -93, 52, 49, -51, -89, -43, 
-    26, 59, 13, -4, 90, 116, -56, -201, -105, 76, 
-    94, 11, 26, 82, 20, -98, -115, -18, 65, 79, 
-    55, -26, -133, -119, 73, 247, 139, -166, -262, -46, 
-    137, 93, -7, 0, 46, 27, -26, -70, -65, 14, 
-    45, -8, -50, -104, -90, 106, 224, 84, -60, -67, 
-    -60, -59, 9, 90, 67, -10, -33, -28, -59, -84, 
-    -15, 93, 101, 20, -51, -76, -38, 42, 48, -38, 
-    -70, -13, 31, 76, 123, 59, -65, -92, -15, 58, 
-    40, -20, -25, -34, -121, -104, 83, 160, 54, -34, 
-    -47, -50, -86, -56, 119, 202, 25, -144, -100, -3, 
-    -13, -73, -50, 86, 179, 95, -34, -33, 1, -46, 
-    -65, -7, 45, 50, -1, -84, -89, 51, 164, 56, 
-    -135, -162, -10, 153, 114, -98, -190, -82, 90, 211, 
-    158, -12, -117, -135, -70, 34, 62, 11, -61, -90, 
-    -20, 94, 130, 56, -22, 8, 65, -11, -136, -116, 
-    7, 55, 10, 31, 134, 93, -65, -94, -52, -98, 
-    -97, 46, 85, -49, -55, 71, 81, 34, 32, -9, 
-    -60, -41, -11, 13, 52, 53, 50, 60, -17, -156, 
-    -198, -89, 93, 197, 115, -38, -43, 45, -4, -149, 
-    -157, -32, 79, 142, 147, 97, 12, -91, -137, -92, 
-    1, 58, 1, -62, -19, 48, 49, 6, 3, 50, 
-    59, 7, -43, -41, -33, -41, -4, 43, -7, -91, 
-    -73, 41, 134, 113, 20, -53, -108, -95, 21, 92, 
-    44, -34, -90, -85, -3, 80, 113, 94, 36, -9, 
-    -15, -11, -36, -100, -151, -96, 71, 182, 116, -30, 
-    -79, 15, 64, -38, -89, -16, 14, 13, 47, 2, 
-    -104, -65, 120, 194, 13, -189, -130, 63, 116, 56, 
-    8, -62, -139, -74, 100, 116, -57, -121, -3, 103, 
-    107, 16, -68, -1, 98, 5, -163, -96, 100, 76, 
-    -64, -54, -17, -40, 39, 151, 78, -88, -107, -17, 
-    25, 37, 65, 58, -11, -71, -74, -52, -12, 43, 
-    54, 3, -18, 13, 40, 46, -3, -76, -85, -49, 
-    30, 111, 88, 1, -53, -71, -73, -39, 84, 166, 
-    -1, -190, -78, 110, 106, 52, 17, -78, -147, -90, 
-    27, 91, 39, -38, 13, 101, 72, -2, -49, -87, 
-    -74, 6, 18, -66, -51, 65, 114, 97, 21, -94, 
-    -95, 13, 73, 53, 30, 23, -23, -85, -57, 7, 
-    -15, -47, 20, 101, 54, -66, -92, -17, 43, 30, 
-    -36, -80, -27, 82, 89, -13, -13, 90, 105, 21, 
-    -77, -165, -163, -44, 80, 129, 96, -12, -89, -25, 
-    83, 88, 16, -55, -107, -102, -54, 12, 110, 127, 
-    27, -32, -35, -56, -31, 64, 121, 38, -141, -204, 
-    -35, 167, 152, -27, -120, -55, 7, -5, 14, 76, 
-    83, 24, -35, -54, -48, -10, 42, 38, -17, -52, 
-    -59, -32, 31, 83, 94, 32, -56, -57, -17, -29, 
-    -42, 0, 56, 73, 58, 7, -63, -107, -101, -7, 
-    107, 87, 7, 5, 31, 15, -36, -75, -82, -66, 
-    12, 104, 61, -43, -22, 60, 53, -6, -24, -13, 
-    -28, -33, 32, 55, -62, -122, 19, 155, 105, -23, 
-    -84, -84, -36, 34, 8, -52, 1, 63, 38, 3, 
-    -8, -25, -51, -60, -26, 64, 155, 103, -56, -93, 
-    -26, -24, -53, -20, 51, 74, 46, 24, -13, -61, 
-    -55, -3, 38, 41, 6, -38, -51, -32, -21, -29, 
-    -13, 34, 38, 31, 89, 105, 1, -94, -73, -23, 
-    -39, -45, -18, -16, 28, 102, 80, -3, -28, 3, 
-    1, -51, -67, -10, 63, 73, 3, -53, -30, 8, 
-    7, 10, 24, -17, -58, 5, 55, -29, -83, 35, 
-    135, 41, -86, -95, -58, -36, 18, 121, 173, 66, 
-    -123, -176, -60, 44, 49, 21, -4, -13, 15, 38, 
-    12, -36, -51, 27, 130, 48, -155, -149, 51, 117, 
-    10, -42, -15, -14, -9, 14, 48, 105, 60, -110, 
-    -156, -24, 48, 9, 15, 88, 91, -47, -176, -120, 
-    34, 120, 127, 67, -48, -108, -34, 46, 12, -28, 
-    -13, 7, 54, 67, -27, -90, -62, -27, 33, 90, 
-    55, -17, -48, -28, 32, 58, -11, -97, -91, -13, 
-    55, 70, 8, -41, 20, 98, 70, -15, -84, -145, 
-    -123, 4, 71, 44, 46, 76, 65, -1, -72, -75, 
-    -1, 73, 45, -57, -76, 13, 84, 66, -33, -103, 
-    -36, 62, 80, 47, -45, -119, -18, 126, 57, -94, 
-    -89, -20, -12, -1, 54, 97, 74, -17, -76, -28, 
-    28, -13, -74, -70, -36, 9, 56, 55, 14, -14, 
-    14, 84, 90, -35, -146, -62, 91, 70, -40, -34, 
-    -2, -23, 13, 48, -13, -48, 1, 19, -2, -13, 
-    -49, -25, 95, 91, -79, -148, -19, 107, 96, 24, 
-    -15, -43, -78, -33, 66, 72, 6, -22, -15, -21, 
-    -57, -73, 9, 119, 110, 7, -51, -38, -34, -65, 
-    -70, -22, 51, 97, 80, 30, -36, -75, -22, 33, 
-    -11, -56, -18, 49, 72, 39, 1, -29, -73, -92, 
-    -57, 14, 105, 143, 66, -35, -71, -73, -35, 44, 
-    73, 29, -32, -81, -93, -34, 54, 100, 82, 14, 
-    -39, -66, -79, -18, 82, 93, 9, -59, -55, -18, 
-    11, 11, -23, -37, 15, 66, 44, -1, 9, 26, 
-    -18, -59, -61, -77, -61, 35, 110, 100, 39, -57, 
-    -106, -6, 109, 61, -43, -46, -8, 13, 45, 24, 
-    -74, -118, -51, 41, 89, 73, 9, -8, 47, 64, 
-    -39, -170, -141, 35, 131, 62, -24, -7, 34, 0, 
-    -23, 15, 22, 0, -20, -62, -87, -55, 13, 69, 
-    82, 81, 53, -22, -62, -37, -14, -18, -14, -4, 
-    4, 30, 55, 29, -25, -62, -66, -8, 73, 72, 
-    5, -54, -75, -32, 39, 31, -35, -21, 73, 94, 
-    -6, -72, -5, 44, -23, -60, -22, -22, -36, -4, 
-    31, 72, 103, 25, -89, -65, 5, -12, -21, 7, 
-    2, 8, 41, 44, 26, 12, -9, -12, -6, -42, 
-    -68, -50, -4, 79, 103, -14, -129, -89, 43, 105, 
-    63, 0, -41, -31, 46, 72, -32, -105, -42, 5, 
-    -28, -18, 48, 86, 79, 26, -81, -136, -37, 76, 
-    61, 15, 5, -20, -22, 24, 24, -29, -39, 3, 
-    27, 20, 12, -24, -68, -4, 109, 83, -41, -95, 
-    -56, 21, 56, 9, -34, -32, -22, 14, 53, 6, 
-    -72, -39, 72, 97, 19, -38, -50, -57, -37, 10, 
-    30, 19, 13, 12, 23, 45, -5, -109, -108, 20, 
-    140, 117, -71, -174, -18, 136, 75, -50, -67, 17, 
-    99, 68, -49, -118, -100, -21, 69, 97, 37, -54, 
-    -57, 48, 84, -23, -88, -9, 64, 19, -27, 10, 
-    27, -29, -60, -21, 14, 2, 18, 80, 57, -42, 
-    -68, -32, -35, -61, -39, 23, 42, 12, 19, 61, 
-    59, 1, -61, -57, 22, 93, 70, -27, -95, -75, 
-    -6, 41, 37, 19, 8, -13, -15, 0, -17, -31, 
-    13, 53, 21, -43, -64, -30, 13, 23, 4, -5, 
-    12, 34, 42, 40, 5, -70, -93, -32, 20, 25, 
-    36, 50, 24, 16, 47, -13, -123, -87, 24, 30, 
-    -7, 4, 25, 32, 36, 1, -52, -36, 26, 59, 
-    58, 5, -67, -59, -15, -21, -29, 11, 56, 48, 
-    6, 21, 71, 21, -99, -148, -83, 55, 141, 75, 
-    -39, -66, -30, 0, 19, 44, 51, -1, -61, -72, 
-    -44, 5, 51, 62, 16, -53, -55, 18, 66, 38, 
-    -3, -9, -5, -24, -17, 22, 11, -18, -12, -35, 
-    -61, -27, 34, 96, 125, 63, -38, -86, -81, -61, 
-    -27, 4, 11, 44, 102, 78, -31, -106, -124, -86, 
-    17, 113, 127, 52, -45, -46, 35, 41, -46, -79, 
-    -21, 13, 15, 30, 7, -37, -21, 31, 57, 31, 
-    -21, -49, -26, 16, 18, -11, -20, 0, 22, 14, 
-    1, 26, 26, -50, -97, -30, 67, 78, 4, -44, 
-    -17, -8, -52, -79, -35, 65, 123, 85, 24, -10, 
-    -37, -48, -33, -25, -29, 6, 69, 74, 9, -41, 
-    -44, -27, -9, -5, 0, 21, 16, -9, -7, 15, 
-    16, -2, -12, -12, -16, -20, -4, 18, 11, 3, 
-    22, 18, -18, -25, -8, -6, 0, 19, 8, -23, 
-    -22, 18, 46, 24, 2, 10, 0, -53, -87, -41, 
-    45, 88, 70, 5, -64, -66, -12, 15, 9, 10, 
-    36, 47, -25, -80, -20, 38, 35, 10, -40, -64, 
-    -4, 57, 29, -25, 7, 88, 62, -57, -87, -25, 
-    -8, -15, 23, 27, -22, -19, 4, -12, 7, 59, 
-    51, -5, -14, 28, 6, -84, -84, 11, 36, -3, 
-    3, 34, 29, -5, -27, -25, -11, 20, 30, -3, 
-    -27, -25, -16, -7, 2, 27, 46, 22, -16, -29, 
-    -34, -26, 21, 61, 38, -4, -20, -27, -21, 16, 
-    49, 36, 0, -21, -51, -82, -26, 80, 78, -26, 
-    -76, -47, -9, 22, 30, 16, 19, 26, 16, 10, 
-    -17, -69, -53, 39, 76, 18, -16, -3, -4, -6, 
-    -17, -33, 3, 29, -11, -18, 32, 31, -13, -4, 
-    20, -29, -90, -45, 80, 159, 109, -49, -171, -131, 
-    2, 46, 3, 15, 66, 36, -41, -48, 19, 67, 
-    26, -66, -82, 7, 78, 30, -68, -60, 56, 92, 
-    3, -52, -13, 37, 21, -45, -53, 10, 40, 19, 
-    0, -10, -27, -24, 1, 3, -19, -17, 23, 68, 
-    54, -22, -60, -16, 22, 19, 1, -43, -65, 1, 
-    72, 53, -16, -60, -31, 47, 68, 1, -39, -12, 
-    -8, -26, 18, 55, 3, -44, -1, 53, 6, -90, 
-    -86, 21, 90, 39, -44, -37, 34, 59, 10, -61, 
-    -82, -40, 1, 25, 55, 76, 72, 37, -27, -92, 
-    -109, -51, 16, 26, 50, 105, 60, -53, -74, -16, 
-    24, 8, -36, -34, 20, 54, 32, -24, -67, -66, 
-    -14, 51, 71, 38, -6, -27, -13, 2, -3, -1, 
-    -13, -33, -12, 23, 36, 16, -17, -1, 38, 32, 
-    8, -10, -32, -41, -46, -42, -13, 27, 59, 56, 
-    7, -26, -15, -2, -11, -33, -39, 4, 71, 83, 
-    24, -47, -75, -64, -22, 35, 42, 11, 29, 60, 
-    2, -89, -71, 25, 54, 19, -8, -42, -59, 0, 
-    93, 97, -12, -98, -59, 30, 61, 21, -29, -40, 
-    -10, 50, 77, -2, -92, -72, -1, 47, 56, 24, 
-    -3, -17, -46, -61, -26, 43, 84, 53, -23, -66, 
-    -46, -29, -36, 17, 112, 108, 2, -85, -104, -62, 
-    16, 50, 21, 6, 48, 71, -6, -85, -48, 4, 
-    -12, -5, 50, 51, -1, -2, 31, 13, -35, -69, 
-    -63, -10, 34, 51, 70, 56, -22, -88, -72, -15, 
-    13, 20, 45, 49, -3, -45, -38, -20, 9, 51, 
-    35, -44, -68, -8, 51, 54, 2, -45, -17, 35, 
-    25, 2, 20, 3, -81, -103, 16, 134, 101, -6, 
-    -46, -42, -65, -88, -63, 14, 107, 138, 71, -30, 
-    -96, -91, -34, 19, 31, 10, 15, 62, 74, 15, 
-    -58, -72, -34, -10, -8, 10, 38, 40, 15, -17, 
-    -23, 4, 2, -44, -49, 8, 53, 47, 21, -14, 
-    -59, -55, 3, 17, -9, 29, 87, 40, -56, -60, 
-    -13, -14, -9, 48, 69, 16, -44, -61, -43, -4, 
-    56, 102, 61, -35, -79, -54, -24, -15, -8, -6, 
-    -11, 14, 47, 31, 3, 9, -1, -28, -25, -8, 
-    -8, -3, 22, 43, 27, -27, -82, -54, 52, 109, 
-    54, -28, -33, 6, -13, -70, -58, 28, 70, 21, 
-    -15, 20, 28, -29, -57, -9, 37, 18, -17, -2, 
-    25, 9, -33, -60, -49, 7, 77, 94, 25, -62, 
-    -64, 3, 16, -18, -3, 19, -13, -41, -16, 19, 
-    32, 43, 47, 3, -55, -58, -18, 22, 46, 30, 
-    -33, -62, 0, 67, 48, -17, -45, -19, 19, 21, 
-    -15, -45, -27, 23, 41, 10, -17, -12, 15, 45, 
-    45, -9, -68, -74, -33, 28, 67, 37, -23, -51, 
-    -23, 41, 59, 2, -37, -18, 5, 9, -7, -31, 
-    -35, -11, 29, 58, 64, 48, 8, -48, -91, -92, 
-    -28, 73, 99, 21, -49, -56, -16, 45, 56, 4, 
-    -31, -29, -29, -24, -4, 9, 18, 30, 15, 2, 
-    26, 18, -19, 1, 21, -36, -72, -21, 32, 38, 
-    32, 19, 8, -2, -40, -80, -68, 7, 97, 113, 
-    24, -76, -90, -29, 33, 34, -3, -15, 24, 68, 
-    39, -33, -57, -38, -39, -52, -3, 99, 124, 25, 
-    -82, -88, -22, 40, 54, 10, -40, -21, 28, 24, 
-    -11, -17, -3, -1, -10, -7, -6, -6, 8, 9, 
-    -16, -19, 8, 13, 1, 10, 30, 22, -14, -28, 
-    -13, -2, 10, 19, -3, -29, -27, -7, 32, 60, 
-    9, -56, -31, 16, 9, 8, 36, 17, -60, -83, 
-    -7, 62, 47, 4, 7, 31, 9, -56, -86, -32, 
-    44, 70, 65, 39, -42, -101, -43, 40, 37, -5, 
-    -3, 21, 3, -22, 9, 21, -29, -57, -13, 43, 
-    40, 6, -2, -4, -29, -45, -28, 1, 40, 74, 
-    53, -1, -38, -55, -50, -12, 27, 22, 0, 8, 
-    28, 25, 8, -10, -30, -27, 0, 18, 8, -12, 
-    -6, 15, -6, -42, -17, 46, 57, 12, -28, -45, 
-    -53, -32, 37, 91, 56, -15, -49, -40, -4, 21, 
-    1, -28, -17, 12, 22, 20, 13, -3, -24, -29, 
-    -10, 8, 7, 1, 5, 18, 11, -22, -26, 8, 
-    30, 19, -1, -11, -19, -23, -2, 33, 30, -26, 
-    -61, -17, 51, 65, 26, -33, -66, -30, 29, 23, 
-    -25, -17, 35, 28, -15, -2, 12, -25, -25, 26, 
-    25, -31, -36, 20, 40, 6, -9, 2, -5, -28, 
-    -18, 23, 36, 16, 1, -11, -16, -7, -17, -37, 
-    -4, 47, 26, -25, -21, 10, 12, -10, -18, -2, 
-    11, 8, 4, -11, -40, -16, 62, 70, -20, -76, 
-    -34, 33, 61, 30, -39, -60, 0, 52, 34, 0, 
-    -22, -44, -38, -4, 20, 31, 24, -4, -8, 28, 
-    26, -35, -66, -20, 41, 34, -22, -33, 9, 23, 
-    4, -13, -22, -15, 5, 21, 39, 46, 13, -29, 
-    -32, -32, -48, -12, 52, 43, -4, -1, 18, 1, 
-    -19, -27, -31, -11, 21, 31, 11, -25, -27, -1, 
-    -9, -18, 38, 82, 30, -42, -44, -11, -1, -7, 
-    -4, 11, 26, 20, -20, -61, -48, 7, 52, 67, 
-    33, -28, -43, -2, 37, 34, -20, -80, -75, 9, 
-    86, 74, 1, -52, -60, -30, 36, 79, 34, -46, 
-    -63, -25, 16, 35, 19, -9, -24, -30, -11, 31, 
-    42, 12, -2, 7, -14, -38, -21, -2, 7, 41, 
-    51, -14, -78, -59, 22, 84, 65, -7, -37, -22, 
-    -34, -51, -13, 40, 46, 15, -15, -18, 10, 28, 
-    -9, -55, -33, 20, 30, 8, -7, -4, 15, 29, 
-    20, -5, -29, -29, 2, 19, 9, 0, -13, -33, 
-    -25, 13, 39, 18, -24, -21, 22, 27, -6, -13, 
-    -15, -30, 3, 65, 43, -38, -62, -26, 7, 27, 
-    27, 5, 0, 6, -16, -32, -9, 28, 41, 9, 
-    -40, -45, -11, 13, 20, 22, 7, -18, -12, 16, 
-    23, 10, -14, -42, -23, 35, 40, -6, -18, 4, 
-    -1, -25, -19, 19, 44, 14, -34, -22, 19, 4, 
-    -33, -21, 5, 4, 6, 23, 19, -3, 2, 26, 
-    17, -28, -60, -44, 11, 50, 27, -16, -18, 9, 
-    26, 33, 32, -4, -65, -68, 6, 48, 7, -22, 
-    9, 25, -4, -21, -17, -22, -9, 28, 45, 19, 
-    -32, -66, -31, 39, 47, -4, -24, -8, -7, 1, 
-    50, 72, 7, -70, -61, 5, 37, 24, 3, -13, 
-    -14, 0, 1, -4, -1, -2, 4, 13, -6, -32, 
-    -33, -13, 11, 21, 34, 45, 4, -49, -39, -5, 
-    -5, -11, 11, 40, 39, 16, -7, -22, -25, -14, 
-    8, 21, 5, -15, -12, -4, -10, -10, 5, 25, 
-    34, 8, -40, -54, -15, 32, 33, -1, -5, 19, 
-    19, -9, -27, -15, -1, -1, 14, 32, 2, -36, 
-    -20, 20, 32, 1, -55, -67, -10, 44, 62, 60, 
-    18, -41, -56, -25, 16, 25, -11, -47, -39, 10, 
-    54, 52, 18, -10, -25, -32, -16, 21, 40, 25, 
-    -1, -30, -42, -14, 8, 10, 29, 28, -13, -20, 
-    7, 7, -13, -20, -9, -2, -14, -14, 10, 15, 
-    4, 8, 14, 2, -11, 11, 35, -5, -64, -52, 
-    16, 56, 28, -14, -3, 26, -3, -47, -24, 35, 
-    42, -8, -38, -13, 18, 6, -7, 6, -1, -20, 
-    -8, 12, 11, -5, -19, -16, 0, 14, 25, 27, 
-    8, -21, -30, -19, -6, 13, 38, 36, -5, -34, 
-    -22, -1, 11, 0, -20, -11, 19, 32, 10, -29, 
-    -38, -7, 16, 2, -11, 9, 34, 27, 4, -9, 
-    -19, -25, -19, -13, -1, 22, 24, 0, -1, 11, 
-    -2, -15, -7, 6, 11, 0, -12, -10, 1, 15, 
-    19, -6, -31, -15, 9, 1, -9, 5, 15, 8, 
-    6, 2, -8, -7, -1, -5, -8, 1, 15, 21, 
-    8, -12, -16, -13, -24, -15, 29, 43, 13, -7, 
-    -8, -6, -7, -12, -19, -17, -2, 8, 17, 25, 
-    19, 12, 5, -16, -27, -17, -16, -15, 11, 19, 
-    -11, -18, 22, 47, 15, -34, -42, -5, 23, 11, 
-    -11, -6, 21, 30, -3, -28, -11, 5, -1, -8, 
-    -10, -4, 9, 15, 13, 27, 35, -8, -68, -69, 
-    -13, 35, 35, 11, 3, 5, 1, -2, -9, -14, 
-    -3, 7, 8, 12, 12, -8, -29, -21, -1, -4, 
-    -6, 30, 51, 8, -29, -23, -20, -12, 16, 21, 
-    -4, -11, 9, 18, 1, -8, -2, -4, -11, -5, 
-    7, 3, -6, 6, 16, -13, -28, 17, 53, 25, 
-    -20, -33, -30, -33, -20, 13, 36, 34, 10, -17, 
-    -23, -15, -7, 3, 18, 34, 26, -23, -66, -44, 
-    24, 70, 49, -6, -30, -23, -15, -1, 22, 19, 
-    -13, -29, -9, 7, 1, -4, 9, 20, 0, -42, 
-    -44, 11, 52, 42, 13, -17, -34, -7, 35, 27, 
-    -16, -30, -12, 2, 4, -1, -3, -5, -13, -3, 
-    17, 5, -11, 18, 47, 16, -48, -76, -32, 32, 
-    37, 2, -3, 17, 5, -21, -9, 19, 29, 14, 
-    -18, -32, -15, 3, 1, -3, 11, 25, 13, -15, 
-    -28, 0, 33, 19, -11, -12, -10, -7, 9, 5, 
-    -27, -33, 2, 37, 37, 7, -17, -4, 10, -20, 
-    -47, -12, 42, 34, -9, -31, -26, 1, 31, 23, 
-    -4, -7, 6, 6, -9, -20, -15, 3, 6, -5, 
-    1, 22, 28, 8, -14, -14, -10, -21, -19, 14, 
-    37, 25, -6, -29, -27, -4, 24, 31, 2, -31, 
-    -22, 7, 11, 0, 6, 18, 6, -16, -22, -19, 
-    -12, 5, 23, 23, 7, -15, -23, -3, 23, 27, 
-    2, -29, -31, -2, 23, 18, -6, -21, -13, 12, 
-    22, 9, -5, -9, -12, -9, 0, 5, 1, 0, 
-    7, 2, -9, 2, 20, 19, -4, -19, -8, -3, 
-    -16, -11, 16, 26, -2, -27, -21, -3, 19, 32, 
-    8, -23, -10, 19, 16, -8, -23, -13, 11, 18, 
-    -4, -19, 2, 29, 12, -29, -38, -18, -3, 9, 
-    27, 34, 22, -4, -35, -40, -4, 21, 10, 10, 
-    24, 0, -32, -17, 19, 34, 14, -31, -48, -6, 
-    36, 16, -21, -5, 35, 20, -29, -33, 6, 20, 
-    -3, -20, -10, 11, 27, 24, -1, -24, -29, -23, 
-    -14, 4, 24, 30, 20, 9, -3, -23, -30, -12, 
-    6, 6, 2, 6, 13, 13, 7, 5, 5, -7, 
-    -25, -18, 2, 4, 3, 4, -3, -6, 5, 10, 
-    4, -1, -11, -22, -9, 30, 39, -1, -34, -24, 
-    4, 10, -6, -2, 16, 5, -11, 9, 27, -9, 
-    -39, -2, 36, 17, -16, -29, -22, 7, 27, 11, 
-    -17, -28, -18, 9, 37, 38, 2, -33, -30, -1, 
-    16, 7, -5, 0, 7, 10, 12, 2, -18, -29, 
-    -19, 9, 25, 12, 1, 7, 10, -4, -24, -33, 
-    -21, 9, 35, 30, 6, -11, -17, -14, -4, 5, 
-    20, 24, -2, -19, -8, -7, -11, 10, 27, 3, 
-    -26, -25, -11, 6, 26, 19, -8, -11, -1, -2, 
-    4, 17, 0, -32, -28, 9, 24, 13, 9, 6, 
-    -7, -7, -2, -7, -9, -8, -1, 9, 12, 7, 
-    3, 7, 6, -10, -16, -2, 5, -1, -6, -8, 
-    -5, 3, 5, 7, 8, 2, 2, 7, -6, -31, 
-    -25, 10, 31, 19, -8, -20, 1, 19, 3, -8, 
-    4, 3, -18, -22, 5, 26, 11, -12, -15, -13, 
-    -8, 7, 16, 9, 6, 8, -5, -27, -20, 19, 
-    32, 2, -16, 0, 11, -6, -20, -9, 3, -1, 
-    -2, 7, 10, 3, -4, -2, 2, -4, -12, -12, 
-    -2, 8, 9, 10, 8, -6, -18, -6, 25, 30, 
-    -10, -45, -32, 7, 28, 23, 14, 5, -14, -19, 
-    1, 4, -15, -11, 13, 16, 3, -7, -8, -1, 
-    4, 0, -8, -19, -18, 7, 30, 25, 3, -19, 
-    -26, -9, 6, 8, 15, 26, 10, -19, -20, -4, 
-    4, 3, 0, -8, -15, -7, 7, 9, 2, 4, 
-    14, 13, -8, -23, -7, 16, 7, -14, -9, 8, 
-    7, 2, 8, 12, -4, -22, -17, 0, 3, 0, 
-    1, -3, -3, 9, 12, 0, -5, -2, -2, 0, 
-    3, -4, -9, 1, 10, 10, 5, -7, -13, -8, 
-    -3, 4, 14, 11, -7, -17, -1, 10, 0, -8, 
-    -7, -2, 13, 15, -6, -22, -13, 11, 19, 0, 
-    -17, -12, -2, 8, 22, 20, -4, -19, -14, -6, 
-    2, 10, 7, -4, -9, -5, 4, 15, 22, 10, 
-    -17, -24, -8, 1, -3, 1, 15, 19, -2, -25, 
-    -24, -3, 14, 18, 14, 0, -20, -19, 5, 15, 
-    3, -3, 3, 2, -8, -6, 1, 0, 3, 15, 
-    15, -4, -24, -25, -4, 13, 9, 1, 2, 8, 
-    8, -3, -10, -5, 3, 5, -1, -3, -1, -4, 
-    -1, 6, 6, 4, 3, -3, -6, -7, -10, -4, 
-    7, 4, -3, 0, 4, -2, -9, -5, 4, 5, 
-    3, 3, 1, 0, -2, 0, 6, 7, 1, -5, 
-    -8, 0, 9, 1, -12, -8, 0, -2, -5, 0, 
-    9, 20, 18, -7, -28, -18, 5, 10, -4, -15, 
-    -2, 15, 19, 15, 3, -18, -26, -5, 15, 13, 
-    1, -2, -4, -10, -8, -2, 4, 9, 4, -7, 
-    -11, -2, 15, 20, 13, 10, -3, -35, -42, -12, 
-    15, 20, 19, 14, -2, -14, -9, 2, 3, -1, 
-    -2, -6, -9, 2, 12, 8, 6, 10, -1, -16, 
-    -15, -2, 8, 2, -9, 5, 26, 17, -16, -36, 
-    -24, 7, 29, 24, -6, -29, -14, 11, 13, 4, 
-    -2, -8, -7, 4, 7, -6, -17, -8, 10, 21, 
-    16, 3, -8, -12, -13, -11, 0, 10, 14, 10, 
-    -4, -11, -3, 4, 4, 4, 0, -10, -9, -2, 
-    -2, 0, 8, 10, 6, 0, -9, -12, -3, 8, 
-    11, 4, -5, -11, -14, -5, 16, 22, 5, -14, 
-    -23, -21, -2, 24, 28, 5, -11, -9, -1, 1, 
-    -5, -7, 2, 5, 0, -3, -6, -2, 10, 16, 
-    1, -14, -4, 15, 10, -7, -14, -11, -7, -3, 
-    4, 4, 1, 1, 4, 4, 2, 6, 9, -3, 
-    -15, -12, -1, 6, 4, 1, -1, -6, -5, 5, 
-    14, 10, -2, -9, -12, -15, -8, 6, 13, 13, 
-    8, -4, -14, -8, 10, 16, 2, -15, -16, -1, 
-    11, 6, -4, -3, 3, 1, 0, 1, -3, -6, 
-    2, 10, 4, -9, -13, -9, -1, 7, 6, -3, 
-    -4, 0, 5, 10, 10, 2, -7, -8, -5, -3, 
-    -3, 0, 2, 3, 4, 3, 0, -8, -15, -5, 
-    18, 22, 2, -16, -15, -7, 7, 24, 16, -10, 
-    -20, -15, -11, 1, 14, 15, 4, -4, -7, -10, 
-    -7, 6, 11, 0, -6, 5, 14, 5, -11, -12, 
-    -6, -2, 5, 7, -3, -7, 4, 10, 2, -3, 
-    1, 0, -5, -2, 2, -2, -6, -4, 0, 2, 
-    -3, -10, 2, 19, 19, 6, -7, -18, -22, -11, 
-    6, 13, 11, 5, -3, -8, -7, -2, 0, 0, 
-    8, 14, 4, -8, -7, 3, 9, 2, -10, -14, 
-    -2, 10, 5, -9, -9, 6, 10, -3, -10, 2, 
-    7, -3, -8, -4, -2, -1, 3, 9, 8, 1, 
-    -5, -10, -6, 5, 8, 0, -4, 3, 10, 4, 
-    -10, -20, -15, -1, 9, 13, 15, 9, -5, -15, 
-    -9, 4, 11, 4, -5, -2, 3, -5, -14, -10, 
-    0, 2, 0, 2, 3, 0, 2, 13, 13, -4, 
-    -16, -6, 5, 1, -6, -6, -4, 0, 9, 15, 
-    7, -4, -9, -5, 0, -2, -8, -2, 8, 5, 
-    -5, 0, 9, 4, -5, -3, 1, -2, -9, -9, 
-    -1, 11, 12, -3, -12, -5, 5, 5, -2, -4, 
-    -3, 0, 5, 5, -1, -5, 0, 4, 1, -4, 
-    -3, -1, 1, 5, 5, -1, -7, -5, 2, 5, 
-    1, -4, -6, -5, 1, 9, 10, 6, 0, -10, 
-    -21, -16, 4, 17, 12, 4, -2, -2, 0, -4, 
-    -6, -1, 0, -6, -6, 6, 14, 8, -2, -4, 
-    2, 5, -4, -12, -10, -6, 2, 14, 10, -6, 
-    -12, -3, 6, 6, 4, 5, 4, -3, -5, -3, 
-    -6, -13, -9, 4, 12, 8, 1, -2, -4, -3, 
-    0, 3, 3, -2, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, 
-    -7, -7, -7, -7, -6, -6, -6, -6, -6, -6, 
-    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 
-    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 
-    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 
-    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 
-    -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, 
-    -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, 
-    -5, -5, -5, -5, -5, -5, -5, -4, -4, -4, 
-    -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 
-    -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, 
-    -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 
-    -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, 
-    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 
-    -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 
+const int closedhat_packed_len = 12443;
+const uint8_t closedhat_packed[] = {
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x40, 0x14, 0x00, 0xa0, 0x62, 0x0e,
+    0xe1, 0x42, 0x03, 0x23, 0xcc, 0x80, 0x82, 0xf8, 0xd5, 0xb1, 0x1d, 0x31, 0xaa, 0x45, 0x08, 0xae,
+    0x06, 0x61, 0xfb, 0xb7, 0x85, 0x9c, 0xaf, 0x7f, 0xc2, 0x1c, 0x28, 0xf4, 0xf4, 0x89, 0x66, 0x25,
+    0x7a, 0x6c, 0xa8, 0xe7, 0x4d, 0x8b, 0xbf, 0x2d, 0xf9, 0x4f, 0xd3, 0xc7, 0x90, 0xab, 0x3e, 0x9c,
+    0xd3, 0xed, 0x75, 0x98, 0xce, 0x43, 0x39, 0xdf, 0x68, 0x79, 0x26, 0xfe, 0x57, 0x1f, 0x58, 0xaf,
+    0xa3, 0x2f, 0xee, 0x27, 0xcb, 0x73, 0xd1, 0xe0, 0x60, 0xf2, 0x9b, 0xeb, 0x7a, 0xf4, 0xd9, 0x27,
+    0x44, 0xf3, 0x4e, 0x8f, 0x82, 0x0f, 0x8c, 0x3f, 0xc2, 0x2b, 0x3f, 0x62, 0x28, 0x89, 0xee, 0x19,
+    0xbb, 0x1c, 0xee, 0x47, 0xf4, 0x24, 0xfd, 0x09, 0xaa, 0x03, 0xd4, 0xad, 0x39, 0xcc, 0x07, 0x5e,
+    0x9b, 0xfb, 0x71, 0x3a, 0xc1, 0xa5, 0x61, 0xfd, 0xf9, 0x39, 0xe8, 0x7e, 0x7b, 0xbf, 0x87, 0x3e,
+    0x1a, 0x82, 0x23, 0x2b, 0x7e, 0x45, 0x1e, 0x43, 0x98, 0xe0, 0x3e, 0x0d, 0xd2, 0x54, 0x9f, 0xba,
+    0x9f, 0x9e, 0x6e, 0xe4, 0x9f, 0xb3, 0xe1, 0x36, 0xec, 0x03, 0xba, 0x26, 0x11, 0x7e, 0xb9, 0xb8,
+    0x62, 0x65, 0x4d, 0x52, 0xc5, 0x00, 0x84, 0x8e, 0x16, 0xac, 0xa2, 0x22, 0xbe, 0xe0, 0xe1, 0xf9,
+    0xfe, 0x9c, 0xdf, 0x22, 0x81, 0x50, 0xca, 0xcf, 0xbf, 0xef, 0xab, 0xff, 0x6a, 0x5b, 0x60, 0xdc,
+    0xdb, 0xf7, 0x86, 0xf9, 0x9c, 0x26, 0xfe, 0x70, 0xbc, 0x90, 0x7c, 0xcd, 0x45, 0x7b, 0xf2, 0x40,
+    0xe1, 0x1d, 0xe9, 0x87, 0xe1, 0x62, 0xbb, 0x3f, 0x37, 0x0f, 0xf2, 0x2a, 0x04, 0xdd, 0x59, 0xf6,
+    0x97, 0xfa, 0x97, 0x9c, 0xbf, 0x56, 0x49, 0xbc, 0xfe, 0x6b, 0xbd, 0x27, 0x3f, 0xf8, 0x1a, 0x0b,
+    0x6f, 0xd8, 0x37, 0xd0, 0xdf, 0xcb, 0x1e, 0xa8, 0x1d, 0x6e, 0x32, 0xba, 0xec, 0x71, 0x4e, 0x6f,
+    0xab, 0x3f, 0x86, 0xee, 0xfd, 0xda, 0x29, 0x06, 0x30, 0x88, 0x92, 0xd4, 0xda, 0x27, 0x47, 0xef,
+    0xfe, 0x63, 0xdf, 0x14, 0xc5, 0xcf, 0xf4, 0x5f, 0xed, 0xdb, 0x66, 0x9d, 0x89, 0x3f, 0x52, 0x4e,
+    0x72, 0xde, 0x3f, 0xee, 0xfb, 0xf6, 0xc2, 0x7f, 0x2f, 0x46, 0x70, 0x5a, 0x08, 0x93, 0xd5, 0x1d,
+    0x2f, 0x59, 0x9e, 0x5e, 0x7f, 0xc0, 0xc3, 0xfc, 0x90, 0xaf, 0x5f, 0xe9, 0x83, 0x14, 0x5d, 0x43,
+    0x9f, 0x3f, 0xea, 0x37, 0x81, 0xae, 0xcd, 0x1e, 0xba, 0x5c, 0x3d, 0x7c, 0xef, 0xfe, 0x46, 0xde,
+    0x82, 0xc4, 0xd7, 0xd7, 0x24, 0x65, 0x64, 0x57, 0xc9, 0xcf, 0xeb, 0xd9, 0xfc, 0xeb, 0xb7, 0x5f,
+    0xfe, 0xd1, 0x3e, 0x11, 0x65, 0x69, 0xcf, 0xab, 0x4b, 0xc9, 0x1d, 0xe1, 0x11, 0xa8, 0x16, 0xd4,
+    0xbc, 0xa0, 0x44, 0x32, 0xd6, 0x5e, 0xb8, 0x1b, 0x1b, 0x62, 0x9f, 0xc8, 0x97, 0xf4, 0x95, 0x93,
+    0xef, 0xf1, 0x64, 0xcd, 0xfb, 0xa7, 0xbf, 0x89, 0x1d, 0x5c, 0x3c, 0xdc, 0x35, 0xb7, 0xf2, 0x55,
+    0xe8, 0xf5, 0xeb, 0xc0, 0xdc, 0xaf, 0x4b, 0xad, 0x3f, 0x49, 0xbb, 0xa7, 0x7b, 0x1c, 0x7c, 0x41,
+    0x92, 0xda, 0xa8, 0xbf, 0x33, 0x5f, 0xc3, 0x87, 0x17, 0x0c, 0x18, 0x37, 0xe2, 0xdd, 0x92, 0x19,
+    0xb9, 0xb3, 0xe2, 0x0e, 0x76, 0x59, 0x41, 0x57, 0xfb, 0x1c, 0x7a, 0x8d, 0xa6, 0xb7, 0x56, 0x9c,
+    0x02, 0x62, 0xbd, 0xe0, 0xb5, 0xf2, 0x3e, 0x84, 0xf3, 0x97, 0xf7, 0x9d, 0xea, 0xa3, 0xb2, 0x5e,
+    0x34, 0x1f, 0xc1, 0xa1, 0x68, 0x37, 0xd5, 0xfa, 0x16, 0xe0, 0xd1, 0xec, 0x05, 0xf6, 0x4f, 0x18,
+    0x3d, 0xcd, 0x2e, 0x65, 0xc4, 0xc3, 0x4b, 0xb1, 0xdd, 0x23, 0xcb, 0xe5, 0x82, 0xf5, 0x47, 0xd9,
+    0x93, 0x73, 0x0e, 0x0e, 0x3c, 0xe1, 0xeb, 0x15, 0x9f, 0x20, 0xc0, 0x29, 0x9a, 0x32, 0xc3, 0xf3,
+    0x1f, 0x06, 0x45, 0x6c, 0x02, 0x03, 0xff, 0x20, 0x93, 0xb0, 0xff, 0x7c, 0x48, 0x51, 0x79, 0xbe,
+    0xf2, 0xb3, 0xa5, 0x67, 0x15, 0x65, 0x06, 0x8a, 0x43, 0x1e, 0xe8, 0x5b, 0x5b, 0xc0, 0xed, 0xb2,
+    0xbb, 0x41, 0xd3, 0x33, 0x05, 0xaf, 0x97, 0x1d, 0xc1, 0x7f, 0x55, 0xc9, 0xf7, 0x77, 0xaf, 0x7e,
+    0xdd, 0xcf, 0xa1, 0x5d, 0xef, 0xc6, 0x26, 0x3e, 0x2a, 0x93, 0x05, 0xbb, 0x08, 0x2c, 0xd0, 0xb1,
+    0xca, 0x7e, 0x6b, 0x79, 0x7b, 0x7f, 0xc2, 0x43, 0xd1, 0x43, 0x01, 0x5a, 0xab, 0xed, 0xcb, 0xe3,
+    0xb3, 0xe1, 0x27, 0x80, 0x4f, 0xf0, 0x66, 0xfe, 0x81, 0x45, 0xef, 0xfe, 0x28, 0x7f, 0x7b, 0x7f,
+    0x84, 0x47, 0x90, 0xf1, 0x2d, 0x58, 0x0f, 0xca, 0xce, 0x49, 0x9f, 0xc3, 0xa8, 0xc2, 0x3f, 0x1e,
+    0xf0, 0xe3, 0x66, 0xf9, 0xbc, 0xf7, 0xfe, 0x67, 0xdc, 0xea, 0xf5, 0xe2, 0xf1, 0x0a, 0xa6, 0x47,
+    0xaa, 0x0f, 0xa8, 0x99, 0xe2, 0x4a, 0xd9, 0x2b, 0x0b, 0x13, 0x4d, 0x4f, 0x00, 0x6d, 0x76, 0xfd,
+    0x95, 0x4b, 0x08, 0xaf, 0xbc, 0x65, 0x3d, 0x57, 0x3e, 0xa6, 0xfd, 0xc4, 0x76, 0xf6, 0x3f, 0x9e,
+    0xc5, 0xf8, 0x6f, 0xf6, 0x0c, 0xf9, 0xb1, 0x18, 0x9e, 0x2c, 0x20, 0xca, 0x34, 0x58, 0x91, 0xae,
+    0xcf, 0x3f, 0x82, 0x4f, 0xd2, 0x9e, 0xae, 0x71, 0x95, 0x75, 0x2c, 0x4f, 0x2d, 0x20, 0xb4, 0xa8,
+    0x16, 0xd8, 0x05, 0x51, 0x0f, 0xc4, 0x1f, 0x3d, 0xfd, 0x28, 0xf1, 0xe5, 0x8f, 0x56, 0x58, 0xdc,
+    0x0b, 0x22, 0x51, 0xca, 0xcf, 0x90, 0x7f, 0x04, 0x8e, 0x2d, 0xdc, 0x06, 0xc6, 0xff, 0x77, 0x2e,
+    0x42, 0x3d, 0x8a, 0xd7, 0x0f, 0x40, 0x09, 0xfe, 0x2f, 0xa7, 0x55, 0x4e, 0x3a, 0xba, 0x4d, 0xf3,
+    0x88, 0x93, 0xb8, 0xb6, 0x6e, 0x15, 0x1f, 0xae, 0x5b, 0x7f, 0x5b, 0x76, 0x4b, 0xdb, 0x01, 0x11,
+    0x33, 0xa1, 0xe4, 0xa1, 0xf9, 0x98, 0x41, 0x24, 0xdc, 0xf3, 0x18, 0xfe, 0x8c, 0xbf, 0xb1, 0xdf,
+    0xba, 0x17, 0x69, 0xea, 0x0c, 0x28, 0x3f, 0x34, 0x51, 0x58, 0x86, 0x67, 0x10, 0xe5, 0x30, 0xf7,
+    0x5f, 0xef, 0x7f, 0xd5, 0x23, 0xe4, 0x65, 0x71, 0x11, 0x61, 0x8c, 0x36, 0x6e, 0x39, 0xbe, 0xe8,
+    0x8f, 0x9d, 0x47, 0x31, 0x0d, 0x8c, 0x9b, 0xfb, 0x5e, 0x99, 0x2a, 0x56, 0x0b, 0xdb, 0xf7, 0xe8,
+    0x5e, 0x8b, 0xbc, 0x11, 0x30, 0x52, 0x7c, 0x67, 0xd4, 0x00, 0x01, 0xbc, 0xa0, 0x76, 0xa7, 0x70,
+    0x8d, 0xe3, 0xb9, 0x34, 0x5d, 0x4e, 0x4f, 0xd5, 0x46, 0x05, 0xb1, 0xbb, 0xf4, 0x56, 0x4f, 0xb1,
+    0xbc, 0xf8, 0x00, 0x65, 0x45, 0xd1, 0xff, 0xf3, 0x8b, 0xa4, 0xfd, 0x51, 0x2f, 0x10, 0xf4, 0x00,
+    0x65, 0xe7, 0x41, 0xa2, 0x9f, 0xa4, 0xaf, 0x0b, 0x8e, 0x8e, 0x03, 0x41, 0xa6, 0x5b, 0x8c, 0xe1,
+    0x90, 0x4a, 0xd7, 0x05, 0x59, 0x10, 0xe1, 0xd1, 0x3c, 0xb8, 0x62, 0xf8, 0xd5, 0x7b, 0x19, 0x11,
+    0x37, 0x3c, 0x5e, 0xcb, 0x1c, 0x7a, 0xbb, 0x52, 0xfb, 0xb6, 0xbe, 0xff, 0xbe, 0x16, 0xa0, 0xd8,
+    0x5a, 0xf0, 0x1b, 0x93, 0x7f, 0x84, 0xc7, 0x65, 0xcd, 0x3b, 0x71, 0xb5, 0x9c, 0xd4, 0xd2, 0x7a,
+    0xa2, 0xd7, 0xe3, 0xf3, 0x06, 0x1d, 0xef, 0x32, 0x10, 0x0b, 0xc3, 0xd9, 0x9b, 0xa1, 0xa1, 0x3f,
+    0xcc, 0xc8, 0xfd, 0xa3, 0xee, 0x7a, 0x22, 0x1c, 0xe0, 0x2b, 0x61, 0x2a, 0xa5, 0xe3, 0xc5, 0x47,
+    0x7d, 0x30, 0xec, 0xf1, 0x8c, 0x8d, 0x4c, 0xa3, 0xa4, 0x25, 0x11, 0x9e, 0x8f, 0xde, 0x77, 0xfe,
+    0x45, 0xf4, 0x7c, 0xca, 0x3b, 0x27, 0x8c, 0x1e, 0x62, 0xbe, 0x36, 0x4f, 0xe5, 0x5c, 0xca, 0xac,
+    0x9e, 0x07, 0x5c, 0xc8, 0xa0, 0x78, 0x0d, 0xd7, 0xae, 0x6d, 0xbd, 0x60, 0x7b, 0xf3, 0x78, 0x74,
+    0x38, 0xe9, 0x6c, 0xc4, 0x7e, 0x51, 0xc0, 0xd7, 0x07, 0xf9, 0x1e, 0xcc, 0x15, 0x74, 0x8a, 0x00,
+    0xb3, 0xae, 0x4a, 0x74, 0xde, 0x7a, 0x91, 0xb8, 0x7f, 0x6c, 0xa3, 0xdd, 0x49, 0x02, 0xfc, 0xa1,
+    0x6c, 0x79, 0xab, 0xb6, 0x4c, 0xbe, 0xa6, 0x6e, 0x7b, 0xc8, 0x13, 0x2c, 0xec, 0x1a, 0x07, 0x5b,
+    0xb5, 0x1f, 0x89, 0x1f, 0x9c, 0xb7, 0x24, 0x6a, 0x44, 0x80, 0x71, 0x91, 0x12, 0xc7, 0xa8, 0xae,
+    0x3f, 0xbe, 0x5f, 0x98, 0xa7, 0x5e, 0x7a, 0x3e, 0xbc, 0x0e, 0x4e, 0x06, 0x2b, 0xd5, 0xce, 0xc2,
+    0x72, 0x81, 0x7a, 0x28, 0xe9, 0xbc, 0x5c, 0xb4, 0xe7, 0xd6, 0x37, 0x4b, 0x1f, 0xa7, 0xf4, 0x33,
+    0xbd, 0xb7, 0x46, 0xdf, 0xe7, 0xc9, 0x84, 0x86, 0xfa, 0xe8, 0x71, 0xc6, 0x57, 0xb1, 0xa8, 0x9e,
+    0x7b, 0x7a, 0x7d, 0xdf, 0x26, 0xf2, 0xaa, 0x78, 0xbf, 0xf5, 0xd3, 0x66, 0x65, 0x47, 0xcb, 0xeb,
+    0x41, 0x65, 0x0a, 0x5e, 0xcf, 0x14, 0xfc, 0x94, 0x67, 0xc9, 0x56, 0x0c, 0x94, 0xa0, 0x3d, 0x71,
+    0x3e, 0x4e, 0xb1, 0x0b, 0x9f, 0xc6, 0x60, 0xcf, 0x57, 0x72, 0x57, 0xe2, 0x07, 0xdb, 0x54, 0x39,
+    0x77, 0x23, 0x70, 0x89, 0x96, 0xf4, 0x6e, 0xf9, 0x55, 0xb4, 0x7f, 0xae, 0x17, 0x26, 0x64, 0xd6,
+    0xe0, 0xef, 0xc0, 0x35, 0x4c, 0x4c, 0xb3, 0x6c, 0x2b, 0xb1, 0x17, 0x83, 0x59, 0x08, 0x8c, 0x45,
+    0x42, 0x5c, 0x69, 0x98, 0x34, 0xf0, 0xcd, 0x20, 0xa5, 0xf7, 0x6d, 0x9f, 0xec, 0x8e, 0x29, 0xad,
+    0x07, 0x89, 0x15, 0x85, 0x28, 0x32, 0x4c, 0xf3, 0xa7, 0x94, 0x3e, 0x77, 0x87, 0x09, 0x14, 0x6d,
+    0x9e, 0xaa, 0x8d, 0xdb, 0x13, 0x8e, 0x95, 0x5b, 0x2e, 0x5f, 0xf0, 0xfb, 0x96, 0xef, 0xaf, 0x42,
+    0x95, 0x53, 0xd4, 0x5f, 0xf4, 0xbf, 0x9d, 0x6f, 0x43, 0x2f, 0xcf, 0x71, 0x74, 0xbe, 0x25, 0xfc,
+    0x88, 0xc6, 0x3e, 0x38, 0x95, 0x89, 0x22, 0x3e, 0xad, 0xda, 0xd4, 0x64, 0x11, 0x47, 0x3c, 0x32,
+    0xe0, 0xa1, 0xdd, 0x8f, 0xea, 0x4b, 0x46, 0xef, 0xd3, 0xf3, 0x9d, 0x22, 0x87, 0xf0, 0x5d, 0xd6,
+    0x0f, 0x23, 0x14, 0x54, 0xfc, 0xe3, 0x1b, 0xd3, 0x53, 0x18, 0x21, 0x4a, 0x18, 0x3f, 0xfe, 0xb6,
+    0x3d, 0x9b, 0xfa, 0x2e, 0x64, 0xa0, 0x8d, 0x08, 0xb9, 0x10, 0x68, 0xf0, 0x58, 0xdd, 0x14, 0x76,
+    0x72, 0xd9, 0xd7, 0xd2, 0x84, 0x93, 0x2d, 0x9d, 0x49, 0x08, 0x4c, 0x3d, 0xad, 0xd0, 0x67, 0xb0,
+    0xe0, 0x59, 0xde, 0x84, 0x73, 0xd9, 0x6f, 0xe9, 0xc0, 0x2a, 0x9a, 0x3d, 0xa6, 0xea, 0xba, 0x1f,
+    0x30, 0x31, 0xae, 0x66, 0x56, 0x15, 0xaa, 0xa6, 0x67, 0x8c, 0x6f, 0xa8, 0x6c, 0x31, 0xb9, 0x26,
+    0x13, 0x83, 0x8a, 0x98, 0xb4, 0x0f, 0xb3, 0x8e, 0xcf, 0xd7, 0xc7, 0x35, 0xbc, 0x8f, 0xb6, 0x45,
+    0x5e, 0x72, 0x50, 0x3e, 0xb1, 0xdc, 0x47, 0xd4, 0x0e, 0x63, 0xe2, 0x0d, 0x3a, 0x61, 0x6a, 0x2d,
+    0xee, 0x49, 0x98, 0x05, 0x7a, 0x50, 0xf0, 0x63, 0x77, 0xe8, 0xef, 0xab, 0xad, 0xae, 0x8e, 0x10,
+    0x7f, 0xb7, 0x2e, 0x47, 0xbf, 0x38, 0x39, 0x74, 0xe9, 0xe1, 0xc6, 0xc8, 0x89, 0xf7, 0x37, 0xba,
+    0xdc, 0x05, 0xe0, 0x75, 0xbc, 0x36, 0x9c, 0x50, 0xf2, 0xc9, 0xe4, 0x5e, 0xff, 0xa3, 0x14, 0x21,
+    0xf0, 0x74, 0xc4, 0xb9, 0x07, 0x53, 0x4d, 0xef, 0x81, 0x53, 0x39, 0xd4, 0x9d, 0xc4, 0xa8, 0xc2,
+    0xa5, 0xe6, 0x2a, 0x79, 0x3c, 0x15, 0x2f, 0x23, 0x54, 0xd3, 0xc4, 0x19, 0x04, 0xb0, 0xdd, 0xae,
+    0xa7, 0x06, 0xa8, 0xee, 0xe7, 0xbf, 0xb0, 0x08, 0x4d, 0xcc, 0x40, 0xb7, 0x34, 0xc6, 0xd6, 0x6a,
+    0xa0, 0x3c, 0x60, 0xd0, 0x1c, 0xe7, 0x3b, 0x9d, 0x72, 0x54, 0xfc, 0x58, 0x7c, 0xb6, 0xf5, 0x8e,
+    0xbc, 0x34, 0x30, 0x0c, 0x96, 0x7a, 0x20, 0xbf, 0x94, 0x46, 0x19, 0x99, 0xea, 0xca, 0xfe, 0x6d,
+    0x57, 0xfd, 0x99, 0x8c, 0xa3, 0x05, 0xb1, 0x2d, 0xc0, 0x29, 0xde, 0x09, 0xb4, 0x04, 0x6b, 0xed,
+    0x02, 0x51, 0x95, 0x83, 0x46, 0xc1, 0xb0, 0xa9, 0xec, 0xb5, 0x5a, 0xab, 0xdd, 0xc0, 0x6a, 0xaf,
+    0xdd, 0x7e, 0xf2, 0x3f, 0xa3, 0x72, 0x0d, 0x50, 0xe0, 0x40, 0x3a, 0x0c, 0xb4, 0xcd, 0xfb, 0x13,
+    0x60, 0xe9, 0x60, 0x3d, 0x96, 0x61, 0x06, 0xdd, 0xfc, 0xd1, 0xa7, 0x80, 0x1c, 0xf1, 0xe4, 0x48,
+    0x6d, 0x6c, 0xeb, 0xa6, 0xf0, 0xf4, 0x5b, 0x7f, 0x5a, 0xa2, 0x79, 0xe3, 0x3d, 0x95, 0x0b, 0xc7,
+    0x88, 0x8f, 0x1b, 0xfe, 0x30, 0xd7, 0x20, 0xee, 0xcf, 0xcd, 0xce, 0x5c, 0xcd, 0x22, 0x58, 0x9a,
+    0x95, 0x2a, 0xa4, 0xe0, 0xe3, 0x6b, 0x55, 0xed, 0x32, 0x14, 0x6c, 0x04, 0x68, 0xa9, 0x8d, 0xae,
+    0xc3, 0x73, 0xc3, 0x17, 0xcf, 0x20, 0x82, 0x9a, 0xd7, 0x7c, 0x3f, 0x5b, 0x86, 0xa8, 0xb8, 0x5d,
+    0x72, 0x8c, 0x57, 0x2b, 0x29, 0x04, 0x0f, 0x46, 0xd5, 0xe5, 0x99, 0x40, 0x02, 0xf6, 0xb3, 0xa7,
+    0x59, 0x4b, 0x0a, 0xb7, 0x90, 0x35, 0x9f, 0x82, 0xb1, 0xa0, 0xb1, 0x43, 0x82, 0xc8, 0x8c, 0xde,
+    0xa4, 0xd0, 0x35, 0x2e, 0xaf, 0x63, 0x5b, 0xfb, 0x28, 0xd2, 0x57, 0xe9, 0xcd, 0xaa, 0x14, 0xb5,
+    0x68, 0x6f, 0xe8, 0x13, 0x57, 0xde, 0x48, 0x9b, 0xfa, 0x71, 0x90, 0x18, 0x4e, 0x86, 0x3b, 0x33,
+    0x88, 0x0e, 0x77, 0x80, 0xfe, 0xe6, 0x29, 0x69, 0x4f, 0x94, 0x9c, 0xe5, 0x98, 0x3e, 0xbc, 0x36,
+    0x5a, 0x73, 0x44, 0x06, 0x3d, 0x74, 0xda, 0x49, 0xa8, 0x79, 0xc6, 0x1d, 0x15, 0x7d, 0xaf, 0x7c,
+    0x07, 0xc1, 0xba, 0xbc, 0xbc, 0x6d, 0xc6, 0xcc, 0x6f, 0xb7, 0xd7, 0x97, 0xc4, 0xfc, 0x80, 0xde,
+    0xd2, 0x0c, 0x59, 0x1d, 0xb4, 0x3c, 0x2c, 0xa9, 0x9b, 0x8d, 0x79, 0xc2, 0x13, 0x80, 0x89, 0x47,
+    0x99, 0xb9, 0x77, 0x6d, 0x04, 0x87, 0x11, 0x5a, 0xec, 0xc0, 0x02, 0xce, 0xd6, 0x11, 0x22, 0x63,
+    0x35, 0x37, 0xbf, 0x7d, 0xd8, 0xe2, 0xa5, 0xbd, 0xb4, 0xac, 0x32, 0xfd, 0xf3, 0x0b, 0x06, 0xde,
+    0xb4, 0x1a, 0xbc, 0x00, 0x77, 0x04, 0xf8, 0x3a, 0x92, 0x69, 0x27, 0x71, 0x90, 0x8a, 0x17, 0x2c,
+    0xda, 0x1c, 0xe3, 0x70, 0x86, 0x6b, 0xc7, 0xa2, 0xe2, 0xfd, 0x3e, 0x2f, 0x13, 0xbc, 0x37, 0x71,
+    0x58, 0xdc, 0x62, 0x1b, 0x40, 0xf5, 0x22, 0xfa, 0xae, 0xc9, 0xa9, 0xcb, 0xb9, 0x41, 0xe3, 0xe7,
+    0x49, 0xed, 0x91, 0x89, 0xa1, 0x7f, 0x61, 0xfd, 0x5f, 0x44, 0xeb, 0xd5, 0x44, 0x42, 0xe1, 0x91,
+    0x08, 0xb5, 0x98, 0x93, 0x84, 0xb3, 0xca, 0x61, 0xbe, 0x92, 0x9c, 0x7e, 0xf0, 0xfb, 0x91, 0x5e,
+    0xe5, 0x9d, 0x13, 0x91, 0x07, 0xce, 0x6d, 0x9b, 0xf5, 0x0c, 0x8e, 0xf1, 0x51, 0x42, 0xef, 0x88,
+    0x3c, 0x65, 0xf4, 0x20, 0x8f, 0x01, 0xd1, 0x62, 0xa8, 0xb4, 0xba, 0x74, 0xa1, 0x0e, 0x66, 0xcb,
+    0x4d, 0xe7, 0x9b, 0x7a, 0x5d, 0xcf, 0x30, 0x5e, 0x27, 0x03, 0xed, 0x28, 0x7a, 0x0a, 0x89, 0x27,
+    0x6f, 0xe5, 0x37, 0xc8, 0xdc, 0x7a, 0xa2, 0x54, 0x97, 0xce, 0xa2, 0x5d, 0xa3, 0x0e, 0xbf, 0xba,
+    0xe4, 0xd9, 0xef, 0xaa, 0x56, 0xe9, 0xc6, 0xb5, 0x8a, 0xc9, 0x9b, 0x69, 0x50, 0xea, 0xb3, 0x6f,
+    0x83, 0xa8, 0x95, 0x2a, 0xf3, 0x8c, 0x87, 0xd9, 0x8a, 0x8a, 0x1d, 0xe0, 0x31, 0x9e, 0xb9, 0x5e,
+    0x32, 0x65, 0x10, 0x66, 0xf8, 0xc9, 0x5a, 0xeb, 0x81, 0x2c, 0x75, 0xda, 0xc0, 0x6e, 0xb1, 0x4a,
+    0xb7, 0xc0, 0xe2, 0x61, 0x53, 0x8d, 0x79, 0x42, 0x91, 0x45, 0xc1, 0xa2, 0x4e, 0xfc, 0xfd, 0x70,
+    0x12, 0x16, 0x8e, 0x34, 0x01, 0x07, 0xd1, 0x7c, 0xce, 0x7e, 0xef, 0xd7, 0x8e, 0xa8, 0xda, 0xfb,
+    0x96, 0x95, 0xc2, 0x88, 0x18, 0x8f, 0xd5, 0x9a, 0xe0, 0x67, 0xc3, 0xca, 0x1a, 0x01, 0x1d, 0x43,
+    0xf0, 0xef, 0xbd, 0xd3, 0xc7, 0x2b, 0xcc, 0x0d, 0x4f, 0x65, 0x69, 0xa0, 0xf5, 0xaf, 0x92, 0x8f,
+    0xea, 0x8a, 0xa1, 0x46, 0xf0, 0x69, 0x30, 0x41, 0x0d, 0x4b, 0x29, 0x4a, 0x88, 0x5c, 0x73, 0x37,
+    0xa4, 0x1c, 0x3a, 0x25, 0xe0, 0x26, 0xc6, 0x08, 0x6c, 0xd9, 0xd3, 0xd4, 0x6e, 0xea, 0x49, 0x14,
+    0x99, 0xf2, 0x7a, 0x21, 0xf6, 0x64, 0xc2, 0xe2, 0xaf, 0xfc, 0xb6, 0xe0, 0xff, 0x5c, 0xaa, 0x8b,
+    0x06, 0x44, 0x4b, 0xc5, 0x6b, 0x51, 0xa1, 0x4a, 0xac, 0x89, 0xdd, 0xb9, 0xc0, 0x12, 0x5c, 0x55,
+    0x45, 0x4c, 0x89, 0x71, 0x8e, 0x7e, 0x49, 0x31, 0x24, 0xa3, 0x05, 0x63, 0x13, 0xaa, 0x77, 0xb9,
+    0xe4, 0xe6, 0x7b, 0x0a, 0x8c, 0xfb, 0x90, 0xc2, 0x02, 0xe3, 0xa9, 0x13, 0x2d, 0x4f, 0xe1, 0x47,
+    0xcd, 0x23, 0x86, 0xc1, 0x43, 0x6a, 0x07, 0xb6, 0x7d, 0x4e, 0xd9, 0xbd, 0x8d, 0x71, 0xd4, 0xfa,
+    0x76, 0x5b, 0xe2, 0x46, 0xf8, 0xa1, 0xca, 0xc4, 0xbf, 0x30, 0xf5, 0xa6, 0xae, 0x46, 0x5c, 0x35,
+    0x88, 0xf3, 0x75, 0x1a, 0x61, 0xce, 0xc4, 0x39, 0xf5, 0xee, 0xaa, 0x14, 0xa2, 0xa3, 0xd7, 0x45,
+    0x3c, 0x35, 0x1c, 0x66, 0x3a, 0xaf, 0xa9, 0x88, 0x2e, 0x87, 0x68, 0xf9, 0x6f, 0x2b, 0xf3, 0x47,
+    0x71, 0x08, 0x46, 0x9e, 0x91, 0x04, 0xbd, 0x87, 0x3c, 0xa5, 0x55, 0x48, 0xe0, 0xb3, 0x4c, 0x86,
+    0xf7, 0xb3, 0x4f, 0x17, 0xdc, 0x7e, 0xb3, 0x7e, 0x58, 0x73, 0x9a, 0xc4, 0xb3, 0x02, 0xbb, 0x9b,
+    0xb6, 0x09, 0xb0, 0xec, 0xd9, 0xab, 0x42, 0x1c, 0xe2, 0xd6, 0x95, 0x53, 0x5c, 0xde, 0x26, 0xa2,
+    0x32, 0x96, 0x3e, 0x49, 0xf4, 0x1c, 0x06, 0x22, 0xb0, 0x93, 0x3d, 0xeb, 0x7a, 0x5a, 0xa2, 0x8a,
+    0x78, 0xb6, 0xa1, 0x41, 0x32, 0x20, 0x55, 0xa5, 0x18, 0x86, 0x20, 0xa6, 0xf3, 0x00, 0x86, 0xc0,
+    0x9b, 0x98, 0x34, 0xdb, 0x99, 0xe8, 0xae, 0x3b, 0xa7, 0xf8, 0xdf, 0xeb, 0x39, 0x3f, 0xec, 0xcb,
+    0x61, 0x9c, 0xb3, 0x5c, 0x5c, 0xc1, 0x17, 0x13, 0x48, 0x9c, 0x2a, 0x0a, 0x0a, 0xbf, 0x3c, 0xde,
+    0xe8, 0xfd, 0x9a, 0xf0, 0xa9, 0x45, 0xe5, 0x6c, 0x64, 0xbe, 0x06, 0x38, 0x9a, 0x3b, 0xbc, 0x14,
+    0xee, 0x2c, 0xab, 0x96, 0x0b, 0xb4, 0xc8, 0xa5, 0xd5, 0x4b, 0x0c, 0xc5, 0xe3, 0xb9, 0x7d, 0x82,
+    0x21, 0x91, 0x45, 0xd1, 0xce, 0x48, 0x7b, 0x2b, 0x9d, 0xe2, 0x39, 0x30, 0x65, 0x18, 0x83, 0x21,
+    0x15, 0x44, 0x40, 0x6a, 0xc4, 0x8c, 0x60, 0x2a, 0xbf, 0x50, 0xb2, 0x45, 0x42, 0x4c, 0x9f, 0x32,
+    0x26, 0x16, 0xdd, 0x9a, 0x56, 0x9f, 0x14, 0xc8, 0x38, 0xcb, 0xa5, 0xb1, 0x05, 0xb4, 0x08, 0xe7,
+    0xcd, 0x33, 0x28, 0xe5, 0xd0, 0xdd, 0x43, 0x91, 0x79, 0x0d, 0x03, 0x16, 0x7e, 0x31, 0xb7, 0x0c,
+    0x8b, 0x67, 0x49, 0x58, 0xb1, 0x4d, 0xb8, 0x0f, 0xa9, 0xa7, 0x2a, 0x92, 0x4f, 0xab, 0x25, 0xdf,
+    0x11, 0xd5, 0xda, 0x61, 0x6f, 0x79, 0xf0, 0x12, 0xce, 0xf2, 0xc6, 0x0d, 0x46, 0xaa, 0xae, 0x64,
+    0x4d, 0xb1, 0x97, 0x26, 0x72, 0xbf, 0x3e, 0x77, 0x48, 0x85, 0xf4, 0xbc, 0x04, 0x6f, 0x55, 0x18,
+    0x81, 0x6b, 0xc5, 0x3b, 0xbb, 0x31, 0xaa, 0x6a, 0xde, 0x87, 0xc4, 0xb8, 0x99, 0xd0, 0x5d, 0xa0,
+    0x5c, 0x75, 0xcc, 0x9b, 0x85, 0x9e, 0xb7, 0x61, 0x89, 0xa8, 0x95, 0x7d, 0x04, 0x35, 0x9f, 0x50,
+    0xed, 0x62, 0x9f, 0x30, 0x82, 0x40, 0xae, 0xae, 0xb5, 0xe9, 0x99, 0xf3, 0x81, 0x43, 0x98, 0xf9,
+    0xa6, 0xbe, 0xb9, 0x18, 0xe3, 0x18, 0xcf, 0x72, 0x7b, 0x77, 0xb9, 0x71, 0xa4, 0x5b, 0xb3, 0x6a,
+    0x03, 0x66, 0xd9, 0x66, 0x24, 0xa1, 0x17, 0x4b, 0x92, 0xae, 0x84, 0x63, 0x1f, 0x84, 0xfd, 0xc1,
+    0x18, 0xf0, 0xae, 0xae, 0x10, 0x36, 0xc7, 0xe3, 0x62, 0x9c, 0x68, 0x46, 0x15, 0xb0, 0x4e, 0xd3,
+    0x65, 0xe8, 0x92, 0x0d, 0x0d, 0x74, 0xed, 0xd6, 0x8b, 0x84, 0x88, 0x74, 0x22, 0xec, 0xe8, 0xce,
+    0x9c, 0x3d, 0xa2, 0x00, 0xec, 0x76, 0x0d, 0x9a, 0xb5, 0x9b, 0x86, 0x68, 0xb9, 0x94, 0xd6, 0xa2,
+    0x23, 0x9a, 0x8a, 0x31, 0x9c, 0xc4, 0xb2, 0xae, 0xf0, 0x99, 0x49, 0xa7, 0x3f, 0x2b, 0xf4, 0x82,
+    0x9f, 0x23, 0x6d, 0x4b, 0x45, 0x6f, 0xd7, 0x38, 0xdd, 0x87, 0xd1, 0xb4, 0xd8, 0x74, 0xff, 0x02,
+    0xf5, 0x0b, 0x8a, 0xe9, 0x78, 0xcc, 0xf8, 0x51, 0x52, 0x65, 0xf6, 0x05, 0xf8, 0x2c, 0x4f, 0x92,
+    0x59, 0xf6, 0x09, 0x01, 0x68, 0xb9, 0x4e, 0xc8, 0x35, 0x16, 0xad, 0x7a, 0xa5, 0x50, 0x62, 0x77,
+    0x45, 0x94, 0x9a, 0x37, 0xaa, 0xb5, 0x4c, 0x0b, 0x6a, 0x23, 0xce, 0xf9, 0x82, 0x4a, 0x6f, 0xc8,
+    0x09, 0x9b, 0xf1, 0x1d, 0x23, 0x59, 0x67, 0x45, 0x49, 0x4a, 0x20, 0xf7, 0x30, 0xb2, 0xbf, 0x2b,
+    0x01, 0x84, 0x4a, 0x0a, 0x5f, 0x19, 0xa0, 0x71, 0x8d, 0xcd, 0x7c, 0x4d, 0xa6, 0x58, 0xcb, 0xa0,
+    0x02, 0xe6, 0x88, 0x61, 0x76, 0x81, 0xb2, 0xc8, 0x11, 0x60, 0xb9, 0x63, 0xe6, 0x28, 0x29, 0x9c,
+    0xfa, 0x65, 0xa3, 0x4a, 0xe0, 0x05, 0xa8, 0x5b, 0xc5, 0x6a, 0x19, 0x4f, 0xa9, 0xe7, 0xe8, 0x22,
+    0x2b, 0x31, 0x7c, 0x95, 0xe1, 0x03, 0x3d, 0xee, 0x07, 0xf3, 0xa1, 0x6b, 0x8c, 0x48, 0x24, 0x14,
+    0x42, 0x8a, 0xc1, 0x13, 0x1d, 0x37, 0x42, 0x1d, 0x3d, 0x08, 0x3c, 0x6c, 0x44, 0x89, 0xe5, 0xaa,
+    0xec, 0x48, 0xf2, 0x05, 0x06, 0xa3, 0xbe, 0x8e, 0xd0, 0xaf, 0xe4, 0xe6, 0x3e, 0x2e, 0x6c, 0x5c,
+    0x62, 0x08, 0xda, 0xca, 0xee, 0xd6, 0xa2, 0x5a, 0x0f, 0x54, 0xca, 0x8f, 0x13, 0x06, 0xb2, 0x08,
+    0xee, 0xc3, 0x25, 0x6a, 0xf0, 0x16, 0x9e, 0xe3, 0x22, 0xb4, 0x88, 0xa7, 0x9d, 0x33, 0x38, 0xc8,
+    0x0d, 0x89, 0xa5, 0x5d, 0x2f, 0xe2, 0x7d, 0xc2, 0xdd, 0xe4, 0x42, 0xda, 0x20, 0x13, 0xee, 0x44,
+    0xd4, 0xed, 0x8f, 0x51, 0x7b, 0x55, 0xee, 0x30, 0xad, 0xe1, 0x40, 0xc1, 0xd7, 0xb1, 0x1a, 0x6f,
+    0xbc, 0x70, 0xdc, 0x1c, 0x64, 0x4f, 0x2b, 0x8f, 0x87, 0x8e, 0xac, 0x5d, 0xed, 0x08, 0x1f, 0xa9,
+    0xde, 0x84, 0xe9, 0x05, 0x08, 0x67, 0x5c, 0x83, 0x14, 0x1e, 0x72, 0xaf, 0x46, 0x5a, 0xa0, 0x4f,
+    0xd8, 0x2e, 0x45, 0xd2, 0xa7, 0x05, 0x10, 0xbe, 0xa1, 0x0f, 0x65, 0x1c, 0x80, 0xc3, 0x79, 0xee,
+    0x13, 0x70, 0xc7, 0x9a, 0x98, 0x29, 0x83, 0x62, 0x2c, 0x07, 0x0b, 0x18, 0x11, 0x39, 0x03, 0x00,
+    0xd0, 0xa4, 0x6e, 0x05, 0xf3, 0x04, 0xd5, 0x01, 0xdc, 0x05, 0x34, 0x63, 0x96, 0x96, 0xcc, 0x21,
+    0xfe, 0x4a, 0x80, 0x7b, 0x30, 0xe3, 0x0e, 0xba, 0xcb, 0x79, 0xd9, 0x28, 0x86, 0x28, 0x7a, 0x99,
+    0x4c, 0x64, 0x28, 0xe0, 0xe8, 0xb2, 0x0e, 0xe4, 0xec, 0xa8, 0x8e, 0xa2, 0xc2, 0x3d, 0x1e, 0xb7,
+    0xd5, 0x25, 0x22, 0x1c, 0x51, 0xc1, 0x04, 0x75, 0xf0, 0x96, 0xa2, 0x04, 0xb9, 0x23, 0x4f, 0x37,
+    0xb0, 0x06, 0x53, 0x23, 0x7c, 0x29, 0x76, 0xb3, 0x1b, 0x54, 0xcc, 0x1d, 0xc0, 0x06, 0x0e, 0x72,
+    0x28, 0x46, 0x42, 0x67, 0x27, 0x85, 0xef, 0xa6, 0x48, 0xde, 0x87, 0x15, 0xa6, 0xb0, 0x18, 0x78,
+    0x3a, 0x9b, 0xa4, 0x7a, 0x9c, 0x32, 0xe1, 0x8b, 0x2d, 0x43, 0xce, 0xe3, 0x82, 0x21, 0xb1, 0x14,
+    0x77, 0x49, 0xb9, 0x0f, 0x16, 0x06, 0xae, 0xca, 0x99, 0x42, 0x68, 0x77, 0x04, 0x04, 0xb0, 0x22,
+    0x1a, 0x41, 0xc6, 0x2c, 0x10, 0x35, 0xc1, 0x40, 0x5c, 0x4c, 0x2e, 0x5c, 0x92, 0x4d, 0x9a, 0x27,
+    0xf2, 0xb7, 0xdc, 0x5e, 0xc4, 0xbc, 0xbd, 0x28, 0xfc, 0x5a, 0xcb, 0x08, 0xbf, 0xaf, 0x40, 0x67,
+    0x7f, 0x74, 0x20, 0xe0, 0xfe, 0x11, 0xd0, 0x1f, 0x79, 0xb1, 0xab, 0xd6, 0x7f, 0xc3, 0x99, 0xcd,
+    0xb4, 0xd2, 0xa3, 0xfa, 0xb9, 0xee, 0xf5, 0x31, 0xb8, 0x3f, 0xc1, 0xff, 0xd8, 0xf8, 0x8d, 0xd8,
+    0x6f, 0xd3, 0x2f, 0x29, 0xbf, 0x3b, 0xff, 0x51, 0x78, 0x25, 0xc2, 0x2f, 0xaf, 0x26, 0x9f, 0xff,
+    0x00, 0x3d, 0x18, 0xfe, 0x5b, 0xff, 0xe2, 0x1f, 0x9d, 0xfd, 0xc8, 0xfa, 0x5d, 0x96, 0x8e, 0x06,
+    0xb4, 0x61, 0xdf, 0x3d, 0x60, 0xe6, 0xe6, 0x60, 0x72, 0xce, 0x51, 0x5a, 0xff, 0x42, 0x5f, 0xe4,
+    0x5a, 0xfe, 0x85, 0xf9, 0x0f, 0x29, 0x7f, 0x74, 0x31, 0x73, 0x2c, 0xfb, 0xf4, 0x4d, 0xfb, 0xbb,
+    0x72, 0x55, 0x73, 0x93, 0xf2, 0x2b, 0x47, 0xbf, 0x28, 0xd9, 0x6f, 0x5c, 0x2a, 0x6f, 0xc6, 0x5f,
+    0x8e, 0x7b, 0x0d, 0xce, 0x09, 0x6b, 0x97, 0x1a, 0xfc, 0x6b, 0x6b, 0x2f, 0x90, 0xbc, 0x36, 0xf1,
+    0xf8, 0xe1, 0xe2, 0xcf, 0xed, 0xcc, 0x84, 0xff, 0x77, 0x19, 0x4e, 0x78, 0xf5, 0x4e, 0xd0, 0xa0,
+    0xdd, 0x72, 0xfe, 0xe2, 0x0e, 0x3f, 0x81, 0xb6, 0xc5, 0x9f, 0x9a, 0xd9, 0xf0, 0x5c, 0xf0, 0x3c,
+    0xc9, 0xa2, 0x04, 0xac, 0x51, 0xc6, 0x97, 0xcf, 0xa6, 0x5d, 0xb2, 0x95, 0xbe, 0x09, 0xed, 0xad,
+    0x4c, 0xfe, 0x35, 0x56, 0x4d, 0x15, 0xb0, 0x3e, 0x34, 0xc2, 0x7f, 0x52, 0x3e, 0x7a, 0x64, 0x5f,
+    0xf7, 0xac, 0x84, 0xf8, 0xd0, 0xd4, 0x6f, 0x88, 0x46, 0xc7, 0x03, 0xe5, 0x56, 0x4c, 0xee, 0x67,
+    0xe8, 0xf4, 0x61, 0xfd, 0xcf, 0xf6, 0xb7, 0xaa, 0x9d, 0x8e, 0x15, 0x94, 0xc1, 0x43, 0x86, 0xbf,
+    0xea, 0xef, 0x50, 0x7f, 0xaf, 0xdf, 0xfb, 0xf5, 0xf6, 0x1b, 0xc4, 0x7f, 0xba, 0xb9, 0xaa, 0x1e,
+    0x1c, 0x68, 0x8e, 0x83, 0x2e, 0x52, 0x94, 0x67, 0x6e, 0xf2, 0x07, 0x0d, 0x52, 0x0e, 0x1c, 0x6d,
+    0x22, 0xb1, 0x0c, 0x83, 0x9f, 0x8e, 0x2d, 0xef, 0xe4, 0x46, 0x84, 0x67, 0xbf, 0x9e, 0xbc, 0x19,
+    0x46, 0x22, 0x35, 0x20, 0xee, 0x50, 0x7b, 0xaf, 0xbb, 0xbd, 0x7a, 0xbb, 0x27, 0xa6, 0xb2, 0x1f,
+    0xbf, 0x23, 0x77, 0xe5, 0x27, 0x22, 0xb2, 0xef, 0x82, 0x66, 0x04, 0xe0, 0xe9, 0xf7, 0x23, 0x3a,
+    0xb3, 0x7f, 0xd5, 0x52, 0xe6, 0x18, 0x64, 0x8e, 0x9b, 0x6d, 0x77, 0x3c, 0x6b, 0xbf, 0x87, 0xb1,
+    0xa7, 0xf5, 0xeb, 0x16, 0xb1, 0xcc, 0xde, 0x82, 0x8f, 0xb0, 0x56, 0x7d, 0x5d, 0x5f, 0x8f, 0xaa,
+    0xbb, 0x70, 0xb8, 0x71, 0xf3, 0x76, 0xb5, 0x6a, 0xd0, 0xfe, 0x89, 0xd3, 0x7f, 0x94, 0x5d, 0x78,
+    0xef, 0xcf, 0x87, 0x75, 0xb9, 0xb2, 0x6d, 0xe1, 0xe1, 0x1f, 0xb6, 0xb4, 0xdb, 0x71, 0xa3, 0xe4,
+    0x9c, 0x1d, 0x22, 0xf6, 0x6c, 0xfb, 0xe2, 0x1d, 0x0c, 0x50, 0xd3, 0xba, 0x0d, 0x36, 0xd2, 0xca,
+    0x5b, 0x5b, 0xc5, 0xf4, 0xab, 0xeb, 0x97, 0xe9, 0xf3, 0xf3, 0xeb, 0x1e, 0x1d, 0x58, 0x6f, 0xad,
+    0xbe, 0x96, 0xe3, 0x96, 0x8a, 0x13, 0xe7, 0xcb, 0x29, 0x9c, 0x46, 0x37, 0x44, 0x77, 0x84, 0x2d,
+    0x8d, 0x2a, 0xdf, 0x99, 0xdf, 0x08, 0x2b, 0xbe, 0xe3, 0xe2, 0x03, 0xad, 0x18, 0xe8, 0xce, 0x41,
+    0xd3, 0x8d, 0x54, 0x1a, 0xed, 0x24, 0xce, 0xef, 0x0f, 0x73, 0xd3, 0x18, 0x95, 0xab, 0x9a, 0xa0,
+    0x92, 0x05, 0xed, 0xb7, 0x12, 0xfe, 0xb5, 0xf1, 0x3e, 0x56, 0x7f, 0x63, 0x3f, 0xb0, 0xc6, 0x3f,
+    0xe4, 0xff, 0xab, 0x65, 0xc6, 0x53, 0x37, 0x97, 0x0c, 0xc0, 0x52, 0xaf, 0x9d, 0x3c, 0xf2, 0x70,
+    0x76, 0xf7, 0x37, 0xcc, 0x75, 0x2f, 0x96, 0x1f, 0xc9, 0x0c, 0xc0, 0xd4, 0x5c, 0xa7, 0xe9, 0x6d,
+    0x2b, 0x28, 0xe7, 0xfc, 0xc6, 0xc5, 0xa7, 0xa5, 0xcd, 0xe5, 0xa7, 0x01, 0x18, 0x53, 0xe6, 0xa6,
+    0xf8, 0x1f, 0x1a, 0xbf, 0x3d, 0x97, 0x0f, 0x85, 0x39, 0xc6, 0x89, 0x52, 0x69, 0x81, 0xa3, 0x48,
+    0x1f, 0xbb, 0xee, 0x1f, 0xa7, 0xdd, 0x78, 0xbd, 0xbf, 0x7a, 0x70, 0x77, 0x85, 0x92, 0xe2, 0x5f,
+    0x82, 0x92, 0x4a, 0x62, 0x32, 0x5c, 0xcb, 0xf9, 0x9b, 0xa5, 0x1f, 0xcb, 0xad, 0x84, 0x81, 0x7e,
+    0xe7, 0xf6, 0xbe, 0x3d, 0x3e, 0x44, 0xdd, 0x8c, 0xe0, 0x96, 0x74, 0x1b, 0x9e, 0x15, 0xfd, 0x4f,
+    0x89, 0xb1, 0xd0, 0x0e, 0x54, 0x39, 0x95, 0xf0, 0xd3, 0x80, 0x54, 0xff, 0xe4, 0xcf, 0xe9, 0x09,
+    0x7b, 0xf2, 0x30, 0x87, 0xce, 0xdc, 0xf2, 0xe8, 0xe3, 0xdd, 0x81, 0x75, 0x3e, 0xb3, 0x3a, 0xdb,
+    0xb7, 0xdd, 0x90, 0x47, 0xc3, 0xa7, 0x13, 0x88, 0x29, 0x46, 0xf4, 0x15, 0x78, 0xe7, 0x1a, 0xd5,
+    0xc5, 0xd2, 0x1c, 0xac, 0xf8, 0xc1, 0xe6, 0xa4, 0xae, 0xea, 0xad, 0x73, 0x31, 0x8e, 0x96, 0x5e,
+    0xb2, 0xd4, 0xf3, 0xcb, 0x97, 0xdd, 0x8e, 0xc0, 0x08, 0x0b, 0xc7, 0x93, 0x3d, 0x01, 0x04, 0xc6,
+    0x0e, 0x31, 0x84, 0xdb, 0x98, 0x36, 0x1d, 0xa6, 0xb5, 0xe8, 0x2e, 0x2d, 0x4a, 0x97, 0x42, 0xf5,
+    0x1c, 0x84, 0xe6, 0xa7, 0x49, 0xa4, 0x1f, 0x7f, 0xe2, 0x07, 0x51, 0xa1, 0x5f, 0x51, 0x55, 0x8d,
+    0x2a, 0x68, 0xd0, 0xdc, 0xea, 0xe5, 0xf4, 0xc3, 0xf8, 0x1e, 0xf0, 0x84, 0x2e, 0x9d, 0xc2, 0xe8,
+    0x24, 0x6e, 0xd1, 0x7e, 0xb5, 0xb7, 0xf8, 0x79, 0x81, 0x85, 0x46, 0x52, 0xf8, 0xc7, 0x4b, 0xf8,
+    0x21, 0xf0, 0xe3, 0x15, 0xb0, 0xf7, 0xaa, 0x6c, 0x17, 0xdb, 0x42, 0x73, 0xee, 0xad, 0xbf, 0xc3,
+    0x8a, 0x41, 0x6a, 0x2d, 0x56, 0x77, 0xf6, 0x34, 0x89, 0xc2, 0xa6, 0x80, 0x1e, 0x5c, 0xea, 0x6e,
+    0x9e, 0x6c, 0xb6, 0x67, 0xd8, 0xf8, 0x63, 0x93, 0x6f, 0xf7, 0xbe, 0x16, 0x12, 0xcd, 0xea, 0xce,
+    0xd7, 0xd1, 0xec, 0x3c, 0x05, 0xeb, 0x94, 0x1b, 0xd1, 0x5c, 0xa0, 0x1a, 0xa3, 0xde, 0x02, 0x49,
+    0x29, 0x35, 0x35, 0xfb, 0x8e, 0x6d, 0xb1, 0x21, 0xbe, 0x0a, 0x14, 0x05, 0x37, 0x44, 0x18, 0xef,
+    0x31, 0x73, 0xe6, 0x14, 0xee, 0x9a, 0x93, 0xed, 0x57, 0xe3, 0x83, 0xd8, 0xfa, 0x8c, 0x9b, 0xa7,
+    0xf3, 0xef, 0x6b, 0x79, 0xb5, 0xf0, 0x7a, 0x1c, 0x06, 0xc6, 0xab, 0x6a, 0x27, 0xc6, 0x51, 0x2c,
+    0x9d, 0xc9, 0xf7, 0x96, 0x23, 0x60, 0x97, 0x57, 0xb8, 0x49, 0x2a, 0x7c, 0xad, 0xf6, 0x0c, 0xa4,
+    0xf3, 0xa8, 0x8f, 0xd8, 0x91, 0x93, 0x8b, 0x18, 0xb5, 0x5a, 0xee, 0x6d, 0x07, 0x6a, 0xd8, 0x4c,
+    0x5e, 0xf2, 0x13, 0x26, 0xbe, 0x76, 0xff, 0x01, 0x50, 0xdd, 0xfa, 0xf3, 0x0b, 0xe0, 0x03, 0x41,
+    0xca, 0x3f, 0x04, 0x76, 0xa4, 0xb3, 0x7a, 0x98, 0x60, 0x05, 0xff, 0xc6, 0x6e, 0x0c, 0x47, 0x14,
+    0xbc, 0x07, 0xa2, 0x60, 0x9d, 0xcc, 0xdb, 0xe0, 0xdf, 0x80, 0x79, 0x3a, 0x8f, 0xa9, 0x8d, 0x47,
+    0x1d, 0xb0, 0x73, 0x09, 0xe4, 0x1e, 0x61, 0xde, 0x9a, 0x71, 0x12, 0x94, 0x26, 0x40, 0x8e, 0x29,
+    0x10, 0xa7, 0xef, 0xc2, 0x99, 0x93, 0xc9, 0x4e, 0x46, 0x18, 0x5b, 0x13, 0x3e, 0x64, 0x81, 0xfc,
+    0x33, 0xe1, 0xde, 0x3e, 0xec, 0x57, 0x69, 0x20, 0x14, 0xf7, 0xd6, 0x56, 0x06, 0x92, 0x58, 0x2c,
+    0x06, 0x23, 0xf3, 0xfd, 0x2b, 0x39, 0x47, 0x30, 0x4a, 0xa8, 0xc1, 0x6c, 0xa8, 0x87, 0x33, 0x85,
+    0xdc, 0xb2, 0x91, 0xe7, 0x83, 0x6b, 0x25, 0x4a, 0x0a, 0xd9, 0x85, 0x5e, 0x22, 0xe2, 0x34, 0x20,
+    0x8e, 0xe2, 0x18, 0x80, 0x6a, 0x89, 0x2d, 0xc1, 0xa1, 0x58, 0x4f, 0xf6, 0x48, 0x55, 0x6a, 0xa6,
+    0x60, 0x1e, 0x4c, 0x4d, 0x66, 0x07, 0xcd, 0xbe, 0x21, 0xe4, 0x07, 0x2f, 0x87, 0x79, 0x12, 0xa7,
+    0x41, 0xe2, 0xc9, 0x2b, 0x85, 0x21, 0x64, 0x0c, 0x83, 0x3c, 0x91, 0x0f, 0x36, 0x49, 0xe2, 0x89,
+    0x9b, 0x25, 0x04, 0x39, 0x3f, 0xf8, 0x0f, 0x7e, 0x7a, 0x31, 0xba, 0x98, 0x01, 0x00, 0x2c, 0x98,
+    0x9a, 0x6b, 0xf6, 0xce, 0xd4, 0xf1, 0x33, 0xa8, 0x82, 0x94, 0x79, 0xa4, 0x3b, 0x13, 0x23, 0xf5,
+    0x0b, 0xc2, 0x4d, 0x74, 0x43, 0xb3, 0xc7, 0x82, 0x38, 0x7f, 0x71, 0x55, 0x6d, 0x70, 0xe0, 0xc7,
+    0x19, 0x00, 0x5f, 0x3e, 0x7d, 0x75, 0xc3, 0xfa, 0x65, 0xdc, 0xca, 0x85, 0x43, 0xe3, 0x8c, 0x7e,
+    0xc1, 0x62, 0x7e, 0xc8, 0xab, 0xd4, 0xea, 0x0c, 0xe6, 0xbb, 0x62, 0x81, 0x18, 0x4a, 0x84, 0x76,
+    0x2d, 0xb0, 0x8e, 0xfe, 0xe3, 0x37, 0x83, 0xd5, 0x0a, 0x93, 0xcb, 0x17, 0xa6, 0xa3, 0xbd, 0xa4,
+    0x26, 0x5a, 0x03, 0x18, 0x3b, 0x1e, 0x2a, 0x80, 0x00, 0xe9, 0xab, 0x34, 0xb6, 0xfb, 0xcc, 0x0c,
+    0x06, 0x54, 0xa3, 0x2d, 0x7b, 0xad, 0x95, 0x61, 0x9d, 0x4a, 0xed, 0xf5, 0x20, 0xc7, 0x79, 0xa2,
+    0xbc, 0x4c, 0x9b, 0xa2, 0x9f, 0x64, 0x45, 0xfe, 0x16, 0x20, 0x09, 0xda, 0x77, 0x14, 0x51, 0x56,
+    0x44, 0x85, 0xc5, 0x82, 0x32, 0xcd, 0xcc, 0x4a, 0xe4, 0x21, 0xaa, 0xa3, 0x3b, 0x20, 0x3e, 0x07,
+    0xb0, 0x01, 0x3f, 0xaa, 0x63, 0xba, 0x4e, 0xba, 0x9e, 0x52, 0x53, 0x0f, 0x01, 0x3c, 0xc9, 0x6c,
+    0x34, 0x52, 0xee, 0xf1, 0xdc, 0x66, 0x23, 0x01, 0x39, 0x74, 0x91, 0x59, 0x73, 0x6f, 0x94, 0x51,
+    0x52, 0x69, 0xbd, 0x00, 0x07, 0x1e, 0xee, 0x0d, 0xbc, 0x30, 0x89, 0x5b, 0x8c, 0x9d, 0x29, 0xe8,
+    0x49, 0x64, 0xcb, 0x48, 0x97, 0xa5, 0x56, 0x26, 0x62, 0x5c, 0x80, 0xdf, 0xc7, 0x4b, 0x86, 0xfc,
+    0x0f, 0x3e, 0x1b, 0xca, 0x95, 0x96, 0xd1, 0x3f, 0x20, 0xc4, 0xca, 0xf8, 0xf6, 0x17, 0x39, 0x73,
+    0x8f, 0xf0, 0xba, 0x83, 0x35, 0xd0, 0xaa, 0x14, 0x2f, 0x1a, 0x47, 0xd1, 0xd7, 0xce, 0x52, 0x5c,
+    0xa0, 0x78, 0xe1, 0x3a, 0x80, 0x45, 0x82, 0xa7, 0x41, 0xdd, 0xe7, 0x51, 0x34, 0xa0, 0xa9, 0xd9,
+    0x56, 0x57, 0x8a, 0x18, 0x7d, 0x5c, 0x68, 0x5b, 0x74, 0xf3, 0x46, 0xbb, 0x16, 0x6f, 0x58, 0x09,
+    0xa8, 0x03, 0x69, 0x4a, 0x43, 0x92, 0xc2, 0xea, 0xee, 0x23, 0x2c, 0xed, 0x8c, 0x66, 0xc3, 0xa2,
+    0x70, 0x11, 0x89, 0x79, 0x06, 0xec, 0x9e, 0x67, 0x22, 0xec, 0x15, 0xb6, 0x6d, 0x27, 0x3c, 0x91,
+    0xae, 0x08, 0xd0, 0x5a, 0x49, 0x95, 0xc1, 0x2a, 0x72, 0x85, 0x30, 0x74, 0xd5, 0x25, 0x4c, 0x25,
+    0x40, 0xe5, 0x05, 0xd3, 0xb0, 0x84, 0xee, 0x06, 0xe2, 0x58, 0xe5, 0x6b, 0x2c, 0xc3, 0xc4, 0xea,
+    0xd6, 0xbd, 0x1f, 0x3f, 0x75, 0xd8, 0x50, 0xb7, 0xe4, 0x5b, 0xe0, 0xdf, 0x19, 0x89, 0xe8, 0x67,
+    0x71, 0x81, 0x3d, 0x15, 0x8e, 0x2e, 0xf4, 0x9a, 0x3c, 0xcf, 0x79, 0x58, 0xd0, 0x68, 0xbd, 0x43,
+    0xb1, 0xda, 0x89, 0x67, 0x93, 0x9a, 0x23, 0x73, 0xe4, 0x4e, 0x5f, 0x45, 0x0b, 0xcf, 0x5f, 0xcd,
+    0xfa, 0xd9, 0x26, 0x01, 0xf5, 0xde, 0x21, 0xbb, 0xcf, 0x02, 0x7a, 0x1b, 0xba, 0x11, 0x29, 0xbd,
+    0x87, 0x66, 0x29, 0xfe, 0x20, 0xaa, 0x9a, 0xdc, 0x01, 0x3c, 0x62, 0xee, 0x28, 0x52, 0x05, 0x5c,
+    0x83, 0x8d, 0x24, 0x08, 0xf5, 0x75, 0x21, 0xe2, 0xb8, 0x39, 0x78, 0x01, 0x55, 0x89, 0xf6, 0xc4,
+    0xef, 0xd3, 0x3b, 0x13, 0xc7, 0x12, 0xef, 0xb0, 0xe4, 0x59, 0x51, 0x09, 0x51, 0x67, 0x06, 0x0f,
+    0x41, 0xe2, 0x52, 0xea, 0x5b, 0x18, 0x71, 0xf3, 0x7b, 0x10, 0xce, 0xb2, 0x29, 0x74, 0x74, 0x32,
+    0xab, 0x8e, 0x06, 0x6e, 0x12, 0xe5, 0x20, 0x0f, 0xa4, 0xfd, 0x0f, 0x7c, 0x97, 0x05, 0x47, 0xb9,
+    0xd3, 0x45, 0x76, 0x96, 0xc0, 0x27, 0xf5, 0x3f, 0xe4, 0xb9, 0x4f, 0x9a, 0x39, 0x72, 0x65, 0xfa,
+    0x36, 0x11, 0xf8, 0xbb, 0xeb, 0x21, 0xc7, 0x46, 0xc6, 0x74, 0xa4, 0x59, 0xcf, 0x7d, 0x8a, 0x6a,
+    0xdc, 0xdd, 0x3d, 0x21, 0x07, 0x5c, 0x5e, 0x25, 0xfc, 0x77, 0x18, 0x72, 0x22, 0xd9, 0x84, 0xf6,
+    0xc5, 0x8a, 0xc0, 0x92, 0xe7, 0x85, 0xea, 0x53, 0x71, 0xeb, 0x0c, 0xf3, 0x4a, 0x5f, 0xab, 0x3f,
+    0x2c, 0x62, 0xae, 0xdf, 0xe2, 0x98, 0xaa, 0x72, 0xcf, 0x39, 0x46, 0x76, 0x88, 0x15, 0x70, 0x86,
+    0xc0, 0x6f, 0x24, 0xe5, 0x48, 0x67, 0xd4, 0x20, 0xfe, 0x74, 0x1a, 0xb4, 0x68, 0xe9, 0xcf, 0x2d,
+    0xb1, 0xb2, 0x84, 0x2b, 0xbb, 0xec, 0x4c, 0xc4, 0xb3, 0x16, 0x10, 0x2b, 0x96, 0x9d, 0x3c, 0x3a,
+    0x31, 0x41, 0x56, 0x0e, 0xa9, 0x5c, 0x60, 0x60, 0x41, 0x1c, 0x76, 0x00, 0x12, 0x0a, 0x46, 0x07,
+    0xb9, 0x5d, 0xf9, 0xcd, 0x13, 0xf4, 0xc3, 0xb4, 0x66, 0x59, 0x12, 0x09, 0x90, 0x68, 0x8c, 0xcd,
+    0x96, 0xb0, 0x1f, 0x8a, 0x57, 0x32, 0x77, 0x2a, 0x72, 0x81, 0x9b, 0x26, 0xf4, 0xca, 0x4e, 0x8e,
+    0x5c, 0xda, 0xaa, 0xad, 0x6d, 0x14, 0x46, 0x37, 0xfa, 0xa3, 0x8b, 0x10, 0x8d, 0xde, 0x4d, 0xfb,
+    0x0d, 0xf3, 0xef, 0x4f, 0x99, 0x30, 0x66, 0x6d, 0xfa, 0x87, 0x94, 0x79, 0x93, 0xe6, 0xcb, 0x89,
+    0x4f, 0x9b, 0x78, 0x2e, 0x8c, 0xa4, 0x33, 0x8a, 0x63, 0xbd, 0x14, 0x9f, 0x40, 0xfa, 0x67, 0x67,
+    0x7d, 0xad, 0xb1, 0xb7, 0x8e, 0x63, 0xc1, 0x52, 0x0f, 0x9f, 0x61, 0xbe, 0x2a, 0xed, 0xe6, 0x25,
+    0x93, 0xc2, 0xae, 0x3e, 0x28, 0xa1, 0xad, 0x7a, 0x1c, 0xf7, 0x8a, 0xb5, 0x85, 0x12, 0xc5, 0xe0,
+    0x46, 0xf7, 0x97, 0xfd, 0xaf, 0x44, 0x78, 0x32, 0xf9, 0xf0, 0x2e, 0x34, 0xfa, 0x62, 0xc0, 0x97,
+    0xc8, 0xf3, 0xa1, 0x3b, 0x96, 0x7c, 0xaf, 0x81, 0xcf, 0xb5, 0x56, 0x32, 0xc8, 0x9e, 0x5c, 0x3e,
+    0x6a, 0x59, 0x17, 0xa3, 0xe7, 0xf6, 0x11, 0xcf, 0x39, 0x5b, 0x4a, 0x3e, 0x16, 0xed, 0xcd, 0x87,
+    0xf6, 0x7a, 0xbe, 0xde, 0x94, 0x55, 0xaf, 0xe4, 0x1b, 0xda, 0x28, 0x89, 0x49, 0x98, 0xab, 0x8f,
+    0x23, 0xcf, 0xbe, 0xff, 0xb1, 0xc2, 0x7e, 0xe2, 0xee, 0x4b, 0x98, 0x6a, 0xf5, 0x1a, 0xca, 0xfc,
+    0x7e, 0x15, 0xf5, 0x37, 0x1e, 0x43, 0xbd, 0x7e, 0x89, 0xdd, 0x42, 0xbc, 0xc3, 0x8a, 0xe8, 0x19,
+    0xfa, 0x78, 0xc6, 0x75, 0x6e, 0x02, 0xf5, 0x17, 0x5c, 0x0a, 0xb2, 0x2f, 0xca, 0xff, 0x15, 0xc1,
+    0x1f, 0x23, 0x78, 0x98, 0x93, 0xb9, 0x74, 0xf9, 0x53, 0x80, 0xaa, 0x0a, 0x21, 0x07, 0xc6, 0x6e,
+    0x59, 0xc5, 0x17, 0xa8, 0xa8, 0xe5, 0x90, 0x2b, 0x5b, 0xf7, 0x8c, 0xbf, 0x84, 0xb3, 0x55, 0xb9,
+    0x22, 0x25, 0xe7, 0x17, 0x5c, 0x71, 0xc2, 0x0a, 0xde, 0x9d, 0xa8, 0xd5, 0x66, 0xcd, 0xa1, 0xc2,
+    0x02, 0x1e, 0x59, 0xaa, 0x6c, 0xad, 0x14, 0x3a, 0xd9, 0xf1, 0xce, 0x38, 0x9b, 0x07, 0x10, 0xe3,
+    0x32, 0xad, 0xe8, 0x39, 0xce, 0x10, 0x5c, 0xf2, 0xed, 0x73, 0x89, 0xba, 0xb3, 0x7f, 0x5d, 0xce,
+    0x88, 0x5f, 0xc0, 0xbc, 0x52, 0x1b, 0x03, 0x69, 0x2f, 0x43, 0x1d, 0xae, 0x1b, 0x06, 0xf1, 0x8a,
+    0xbb, 0x69, 0x1f, 0xf2, 0x8e, 0x73, 0x50, 0x40, 0x98, 0x9b, 0x20, 0x61, 0x65, 0x66, 0x11, 0xcf,
+    0xf1, 0xaa, 0x62, 0xa4, 0x86, 0x32, 0x0f, 0x0d, 0xf1, 0x67, 0xc1, 0x90, 0x2f, 0x70, 0xce, 0xf0,
+    0x53, 0xea, 0x24, 0xaa, 0x8d, 0x32, 0xfc, 0x0a, 0xca, 0xf0, 0x43, 0xbb, 0xa9, 0x79, 0x26, 0xfb,
+    0x19, 0xc8, 0x56, 0xf1, 0xe8, 0x63, 0x82, 0x0e, 0x1d, 0x27, 0x99, 0x56, 0x10, 0xa4, 0x81, 0x7d,
+    0x62, 0xc3, 0xf6, 0xa3, 0xca, 0x78, 0xee, 0xd5, 0xd6, 0x9d, 0x01, 0x07, 0x04, 0xe9, 0x37, 0x18,
+    0x61, 0x36, 0x40, 0x65, 0x27, 0x63, 0x31, 0x48, 0x10, 0xb7, 0x34, 0x67, 0xab, 0x51, 0x21, 0x94,
+    0xf9, 0x46, 0xa3, 0x04, 0x09, 0x0a, 0xd2, 0x86, 0x7e, 0xd9, 0x92, 0x2e, 0xaf, 0x03, 0x8f, 0xd4,
+    0x0a, 0x9c, 0x4a, 0xdc, 0xca, 0xd1, 0x65, 0x13, 0xb5, 0x50, 0xfb, 0x0b, 0xc0, 0x46, 0x0e, 0x0d,
+    0xc3, 0x23, 0x66, 0x70, 0xd2, 0x19, 0xa0, 0xdb, 0x97, 0xc1, 0x24, 0x36, 0x9c, 0xcc, 0x3b, 0x3e,
+    0x3c, 0xef, 0x89, 0x83, 0x3c, 0xa1, 0x71, 0xf2, 0xea, 0x5b, 0xce, 0xee, 0xfb, 0xda, 0x4e, 0x01,
+    0x22, 0x23, 0xda, 0xe5, 0xc5, 0x2c, 0x0a, 0x11, 0xe5, 0x30, 0x02, 0xac, 0x53, 0x24, 0x46, 0x47,
+    0x16, 0xfb, 0x9c, 0xef, 0x37, 0x31, 0x91, 0x6c, 0x06, 0x2f, 0x7f, 0xab, 0xfd, 0xa1, 0xd3, 0x4c,
+    0x6c, 0xbf, 0xe6, 0x97, 0x2a, 0xf8, 0x6f, 0x29, 0x72, 0x06, 0xfa, 0xa0, 0xfb, 0xc6, 0xab, 0x74,
+    0x99, 0x21, 0xac, 0x1b, 0x58, 0xe4, 0x8c, 0xcd, 0x15, 0x52, 0xc3, 0x28, 0xd6, 0x03, 0xaa, 0x65,
+    0xd5, 0xc6, 0x20, 0x7e, 0x12, 0x9a, 0x96, 0xae, 0xb5, 0xaa, 0xb8, 0xc8, 0x67, 0xa8, 0xd3, 0x33,
+    0xb0, 0x6e, 0xef, 0x7a, 0xbb, 0xa4, 0x04, 0xf1, 0xad, 0x6e, 0x3c, 0x0f, 0xc5, 0xf0, 0x2a, 0xa4,
+    0x99, 0x50, 0x67, 0x6e, 0x44, 0xaa, 0x31, 0xff, 0xac, 0x79, 0xce, 0x24, 0xd5, 0x10, 0x66, 0x48,
+    0xbd, 0x30, 0x6e, 0x0f, 0x3a, 0xea, 0xfc, 0x8b, 0xc3, 0x9f, 0x33, 0x15, 0x3d, 0x2f, 0x4e, 0xd5,
+    0x00, 0xe2, 0x68, 0xd9, 0x76, 0x8f, 0x6d, 0x4e, 0x8a, 0x80, 0xa0, 0xc8, 0x2e, 0x23, 0x03, 0x8e,
+    0x5a, 0xaf, 0xd2, 0x64, 0xac, 0x15, 0xd2, 0xf3, 0xbc, 0xa1, 0x02, 0x3e, 0xae, 0x05, 0x2f, 0x43,
+    0xc4, 0x3d, 0x51, 0xcb, 0x8e, 0x98, 0xfd, 0x7c, 0xad, 0xe2, 0xfe, 0xa3, 0x29, 0x77, 0xa6, 0xdc,
+    0x0e, 0xef, 0x1d, 0xc2, 0xea, 0xf5, 0x77, 0x98, 0x8b, 0x9c, 0xbb, 0xe2, 0x1c, 0x16, 0x4f, 0xa6,
+    0x3b, 0x53, 0x69, 0x26, 0xf7, 0xce, 0xe7, 0xac, 0x56, 0x1b, 0x82, 0x4c, 0x96, 0x61, 0x32, 0xc2,
+    0xca, 0x0e, 0x47, 0x2c, 0xc9, 0x30, 0x8e, 0xc1, 0x63, 0xed, 0xed, 0xdc, 0xaa, 0x3f, 0x9e, 0x4d,
+    0x71, 0x8a, 0x8d, 0x4c, 0x0b, 0x33, 0x94, 0x54, 0x56, 0xd3, 0xd0, 0x38, 0xdb, 0xcc, 0xb0, 0x0c,
+    0xd0, 0xce, 0x3b, 0x92, 0x67, 0x7c, 0x77, 0x2c, 0x7c, 0x4d, 0x54, 0x71, 0xce, 0xf9, 0xaf, 0x4f,
+    0x5c, 0xb9, 0x76, 0x51, 0xf4, 0x58, 0x78, 0xb8, 0x01, 0x18, 0x8b, 0xa1, 0xa8, 0xd0, 0x90, 0x36,
+    0x79, 0xe2, 0x70, 0x60, 0xde, 0x11, 0x61, 0x4c, 0x09, 0xe7, 0x2c, 0x9e, 0x2c, 0x6f, 0x32, 0x0b,
+    0xc1, 0xc0, 0x21, 0x14, 0x18, 0x7c, 0x47, 0x3f, 0x75, 0xba, 0x57, 0x1b, 0x46, 0x11, 0x4b, 0xdd,
+    0x78, 0x92, 0x37, 0x52, 0x91, 0x30, 0x39, 0x43, 0x1f, 0xcf, 0x7a, 0x47, 0x21, 0xcb, 0x5c, 0xdd,
+    0x38, 0x2a, 0xd0, 0xae, 0x38, 0xcf, 0x18, 0x74, 0x85, 0xab, 0xe5, 0x75, 0x2c, 0x4c, 0xde, 0x97,
+    0x2f, 0x47, 0x06, 0x43, 0xce, 0x26, 0x0a, 0x3a, 0x94, 0x49, 0x62, 0x9e, 0x63, 0x83, 0x6d, 0x6d,
+    0x81, 0x63, 0x07, 0x86, 0x40, 0x67, 0x8b, 0x26, 0x07, 0x56, 0xcd, 0x55, 0x82, 0xde, 0x09, 0x28,
+    0x53, 0xbe, 0x03, 0xbd, 0x72, 0x97, 0x63, 0x4b, 0x83, 0xf8, 0x31, 0x55, 0x06, 0x94, 0xa2, 0x48,
+    0xff, 0x89, 0x63, 0xf7, 0x30, 0x14, 0x17, 0x22, 0x4b, 0x8e, 0x41, 0x02, 0x72, 0xa6, 0x48, 0xf7,
+    0x5f, 0x0b, 0x93, 0xea, 0xcd, 0xf9, 0xa3, 0x9d, 0xfe, 0x4f, 0x92, 0x7b, 0x03, 0x93, 0x0e, 0xf8,
+    0xfe, 0x3b, 0x57, 0x95, 0xdb, 0x46, 0xba, 0xce, 0x18, 0xd8, 0xc2, 0xac, 0x06, 0xe1, 0xb9, 0x33,
+    0x60, 0xda, 0x2b, 0x3a, 0xa5, 0xeb, 0x9b, 0x56, 0x6b, 0x8f, 0x3c, 0x71, 0xbe, 0x0b, 0x93, 0x8e,
+    0xd7, 0xdf, 0x77, 0x1b, 0x1b, 0x55, 0x47, 0x82, 0x31, 0xc0, 0x50, 0x68, 0xda, 0x62, 0x20, 0xeb,
+    0x39, 0x54, 0x33, 0x33, 0x4a, 0x81, 0x11, 0x90, 0x06, 0x53, 0xa7, 0xd4, 0xb3, 0xc4, 0xe4, 0x67,
+    0x26, 0x84, 0x4d, 0xe6, 0x57, 0x29, 0x96, 0xc8, 0xd6, 0x91, 0x74, 0x53, 0x73, 0xc0, 0x73, 0xfe,
+    0x19, 0x19, 0x70, 0x47, 0x03, 0x0f, 0xad, 0xd3, 0xbd, 0x55, 0x06, 0xf7, 0x0a, 0x0b, 0xcb, 0x97,
+    0xf4, 0xb3, 0xa7, 0x5b, 0x29, 0xc2, 0x19, 0xba, 0x08, 0x04, 0xb9, 0xdd, 0xf0, 0xe6, 0x08, 0x5b,
+    0xe9, 0x72, 0x97, 0x5c, 0x43, 0xd8, 0x4d, 0x6e, 0x46, 0x9f, 0xf4, 0xba, 0xe5, 0xa5, 0x5e, 0x64,
+    0xc5, 0x52, 0x06, 0x91, 0xc2, 0xa5, 0x4e, 0x56, 0xd9, 0xd1, 0xde, 0xe7, 0xcb, 0x71, 0xbd, 0x11,
+    0xac, 0x26, 0x09, 0x3f, 0x75, 0xd8, 0x72, 0x17, 0x83, 0x36, 0x54, 0xe7, 0xd1, 0x31, 0x7c, 0x78,
+    0xf8, 0x62, 0x11, 0x94, 0x78, 0x27, 0x0b, 0xab, 0xb5, 0x96, 0xca, 0x86, 0x29, 0x3e, 0x69, 0xd6,
+    0x74, 0x57, 0x6e, 0x31, 0xac, 0x73, 0x03, 0x33, 0x43, 0xf1, 0xc8, 0x1b, 0xae, 0x3b, 0x90, 0x45,
+    0xa1, 0xef, 0x94, 0x8a, 0x6a, 0x62, 0x3c, 0x33, 0xe6, 0x38, 0xd4, 0x71, 0x25, 0x30, 0x13, 0xf3,
+    0xd0, 0xaf, 0xcc, 0xa6, 0x5f, 0x84, 0xf9, 0x5a, 0xe7, 0x97, 0x5e, 0x3a, 0x2b, 0x6e, 0xd0, 0x7d,
+    0x31, 0x83, 0x9f, 0x94, 0x71, 0x29, 0x16, 0x6a, 0x12, 0x83, 0x99, 0xcb, 0x3b, 0xa0, 0xf7, 0xe6,
+    0xbe, 0x87, 0xf3, 0x4f, 0xe9, 0x03, 0xdf, 0x96, 0xd6, 0xfd, 0x1a, 0x2f, 0xc7, 0xfb, 0x46, 0xa1,
+    0xf0, 0x3f, 0x2b, 0xd5, 0x3e, 0x11, 0x64, 0xf0, 0x3d, 0x6e, 0x28, 0x3f, 0xc5, 0xba, 0xf6, 0xe7,
+    0xd6, 0x44, 0x31, 0x49, 0xde, 0x43, 0x2e, 0x64, 0x39, 0xda, 0xb4, 0xa9, 0xfe, 0xf3, 0x23, 0x97,
+    0x0a, 0x5d, 0xc8, 0x29, 0x93, 0x0e, 0x21, 0x4c, 0xfe, 0xb7, 0xfb, 0x9f, 0x2a, 0xfc, 0xb3, 0xcd,
+    0xa1, 0xbc, 0x86, 0xb2, 0x76, 0xa0, 0x6d, 0x55, 0x2b, 0xe1, 0x96, 0xc8, 0xfe, 0xeb, 0x03, 0x56,
+    0x29, 0xf8, 0x26, 0x6d, 0xed, 0xf5, 0x58, 0x42, 0xfe, 0x3e, 0x83, 0xda, 0x39, 0x26, 0xab, 0xec,
+    0x78, 0x67, 0xc8, 0x80, 0xb4, 0x56, 0xd4, 0x27, 0x97, 0xfb, 0x01, 0xd6, 0x83, 0x57, 0xcb, 0xb8,
+    0x76, 0x11, 0x00, 0xef, 0xbe, 0xce, 0xeb, 0xe0, 0x9d, 0x83, 0x53, 0xc9, 0xe1, 0x21, 0x3b, 0x16,
+    0xf4, 0x67, 0x8c, 0xdd, 0xb5, 0xee, 0x1b, 0xf8, 0xff, 0x11, 0xce, 0x3f, 0x22, 0xfe, 0x24, 0x07,
+    0xfe, 0x03, 0xf9, 0x9b, 0x5f, 0xb5, 0x7f, 0x24, 0x01, 0xfc, 0x7f, 0x5b, 0x9d, 0x64, 0x9e, 0x01,
+    0xea, 0x1c, 0x37, 0xfe, 0x4f, 0xbe, 0xf7, 0x4c, 0x5a, 0x33, 0x30, 0xf7, 0x82, 0x6d, 0x65, 0x9b,
+    0x87, 0xfd, 0xe7, 0x4c, 0xfb, 0x63, 0x02, 0x2b, 0x0f, 0x0f, 0x7b, 0xc9, 0x36, 0x2b, 0x47, 0x49,
+    0xf6, 0x30, 0x0f, 0x04, 0xed, 0x10, 0xea, 0xcf, 0x15, 0xd2, 0xe3, 0xf8, 0xd6, 0xc9, 0x1b, 0x3d,
+    0x46, 0x0e, 0x54, 0x5a, 0x1e, 0x97, 0x3d, 0x6e, 0x3c, 0xd6, 0x7a, 0xf2, 0xe9, 0xdd, 0x38, 0x03,
+    0x20, 0x4b, 0x8e, 0x07, 0x8d, 0xd3, 0x4d, 0xf2, 0x09, 0xc4, 0x7f, 0x3a, 0xf8, 0xb1, 0x57, 0xf2,
+    0xfe, 0xd7, 0xd4, 0x01, 0xfe, 0x27, 0x1b, 0xfd, 0x1b, 0xf4, 0x4a, 0xd7, 0x33, 0xfe, 0x2f, 0x05,
+    0xd8, 0xb0, 0x0d, 0x61, 0xb7, 0x63, 0x91, 0xc8, 0xc2, 0x3e, 0x1d, 0xed, 0x1e, 0xc7, 0xf8, 0xa8,
+    0xb6, 0x8d, 0x74, 0x21, 0xab, 0xca, 0xef, 0x9e, 0x9c, 0x6d, 0xd6, 0x7a, 0x69, 0x46, 0x79, 0x55,
+    0xd1, 0xfd, 0x6b, 0xe6, 0xdc, 0xcf, 0xa9, 0xd6, 0x85, 0x09, 0x45, 0x37, 0x7b, 0xdf, 0x8b, 0x6a,
+    0x1b, 0xe9, 0x2f, 0x93, 0x42, 0xbd, 0xbf, 0x61, 0xcc, 0xad, 0x8a, 0x79, 0xaa, 0xff, 0x6e, 0xea,
+    0x59, 0x0f, 0x88, 0xbf, 0x87, 0x34, 0x4a, 0x87, 0xa6, 0x57, 0x44, 0xfc, 0x06, 0xfb, 0x4d, 0x3c,
+    0xe5, 0xda, 0x56, 0x4b, 0xac, 0xc7, 0x14, 0xa4, 0x17, 0xae, 0xb7, 0xe8, 0xf9, 0xc7, 0xbb, 0x34,
+    0xf0, 0x38, 0x12, 0xb1, 0x3b, 0xb4, 0x9a, 0x01, 0x9e, 0xeb, 0x27, 0x45, 0x32, 0x13, 0x4d, 0x0b,
+    0x22, 0xa1, 0x58, 0x9f, 0xfd, 0xf7, 0xd0, 0xe8, 0x5e, 0x1c, 0x19, 0x93, 0x84, 0xe4, 0xd6, 0x49,
+    0x63, 0xaf, 0xc2, 0xec, 0xbd, 0x4b, 0x22, 0xa7, 0xe2, 0x22, 0x73, 0xae, 0xcd, 0xc2, 0x38, 0x5f,
+    0xd9, 0x6b, 0xfa, 0x27, 0x0c, 0x66, 0x5d, 0x80, 0xa6, 0xc4, 0x2b, 0x05, 0x3c, 0x5f, 0x92, 0xc6,
+    0x3c, 0xd2, 0x81, 0x71, 0x6a, 0x30, 0xe7, 0xaf, 0xfd, 0xcb, 0x9a, 0x74, 0xff, 0xbf, 0xa4, 0x7b,
+    0x27, 0x84, 0x51, 0xfe, 0xf2, 0xb7, 0xed, 0x56, 0x8b, 0x0d, 0xde, 0x33, 0x48, 0xd1, 0x82, 0x79,
+    0x0e, 0xf7, 0x72, 0xf7, 0xe7, 0xae, 0x1b, 0x8c, 0x8a, 0x6d, 0xcd, 0x5d, 0xcc, 0x77, 0xb7, 0x30,
+    0x68, 0x68, 0x23, 0x59, 0x48, 0xcf, 0x08, 0x86, 0x31, 0xe2, 0x9d, 0x93, 0x45, 0xfe, 0xcf, 0xb6,
+    0xef, 0x0e, 0x4a, 0x1e, 0xc5, 0xe5, 0x96, 0x1f, 0xcf, 0x75, 0xdd, 0x2a, 0xcc, 0x1a, 0x3c, 0x40,
+    0xe6, 0x62, 0x3e, 0x6d, 0x10, 0x03, 0x20, 0x98, 0xb1, 0xdc, 0xa6, 0x4b, 0x3c, 0x45, 0xdb, 0x97,
+    0x66, 0x7b, 0xed, 0xfb, 0x87, 0x14, 0x51, 0x77, 0x97, 0x4e, 0xe8, 0x01, 0xbb, 0xe5, 0xf2, 0xed,
+    0xf9, 0xc7, 0x81, 0xd8, 0xc0, 0xa5, 0xde, 0x3d, 0x91, 0x3e, 0xcd, 0x95, 0x7c, 0xf5, 0x94, 0xdf,
+    0x35, 0xdd, 0xbe, 0x78, 0x9f, 0xf0, 0xbc, 0xbe, 0x19, 0xa1, 0x70, 0xe8, 0x12, 0x2e, 0xcf, 0xe8,
+    0x73, 0x4f, 0x7a, 0x7c, 0xc0, 0x60, 0x33, 0x9d, 0x75, 0xf3, 0xcc, 0x35, 0xc9, 0x3f, 0x7d, 0x2e,
+    0xf5, 0xe5, 0xaf, 0x3f, 0xf8, 0x39, 0x1f, 0xda, 0x3c, 0x7b, 0x31, 0xf6, 0x55, 0xbe, 0xb9, 0xb8,
+    0x0b, 0x59, 0xf3, 0xd8, 0x09, 0xda, 0x66, 0x71, 0x1a, 0x5d, 0x39, 0x23, 0xad, 0xda, 0x4e, 0xa3,
+    0x09, 0x57, 0x2c, 0x11, 0xbd, 0x04, 0x33, 0x21, 0x51, 0x56, 0x31, 0x66, 0x0f, 0x29, 0xb7, 0x33,
+    0x38, 0xc2, 0xf4, 0x92, 0x7c, 0xf9, 0x82, 0xbd, 0xa6, 0x57, 0xfe, 0x43, 0x6f, 0xdf, 0x0a, 0x24,
+    0x6e, 0x43, 0x14, 0xcd, 0xda, 0x17, 0x7d, 0x7a, 0x95, 0xea, 0xf5, 0x8c, 0x92, 0x97, 0xa2, 0xb4,
+    0x75, 0x09, 0xc6, 0xbf, 0x7b, 0xd6, 0x32, 0x6d, 0xff, 0xde, 0x47, 0x7f, 0x54, 0xf5, 0x6f, 0x05,
+    0xf9, 0x09, 0xd7, 0x2a, 0x8a, 0x40, 0xe5, 0xed, 0x73, 0x03, 0x4d, 0x6d, 0xb7, 0x16, 0xcb, 0x1d,
+    0x96, 0xcf, 0x1e, 0x37, 0x1f, 0x1f, 0x21, 0xe2, 0xd6, 0x03, 0x53, 0xb1, 0x67, 0x29, 0x72, 0x95,
+    0xf7, 0x6d, 0x6f, 0x28, 0x7e, 0xaa, 0x72, 0xc9, 0xf7, 0x49, 0xf0, 0xd8, 0x5e, 0x15, 0xc7, 0xa5,
+    0xd3, 0x1c, 0x6e, 0x2a, 0x81, 0xb3, 0x62, 0xc9, 0xf9, 0x9d, 0xf5, 0x3e, 0xf3, 0x39, 0xeb, 0x9f,
+    0xc9, 0x37, 0xef, 0x49, 0xfb, 0x8c, 0x0e, 0x24, 0x0d, 0x3a, 0xc6, 0x13, 0x71, 0x16, 0xd4, 0x08,
+    0x97, 0x06, 0xad, 0x71, 0x5e, 0x62, 0x0c, 0x64, 0x1e, 0xd0, 0xc9, 0x8c, 0x70, 0x6a, 0x7f, 0x9f,
+    0xd0, 0xc5, 0x09, 0xb0, 0xea, 0x01, 0x68, 0x06, 0x13, 0x9d, 0xef, 0x1c, 0xd2, 0x3f, 0x3d, 0x2b,
+    0xc9, 0x59, 0x7d, 0x33, 0x85, 0x73, 0x1e, 0xea, 0x5d, 0x7e, 0x5c, 0x6c, 0x32, 0x0d, 0x2e, 0x8c,
+    0xc7, 0x61, 0xcb, 0x19, 0xce, 0xa3, 0x87, 0x71, 0xa7, 0xfb, 0x1e, 0xf1, 0xd2, 0x30, 0xde, 0x36,
+    0x5e, 0x3c, 0x17, 0x25, 0x55, 0xa3, 0x4c, 0x12, 0x04, 0x5b, 0xc5, 0x30, 0xe7, 0x69, 0x8d, 0x37,
+    0x9b, 0xe2, 0xfe, 0x5d, 0xda, 0x2f, 0xf8, 0x1d, 0xbb, 0x44, 0x2f, 0xc9, 0x5e, 0x42, 0x6f, 0xf4,
+    0x3d, 0x5b, 0xaa, 0x40, 0x0a, 0xa3, 0x3e, 0x43, 0xc0, 0x71, 0xef, 0x93, 0x64, 0x58, 0xee, 0x96,
+    0x8e, 0x1d, 0x5b, 0x9d, 0xd5, 0x3b, 0x85, 0xc2, 0xdf, 0xc3, 0x6b, 0xbc, 0x23, 0xcf, 0xa0, 0xfd,
+    0x47, 0x2d, 0x0c, 0xa3, 0x12, 0x0c, 0x9d, 0x4c, 0x95, 0x2d, 0xf0, 0xfb, 0x46, 0x41, 0x13, 0xe4,
+    0xa6, 0x6f, 0x90, 0xb8, 0x27, 0xd4, 0xb9, 0xc7, 0xa5, 0xfe, 0xd7, 0x01, 0xc3, 0x0d, 0x1c, 0xb8,
+    0x06, 0x98, 0xf3, 0xe3, 0x3b, 0x4e, 0x9d, 0xcc, 0xa2, 0xb5, 0x70, 0xc8, 0x8e, 0x87, 0x16, 0xfc,
+    0x6b, 0x34, 0xe9, 0x7c, 0xfe, 0x52, 0xe1, 0x9a, 0x01, 0xea, 0xeb, 0x5b, 0x53, 0x22, 0x8c, 0x6c,
+    0xfc, 0xfd, 0x8c, 0x7a, 0xdd, 0x32, 0xb0, 0xad, 0xc6, 0x15, 0x66, 0x24, 0xcd, 0x86, 0x61, 0x35,
+    0x29, 0xa2, 0x0d, 0xb6, 0x4e, 0x16, 0xe0, 0xf1, 0x22, 0x04, 0x93, 0xc8, 0xe5, 0x22, 0x97, 0xca,
+    0x60, 0x5b, 0x19, 0x0b, 0x9d, 0x05, 0x33, 0xb7, 0x31, 0x7b, 0x0d, 0xd7, 0xaf, 0x72, 0xc8, 0xff,
+    0x29, 0x6f, 0x30, 0x0c, 0x72, 0xa8, 0x4d, 0x8b, 0x73, 0x1a, 0x3a, 0xd4, 0x91, 0x59, 0x05, 0x4c,
+    0x88, 0xe4, 0x8e, 0xe4, 0x51, 0xa9, 0x9f, 0xf4, 0x0c, 0x73, 0x81, 0xf8, 0xda, 0x7e, 0x45, 0xa7,
+    0x43, 0x8b, 0x4a, 0xcc, 0x6e, 0xf9, 0xfc, 0x53, 0xd5, 0x26, 0xdd, 0x6f, 0x43, 0xd8, 0xb9, 0x27,
+    0x47, 0xf7, 0xdb, 0x67, 0x96, 0x60, 0x07, 0xfc, 0x87, 0x5b, 0xa1, 0x70, 0x49, 0xa1, 0xfd, 0x9d,
+    0x84, 0x27, 0x09, 0xc9, 0xf5, 0xaf, 0xc1, 0x81, 0x3d, 0x94, 0xbf, 0x6e, 0x66, 0x13, 0x8d, 0xf3,
+    0x7c, 0x4e, 0xc5, 0xca, 0xaa, 0xd3, 0x7b, 0x5e, 0x11, 0xc8, 0xad, 0x3e, 0x8a, 0x3f, 0xa9, 0x2e,
+    0xe2, 0x74, 0x6c, 0xc8, 0x4d, 0x0d, 0x3e, 0x7f, 0x38, 0xe0, 0x82, 0xf2, 0x1a, 0x6f, 0x2f, 0x8c,
+    0xf6, 0xee, 0xf8, 0xeb, 0xc5, 0xe6, 0xb7, 0xeb, 0x35, 0xbe, 0x1f, 0x89, 0x5d, 0x07, 0x64, 0xfa,
+    0x5e, 0x57, 0x9b, 0x74, 0xc3, 0x28, 0xcd, 0x84, 0xfa, 0x5c, 0xd6, 0xba, 0x0a, 0x0e, 0xa0, 0x85,
+    0x49, 0x7f, 0x86, 0x19, 0x89, 0xed, 0x97, 0x0b, 0x1d, 0xe4, 0x3c, 0x8e, 0x6d, 0x99, 0x58, 0x7c,
+    0xb6, 0xaf, 0x6c, 0xe3, 0x9a, 0x70, 0xe5, 0x86, 0x93, 0x31, 0x0b, 0xd2, 0xae, 0xd6, 0x9d, 0x3c,
+    0xa5, 0x32, 0x70, 0xd4, 0xda, 0x91, 0x3c, 0x65, 0xe0, 0x72, 0x9c, 0xdb, 0x89, 0x2f, 0x65, 0xf7,
+    0x11, 0xa2, 0x14, 0x94, 0x6b, 0x10, 0x7d, 0xdb, 0xb0, 0x20, 0x76, 0x7e, 0xc6, 0x67, 0xc6, 0xb9,
+    0x40, 0x55, 0x16, 0xb7, 0x96, 0xd7, 0x6d, 0xde, 0xb1, 0x84, 0x55, 0xf0, 0x3a, 0x0d, 0x5d, 0x9e,
+    0xed, 0xda, 0xa4, 0x1c, 0x57, 0x85, 0x8f, 0x9c, 0x14, 0x20, 0x49, 0xac, 0x43, 0x71, 0x75, 0x82,
+    0xac, 0x46, 0x53, 0x2a, 0x82, 0x31, 0xa1, 0xcb, 0xa2, 0x97, 0x5a, 0xee, 0x91, 0xc6, 0x1b, 0xf9,
+    0x0e, 0x1e, 0xce, 0x46, 0x08, 0xb9, 0xd2, 0xbd, 0x31, 0x73, 0x6f, 0xef, 0xbb, 0x5a, 0xa6, 0xa5,
+    0x62, 0x38, 0x91, 0xe5, 0xe3, 0xb9, 0xf5, 0x38, 0xd4, 0xdc, 0xf6, 0xa3, 0x23, 0x94, 0x64, 0xc7,
+    0x8f, 0x37, 0xbb, 0xb9, 0x35, 0xf2, 0xcc, 0xb4, 0xa5, 0x20, 0x41, 0xd1, 0x77, 0x1c, 0xd4, 0x1f,
+    0x85, 0x71, 0xe0, 0x0c, 0xc5, 0xee, 0xfd, 0xa5, 0x33, 0x1d, 0xc8, 0xf0, 0xdb, 0xb9, 0x1c, 0x91,
+    0x21, 0x3c, 0x26, 0x00, 0xc4, 0x0c, 0xb0, 0x0f, 0x0f, 0x48, 0x52, 0xaa, 0xd3, 0x4d, 0xa2, 0x49,
+    0x4d, 0x37, 0x31, 0x4e, 0x1d, 0xd5, 0xa9, 0xd8, 0xff, 0xa3, 0xee, 0xa4, 0x15, 0x49, 0xb4, 0x69,
+    0x52, 0x3f, 0xb6, 0xc1, 0xf5, 0x2e, 0x6c, 0x65, 0x4d, 0x43, 0x31, 0xa2, 0xca, 0x58, 0x39, 0xb6,
+    0x5d, 0x85, 0xf9, 0x3e, 0x07, 0x9a, 0x7a, 0x76, 0x19, 0x53, 0xd2, 0x65, 0x29, 0xf2, 0xd8, 0x0c,
+    0x7b, 0x16, 0x84, 0x13, 0x84, 0x2c, 0x24, 0xe2, 0x75, 0x9a, 0x07, 0x84, 0x60, 0x99, 0xcf, 0x3d,
+    0x5d, 0x4a, 0x22, 0x6a, 0xb4, 0x41, 0x23, 0x71, 0x92, 0x83, 0x43, 0x68, 0xc2, 0xa4, 0x16, 0xdf,
+    0x57, 0x2d, 0xcc, 0xb8, 0x82, 0x1f, 0x53, 0xb9, 0xc6, 0xab, 0x4d, 0x03, 0x73, 0x95, 0xb7, 0x83,
+    0xa4, 0x51, 0x44, 0xa9, 0xfe, 0x77, 0x2a, 0xf5, 0x0c, 0x3a, 0xef, 0x84, 0xa3, 0x86, 0xb0, 0x33,
+    0x53, 0xf6, 0xd6, 0x37, 0x85, 0x82, 0x81, 0xd0, 0xdc, 0x13, 0x83, 0x23, 0x4e, 0x50, 0x40, 0x9b,
+    0xd7, 0xc0, 0x1e, 0x64, 0xb0, 0x6e, 0x01, 0x9b, 0x29, 0xed, 0xf0, 0x15, 0x22, 0xb3, 0x92, 0xa5,
+    0x7c, 0xee, 0x2f, 0xca, 0xbd, 0xca, 0x5d, 0x53, 0x87, 0x8f, 0xd7, 0xf9, 0x9d, 0xef, 0x00, 0xec,
+    0xd4, 0xe2, 0xb3, 0x38, 0x6d, 0x24, 0x29, 0x69, 0x44, 0x2a, 0xc4, 0x49, 0x8c, 0xac, 0xea, 0xdc,
+    0x88, 0x1f, 0xc2, 0xfa, 0xa8, 0xd7, 0x20, 0xf2, 0x0c, 0x6b, 0x4f, 0xfb, 0xdf, 0x5d, 0xbe, 0x7b,
+    0x16, 0x25, 0x47, 0xc6, 0x5a, 0xce, 0x1e, 0x99, 0x1e, 0xa5, 0x8a, 0xc5, 0xb4, 0x5e, 0x5f, 0xd8,
+    0x59, 0x78, 0x07, 0x62, 0xb3, 0x2d, 0xe2, 0x30, 0xf3, 0xe5, 0x03, 0xa3, 0x7b, 0x38, 0x8f, 0x2a,
+    0xea, 0x43, 0xdc, 0x6f, 0xbc, 0xd5, 0xf3, 0x6f, 0x32, 0xc0, 0xac, 0xfb, 0xfc, 0x1c, 0xd8, 0x14,
+    0x2c, 0x01, 0x9c, 0x0b, 0x16, 0x8e, 0x37, 0x94, 0x49, 0x22, 0xb9, 0x78, 0xdc, 0x91, 0x49, 0x96,
+    0xca, 0xc3, 0x22, 0xba, 0x2a, 0x16, 0x87, 0x11, 0x1f, 0xb5, 0x8d, 0xa4, 0x0f, 0x25, 0xb0, 0x9d,
+    0x90, 0x90, 0x50, 0xae, 0x0e, 0x82, 0xf1, 0x17, 0x92, 0xe3, 0x28, 0xdd, 0xa5, 0xf4, 0x54, 0x72,
+    0x21, 0x7e, 0x88, 0x0d, 0x0f, 0x31, 0xe0, 0x74, 0x72, 0xc8, 0x00, 0xa1, 0xa3, 0xa0, 0x01, 0x28,
+    0xe4, 0xcf, 0x2b, 0x93, 0x75, 0x28, 0xa3, 0x08, 0x71, 0xfe, 0xab, 0x59, 0x4a, 0x74, 0x74, 0x6e,
+    0x78, 0x7e, 0x43, 0xbc, 0xde, 0x68, 0x73, 0x31, 0xee, 0xb1, 0xd0, 0x8c, 0xe5, 0xed, 0x10, 0xc7,
+    0x1c, 0x1e, 0xff, 0x0b, 0x0b, 0x40, 0x9e, 0x60, 0xd8, 0x94, 0xca, 0x8b, 0xcc, 0xef, 0x21, 0xf0,
+    0x6c, 0x82, 0x05, 0x6b, 0x92, 0xab, 0x16, 0x2d, 0x61, 0x0c, 0xd9, 0x7e, 0xc2, 0x07, 0x4a, 0x9b,
+    0x4d, 0x29, 0xc1, 0x9c, 0x77, 0xc0, 0xe1, 0x72, 0x29, 0x76, 0x39, 0xd9, 0xaf, 0x58, 0x5f, 0x89,
+    0xf5, 0x18, 0x6e, 0x41, 0xc4, 0x97, 0xa1, 0xb2, 0x98, 0xaa, 0x06, 0x99, 0x84, 0x46, 0x78, 0x2a,
+    0x7c, 0x79, 0xde, 0x57, 0x7e, 0xd0, 0x1a, 0xf8, 0x9d, 0xf6, 0x29, 0xb7, 0x60, 0x85, 0xc3, 0xa1,
+    0x6e, 0xb3, 0x51, 0x4a, 0x40, 0xe5, 0x06, 0x62, 0x72, 0xed, 0x81, 0x04, 0x6a, 0xed, 0xb9, 0x14,
+    0x3a, 0x0a, 0x6e, 0x05, 0x17, 0x73, 0x74, 0xb5, 0x4c, 0x84, 0x1d, 0x4e, 0xc8, 0x16, 0xda, 0xd3,
+    0x89, 0x19, 0xc1, 0x9a, 0x93, 0x62, 0x71, 0xcd, 0x29, 0xa2, 0x47, 0x21, 0x25, 0x00, 0x5a, 0x94,
+    0x0c, 0x41, 0xda, 0xc6, 0x54, 0xe3, 0xe5, 0x31, 0x2b, 0xc4, 0x52, 0x73, 0xc5, 0xeb, 0xb4, 0x8d,
+    0x68, 0x72, 0xb6, 0x43, 0x86, 0x64, 0x02, 0x99, 0x7e, 0x46, 0xa1, 0x80, 0x1a, 0x5b, 0x75, 0xfb,
+    0x6a, 0xa7, 0x81, 0x78, 0x40, 0x3e, 0xf3, 0x75, 0x4c, 0x9a, 0x0b, 0x45, 0x6c, 0x73, 0xd2, 0xcb,
+    0x42, 0xb1, 0x7c, 0xd3, 0x80, 0x45, 0x2c, 0xf6, 0x93, 0x18, 0x8d, 0x0e, 0x4d, 0xb0, 0x26, 0xef,
+    0x24, 0xb5, 0xa5, 0x02, 0xa7, 0xa1, 0x09, 0xad, 0x5d, 0x8c, 0x31, 0xda, 0x38, 0x24, 0x42, 0xa4,
+    0xb0, 0x3c, 0x30, 0xcf, 0xa2, 0xdf, 0x65, 0x1b, 0xf2, 0x26, 0x3f, 0x33, 0xaa, 0x70, 0x08, 0x25,
+    0xdf, 0x49, 0x85, 0xa9, 0x5a, 0x23, 0x10, 0x1c, 0x14, 0x97, 0x00, 0x9d, 0x4e, 0xf8, 0x5b, 0x9e,
+    0xfd, 0xd6, 0x15, 0xaf, 0xb5, 0xd2, 0x55, 0x58, 0xf8, 0x84, 0x71, 0x20, 0x7a, 0x38, 0xd9, 0x49,
+    0xb8, 0xb3, 0x66, 0x4f, 0x05, 0x22, 0x89, 0x79, 0x9d, 0xd5, 0x43, 0x2c, 0x60, 0xd3, 0x72, 0x5a,
+    0xf7, 0x40, 0x8f, 0x56, 0xf7, 0x3a, 0xed, 0x6b, 0xc5, 0x27, 0x1a, 0xae, 0x2a, 0x32, 0x62, 0x8a,
+    0x32, 0xb5, 0xca, 0x3d, 0x11, 0x6b, 0xe5, 0x3f, 0xb1, 0xcb, 0x7c, 0xeb, 0xbd, 0x01, 0x53, 0x62,
+    0xb0, 0xb3, 0x3a, 0x76, 0x51, 0x0c, 0x6b, 0xcd, 0x64, 0x34, 0xab, 0x63, 0xae, 0x7e, 0x67, 0x74,
+    0x60, 0x63, 0x3a, 0x94, 0x05, 0xa6, 0x99, 0x05, 0xd0, 0x5c, 0xe2, 0x13, 0xc2, 0xf9, 0xf9, 0xe9,
+    0xf1, 0x73, 0x84, 0x12, 0x27, 0x99, 0x85, 0xe3, 0x51, 0xe4, 0x13, 0x51, 0xf8, 0xcc, 0x25, 0x6a,
+    0x4c, 0x88, 0xc8, 0x7d, 0x37, 0x8f, 0xac, 0x14, 0x5f, 0x71, 0xb8, 0xa7, 0x83, 0x68, 0xd4, 0xde,
+    0xc3, 0x85, 0xa6, 0x61, 0xd9, 0x62, 0x45, 0x2e, 0x4e, 0xbf, 0x0d, 0x3e, 0xd7, 0xb5, 0x28, 0x94,
+    0x07, 0x63, 0xca, 0xca, 0xe9, 0xd4, 0xe6, 0x7a, 0xf8, 0x34, 0xe2, 0x3c, 0x06, 0x82, 0x0e, 0xbb,
+    0x4b, 0x1f, 0xb8, 0x57, 0x03, 0x65, 0x73, 0xd1, 0xda, 0x15, 0x40, 0x78, 0x04, 0xf2, 0x43, 0xd5,
+    0x71, 0xbb, 0x37, 0x0c, 0x95, 0x0a, 0x8c, 0x84, 0x81, 0x95, 0x20, 0xcf, 0x54, 0xc7, 0x8d, 0x1a,
+    0x23, 0x86, 0x14, 0xdc, 0x04, 0xbb, 0x56, 0x9a, 0x4b, 0xe8, 0xed, 0xb1, 0x76, 0x12, 0x28, 0x66,
+    0x95, 0xa7, 0x37, 0xf5, 0x1c, 0x7e, 0x45, 0xc6, 0xa6, 0x15, 0x5c, 0x74, 0xa7, 0x1c, 0xce, 0x08,
+    0x6d, 0x30, 0x74, 0x94, 0x90, 0xb2, 0xc8, 0x85, 0xd0, 0x43, 0x5b, 0xc2, 0xe2, 0x19, 0x40, 0xc5,
+    0xbe, 0x1b, 0x08, 0xb6, 0x00, 0x68, 0x37, 0xf8, 0xd7, 0x0a, 0xb7, 0x29, 0xdf, 0x64, 0x26, 0x94,
+    0x08, 0xc0, 0x7b, 0xba, 0xa8, 0xc9, 0x58, 0xeb, 0x64, 0x78, 0x1a, 0x12, 0xba, 0x1e, 0x36, 0x3c,
+    0x70, 0x36, 0x0e, 0x20, 0x6e, 0x32, 0xb4, 0xc4, 0xcd, 0x1e, 0x06, 0xc4, 0xf2, 0x51, 0x98, 0xe3,
+    0x90, 0x52, 0xaa, 0xe8, 0xd8, 0x89, 0x89, 0x25, 0x53, 0x18, 0xb4, 0x1c, 0x67, 0x3e, 0x4f, 0xba,
+    0x9f, 0x72, 0x6d, 0xc8, 0x36, 0x96, 0xe2, 0x76, 0x9d, 0x9c, 0x51, 0x20, 0xf4, 0x31, 0xf5, 0x61,
+    0x7a, 0xac, 0xb4, 0x31, 0xf9, 0xc0, 0xa8, 0x10, 0x94, 0xfa, 0xb0, 0x15, 0x5b, 0x0d, 0x83, 0x3f,
+    0xe5, 0x21, 0x58, 0x90, 0x0e, 0x0a, 0x8a, 0x7c, 0x4a, 0xad, 0xad, 0x5d, 0xa1, 0x3a, 0xcd, 0x0d,
+    0xdb, 0x24, 0xa4, 0x16, 0xe3, 0x38, 0xc9, 0x15, 0x48, 0x30, 0x9e, 0x30, 0xe0, 0xbf, 0x09, 0x17,
+    0x32, 0x1a, 0x0c, 0x27, 0x82, 0xab, 0xa7, 0x40, 0x8c, 0x90, 0x96, 0x9a, 0x6d, 0x22, 0x98, 0x92,
+    0xf5, 0x0e, 0xdb, 0x0d, 0x34, 0xcd, 0xb2, 0xa0, 0x0b, 0x9e, 0x37, 0x09, 0x52, 0xa3, 0x4a, 0x99,
+    0x05, 0xeb, 0x36, 0x92, 0xd5, 0x68, 0xb4, 0x90, 0x12, 0x12, 0x1d, 0x20, 0x21, 0xb2, 0xca, 0x4d,
+    0x4c, 0x28, 0xd5, 0x62, 0x83, 0x30, 0xf2, 0x13, 0x70, 0x74, 0xcf, 0x0e, 0x46, 0xe2, 0x5d, 0x90,
+    0xd6, 0x78, 0x83, 0xbe, 0x06, 0x26, 0x41, 0x23, 0x09, 0x41, 0x76, 0x3b, 0x5c, 0x4f, 0x41, 0xfb,
+    0xa4, 0x7f, 0xea, 0x7b, 0x1f, 0x55, 0xc8, 0x36, 0xe3, 0x86, 0xfe, 0x2d, 0x9f, 0xca, 0x44, 0xfe,
+    0x2c, 0xbf, 0xc2, 0x76, 0xcb, 0xf9, 0x7c, 0xd8, 0x8e, 0x7b, 0xc6, 0x5b, 0xff, 0x13, 0x83, 0xf7,
+    0x1d, 0xf1, 0xab, 0xdc, 0xbb, 0x09, 0x0c, 0x0d, 0xad, 0xa6, 0x09, 0xc8, 0x7a, 0x85, 0x78, 0xfa,
+    0x2f, 0xb8, 0x61, 0xff, 0x2b, 0xfd, 0x7e, 0xdb, 0xfb, 0x4f, 0x45, 0x03, 0x81, 0x38, 0xaf, 0x46,
+    0x36, 0x03, 0x43, 0x93, 0xdc, 0x78, 0x88, 0x4b, 0x7b, 0xd4, 0xd9, 0x2b, 0x49, 0x1f, 0x1f, 0xc2,
+    0x91, 0xce, 0x7c, 0x57, 0x94, 0x57, 0xee, 0xfc, 0x5a, 0x18, 0xe2, 0xc3, 0x2a, 0xb8, 0x6d, 0x54,
+    0xdf, 0xe2, 0xfc, 0xfe, 0x9b, 0xe3, 0xa6, 0x89, 0x94, 0xa9, 0xf0, 0xba, 0xdc, 0xc7, 0xcb, 0x6b,
+    0x19, 0xcd, 0xd3, 0xf4, 0xbe, 0x27, 0x0d, 0xfd, 0x06, 0xfb, 0x9f, 0xd7, 0xc4, 0x26, 0xe3, 0xf6,
+    0x79, 0xaf, 0x79, 0x41, 0x9b, 0x99, 0x40, 0x75, 0x7c, 0x24, 0xa5, 0x0f, 0x16, 0xd7, 0x86, 0xf9,
+    0x2b, 0x2f, 0x97, 0xfa, 0x3b, 0x4f, 0x44, 0x17, 0x87, 0x8b, 0x9c, 0xc5, 0x41, 0x4d, 0xa1, 0xde,
+    0x34, 0xf9, 0x7f, 0x43, 0xc0, 0x7d, 0x52, 0x4d, 0x29, 0xeb, 0x0b, 0xbe, 0xad, 0x0f, 0x05, 0xa6,
+    0x38, 0xbf, 0x43, 0xca, 0x9c, 0xfc, 0x07, 0xce, 0x72, 0xff, 0xf4, 0x3b, 0xff, 0xd8, 0x7d, 0x74,
+    0xbf, 0x0e, 0x3a, 0x71, 0x2d, 0x4c, 0xb8, 0xac, 0xf3, 0xea, 0x99, 0x3a, 0xb3, 0x9f, 0x88, 0xeb,
+    0x3c, 0xbf, 0x9f, 0x1a, 0x38, 0x16, 0x23, 0x44, 0xb7, 0x32, 0xb4, 0x53, 0xd6, 0x38, 0xae, 0x60,
+    0x86, 0x87, 0x1a, 0xc6, 0x33, 0x40, 0x33, 0x56, 0xfe, 0xca, 0x62, 0x6a, 0x7a, 0xff, 0xb7, 0x6b,
+    0x9a, 0xc9, 0x23, 0xb7, 0x12, 0x47, 0x5a, 0x8b, 0xed, 0xb3, 0x5c, 0x9e, 0xbc, 0xc8, 0x58, 0x77,
+    0x9f, 0x3d, 0xa6, 0xfa, 0x1f, 0x91, 0x98, 0xe0, 0x89, 0xdb, 0xae, 0xf2, 0x1b, 0xad, 0x3f, 0x81,
+    0x05, 0x09, 0x3a, 0x96, 0xd2, 0xa0, 0x55, 0x2e, 0x94, 0x4f, 0x98, 0xe8, 0xb9, 0x7f, 0xbd, 0x6b,
+    0xec, 0x3e, 0x1a, 0x37, 0xf4, 0xfb, 0x7e, 0x63, 0xe6, 0x3b, 0x2a, 0x9f, 0x93, 0xe4, 0x51, 0xe0,
+    0xb9, 0x07, 0x14, 0xb8, 0xf7, 0x38, 0xce, 0x92, 0x23, 0x27, 0x9b, 0x79, 0x65, 0x97, 0xee, 0x54,
+    0x76, 0xd4, 0x13, 0x2a, 0xb8, 0xe9, 0x1f, 0x76, 0xe6, 0x52, 0x6c, 0x17, 0x9e, 0x8e, 0xf1, 0x62,
+    0xfb, 0xc2, 0x93, 0xa0, 0xe4, 0x69, 0x53, 0x3c, 0x61, 0x1c, 0x08, 0x29, 0x4c, 0xcf, 0x95, 0x93,
+    0xe6, 0xbe, 0xb3, 0x90, 0xd1, 0xfb, 0x11, 0x3b, 0x0a, 0x1f, 0x42, 0x3f, 0xba, 0xe7, 0xaf, 0x85,
+    0x51, 0xea, 0x78, 0xd9, 0xb9, 0xad, 0xd5, 0x95, 0x8d, 0xec, 0xb6, 0x18, 0x14, 0xa8, 0x59, 0xe2,
+    0x54, 0xf4, 0x61, 0x08, 0x0f, 0x8a, 0x9e, 0xa3, 0xd3, 0xa4, 0xe9, 0x37, 0x4a, 0x77, 0x39, 0x1a,
+    0xd3, 0x5d, 0x46, 0x3a, 0x7f, 0x37, 0x5e, 0x2b, 0x49, 0xa6, 0x82, 0x4b, 0x67, 0x32, 0x2c, 0x43,
+    0x1b, 0xfa, 0x5a, 0xef, 0x8e, 0xe7, 0xb0, 0x7e, 0x8e, 0x87, 0x79, 0x45, 0xc5, 0xd2, 0xe4, 0x9e,
+    0x01, 0x84, 0x99, 0xe4, 0xe3, 0xbe, 0xcb, 0x29, 0xf5, 0x3f, 0x93, 0xb6, 0xfc, 0x15, 0x55, 0xbc,
+    0xfe, 0x2f, 0x33, 0x82, 0xf9, 0xc4, 0x1f, 0x33, 0x7f, 0xd6, 0x72, 0x82, 0x36, 0xba, 0x7c, 0x37,
+    0x0d, 0xb9, 0xf8, 0xfc, 0x37, 0xe2, 0x17, 0xf9, 0x72, 0x91, 0x4b, 0x73, 0xdd, 0x06, 0x47, 0xe2,
+    0xd2, 0xed, 0x25, 0x0c, 0x38, 0x1b, 0x89, 0xb7, 0x0a, 0xb2, 0x42, 0xb8, 0xb5, 0x2a, 0x97, 0xcd,
+    0x86, 0x50, 0xe4, 0x48, 0xc4, 0x67, 0xb4, 0x4b, 0x75, 0xb5, 0x68, 0xc1, 0xc2, 0x76, 0xda, 0x4f,
+    0x8d, 0xfb, 0x9e, 0x83, 0xee, 0x03, 0xd5, 0xc2, 0xef, 0x71, 0x36, 0x5d, 0x56, 0x02, 0x9f, 0x33,
+    0x4d, 0xb0, 0x73, 0x93, 0x9d, 0x8b, 0x35, 0xa0, 0x31, 0xa7, 0x3d, 0xd4, 0x51, 0x21, 0xcb, 0xf4,
+    0xa0, 0x79, 0x8b, 0x84, 0xeb, 0x46, 0xcd, 0xdd, 0xb8, 0xc0, 0x2b, 0x7f, 0x86, 0xd1, 0x4e, 0xf5,
+    0xec, 0xf2, 0xd7, 0x06, 0x70, 0x72, 0xf5, 0x5c, 0xd0, 0xee, 0x2c, 0x07, 0x1c, 0x7b, 0x4f, 0xc1,
+    0xeb, 0xc2, 0x75, 0xdd, 0xc5, 0x14, 0x0f, 0x2f, 0x99, 0xc0, 0x73, 0x02, 0xb1, 0xf8, 0xda, 0x71,
+    0x54, 0x18, 0x4e, 0x11, 0x17, 0x0f, 0x6a, 0x15, 0x4b, 0x2d, 0xf5, 0x96, 0x97, 0xe9, 0x6f, 0x7e,
+    0x4b, 0xf2, 0x87, 0x7e, 0x97, 0x73, 0x82, 0xbc, 0x2e, 0x9a, 0xf0, 0x75, 0xad, 0xaa, 0x51, 0x91,
+    0x95, 0x01, 0xeb, 0x61, 0x46, 0xb6, 0xbe, 0xa8, 0x2d, 0x77, 0xaf, 0x03, 0x20, 0x5c, 0xcc, 0xa5,
+    0x82, 0x23, 0xb4, 0xb8, 0xb9, 0x71, 0x9b, 0xce, 0x91, 0x3e, 0x7c, 0x1b, 0x43, 0xf4, 0xb1, 0xa3,
+    0x50, 0x67, 0x37, 0x12, 0xbc, 0x7a, 0xad, 0x20, 0xdb, 0x54, 0x65, 0x8e, 0x89, 0xc1, 0x2e, 0xea,
+    0x6d, 0xfc, 0xd7, 0x90, 0xa3, 0xef, 0xee, 0x40, 0x50, 0x63, 0x19, 0xdb, 0xd5, 0x5e, 0x31, 0x85,
+    0x2a, 0x85, 0x99, 0x18, 0x4d, 0xa6, 0xda, 0x9f, 0xde, 0xc4, 0xe1, 0x82, 0x39, 0x82, 0xc7, 0x2e,
+    0x6e, 0xae, 0x26, 0x7c, 0x65, 0x44, 0x90, 0x68, 0x59, 0x73, 0x29, 0x8b, 0x0f, 0x41, 0x3c, 0x20,
+    0x6d, 0xa2, 0x0e, 0x3f, 0x7a, 0xaa, 0x90, 0xf8, 0xb6, 0xc1, 0x26, 0x32, 0x8a, 0xf4, 0xac, 0x5f,
+    0x03, 0xa7, 0x3f, 0x65, 0x92, 0x29, 0x8b, 0xaf, 0x5d, 0x18, 0x04, 0x31, 0xc9, 0x19, 0x1b, 0xea,
+    0x4d, 0x3d, 0x5f, 0x59, 0xc4, 0x6e, 0xfb, 0xd2, 0x31, 0x4b, 0x2b, 0x38, 0xea, 0x8e, 0x57, 0xee,
+    0x6a, 0x7a, 0x8e, 0x40, 0x53, 0x76, 0x24, 0x5c, 0x2e, 0x67, 0x3e, 0x77, 0x39, 0xc7, 0x68, 0xff,
+    0x2a, 0x33, 0xf2, 0x18, 0x4e, 0x56, 0x9d, 0xb0, 0x21, 0x4b, 0xa1, 0x2c, 0xa6, 0x7e, 0x4e, 0x6f,
+    0xc4, 0x64, 0x23, 0x46, 0x64, 0x83, 0x79, 0x3f, 0x03, 0x61, 0xed, 0x35, 0x83, 0xad, 0xfa, 0x5b,
+    0x7c, 0xa6, 0x82, 0x0e, 0x3c, 0xf2, 0x89, 0xe3, 0x5b, 0xbb, 0xd7, 0x10, 0xd7, 0x16, 0x50, 0xb8,
+    0xf7, 0xaa, 0x2e, 0x1a, 0x62, 0x75, 0x63, 0x33, 0x98, 0x83, 0xd7, 0x74, 0x37, 0x59, 0xc6, 0xfa,
+    0x9c, 0x4d, 0xca, 0xce, 0xfb, 0x0c, 0xd4, 0x23, 0xc2, 0xb8, 0x3c, 0x68, 0x5c, 0xa6, 0x51, 0xbf,
+    0x16, 0x97, 0x65, 0x8e, 0x47, 0xc2, 0xe2, 0xf0, 0xdc, 0x22, 0x48, 0x1d, 0xbe, 0x4f, 0x8a, 0xf4,
+    0x18, 0x9f, 0x5a, 0x2b, 0x14, 0x40, 0xb5, 0x74, 0xb2, 0xdd, 0xad, 0xad, 0x05, 0x84, 0x8d, 0xc8,
+    0x88, 0x49, 0xa9, 0xe0, 0x32, 0x2d, 0xdc, 0x63, 0x06, 0x77, 0x3c, 0xee, 0xa3, 0xd9, 0x29, 0xe6,
+    0xc6, 0x40, 0x29, 0x88, 0x86, 0xb9, 0x85, 0xa2, 0x48, 0xa4, 0xac, 0x3b, 0x0e, 0xc0, 0x3f, 0xc9,
+    0xe2, 0x7c, 0x17, 0x78, 0x57, 0x1f, 0x1a, 0xde, 0x16, 0x6b, 0x86, 0x19, 0x83, 0x6e, 0x38, 0x5c,
+    0x39, 0xfd, 0x27, 0x38, 0x47, 0x8d, 0xb3, 0x34, 0x21, 0xe8, 0x9a, 0x0c, 0x94, 0xe2, 0x1a, 0x3c,
+    0x1c, 0x6d, 0x55, 0x74, 0xbc, 0xcc, 0x66, 0x19, 0x74, 0x0c, 0x5b, 0xb9, 0x74, 0xb0, 0xd8, 0xed,
+    0xb4, 0x66, 0x67, 0x89, 0x87, 0x07, 0x19, 0x9e, 0x75, 0x2f, 0x73, 0x42, 0x5e, 0xdb, 0x61, 0x38,
+    0x8f, 0x0f, 0x52, 0xd4, 0xcd, 0xd7, 0x10, 0x5b, 0x4f, 0x87, 0x11, 0x14, 0xe8, 0x04, 0x19, 0xba,
+    0x8a, 0x65, 0x73, 0x25, 0x11, 0x4b, 0xc8, 0x83, 0x3e, 0x83, 0x80, 0xcb, 0x13, 0xb9, 0xdf, 0xd0,
+    0xf1, 0x1d, 0x34, 0xff, 0x1e, 0x16, 0x31, 0x54, 0x02, 0x9e, 0x0e, 0x5f, 0x0d, 0xb8, 0xa0, 0x3f,
+    0x7e, 0x86, 0xb9, 0x17, 0x1b, 0xe1, 0x5d, 0x7d, 0x07, 0x01, 0x89, 0xd5, 0xa2, 0x92, 0x83, 0x5b,
+    0x18, 0x39, 0x5a, 0x79, 0x36, 0x30, 0x09, 0xb1, 0x16, 0x06, 0x80, 0xb7, 0xca, 0xc7, 0xb2, 0x5c,
+    0x1c, 0x41, 0x42, 0x0d, 0x19, 0x33, 0xab, 0x89, 0x0f, 0x69, 0xa2, 0x03, 0x85, 0xb5, 0x53, 0x2d,
+    0x8e, 0x1f, 0x83, 0x39, 0xbc, 0x55, 0xc3, 0xe0, 0xf0, 0xd4, 0x58, 0x58, 0x98, 0xc0, 0x06, 0xe0,
+    0x21, 0xa4, 0x9f, 0x66, 0xfa, 0x36, 0x18, 0xc4, 0x24, 0x5c, 0x09, 0x19, 0x04, 0x19, 0x19, 0xb5,
+    0x21, 0x46, 0x43, 0xb3, 0x49, 0x39, 0xa6, 0x61, 0xd4, 0xf4, 0xb2, 0x1e, 0x22, 0xf2, 0x4e, 0xf6,
+    0x44, 0xa6, 0x69, 0xa7, 0x1f, 0x91, 0xbe, 0x9e, 0x81, 0x29, 0x84, 0x8c, 0x1b, 0x53, 0xca, 0xd6,
+    0xf0, 0xdd, 0x11, 0xd9, 0xb2, 0x6c, 0x41, 0xce, 0x00, 0xa9, 0x27, 0x28, 0xc0, 0x68, 0xf8, 0x79,
+    0x7c, 0x07, 0x44, 0xcf, 0xb7, 0xab, 0x8e, 0xcd, 0x43, 0x4e, 0xca, 0x84, 0x29, 0x11, 0x1d, 0x3b,
+    0x9b, 0x82, 0xe7, 0x99, 0x66, 0xec, 0x4b, 0x8d, 0x51, 0x3c, 0xa0, 0xa8, 0xb0, 0x25, 0x96, 0x51,
+    0xf1, 0xe0, 0xbc, 0x07, 0x60, 0xb7, 0xed, 0xf8, 0xdf, 0x71, 0xed, 0x2e, 0x7b, 0x94, 0x3a, 0x8d,
+    0x23, 0xde, 0xa7, 0x12, 0x93, 0x3d, 0xb4, 0x71, 0x6f, 0xb5, 0x0b, 0xc9, 0x44, 0x72, 0xb8, 0x1c,
+    0xf6, 0x4a, 0x66, 0x6e, 0x29, 0x15, 0x7b, 0xd8, 0xe8, 0x62, 0xe8, 0x2f, 0x16, 0xf0, 0xac, 0xe2,
+    0x02, 0xb3, 0x59, 0x78, 0x99, 0xd8, 0xe9, 0x40, 0x76, 0x77, 0x62, 0x33, 0xd8, 0xe5, 0xbc, 0x0e,
+    0x1d, 0x46, 0x2a, 0x78, 0x3a, 0x32, 0xaa, 0x41, 0x9e, 0x42, 0x6e, 0x62, 0x41, 0xfd, 0xfa, 0x98,
+    0x49, 0x62, 0x89, 0x48, 0xa2, 0x58, 0x40, 0x1c, 0x2e, 0x55, 0x6d, 0xd5, 0x40, 0xa2, 0xc7, 0x19,
+    0x8f, 0x7d, 0x6f, 0xcd, 0xc4, 0x73, 0xc3, 0x22, 0x4b, 0x2a, 0x1c, 0x22, 0x16, 0xa5, 0x05, 0xe4,
+    0x10, 0x1a, 0x9c, 0x79, 0x09, 0x81, 0x63, 0xe4, 0x26, 0x87, 0xc9, 0x9e, 0xa4, 0xa3, 0xeb, 0xe8,
+    0x70, 0x5e, 0x53, 0x59, 0x83, 0xe8, 0xda, 0xc4, 0x3c, 0x4c, 0xc8, 0x75, 0x3d, 0xb9, 0x57, 0x14,
+    0x53, 0x85, 0xa6, 0xf1, 0x20, 0xf2, 0x54, 0x0d, 0xe4, 0x45, 0x88, 0x4a, 0x3a, 0x38, 0xab, 0x91,
+    0x8b, 0x59, 0xc2, 0x5d, 0x5e, 0x3a, 0xbb, 0xe2, 0x67, 0xc5, 0x28, 0x84, 0x7c, 0x3a, 0x0a, 0xd1,
+    0x7f, 0x33, 0x95, 0x47, 0x19, 0xc7, 0x70, 0x07, 0x32, 0xbc, 0x08, 0x1d, 0x10, 0xcd, 0x6c, 0x0d,
+    0xa4, 0x20, 0x43, 0xcb, 0x65, 0xd0, 0x54, 0x34, 0x67, 0x4e, 0xdd, 0x74, 0xa0, 0x47, 0x24, 0x54,
+    0x2c, 0x1e, 0x65, 0x90, 0x0c, 0xbc, 0xee, 0x1b, 0x82, 0x2d, 0x93, 0x9f, 0x6c, 0x4a, 0x5d, 0xac,
+    0xc7, 0x11, 0x69, 0x17, 0x73, 0x06, 0xd4, 0xa9, 0xe2, 0x01, 0xe1, 0xaf, 0x85, 0x60, 0x68, 0xc2,
+    0xa2, 0x48, 0x20, 0x52, 0xa1, 0x2c, 0x42, 0x2c, 0x04, 0x8c, 0x98, 0x00, 0xe1, 0xd0, 0x2c, 0x1a,
+    0x3d, 0x30, 0x78, 0x71, 0xa8, 0x82, 0x0c, 0x4c, 0x55, 0xe8, 0x29, 0x07, 0x0a, 0xd5, 0x90, 0x27,
+    0x53, 0x07, 0x39, 0xac, 0x96, 0x47, 0x81, 0xc4, 0x83, 0xac, 0x6c, 0x2c, 0x13, 0x42, 0xd8, 0xfa,
+    0xdb, 0x8b, 0x40, 0xac, 0x68, 0xd7, 0xdc, 0x5d, 0x37, 0xab, 0x80, 0xd1, 0x33, 0xeb, 0x5d, 0xde,
+    0x22, 0x1b, 0x18, 0x22, 0x84, 0x32, 0xe3, 0xe9, 0xaa, 0x07, 0xd7, 0x91, 0x94, 0x57, 0xb3, 0x01,
+    0xbe, 0x65, 0x1a, 0x31, 0xf0, 0x98, 0x35, 0x61, 0x0e, 0x3e, 0x29, 0x02, 0xbc, 0x21, 0x22, 0x44,
+    0x99, 0x26, 0x5f, 0x16, 0x64, 0x49, 0x09, 0xe9, 0x05, 0xb2, 0x67, 0xc6, 0x8c, 0x8a, 0x82, 0x33,
+    0x0e, 0xa5, 0xdb, 0xdb, 0x0e, 0x50, 0x1f, 0x1f, 0x46, 0xea, 0x31, 0xf1, 0x03, 0x61, 0x87, 0x13,
+    0x16, 0xd6, 0x9d, 0x06, 0xe2, 0x2a, 0xce, 0x0c, 0xd0, 0x10, 0x65, 0x4f, 0xc4, 0x34, 0x8f, 0x1b,
+    0x48, 0x06, 0x5c, 0x93, 0x0a, 0x1b, 0x99, 0xae, 0xeb, 0x3d, 0x47, 0xee, 0xfb, 0x39, 0x0f, 0x15,
+    0x31, 0x2a, 0x62, 0x99, 0xde, 0x64, 0x6e, 0x1a, 0x82, 0x47, 0x6e, 0x7f, 0x65, 0x8e, 0x9f, 0xe0,
+    0xc8, 0x75, 0x11, 0x1b, 0x1a, 0xd8, 0xea, 0x43, 0xf8, 0x31, 0xf7, 0xcf, 0x14, 0xa5, 0x26, 0x84,
+    0x33, 0x20, 0x8a, 0xc2, 0x48, 0x4d, 0x1b, 0xcb, 0xc5, 0xcc, 0x46, 0x05, 0x47, 0x2e, 0xaf, 0x09,
+    0x8e, 0x4b, 0x89, 0x97, 0x75, 0x9c, 0x55, 0x85, 0x8f, 0x6c, 0x21, 0x1c, 0xc4, 0x55, 0x3c, 0xec,
+    0xb5, 0x64, 0xee, 0xfc, 0x47, 0x2d, 0x8a, 0xa5, 0xd2, 0x8e, 0xc7, 0x32, 0xa1, 0xc6, 0xa9, 0x94,
+    0x92, 0x60, 0xf1, 0x50, 0x78, 0x5b, 0xfc, 0x0a, 0x1b, 0x4c, 0x31, 0x46, 0x15, 0xd3, 0x3d, 0x0a,
+    0x9b, 0x49, 0x03, 0xf2, 0xe1, 0x2b, 0x21, 0x15, 0xd7, 0xca, 0x82, 0xa8, 0xc1, 0x28, 0x81, 0x97,
+    0x52, 0x70, 0xf0, 0x90, 0x85, 0xd3, 0xaa, 0x86, 0x34, 0x9e, 0x05, 0x04, 0x70, 0xb5, 0xe8, 0xd5,
+    0x91, 0x12, 0x21, 0xd4, 0x84, 0x00, 0x5a, 0x18, 0x12, 0xc6, 0x88, 0xab, 0x17, 0x2d, 0x86, 0x31,
+    0x6b, 0x8d, 0x6e, 0x5a, 0x52, 0xc8, 0x73, 0xd4, 0x8f, 0xac, 0xf6, 0xa9, 0x38, 0x07, 0x50, 0xad,
+    0x60, 0xd0, 0xdb, 0x6e, 0x84, 0x73, 0x3a, 0xb8, 0xed, 0x93, 0xe8, 0xfa, 0x32, 0xaf, 0x2e, 0x1b,
+    0x67, 0x76, 0x6a, 0x31, 0xd4, 0x04, 0x9f, 0xb5, 0x36, 0xe4, 0xec, 0x36, 0x2a, 0x49, 0xee, 0x5e,
+    0x55, 0x42, 0x21, 0xb5, 0x5b, 0xe0, 0xfc, 0x9e, 0xb5, 0x2c, 0xa6, 0x72, 0x11, 0xc9, 0xd9, 0x45,
+    0xd9, 0x9c, 0xec, 0x55, 0x41, 0xf1, 0xd5, 0xc0, 0xa9, 0xc0, 0xc1, 0x23, 0x9f, 0x83, 0x19, 0x55,
+    0x30, 0x89, 0x31, 0xbc, 0xde, 0x0d, 0x05, 0x93, 0x81, 0xcc, 0x84, 0x53, 0xc9, 0x8e, 0x48, 0xea,
+    0x50, 0xfe, 0x75, 0x7d, 0xc5, 0xb0, 0x6a, 0x79, 0xd7, 0x15, 0x04, 0xd6, 0xa4, 0x43, 0xa7, 0x57,
+    0xd7, 0x75, 0x90, 0x3c, 0xac, 0x78, 0x85, 0xab, 0x59, 0x66, 0xb7, 0x4f, 0xb0, 0xbc, 0x4e, 0x0c,
+    0x55, 0x95, 0x51, 0x85, 0x22, 0xa7, 0x8c, 0x5a, 0xe4, 0x4d, 0xc6, 0x30, 0x08, 0x91, 0xc0, 0x46,
+    0x2f, 0xc5, 0xb6, 0x07, 0x36, 0x26, 0xca, 0x68, 0x5b, 0x38, 0x59, 0x91, 0x16, 0x87, 0x19, 0xc6,
+    0x5a, 0x4e, 0xef, 0xc3, 0xcf, 0x01, 0x15, 0x64, 0xaa, 0xa6, 0xdd, 0x0a, 0x48, 0xeb, 0x89, 0xc9,
+    0x1d, 0xfc, 0xbb, 0x27, 0x84, 0x87, 0x04, 0x12, 0xca, 0x08, 0xfb, 0x71, 0x84, 0xda, 0x86, 0x44,
+    0x00, 0x53, 0x25, 0x47, 0xea, 0xeb, 0x5c, 0x72, 0x96, 0x55, 0xba, 0x31, 0x31, 0xc9, 0x6c, 0x4c,
+    0x6b, 0x25, 0x28, 0x61, 0xe1, 0x88, 0x58, 0xb7, 0xa0, 0x9c, 0x4b, 0x0a, 0x79, 0xb1, 0xf9, 0x36,
+    0xa5, 0xac, 0x31, 0x88, 0xb1, 0x3a, 0xd0, 0x78, 0x63, 0x50, 0x67, 0x96, 0x3f, 0x6e, 0xca, 0x18,
+    0xd1, 0x61, 0x12, 0xf6, 0x61, 0x64, 0x24, 0x18, 0x1f, 0xbd, 0x73, 0x79, 0x86, 0x4b, 0x81, 0x6e,
+    0xd2, 0x30, 0x24, 0x3b, 0xb4, 0x94, 0x89, 0x1e, 0xb5, 0x14, 0xd9, 0xe0, 0x0a, 0xbb, 0x51, 0x72,
+    0x57, 0x51, 0xce, 0xed, 0xdb, 0xb8, 0xc0, 0x24, 0xb1, 0x8d, 0x4c, 0xb8, 0x41, 0xf5, 0xe1, 0xd8,
+    0x48, 0x3a, 0x18, 0x7e, 0x3e, 0xbe, 0x54, 0x0e, 0x03, 0x8a, 0x69, 0x9b, 0xc5, 0x8d, 0x90, 0xba,
+    0x2d, 0x4f, 0x0a, 0x11, 0x28, 0x05, 0x48, 0x69, 0x26, 0x1d, 0x66, 0x81, 0xf9, 0x32, 0x24, 0x74,
+    0x71, 0xf8, 0xdc, 0xa3, 0x0b, 0x65, 0x54, 0xf2, 0xf3, 0xd8, 0xf5, 0xbe, 0xa4, 0x0f, 0xa3, 0xf8,
+    0xed, 0xf6, 0xbb, 0x81, 0x64, 0xaf, 0x9d, 0xb1, 0x67, 0xcf, 0x9f, 0x18, 0x16, 0x78, 0x5f, 0x99,
+    0x4b, 0xf1, 0x7f, 0x54, 0xbf, 0x13, 0xb8, 0xe6, 0xbf, 0x0e, 0x37, 0x08, 0x7c, 0x52, 0xdc, 0x11,
+    0x11, 0x82, 0x01, 0xc0, 0xa8, 0x8b, 0x58, 0xa5, 0xd2, 0x90, 0x7e, 0x3b, 0x6f, 0x2c, 0xc2, 0x52,
+    0xe9, 0x89, 0x23, 0x3a, 0xc7, 0x17, 0xc1, 0xa5, 0xbc, 0x68, 0x36, 0x22, 0xfb, 0x33, 0x7d, 0x8f,
+    0x29, 0xdd, 0x51, 0xa8, 0x4b, 0xf0, 0x6d, 0xf3, 0x3d, 0x8a, 0x84, 0xd3, 0xf8, 0x3d, 0x5e, 0xa7,
+    0xc6, 0x17, 0x4c, 0x4a, 0x10, 0xe8, 0xde, 0x63, 0x87, 0x5f, 0x63, 0xa0, 0x2e, 0x19, 0xe1, 0xd1,
+    0x7e, 0x15, 0xac, 0xec, 0x49, 0x3c, 0xbc, 0x98, 0x25, 0x66, 0x67, 0x13, 0x2d, 0x09, 0x02, 0xc1,
+    0x87, 0x1c, 0x6a, 0xd1, 0x13, 0x8e, 0x64, 0xa9, 0x38, 0xf4, 0xbb, 0xcb, 0x6c, 0xe7, 0xc1, 0x3e,
+    0x57, 0x95, 0xcc, 0xc5, 0xf3, 0x70, 0xd2, 0xc8, 0xa5, 0x1e, 0xca, 0xd6, 0x94, 0x0c, 0xd7, 0xe4,
+    0x93, 0x1a, 0x20, 0x25, 0x90, 0xd1, 0xb8, 0x23, 0xe2, 0x4c, 0x56, 0x3a, 0x67, 0x8f, 0x2b, 0x18,
+    0x5e, 0x7e, 0x2e, 0xc7, 0x90, 0xe6, 0x6f, 0x57, 0x07, 0x23, 0xac, 0x5e, 0xfa, 0x1c, 0x83, 0x75,
+    0x5a, 0x73, 0x24, 0x0e, 0x30, 0x3c, 0xf2, 0x7a, 0x12, 0x30, 0xdd, 0x58, 0xd9, 0xaa, 0x69, 0x35,
+    0x1d, 0xd5, 0xc9, 0x49, 0x38, 0xf8, 0x5c, 0x69, 0x3c, 0x52, 0x2f, 0x09, 0x2c, 0xf8, 0x0d, 0x0a,
+    0x3b, 0xb6, 0x68, 0x7b, 0x88, 0x7d, 0x3e, 0x7e, 0xa7, 0x8d, 0x62, 0xef, 0x93, 0x27, 0xb1, 0xc8,
+    0x87, 0x87, 0x2e, 0x59, 0x98, 0x94, 0x16, 0x36, 0xb8, 0xf9, 0x01, 0xf6, 0x6e, 0xee, 0x76, 0x8d,
+    0xe7, 0xab, 0xa8, 0xe4, 0x58, 0x28, 0x9d, 0x22, 0x04, 0x43, 0xb0, 0x74, 0xc5, 0x01, 0xfc, 0x8f,
+    0x01, 0x1d, 0xd1, 0xa3, 0x41, 0x8e, 0x78, 0xf2, 0x30, 0x14, 0x8f, 0x8e, 0x1d, 0x43, 0xd1, 0xe8,
+    0x6c, 0x71, 0xfc, 0xf0, 0xf0, 0x94, 0x2c, 0x67, 0x9e, 0x2f, 0x3f, 0x45, 0xae, 0x76, 0xd3, 0xd8,
+    0x7d, 0x97, 0x74, 0xb3, 0x85, 0xe5, 0xf5, 0xca, 0xf9, 0x1e, 0xd2, 0xfe, 0x8f, 0x24, 0xfb, 0x9e,
+    0x26, 0xb6, 0xcf, 0xbf, 0x07, 0x33, 0x4a, 0x33, 0xf5, 0xdd, 0x2e, 0x36, 0xa2, 0xd6, 0xdb, 0x4a,
+    0x4c, 0xf8, 0x51, 0x92, 0xc4, 0x53, 0xc1, 0xef, 0xc6, 0xf8, 0x5d, 0xc8, 0xbe, 0x7d, 0xb7, 0x97,
+    0x83, 0x99, 0xca, 0x32, 0xed, 0xb1, 0x6c, 0x44, 0xc9, 0xdb, 0x99, 0xca, 0x52, 0x5b, 0xa3, 0x46,
+    0x71, 0x1a, 0x33, 0xc0, 0xbd, 0x09, 0x34, 0x59, 0x8e, 0x86, 0x65, 0x49, 0x3a, 0x63, 0x6b, 0x15,
+    0x82, 0x68, 0x6e, 0xe1, 0x77, 0x25, 0xfc, 0x19, 0xf9, 0x18, 0x52, 0x00, 0x96, 0x49, 0x92, 0xdf,
+    0x9d, 0x94, 0xd5, 0xfe, 0x09, 0x38, 0x94, 0x0e, 0x11, 0xda, 0x26, 0x58, 0x39, 0x99, 0xf5, 0xe3,
+    0x75, 0x0a, 0xdb, 0x5e, 0x61, 0x33, 0xcc, 0xcc, 0xa5, 0x6f, 0x7d, 0x8d, 0x27, 0x72, 0x58, 0xa8,
+    0x08, 0x90, 0x87, 0x96, 0x55, 0x04, 0x76, 0x6f, 0xc0, 0xe7, 0x67, 0x4d, 0xd5, 0x0e, 0xb4, 0x23,
+    0x81, 0xc7, 0xec, 0x8b, 0xea, 0x6a, 0x68, 0xd9, 0xbd, 0x02, 0xcc, 0x12, 0x09, 0x6b, 0x2a, 0x15,
+    0x3e, 0x2e, 0x1e, 0x37, 0x98, 0x87, 0x16, 0x3c, 0x00, 0x90, 0xe1, 0x4c, 0xf0, 0x7d, 0x94, 0xbc,
+    0x4c, 0x06, 0x64, 0xbe, 0x0b, 0x81, 0x12, 0x30, 0x26, 0x25, 0x16, 0x98, 0x32, 0x28, 0x28, 0xd2,
+    0xda, 0x3c, 0x95, 0x31, 0x00, 0x2e, 0x65, 0xa0, 0x66, 0xcd, 0x74, 0x55, 0xa6, 0x34, 0xfc, 0x71,
+    0x90, 0x2c, 0x07, 0xa4, 0x25, 0x4f, 0x7d, 0xbc, 0xed, 0xe0, 0xb0, 0xc7, 0xa0, 0x05, 0x78, 0x6c,
+    0x38, 0x03, 0xd1, 0x2d, 0xe5, 0xc0, 0xd0, 0x62, 0xef, 0x3d, 0x7e, 0x97, 0x32, 0x20, 0x7a, 0x7d,
+    0x57, 0x6f, 0x69, 0x25, 0x8f, 0x8e, 0x87, 0x0b, 0x60, 0x3c, 0x3a, 0xee, 0x9b, 0x03, 0x2a, 0x33,
+    0xb4, 0xec, 0xaf, 0x62, 0x60, 0x91, 0x81, 0xd1, 0x36, 0xb0, 0x11, 0xcd, 0x58, 0xe5, 0xc0, 0xa0,
+    0x52, 0xa4, 0x18, 0xbb, 0x33, 0x28, 0x67, 0xf5, 0x58, 0xf2, 0x34, 0x2b, 0xe9, 0xad, 0x6a, 0xce,
+    0xbc, 0xee, 0xb1, 0xdc, 0x3b, 0x74, 0xaf, 0x2e, 0xcb, 0x46, 0xc5, 0x62, 0x40, 0x2f, 0xb6, 0x34,
+    0x07, 0x16, 0x12, 0x2d, 0x94, 0x56, 0x6a, 0x35, 0x20, 0xf4, 0x6c, 0xb1, 0x29, 0x85, 0x63, 0xa5,
+    0x71, 0xa9, 0x79, 0xa8, 0xde, 0x9c, 0xdb, 0x32, 0x29, 0x1b, 0x35, 0x94, 0xcb, 0x30, 0xc6, 0x27,
+    0x09, 0x3c, 0x16, 0x19, 0x65, 0x06, 0x8a, 0x55, 0x71, 0x16, 0x70, 0x8a, 0x34, 0x60, 0x50, 0x3d,
+    0x37, 0x14, 0x34, 0x31, 0xd3, 0x08, 0xc1, 0xc5, 0x49, 0xc3, 0x19, 0x8e, 0x38, 0xca, 0xa5, 0xb0,
+    0xe5, 0xb8, 0xe0, 0x88, 0x09, 0x26, 0x88, 0xf2, 0x89, 0x20, 0x59, 0xa6, 0xc9, 0x55, 0x40, 0x82,
+    0xa8, 0x85, 0xb3, 0x74, 0x29, 0x5f, 0xe0, 0x9f, 0x95, 0x61, 0x79, 0x65, 0x56, 0x4b, 0x06, 0x8c,
+    0x28, 0x05, 0x9a, 0x19, 0x8d, 0x18, 0x1b, 0x88, 0x6a, 0xf5, 0xc1, 0xe8, 0x70, 0x00, 0x9e, 0x78,
+    0x83, 0x8a, 0x69, 0x2b, 0x28, 0x11, 0x00, 0x47, 0x92, 0x84, 0x81, 0x43, 0xc8, 0x95, 0xab, 0x92,
+    0x60, 0xc8, 0x58, 0x2a, 0x89, 0xb2, 0x12, 0x82, 0x89, 0x81, 0x9a, 0x63, 0x03, 0xa2, 0xc2, 0x96,
+    0x5d, 0xda, 0xc8, 0xaf, 0xb2, 0xc8, 0xc2, 0xb5, 0x85, 0x38, 0x39, 0xf5, 0x4b, 0x41, 0x05, 0x1e,
+    0x80, 0x7f, 0x07, 0x56, 0x67, 0x91, 0xb9, 0x27, 0x9b, 0x3c, 0xe4, 0x1c, 0x9c, 0x2d, 0xf7, 0xe4,
+    0x40, 0x2c, 0x96, 0x96, 0x8f, 0xa6, 0x1f, 0x3b, 0x49, 0x3b, 0x36, 0xe0, 0xd6, 0xd4, 0x3f, 0x55,
+    0xb8, 0x8e, 0x08, 0x48, 0x61, 0x9e, 0xa4, 0x85, 0xdf, 0xb5, 0x6a, 0xef, 0x7e, 0xbe, 0xc7, 0x80,
+    0x56, 0x29, 0x32, 0x17, 0xa6, 0xc5, 0x85, 0x1d, 0xbe, 0xdc, 0x28, 0x81, 0x8e, 0xe3, 0x8b, 0xd7,
+    0x66, 0xc6, 0x13, 0x76, 0xc1, 0x10, 0x68, 0x03, 0xdf, 0x2f, 0x1b, 0x18, 0x0b, 0x73, 0xda, 0x72,
+    0xdd, 0x5c, 0x6e, 0x61, 0xfa, 0xb2, 0xca, 0xad, 0x70, 0xfa, 0xa2, 0xb4, 0x03, 0xaa, 0x95, 0x10,
+    0x65, 0x4c, 0x94, 0x64, 0x79, 0x60, 0x10, 0xa8, 0x98, 0x53, 0x97, 0xbb, 0x34, 0x49, 0xc1, 0x38,
+    0x3b, 0x89, 0xdb, 0xad, 0xd3, 0x01, 0x99, 0x19, 0x7e, 0xbc, 0xb3, 0xab, 0x76, 0xe7, 0x5b, 0xb4,
+    0xbb, 0xb9, 0x89, 0xd3, 0xda, 0x3d, 0xd9, 0x17, 0xa6, 0x9a, 0x36, 0x44, 0x98, 0x67, 0x84, 0x0a,
+    0x10, 0x1c, 0x48, 0x49, 0xa3, 0x31, 0xf2, 0xbc, 0xb7, 0xcb, 0x83, 0x90, 0x7c, 0xba, 0x4b, 0x9b,
+    0xc1, 0x06, 0xd8, 0xf3, 0x60, 0x7e, 0xda, 0x66, 0xc8, 0x7c, 0xa4, 0xea, 0xa3, 0xa7, 0xd7, 0x8c,
+    0xb1, 0x73, 0x79, 0x36, 0x1f, 0xcb, 0xef, 0x3e, 0xa9, 0x24, 0xe0, 0x07, 0x7e, 0x1c, 0xde, 0x4b,
+    0x3b, 0x7e, 0xf5, 0xfa, 0x30, 0x69, 0x4f, 0x9b, 0x47, 0x4f, 0x85, 0x9a, 0x0b, 0x9e, 0x39, 0xb9,
+    0xb8, 0x03, 0xbf, 0xa7, 0x6d, 0x68, 0xe0, 0xec, 0xd1, 0x11, 0x76, 0xf5, 0xce, 0xc6, 0x11, 0x95,
+    0x54, 0xe5, 0x29, 0xbc, 0x38, 0xc8, 0x83, 0x20, 0xab, 0x54, 0x88, 0x0c, 0xba, 0xe1, 0xec, 0xf7,
+    0x07, 0xc7, 0xbd, 0x12, 0x2c, 0x78, 0x15, 0x2c, 0x5c, 0xd0, 0xfb, 0x47, 0xe8, 0xc5, 0x7f, 0x4e,
+    0xb7, 0x73, 0x4d, 0x87, 0x9f, 0x1c, 0x5e, 0xaf, 0x61, 0x3c, 0x3d, 0x61, 0xc0, 0xe4, 0x81, 0xd2,
+    0x50, 0x4c, 0x7d, 0x39, 0x62, 0xe2, 0xa0, 0x4e, 0x90, 0xfb, 0xfc, 0x3a, 0x62, 0xf3, 0x76, 0x32,
+    0x5c, 0x35, 0x9d, 0x5a, 0x38, 0x07, 0x95, 0xed, 0x96, 0x4e, 0x63, 0x71, 0xf0, 0xca, 0xce, 0x4c,
+    0xcf, 0x94, 0x23, 0x46, 0x20, 0x77, 0xf3, 0xc5, 0xc1, 0x54, 0x4c, 0x6b, 0x46, 0xd8, 0x5e, 0x18,
+    0xa8, 0x71, 0x9c, 0xc8, 0xef, 0x1a, 0x82, 0xb7, 0xa4, 0xca, 0x74, 0x04, 0x23, 0x97, 0xdb, 0xc3,
+    0x27, 0x76, 0x67, 0xe7, 0x16, 0x63, 0x3d, 0x06, 0xc7, 0xad, 0x5c, 0x93, 0x4f, 0x6d, 0x2f, 0x76,
+    0x08, 0x99, 0x02, 0x79, 0x73, 0xe6, 0xf0, 0x12, 0xf0, 0x4c, 0xbc, 0xf0, 0x98, 0x23, 0x74, 0x86,
+    0x38, 0xc8, 0x79, 0xe7, 0x1c, 0x11, 0x49, 0x02, 0xf1, 0xaf, 0x8b, 0xb2, 0x3f, 0xa7, 0xbd, 0xdd,
+    0x1b, 0xac, 0x55, 0x79, 0x44, 0x8b, 0x65, 0xab, 0x01, 0x9a, 0xf0, 0xa0, 0x0f, 0xcb, 0x8d, 0xdd,
+    0x9c, 0x46, 0xcb, 0xc7, 0x0b, 0x20, 0xbb, 0x92, 0x4c, 0xb9, 0xce, 0x83, 0x01, 0xf6, 0xb5, 0xd1,
+    0x11, 0x16, 0x54, 0xfd, 0xad, 0xc0, 0xea, 0xe1, 0x81, 0xc4, 0x82, 0x83, 0xeb, 0xc2, 0x03, 0x00,
+    0x45, 0x2c, 0x54, 0x01, 0x23, 0x18, 0x0c, 0x78, 0x45, 0x24, 0x8a, 0x6d, 0x2f, 0x2a, 0x2c, 0x99,
+    0xb8, 0x43, 0x20, 0x1e, 0xd1, 0xd5, 0x72, 0xf5, 0xd3, 0x36, 0x60, 0x61, 0x9c, 0x70, 0x6c, 0xd0,
+    0x7c, 0xb5, 0xac, 0x92, 0x38, 0xf0, 0xa5, 0x17, 0x6c, 0x93, 0x0e, 0xf7, 0x88, 0xa2, 0xbb, 0x30,
+    0xf8, 0x77, 0x96, 0xcc, 0x96, 0x03, 0x3e, 0x55, 0x5c, 0x62, 0x98, 0x8f, 0x58, 0x80, 0x6b, 0xae,
+    0x3e, 0xfe, 0x13, 0xd5, 0x10, 0x89, 0x04, 0x05, 0x8d, 0x26, 0x50, 0x4a, 0x13, 0x85, 0x8c, 0x41,
+    0x8a, 0xb6, 0xc6, 0x77, 0x20, 0xa0, 0x40, 0xe1, 0x4a, 0x14, 0x63, 0x08, 0x03, 0x03, 0x1c, 0x24,
+    0xbc, 0x11, 0x0a, 0x77, 0x80, 0x69, 0x04, 0x5a, 0x32, 0x37, 0x9f, 0x1a, 0xa4, 0x3d, 0xa3, 0xbb,
+    0x35, 0xc6, 0xc7, 0xc6, 0x9b, 0xaa, 0x10, 0xcf, 0x1b, 0xc6, 0x88, 0x90, 0xd9, 0x47, 0x76, 0x8a,
+    0xa4, 0x2f, 0x97, 0xe3, 0x9e, 0xed, 0x19, 0xac, 0x1d, 0x70, 0x90, 0xc1, 0x1a, 0xe1, 0x25, 0x10,
+    0x32, 0x40, 0xdf, 0x68, 0xe0, 0x24, 0x2a, 0xe4, 0xc5, 0x7f, 0x9f, 0x7b, 0xba, 0xb8, 0x17, 0xd3,
+    0x5c, 0xd5, 0x20, 0x6f, 0x6a, 0x1c, 0xbc, 0x2f, 0x93, 0x56, 0x03, 0x3e, 0x7a, 0x65, 0x04, 0x96,
+    0x48, 0x79, 0x4a, 0x84, 0x20, 0x11, 0xc2, 0x31, 0x82, 0x09, 0x18, 0x08, 0x67, 0x2c, 0x13, 0x21,
+    0x32, 0xd6, 0x9c, 0x1b, 0x15, 0x5e, 0xdd, 0x23, 0xe0, 0xe8, 0x54, 0xb0, 0x84, 0x49, 0x69, 0x14,
+    0x02, 0xac, 0x72, 0x60, 0x15, 0x67, 0xba, 0x46, 0xd7, 0x2b, 0x4a, 0x84, 0x08, 0x48, 0x41, 0x19,
+    0x11, 0x6d, 0x9c, 0x2c, 0x40, 0x82, 0xb4, 0xaa, 0xc9, 0x07, 0x0c, 0xf6, 0xbd, 0x95, 0x55, 0x01,
+    0xeb, 0x7c, 0x98, 0x09, 0x6d, 0xe1, 0x99, 0x87, 0x29, 0x84, 0x01, 0x15, 0x64, 0x91, 0x10, 0xd3,
+    0x08, 0x5c, 0xc2, 0x9c, 0x0a, 0x92, 0x42, 0x35, 0xe9, 0x29, 0x40, 0x43, 0x20, 0xc0, 0x7d, 0xa9,
+    0xc9, 0xb0, 0x97, 0xda, 0xd7, 0x70, 0x60, 0x8f, 0x3d, 0xb2, 0x8a, 0xcb, 0x90, 0x76, 0xc6, 0xd6,
+    0x4c, 0x05, 0xaa, 0xc5, 0x4b, 0x3a, 0xc6, 0xa7, 0x15, 0xa8, 0x90, 0x85, 0x10, 0x12, 0x32, 0x0d,
+    0x67, 0x01, 0x0b, 0x19, 0x33, 0x66, 0x63, 0x71, 0xeb, 0x95, 0x95, 0x4c, 0xa2, 0xbd, 0xa3, 0x00,
+    0x20, 0xb1, 0x0f, 0x69, 0xa2, 0x24, 0x75, 0x8e, 0x45, 0x43, 0x0b, 0x24, 0x2c, 0x64, 0x71, 0x5e,
+    0x71, 0x84, 0xd1, 0x40, 0x24, 0xc6, 0xb5, 0x40, 0x03, 0x9a, 0x44, 0x47, 0x9e, 0xd0, 0xc5, 0x55,
+    0xd1, 0x26, 0xd8, 0x51, 0x32, 0x12, 0x33, 0x26, 0xb8, 0xc0, 0x40, 0x10, 0xc0, 0x25, 0x55, 0x1e,
+    0xf5, 0xa8, 0x4b, 0x59, 0xc1, 0x15, 0xce, 0x3c, 0x29, 0x00, 0xde, 0x38, 0x14, 0x90, 0x44, 0x84,
+    0x94, 0x43, 0x86, 0x10, 0xcd, 0x41, 0x67, 0x4a, 0x94, 0x33, 0x94, 0x0a, 0x50, 0x52, 0x04, 0x08,
+    0xe5, 0x08, 0x94, 0xa0, 0xb5, 0x24, 0x50, 0x8e, 0xb4, 0x8a, 0x29, 0x18, 0x08, 0xf4, 0xde, 0x8c,
+    0x54, 0x20, 0x63, 0x01, 0xd0, 0x77, 0xfe, 0xdf, 0xfc, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xbf, 0xfb,
+    0xff, 0xff, 0xbb, 0xff, 0xdf, 0xbf, 0xff, 0xef, 0xff, 0xef, 0x7f, 0xbf, 0xff, 0xdf, 0xff, 0xff,
+    0xef, 0xef, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xdf, 0xff, 0xf9, 0xda, 0xff, 0xfb, 0xbd,
+    0xf7, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xfb, 0xee, 0xdf, 0xbf, 0x3f,
+    0xef, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0xc0, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf9,
+    0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7,
+    0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c,
 };
 
 #endif // CLOSEDHAT_SAMPLE_H
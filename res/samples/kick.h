@@ -3,4462 +3,417 @@
 
 #include <stdint.h>
 
+// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).
 const int kick_sample_len = 44538;
-const int16_t kick_sample[] = {
-    -2761, -5700, 10362, 13322, 11270, 9778, 3096, 1679, 1724, 5485, 
-    8192, 8024, 3233, -5463, -12353, -11656, -8485, -10420, -12026, -11431, 
-    -10433, -328, 10568, 10865, 806, -12328, -11803, -9926, -7009, -265, 
-    6432, 11751, 11731, 10348, 9838, 9264, 8899, 8612, 8468, 8213, 
-    5666, -1842, -10331, -12738, -11486, -10579, -9741, -9269, -8844, -8583, 
-    -8425, -8318, -8264, -8191, -8202, -8108, -8159, -7948, -8148, -7748, 
-    -5039, -2536, -1114, -479, 794, 3748, 7465, 9965, 10590, 10830, 
-    10723, 10101, 9803, 9570, 9415, 9305, 9226, 9175, 9104, 9024, 
-    9012, 8933, 8878, 8770, 8799, 8880, 7055, 4426, 4298, 5040, 
-    3776, 819, -643, 1048, 3205, 3480, 1991, 939, 1459, 3258, 
-    4585, 1514, -1293, -1802, -414, 1281, 433, -1647, -3276, -3618, 
-    -3295, -2916, -3320, -3581, -3250, -3583, -4650, -5725, -6179, -5866, 
-    -5054, -4855, -5687, -6678, -6997, -5659, -5351, -6340, -6730, -6418, 
-    -5675, -6165, -6550, -6567, -5629, -3482, -5186, -6732, -5878, -4787, 
-    -4629, -4690, -4405, -3962, -5392, -6209, -3509, -2470, -3005, -2995, 
-    -2503, -2436, -2801, -2733, -2334, -2623, -2587, -1371, -1043, -1919, 
-    -2246, -1629, -982, -783, -775, -732, -972, -508, -555, -727, 
-    210, 38, -524, -787, -469, 100, 526, 823, 1187, -108, 
-    -576, 1613, 3173, 3484, 2991, 2946, 3757, 4869, 5479, 6026, 
-    5332, 4305, 5031, 5861, 5194, 4447, 4928, 6170, 5850, 3036, 
-    3794, 4983, 3414, 2813, 3266, 3505, 3118, 2571, 1997, 1537, 
-    1579, 1595, 1319, 409, -487, -862, -831, -780, -1075, -2222, 
-    -3272, -3245, -3197, -2910, -3736, -4150, -3336, -3137, -4012, -4520, 
-    -3571, -2462, -3071, -4443, -4271, -3681, -3584, -3928, -4509, -4941, 
-    -4745, -4408, -4195, -4659, -5473, -5095, -4792, -5065, -5174, -5067, 
-    -4909, -4776, -4657, -4695, -4268, -3956, -4916, -5222, -4110, -3381, 
-    -3402, -3580, -3559, -3164, -3074, -3008, -2681, -2375, -2275, -2530, 
-    -2317, -1480, -704, -620, -934, -601, 41, 554, 683, 828, 
-    1627, 2215, 2164, 1970, 2258, 2801, 3193, 3304, 3221, 3796, 
-    4686, 4975, 4809, 4559, 4673, 5152, 5585, 5550, 5480, 5798, 
-    6249, 6608, 6757, 6942, 7424, 7663, 7309, 6649, 6457, 7048, 
-    7263, 6903, 6454, 6468, 6894, 7139, 7060, 7057, 7158, 6997, 
-    6919, 6857, 6768, 6710, 6668, 6661, 6578, 6240, 6099, 6161, 
-    6059, 5501, 4838, 4988, 4827, 4375, 4252, 4219, 3849, 3326, 
-    3071, 3020, 2760, 2105, 1451, 844, 368, -6, -356, -725, 
-    -1188, -1654, -2013, -2266, -2548, -3162, -3806, -4063, -4405, -4893, 
-    -5160, -5165, -5059, -5182, -5560, -6205, -6058, -5485, -6073, -6564, 
-    -6372, -6041, -6195, -6605, -6781, -6657, -6591, -6478, -6314, -6493, 
-    -6711, -6766, -6524, -6085, -5834, -5965, -6363, -6316, -5868, -5546, 
-    -5480, -5593, -5413, -5042, -4846, -4781, -4681, -4375, -4090, -3951, 
-    -4045, -3941, -3338, -2924, -2864, -2844, -2605, -2113, -1709, -1587, 
-    -1735, -1372, -788, -638, -469, -95, 410, 708, 751, 791, 
-    1109, 1972, 2208, 2051, 2318, 2733, 2904, 2974, 3344, 3733, 
-    3832, 3729, 3891, 4201, 4424, 4499, 4543, 4801, 5097, 5180, 
-    5100, 5027, 5030, 5001, 4942, 4930, 5020, 5118, 5042, 4849, 
-    4724, 4712, 4628, 4472, 4139, 3838, 4150, 4218, 3585, 3066, 
-    3176, 3208, 2758, 2253, 2216, 2033, 1438, 1496, 1692, 1422, 
-    860, 313, 52, -59, -200, -787, -1273, -1200, -1379, -1861, 
-    -2362, -2634, -2787, -3014, -3233, -3504, -3716, -4045, -4621, -4940, 
-    -4802, -4681, -4979, -5404, -5770, -6026, -6106, -6021, -5962, -6176, 
-    -6511, -6611, -6486, -6380, -6471, -6700, -6817, -6817, -6729, -6615, 
-    -6554, -6593, -6717, -6677, -6543, -6439, -6319, -6270, -6145, -6022, 
-    -5948, -5908, -5872, -5736, -5424, -5329, -5445, -5287, -4985, -4781, 
-    -4697, -4465, -4157, -3925, -3748, -3535, -3259, -2924, -2564, -2270, 
-    -2077, -1891, -1539, -1107, -679, -282, 70, 430, 828, 1334, 
-    1890, 2345, 2732, 3206, 3777, 4196, 4514, 4956, 5417, 5816, 
-    6131, 6398, 6687, 7027, 7374, 7602, 7770, 7926, 8069, 8213, 
-    8431, 8653, 8687, 8714, 8734, 8608, 8465, 8303, 8143, 7994, 
-    7873, 7782, 7650, 7503, 7355, 7257, 7192, 7069, 6931, 6815, 
-    6741, 6684, 6603, 6480, 6344, 6278, 6216, 6115, 6016, 5923, 
-    5855, 5779, 5694, 5621, 5534, 5466, 5398, 5284, 5003, 4711, 
-    4581, 4373, 4051, 3638, 3232, 2995, 2679, 2213, 1692, 1342, 
-    960, 440, 39, -144, -534, -1212, -1644, -1958, -2335, -2765, 
-    -3210, -3545, -3789, -4108, -4717, -5183, -5312, -5548, -5846, -6090, 
-    -6288, -6497, -6742, -6959, -7087, -7198, -7310, -7441, -7587, -7725, 
-    -7810, -7800, -7826, -7923, -8003, -8012, -7983, -7967, -7850, -7784, 
-    -7841, -7840, -7755, -7591, -7456, -7399, -7371, -7289, -7137, -6966, 
-    -6830, -6789, -6722, -6495, -6237, -6077, -5945, -5734, -5428, -5086, 
-    -4888, -4778, -4601, -4332, -3986, -3694, -3524, -3372, -3059, -2670, 
-    -2478, -2292, -1973, -1602, -1247, -985, -782, -543, -262, 63, 
-    367, 635, 901, 1078, 1357, 1733, 2040, 2205, 2346, 2654, 
-    3013, 3295, 3520, 3722, 3941, 4173, 4416, 4622, 4798, 4964, 
-    5126, 5331, 5556, 5736, 5859, 5983, 6124, 6273, 6430, 6517, 
-    6537, 6575, 6639, 6749, 6816, 6850, 6923, 6989, 7049, 7049, 
-    7032, 7036, 7066, 7129, 7113, 7065, 7029, 7059, 7104, 7015, 
-    6901, 6818, 6846, 6861, 6710, 6618, 6627, 6574, 6449, 6336, 
-    6265, 6166, 6007, 5786, 5623, 5561, 5418, 5137, 4942, 4817, 
-    4662, 4520, 4345, 4103, 3831, 3592, 3409, 3245, 3036, 2765, 
-    2441, 2213, 2052, 1839, 1580, 1292, 1042, 879, 731, 425, 
-    130, -14, -189, -447, -701, -911, -1089, -1260, -1482, -1755, 
-    -1944, -2086, -2268, -2428, -2606, -2768, -2870, -2954, -3037, -3148, 
-    -3280, -3363, -3397, -3477, -3575, -3645, -3694, -3756, -3816, -3861, 
-    -3873, -3951, -4025, -3974, -3945, -3920, -3928, -3940, -3942, -3954, 
-    -3959, -3992, -4007, -4012, -4058, -4113, -4161, -4191, -4238, -4305, 
-    -4380, -4451, -4467, -4522, -4605, -4674, -4751, -4804, -4880, -4957, 
-    -5040, -5118, -5181, -5255, -5261, -5243, -5219, -5204, -5211, -5189, 
-    -5172, -5125, -5069, -5033, -5004, -4966, -4882, -4830, -4779, -4695, 
-    -4627, -4548, -4466, -4364, -4272, -4212, -4113, -3992, -3870, -3751, 
-    -3631, -3520, -3441, -3334, -3204, -3061, -2973, -2936, -2727, -2546, 
-    -2472, -2347, -2175, -2021, -1908, -1780, -1612, -1449, -1338, -1260, 
-    -1160, -1021, -904, -818, -720, -598, -486, -373, -262, -160, 
-    -72, -39, 10, 55, 114, 179, 231, 273, 297, 312, 
-    381, 459, 468, 497, 526, 554, 603, 642, 644, 647, 
-    658, 674, 710, 735, 737, 742, 763, 775, 778, 790, 
-    804, 824, 838, 856, 869, 872, 878, 868, 879, 902, 
-    907, 906, 899, 915, 905, 901, 914, 900, 908, 901, 
-    889, 873, 852, 850, 830, 807, 798, 799, 788, 757, 
-    741, 710, 668, 647, 642, 652, 618, 568, 537, 524, 
-    518, 480, 438, 401, 383, 391, 376, 319, 260, 238, 
-    219, 194, 185, 168, 154, 138, 137, 165, 163, 162, 
-    148, 144, 171, 211, 266, 306, 331, 348, 386, 435, 
-    460, 522, 579, 623, 674, 716, 774, 820, 858, 925, 
-    1010, 1082, 1138, 1224, 1322, 1426, 1536, 1619, 1692, 1777, 
-    1864, 1929, 1985, 2056, 2130, 2216, 2298, 2376, 2476, 2565, 
-    2657, 2748, 2834, 2934, 3016, 3093, 3166, 3246, 3324, 3387, 
-    3464, 3526, 3601, 3688, 3755, 3824, 3886, 3958, 4022, 4087, 
-    4160, 4221, 4293, 4366, 4440, 4509, 4588, 4673, 4723, 4765, 
-    4811, 4863, 4927, 5003, 5069, 5125, 5188, 5240, 5281, 5332, 
-    5377, 5427, 5472, 5503, 5543, 5573, 5603, 5622, 5645, 5683, 
-    5711, 5731, 5736, 5751, 5771, 5769, 5779, 5778, 5773, 5771, 
-    5766, 5750, 5708, 5665, 5621, 5587, 5558, 5501, 5447, 5380, 
-    5313, 5247, 5170, 5091, 5009, 4939, 4859, 4765, 4683, 4586, 
-    4468, 4348, 4243, 4130, 4002, 3882, 3755, 3610, 3463, 3316, 
-    3158, 2996, 2838, 2663, 2492, 2329, 2151, 1966, 1772, 1593, 
-    1420, 1234, 1045, 849, 662, 470, 273, 69, -152, -362, 
-    -571, -784, -997, -1203, -1396, -1594, -1777, -1957, -2136, -2300, 
-    -2462, -2604, -2756, -2907, -3040, -3171, -3292, -3418, -3537, -3648, 
-    -3757, -3868, -3984, -4080, -4187, -4291, -4383, -4486, -4576, -4652, 
-    -4711, -4767, -4823, -4866, -4931, -4992, -5048, -5096, -5144, -5218, 
-    -5290, -5356, -5418, -5481, -5549, -5603, -5650, -5705, -5759, -5807, 
-    -5856, -5916, -5974, -6032, -6093, -6150, -6198, -6228, -6264, -6302, 
-    -6347, -6402, -6447, -6483, -6502, -6527, -6555, -6574, -6609, -6628, 
-    -6648, -6668, -6685, -6704, -6713, -6720, -6726, -6747, -6771, -6778, 
-    -6791, -6796, -6809, -6818, -6816, -6826, -6839, -6839, -6834, -6830, 
-    -6816, -6791, -6769, -6743, -6719, -6693, -6650, -6609, -6559, -6509, 
-    -6463, -6397, -6323, -6246, -6169, -6084, -5990, -5892, -5782, -5677, 
-    -5566, -5454, -5332, -5196, -5062, -4914, -4759, -4606, -4458, -4305, 
-    -4139, -3991, -3840, -3686, -3528, -3354, -3183, -3009, -2841, -2676, 
-    -2509, -2332, -2137, -1958, -1769, -1571, -1380, -1188, -1006, -816, 
-    -619, -423, -228, -39, 156, 346, 546, 747, 934, 1125, 
-    1316, 1514, 1713, 1905, 2099, 2278, 2463, 2646, 2818, 2981, 
-    3137, 3301, 3455, 3608, 3759, 3895, 4037, 4173, 4305, 4429, 
-    4551, 4671, 4780, 4888, 4996, 5111, 5229, 5334, 5437, 5539, 
-    5645, 5751, 5852, 5948, 6037, 6131, 6217, 6293, 6369, 6444, 
-    6522, 6589, 6653, 6717, 6773, 6827, 6874, 6919, 6962, 7007, 
-    7047, 7080, 7116, 7139, 7155, 7176, 7189, 7201, 7211, 7221, 
-    7223, 7220, 7223, 7217, 7208, 7196, 7189, 7183, 7160, 7144, 
-    7121, 7100, 7083, 7052, 7022, 6991, 6960, 6920, 6878, 6839, 
-    6784, 6733, 6685, 6639, 6586, 6521, 6461, 6400, 6338, 6271, 
-    6196, 6108, 6011, 5930, 5844, 5749, 5654, 5560, 5472, 5379, 
-    5280, 5182, 5084, 4979, 4872, 4776, 4677, 4570, 4463, 4354, 
-    4248, 4130, 4008, 3897, 3771, 3644, 3525, 3402, 3272, 3138, 
-    3005, 2863, 2741, 2620, 2479, 2348, 2214, 2081, 1941, 1797, 
-    1652, 1503, 1357, 1209, 1071, 922, 771, 630, 481, 339, 
-    195, 50, -93, -239, -388, -533, -669, -812, -954, -1088, 
-    -1225, -1360, -1497, -1640, -1781, -1922, -2061, -2198, -2329, -2458, 
-    -2586, -2717, -2853, -2981, -3101, -3227, -3350, -3472, -3593, -3715, 
-    -3838, -3957, -4075, -4194, -4317, -4435, -4548, -4662, -4764, -4880, 
-    -4988, -5086, -5191, -5297, -5399, -5491, -5582, -5664, -5748, -5839, 
-    -5912, -5993, -6069, -6136, -6204, -6274, -6347, -6407, -6460, -6521, 
-    -6583, -6627, -6667, -6723, -6771, -6807, -6840, -6867, -6894, -6918, 
-    -6937, -6957, -6987, -7015, -7025, -7032, -7043, -7055, -7064, -7062, 
-    -7067, -7075, -7066, -7057, -7052, -7031, -7009, -6993, -6976, -6948, 
-    -6918, -6882, -6851, -6809, -6759, -6723, -6674, -6615, -6560, -6508, 
-    -6451, -6386, -6317, -6241, -6184, -6119, -6031, -5947, -5866, -5793, 
-    -5710, -5623, -5547, -5476, -5386, -5294, -5218, -5126, -5022, -4922, 
-    -4825, -4738, -4646, -4545, -4452, -4360, -4259, -4165, -4073, -3973, 
-    -3870, -3772, -3675, -3578, -3472, -3360, -3261, -3158, -3047, -2938, 
-    -2834, -2726, -2609, -2495, -2388, -2284, -2172, -2065, -1972, -1862, 
-    -1748, -1648, -1547, -1441, -1339, -1245, -1151, -1059, -957, -850, 
-    -762, -664, -554, -455, -369, -277, -166, -60, 25, 126, 
-    240, 331, 420, 526, 624, 718, 819, 921, 1022, 1121, 
-    1212, 1303, 1407, 1506, 1596, 1691, 1791, 1887, 1980, 2071, 
-    2167, 2254, 2329, 2413, 2495, 2571, 2644, 2714, 2783, 2857, 
-    2943, 3015, 3088, 3166, 3224, 3285, 3359, 3429, 3488, 3548, 
-    3616, 3683, 3738, 3792, 3861, 3923, 3979, 4037, 4086, 4142, 
-    4202, 4257, 4306, 4359, 4405, 4451, 4508, 4554, 4599, 4653, 
-    4696, 4733, 4769, 4806, 4843, 4877, 4913, 4941, 4971, 5006, 
-    5040, 5076, 5107, 5140, 5170, 5199, 5234, 5259, 5280, 5307, 
-    5335, 5360, 5384, 5410, 5434, 5460, 5491, 5512, 5525, 5543, 
-    5562, 5583, 5602, 5620, 5634, 5647, 5652, 5659, 5674, 5678, 
-    5676, 5682, 5690, 5688, 5678, 5668, 5663, 5648, 5629, 5623, 
-    5612, 5599, 5589, 5572, 5554, 5535, 5508, 5474, 5442, 5411, 
-    5371, 5330, 5284, 5234, 5188, 5139, 5087, 5034, 4980, 4940, 
-    4894, 4843, 4797, 4745, 4692, 4634, 4576, 4522, 4472, 4414, 
-    4347, 4287, 4220, 4155, 4094, 4030, 3970, 3902, 3830, 3759, 
-    3693, 3621, 3539, 3462, 3388, 3309, 3224, 3139, 3064, 2984, 
-    2895, 2805, 2718, 2629, 2539, 2443, 2349, 2258, 2161, 2059, 
-    1963, 1868, 1767, 1663, 1560, 1464, 1373, 1272, 1166, 1067, 
-    971, 873, 773, 672, 569, 462, 353, 252, 150, 47, 
-    -56, -158, -256, -354, -455, -559, -653, -747, -852, -954, 
-    -1054, -1155, -1255, -1353, -1447, -1546, -1643, -1740, -1848, -1958, 
-    -2062, -2160, -2260, -2361, -2458, -2547, -2632, -2720, -2810, -2892, 
-    -2969, -3049, -3130, -3207, -3287, -3370, -3447, -3516, -3587, -3663, 
-    -3738, -3808, -3879, -3952, -4022, -4086, -4148, -4213, -4278, -4338, 
-    -4391, -4449, -4508, -4561, -4612, -4661, -4708, -4752, -4795, -4832, 
-    -4866, -4904, -4946, -4995, -5039, -5081, -5128, -5172, -5210, -5245, 
-    -5285, -5319, -5349, -5382, -5411, -5435, -5458, -5480, -5502, -5523, 
-    -5543, -5559, -5572, -5587, -5599, -5608, -5619, -5631, -5641, -5646, 
-    -5648, -5650, -5652, -5651, -5650, -5646, -5639, -5630, -5619, -5606, 
-    -5595, -5583, -5570, -5557, -5541, -5527, -5511, -5488, -5467, -5447, 
-    -5425, -5400, -5374, -5344, -5319, -5295, -5267, -5242, -5211, -5181, 
-    -5153, -5120, -5084, -5050, -5018, -4982, -4944, -4900, -4856, -4816, 
-    -4768, -4718, -4667, -4617, -4566, -4511, -4452, -4399, -4343, -4276, 
-    -4212, -4148, -4078, -4007, -3933, -3858, -3788, -3711, -3628, -3555, 
-    -3479, -3395, -3312, -3226, -3141, -3057, -2967, -2875, -2788, -2697, 
-    -2606, -2511, -2415, -2322, -2226, -2129, -2037, -1944, -1843, -1747, 
-    -1651, -1551, -1451, -1350, -1250, -1150, -1046, -942, -841, -739, 
-    -637, -531, -425, -323, -220, -117, -15, 91, 201, 309, 
-    417, 529, 639, 748, 855, 965, 1079, 1191, 1303, 1419, 
-    1534, 1643, 1752, 1862, 1973, 2086, 2197, 2310, 2420, 2527, 
-    2634, 2740, 2845, 2950, 3053, 3155, 3261, 3358, 3454, 3552, 
-    3647, 3742, 3844, 3943, 4032, 4120, 4209, 4295, 4380, 4466, 
-    4554, 4637, 4716, 4798, 4879, 4956, 5034, 5104, 5174, 5255, 
-    5330, 5397, 5464, 5535, 5606, 5673, 5734, 5796, 5853, 5905, 
-    5962, 6016, 6064, 6111, 6158, 6200, 6246, 6293, 6327, 6364, 
-    6399, 6429, 6458, 6486, 6514, 6540, 6561, 6580, 6602, 6616, 
-    6633, 6648, 6661, 6675, 6686, 6694, 6705, 6717, 6722, 6729, 
-    6733, 6731, 6736, 6736, 6737, 6740, 6735, 6722, 6714, 6714, 
-    6705, 6692, 6679, 6664, 6644, 6626, 6614, 6598, 6567, 6538, 
-    6519, 6491, 6458, 6427, 6394, 6362, 6325, 6286, 6250, 6212, 
-    6170, 6135, 6092, 6042, 6003, 5962, 5917, 5873, 5830, 5783, 
-    5734, 5682, 5638, 5595, 5546, 5499, 5442, 5380, 5336, 5298, 
-    5247, 5184, 5127, 5075, 5015, 4950, 4890, 4831, 4772, 4714, 
-    4651, 4582, 4514, 4452, 4380, 4310, 4241, 4166, 4096, 4025, 
-    3949, 3875, 3802, 3727, 3650, 3573, 3493, 3417, 3338, 3255, 
-    3172, 3094, 3018, 2938, 2849, 2764, 2688, 2609, 2526, 2440, 
-    2352, 2270, 2190, 2105, 2021, 1935, 1848, 1760, 1674, 1591, 
-    1505, 1413, 1323, 1234, 1145, 1056, 968, 873, 778, 691, 
-    596, 499, 404, 309, 210, 109, 13, -80, -179, -275, 
-    -370, -471, -567, -660, -758, -857, -954, -1052, -1153, -1254, 
-    -1350, -1445, -1549, -1652, -1748, -1848, -1948, -2046, -2142, -2242, 
-    -2340, -2434, -2532, -2628, -2723, -2814, -2906, -3002, -3097, -3190, 
-    -3283, -3374, -3468, -3560, -3649, -3741, -3832, -3919, -4007, -4095, 
-    -4180, -4267, -4356, -4440, -4526, -4608, -4692, -4780, -4862, -4941, 
-    -5020, -5099, -5174, -5251, -5325, -5400, -5477, -5547, -5613, -5681, 
-    -5754, -5827, -5890, -5947, -6010, -6075, -6132, -6193, -6254, -6313, 
-    -6372, -6427, -6480, -6532, -6582, -6633, -6687, -6732, -6775, -6821, 
-    -6868, -6919, -6967, -7006, -7046, -7090, -7127, -7162, -7201, -7235, 
-    -7268, -7303, -7339, -7372, -7402, -7434, -7467, -7486, -7504, -7534, 
-    -7566, -7592, -7609, -7623, -7643, -7664, -7675, -7685, -7704, -7720, 
-    -7725, -7728, -7737, -7747, -7754, -7760, -7764, -7762, -7757, -7763, 
-    -7770, -7766, -7759, -7753, -7746, -7738, -7731, -7724, -7717, -7708, 
-    -7694, -7673, -7657, -7646, -7632, -7615, -7596, -7574, -7552, -7533, 
-    -7511, -7488, -7469, -7446, -7416, -7386, -7355, -7323, -7292, -7262, 
-    -7232, -7197, -7162, -7131, -7093, -7051, -7011, -6973, -6932, -6888, 
-    -6843, -6797, -6749, -6705, -6662, -6606, -6554, -6510, -6463, -6408, 
-    -6351, -6297, -6243, -6186, -6122, -6063, -6007, -5946, -5885, -5824, 
-    -5761, -5696, -5629, -5563, -5499, -5435, -5364, -5295, -5227, -5158, 
-    -5087, -5014, -4940, -4867, -4796, -4724, -4650, -4570, -4491, -4420, 
-    -4345, -4265, -4186, -4109, -4029, -3947, -3863, -3781, -3697, -3609, 
-    -3524, -3441, -3355, -3268, -3179, -3088, -2999, -2910, -2817, -2727, 
-    -2639, -2544, -2449, -2358, -2268, -2176, -2081, -1988, -1893, -1792, 
-    -1699, -1611, -1511, -1409, -1312, -1214, -1115, -1020, -923, -820, 
-    -720, -623, -525, -424, -323, -225, -124, -21, 81, 183, 
-    287, 387, 491, 600, 702, 804, 911, 1018, 1121, 1217, 
-    1314, 1417, 1518, 1614, 1710, 1811, 1916, 2015, 2102, 2190, 
-    2290, 2393, 2488, 2580, 2673, 2768, 2863, 2958, 3050, 3139, 
-    3231, 3326, 3419, 3508, 3601, 3694, 3785, 3878, 3969, 4060, 
-    4154, 4247, 4336, 4425, 4517, 4608, 4699, 4791, 4880, 4967, 
-    5057, 5146, 5233, 5319, 5411, 5496, 5572, 5646, 5721, 5795, 
-    5869, 5942, 6015, 6087, 6157, 6227, 6296, 6364, 6432, 6498, 
-    6564, 6628, 6692, 6755, 6817, 6879, 6941, 7002, 7062, 7122, 
-    7182, 7243, 7302, 7351, 7398, 7447, 7495, 7536, 7580, 7626, 
-    7670, 7714, 7754, 7792, 7830, 7871, 7914, 7954, 7987, 8019, 
-    8055, 8089, 8116, 8146, 8181, 8215, 8240, 8264, 8290, 8312, 
-    8332, 8353, 8370, 8389, 8407, 8423, 8439, 8453, 8462, 8474, 
-    8486, 8492, 8502, 8511, 8515, 8521, 8525, 8530, 8534, 8534, 
-    8530, 8533, 8535, 8531, 8533, 8529, 8522, 8515, 8510, 8503, 
-    8494, 8484, 8474, 8465, 8451, 8438, 8422, 8401, 8384, 8369, 
-    8351, 8328, 8305, 8283, 8263, 8242, 8211, 8184, 8162, 8135, 
-    8103, 8073, 8046, 8018, 7988, 7959, 7925, 7886, 7855, 7829, 
-    7796, 7756, 7715, 7681, 7644, 7603, 7567, 7527, 7483, 7443, 
-    7399, 7349, 7300, 7253, 7208, 7161, 7110, 7060, 7005, 6949, 
-    6894, 6837, 6780, 6725, 6670, 6615, 6561, 6502, 6438, 6384, 
-    6324, 6257, 6195, 6135, 6072, 6006, 5945, 5885, 5820, 5750, 
-    5685, 5623, 5557, 5492, 5428, 5360, 5288, 5218, 5149, 5078, 
-    5009, 4939, 4868, 4791, 4711, 4633, 4560, 4482, 4403, 4328, 
-    4249, 4168, 4092, 4012, 3928, 3845, 3766, 3686, 3602, 3517, 
-    3438, 3358, 3271, 3187, 3104, 3019, 2932, 2844, 2755, 2672, 
-    2593, 2503, 2405, 2318, 2232, 2141, 2048, 1956, 1866, 1775, 
-    1681, 1585, 1496, 1401, 1306, 1218, 1125, 1030, 935, 840, 
-    747, 656, 561, 466, 377, 278, 182, 93, -1, -94, 
-    -184, -277, -375, -471, -566, -660, -748, -843, -939, -1032, 
-    -1125, -1217, -1310, -1404, -1498, -1591, -1691, -1787, -1878, -1976, 
-    -2073, -2165, -2259, -2354, -2444, -2529, -2619, -2713, -2802, -2889, 
-    -2979, -3067, -3152, -3233, -3317, -3403, -3489, -3573, -3650, -3727, 
-    -3809, -3892, -3970, -4046, -4124, -4204, -4281, -4356, -4436, -4513, 
-    -4585, -4663, -4741, -4817, -4893, -4972, -5050, -5127, -5203, -5279, 
-    -5355, -5431, -5504, -5577, -5649, -5720, -5789, -5857, -5927, -5991, 
-    -6049, -6107, -6164, -6220, -6276, -6331, -6385, -6439, -6491, -6543, 
-    -6595, -6645, -6695, -6744, -6793, -6841, -6888, -6936, -6983, -7030, 
-    -7077, -7123, -7169, -7216, -7263, -7309, -7351, -7389, -7421, -7453, 
-    -7487, -7520, -7553, -7586, -7617, -7647, -7677, -7706, -7733, -7758, 
-    -7781, -7804, -7826, -7849, -7873, -7892, -7907, -7921, -7940, -7959, 
-    -7971, -7980, -7993, -8007, -8017, -8027, -8036, -8041, -8047, -8055, 
-    -8061, -8063, -8066, -8070, -8071, -8069, -8073, -8076, -8073, -8072, 
-    -8071, -8068, -8063, -8060, -8058, -8052, -8042, -8036, -8031, -8021, 
-    -8016, -8007, -7995, -7985, -7974, -7960, -7947, -7933, -7911, -7895, 
-    -7884, -7867, -7848, -7829, -7810, -7790, -7770, -7753, -7733, -7707, 
-    -7683, -7660, -7638, -7615, -7590, -7566, -7543, -7516, -7485, -7458, 
-    -7427, -7398, -7371, -7339, -7309, -7275, -7241, -7210, -7180, -7142, 
-    -7109, -7082, -7040, -7001, -6967, -6922, -6881, -6843, -6801, -6755, 
-    -6713, -6671, -6627, -6583, -6537, -6493, -6448, -6397, -6348, -6301, 
-    -6254, -6205, -6158, -6107, -6053, -6006, -5960, -5909, -5853, -5798, 
-    -5743, -5690, -5634, -5574, -5521, -5464, -5403, -5345, -5285, -5224, 
-    -5166, -5101, -5032, -4975, -4916, -4848, -4784, -4716, -4647, -4583, 
-    -4517, -4447, -4379, -4310, -4237, -4167, -4092, -4019, -3950, -3877, 
-    -3801, -3725, -3652, -3580, -3504, -3424, -3349, -3274, -3195, -3118, 
-    -3038, -2959, -2880, -2799, -2718, -2636, -2550, -2471, -2390, -2297, 
-    -2213, -2132, -2044, -1959, -1877, -1791, -1701, -1614, -1529, -1444, 
-    -1357, -1272, -1189, -1103, -1017, -933, -849, -763, -679, -592, 
-    -506, -421, -336, -252, -168, -82, 4, 88, 171, 258, 
-    346, 433, 520, 608, 695, 781, 872, 962, 1052, 1143, 
-    1233, 1327, 1421, 1512, 1603, 1695, 1786, 1877, 1967, 2057, 
-    2145, 2234, 2322, 2408, 2489, 2571, 2652, 2731, 2809, 2887, 
-    2963, 3036, 3110, 3182, 3253, 3324, 3392, 3460, 3526, 3592, 
-    3661, 3861, 4014, 4047, 4126, 4184, 4251, 4315, 4381, 4447, 
-    4512, 4577, 4643, 4708, 4773, 4840, 4907, 4973, 5038, 5104, 
-    5171, 5236, 5300, 5365, 5429, 5491, 5552, 5613, 5674, 5735, 
-    5792, 5849, 5903, 5954, 6005, 6055, 6106, 6156, 6206, 6256, 
-    6305, 6354, 6403, 6452, 6501, 6549, 6598, 6643, 6684, 6727, 
-    6768, 6807, 6846, 6885, 6923, 6960, 6995, 7031, 7067, 7098, 
-    7132, 7166, 7197, 7227, 7255, 7283, 7311, 7339, 7363, 7389, 
-    7413, 7435, 7458, 7480, 7500, 7520, 7538, 7556, 7575, 7592, 
-    7605, 7621, 7637, 7650, 7664, 7678, 7692, 7705, 7716, 7727, 
-    7737, 7746, 7757, 7767, 7775, 7782, 7788, 7793, 7798, 7803, 
-    7805, 7808, 7811, 7813, 7812, 7808, 7805, 7803, 7798, 7792, 
-    7785, 7778, 7770, 7760, 7750, 7738, 7726, 7715, 7702, 7688, 
-    7673, 7659, 7644, 7628, 7608, 7591, 7576, 7558, 7539, 7522, 
-    7504, 7485, 7465, 7444, 7424, 7405, 7384, 7360, 7338, 7316, 
-    7293, 7266, 7239, 7213, 7186, 7159, 7130, 7098, 7068, 7036, 
-    7002, 6969, 6936, 6899, 6861, 6824, 6786, 6748, 6712, 6669, 
-    6626, 6586, 6545, 6501, 6457, 6415, 6372, 6328, 6282, 6239, 
-    6195, 6148, 6101, 6053, 6004, 5956, 5911, 5863, 5811, 5761, 
-    5710, 5659, 5606, 5551, 5496, 5440, 5385, 5327, 5267, 5207, 
-    5151, 5092, 5027, 4964, 4901, 4837, 4772, 4706, 4640, 4573, 
-    4505, 4435, 4366, 4296, 4225, 4155, 4084, 4011, 3939, 3865, 
-    3790, 3716, 3642, 3567, 3492, 3415, 3337, 3260, 3185, 3107, 
-    3027, 2947, 2870, 2790, 2710, 2629, 2549, 2468, 2386, 2305, 
-    2225, 2140, 2055, 1972, 1889, 1805, 1720, 1634, 1549, 1464, 
-    1378, 1292, 1207, 1120, 1034, 947, 859, 773, 686, 597, 
-    508, 419, 331, 243, 154, 65, -24, -114, -201, -289, 
-    -380, -468, -554, -642, -730, -818, -906, -991, -1079, -1168, 
-    -1252, -1335, -1420, -1507, -1592, -1677, -1760, -1842, -1927, -2010, 
-    -2091, -2173, -2255, -2337, -2419, -2501, -2582, -2662, -2743, -2824, 
-    -2903, -2982, -3060, -3138, -3215, -3291, -3367, -3444, -3520, -3596, 
-    -3672, -3747, -3821, -3895, -3969, -4042, -4114, -4186, -4258, -4327, 
-    -4397, -4468, -4537, -4604, -4671, -4737, -4803, -4867, -4931, -4993, 
-    -5054, -5116, -5177, -5236, -5292, -5351, -5409, -5465, -5521, -5577, 
-    -5632, -5687, -5742, -5794, -5846, -5899, -5949, -6000, -6051, -6100, 
-    -6149, -6197, -6245, -6292, -6338, -6382, -6425, -6468, -6512, -6555, 
-    -6596, -6635, -6674, -6711, -6748, -6785, -6821, -6856, -6889, -6922, 
-    -6955, -6988, -7019, -7048, -7078, -7106, -7135, -7163, -7189, -7216, 
-    -7241, -7267, -7291, -7314, -7337, -7358, -7381, -7403, -7422, -7442, 
-    -7461, -7479, -7496, -7513, -7527, -7542, -7558, -7570, -7584, -7596, 
-    -7607, -7618, -7628, -7636, -7644, -7651, -7658, -7665, -7670, -7674, 
-    -7679, -7683, -7685, -7686, -7686, -7687, -7687, -7685, -7682, -7680, 
-    -7677, -7673, -7668, -7662, -7655, -7647, -7639, -7630, -7620, -7610, 
-    -7599, -7586, -7574, -7563, -7548, -7533, -7517, -7502, -7485, -7468, 
-    -7450, -7430, -7411, -7392, -7372, -7350, -7329, -7307, -7284, -7261, 
-    -7236, -7212, -7188, -7162, -7135, -7108, -7080, -7052, -7023, -6992, 
-    -6961, -6931, -6899, -6867, -6835, -6801, -6767, -6731, -6695, -6659, 
-    -6624, -6586, -6546, -6508, -6469, -6427, -6387, -6346, -6304, -6260, 
-    -6217, -6173, -6127, -6082, -6038, -5992, -5946, -5899, -5852, -5804, 
-    -5757, -5708, -5660, -5611, -5561, -5509, -5458, -5406, -5354, -5301, 
-    -5248, -5195, -5141, -5087, -5031, -4975, -4918, -4862, -4805, -4746, 
-    -4687, -4629, -4570, -4510, -4448, -4387, -4325, -4262, -4199, -4136, 
-    -4072, -4008, -3943, -3878, -3812, -3746, -3679, -3612, -3543, -3474, 
-    -3405, -3336, -3266, -3196, -3126, -3056, -2984, -2912, -2840, -2767, 
-    -2694, -2621, -2546, -2471, -2396, -2321, -2245, -2168, -2090, -2013, 
-    -1935, -1855, -1776, -1696, -1616, -1535, -1453, -1372, -1290, -1208, 
-    -1125, -1043, -959, -876, -793, -710, -625, -542, -459, -375, 
-    -291, -207, -124, -41, 42, 125, 208, 290, 372, 455, 
-    537, 619, 701, 783, 865, 946, 1028, 1109, 1190, 1270, 
-    1351, 1432, 1513, 1593, 1674, 1754, 1834, 1914, 1993, 2073, 
-    2152, 2231, 2309, 2386, 2463, 2540, 2616, 2692, 2769, 2844, 
-    2919, 2995, 3070, 3144, 3218, 3293, 3366, 3439, 3512, 3586, 
-    3658, 3730, 3801, 3873, 3944, 4014, 4084, 4154, 4223, 4292, 
-    4359, 4426, 4492, 4558, 4623, 4687, 4751, 4814, 4876, 4937, 
-    4998, 5058, 5117, 5176, 5234, 5291, 5347, 5404, 5459, 5513, 
-    5568, 5621, 5674, 5727, 5779, 5830, 5881, 5931, 5980, 6029, 
-    6078, 6125, 6172, 6218, 6263, 6307, 6351, 6395, 6437, 6478, 
-    6519, 6558, 6598, 6636, 6674, 6710, 6747, 6782, 6816, 6850, 
-    6883, 6915, 6947, 6978, 7008, 7037, 7066, 7094, 7122, 7149, 
-    7175, 7201, 7225, 7249, 7273, 7295, 7317, 7338, 7359, 7379, 
-    7398, 7416, 7433, 7450, 7466, 7482, 7497, 7511, 7525, 7537, 
-    7549, 7561, 7572, 7582, 7592, 7600, 7608, 7616, 7622, 7628, 
-    7633, 7638, 7641, 7645, 7647, 7649, 7650, 7651, 7651, 7650, 
-    7649, 7647, 7644, 7641, 7637, 7633, 7627, 7621, 7614, 7607, 
-    7599, 7591, 7581, 7571, 7560, 7549, 7537, 7524, 7511, 7497, 
-    7482, 7467, 7451, 7435, 7418, 7400, 7382, 7363, 7343, 7323, 
-    7301, 7279, 7257, 7234, 7210, 7185, 7160, 7134, 7108, 7081, 
-    7053, 7025, 6996, 6966, 6936, 6905, 6873, 6840, 6807, 6774, 
-    6740, 6704, 6669, 6634, 6597, 6559, 6522, 6483, 6444, 6405, 
-    6365, 6324, 6283, 6241, 6199, 6156, 6113, 6069, 6025, 5981, 
-    5935, 5890, 5844, 5797, 5749, 5701, 5652, 5602, 5552, 5502, 
-    5451, 5399, 5347, 5294, 5241, 5187, 5133, 5078, 5022, 4966, 
-    4909, 4851, 4793, 4735, 4676, 4617, 4557, 4497, 4436, 4375, 
-    4313, 4251, 4188, 4125, 4062, 3997, 3932, 3867, 3801, 3735, 
-    3668, 3601, 3534, 3466, 3398, 3329, 3260, 3191, 3121, 3051, 
-    2980, 2909, 2838, 2765, 2693, 2619, 2545, 2471, 2396, 2320, 
-    2244, 2168, 2091, 2013, 1936, 1857, 1779, 1700, 1621, 1541, 
-    1461, 1381, 1301, 1220, 1139, 1058, 977, 896, 815, 734, 
-    653, 571, 490, 409, 329, 248, 167, 87, 6, -74, 
-    -154, -234, -313, -393, -473, -552, -631, -711, -790, -869, 
-    -948, -1027, -1105, -1184, -1262, -1340, -1418, -1496, -1573, -1650, 
-    -1727, -1804, -1880, -1956, -2032, -2107, -2182, -2257, -2332, -2406, 
-    -2480, -2554, -2628, -2701, -2774, -2846, -2919, -2991, -3063, -3135, 
-    -3207, -3278, -3349, -3420, -3490, -3560, -3630, -3699, -3768, -3837, 
-    -3905, -3973, -4040, -4106, -4173, -4238, -4302, -4367, -4431, -4493, 
-    -4555, -4617, -4678, -4738, -4798, -4857, -4916, -4974, -5031, -5088, 
-    -5144, -5199, -5254, -5308, -5362, -5415, -5467, -5519, -5570, -5620, 
-    -5670, -5719, -5768, -5815, -5862, -5909, -5954, -6000, -6044, -6088, 
-    -6131, -6174, -6216, -6257, -6298, -6338, -6378, -6417, -6455, -6493, 
-    -6530, -6567, -6602, -6637, -6672, -6705, -6738, -6770, -6802, -6833, 
-    -6863, -6892, -6921, -6949, -6976, -7002, -7028, -7052, -7076, -7100, 
-    -7123, -7145, -7166, -7187, -7207, -7226, -7245, -7263, -7281, -7298, 
-    -7315, -7331, -7346, -7361, -7375, -7389, -7402, -7415, -7426, -7437, 
-    -7448, -7458, -7467, -7476, -7484, -7491, -7497, -7503, -7508, -7513, 
-    -7516, -7519, -7522, -7524, -7525, -7525, -7525, -7524, -7522, -7519, 
-    -7516, -7513, -7508, -7503, -7497, -7491, -7484, -7477, -7469, -7460, 
-    -7451, -7441, -7431, -7420, -7408, -7396, -7383, -7370, -7356, -7341, 
-    -7326, -7310, -7294, -7277, -7259, -7241, -7222, -7203, -7183, -7162, 
-    -7140, -7118, -7096, -7073, -7049, -7025, -7000, -6974, -6948, -6921, 
-    -6894, -6866, -6837, -6808, -6779, -6748, -6718, -6686, -6654, -6622, 
-    -6589, -6556, -6522, -6487, -6452, -6417, -6381, -6345, -6308, -6270, 
-    -6232, -6193, -6154, -6114, -6074, -6033, -5991, -5949, -5906, -5863, 
-    -5819, -5774, -5730, -5684, -5638, -5591, -5544, -5497, -5449, -5401, 
-    -5352, -5303, -5253, -5203, -5152, -5100, -5048, -4995, -4942, -4889, 
-    -4835, -4781, -4726, -4671, -4615, -4558, -4502, -4444, -4387, -4328, 
-    -4270, -4210, -4151, -4091, -4030, -3969, -3908, -3846, -3784, -3721, 
-    -3658, -3595, -3531, -3467, -3402, -3337, -3272, -3206, -3140, -3073, 
-    -3007, -2940, -2872, -2805, -2737, -2668, -2599, -2530, -2461, -2391, 
-    -2321, -2251, -2180, -2109, -2037, -1965, -1893, -1820, -1747, -1674, 
-    -1600, -1526, -1452, -1377, -1303, -1228, -1153, -1077, -1002, -926, 
-    -850, -775, -699, -623, -547, -471, -395, -319, -243, -167, 
-    -92, -16, 59, 134, 210, 285, 360, 434, 509, 584, 
-    658, 733, 807, 881, 955, 1029, 1102, 1176, 1249, 1323, 
-    1396, 1469, 1541, 1614, 1686, 1759, 1831, 1903, 1974, 2045, 
-    2116, 2187, 2257, 2327, 2396, 2466, 2534, 2603, 2671, 2739, 
-    2807, 2875, 2944, 3012, 3080, 3148, 3215, 3282, 3349, 3415, 
-    3481, 3546, 3611, 3676, 3740, 3804, 3867, 3930, 3993, 4055, 
-    4116, 4177, 4238, 4298, 4357, 4416, 4474, 4531, 4589, 4645, 
-    4702, 4757, 4813, 4867, 4921, 4975, 5028, 5080, 5132, 5183, 
-    5234, 5284, 5333, 5382, 5430, 5478, 5524, 5571, 5617, 5662, 
-    5706, 5750, 5794, 5837, 5879, 5921, 5962, 6002, 6042, 6082, 
-    6121, 6159, 6197, 6234, 6271, 6307, 6342, 6377, 6411, 6445, 
-    6478, 6510, 6542, 6573, 6603, 6633, 6662, 6690, 6718, 6745, 
-    6771, 6797, 6821, 6845, 6869, 6892, 6914, 6936, 6956, 6977, 
-    6997, 7016, 7034, 7052, 7070, 7087, 7103, 7119, 7134, 7149, 
-    7162, 7176, 7188, 7201, 7212, 7223, 7234, 7243, 7252, 7261, 
-    7269, 7276, 7283, 7289, 7294, 7299, 7303, 7306, 7309, 7310, 
-    7311, 7312, 7312, 7311, 7310, 7308, 7305, 7302, 7298, 7293, 
-    7289, 7283, 7277, 7271, 7263, 7256, 7248, 7239, 7229, 7219, 
-    7209, 7198, 7186, 7174, 7161, 7147, 7133, 7118, 7103, 7087, 
-    7070, 7053, 7035, 7017, 6998, 6978, 6958, 6937, 6915, 6893, 
-    6871, 6847, 6823, 6799, 6774, 6749, 6722, 6696, 6669, 6641, 
-    6613, 6584, 6554, 6525, 6494, 6463, 6432, 6400, 6368, 6335, 
-    6301, 6267, 6232, 6197, 6161, 6125, 6088, 6050, 6012, 5974, 
-    5935, 5896, 5856, 5815, 5774, 5733, 5691, 5649, 5606, 5563, 
-    5520, 5476, 5431, 5387, 5341, 5295, 5248, 5201, 5154, 5106, 
-    5058, 5009, 4960, 4910, 4860, 4809, 4758, 4707, 4655, 4603, 
-    4550, 4496, 4442, 4388, 4333, 4278, 4222, 4166, 4109, 4052, 
-    3995, 3937, 3879, 3821, 3762, 3702, 3643, 3583, 3522, 3462, 
-    3400, 3339, 3277, 3215, 3152, 3089, 3026, 2962, 2898, 2834, 
-    2769, 2704, 2638, 2572, 2506, 2439, 2372, 2304, 2236, 2167, 
-    2098, 2029, 1959, 1889, 1818, 1748, 1676, 1605, 1533, 1461, 
-    1389, 1317, 1244, 1172, 1099, 1026, 953, 880, 807, 734, 
-    661, 588, 515, 442, 369, 296, 223, 150, 77, 4, 
-    -68, -141, -213, -286, -358, -431, -503, -575, -647, -719, 
-    -791, -863, -935, -1006, -1078, -1149, -1220, -1291, -1362, -1433, 
-    -1504, -1574, -1644, -1713, -1782, -1851, -1920, -1988, -2057, -2124, 
-    -2191, -2258, -2325, -2392, -2460, -2528, -2596, -2664, -2732, -2799, 
-    -2866, -2933, -2999, -3065, -3131, -3196, -3261, -3325, -3389, -3453, 
-    -3517, -3580, -3643, -3705, -3766, -3828, -3888, -3949, -4008, -4068, 
-    -4126, -4185, -4242, -4300, -4356, -4412, -4468, -4523, -4577, -4631, 
-    -4685, -4738, -4790, -4842, -4894, -4945, -4995, -5045, -5094, -5143, 
-    -5191, -5239, -5286, -5333, -5379, -5425, -5470, -5515, -5559, -5603, 
-    -5645, -5688, -5730, -5771, -5812, -5852, -5891, -5930, -5968, -6006, 
-    -6043, -6079, -6115, -6150, -6185, -6218, -6252, -6284, -6316, -6347, 
-    -6378, -6408, -6437, -6466, -6494, -6521, -6548, -6574, -6600, -6625, 
-    -6649, -6673, -6696, -6719, -6740, -6762, -6782, -6803, -6822, -6841, 
-    -6859, -6877, -6894, -6911, -6927, -6942, -6957, -6971, -6985, -6998, 
-    -7010, -7022, -7033, -7043, -7053, -7063, -7071, -7079, -7087, -7094, 
-    -7100, -7105, -7110, -7115, -7118, -7121, -7124, -7126, -7127, -7128, 
-    -7128, -7128, -7127, -7126, -7124, -7121, -7118, -7115, -7110, -7106, 
-    -7100, -7095, -7088, -7082, -7074, -7066, -7058, -7049, -7039, -7029, 
-    -7018, -7007, -6995, -6983, -6970, -6956, -6942, -6927, -6912, -6896, 
-    -6879, -6862, -6844, -6826, -6807, -6787, -6767, -6746, -6725, -6703, 
-    -6681, -6658, -6634, -6610, -6585, -6560, -6534, -6508, -6481, -6454, 
-    -6426, -6397, -6368, -6339, -6309, -6278, -6247, -6215, -6183, -6151, 
-    -6118, -6084, -6050, -6016, -5981, -5945, -5910, -5873, -5837, -5799, 
-    -5762, -5723, -5685, -5646, -5606, -5566, -5526, -5485, -5443, -5401, 
-    -5359, -5316, -5272, -5229, -5184, -5140, -5094, -5049, -5003, -4956, 
-    -4909, -4862, -4814, -4766, -4717, -4668, -4618, -4568, -4518, -4467, 
-    -4416, -4364, -4312, -4260, -4206, -4153, -4099, -4045, -3990, -3935, 
-    -3880, -3824, -3768, -3711, -3654, -3597, -3539, -3480, -3421, -3362, 
-    -3302, -3242, -3182, -3121, -3059, -2997, -2934, -2871, -2808, -2744, 
-    -2679, -2614, -2549, -2483, -2417, -2350, -2283, -2215, -2147, -2079, 
-    -2010, -1941, -1872, -1803, -1733, -1663, -1592, -1522, -1451, -1380, 
-    -1309, -1238, -1167, -1095, -1024, -952, -880, -809, -737, -665, 
-    -594, -522, -451, -379, -308, -236, -165, -93, -22, 49, 
-    120, 191, 262, 333, 404, 474, 544, 615, 685, 755, 
-    825, 895, 965, 1034, 1104, 1174, 1243, 1312, 1381, 1450, 
-    1519, 1588, 1656, 1724, 1792, 1860, 1928, 1995, 2062, 2129, 
-    2196, 2262, 2327, 2393, 2458, 2522, 2588, 2654, 2720, 2786, 
-    2852, 2917, 2983, 3047, 3112, 3176, 3239, 3303, 3365, 3428, 
-    3490, 3551, 3612, 3673, 3733, 3793, 3853, 3911, 3970, 4028, 
-    4085, 4141, 4198, 4253, 4308, 4363, 4417, 4471, 4524, 4576, 
-    4628, 4680, 4731, 4782, 4832, 4882, 4931, 4980, 5029, 5077, 
-    5124, 5171, 5217, 5263, 5309, 5354, 5399, 5442, 5486, 5529, 
-    5571, 5613, 5654, 5695, 5735, 5775, 5814, 5852, 5890, 5927, 
-    5964, 6000, 6036, 6070, 6105, 6138, 6171, 6204, 6235, 6266, 
-    6297, 6327, 6356, 6384, 6412, 6440, 6466, 6493, 6518, 6543, 
-    6568, 6592, 6615, 6638, 6660, 6682, 6703, 6724, 6744, 6763, 
-    6782, 6800, 6818, 6835, 6851, 6867, 6882, 6897, 6911, 6924, 
-    6937, 6949, 6961, 6972, 6982, 6992, 7001, 7010, 7018, 7025, 
-    7032, 7038, 7044, 7049, 7053, 7057, 7061, 7063, 7066, 7067, 
-    7068, 7069, 7069, 7069, 7068, 7066, 7064, 7061, 7058, 7055, 
-    7051, 7046, 7041, 7035, 7029, 7023, 7016, 7008, 7000, 6991, 
-    6981, 6971, 6960, 6949, 6937, 6925, 6912, 6898, 6884, 6869, 
-    6854, 6838, 6822, 6805, 6787, 6769, 6750, 6731, 6711, 6691, 
-    6670, 6649, 6627, 6604, 6581, 6558, 6534, 6509, 6484, 6458, 
-    6432, 6406, 6379, 6351, 6323, 6295, 6266, 6236, 6206, 6176, 
-    6145, 6113, 6081, 6049, 6017, 5983, 5950, 5916, 5881, 5847, 
-    5811, 5776, 5740, 5703, 5666, 5629, 5591, 5553, 5515, 5476, 
-    5436, 5396, 5356, 5315, 5274, 5233, 5191, 5148, 5105, 5062, 
-    5018, 4974, 4930, 4885, 4840, 4794, 4748, 4701, 4654, 4607, 
-    4559, 4511, 4462, 4414, 4365, 4315, 4265, 4215, 4165, 4114, 
-    4062, 4011, 3959, 3907, 3854, 3801, 3748, 3694, 3640, 3585, 
-    3531, 3475, 3420, 3364, 3308, 3251, 3194, 3136, 3078, 3019, 
-    2960, 2900, 2840, 2780, 2719, 2657, 2596, 2534, 2471, 2408, 
-    2345, 2281, 2217, 2153, 2088, 2023, 1958, 1892, 1827, 1761, 
-    1694, 1628, 1561, 1494, 1427, 1360, 1293, 1225, 1158, 1090, 
-    1022, 954, 886, 818, 750, 682, 614, 546, 478, 410, 
-    342, 274, 206, 138, 70, 3, -65, -133, -200, -268, 
-    -335, -403, -470, -537, -604, -671, -738, -805, -872, -938, 
-    -1005, -1071, -1137, -1203, -1269, -1335, -1401, -1467, -1532, -1597, 
-    -1662, -1727, -1792, -1857, -1921, -1985, -2049, -2113, -2177, -2240, 
-    -2302, -2365, -2427, -2489, -2552, -2615, -2679, -2742, -2805, -2868, 
-    -2930, -2992, -3054, -3115, -3175, -3235, -3295, -3354, -3413, -3472, 
-    -3530, -3587, -3645, -3702, -3758, -3815, -3870, -3926, -3980, -4035, 
-    -4089, -4142, -4195, -4248, -4300, -4352, -4403, -4454, -4504, -4554, 
-    -4604, -4654, -4703, -4751, -4800, -4847, -4895, -4942, -4988, -5034, 
-    -5080, -5125, -5170, -5214, -5258, -5301, -5344, -5386, -5427, -5469, 
-    -5509, -5550, -5589, -5628, -5667, -5705, -5743, -5780, -5817, -5853, 
-    -5889, -5924, -5958, -5992, -6026, -6059, -6091, -6123, -6155, -6185, 
-    -6216, -6245, -6274, -6303, -6331, -6358, -6385, -6411, -6437, -6462, 
-    -6487, -6511, -6535, -6558, -6580, -6602, -6624, -6645, -6665, -6684, 
-    -6704, -6722, -6740, -6757, -6774, -6790, -6806, -6821, -6835, -6849, 
-    -6863, -6875, -6888, -6900, -6911, -6922, -6932, -6941, -6950, -6959, 
-    -6967, -6975, -6982, -6988, -6994, -7000, -7005, -7009, -7014, -7017, 
-    -7020, -7023, -7025, -7027, -7028, -7029, -7030, -7030, -7029, -7028, 
-    -7027, -7025, -7022, -7019, -7016, -7012, -7007, -7002, -6997, -6991, 
-    -6984, -6977, -6969, -6961, -6952, -6942, -6932, -6921, -6909, -6897, 
-    -6884, -6871, -6857, -6843, -6828, -6812, -6796, -6779, -6762, -6744, 
-    -6726, -6707, -6688, -6668, -6648, -6627, -6605, -6583, -6561, -6538, 
-    -6515, -6491, -6467, -6442, -6417, -6391, -6365, -6339, -6312, -6284, 
-    -6257, -6228, -6200, -6170, -6141, -6111, -6081, -6050, -6019, -5987, 
-    -5956, -5923, -5891, -5858, -5824, -5791, -5756, -5722, -5687, -5651, 
-    -5616, -5580, -5543, -5506, -5469, -5431, -5393, -5355, -5316, -5277, 
-    -5237, -5197, -5156, -5115, -5074, -5032, -4990, -4947, -4904, -4861, 
-    -4817, -4773, -4728, -4683, -4638, -4592, -4546, -4499, -4452, -4405, 
-    -4358, -4310, -4262, -4213, -4164, -4115, -4065, -4015, -3965, -3914, 
-    -3863, -3812, -3760, -3708, -3655, -3602, -3549, -3495, -3441, -3386, 
-    -3331, -3275, -3219, -3162, -3105, -3047, -2989, -2931, -2872, -2813, 
-    -2753, -2693, -2632, -2571, -2510, -2448, -2386, -2323, -2260, -2197, 
-    -2134, -2070, -2006, -1942, -1878, -1814, -1749, -1684, -1619, -1554, 
-    -1489, -1424, -1359, -1293, -1228, -1162, -1097, -1031, -965, -900, 
-    -834, -768, -702, -637, -571, -505, -439, -373, -307, -241, 
-    -176, -110, -44, 22, 88, 153, 219, 285, 350, 416, 
-    481, 547, 612, 678, 743, 809, 874, 939, 1005, 1070, 
-    1135, 1200, 1265, 1330, 1394, 1459, 1523, 1587, 1651, 1715, 
-    1779, 1842, 1905, 1968, 2031, 2093, 2155, 2217, 2281, 2344, 
-    2408, 2471, 2534, 2597, 2659, 2721, 2782, 2843, 2903, 2964, 
-    3023, 3082, 3141, 3200, 3258, 3316, 3373, 3430, 3487, 3543, 
-    3600, 3656, 3711, 3766, 3821, 3876, 3929, 3983, 4036, 4089, 
-    4142, 4194, 4245, 4297, 4348, 4398, 4448, 4498, 4547, 4596, 
-    4645, 4693, 4740, 4788, 4835, 4881, 4927, 4972, 5017, 5062, 
-    5106, 5149, 5192, 5234, 5276, 5318, 5359, 5399, 5439, 5478, 
-    5517, 5556, 5594, 5631, 5668, 5705, 5741, 5776, 5811, 5846, 
-    5880, 5914, 5947, 5979, 6012, 6043, 6074, 6105, 6135, 6165, 
-    6194, 6222, 6250, 6278, 6305, 6331, 6357, 6382, 6407, 6431, 
-    6455, 6478, 6500, 6522, 6543, 6564, 6584, 6603, 6622, 6640, 
-    6658, 6675, 6691, 6707, 6722, 6737, 6751, 6765, 6778, 6791, 
-    6803, 6814, 6825, 6836, 6846, 6855, 6864, 6873, 6881, 6888, 
-    6896, 6902, 6908, 6914, 6919, 6924, 6929, 6933, 6936, 6939, 
-    6942, 6944, 6946, 6947, 6948, 6949, 6949, 6948, 6947, 6946, 
-    6944, 6942, 6939, 6936, 6932, 6928, 6923, 6918, 6912, 6905, 
-    6898, 6891, 6883, 6874, 6865, 6855, 6845, 6834, 6823, 6811, 
-    6799, 6785, 6772, 6758, 6743, 6728, 6712, 6696, 6679, 6662, 
-    6644, 6626, 6607, 6588, 6568, 6548, 6527, 6506, 6485, 6462, 
-    6440, 6417, 6394, 6370, 6345, 6320, 6295, 6269, 6243, 6217, 
-    6190, 6162, 6134, 6106, 6078, 6049, 6019, 5989, 5959, 5928, 
-    5897, 5866, 5834, 5802, 5770, 5737, 5704, 5670, 5636, 5602, 
-    5567, 5533, 5497, 5462, 5426, 5389, 5353, 5316, 5278, 5240, 
-    5202, 5164, 5125, 5086, 5046, 5006, 4966, 4925, 4884, 4842, 
-    4800, 4758, 4715, 4672, 4628, 4584, 4540, 4495, 4450, 4404, 
-    4358, 4312, 4266, 4218, 4171, 4123, 4075, 4026, 3977, 3927, 
-    3878, 3827, 3777, 3726, 3675, 3623, 3571, 3519, 3466, 3413, 
-    3359, 3305, 3251, 3197, 3142, 3086, 3031, 2975, 2918, 2862, 
-    2804, 2747, 2689, 2631, 2572, 2513, 2454, 2394, 2334, 2274, 
-    2213, 2152, 2091, 2030, 1968, 1906, 1844, 1782, 1720, 1657, 
-    1595, 1532, 1469, 1407, 1344, 1281, 1218, 1155, 1092, 1028, 
-    965, 902, 839, 776, 713, 649, 586, 523, 460, 397, 
-    334, 271, 208, 145, 82, 19, -43, -106, -169, -232, 
-    -294, -357, -420, -483, -545, -608, -671, -733, -796, -858, 
-    -921, -983, -1046, -1108, -1171, -1233, -1296, -1358, -1420, -1482, 
-    -1544, -1606, -1667, -1729, -1790, -1851, -1912, -1972, -2033, -2093, 
-    -2152, -2212, -2271, -2330, -2388, -2446, -2504, -2562, -2620, -2679, 
-    -2737, -2795, -2853, -2911, -2968, -3024, -3081, -3137, -3192, -3247, 
-    -3302, -3356, -3410, -3463, -3516, -3569, -3621, -3673, -3725, -3777, 
-    -3828, -3878, -3928, -3978, -4028, -4077, -4125, -4173, -4221, -4269, 
-    -4316, -4363, -4410, -4457, -4503, -4548, -4593, -4638, -4683, -4727, 
-    -4771, -4814, -4857, -4899, -4941, -4983, -5024, -5065, -5105, -5145, 
-    -5184, -5223, -5261, -5299, -5336, -5373, -5409, -5445, -5481, -5516, 
-    -5550, -5584, -5618, -5651, -5684, -5716, -5748, -5779, -5810, -5840, 
-    -5870, -5899, -5928, -5956, -5984, -6011, -6038, -6065, -6091, -6116, 
-    -6141, -6165, -6189, -6213, -6235, -6258, -6280, -6301, -6321, -6341, 
-    -6361, -6380, -6398, -6416, -6433, -6450, -6466, -6482, -6497, -6511, 
-    -6526, -6539, -6552, -6565, -6577, -6589, -6600, -6610, -6620, -6630, 
-    -6639, -6648, -6656, -6664, -6671, -6678, -6685, -6691, -6697, -6702, 
-    -6707, -6711, -6715, -6719, -6722, -6725, -6727, -6729, -6730, -6731, 
-    -6732, -6732, -6732, -6731, -6730, -6728, -6726, -6723, -6720, -6717, 
-    -6713, -6708, -6703, -6698, -6692, -6686, -6679, -6671, -6663, -6655, 
-    -6646, -6636, -6626, -6615, -6604, -6593, -6580, -6568, -6554, -6541, 
-    -6526, -6512, -6496, -6480, -6464, -6447, -6430, -6412, -6394, -6375, 
-    -6356, -6336, -6316, -6296, -6274, -6253, -6231, -6209, -6186, -6162, 
-    -6139, -6115, -6090, -6065, -6040, -6014, -5988, -5961, -5935, -5907, 
-    -5880, -5852, -5823, -5795, -5766, -5736, -5706, -5676, -5645, -5614, 
-    -5583, -5551, -5519, -5487, -5454, -5421, -5388, -5354, -5320, -5285, 
-    -5250, -5215, -5180, -5144, -5108, -5071, -5034, -4997, -4959, -4921, 
-    -4883, -4844, -4805, -4765, -4725, -4685, -4644, -4603, -4561, -4519, 
-    -4477, -4434, -4391, -4347, -4303, -4259, -4214, -4169, -4124, -4078, 
-    -4032, -3986, -3939, -3892, -3845, -3797, -3749, -3700, -3652, -3603, 
-    -3554, -3504, -3454, -3404, -3353, -3303, -3251, -3200, -3148, -3096, 
-    -3044, -2991, -2938, -2884, -2830, -2776, -2721, -2666, -2611, -2555, 
-    -2499, -2443, -2386, -2329, -2272, -2214, -2156, -2097, -2039, -1980, 
-    -1921, -1861, -1801, -1742, -1682, -1621, -1561, -1501, -1440, -1379, 
-    -1318, -1258, -1197, -1136, -1075, -1014, -953, -892, -831, -770, 
-    -709, -648, -587, -526, -465, -404, -343, -282, -221, -161, 
-    -100, -39, 22, 82, 143, 204, 264, 325, 386, 446, 
-    507, 567, 628, 689, 749, 810, 870, 931, 991, 1052, 
-    1112, 1172, 1233, 1293, 1353, 1413, 1472, 1532, 1591, 1651, 
-    1710, 1769, 1827, 1886, 1944, 2002, 2059, 2117, 2174, 2231, 
-    2287, 2343, 2400, 2457, 2515, 2572, 2629, 2685, 2741, 2797, 
-    2853, 2908, 2962, 3017, 3071, 3124, 3178, 3230, 3283, 3335, 
-    3387, 3439, 3490, 3541, 3592, 3642, 3692, 3742, 3791, 3839, 
-    3888, 3936, 3983, 4031, 4078, 4124, 4171, 4216, 4262, 4307, 
-    4352, 4397, 4441, 4485, 4528, 4571, 4613, 4655, 4697, 4738, 
-    4779, 4819, 4859, 4899, 4938, 4976, 5014, 5052, 5089, 5126, 
-    5162, 5198, 5234, 5269, 5303, 5338, 5371, 5404, 5437, 5469, 
-    5501, 5533, 5563, 5594, 5624, 5653, 5682, 5711, 5739, 5766, 
-    5793, 5820, 5846, 5872, 5897, 5921, 5945, 5969, 5992, 6015, 
-    6037, 6058, 6079, 6100, 6119, 6139, 6157, 6176, 6194, 6211, 
-    6228, 6244, 6260, 6275, 6290, 6304, 6318, 6331, 6343, 6356, 
-    6368, 6379, 6390, 6400, 6410, 6419, 6428, 6436, 6444, 6452, 
-    6459, 6465, 6471, 6477, 6482, 6487, 6491, 6495, 6498, 6501, 
-    6503, 6505, 6507, 6508, 6509, 6509, 6509, 6508, 6507, 6506, 
-    6504, 6502, 6499, 6496, 6492, 6488, 6483, 6478, 6473, 6467, 
-    6460, 6453, 6446, 6438, 6430, 6421, 6412, 6402, 6392, 6381, 
-    6370, 6358, 6346, 6333, 6320, 6307, 6293, 6278, 6263, 6248, 
-    6232, 6216, 6199, 6182, 6164, 6146, 6128, 6108, 6089, 6069, 
-    6049, 6028, 6007, 5985, 5963, 5940, 5918, 5894, 5871, 5847, 
-    5822, 5797, 5772, 5746, 5720, 5694, 5667, 5640, 5612, 5585, 
-    5556, 5528, 5499, 5469, 5440, 5410, 5379, 5348, 5317, 5286, 
-    5254, 5222, 5189, 5157, 5123, 5090, 5056, 5022, 4988, 4953, 
-    4918, 4882, 4847, 4810, 4774, 4737, 4700, 4663, 4625, 4587, 
-    4548, 4509, 4470, 4431, 4391, 4351, 4310, 4269, 4228, 4186, 
-    4145, 4102, 4060, 4017, 3973, 3930, 3886, 3841, 3797, 3752, 
-    3706, 3661, 3615, 3568, 3522, 3475, 3428, 3380, 3332, 3284, 
-    3236, 3187, 3138, 3089, 3039, 2990, 2939, 2889, 2838, 2787, 
-    2736, 2685, 2633, 2581, 2529, 2477, 2424, 2371, 2318, 2265, 
-    2211, 2158, 2104, 2050, 1995, 1941, 1886, 1831, 1776, 1721, 
-    1666, 1610, 1554, 1498, 1442, 1386, 1330, 1274, 1217, 1161, 
-    1104, 1047, 990, 933, 876, 819, 762, 705, 648, 591, 
-    534, 477, 420, 363, 306, 249, 192, 135, 78, 21, 
-    -36, -93, -149, -206, -263, -319, -376, -432, -488, -545, 
-    -601, -657, -713, -770, -826, -882, -938, -993, -1049, -1105, 
-    -1161, -1216, -1272, -1327, -1383, -1438, -1493, -1548, -1603, -1658, 
-    -1713, -1767, -1822, -1876, -1930, -1985, -2038, -2092, -2146, -2199, 
-    -2252, -2305, -2358, -2410, -2463, -2515, -2566, -2618, -2669, -2720, 
-    -2770, -2820, -2870, -2920, -2969, -3018, -3067, -3116, -3164, -3213, 
-    -3261, -3309, -3357, -3404, -3451, -3497, -3544, -3589, -3635, -3680, 
-    -3724, -3769, -3813, -3856, -3899, -3942, -3985, -4027, -4069, -4111, 
-    -4152, -4193, -4234, -4274, -4314, -4354, -4393, -4432, -4470, -4509, 
-    -4547, -4584, -4621, -4658, -4695, -4731, -4766, -4802, -4837, -4871, 
-    -4905, -4939, -4972, -5005, -5037, -5069, -5101, -5132, -5162, -5193, 
-    -5223, -5252, -5281, -5309, -5337, -5365, -5392, -5419, -5446, -5472, 
-    -5498, -5523, -5548, -5572, -5596, -5620, -5643, -5665, -5688, -5709, 
-    -5731, -5752, -5772, -5792, -5811, -5830, -5849, -5867, -5884, -5901, 
-    -5918, -5934, -5949, -5964, -5979, -5993, -6007, -6020, -6033, -6045, 
-    -6057, -6068, -6079, -6089, -6100, -6109, -6118, -6127, -6136, -6144, 
-    -6151, -6159, -6165, -6172, -6178, -6183, -6188, -6193, -6197, -6201, 
-    -6204, -6207, -6210, -6212, -6214, -6216, -6217, -6217, -6217, -6217, 
-    -6217, -6216, -6214, -6213, -6210, -6208, -6205, -6202, -6198, -6194, 
-    -6189, -6184, -6179, -6173, -6167, -6160, -6153, -6146, -6138, -6129, 
-    -6121, -6111, -6101, -6091, -6081, -6069, -6058, -6046, -6033, -6020, 
-    -6007, -5993, -5979, -5964, -5948, -5933, -5916, -5900, -5883, -5865, 
-    -5847, -5829, -5811, -5791, -5772, -5752, -5732, -5711, -5690, -5669, 
-    -5648, -5626, -5603, -5581, -5558, -5534, -5511, -5487, -5462, -5437, 
-    -5412, -5387, -5361, -5335, -5308, -5282, -5255, -5227, -5199, -5171, 
-    -5143, -5114, -5085, -5055, -5026, -4996, -4965, -4934, -4903, -4872, 
-    -4840, -4808, -4776, -4743, -4710, -4677, -4644, -4610, -4575, -4541, 
-    -4506, -4471, -4436, -4400, -4364, -4328, -4291, -4254, -4216, -4179, 
-    -4141, -4102, -4064, -4025, -3985, -3946, -3906, -3865, -3825, -3784, 
-    -3742, -3701, -3659, -3617, -3574, -3532, -3489, -3446, -3402, -3359, 
-    -3315, -3270, -3226, -3181, -3136, -3091, -3046, -3000, -2955, -2909, 
-    -2862, -2816, -2769, -2722, -2675, -2627, -2580, -2531, -2483, -2434, 
-    -2386, -2336, -2287, -2237, -2187, -2136, -2086, -2035, -1984, -1932, 
-    -1880, -1828, -1776, -1724, -1671, -1618, -1565, -1512, -1459, -1405, 
-    -1352, -1298, -1244, -1190, -1136, -1082, -1028, -974, -920, -866, 
-    -811, -757, -703, -649, -594, -540, -486, -432, -378, -324, 
-    -269, -215, -161, -107, -53, 1, 55, 109, 163, 216, 
-    270, 324, 378, 432, 486, 539, 593, 647, 701, 754, 
-    808, 862, 915, 969, 1023, 1076, 1130, 1183, 1236, 1290, 
-    1343, 1396, 1449, 1502, 1554, 1607, 1659, 1712, 1764, 1815, 
-    1867, 1918, 1970, 2020, 2071, 2122, 2172, 2222, 2272, 2322, 
-    2373, 2423, 2473, 2523, 2573, 2623, 2672, 2721, 2770, 2818, 
-    2866, 2914, 2962, 3009, 3056, 3103, 3149, 3195, 3241, 3286, 
-    3331, 3376, 3421, 3465, 3509, 3552, 3595, 3638, 3681, 3724, 
-    3766, 3808, 3849, 3891, 3932, 3972, 4013, 4053, 4093, 4132, 
-    4171, 4210, 4248, 4286, 4324, 4361, 4398, 4435, 4471, 4507, 
-    4543, 4578, 4612, 4647, 4681, 4715, 4748, 4781, 4813, 4846, 
-    4878, 4909, 4940, 4971, 5001, 5031, 5061, 5090, 5119, 5147, 
-    5175, 5203, 5230, 5257, 5283, 5310, 5335, 5360, 5385, 5410, 
-    5434, 5457, 5481, 5503, 5526, 5547, 5569, 5590, 5610, 5630, 
-    5649, 5668, 5687, 5705, 5723, 5740, 5757, 5773, 5789, 5804, 
-    5819, 5833, 5847, 5861, 5874, 5887, 5899, 5911, 5922, 5933, 
-    5944, 5954, 5964, 5973, 5982, 5990, 5998, 6006, 6013, 6020, 
-    6026, 6033, 6038, 6043, 6048, 6053, 6057, 6061, 6064, 6067, 
-    6070, 6072, 6074, 6075, 6077, 6077, 6078, 6078, 6077, 6077, 
-    6076, 6074, 6072, 6070, 6067, 6064, 6061, 6057, 6053, 6048, 
-    6043, 6038, 6032, 6026, 6019, 6012, 6004, 5997, 5988, 5979, 
-    5970, 5960, 5950, 5939, 5928, 5917, 5905, 5893, 5880, 5866, 
-    5853, 5839, 5824, 5809, 5794, 5778, 5762, 5745, 5728, 5711, 
-    5693, 5675, 5656, 5637, 5618, 5598, 5578, 5558, 5537, 5516, 
-    5495, 5473, 5451, 5429, 5406, 5383, 5359, 5336, 5312, 5287, 
-    5262, 5237, 5212, 5186, 5160, 5134, 5108, 5081, 5053, 5026, 
-    4998, 4970, 4941, 4913, 4884, 4854, 4825, 4795, 4765, 4734, 
-    4703, 4672, 4641, 4609, 4577, 4545, 4513, 4480, 4447, 4414, 
-    4380, 4346, 4312, 4277, 4242, 4207, 4171, 4135, 4099, 4063, 
-    4026, 3989, 3951, 3914, 3876, 3837, 3798, 3759, 3720, 3680, 
-    3640, 3600, 3560, 3519, 3478, 3437, 3395, 3353, 3311, 3269, 
-    3227, 3184, 3141, 3098, 3054, 3010, 2967, 2922, 2878, 2833, 
-    2788, 2743, 2698, 2652, 2606, 2560, 2514, 2467, 2420, 2372, 
-    2325, 2277, 2229, 2180, 2132, 2083, 2034, 1984, 1935, 1885, 
-    1835, 1785, 1734, 1684, 1633, 1583, 1532, 1480, 1429, 1378, 
-    1326, 1275, 1223, 1172, 1120, 1068, 1017, 965, 913, 861, 
-    809, 757, 705, 654, 602, 550, 498, 446, 395, 343, 
-    291, 239, 188, 136, 85, 33, -19, -70, -122, -173, 
-    -225, -277, -328, -380, -431, -483, -535, -586, -638, -689, 
-    -741, -792, -844, -895, -947, -998, -1049, -1100, -1151, -1202, 
-    -1253, -1304, -1355, -1405, -1456, -1506, -1556, -1606, -1656, -1706, 
-    -1755, -1804, -1853, -1902, -1951, -1999, -2047, -2095, -2143, -2192, 
-    -2241, -2289, -2338, -2386, -2434, -2481, -2529, -2576, -2622, -2669, 
-    -2715, -2761, -2807, -2852, -2897, -2942, -2987, -3031, -3076, -3119, 
-    -3163, -3206, -3249, -3292, -3334, -3376, -3418, -3460, -3501, -3542, 
-    -3583, -3624, -3665, -3705, -3745, -3785, -3824, -3863, -3902, -3941, 
-    -3979, -4017, -4054, -4092, -4129, -4166, -4202, -4238, -4274, -4309, 
-    -4344, -4379, -4413, -4447, -4481, -4514, -4547, -4580, -4612, -4644, 
-    -4676, -4707, -4738, -4769, -4800, -4830, -4859, -4889, -4918, -4946, 
-    -4975, -5003, -5030, -5058, -5084, -5111, -5137, -5163, -5188, -5213, 
-    -5237, -5262, -5285, -5309, -5332, -5354, -5376, -5398, -5419, -5440, 
-    -5460, -5480, -5499, -5518, -5537, -5555, -5573, -5590, -5607, -5623, 
-    -5639, -5655, -5670, -5684, -5699, -5713, -5726, -5740, -5752, -5765, 
-    -5777, -5788, -5800, -5810, -5821, -5831, -5840, -5850, -5858, -5867, 
-    -5875, -5883, -5890, -5897, -5903, -5910, -5915, -5921, -5926, -5931, 
-    -5935, -5939, -5942, -5946, -5949, -5951, -5953, -5955, -5957, -5958, 
-    -5959, -5959, -5959, -5959, -5959, -5958, -5956, -5955, -5952, -5950, 
-    -5947, -5944, -5940, -5936, -5932, -5927, -5922, -5916, -5910, -5903, 
-    -5896, -5889, -5881, -5873, -5864, -5855, -5845, -5835, -5824, -5813, 
-    -5802, -5790, -5778, -5765, -5752, -5739, -5725, -5710, -5695, -5680, 
-    -5665, -5649, -5632, -5616, -5598, -5581, -5563, -5545, -5526, -5507, 
-    -5488, -5468, -5448, -5428, -5407, -5387, -5365, -5344, -5322, -5300, 
-    -5277, -5254, -5231, -5208, -5184, -5160, -5136, -5112, -5087, -5062, 
-    -5036, -5010, -4984, -4958, -4932, -4905, -4878, -4850, -4823, -4795, 
-    -4766, -4738, -4709, -4680, -4651, -4621, -4591, -4561, -4530, -4499, 
-    -4468, -4437, -4405, -4373, -4341, -4308, -4275, -4242, -4208, -4174, 
-    -4140, -4106, -4071, -4036, -4001, -3965, -3930, -3893, -3857, -3820, 
-    -3783, -3746, -3708, -3670, -3632, -3594, -3555, -3517, -3477, -3438, 
-    -3399, -3359, -3319, -3278, -3238, -3197, -3156, -3115, -3074, -3032, 
-    -2990, -2948, -2905, -2862, -2819, -2776, -2732, -2688, -2644, -2599, 
-    -2555, -2509, -2464, -2418, -2372, -2326, -2279, -2232, -2185, -2137, 
-    -2090, -2042, -1993, -1945, -1896, -1847, -1798, -1749, -1699, -1650, 
-    -1600, -1550, -1501, -1451, -1401, -1351, -1301, -1250, -1200, -1150, 
-    -1100, -1050, -1000, -950, -900, -850, -800, -749, -699, -649, 
-    -599, -549, -499, -449, -399, -349, -299, -248, -198, -148, 
-    -97, -46, 4, 55, 106, 157, 208, 259, 310, 360, 
-    410, 460, 510, 560, 610, 660, 710, 760, 810, 860, 
-    910, 960, 1010, 1060, 1109, 1159, 1208, 1257, 1306, 1355, 
-    1404, 1453, 1502, 1550, 1599, 1647, 1695, 1744, 1792, 1841, 
-    1889, 1937, 1985, 2032, 2080, 2127, 2174, 2221, 2268, 2314, 
-    2360, 2406, 2452, 2498, 2544, 2589, 2634, 2679, 2723, 2768, 
-    2812, 2856, 2900, 2943, 2986, 3029, 3071, 3114, 3156, 3198, 
-    3239, 3281, 3322, 3362, 3403, 3443, 3483, 3523, 3562, 3601, 
-    3640, 3679, 3717, 3755, 3793, 3830, 3867, 3904, 3941, 3978, 
-    4014, 4050, 4085, 4120, 4155, 4190, 4225, 4259, 4293, 4326, 
-    4359, 4392, 4424, 4457, 4488, 4520, 4551, 4582, 4613, 4643, 
-    4673, 4703, 4732, 4761, 4790, 4818, 4846, 4873, 4900, 4927, 
-    4954, 4980, 5006, 5031, 5056, 5080, 5105, 5128, 5152, 5175, 
-    5197, 5220, 5241, 5263, 5284, 5305, 5325, 5345, 5364, 5383, 
-    5402, 5420, 5438, 5455, 5472, 5489, 5505, 5520, 5536, 5551, 
-    5565, 5579, 5593, 5606, 5619, 5632, 5644, 5655, 5667, 5678, 
-    5688, 5699, 5709, 5718, 5727, 5736, 5744, 5752, 5760, 5767, 
-    5774, 5781, 5787, 5793, 5799, 5804, 5809, 5814, 5818, 5822, 
-    5825, 5828, 5831, 5834, 5836, 5838, 5839, 5840, 5841, 5841, 
-    5841, 5840, 5840, 5839, 5837, 5835, 5833, 5831, 5828, 5824, 
-    5821, 5817, 5812, 5807, 5802, 5797, 5791, 5784, 5778, 5770, 
-    5763, 5755, 5747, 5738, 5729, 5719, 5709, 5699, 5688, 5676, 
-    5665, 5653, 5640, 5627, 5614, 5600, 5586, 5571, 5557, 5541, 
-    5526, 5510, 5493, 5476, 5459, 5442, 5424, 5406, 5387, 5368, 
-    5349, 5330, 5310, 5290, 5270, 5249, 5228, 5207, 5185, 5164, 
-    5142, 5119, 5097, 5074, 5051, 5027, 5004, 4980, 4955, 4931, 
-    4906, 4881, 4855, 4830, 4804, 4778, 4751, 4724, 4697, 4670, 
-    4642, 4615, 4586, 4558, 4529, 4500, 4471, 4442, 4412, 4382, 
-    4352, 4321, 4290, 4259, 4228, 4196, 4164, 4132, 4099, 4066, 
-    4033, 3999, 3966, 3932, 3897, 3863, 3828, 3792, 3757, 3721, 
-    3685, 3649, 3612, 3576, 3539, 3501, 3464, 3426, 3388, 3350, 
-    3311, 3273, 3234, 3194, 3155, 3115, 3076, 3036, 2995, 2955, 
-    2914, 2873, 2832, 2790, 2749, 2707, 2664, 2622, 2579, 2536, 
-    2493, 2450, 2406, 2362, 2317, 2273, 2228, 2183, 2138, 2092, 
-    2046, 2000, 1954, 1907, 1860, 1814, 1766, 1719, 1672, 1624, 
-    1576, 1529, 1481, 1433, 1385, 1336, 1288, 1240, 1191, 1143, 
-    1095, 1046, 998, 950, 901, 853, 804, 756, 708, 659, 
-    611, 563, 514, 466, 418, 369, 321, 273, 224, 176, 
-    127, 79, 30, -19, -67, -116, -165, -213, -262, -311, 
-    -360, -409, -458, -507, -556, -605, -653, -701, -749, -797, 
-    -844, -892, -939, -987, -1034, -1082, -1129, -1177, -1224, -1271, 
-    -1319, -1366, -1413, -1460, -1507, -1553, -1600, -1647, -1693, -1740, 
-    -1786, -1833, -1879, -1925, -1971, -2016, -2062, -2107, -2152, -2197, 
-    -2242, -2287, -2331, -2375, -2419, -2463, -2507, -2550, -2593, -2636, 
-    -2679, -2722, -2764, -2806, -2848, -2890, -2931, -2972, -3013, -3054, 
-    -3095, -3135, -3175, -3214, -3254, -3293, -3332, -3371, -3409, -3447, 
-    -3485, -3523, -3560, -3597, -3634, -3671, -3707, -3743, -3779, -3815, 
-    -3850, -3885, -3919, -3954, -3988, -4022, -4056, -4089, -4122, -4155, 
-    -4187, -4219, -4251, -4283, -4314, -4345, -4375, -4406, -4436, -4466, 
-    -4495, -4524, -4553, -4582, -4610, -4638, -4665, -4692, -4719, -4745, 
-    -4771, -4797, -4822, -4847, -4872, -4896, -4920, -4944, -4967, -4990, 
-    -5013, -5035, -5056, -5078, -5099, -5120, -5140, -5160, -5180, -5199, 
-    -5218, -5236, -5254, -5272, -5289, -5306, -5323, -5339, -5355, -5370, 
-    -5385, -5400, -5414, -5428, -5441, -5454, -5466, -5479, -5490, -5502, 
-    -5513, -5524, -5534, -5544, -5554, -5563, -5572, -5580, -5588, -5596, 
-    -5604, -5611, -5618, -5624, -5630, -5636, -5642, -5647, -5652, -5656, 
-    -5660, -5664, -5667, -5671, -5673, -5676, -5678, -5680, -5681, -5682, 
-    -5683, -5684, -5684, -5683, -5683, -5682, -5681, -5679, -5677, -5675, 
-    -5672, -5669, -5665, -5662, -5658, -5653, -5648, -5643, -5638, -5632, 
-    -5626, -5619, -5612, -5605, -5598, -5589, -5581, -5572, -5563, -5554, 
-    -5544, -5534, -5523, -5512, -5501, -5489, -5477, -5464, -5451, -5438, 
-    -5424, -5410, -5395, -5380, -5365, -5350, -5334, -5318, -5301, -5284, 
-    -5267, -5249, -5231, -5213, -5194, -5176, -5156, -5137, -5117, -5097, 
-    -5077, -5056, -5036, -5015, -4993, -4972, -4950, -4928, -4905, -4883, 
-    -4860, -4836, -4813, -4789, -4765, -4741, -4716, -4691, -4666, -4641, 
-    -4615, -4589, -4563, -4536, -4510, -4483, -4455, -4428, -4400, -4372, 
-    -4344, -4315, -4287, -4258, -4228, -4199, -4169, -4139, -4108, -4077, 
-    -4046, -4015, -3983, -3952, -3920, -3887, -3855, -3822, -3788, -3755, 
-    -3721, -3687, -3653, -3618, -3584, -3549, -3513, -3478, -3442, -3406, 
-    -3370, -3333, -3297, -3260, -3223, -3185, -3148, -3110, -3072, -3034, 
-    -2996, -2957, -2918, -2879, -2840, -2801, -2761, -2722, -2682, -2641, 
-    -2601, -2560, -2520, -2479, -2437, -2396, -2354, -2312, -2270, -2227, 
-    -2184, -2141, -2098, -2055, -2011, -1967, -1923, -1879, -1834, -1790, 
-    -1745, -1700, -1654, -1609, -1563, -1518, -1472, -1426, -1380, -1334, 
-    -1288, -1242, -1196, -1149, -1103, -1057, -1010, -964, -918, -871, 
-    -825, -778, -732, -686, -639, -593, -547, -500, -454, -408, 
-    -362, -315, -269, -223, -176, -130, -84, -37, 9, 56, 
-    102, 149, 195, 242, 288, 335, 382, 428, 475, 522, 
-    569, 615, 662, 708, 753, 799, 844, 890, 935, 980, 
-    1026, 1071, 1117, 1162, 1207, 1252, 1297, 1342, 1387, 1432, 
-    1477, 1522, 1566, 1611, 1655, 1699, 1744, 1788, 1832, 1876, 
-    1920, 1964, 2007, 2051, 2094, 2137, 2180, 2222, 2265, 2307, 
-    2349, 2391, 2432, 2474, 2515, 2556, 2597, 2638, 2678, 2719, 
-    2759, 2799, 2838, 2878, 2917, 2956, 2995, 3033, 3071, 3109, 
-    3147, 3185, 3222, 3259, 3296, 3333, 3369, 3405, 3441, 3476, 
-    3512, 3547, 3581, 3616, 3650, 3684, 3718, 3752, 3785, 3818, 
-    3851, 3883, 3916, 3948, 3979, 4011, 4042, 4073, 4104, 4134, 
-    4164, 4194, 4223, 4252, 4281, 4310, 4338, 4366, 4394, 4421, 
-    4448, 4475, 4501, 4528, 4553, 4579, 4604, 4629, 4654, 4678, 
-    4701, 4725, 4748, 4771, 4794, 4816, 4838, 4859, 4880, 4901, 
-    4922, 4942, 4962, 4981, 5000, 5019, 5038, 5056, 5073, 5091, 
-    5108, 5124, 5141, 5156, 5172, 5187, 5202, 5216, 5230, 5244, 
-    5257, 5270, 5282, 5294, 5306, 5318, 5329, 5339, 5349, 5359, 
-    5369, 5378, 5387, 5396, 5404, 5412, 5419, 5427, 5434, 5440, 
-    5447, 5453, 5458, 5464, 5469, 5473, 5478, 5482, 5486, 5490, 
-    5493, 5496, 5498, 5500, 5502, 5504, 5505, 5506, 5507, 5507, 
-    5507, 5507, 5506, 5505, 5504, 5502, 5500, 5498, 5495, 5492, 
-    5489, 5485, 5481, 5477, 5472, 5467, 5462, 5456, 5450, 5443, 
-    5437, 5430, 5422, 5415, 5406, 5398, 5389, 5380, 5370, 5360, 
-    5350, 5339, 5328, 5317, 5305, 5293, 5281, 5268, 5255, 5241, 
-    5227, 5213, 5198, 5183, 5168, 5152, 5136, 5120, 5103, 5086, 
-    5069, 5052, 5034, 5016, 4997, 4979, 4960, 4941, 4921, 4902, 
-    4882, 4862, 4841, 4821, 4800, 4778, 4757, 4735, 4713, 4691, 
-    4669, 4646, 4623, 4600, 4576, 4553, 4529, 4504, 4480, 4455, 
-    4430, 4405, 4379, 4353, 4327, 4301, 4275, 4248, 4221, 4194, 
-    4166, 4138, 4110, 4082, 4054, 4025, 3996, 3967, 3937, 3908, 
-    3878, 3847, 3817, 3786, 3755, 3724, 3692, 3661, 3629, 3596, 
-    3564, 3531, 3498, 3465, 3431, 3397, 3363, 3329, 3295, 3260, 
-    3225, 3190, 3155, 3119, 3083, 3048, 3011, 2975, 2939, 2902, 
-    2865, 2828, 2791, 2753, 2716, 2678, 2640, 2601, 2563, 2524, 
-    2485, 2446, 2407, 2368, 2328, 2288, 2248, 2207, 2167, 2126, 
-    2085, 2044, 2002, 1961, 1919, 1877, 1835, 1792, 1750, 1707, 
-    1664, 1621, 1578, 1535, 1491, 1448, 1404, 1360, 1316, 1273, 
-    1228, 1184, 1140, 1096, 1052, 1007, 963, 919, 874, 830, 
-    786, 741, 697, 652, 608, 563, 519, 474, 430, 386, 
-    341, 297, 252, 208, 164, 119, 75, 30, -14, -58, 
-    -103, -147, -192, -236, -280, -325, -369, -414, -458, -503, 
-    -547, -591, -636, -680, -725, -769, -813, -857, -901, -944, 
-    -988, -1031, -1074, -1118, -1161, -1204, -1247, -1290, -1333, -1376, 
-    -1419, -1462, -1505, -1547, -1590, -1632, -1675, -1717, -1760, -1802, 
-    -1844, -1886, -1928, -1969, -2011, -2052, -2093, -2134, -2175, -2216, 
-    -2256, -2296, -2336, -2376, -2416, -2455, -2495, -2534, -2573, -2611, 
-    -2650, -2688, -2726, -2764, -2802, -2840, -2877, -2914, -2951, -2988, 
-    -3024, -3060, -3096, -3132, -3168, -3203, -3238, -3273, -3308, -3342, 
-    -3376, -3410, -3444, -3478, -3511, -3544, -3577, -3609, -3641, -3673, 
-    -3705, -3737, -3768, -3799, -3830, -3860, -3890, -3920, -3950, -3979, 
-    -4008, -4037, -4066, -4094, -4122, -4150, -4177, -4205, -4232, -4258, 
-    -4285, -4311, -4336, -4362, -4387, -4412, -4437, -4461, -4485, -4509, 
-    -4532, -4555, -4578, -4600, -4622, -4644, -4665, -4686, -4707, -4727, 
-    -4748, -4767, -4787, -4806, -4825, -4843, -4862, -4879, -4897, -4914, 
-    -4931, -4947, -4964, -4980, -4995, -5010, -5025, -5039, -5053, -5067, 
-    -5081, -5094, -5106, -5119, -5131, -5142, -5154, -5164, -5175, -5185, 
-    -5195, -5205, -5214, -5223, -5231, -5239, -5247, -5255, -5262, -5269, 
-    -5276, -5282, -5288, -5294, -5299, -5304, -5309, -5314, -5318, -5322, 
-    -5325, -5329, -5332, -5334, -5337, -5339, -5340, -5342, -5343, -5344, 
-    -5344, -5345, -5345, -5344, -5343, -5342, -5341, -5339, -5337, -5335, 
-    -5332, -5329, -5326, -5323, -5319, -5315, -5310, -5305, -5300, -5295, 
-    -5289, -5283, -5277, -5270, -5263, -5255, -5248, -5240, -5231, -5223, 
-    -5214, -5204, -5195, -5184, -5174, -5163, -5152, -5141, -5129, -5117, 
-    -5104, -5091, -5078, -5065, -5051, -5037, -5022, -5007, -4992, -4977, 
-    -4961, -4945, -4929, -4912, -4895, -4878, -4860, -4843, -4825, -4806, 
-    -4788, -4769, -4750, -4731, -4711, -4691, -4671, -4651, -4631, -4610, 
-    -4589, -4568, -4546, -4524, -4502, -4480, -4458, -4435, -4412, -4389, 
-    -4365, -4342, -4318, -4293, -4269, -4244, -4219, -4194, -4168, -4143, 
-    -4117, -4091, -4064, -4038, -4011, -3984, -3957, -3929, -3901, -3873, 
-    -3845, -3817, -3788, -3759, -3730, -3700, -3670, -3640, -3610, -3580, 
-    -3549, -3518, -3487, -3456, -3424, -3392, -3360, -3327, -3295, -3262, 
-    -3229, -3196, -3162, -3128, -3095, -3060, -3026, -2992, -2957, -2922, 
-    -2887, -2852, -2817, -2781, -2745, -2710, -2673, -2637, -2601, -2564, 
-    -2528, -2491, -2454, -2416, -2379, -2341, -2303, -2265, -2227, -2189, 
-    -2150, -2111, -2072, -2033, -1993, -1954, -1914, -1874, -1834, -1794, 
-    -1753, -1712, -1671, -1630, -1589, -1548, -1506, -1465, -1423, -1381, 
-    -1339, -1297, -1255, -1213, -1171, -1129, -1086, -1044, -1002, -959, 
-    -917, -874, -832, -789, -747, -704, -662, -619, -577, -534, 
-    -492, -449, -407, -365, -322, -280, -237, -195, -153, -110, 
-    -68, -25, 17, 59, 102, 144, 187, 229, 271, 314, 
-    356, 399, 441, 484, 526, 569, 611, 654, 696, 739, 
-    780, 822, 863, 905, 946, 987, 1029, 1070, 1111, 1153, 
-    1194, 1235, 1276, 1317, 1358, 1399, 1440, 1480, 1521, 1562, 
-    1602, 1643, 1683, 1723, 1764, 1804, 1844, 1883, 1923, 1963, 
-    2002, 2041, 2080, 2119, 2158, 2196, 2235, 2273, 2311, 2349, 
-    2386, 2424, 2461, 2498, 2535, 2572, 2609, 2645, 2681, 2717, 
-    2753, 2789, 2824, 2859, 2894, 2929, 2963, 2998, 3032, 3066, 
-    3100, 3133, 3166, 3199, 3232, 3265, 3297, 3330, 3361, 3393, 
-    3425, 3456, 3487, 3518, 3548, 3579, 3609, 3639, 3669, 3698, 
-    3727, 3756, 3785, 3813, 3841, 3869, 3897, 3924, 3952, 3978, 
-    4005, 4032, 4058, 4084, 4109, 4135, 4160, 4185, 4209, 4234, 
-    4258, 4281, 4305, 4328, 4351, 4373, 4395, 4417, 4439, 4460, 
-    4481, 4502, 4522, 4542, 4562, 4582, 4601, 4620, 4638, 4657, 
-    4675, 4692, 4709, 4726, 4743, 4759, 4776, 4791, 4807, 4822, 
-    4837, 4851, 4865, 4879, 4892, 4906, 4918, 4931, 4943, 4955, 
-    4966, 4977, 4988, 4999, 5009, 5019, 5028, 5037, 5046, 5055, 
-    5063, 5071, 5079, 5086, 5093, 5100, 5106, 5113, 5119, 5124, 
-    5129, 5135, 5139, 5144, 5148, 5152, 5156, 5159, 5162, 5165, 
-    5167, 5170, 5171, 5173, 5174, 5175, 5176, 5177, 5177, 5177, 
-    5176, 5175, 5174, 5173, 5171, 5169, 5167, 5164, 5161, 5158, 
-    5155, 5151, 5147, 5142, 5137, 5132, 5127, 5122, 5116, 5109, 
-    5103, 5096, 5089, 5081, 5073, 5065, 5057, 5048, 5039, 5029, 
-    5020, 5010, 4999, 4988, 4977, 4966, 4954, 4942, 4930, 4917, 
-    4904, 4891, 4877, 4863, 4849, 4834, 4820, 4804, 4789, 4773, 
-    4757, 4741, 4725, 4708, 4691, 4674, 4656, 4639, 4621, 4603, 
-    4584, 4566, 4547, 4528, 4508, 4489, 4469, 4449, 4429, 4408, 
-    4387, 4366, 4345, 4324, 4302, 4280, 4258, 4236, 4213, 4190, 
-    4167, 4144, 4120, 4096, 4072, 4048, 4023, 3999, 3974, 3948, 
-    3923, 3898, 3872, 3846, 3820, 3793, 3766, 3740, 3712, 3685, 
-    3657, 3630, 3602, 3573, 3545, 3516, 3487, 3458, 3429, 3399, 
-    3369, 3339, 3309, 3278, 3247, 3216, 3185, 3153, 3122, 3090, 
-    3058, 3026, 2993, 2961, 2928, 2895, 2861, 2828, 2794, 2761, 
-    2727, 2693, 2658, 2624, 2589, 2555, 2520, 2485, 2449, 2414, 
-    2378, 2343, 2307, 2270, 2234, 2198, 2161, 2124, 2087, 2050, 
-    2013, 1975, 1937, 1900, 1862, 1823, 1785, 1746, 1708, 1669, 
-    1630, 1591, 1551, 1512, 1472, 1433, 1393, 1353, 1313, 1273, 
-    1233, 1193, 1152, 1112, 1071, 1031, 990, 950, 909, 869, 
-    828, 787, 747, 706, 665, 625, 584, 543, 503, 462, 
-    421, 381, 340, 300, 259, 218, 178, 137, 97, 56, 
-    16, -25, -65, -106, -146, -187, -227, -268, -308, -349, 
-    -389, -430, -470, -511, -551, -592, -632, -673, -713, -754, 
-    -794, -834, -874, -913, -953, -992, -1032, -1071, -1110, -1150, 
-    -1189, -1228, -1267, -1306, -1345, -1384, -1423, -1462, -1501, -1540, 
-    -1578, -1617, -1655, -1694, -1732, -1770, -1808, -1846, -1883, -1921, 
-    -1958, -1996, -2033, -2070, -2106, -2143, -2180, -2216, -2252, -2288, 
-    -2324, -2359, -2395, -2430, -2465, -2500, -2535, -2570, -2604, -2638, 
-    -2673, -2706, -2740, -2774, -2807, -2840, -2873, -2906, -2938, -2971, 
-    -3003, -3035, -3067, -3098, -3129, -3161, -3191, -3222, -3253, -3283, 
-    -3313, -3343, -3372, -3402, -3431, -3460, -3488, -3517, -3545, -3573, 
-    -3601, -3628, -3656, -3683, -3709, -3736, -3762, -3788, -3814, -3840, 
-    -3865, -3890, -3915, -3940, -3965, -3989, -4013, -4037, -4060, -4083, 
-    -4106, -4129, -4151, -4173, -4195, -4217, -4238, -4259, -4280, -4300, 
-    -4320, -4340, -4360, -4379, -4398, -4416, -4435, -4453, -4471, -4488, 
-    -4505, -4522, -4539, -4555, -4571, -4587, -4603, -4618, -4633, -4647, 
-    -4661, -4675, -4689, -4702, -4715, -4728, -4740, -4752, -4764, -4776, 
-    -4787, -4797, -4808, -4818, -4828, -4838, -4847, -4856, -4865, -4873, 
-    -4881, -4889, -4897, -4904, -4911, -4917, -4924, -4930, -4936, -4941, 
-    -4947, -4952, -4956, -4961, -4965, -4969, -4972, -4976, -4979, -4981, 
-    -4984, -4986, -4988, -4990, -4991, -4992, -4993, -4994, -4994, -4994, 
-    -4994, -4993, -4993, -4991, -4990, -4988, -4986, -4984, -4982, -4979, 
-    -4976, -4972, -4969, -4965, -4961, -4956, -4951, -4946, -4941, -4935, 
-    -4929, -4923, -4916, -4910, -4902, -4895, -4887, -4879, -4871, -4862, 
-    -4853, -4844, -4834, -4824, -4814, -4804, -4793, -4782, -4770, -4759, 
-    -4747, -4734, -4722, -4709, -4696, -4682, -4669, -4655, -4640, -4626, 
-    -4611, -4596, -4581, -4565, -4549, -4533, -4517, -4500, -4483, -4466, 
-    -4449, -4432, -4414, -4396, -4378, -4359, -4341, -4322, -4303, -4284, 
-    -4264, -4245, -4225, -4205, -4184, -4164, -4143, -4122, -4101, -4079, 
-    -4057, -4035, -4013, -3991, -3968, -3945, -3922, -3899, -3875, -3852, 
-    -3828, -3804, -3780, -3755, -3730, -3705, -3680, -3655, -3629, -3603, 
-    -3577, -3551, -3525, -3498, -3471, -3444, -3417, -3389, -3362, -3334, 
-    -3306, -3277, -3249, -3220, -3191, -3162, -3132, -3103, -3073, -3043, 
-    -3013, -2982, -2952, -2921, -2890, -2859, -2828, -2796, -2764, -2732, 
-    -2700, -2668, -2636, -2603, -2570, -2538, -2504, -2471, -2438, -2404, 
-    -2371, -2337, -2303, -2269, -2235, -2200, -2166, -2131, -2096, -2061, 
-    -2026, -1991, -1955, -1920, -1884, -1848, -1812, -1776, -1739, -1703, 
-    -1666, -1629, -1592, -1555, -1518, -1480, -1443, -1405, -1367, -1329, 
-    -1292, -1253, -1215, -1177, -1139, -1101, -1062, -1024, -985, -947, 
-    -908, -869, -831, -792, -753, -715, -676, -637, -598, -560, 
-    -521, -482, -443, -405, -366, -327, -289, -250, -211, -173, 
-    -134, -96, -57, -18, 20, 59, 97, 136, 174, 213, 
-    251, 290, 328, 367, 405, 443, 482, 520, 559, 597, 
-    635, 674, 712, 750, 789, 827, 865, 903, 940, 978, 
-    1015, 1053, 1090, 1127, 1165, 1202, 1239, 1276, 1313, 1350, 
-    1387, 1424, 1461, 1498, 1534, 1571, 1607, 1644, 1680, 1716, 
-    1753, 1788, 1824, 1860, 1895, 1931, 1966, 2001, 2036, 2071, 
-    2106, 2140, 2174, 2209, 2243, 2277, 2310, 2344, 2377, 2411, 
-    2444, 2477, 2510, 2542, 2575, 2607, 2639, 2671, 2703, 2734, 
-    2766, 2797, 2828, 2859, 2890, 2920, 2951, 2981, 3011, 3040, 
-    3070, 3099, 3128, 3157, 3186, 3214, 3243, 3271, 3298, 3326, 
-    3354, 3381, 3408, 3435, 3461, 3487, 3514, 3539, 3565, 3591, 
-    3616, 3641, 3666, 3690, 3715, 3739, 3763, 3786, 3810, 3833, 
-    3856, 3879, 3901, 3924, 3946, 3968, 3989, 4010, 4031, 4052, 
-    4073, 4093, 4113, 4133, 4152, 4171, 4190, 4209, 4227, 4245, 
-    4263, 4281, 4298, 4315, 4332, 4348, 4364, 4380, 4396, 4411, 
-    4426, 4441, 4456, 4470, 4484, 4497, 4511, 4524, 4537, 4549, 
-    4561, 4573, 4585, 4596, 4607, 4618, 4629, 4639, 4649, 4658, 
-    4668, 4677, 4686, 4694, 4702, 4710, 4718, 4725, 4732, 4739, 
-    4746, 4752, 4758, 4764, 4769, 4774, 4779, 4784, 4788, 4793, 
-    4796, 4800, 4803, 4807, 4809, 4812, 4814, 4816, 4818, 4820, 
-    4821, 4822, 4823, 4823, 4823, 4823, 4823, 4822, 4822, 4821, 
-    4819, 4817, 4816, 4813, 4811, 4808, 4805, 4802, 4798, 4795, 
-    4791, 4786, 4782, 4777, 4772, 4766, 4761, 4755, 4748, 4742, 
-    4735, 4728, 4720, 4713, 4705, 4696, 4688, 4679, 4670, 4660, 
-    4651, 4641, 4630, 4620, 4609, 4598, 4587, 4575, 4563, 4551, 
-    4538, 4525, 4512, 4499, 4485, 4472, 4457, 4443, 4429, 4414, 
-    4399, 4383, 4368, 4352, 4336, 4320, 4304, 4287, 4270, 4253, 
-    4236, 4218, 4201, 4183, 4164, 4146, 4128, 4109, 4090, 4071, 
-    4051, 4032, 4012, 3992, 3971, 3951, 3930, 3909, 3888, 3867, 
-    3845, 3824, 3802, 3780, 3757, 3735, 3712, 3689, 3666, 3642, 
-    3619, 3595, 3571, 3547, 3523, 3498, 3473, 3448, 3423, 3398, 
-    3372, 3346, 3320, 3294, 3268, 3241, 3214, 3187, 3160, 3133, 
-    3105, 3078, 3050, 3022, 2993, 2965, 2936, 2907, 2878, 2849, 
-    2819, 2789, 2760, 2730, 2699, 2669, 2638, 2608, 2577, 2546, 
-    2515, 2483, 2452, 2420, 2388, 2357, 2324, 2292, 2260, 2227, 
-    2195, 2162, 2129, 2096, 2063, 2030, 1996, 1962, 1929, 1895, 
-    1861, 1827, 1792, 1758, 1723, 1689, 1654, 1619, 1584, 1549, 
-    1513, 1478, 1442, 1407, 1371, 1335, 1299, 1263, 1226, 1190, 
-    1154, 1117, 1081, 1044, 1007, 971, 934, 897, 860, 823, 
-    787, 750, 713, 676, 639, 602, 565, 528, 491, 454, 
-    417, 380, 343, 306, 269, 232, 195, 158, 122, 85, 
-    48, 11, -26, -62, -99, -136, -173, -209, -246, -283, 
-    -319, -356, -392, -429, -466, -502, -539, -575, -612, -648, 
-    -685, -721, -758, -794, -830, -866, -902, -938, -974, -1010, 
-    -1045, -1081, -1116, -1152, -1187, -1223, -1258, -1293, -1328, -1364, 
-    -1399, -1434, -1469, -1504, -1539, -1573, -1608, -1642, -1677, -1711, 
-    -1745, -1779, -1813, -1847, -1880, -1914, -1947, -1980, -2014, -2046, 
-    -2079, -2112, -2144, -2177, -2209, -2241, -2273, -2305, -2336, -2368, 
-    -2399, -2430, -2461, -2492, -2523, -2553, -2584, -2614, -2644, -2674, 
-    -2703, -2733, -2762, -2791, -2820, -2849, -2878, -2906, -2935, -2963, 
-    -2991, -3018, -3046, -3073, -3100, -3127, -3154, -3180, -3207, -3233, 
-    -3259, -3284, -3310, -3335, -3360, -3385, -3410, -3434, -3458, -3482, 
-    -3506, -3530, -3553, -3576, -3599, -3622, -3645, -3667, -3689, -3711, 
-    -3733, -3755, -3776, -3797, -3818, -3838, -3858, -3878, -3898, -3918, 
-    -3937, -3956, -3975, -3994, -4012, -4030, -4048, -4065, -4083, -4100, 
-    -4116, -4133, -4149, -4165, -4181, -4197, -4212, -4227, -4242, -4256, 
-    -4270, -4284, -4298, -4311, -4324, -4337, -4350, -4362, -4374, -4386, 
-    -4398, -4409, -4420, -4430, -4441, -4451, -4461, -4471, -4480, -4489, 
-    -4498, -4506, -4515, -4523, -4530, -4538, -4545, -4552, -4559, -4565, 
-    -4571, -4577, -4583, -4588, -4594, -4598, -4603, -4608, -4612, -4616, 
-    -4619, -4623, -4626, -4629, -4632, -4634, -4636, -4638, -4640, -4641, 
-    -4642, -4643, -4644, -4644, -4645, -4644, -4644, -4644, -4643, -4642, 
-    -4640, -4639, -4637, -4635, -4632, -4630, -4627, -4624, -4620, -4617, 
-    -4613, -4609, -4604, -4600, -4595, -4590, -4584, -4579, -4573, -4566, 
-    -4560, -4553, -4546, -4539, -4531, -4523, -4515, -4507, -4498, -4489, 
-    -4480, -4471, -4461, -4451, -4441, -4430, -4420, -4409, -4397, -4386, 
-    -4374, -4362, -4350, -4337, -4324, -4311, -4298, -4284, -4271, -4257, 
-    -4243, -4228, -4213, -4199, -4183, -4168, -4153, -4137, -4121, -4105, 
-    -4088, -4072, -4055, -4038, -4021, -4003, -3986, -3968, -3950, -3932, 
-    -3914, -3895, -3876, -3857, -3838, -3818, -3799, -3779, -3759, -3739, 
-    -3718, -3698, -3677, -3656, -3635, -3614, -3592, -3570, -3549, -3526, 
-    -3504, -3482, -3459, -3436, -3413, -3390, -3366, -3343, -3319, -3295, 
-    -3270, -3246, -3221, -3196, -3171, -3146, -3121, -3095, -3069, -3044, 
-    -3017, -2991, -2965, -2938, -2911, -2884, -2857, -2829, -2802, -2774, 
-    -2746, -2718, -2690, -2661, -2633, -2604, -2575, -2546, -2517, -2487, 
-    -2458, -2428, -2398, -2368, -2338, -2308, -2277, -2247, -2216, -2185, 
-    -2154, -2123, -2092, -2060, -2029, -1997, -1965, -1933, -1901, -1869, 
-    -1837, -1805, -1772, -1739, -1707, -1674, -1641, -1608, -1575, -1541, 
-    -1508, -1474, -1441, -1407, -1373, -1339, -1305, -1271, -1237, -1202, 
-    -1168, -1133, -1099, -1064, -1030, -995, -960, -925, -890, -855, 
-    -820, -785, -750, -715, -680, -644, -609, -574, -539, -504, 
-    -469, -433, -398, -363, -328, -293, -258, -222, -187, -152, 
-    -117, -82, -47, -12, 23, 58, 93, 128, 163, 198, 
-    232, 267, 302, 337, 372, 407, 441, 476, 511, 545, 
-    580, 614, 649, 684, 718, 753, 787, 821, 856, 890, 
-    924, 958, 992, 1026, 1060, 1094, 1127, 1161, 1194, 1228, 
-    1261, 1295, 1328, 1361, 1395, 1428, 1461, 1494, 1527, 1560, 
-    1592, 1625, 1657, 1690, 1722, 1754, 1786, 1818, 1850, 1882, 
-    1913, 1944, 1976, 2007, 2038, 2069, 2099, 2130, 2160, 2190, 
-    2221, 2250, 2280, 2310, 2339, 2369, 2398, 2427, 2456, 2485, 
-    2514, 2542, 2571, 2599, 2627, 2655, 2682, 2710, 2737, 2765, 
-    2792, 2819, 2845, 2872, 2898, 2924, 2950, 2976, 3002, 3027, 
-    3052, 3077, 3102, 3127, 3151, 3176, 3199, 3223, 3247, 3270, 
-    3293, 3317, 3339, 3362, 3385, 3407, 3429, 3451, 3473, 3494, 
-    3515, 3536, 3557, 3578, 3598, 3619, 3639, 3658, 3678, 3697, 
-    3716, 3735, 3754, 3772, 3790, 3808, 3826, 3843, 3861, 3878, 
-    3895, 3911, 3927, 3943, 3959, 3975, 3990, 4005, 4020, 4035, 
-    4049, 4063, 4077, 4091, 4104, 4117, 4130, 4142, 4155, 4167, 
-    4179, 4190, 4202, 4213, 4224, 4234, 4245, 4255, 4264, 4274, 
-    4283, 4292, 4301, 4309, 4318, 4326, 4334, 4341, 4348, 4355, 
-    4362, 4369, 4375, 4381, 4387, 4392, 4398, 4403, 4408, 4412, 
-    4417, 4421, 4425, 4428, 4432, 4435, 4438, 4440, 4443, 4445, 
-    4447, 4449, 4450, 4452, 4453, 4453, 4454, 4454, 4454, 4454, 
-    4454, 4453, 4452, 4451, 4450, 4448, 4446, 4444, 4442, 4439, 
-    4436, 4433, 4430, 4426, 4423, 4419, 4414, 4410, 4405, 4400, 
-    4395, 4389, 4384, 4378, 4371, 4365, 4358, 4351, 4344, 4336, 
-    4329, 4321, 4312, 4304, 4295, 4286, 4277, 4267, 4257, 4247, 
-    4237, 4227, 4216, 4205, 4193, 4182, 4170, 4158, 4146, 4134, 
-    4121, 4108, 4095, 4082, 4068, 4055, 4041, 4027, 4012, 3998, 
-    3983, 3968, 3953, 3937, 3922, 3906, 3890, 3874, 3857, 3841, 
-    3824, 3807, 3790, 3772, 3755, 3737, 3719, 3701, 3683, 3664, 
-    3646, 3627, 3608, 3588, 3569, 3549, 3530, 3510, 3490, 3469, 
-    3449, 3428, 3407, 3386, 3365, 3344, 3322, 3301, 3279, 3256, 
-    3234, 3212, 3189, 3166, 3143, 3120, 3096, 3073, 3049, 3025, 
-    3001, 2977, 2952, 2928, 2903, 2878, 2853, 2827, 2802, 2776, 
-    2750, 2725, 2698, 2672, 2646, 2619, 2592, 2565, 2538, 2511, 
-    2484, 2456, 2428, 2400, 2372, 2344, 2316, 2288, 2259, 2230, 
-    2202, 2173, 2143, 2114, 2085, 2055, 2026, 1996, 1966, 1936, 
-    1906, 1876, 1846, 1815, 1785, 1754, 1723, 1693, 1662, 1631, 
-    1599, 1568, 1537, 1505, 1474, 1442, 1411, 1379, 1347, 1315, 
-    1283, 1250, 1218, 1186, 1153, 1121, 1088, 1056, 1023, 990, 
-    957, 924, 891, 858, 825, 792, 759, 726, 692, 659, 
-    626, 593, 559, 526, 493, 460, 426, 393, 360, 327, 
-    293, 260, 227, 194, 160, 127, 94, 61, 28, -5, 
-    -38, -71, -104, -137, -170, -203, -236, -269, -302, -335, 
-    -368, -400, -433, -466, -499, -531, -564, -597, -629, -662, 
-    -694, -727, -759, -791, -824, -856, -888, -920, -952, -984, 
-    -1016, -1048, -1080, -1112, -1143, -1175, -1206, -1238, -1269, -1301, 
-    -1332, -1363, -1394, -1425, -1456, -1487, -1518, -1549, -1579, -1610, 
-    -1640, -1670, -1700, -1731, -1760, -1790, -1820, -1849, -1879, -1908, 
-    -1937, -1966, -1995, -2024, -2052, -2081, -2109, -2138, -2166, -2194, 
-    -2221, -2249, -2277, -2304, -2331, -2358, -2385, -2412, -2439, -2466, 
-    -2492, -2518, -2544, -2570, -2596, -2622, -2647, -2673, -2698, -2723, 
-    -2748, -2772, -2797, -2821, -2845, -2869, -2893, -2917, -2940, -2963, 
-    -2986, -3009, -3032, -3054, -3077, -3099, -3121, -3143, -3164, -3186, 
-    -3207, -3228, -3249, -3270, -3290, -3310, -3331, -3351, -3370, -3390, 
-    -3409, -3428, -3447, -3466, -3484, -3503, -3521, -3539, -3556, -3574, 
-    -3591, -3608, -3625, -3641, -3658, -3674, -3690, -3706, -3721, -3737, 
-    -3752, -3766, -3781, -3795, -3810, -3824, -3837, -3851, -3864, -3877, 
-    -3890, -3903, -3915, -3927, -3939, -3951, -3962, -3973, -3984, -3995, 
-    -4005, -4015, -4025, -4035, -4045, -4054, -4063, -4072, -4080, -4089, 
-    -4097, -4105, -4112, -4120, -4127, -4134, -4140, -4147, -4153, -4159, 
-    -4165, -4171, -4176, -4181, -4186, -4191, -4195, -4199, -4203, -4207, 
-    -4211, -4214, -4217, -4220, -4223, -4225, -4227, -4229, -4231, -4233, 
-    -4234, -4235, -4236, -4237, -4237, -4237, -4237, -4237, -4237, -4236, 
-    -4235, -4234, -4233, -4231, -4229, -4227, -4225, -4223, -4220, -4217, 
-    -4214, -4211, -4207, -4203, -4199, -4195, -4191, -4186, -4181, -4176, 
-    -4171, -4165, -4159, -4153, -4147, -4140, -4133, -4126, -4119, -4112, 
-    -4104, -4096, -4088, -4079, -4071, -4062, -4053, -4043, -4034, -4024, 
-    -4014, -4004, -3993, -3982, -3972, -3960, -3949, -3938, -3926, -3914, 
-    -3902, -3889, -3877, -3864, -3851, -3838, -3824, -3811, -3797, -3783, 
-    -3769, -3754, -3740, -3725, -3710, -3695, -3680, -3664, -3649, -3633, 
-    -3617, -3601, -3584, -3568, -3551, -3534, -3517, -3500, -3482, -3465, 
-    -3447, -3429, -3411, -3393, -3374, -3356, -3337, -3318, -3299, -3280, 
-    -3260, -3241, -3221, -3201, -3181, -3161, -3140, -3120, -3099, -3078, 
-    -3057, -3035, -3014, -2992, -2970, -2948, -2926, -2904, -2881, -2859, 
-    -2836, -2813, -2790, -2767, -2743, -2720, -2696, -2672, -2648, -2624, 
-    -2599, -2575, -2550, -2525, -2500, -2475, -2450, -2424, -2399, -2373, 
-    -2347, -2321, -2295, -2269, -2243, -2216, -2190, -2163, -2136, -2109, 
-    -2082, -2054, -2027, -2000, -1972, -1944, -1916, -1888, -1860, -1832, 
-    -1804, -1776, -1747, -1719, -1690, -1661, -1632, -1603, -1574, -1545, 
-    -1516, -1486, -1457, -1427, -1398, -1368, -1338, -1308, -1278, -1248, 
-    -1218, -1188, -1158, -1127, -1097, -1066, -1035, -1005, -974, -943, 
-    -912, -881, -850, -819, -788, -757, -726, -695, -664, -633, 
-    -601, -570, -539, -508, -476, -445, -414, -383, -352, -320, 
-    -289, -258, -227, -195, -164, -133, -102, -71, -39, -8, 
-    23, 54, 85, 116, 147, 178, 209, 240, 271, 302, 
-    333, 363, 394, 425, 456, 486, 517, 548, 578, 609, 
-    639, 670, 700, 731, 761, 791, 822, 852, 882, 913, 
-    943, 973, 1003, 1033, 1063, 1093, 1122, 1152, 1182, 1211, 
-    1241, 1270, 1299, 1329, 1358, 1387, 1416, 1445, 1474, 1503, 
-    1531, 1560, 1588, 1617, 1645, 1673, 1701, 1729, 1757, 1785, 
-    1812, 1840, 1867, 1894, 1921, 1948, 1975, 2002, 2029, 2055, 
-    2082, 2108, 2134, 2160, 2186, 2211, 2237, 2263, 2288, 2313, 
-    2338, 2363, 2388, 2413, 2437, 2461, 2486, 2510, 2534, 2558, 
-    2581, 2605, 2628, 2651, 2674, 2697, 2720, 2742, 2765, 2787, 
-    2809, 2831, 2852, 2874, 2895, 2916, 2937, 2958, 2979, 2999, 
-    3020, 3040, 3060, 3080, 3099, 3119, 3138, 3157, 3176, 3195, 
-    3213, 3232, 3250, 3268, 3286, 3303, 3321, 3338, 3355, 3372, 
-    3389, 3405, 3421, 3437, 3453, 3469, 3484, 3500, 3515, 3530, 
-    3544, 3559, 3573, 3587, 3601, 3614, 3628, 3641, 3654, 3666, 
-    3679, 3691, 3703, 3715, 3727, 3739, 3750, 3761, 3772, 3782, 
-    3793, 3803, 3813, 3822, 3832, 3841, 3850, 3859, 3867, 3876, 
-    3884, 3892, 3899, 3907, 3914, 3921, 3928, 3935, 3941, 3947, 
-    3953, 3959, 3964, 3970, 3975, 3980, 3985, 3989, 3993, 3997, 
-    4001, 4005, 4008, 4012, 4015, 4017, 4020, 4022, 4025, 4027, 
-    4028, 4030, 4031, 4032, 4033, 4034, 4034, 4035, 4035, 4035, 
-    4034, 4034, 4033, 4032, 4031, 4029, 4028, 4026, 4024, 4022, 
-    4019, 4017, 4014, 4011, 4007, 4004, 4000, 3996, 3992, 3988, 
-    3983, 3978, 3973, 3968, 3963, 3957, 3951, 3945, 3939, 3932, 
-    3925, 3919, 3911, 3904, 3896, 3888, 3880, 3872, 3863, 3855, 
-    3846, 3837, 3827, 3818, 3808, 3798, 3788, 3777, 3767, 3756, 
-    3745, 3733, 3722, 3710, 3699, 3687, 3674, 3662, 3649, 3637, 
-    3624, 3610, 3597, 3584, 3570, 3556, 3542, 3528, 3513, 3499, 
-    3484, 3469, 3454, 3439, 3423, 3408, 3392, 3376, 3360, 3344, 
-    3327, 3311, 3294, 3277, 3260, 3243, 3225, 3208, 3190, 3172, 
-    3154, 3136, 3118, 3099, 3080, 3062, 3043, 3023, 3004, 2985, 
-    2965, 2945, 2925, 2905, 2885, 2865, 2844, 2823, 2802, 2781, 
-    2760, 2739, 2717, 2696, 2674, 2652, 2630, 2607, 2585, 2562, 
-    2540, 2517, 2494, 2471, 2448, 2424, 2401, 2377, 2353, 2329, 
-    2305, 2281, 2257, 2232, 2208, 2183, 2158, 2133, 2108, 2083, 
-    2057, 2032, 2006, 1980, 1955, 1929, 1903, 1877, 1851, 1824, 
-    1798, 1771, 1745, 1718, 1691, 1664, 1637, 1610, 1583, 1556, 
-    1528, 1501, 1473, 1446, 1418, 1390, 1362, 1334, 1306, 1278, 
-    1250, 1222, 1193, 1165, 1137, 1108, 1079, 1051, 1022, 993, 
-    964, 935, 906, 877, 848, 819, 790, 760, 731, 702, 
-    672, 643, 613, 584, 555, 525, 496, 466, 437, 407, 
-    378, 348, 319, 289, 260, 230, 201, 172, 142, 113, 
-    83, 54, 25, -5, -34, -63, -92, -122, -151, -180, 
-    -209, -238, -268, -297, -326, -355, -384, -413, -442, -470, 
-    -499, -528, -557, -586, -614, -643, -672, -700, -729, -757, 
-    -786, -814, -843, -871, -899, -928, -956, -984, -1012, -1041, 
-    -1069, -1096, -1124, -1152, -1180, -1207, -1235, -1262, -1290, -1317, 
-    -1344, -1371, -1398, -1425, -1452, -1479, -1506, -1532, -1559, -1585, 
-    -1612, -1638, -1664, -1690, -1716, -1742, -1767, -1793, -1818, -1844, 
-    -1869, -1894, -1919, -1944, -1968, -1993, -2018, -2042, -2066, -2090, 
-    -2114, -2138, -2162, -2186, -2209, -2232, -2256, -2279, -2302, -2325, 
-    -2347, -2370, -2392, -2415, -2437, -2459, -2481, -2503, -2524, -2546, 
-    -2567, -2588, -2609, -2630, -2650, -2671, -2691, -2711, -2731, -2751, 
-    -2771, -2790, -2810, -2829, -2848, -2867, -2885, -2904, -2922, -2941, 
-    -2959, -2977, -2994, -3012, -3029, -3046, -3063, -3080, -3097, -3114, 
-    -3130, -3146, -3162, -3178, -3194, -3209, -3224, -3239, -3254, -3269, 
-    -3283, -3298, -3312, -3326, -3340, -3353, -3366, -3380, -3393, -3405, 
-    -3418, -3430, -3442, -3454, -3466, -3478, -3489, -3500, -3511, -3522, 
-    -3533, -3543, -3553, -3563, -3573, -3583, -3592, -3601, -3610, -3619, 
-    -3627, -3636, -3644, -3652, -3659, -3667, -3674, -3681, -3688, -3695, 
-    -3701, -3708, -3714, -3720, -3725, -3731, -3736, -3741, -3746, -3751, 
-    -3755, -3760, -3764, -3768, -3771, -3775, -3778, -3781, -3784, -3787, 
-    -3789, -3792, -3794, -3796, -3798, -3799, -3801, -3802, -3803, -3803, 
-    -3804, -3804, -3805, -3805, -3804, -3804, -3803, -3803, -3802, -3801, 
-    -3799, -3798, -3796, -3794, -3792, -3790, -3787, -3784, -3781, -3778, 
-    -3775, -3772, -3768, -3764, -3760, -3756, -3751, -3746, -3742, -3737, 
-    -3731, -3726, -3720, -3714, -3708, -3702, -3695, -3689, -3682, -3675, 
-    -3667, -3660, -3652, -3644, -3636, -3628, -3619, -3611, -3602, -3593, 
-    -3583, -3574, -3564, -3554, -3544, -3534, -3524, -3513, -3502, -3491, 
-    -3480, -3469, -3457, -3446, -3434, -3422, -3410, -3397, -3385, -3372, 
-    -3359, -3346, -3333, -3319, -3306, -3292, -3278, -3264, -3250, -3236, 
-    -3222, -3207, -3192, -3177, -3162, -3147, -3131, -3116, -3100, -3084, 
-    -3068, -3052, -3036, -3019, -3003, -2986, -2969, -2952, -2935, -2918, 
-    -2900, -2883, -2865, -2847, -2829, -2811, -2793, -2774, -2756, -2737, 
-    -2718, -2699, -2680, -2660, -2641, -2621, -2601, -2582, -2562, -2541, 
-    -2521, -2501, -2480, -2459, -2438, -2418, -2396, -2375, -2354, -2332, 
-    -2311, -2289, -2267, -2245, -2223, -2201, -2178, -2156, -2133, -2110, 
-    -2088, -2065, -2042, -2018, -1995, -1972, -1948, -1925, -1901, -1877, 
-    -1853, -1829, -1805, -1781, -1757, -1732, -1708, -1683, -1658, -1634, 
-    -1609, -1584, -1559, -1534, -1509, -1483, -1458, -1433, -1407, -1382, 
-    -1356, -1330, -1305, -1279, -1253, -1227, -1201, -1175, -1148, -1122, 
-    -1096, -1069, -1043, -1016, -990, -963, -936, -909, -883, -856, 
-    -829, -802, -775, -748, -721, -693, -666, -639, -612, -585, 
-    -557, -530, -503, -476, -448, -421, -394, -366, -339, -312, 
-    -284, -257, -230, -202, -175, -148, -121, -93, -66, -39, 
-    -12, 15, 43, 70, 97, 124, 151, 178, 205, 232, 
-    259, 286, 313, 340, 367, 393, 420, 447, 474, 500, 
-    527, 553, 580, 607, 633, 660, 686, 712, 739, 765, 
-    791, 818, 844, 870, 896, 922, 948, 974, 1000, 1026, 
-    1052, 1078, 1103, 1129, 1154, 1180, 1205, 1231, 1256, 1281, 
-    1306, 1331, 1356, 1381, 1405, 1430, 1454, 1479, 1503, 1528, 
-    1552, 1576, 1600, 1624, 1648, 1671, 1695, 1718, 1742, 1765, 
-    1788, 1811, 1834, 1857, 1880, 1902, 1925, 1947, 1969, 1991, 
-    2013, 2035, 2057, 2079, 2100, 2122, 2143, 2164, 2186, 2207, 
-    2227, 2248, 2269, 2289, 2310, 2330, 2350, 2370, 2390, 2409, 
-    2429, 2448, 2468, 2487, 2506, 2524, 2543, 2561, 2580, 2598, 
-    2616, 2634, 2652, 2669, 2687, 2704, 2721, 2738, 2755, 2771, 
-    2788, 2804, 2821, 2837, 2853, 2868, 2884, 2899, 2915, 2930, 
-    2945, 2959, 2974, 2988, 3003, 3017, 3031, 3045, 3058, 3072, 
-    3085, 3098, 3111, 3124, 3136, 3149, 3161, 3173, 3185, 3197, 
-    3208, 3220, 3231, 3242, 3252, 3263, 3273, 3284, 3294, 3304, 
-    3313, 3323, 3332, 3341, 3350, 3359, 3367, 3376, 3384, 3392, 
-    3400, 3407, 3415, 3422, 3429, 3436, 3442, 3449, 3455, 3461, 
-    3467, 3473, 3478, 3484, 3489, 3494, 3499, 3504, 3508, 3512, 
-    3516, 3520, 3524, 3528, 3531, 3534, 3537, 3540, 3543, 3545, 
-    3547, 3549, 3551, 3553, 3555, 3556, 3557, 3558, 3559, 3560, 
-    3560, 3561, 3561, 3561, 3560, 3560, 3559, 3559, 3558, 3556, 
-    3555, 3554, 3552, 3550, 3548, 3546, 3544, 3541, 3538, 3535, 
-    3532, 3529, 3526, 3522, 3518, 3514, 3510, 3506, 3501, 3496, 
-    3491, 3486, 3481, 3475, 3470, 3464, 3458, 3452, 3445, 3439, 
-    3432, 3425, 3418, 3410, 3403, 3395, 3387, 3379, 3371, 3363, 
-    3354, 3345, 3336, 3327, 3318, 3308, 3299, 3289, 3279, 3269, 
-    3259, 3248, 3237, 3227, 3216, 3204, 3193, 3182, 3170, 3158, 
-    3146, 3134, 3122, 3110, 3097, 3084, 3072, 3059, 3045, 3032, 
-    3019, 3005, 2992, 2978, 2964, 2950, 2935, 2921, 2906, 2892, 
-    2877, 2862, 2847, 2831, 2816, 2800, 2785, 2769, 2753, 2737, 
-    2721, 2704, 2688, 2671, 2655, 2638, 2621, 2604, 2586, 2569, 
-    2551, 2534, 2516, 2498, 2480, 2462, 2444, 2425, 2407, 2388, 
-    2369, 2350, 2331, 2312, 2293, 2273, 2254, 2234, 2214, 2194, 
-    2174, 2154, 2134, 2113, 2093, 2072, 2052, 2031, 2010, 1989, 
-    1968, 1946, 1925, 1904, 1882, 1860, 1839, 1817, 1795, 1773, 
-    1751, 1729, 1706, 1684, 1661, 1639, 1616, 1593, 1571, 1548, 
-    1525, 1502, 1479, 1456, 1432, 1409, 1386, 1362, 1338, 1315, 
-    1291, 1268, 1244, 1220, 1196, 1172, 1148, 1124, 1100, 1075, 
-    1051, 1027, 1002, 978, 953, 929, 904, 879, 854, 830, 
-    805, 780, 755, 730, 705, 680, 655, 630, 605, 579, 
-    554, 529, 504, 478, 453, 428, 403, 377, 352, 327, 
-    302, 276, 251, 226, 200, 175, 150, 125, 100, 74, 
-    49, 24, -1, -26, -51, -76, -102, -127, -152, -177, 
-    -202, -227, -252, -276, -301, -326, -351, -376, -401, -425, 
-    -450, -475, -499, -524, -549, -573, -598, -622, -646, -671, 
-    -695, -719, -744, -768, -792, -816, -841, -865, -889, -913, 
-    -937, -960, -984, -1008, -1032, -1055, -1079, -1102, -1126, -1149, 
-    -1172, -1196, -1219, -1242, -1265, -1288, -1310, -1333, -1356, -1378, 
-    -1401, -1423, -1446, -1468, -1490, -1512, -1534, -1556, -1578, -1599, 
-    -1621, -1642, -1664, -1685, -1706, -1727, -1748, -1769, -1790, -1810, 
-    -1831, -1851, -1872, -1892, -1912, -1932, -1952, -1972, -1991, -2011, 
-    -2030, -2050, -2069, -2088, -2107, -2126, -2145, -2163, -2182, -2200, 
-    -2219, -2237, -2255, -2273, -2290, -2308, -2326, -2343, -2360, -2377, 
-    -2394, -2411, -2428, -2444, -2460, -2477, -2493, -2509, -2524, -2540, 
-    -2556, -2571, -2586, -2601, -2616, -2631, -2646, -2660, -2675, -2689, 
-    -2703, -2717, -2731, -2744, -2758, -2771, -2785, -2798, -2810, -2823, 
-    -2836, -2848, -2861, -2873, -2885, -2896, -2908, -2920, -2931, -2942, 
-    -2953, -2964, -2975, -2985, -2996, -3006, -3016, -3026, -3035, -3045, 
-    -3054, -3063, -3072, -3081, -3090, -3098, -3106, -3114, -3122, -3130, 
-    -3138, -3145, -3153, -3160, -3167, -3173, -3180, -3186, -3193, -3199, 
-    -3205, -3210, -3216, -3221, -3227, -3232, -3237, -3241, -3246, -3250, 
-    -3255, -3259, -3263, -3266, -3270, -3273, -3276, -3280, -3282, -3285, 
-    -3288, -3290, -3292, -3294, -3296, -3298, -3300, -3301, -3302, -3303, 
-    -3304, -3305, -3305, -3306, -3306, -3306, -3306, -3306, -3305, -3305, 
-    -3304, -3303, -3302, -3301, -3299, -3298, -3296, -3294, -3292, -3290, 
-    -3288, -3285, -3282, -3280, -3277, -3273, -3270, -3266, -3263, -3259, 
-    -3255, -3251, -3246, -3242, -3237, -3232, -3227, -3222, -3217, -3211, 
-    -3205, -3200, -3194, -3187, -3181, -3174, -3168, -3161, -3154, -3147, 
-    -3139, -3132, -3124, -3116, -3108, -3100, -3092, -3083, -3075, -3066, 
-    -3057, -3048, -3039, -3029, -3020, -3010, -3000, -2990, -2980, -2969, 
-    -2959, -2948, -2937, -2927, -2916, -2904, -2893, -2882, -2870, -2858, 
-    -2846, -2834, -2822, -2810, -2798, -2785, -2772, -2760, -2747, -2734, 
-    -2720, -2707, -2694, -2680, -2666, -2652, -2638, -2624, -2610, -2596, 
-    -2581, -2567, -2552, -2537, -2522, -2507, -2492, -2477, -2461, -2446, 
-    -2430, -2414, -2398, -2382, -2366, -2350, -2333, -2317, -2300, -2283, 
-    -2267, -2250, -2233, -2215, -2198, -2181, -2163, -2145, -2128, -2110, 
-    -2092, -2074, -2055, -2037, -2019, -2000, -1982, -1963, -1944, -1925, 
-    -1906, -1887, -1868, -1849, -1829, -1810, -1790, -1771, -1751, -1731, 
-    -1711, -1691, -1671, -1651, -1630, -1610, -1590, -1569, -1549, -1528, 
-    -1507, -1486, -1465, -1445, -1424, -1402, -1381, -1360, -1339, -1317, 
-    -1296, -1275, -1253, -1231, -1210, -1188, -1166, -1145, -1123, -1101, 
-    -1079, -1057, -1035, -1012, -990, -968, -946, -923, -901, -879, 
-    -856, -833, -811, -788, -766, -743, -720, -697, -675, -652, 
-    -629, -606, -583, -560, -537, -514, -491, -468, -445, -422, 
-    -399, -375, -352, -329, -306, -283, -260, -237, -214, -191, 
-    -167, -144, -121, -98, -75, -52, -29, -6, 17, 40, 
-    63, 86, 109, 132, 154, 177, 200, 223, 246, 269, 
-    291, 314, 337, 359, 382, 405, 427, 450, 472, 495, 
-    517, 540, 562, 585, 607, 629, 651, 674, 696, 718, 
-    740, 762, 784, 806, 828, 850, 872, 893, 915, 937, 
-    958, 980, 1001, 1023, 1044, 1066, 1087, 1108, 1129, 1150, 
-    1171, 1192, 1213, 1233, 1254, 1275, 1295, 1316, 1336, 1356, 
-    1377, 1397, 1417, 1437, 1456, 1476, 1496, 1516, 1535, 1555, 
-    1574, 1593, 1612, 1631, 1650, 1669, 1688, 1706, 1725, 1743, 
-    1762, 1780, 1798, 1816, 1834, 1852, 1870, 1887, 1905, 1923, 
-    1940, 1957, 1974, 1991, 2008, 2025, 2042, 2058, 2075, 2091, 
-    2108, 2124, 2140, 2155, 2171, 2187, 2202, 2218, 2233, 2248, 
-    2263, 2278, 2292, 2307, 2322, 2336, 2350, 2364, 2378, 2392, 
-    2406, 2419, 2433, 2446, 2459, 2472, 2485, 2498, 2510, 2523, 
-    2535, 2547, 2559, 2571, 2583, 2595, 2606, 2618, 2629, 2640, 
-    2651, 2662, 2672, 2683, 2693, 2704, 2714, 2724, 2733, 2743, 
-    2753, 2762, 2771, 2780, 2789, 2798, 2806, 2815, 2823, 2831, 
-    2839, 2847, 2855, 2862, 2869, 2877, 2884, 2891, 2897, 2904, 
-    2910, 2916, 2923, 2928, 2934, 2940, 2945, 2951, 2956, 2961, 
-    2966, 2971, 2975, 2980, 2984, 2988, 2992, 2996, 3000, 3003, 
-    3007, 3010, 3013, 3016, 3018, 3021, 3024, 3026, 3028, 3030, 
-    3032, 3033, 3035, 3036, 3038, 3039, 3039, 3040, 3041, 3041, 
-    3042, 3042, 3042, 3042, 3041, 3041, 3040, 3040, 3039, 3038, 
-    3037, 3035, 3034, 3032, 3030, 3029, 3026, 3024, 3022, 3019, 
-    3017, 3014, 3011, 3008, 3005, 3001, 2998, 2994, 2990, 2986, 
-    2982, 2978, 2973, 2969, 2964, 2959, 2954, 2949, 2943, 2938, 
-    2932, 2926, 2920, 2914, 2908, 2902, 2895, 2888, 2881, 2874, 
-    2867, 2860, 2853, 2845, 2837, 2830, 2822, 2813, 2805, 2797, 
-    2788, 2779, 2771, 2762, 2752, 2743, 2734, 2724, 2715, 2705, 
-    2695, 2685, 2675, 2664, 2654, 2643, 2633, 2622, 2611, 2600, 
-    2589, 2577, 2566, 2555, 2543, 2531, 2519, 2507, 2495, 2483, 
-    2470, 2458, 2445, 2432, 2420, 2407, 2394, 2380, 2367, 2354, 
-    2340, 2326, 2313, 2299, 2285, 2271, 2257, 2242, 2228, 2213, 
-    2199, 2184, 2169, 2154, 2139, 2124, 2109, 2093, 2078, 2062, 
-    2047, 2031, 2015, 1999, 1983, 1967, 1951, 1935, 1918, 1902, 
-    1885, 1868, 1851, 1835, 1818, 1800, 1783, 1766, 1749, 1731, 
-    1714, 1696, 1678, 1661, 1643, 1625, 1607, 1589, 1571, 1552, 
-    1534, 1516, 1497, 1479, 1460, 1441, 1423, 1404, 1385, 1366, 
-    1347, 1328, 1309, 1290, 1270, 1251, 1232, 1212, 1193, 1173, 
-    1154, 1134, 1115, 1095, 1075, 1055, 1035, 1016, 996, 976, 
-    956, 936, 915, 895, 875, 855, 834, 814, 794, 773, 
-    753, 732, 712, 691, 671, 650, 629, 609, 588, 567, 
-    547, 526, 505, 484, 463, 443, 422, 401, 380, 359, 
-    338, 317, 296, 275, 254, 233, 212, 192, 171, 150, 
-    129, 108, 87, 66, 45, 24, 4, -17, -38, -59, 
-    -80, -100, -121, -142, -163, -183, -204, -225, -246, -266, 
-    -287, -307, -328, -348, -369, -389, -410, -430, -451, -471, 
-    -491, -512, -532, -552, -572, -592, -613, -633, -653, -673, 
-    -692, -712, -732, -752, -772, -791, -811, -831, -850, -870, 
-    -889, -909, -928, -947, -967, -986, -1005, -1024, -1043, -1062, 
-    -1081, -1100, -1119, -1137, -1156, -1174, -1193, -1211, -1230, -1248, 
-    -1266, -1284, -1302, -1320, -1338, -1356, -1374, -1391, -1409, -1426, 
-    -1444, -1461, -1478, -1495, -1512, -1529, -1546, -1563, -1580, -1596, 
-    -1613, -1629, -1646, -1662, -1678, -1694, -1710, -1726, -1742, -1757, 
-    -1773, -1789, -1804, -1819, -1834, -1850, -1865, -1879, -1894, -1909, 
-    -1924, -1938, -1952, -1967, -1981, -1995, -2009, -2023, -2036, -2050, 
-    -2063, -2077, -2090, -2103, -2116, -2129, -2142, -2154, -2167, -2179, 
-    -2192, -2204, -2216, -2228, -2239, -2251, -2263, -2274, -2285, -2297, 
-    -2308, -2318, -2329, -2340, -2351, -2361, -2371, -2382, -2392, -2402, 
-    -2411, -2421, -2431, -2440, -2449, -2459, -2468, -2477, -2485, -2494, 
-    -2503, -2511, -2519, -2527, -2535, -2543, -2551, -2558, -2566, -2573, 
-    -2580, -2587, -2594, -2601, -2607, -2614, -2620, -2626, -2632, -2638, 
-    -2644, -2650, -2655, -2661, -2666, -2671, -2676, -2681, -2685, -2690, 
-    -2694, -2699, -2703, -2707, -2711, -2714, -2718, -2721, -2725, -2728, 
-    -2731, -2734, -2736, -2739, -2742, -2744, -2746, -2748, -2750, -2752, 
-    -2754, -2755, -2757, -2758, -2759, -2760, -2761, -2761, -2762, -2762, 
-    -2763, -2763, -2763, -2763, -2763, -2762, -2762, -2761, -2760, -2759, 
-    -2758, -2757, -2756, -2754, -2753, -2751, -2749, -2747, -2745, -2743, 
-    -2741, -2738, -2736, -2733, -2730, -2727, -2724, -2720, -2717, -2713, 
-    -2710, -2706, -2702, -2698, -2694, -2689, -2685, -2680, -2675, -2670, 
-    -2665, -2660, -2655, -2649, -2644, -2638, -2632, -2626, -2620, -2614, 
-    -2608, -2601, -2595, -2588, -2581, -2574, -2567, -2560, -2553, -2545, 
-    -2537, -2530, -2522, -2514, -2506, -2498, -2489, -2481, -2472, -2464, 
-    -2455, -2446, -2437, -2428, -2418, -2409, -2399, -2390, -2380, -2370, 
-    -2360, -2350, -2340, -2330, -2320, -2309, -2298, -2288, -2277, -2266, 
-    -2255, -2244, -2233, -2221, -2210, -2198, -2186, -2175, -2163, -2151, 
-    -2139, -2126, -2114, -2102, -2089, -2077, -2064, -2051, -2038, -2025, 
-    -2012, -1999, -1986, -1973, -1959, -1946, -1932, -1918, -1904, -1890, 
-    -1876, -1862, -1848, -1834, -1820, -1805, -1791, -1776, -1761, -1747, 
-    -1732, -1717, -1702, -1687, -1671, -1656, -1641, -1625, -1610, -1594, 
-    -1579, -1563, -1547, -1532, -1516, -1500, -1484, -1467, -1451, -1435, 
-    -1419, -1402, -1386, -1369, -1353, -1336, -1319, -1302, -1286, -1269, 
-    -1252, -1235, -1218, -1201, -1183, -1166, -1149, -1132, -1114, -1097, 
-    -1079, -1062, -1044, -1027, -1009, -991, -974, -956, -938, -920, 
-    -902, -885, -867, -849, -831, -813, -794, -776, -758, -740, 
-    -722, -704, -685, -667, -649, -630, -612, -593, -575, -557, 
-    -538, -520, -501, -483, -464, -445, -427, -408, -390, -371, 
-    -352, -334, -315, -297, -278, -259, -241, -222, -203, -185, 
-    -166, -147, -128, -110, -91, -72, -54, -35, -16, 2, 
-    21, 39, 58, 77, 95, 114, 132, 151, 169, 188, 
-    206, 225, 243, 262, 280, 298, 317, 335, 354, 372, 
-    390, 408, 427, 445, 463, 481, 499, 517, 535, 553, 
-    571, 589, 607, 624, 642, 660, 677, 695, 713, 730, 
-    748, 765, 783, 800, 817, 834, 852, 869, 886, 903, 
-    920, 937, 954, 971, 987, 1004, 1021, 1037, 1054, 1070, 
-    1087, 1103, 1119, 1135, 1152, 1168, 1184, 1200, 1215, 1231, 
-    1247, 1263, 1278, 1294, 1309, 1324, 1340, 1355, 1370, 1385, 
-    1400, 1415, 1430, 1445, 1459, 1474, 1488, 1503, 1517, 1532, 
-    1546, 1560, 1574, 1588, 1601, 1615, 1629, 1642, 1656, 1669, 
-    1683, 1696, 1709, 1722, 1735, 1747, 1760, 1773, 1785, 1798, 
-    1810, 1822, 1835, 1847, 1858, 1870, 1882, 1894, 1905, 1917, 
-    1928, 1939, 1950, 1961, 1972, 1983, 1993, 2004, 2014, 2025, 
-    2035, 2045, 2055, 2065, 2075, 2084, 2094, 2103, 2113, 2122, 
-    2131, 2140, 2149, 2158, 2166, 2175, 2183, 2192, 2200, 2208, 
-    2216, 2224, 2232, 2239, 2247, 2254, 2261, 2268, 2275, 2282, 
-    2289, 2296, 2302, 2309, 2315, 2321, 2327, 2333, 2339, 2345, 
-    2350, 2356, 2361, 2366, 2372, 2377, 2381, 2386, 2391, 2395, 
-    2400, 2404, 2408, 2412, 2416, 2420, 2423, 2427, 2430, 2434, 
-    2437, 2440, 2443, 2446, 2448, 2451, 2453, 2455, 2458, 2460, 
-    2462, 2463, 2465, 2467, 2468, 2470, 2471, 2472, 2473, 2474, 
-    2474, 2475, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 2476, 
-    2475, 2475, 2474, 2473, 2472, 2471, 2470, 2469, 2467, 2466, 
-    2464, 2462, 2460, 2458, 2456, 2454, 2452, 2449, 2447, 2444, 
-    2441, 2438, 2435, 2432, 2429, 2425, 2422, 2418, 2414, 2410, 
-    2406, 2402, 2398, 2394, 2389, 2385, 2380, 2375, 2370, 2365, 
-    2360, 2355, 2349, 2344, 2338, 2333, 2327, 2321, 2315, 2309, 
-    2302, 2296, 2289, 2283, 2276, 2269, 2262, 2255, 2248, 2241, 
-    2234, 2226, 2219, 2211, 2203, 2195, 2187, 2179, 2171, 2163, 
-    2154, 2146, 2137, 2129, 2120, 2111, 2102, 2093, 2084, 2074, 
-    2065, 2056, 2046, 2036, 2026, 2017, 2007, 1997, 1986, 1976, 
-    1966, 1955, 1945, 1934, 1924, 1913, 1902, 1891, 1880, 1869, 
-    1858, 1846, 1835, 1824, 1812, 1800, 1789, 1777, 1765, 1753, 
-    1741, 1729, 1716, 1704, 1692, 1679, 1667, 1654, 1641, 1629, 
-    1616, 1603, 1590, 1577, 1564, 1551, 1537, 1524, 1511, 1497, 
-    1484, 1470, 1456, 1443, 1429, 1415, 1401, 1387, 1373, 1359, 
-    1345, 1331, 1316, 1302, 1287, 1273, 1258, 1244, 1229, 1215, 
-    1200, 1185, 1170, 1155, 1140, 1125, 1110, 1095, 1080, 1065, 
-    1049, 1034, 1019, 1004, 988, 973, 957, 942, 926, 911, 
-    895, 879, 864, 848, 832, 816, 800, 785, 769, 753, 
-    737, 721, 705, 689, 673, 657, 640, 624, 608, 592, 
-    576, 560, 543, 527, 511, 494, 478, 462, 445, 429, 
-    413, 396, 380, 363, 347, 331, 314, 298, 281, 265, 
-    248, 232, 215, 199, 182, 166, 149, 133, 116, 100, 
-    84, 67, 51, 34, 18, 1, -15, -31, -48, -64, 
-    -81, -97, -113, -130, -146, -162, -179, -195, -211, -227, 
-    -244, -260, -276, -292, -308, -324, -340, -356, -372, -388, 
-    -404, -420, -436, -452, -468, -484, -499, -515, -531, -547, 
-    -562, -578, -593, -609, -624, -640, -655, -670, -686, -701, 
-    -716, -731, -746, -762, -777, -792, -807, -821, -836, -851, 
-    -866, -880, -895, -910, -924, -939, -953, -967, -982, -996, 
-    -1010, -1024, -1038, -1052, -1066, -1080, -1094, -1108, -1121, -1135, 
-    -1149, -1162, -1175, -1189, -1202, -1215, -1229, -1242, -1255, -1268, 
-    -1281, -1293, -1306, -1319, -1331, -1344, -1356, -1369, -1381, -1393, 
-    -1406, -1418, -1430, -1441, -1453, -1465, -1477, -1488, -1500, -1511, 
-    -1523, -1534, -1545, -1556, -1567, -1578, -1589, -1600, -1610, -1621, 
-    -1632, -1642, -1652, -1662, -1673, -1683, -1693, -1702, -1712, -1722, 
-    -1731, -1741, -1750, -1760, -1769, -1778, -1787, -1796, -1805, -1814, 
-    -1822, -1831, -1839, -1847, -1856, -1864, -1872, -1880, -1888, -1895, 
-    -1903, -1911, -1918, -1925, -1933, -1940, -1947, -1954, -1961, -1967, 
-    -1974, -1980, -1987, -1993, -1999, -2006, -2012, -2017, -2023, -2029, 
-    -2035, -2040, -2045, -2051, -2056, -2061, -2066, -2071, -2076, -2080, 
-    -2085, -2089, -2094, -2098, -2102, -2106, -2110, -2114, -2118, -2121, 
-    -2125, -2128, -2131, -2134, -2138, -2141, -2143, -2146, -2149, -2151, 
-    -2154, -2156, -2158, -2161, -2163, -2164, -2166, -2168, -2170, -2171, 
-    -2172, -2174, -2175, -2176, -2177, -2178, -2179, -2179, -2180, -2180, 
-    -2181, -2181, -2181, -2181, -2181, -2181, -2180, -2180, -2180, -2179, 
-    -2178, -2178, -2177, -2176, -2175, -2173, -2172, -2171, -2169, -2168, 
-    -2166, -2164, -2162, -2160, -2158, -2156, -2153, -2151, -2148, -2146, 
-    -2143, -2140, -2137, -2134, -2131, -2128, -2124, -2121, -2117, -2114, 
-    -2110, -2106, -2102, -2098, -2094, -2090, -2085, -2081, -2076, -2072, 
-    -2067, -2062, -2057, -2052, -2047, -2042, -2036, -2031, -2026, -2020, 
-    -2014, -2008, -2003, -1997, -1990, -1984, -1978, -1972, -1965, -1959, 
-    -1952, -1945, -1938, -1932, -1925, -1918, -1910, -1903, -1896, -1888, 
-    -1881, -1873, -1866, -1858, -1850, -1842, -1834, -1826, -1818, -1809, 
-    -1801, -1793, -1784, -1775, -1767, -1758, -1749, -1740, -1731, -1722, 
-    -1713, -1704, -1694, -1685, -1676, -1666, -1656, -1647, -1637, -1627, 
-    -1617, -1607, -1597, -1587, -1577, -1566, -1556, -1546, -1535, -1525, 
-    -1514, -1503, -1492, -1482, -1471, -1460, -1449, -1438, -1426, -1415, 
-    -1404, -1393, -1381, -1370, -1358, -1347, -1335, -1323, -1312, -1300, 
-    -1288, -1276, -1264, -1252, -1240, -1228, -1215, -1203, -1191, -1178, 
-    -1166, -1154, -1141, -1128, -1116, -1103, -1090, -1078, -1065, -1052, 
-    -1039, -1026, -1013, -1000, -987, -974, -961, -948, -935, -921, 
-    -908, -895, -881, -868, -855, -841, -828, -814, -801, -787, 
-    -773, -760, -746, -732, -719, -705, -691, -677, -663, -650, 
-    -636, -622, -608, -594, -580, -566, -552, -538, -524, -510, 
-    -496, -482, -468, -454, -440, -425, -411, -397, -383, -369, 
-    -354, -340, -326, -312, -298, -283, -269, -255, -241, -226, 
-    -212, -198, -184, -169, -155, -141, -127, -112, -98, -84, 
-    -70, -55, -41, -27, -13, 1, 16, 30, 44, 58, 
-    72, 86, 101, 115, 129, 143, 157, 171, 185, 199, 
-    213, 227, 241, 255, 269, 283, 296, 310, 324, 338, 
-    352, 365, 379, 393, 406, 420, 434, 447, 461, 474, 
-    487, 501, 514, 528, 541, 554, 568, 581, 594, 607, 
-    620, 633, 646, 659, 672, 685, 698, 711, 723, 736, 
-    749, 761, 774, 786, 799, 811, 824, 836, 848, 861, 
-    873, 885, 897, 909, 921, 933, 945, 957, 968, 980, 
-    992, 1003, 1015, 1026, 1038, 1049, 1061, 1072, 1083, 1094, 
-    1105, 1116, 1127, 1138, 1149, 1160, 1170, 1181, 1192, 1202, 
-    1213, 1223, 1233, 1243, 1254, 1264, 1274, 1284, 1294, 1303, 
-    1313, 1323, 1332, 1342, 1351, 1361, 1370, 1379, 1389, 1398, 
-    1407, 1416, 1424, 1433, 1442, 1451, 1459, 1468, 1476, 1484, 
-    1493, 1501, 1509, 1517, 1525, 1533, 1540, 1548, 1556, 1563, 
-    1570, 1578, 1585, 1592, 1599, 1606, 1613, 1620, 1627, 1633, 
-    1640, 1646, 1653, 1659, 1665, 1672, 1678, 1684, 1689, 1695, 
-    1701, 1707, 1712, 1718, 1723, 1728, 1733, 1738, 1744, 1748, 
-    1753, 1758, 1763, 1767, 1772, 1776, 1780, 1785, 1789, 1793, 
-    1797, 1801, 1804, 1808, 1811, 1815, 1818, 1822, 1825, 1828, 
-    1831, 1834, 1837, 1840, 1842, 1845, 1847, 1850, 1852, 1854, 
-    1856, 1859, 1860, 1862, 1864, 1866, 1867, 1869, 1870, 1872, 
-    1873, 1874, 1875, 1876, 1877, 1878, 1878, 1879, 1880, 1880, 
-    1880, 1881, 1881, 1881, 1881, 1881, 1880, 1880, 1880, 1879, 
-    1879, 1878, 1878, 1877, 1876, 1875, 1874, 1873, 1871, 1870, 
-    1869, 1867, 1866, 1864, 1862, 1860, 1858, 1856, 1854, 1852, 
-    1850, 1847, 1845, 1842, 1840, 1837, 1834, 1831, 1828, 1825, 
-    1822, 1819, 1816, 1812, 1809, 1805, 1801, 1798, 1794, 1790, 
-    1786, 1782, 1778, 1773, 1769, 1765, 1760, 1756, 1751, 1746, 
-    1741, 1737, 1732, 1727, 1721, 1716, 1711, 1706, 1700, 1695, 
-    1689, 1683, 1678, 1672, 1666, 1660, 1654, 1648, 1642, 1635, 
-    1629, 1623, 1616, 1609, 1603, 1596, 1589, 1582, 1576, 1569, 
-    1562, 1554, 1547, 1540, 1533, 1525, 1518, 1510, 1503, 1495, 
-    1487, 1479, 1471, 1464, 1455, 1447, 1439, 1431, 1423, 1414, 
-    1406, 1398, 1389, 1380, 1372, 1363, 1354, 1346, 1337, 1328, 
-    1319, 1310, 1301, 1291, 1282, 1273, 1264, 1254, 1245, 1235, 
-    1226, 1216, 1206, 1197, 1187, 1177, 1167, 1157, 1148, 1138, 
-    1127, 1117, 1107, 1097, 1087, 1077, 1066, 1056, 1045, 1035, 
-    1024, 1014, 1003, 993, 982, 971, 961, 950, 939, 928, 
-    917, 906, 895, 884, 873, 862, 851, 840, 829, 818, 
-    806, 795, 784, 772, 761, 750, 738, 727, 715, 704, 
-    692, 681, 669, 658, 646, 634, 623, 611, 599, 588, 
-    576, 564, 552, 541, 529, 517, 505, 493, 482, 470, 
-    458, 446, 434, 422, 410, 398, 386, 374, 362, 350, 
-    338, 326, 314, 302, 290, 278, 266, 254, 242, 230, 
-    218, 206, 194, 182, 170, 157, 145, 133, 121, 109, 
-    97, 85, 73, 61, 49, 37, 25, 13, 1, -11, 
-    -23, -35, -47, -58, -70, -82, -94, -106, -118, -130, 
-    -142, -153, -165, -177, -189, -201, -212, -224, -236, -247, 
-    -259, -271, -282, -294, -305, -317, -328, -340, -351, -363, 
-    -374, -385, -397, -408, -419, -431, -442, -453, -464, -475, 
-    -486, -497, -508, -519, -530, -541, -552, -563, -574, -585, 
-    -595, -606, -617, -627, -638, -648, -659, -669, -680, -690, 
-    -700, -711, -721, -731, -741, -751, -761, -772, -782, -792, 
-    -801, -811, -821, -831, -840, -850, -860, -869, -879, -888, 
-    -898, -907, -916, -926, -935, -944, -953, -962, -971, -980, 
-    -989, -998, -1007, -1015, -1024, -1033, -1041, -1050, -1058, -1067, 
-    -1075, -1083, -1091, -1099, -1107, -1115, -1123, -1131, -1139, -1147, 
-    -1155, -1162, -1170, -1177, -1185, -1192, -1200, -1207, -1214, -1221, 
-    -1228, -1235, -1242, -1249, -1256, -1263, -1269, -1276, -1282, -1289, 
-    -1295, -1301, -1308, -1314, -1320, -1326, -1332, -1338, -1344, -1350, 
-    -1355, -1361, -1366, -1372, -1377, -1383, -1388, -1393, -1398, -1403, 
-    -1408, -1413, -1418, -1423, -1427, -1432, -1437, -1441, -1445, -1450, 
-    -1454, -1458, -1462, -1466, -1470, -1474, -1478, -1482, -1485, -1489, 
-    -1492, -1496, -1499, -1503, -1506, -1509, -1512, -1515, -1518, -1521, 
-    -1523, -1526, -1529, -1531, -1534, -1536, -1538, -1541, -1543, -1545, 
-    -1547, -1549, -1551, -1552, -1554, -1556, -1557, -1559, -1560, -1562, 
-    -1563, -1564, -1565, -1566, -1567, -1568, -1569, -1570, -1570, -1571, 
-    -1571, -1572, -1572, -1573, -1573, -1573, -1573, -1573, -1573, -1573, 
-    -1573, -1572, -1572, -1572, -1571, -1571, -1570, -1569, -1568, -1568, 
-    -1567, -1566, -1565, -1563, -1562, -1561, -1560, -1558, -1557, -1555, 
-    -1553, -1552, -1550, -1548, -1546, -1544, -1542, -1540, -1538, -1535, 
-    -1533, -1531, -1528, -1525, -1523, -1520, -1517, -1514, -1512, -1509, 
-    -1505, -1502, -1499, -1496, -1493, -1489, -1486, -1482, -1479, -1475, 
-    -1471, -1467, -1463, -1460, -1456, -1452, -1447, -1443, -1439, -1435, 
-    -1430, -1426, -1421, -1417, -1412, -1407, -1403, -1398, -1393, -1388, 
-    -1383, -1378, -1373, -1367, -1362, -1357, -1351, -1346, -1340, -1335, 
-    -1329, -1324, -1318, -1312, -1306, -1300, -1295, -1289, -1282, -1276, 
-    -1270, -1264, -1258, -1251, -1245, -1238, -1232, -1225, -1219, -1212, 
-    -1205, -1199, -1192, -1185, -1178, -1171, -1164, -1157, -1150, -1143, 
-    -1135, -1128, -1121, -1113, -1106, -1099, -1091, -1084, -1076, -1068, 
-    -1061, -1053, -1045, -1037, -1030, -1022, -1014, -1006, -998, -990, 
-    -982, -973, -965, -957, -949, -940, -932, -924, -915, -907, 
-    -898, -890, -881, -873, -864, -856, -847, -838, -829, -821, 
-    -812, -803, -794, -785, -776, -767, -758, -749, -740, -731, 
-    -722, -713, -704, -695, -685, -676, -667, -658, -648, -639, 
-    -630, -620, -611, -601, -592, -582, -573, -564, -554, -545, 
-    -535, -525, -516, -506, -497, -487, -477, -468, -458, -449, 
-    -439, -429, -419, -410, -400, -390, -381, -371, -361, -351, 
-    -342, -332, -322, -312, -302, -293, -283, -273, -263, -253, 
-    -243, -234, -224, -214, -204, -194, -184, -175, -165, -155, 
-    -145, -135, -125, -116, -106, -96, -86, -76, -67, -57, 
-    -47, -37, -28, -18, -8, 2, 11, 21, 31, 41, 
-    50, 60, 70, 79, 89, 99, 108, 118, 127, 137, 
-    146, 156, 165, 175, 184, 194, 203, 213, 222, 231, 
-    241, 250, 260, 269, 278, 287, 297, 306, 315, 324, 
-    333, 342, 351, 360, 369, 378, 387, 396, 405, 414, 
-    423, 432, 440, 449, 458, 467, 475, 484, 493, 501, 
-    510, 518, 527, 535, 544, 552, 560, 569, 577, 585, 
-    593, 601, 609, 617, 626, 634, 642, 650, 657, 665, 
-    673, 681, 689, 696, 704, 712, 719, 727, 734, 742, 
-    749, 756, 764, 771, 778, 785, 792, 800, 807, 814, 
-    820, 827, 834, 841, 848, 855, 861, 868, 874, 881, 
-    887, 894, 900, 907, 913, 919, 925, 931, 937, 943, 
-    949, 955, 961, 967, 973, 978, 984, 990, 995, 1001, 
-    1006, 1012, 1017, 1022, 1027, 1033, 1038, 1043, 1048, 1053, 
-    1058, 1062, 1067, 1072, 1076, 1081, 1086, 1090, 1095, 1099, 
-    1103, 1107, 1112, 1116, 1120, 1124, 1128, 1132, 1136, 1139, 
-    1143, 1147, 1150, 1154, 1157, 1161, 1164, 1168, 1171, 1174, 
-    1177, 1180, 1183, 1186, 1189, 1192, 1195, 1198, 1200, 1203, 
-    1205, 1208, 1210, 1213, 1215, 1217, 1220, 1222, 1224, 1226, 
-    1228, 1230, 1231, 1233, 1235, 1236, 1238, 1240, 1241, 1243, 
-    1244, 1245, 1246, 1248, 1249, 1250, 1251, 1252, 1252, 1253, 
-    1254, 1255, 1255, 1256, 1257, 1257, 1257, 1258, 1258, 1258, 
-    1258, 1259, 1259, 1259, 1259, 1258, 1258, 1258, 1258, 1257, 
-    1257, 1257, 1256, 1255, 1255, 1254, 1253, 1252, 1252, 1251, 
-    1250, 1249, 1248, 1247, 1245, 1244, 1243, 1241, 1240, 1238, 
-    1237, 1235, 1234, 1232, 1230, 1228, 1226, 1225, 1223, 1220, 
-    1218, 1216, 1214, 1212, 1209, 1207, 1205, 1202, 1200, 1197, 
-    1194, 1192, 1189, 1186, 1183, 1180, 1178, 1175, 1171, 1168, 
-    1165, 1162, 1159, 1155, 1152, 1149, 1145, 1142, 1138, 1134, 
-    1131, 1127, 1123, 1120, 1116, 1112, 1108, 1104, 1100, 1096, 
-    1091, 1087, 1083, 1079, 1074, 1070, 1066, 1061, 1057, 1052, 
-    1048, 1043, 1038, 1033, 1029, 1024, 1019, 1014, 1009, 1004, 
-    999, 994, 989, 984, 979, 973, 968, 963, 958, 952, 
-    947, 941, 936, 930, 925, 919, 913, 908, 902, 896, 
-    890, 884, 879, 873, 867, 861, 855, 849, 843, 837, 
-    830, 824, 818, 812, 806, 799, 793, 786, 780, 774, 
-    767, 761, 754, 748, 741, 735, 728, 721, 715, 708, 
-    701, 694, 688, 681, 674, 667, 660, 653, 647, 640, 
-    633, 626, 619, 612, 605, 598, 590, 583, 576, 569, 
-    562, 555, 547, 540, 533, 526, 518, 511, 504, 497, 
-    489, 482, 475, 467, 460, 452, 445, 438, 430, 423, 
-    415, 408, 400, 393, 385, 378, 370, 363, 355, 348, 
-    340, 333, 325, 318, 310, 303, 295, 287, 280, 272, 
-    265, 257, 249, 242, 234, 227, 219, 211, 204, 196, 
-    189, 181, 173, 166, 158, 151, 143, 135, 128, 120, 
-    113, 105, 98, 90, 82, 75, 67, 60, 52, 45, 
-    37, 30, 22, 15, 7, 0, -8, -15, -23, -30, 
-    -38, -45, -52, -60, -67, -74, -82, -89, -96, -104, 
-    -111, -118, -126, -133, -140, -147, -155, -162, -169, -176, 
-    -183, -190, -197, -204, -212, -219, -226, -233, -240, -246, 
-    -253, -260, -267, -274, -281, -288, -294, -301, -308, -315, 
-    -321, -328, -335, -341, -348, -355, -361, -368, -374, -381, 
-    -387, -393, -400, -406, -413, -419, -425, -431, -438, -444, 
-    -450, -456, -462, -468, -474, -480, -486, -492, -498, -504, 
-    -510, -516, -521, -527, -533, -539, -544, -550, -556, -561, 
-    -567, -572, -578, -583, -589, -594, -599, -604, -610, -615, 
-    -620, -625, -630, -635, -640, -645, -650, -655, -660, -665, 
-    -670, -675, -679, -684, -689, -693, -698, -702, -707, -711, 
-    -716, -720, -724, -729, -733, -737, -741, -745, -749, -754, 
-    -757, -761, -765, -769, -773, -777, -781, -784, -788, -792, 
-    -795, -799, -802, -806, -809, -812, -816, -819, -822, -825, 
-    -828, -831, -835, -838, -840, -843, -846, -849, -852, -855, 
-    -857, -860, -863, -865, -868, -870, -873, -875, -877, -880, 
-    -882, -884, -886, -888, -890, -892, -894, -896, -898, -900, 
-    -902, -904, -905, -907, -909, -910, -912, -913, -915, -916, 
-    -917, -919, -920, -921, -922, -923, -925, -926, -927, -928, 
-    -928, -929, -930, -931, -932, -932, -933, -934, -934, -935, 
-    -935, -936, -936, -936, -937, -937, -937, -937, -937, -937, 
-    -937, -937, -937, -937, -937, -937, -937, -936, -936, -936, 
-    -935, -935, -934, -934, -933, -933, -932, -931, -931, -930, 
-    -929, -928, -927, -926, -925, -924, -923, -922, -921, -920, 
-    -919, -917, -916, -915, -913, -912, -910, -909, -907, -906, 
-    -904, -903, -901, -899, -897, -895, -894, -892, -890, -888, 
-    -886, -884, -882, -879, -877, -875, -873, -871, -868, -866, 
-    -863, -861, -859, -856, -853, -851, -848, -846, -843, -840, 
-    -837, -835, -832, -829, -826, -823, -820, -817, -814, -811, 
-    -808, -805, -802, -799, -795, -792, -789, -786, -782, -779, 
-    -775, -772, -769, -765, -762, -758, -754, -751, -747, -743, 
-    -740, -736, -732, -728, -725, -721, -717, -713, -709, -705, 
-    -701, -697, -693, -689, -685, -681, -677, -672, -668, -664, 
-    -660, -655, -651, -647, -642, -638, -634, -629, -625, -620, 
-    -616, -611, -607, -602, -598, -593, -589, -584, -579, -575, 
-    -570, -565, -560, -556, -551, -546, -541, -537, -532, -527, 
-    -522, -517, -512, -507, -502, -497, -492, -487, -482, -477, 
-    -472, -467, -462, -457, -452, -447, -442, -437, -432, -426, 
-    -421, -416, -411, -406, -401, -395, -390, -385, -380, -374, 
-    -369, -364, -359, -353, -348, -343, -337, -332, -327, -321, 
-    -316, -311, -305, -300, -295, -289, -284, -279, -273, -268, 
-    -263, -257, -252, -246, -241, -236, -230, -225, -220, -214, 
-    -209, -203, -198, -193, -187, -182, -176, -171, -166, -160, 
-    -155, -149, -144, -139, -133, -128, -123, -117, -112, -106, 
-    -101, -96, -90, -85, -80, -74, -69, -64, -58, -53, 
-    -48, -42, -37, -32, -27, -21, -16, -11, -6, 0, 
-    5, 10, 15, 20, 26, 31, 36, 41, 46, 51, 
-    56, 62, 67, 72, 77, 82, 87, 92, 97, 102, 
-    107, 112, 117, 122, 127, 132, 136, 141, 146, 151, 
-    156, 161, 166, 170, 175, 180, 184, 189, 194, 199, 
-    203, 208, 212, 217, 222, 226, 231, 235, 240, 244, 
-    249, 253, 257, 262, 266, 271, 275, 279, 283, 288, 
-    292, 296, 300, 305, 309, 313, 317, 321, 325, 329, 
-    333, 337, 341, 345, 349, 353, 357, 361, 364, 368, 
-    372, 376, 379, 383, 387, 390, 394, 398, 401, 405, 
-    408, 412, 415, 418, 422, 425, 429, 432, 435, 439, 
-    442, 445, 448, 451, 454, 458, 461, 464, 467, 470, 
-    473, 475, 478, 481, 484, 487, 490, 492, 495, 498, 
-    500, 503, 506, 508, 511, 513, 516, 518, 521, 523, 
-    525, 528, 530, 532, 534, 537, 539, 541, 543, 545, 
-    547, 549, 551, 553, 555, 557, 559, 561, 563, 564, 
-    566, 568, 569, 571, 573, 574, 576, 577, 579, 580, 
-    582, 583, 585, 586, 587, 588, 590, 591, 592, 593, 
-    594, 596, 597, 598, 599, 600, 601, 601, 602, 603, 
-    604, 605, 606, 606, 607, 608, 608, 609, 609, 610, 
-    611, 611, 611, 612, 612, 613, 613, 613, 614, 614, 
-    614, 614, 614, 614, 615, 615, 615, 615, 615, 615, 
-    615, 614, 614, 614, 614, 614, 613, 613, 613, 613, 
-    612, 612, 611, 611, 610, 610, 609, 609, 608, 608, 
-    607, 606, 606, 605, 604, 604, 603, 602, 601, 600, 
-    599, 598, 597, 596, 595, 594, 593, 592, 591, 590, 
-    589, 588, 586, 585, 584, 583, 581, 580, 578, 577, 
-    576, 574, 573, 571, 570, 568, 567, 565, 563, 562, 
-    560, 558, 557, 555, 553, 552, 550, 548, 546, 544, 
-    542, 540, 538, 537, 535, 533, 531, 528, 526, 524, 
-    522, 520, 518, 516, 514, 511, 509, 507, 505, 503, 
-    500, 498, 496, 493, 491, 489, 486, 484, 481, 479, 
-    476, 474, 472, 469, 467, 464, 461, 459, 456, 454, 
-    451, 448, 446, 443, 440, 438, 435, 432, 430, 427, 
-    424, 421, 419, 416, 413, 410, 407, 404, 401, 399, 
-    396, 393, 390, 387, 384, 381, 378, 375, 372, 369, 
-    366, 363, 360, 357, 354, 351, 348, 345, 342, 339, 
-    336, 333, 330, 326, 323, 320, 317, 314, 311, 308, 
-    304, 301, 298, 295, 292, 289, 285, 282, 279, 276, 
-    272, 269, 266, 263, 260, 256, 253, 250, 247, 243, 
-    240, 237, 234, 230, 227, 224, 221, 217, 214, 211, 
-    207, 204, 201, 198, 194, 191, 188, 185, 181, 178, 
-    175, 172, 168, 165, 162, 159, 155, 152, 149, 146, 
-    142, 139, 136, 133, 129, 126, 123, 120, 117, 114, 
-    110, 107, 104, 101, 98, 94, 91, 88, 85, 82, 
-    79, 76, 73, 69, 66, 63, 60, 57, 54, 51, 
-    48, 45, 42, 39, 36, 33, 30, 27, 24, 21, 
-    18, 15, 12, 9, 6, 4, 1, -2, -5, -8, 
-    -11, -14, -16, -19, -22, -25, -28, -30, -33, -36, 
-    -38, -41, -44, -47, -49, -52, -55, -57, -60, -63, 
-    -65, -68, -70, -73, -76, -78, -81, -83, -86, -88, 
-    -90, -93, -95, -98, -100, -103, -105, -107, -110, -112, 
-    -114, -117, -119, -121, -124, -126, -128, -130, -133, -135, 
-    -137, -139, -141, -143, -145, -148, -150, -152, -154, -156, 
-    -158, -160, -162, -164, -166, -168, -170, -172, -174, -175, 
-    -177, -179, -181, -183, -185, -186, -188, -190, -192, -193, 
-    -195, -197, -198, -200, -202, -203, -205, -207, -208, -210, 
-    -211, -213, -214, -216, -217, -219, -220, -222, -223, -224, 
-    -226, -227, -228, -230, -231, -232, -234, -235, -236, -237, 
-    -239, -240, -241, -242, -243, -244, -245, -246, -248, -249, 
-    -250, -251, -252, -253, -254, -254, -255, -256, -257, -258, 
-    -259, -260, -261, -261, -262, -263, -264, -264, -265, -266, 
-    -266, -267, -268, -268, -269, -269, -270, -271, -271, -272, 
-    -272, -273, -273, -273, -274, -274, -275, -275, -275, -276, 
-    -276, -276, -277, -277, -277, -277, -278, -278, -278, -278, 
-    -278, -278, -278, -279, -279, -279, -279, -279, -279, -279, 
-    -279, -279, -279, -279, -279, -278, -278, -278, -278, -278, 
-    -278, -278, -277, -277, -277, -277, -277, -276, -276, -276, 
-    -275, -275, -275, -274, -274, -274, -273, -273, -273, -272, 
-    -272, -271, -271, -270, -270, -269, -269, -268, -268, -267, 
-    -267, -266, -266, -265, -265, -264, -263, -263, -262, -262, 
-    -261, -260, -260, -259, -258, -258, -257, -256, -256, -255, 
-    -254, -253, -253, -252, -251, -251, -250, -249, -248, -247, 
-    -247, -246, -245, -244, -243, -242, -242, -241, -240, -239, 
-    -238, -237, -236, -235, -235, -234, -233, -232, -231, -230, 
-    -229, -228, -227, -226, -225, -224, -223, -222, -221, -220, 
-    -219, -218, -217, -216, -215, -214, -213, -212, -211, -210, 
-    -209, -207, -206, -205, -204, -203, -202, -201, -200, -199, 
-    -197, -196, -195, -194, -193, -192, -191, -189, -188, -187, 
-    -186, -185, -184, -182, -181, -180, -179, -178, -177, -175, 
-    -174, -173, -172, -171, -169, -168, -167, -166, -165, -163, 
-    -162, -161, -160, -159, -157, -156, -155, -154, -153, -151, 
-    -150, -149, -148, -146, -145, -144, -143, -142, -140, -139, 
-    -138, -137, -136, -134, -133, -132, -131, -130, -128, -127, 
-    -126, -125, -124, -122, -121, -120, -119, -118, -116, -115, 
-    -114, -113, -112, -110, -109, -108, -107, -106, -105, -103, 
-    -102, -101, -100, -99, -98, -96, -95, -94, -93, -92, 
-    -91, -89, -88, -87, -86, -85, -84, -83, -81, -80, 
-    -79, -78, -77, -76, -75, -74, -73, -71, -70, -69, 
-    -68, -67, -66, -65, -64, -63, -62, -61, -59, -58, 
-    -57, -56, -55, -54, -53, -52, -51, -50, -49, -48, 
-    -47, -46, -45, -44, -43, -42, -41, -40, -39, -38, 
-    -37, -36, -35, -34, -33, -33, -32, -31, -30, -29, 
-    -28, -27, -26, -25, -25, -24, -23, -22, -21, -20, 
-    -19, -19, -18, -17, -16, -15, -15, -14, -13, -12, 
-    -12, -11, -10, -9, -9, -8, -7, -7, -6, -5, 
-    -5, -4, -3, -3, -2, -1, -1, 0, 1, 1, 
-    2, 3, 3, 4, 4, 5, 6, 6, 7, 7, 
-    8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 
-    13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 
-    18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 
-    23, 23, 24, 24, 25, 25, 26, 26, 26, 27, 
-    27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 
-    31, 31, 31, 32, 32, 32, 33, 33, 33, 34, 
-    34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 
-    36, 37, 37, 37, 37, 37, 37, 37, 37, 38, 
-    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 
-    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 
-    38, 39, 39, 39, 39, 39, 39, 39, 40, 40, 
-    40, 40, 40, 41, 41, 41, 41, 41, 41, 41, 
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 41, 
-    41, 41, 41, 41, 41, 40, 40, 40, 40, 39, 
-    39, 39, 38, 39, 39, 39, 39, 38, 38, 38, 
-    38, 38, 38, 37, 37, 37, 36, 36, 36, 36, 
-    35, 35, 35, 34, 34, 34, 34, 33, 33, 33, 
-    33, 32, 32, 32, 32, 31, 31, 31, 31, 30, 
-    30, 30, 30, 29, 29, 29, 29, 28, 28, 28, 
-    28, 27, 27, 27, 26, 26, 26, 25, 25, 25, 
-    25, 24, 24, 24, 23, 23, 23, 23, 22, 22, 
-    22, 22, 21, 21, 21, 20, 20, 20, 20, 19, 
-    19, 19, 19, 18, 18, 18, 18, 17, 17, 17, 
-    16, 16, 16, 16, 15, 15, 15, 14, 14, 14, 
-    14, 13, 13, 13, 13, 12, 12, 12, 12, 12, 
-    11, 11, 11, 11, 10, 10, 10, 10, 10, 9, 
-    9, 9, 9, 8, 8, 8, 8, 8, 7, 7, 
-    7, 7, 7, 6, 6, 6, 6, 6, 6, 5, 
-    5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 
-    4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 
-    3, 2, 2, 2, 2, 2, 2, 2, 2, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 
-    7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 
-    6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
-    5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
-    4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
-    3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
-    2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 
+const int kick_packed_len = 6509;
+const uint8_t kick_packed[] = {
+    0x93, 0xff, 0xb2, 0x2b, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x39, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x6f, 0xff, 0xff, 0xa4, 0xf8, 0xc1, 0xff, 0xff, 0xe4, 0x5f,
+    0xff, 0xff, 0xa4, 0x5f, 0x5b, 0x3f, 0xff, 0x42, 0x3c, 0x3b, 0xff, 0xe3, 0xaf, 0xff, 0xfe, 0x0e,
+    0xff, 0xff, 0x20, 0x7f, 0x83, 0x9f, 0xff, 0xff, 0xff, 0x51, 0xbf, 0xea, 0xa7, 0xff, 0xff, 0x78,
+    0xe4, 0x97, 0xfa, 0x65, 0x49, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x4d, 0xc2, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73, 0xff, 0xf8, 0x0b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf2, 0xdb, 0xe4, 0x87, 0x84, 0x1f, 0xff, 0xbc, 0xc2, 0xef, 0xcc, 0x3f, 0xff, 0xff,
+    0x6d, 0x7e, 0x52, 0xf3, 0x48, 0x7f, 0x68, 0x89, 0xc4, 0x78, 0xdd, 0xff, 0x79, 0xff, 0xff, 0xf9,
+    0x83, 0xda, 0x9f, 0xff, 0xff, 0xec, 0x27, 0xff, 0xe4, 0xb4, 0xb1, 0x22, 0x66, 0xd8, 0xba, 0xa3,
+    0x99, 0xa3, 0x28, 0xd2, 0x13, 0x14, 0xe6, 0x92, 0x43, 0x03, 0x29, 0xae, 0x58, 0x7f, 0xc0, 0xa6,
+    0x6f, 0xc7, 0x1e, 0x12, 0xe7, 0xe7, 0xe9, 0x16, 0xfb, 0x7b, 0x03, 0xfc, 0xa5, 0xa0, 0x32, 0xd7,
+    0x01, 0x64, 0x41, 0x04, 0x4e, 0x0b, 0x41, 0xf0, 0x70, 0x13, 0x82, 0x24, 0x41, 0x0a, 0x18, 0x0d,
+    0x28, 0x90, 0xd1, 0xfc, 0xe3, 0xe2, 0x3f, 0xfd, 0x8a, 0xe6, 0x67, 0xf6, 0xaf, 0xf4, 0xe7, 0xed,
+    0x77, 0xff, 0x94, 0x56, 0x93, 0xf9, 0x67, 0xfb, 0x8f, 0x5a, 0xbf, 0x12, 0x3d, 0xfe, 0xb5, 0xff,
+    0xff, 0xf1, 0x6e, 0x08, 0x7f, 0xbe, 0x9f, 0xcd, 0x28, 0xcd, 0xff, 0x77, 0x7d, 0x9f, 0xb0, 0xdf,
+    0x03, 0xb4, 0xc8, 0x70, 0xe0, 0xea, 0x3d, 0x94, 0x1a, 0x5f, 0xb7, 0x60, 0x7e, 0x6d, 0x6f, 0xf5,
+    0xe6, 0xcc, 0x9f, 0x03, 0x53, 0xdd, 0x40, 0xfc, 0xf2, 0xf0, 0x2f, 0xe1, 0x0e, 0x57, 0x6b, 0xe5,
+    0x5e, 0xf6, 0x84, 0xd2, 0x9c, 0x1d, 0x76, 0xf5, 0xcb, 0xff, 0xf8, 0x2a, 0x9e, 0x7f, 0xcc, 0x07,
+    0x6b, 0xa9, 0x2d, 0xac, 0xb4, 0x4f, 0x3f, 0x94, 0x39, 0x95, 0xff, 0xf5, 0xeb, 0xf3, 0xe7, 0xf1,
+    0x2f, 0x10, 0xae, 0x25, 0x51, 0xab, 0xf5, 0x8a, 0x4b, 0x6a, 0xfc, 0x8a, 0xf4, 0xe3, 0x9d, 0xfe,
+    0xb3, 0xe2, 0x57, 0x58, 0x03, 0xca, 0xfe, 0xbe, 0x88, 0xd0, 0xd7, 0x60, 0x2f, 0xe9, 0xf3, 0xe5,
+    0x57, 0x95, 0x34, 0x2e, 0x2b, 0x64, 0x53, 0xec, 0x8e, 0xa0, 0x24, 0x37, 0xe7, 0xaf, 0x1d, 0xbf,
+    0xf3, 0x0b, 0x3a, 0x7d, 0xc1, 0xe2, 0x3d, 0x80, 0xe5, 0x84, 0x5a, 0xbd, 0x63, 0xef, 0xb6, 0x32,
+    0x67, 0xf6, 0xc8, 0xd0, 0xfb, 0x62, 0x4f, 0xfb, 0x31, 0xbe, 0x5f, 0x86, 0x7f, 0xf5, 0xef, 0xff,
+    0xef, 0x45, 0x5e, 0xff, 0xd8, 0xbe, 0xc8, 0x78, 0x78, 0xd5, 0xe7, 0x1a, 0x7e, 0x1a, 0x9c, 0x97,
+    0xb0, 0x33, 0x88, 0xf9, 0xe6, 0x0e, 0x60, 0x95, 0x2c, 0x0a, 0x25, 0x9f, 0x29, 0xcc, 0x2f, 0x1a,
+    0x82, 0xa7, 0x7b, 0xcb, 0x1a, 0x71, 0xec, 0xc6, 0x66, 0xf8, 0xc7, 0x37, 0xbe, 0xb1, 0x28, 0x1f,
+    0xad, 0x7b, 0xeb, 0xf8, 0x21, 0x51, 0x2e, 0xcd, 0x71, 0x76, 0x52, 0xac, 0xe8, 0x46, 0x8f, 0x7d,
+    0x49, 0x97, 0x7e, 0xa8, 0x12, 0xb8, 0xfe, 0xa4, 0x36, 0x03, 0x30, 0x62, 0x0d, 0xa7, 0x36, 0x88,
+    0xe5, 0xf7, 0xbf, 0x47, 0x3e, 0x8a, 0x4f, 0xdd, 0xdb, 0x4e, 0x58, 0xe9, 0xd9, 0x18, 0x42, 0xf8,
+    0x14, 0x14, 0xb3, 0x73, 0x16, 0xd4, 0x67, 0x00, 0xf3, 0xac, 0xf4, 0x6f, 0x43, 0xa3, 0x52, 0x03,
+    0x3f, 0xc2, 0x0d, 0x1c, 0x69, 0x73, 0xf5, 0x1d, 0xb8, 0x8f, 0xf2, 0x5b, 0x0c, 0x58, 0x3d, 0x24,
+    0x8e, 0xd9, 0x63, 0x63, 0x4a, 0x79, 0xb1, 0x36, 0x85, 0xbb, 0x4e, 0x22, 0xd0, 0x84, 0x28, 0xb7,
+    0x68, 0xc4, 0x88, 0xa4, 0xf2, 0xe5, 0x0c, 0x63, 0xb5, 0x1c, 0x1e, 0x9d, 0xf8, 0xfa, 0x58, 0xd9,
+    0xea, 0x70, 0xb4, 0xc8, 0x72, 0x60, 0xd0, 0x81, 0x65, 0x30, 0x40, 0x1a, 0x87, 0xc1, 0x00, 0x8c,
+    0x4b, 0xbf, 0xac, 0x53, 0x2c, 0xa3, 0xd8, 0xf3, 0x47, 0x8b, 0x51, 0xb6, 0x22, 0xc9, 0x22, 0xd2,
+    0x50, 0xa6, 0x30, 0x61, 0x98, 0x68, 0x68, 0xa8, 0x04, 0x2f, 0x20, 0xc6, 0x60, 0x60, 0x12, 0x97,
+    0x60, 0x29, 0xac, 0x6a, 0x07, 0x32, 0x5c, 0x3b, 0xa0, 0xc5, 0x4a, 0x46, 0xdd, 0x40, 0xc3, 0x79,
+    0xc9, 0x7f, 0x60, 0xaf, 0x0c, 0x2a, 0xa7, 0xa2, 0x26, 0x16, 0xab, 0x22, 0xd7, 0x25, 0xff, 0x75,
+    0x22, 0xc0, 0xe6, 0x2f, 0x0c, 0xd2, 0xb4, 0x4d, 0x51, 0xa2, 0x93, 0x14, 0xbb, 0xcf, 0xb8, 0x2b,
+    0x5e, 0xa9, 0x11, 0xf6, 0xff, 0xac, 0xb1, 0x29, 0x7e, 0x57, 0x50, 0x51, 0x19, 0x9c, 0x0a, 0x52,
+    0x37, 0x45, 0x8c, 0xbc, 0xcb, 0xcc, 0xc3, 0x13, 0xdb, 0x67, 0xe8, 0xaf, 0x86, 0x70, 0x6e, 0xff,
+    0x37, 0x55, 0x8c, 0x26, 0x66, 0x90, 0x66, 0x75, 0xfd, 0x01, 0x61, 0x66, 0x21, 0x67, 0x2d, 0x11,
+    0xaa, 0x09, 0x43, 0xce, 0x64, 0xc5, 0x80, 0x9a, 0x21, 0xb2, 0x70, 0x49, 0x28, 0x2b, 0x52, 0x70,
+    0xf5, 0xac, 0x13, 0x1a, 0x95, 0x14, 0x0e, 0x26, 0x03, 0xf0, 0xec, 0x5e, 0x33, 0x01, 0x05, 0x6c,
+    0xe9, 0x22, 0x0e, 0x22, 0x3c, 0x8f, 0x58, 0x44, 0x0c, 0xca, 0x79, 0xf5, 0xe4, 0xe4, 0xce, 0xa2,
+    0x6e, 0xe1, 0x8d, 0xb6, 0xa1, 0x23, 0xa6, 0xfa, 0x34, 0x8a, 0x5a, 0x38, 0x8e, 0x0f, 0x43, 0xc4,
+    0xb0, 0x3b, 0xaf, 0x66, 0x56, 0x2f, 0x3e, 0xf1, 0x74, 0x25, 0x72, 0x8e, 0xe2, 0x4c, 0x10, 0x19,
+    0xc7, 0x63, 0xa5, 0xed, 0x80, 0x56, 0x48, 0x21, 0xa8, 0xa7, 0xe8, 0xec, 0x6e, 0x2c, 0x0a, 0x50,
+    0x67, 0x08, 0x4f, 0x17, 0x59, 0xc2, 0x09, 0x58, 0x94, 0x4c, 0xe0, 0x3a, 0x8b, 0x00, 0xd0, 0x69,
+    0x31, 0xca, 0x95, 0x20, 0xbc, 0x0e, 0xc2, 0x02, 0x34, 0x98, 0x00, 0xc6, 0x11, 0x0c, 0x07, 0x32,
+    0x16, 0x06, 0xc5, 0xa5, 0x84, 0x89, 0x01, 0x86, 0x77, 0xa5, 0x04, 0xc1, 0x2e, 0x36, 0x89, 0x03,
+    0xf0, 0xec, 0x19, 0x10, 0x66, 0x48, 0x1a, 0xa6, 0x14, 0x00, 0x38, 0x7a, 0x2c, 0x82, 0x02, 0x61,
+    0xb0, 0x32, 0x19, 0x24, 0x39, 0x5c, 0x61, 0x25, 0xe6, 0x49, 0xf0, 0x13, 0x0f, 0x65, 0x38, 0xbe,
+    0x16, 0x0c, 0xc0, 0x71, 0xda, 0x3b, 0x82, 0xe0, 0xc8, 0x04, 0x4a, 0x01, 0x0b, 0xb8, 0x1a, 0x06,
+    0xa4, 0x61, 0x08, 0x4a, 0x02, 0x02, 0xc1, 0xc0, 0x78, 0x28, 0x83, 0xa0, 0x08, 0xc8, 0x21, 0x0e,
+    0x60, 0xe8, 0x58, 0x2a, 0x04, 0x41, 0x78, 0xa6, 0x0c, 0x91, 0x80, 0x40, 0x9a, 0x02, 0x01, 0x81,
+    0x90, 0x1e, 0x08, 0x83, 0x00, 0xd8, 0x4c, 0x00, 0x0b, 0x6a, 0x68, 0x2a, 0xa2, 0x13, 0x67, 0x19,
+    0x6a, 0x07, 0x2a, 0x44, 0xea, 0x56, 0x36, 0xaa, 0xc1, 0xfa, 0x26, 0x77, 0x36, 0x8c, 0xec, 0x3f,
+    0x7b, 0x0e, 0xc1, 0xf4, 0x69, 0x07, 0x4d, 0xc2, 0xd8, 0x95, 0x88, 0x68, 0xf4, 0xa2, 0x35, 0x47,
+    0xb1, 0xb0, 0x5c, 0x05, 0x44, 0x70, 0xe0, 0xb2, 0x08, 0x80, 0x10, 0x94, 0x1d, 0x04, 0x06, 0xa2,
+    0xf8, 0x47, 0x23, 0x42, 0x22, 0x38, 0x4c, 0x06, 0x4c, 0xa1, 0x94, 0xf5, 0x1d, 0x0a, 0x82, 0x78,
+    0x39, 0x26, 0xc3, 0x91, 0xb0, 0x8c, 0x09, 0x84, 0x52, 0xf4, 0x34, 0x50, 0x03, 0xe3, 0x0c, 0x37,
+    0x27, 0x8b, 0xe1, 0x21, 0x1f, 0x2b, 0xc8, 0x62, 0xe0, 0x9a, 0x1a, 0xcf, 0x30, 0x8d, 0x42, 0x26,
+    0x18, 0x90, 0x2d, 0x0a, 0x1a, 0x01, 0xf2, 0xe4, 0x75, 0x12, 0x05, 0x41, 0x60, 0x29, 0x11, 0xc0,
+    0x32, 0xc4, 0xcc, 0x30, 0x88, 0x94, 0x6c, 0x2f, 0x53, 0x86, 0x62, 0x64, 0x71, 0x0b, 0x42, 0x20,
+    0x68, 0x16, 0x12, 0x43, 0xb0, 0x4c, 0x07, 0x15, 0x82, 0x81, 0x64, 0x71, 0x00, 0x82, 0x20, 0x40,
+    0x10, 0x22, 0xc8, 0x50, 0x90, 0x34, 0x17, 0x05, 0x51, 0x04, 0x4e, 0x03, 0x40, 0xb1, 0xdc, 0x21,
+    0x0a, 0x83, 0x41, 0x08, 0x9d, 0x0f, 0xc1, 0x82, 0x10, 0x1e, 0x42, 0xc3, 0x10, 0xf8, 0xde, 0x06,
+    0x54, 0xb1, 0xd8, 0xca, 0x1e, 0xc8, 0xf0, 0x60, 0x54, 0x0d, 0xc7, 0x71, 0xec, 0x74, 0x32, 0x8a,
+    0x14, 0x4c, 0xac, 0x23, 0x03, 0xb0, 0x68, 0x41, 0x21, 0x43, 0xb1, 0x08, 0x70, 0x09, 0x85, 0x91,
+    0xec, 0x69, 0x30, 0x08, 0x61, 0x9c, 0x5b, 0x0e, 0x44, 0xc2, 0xb8, 0x1e, 0x4e, 0xc1, 0x64, 0xb8,
+    0x3d, 0x29, 0x40, 0x81, 0x60, 0x40, 0x03, 0x86, 0x51, 0x94, 0xa8, 0x17, 0x84, 0xf0, 0xb0, 0x23,
+    0x08, 0x07, 0x80, 0x90, 0x02, 0x0d, 0xc2, 0x91, 0x88, 0x62, 0x16, 0xc2, 0x30, 0xe0, 0x2a, 0x06,
+    0x40, 0x40, 0x78, 0x42, 0x20, 0xc0, 0x83, 0xe8, 0x2b, 0x01, 0xc4, 0x10, 0x1c, 0x14, 0x04, 0xc0,
+    0xe0, 0xdc, 0x24, 0x05, 0x05, 0x10, 0x44, 0x0e, 0x09, 0x02, 0x10, 0x9c, 0x0f, 0x02, 0x06, 0xe1,
+    0x34, 0x37, 0x07, 0x00, 0xf0, 0xc0, 0x2d, 0x00, 0x40, 0xb0, 0x28, 0x1e, 0x05, 0x48, 0x80, 0xc0,
+    0x0c, 0x04, 0x42, 0xb0, 0xe8, 0x09, 0x0f, 0x01, 0x20, 0x9c, 0x0d, 0x04, 0x85, 0xc0, 0xfc, 0x01,
+    0x10, 0x81, 0xf0, 0x58, 0x06, 0x0a, 0x01, 0x30, 0xfc, 0x4e, 0x0b, 0x00, 0x20, 0x14, 0x02, 0x04,
+    0x43, 0xf0, 0xe0, 0x2e, 0x06, 0x86, 0xd1, 0x95, 0x58, 0x0d, 0xcd, 0x51, 0x98, 0x5e, 0x08, 0xc5,
+    0x10, 0x78, 0x50, 0x02, 0x46, 0x71, 0x04, 0x2c, 0x13, 0x82, 0xb0, 0xf4, 0x18, 0x0c, 0x01, 0x30,
+    0x08, 0x03, 0x04, 0x41, 0xb1, 0xb4, 0x20, 0x01, 0xc1, 0xc0, 0x30, 0x19, 0x04, 0xc2, 0x30, 0x44,
+    0x6c, 0x04, 0x88, 0x90, 0xa0, 0x00, 0x00, 0x42, 0xa0, 0x4c, 0x49, 0x00, 0x81, 0x00, 0x28, 0x28,
+    0x05, 0x42, 0xd0, 0x18, 0x20, 0x04, 0x41, 0x10, 0x48, 0x04, 0x03, 0x00, 0xb0, 0x20, 0x09, 0x04,
+    0xc0, 0x60, 0x7c, 0x2a, 0x06, 0x02, 0x30, 0x2c, 0x0b, 0x0b, 0x83, 0x30, 0x30, 0x22, 0x0d, 0x42,
+    0xc0, 0x74, 0x09, 0x01, 0xc0, 0x90, 0x98, 0x23, 0x01, 0x41, 0xc0, 0x50, 0x17, 0x09, 0xc1, 0xe0,
+    0x74, 0x15, 0x0a, 0x82, 0x00, 0x78, 0x57, 0x07, 0xc2, 0x60, 0x90, 0x0e, 0x0f, 0xc0, 0x70, 0x28,
+    0x26, 0x0d, 0x02, 0xd1, 0x4c, 0x03, 0x12, 0x80, 0x60, 0x2c, 0x20, 0x03, 0xc0, 0x60, 0x0c, 0x1e,
+    0x0e, 0x83, 0xb0, 0x08, 0x19, 0x05, 0x03, 0xe0, 0x68, 0x1e, 0x07, 0x41, 0xd0, 0x3c, 0x2a, 0x05,
+    0x82, 0xf1, 0x28, 0x09, 0x06, 0x40, 0xe0, 0x44, 0x20, 0x05, 0xc0, 0xf0, 0xe8, 0x24, 0x06, 0x41,
+    0xf0, 0xf2, 0x1f, 0x0a, 0x53, 0xf5, 0xcf, 0x82, 0x7c, 0xf1, 0xec, 0xdc, 0x1d, 0xfe, 0x9a, 0xb0,
+    0xc7, 0xa7, 0x9c, 0x5e, 0xc7, 0xd7, 0xa7, 0x5e, 0x5c, 0x3d, 0xd2, 0xba, 0x5c, 0xb0, 0xdf, 0x62,
+    0x28, 0xe9, 0x4f, 0xf5, 0xbc, 0x29, 0xc3, 0x86, 0x79, 0xdb, 0x5d, 0x74, 0x9c, 0xa3, 0xcf, 0x2c,
+    0xc3, 0x58, 0x76, 0xce, 0xfd, 0x74, 0x97, 0xcf, 0x86, 0xae, 0xcb, 0xaf, 0xe6, 0x23, 0xa4, 0xbf,
+    0x76, 0xe2, 0x05, 0xa9, 0xaf, 0x0c, 0xf9, 0xf0, 0xeb, 0xf1, 0x3e, 0xd7, 0xeb, 0x85, 0x7c, 0xcc,
+    0x35, 0x78, 0x78, 0xc3, 0x0e, 0xb5, 0xc7, 0xb5, 0x38, 0xad, 0x72, 0x8c, 0x6b, 0xe3, 0xb1, 0x38,
+    0x5b, 0x94, 0x7b, 0x31, 0x76, 0x4f, 0x86, 0x65, 0xe8, 0x9a, 0x46, 0xd8, 0x21, 0xc7, 0xe1, 0xab,
+    0x70, 0xd7, 0x97, 0x4f, 0x26, 0x0e, 0x5f, 0x38, 0x4b, 0x00, 0xfc, 0xd2, 0x90, 0x18, 0xf4, 0xb5,
+    0xca, 0x83, 0xaa, 0x02, 0xc3, 0x2f, 0x49, 0x9d, 0x73, 0xd3, 0x2f, 0x29, 0xae, 0x5d, 0xfc, 0x04,
+    0x18, 0xf4, 0x42, 0xea, 0xbe, 0x53, 0xc2, 0xf0, 0xdb, 0x75, 0xe5, 0x21, 0xd3, 0x65, 0x81, 0xa7,
+    0x91, 0xe4, 0x0f, 0xf0, 0xc1, 0x83, 0x0c, 0xa1, 0xc2, 0x34, 0x2d, 0x3a, 0x1f, 0x4b, 0x1c, 0x65,
+    0xcb, 0xcd, 0x9a, 0x1e, 0x0a, 0xd3, 0x54, 0xd3, 0xd3, 0xbe, 0x99, 0x54, 0xb3, 0xc2, 0xc2, 0x33,
+    0xa4, 0x74, 0x2e, 0x70, 0x0b, 0x15, 0x53, 0xad, 0x0f, 0x5c, 0x6b, 0x86, 0x62, 0x7d, 0x69, 0x37,
+    0xb9, 0x9e, 0xa2, 0x16, 0x6e, 0x26, 0x30, 0x08, 0xc6, 0xb2, 0xbe, 0x60, 0x2d, 0xaa, 0x85, 0xce,
+    0xa6, 0x69, 0x1a, 0xb7, 0x1a, 0xca, 0xe2, 0x61, 0x78, 0xd3, 0x15, 0x59, 0x17, 0x8d, 0xaa, 0x90,
+    0xe6, 0x42, 0x18, 0x9b, 0x77, 0x83, 0x25, 0x77, 0x90, 0x8c, 0x6f, 0xc7, 0x1f, 0x08, 0xe2, 0x05,
+    0x48, 0xcc, 0x82, 0xa7, 0xb2, 0xdc, 0x0d, 0xb7, 0x7d, 0xba, 0x8e, 0x0f, 0x57, 0x2c, 0x7e, 0x05,
+    0xef, 0xa2, 0x95, 0x5c, 0x5d, 0x8f, 0x4d, 0x4f, 0x4b, 0xd8, 0xc5, 0x15, 0x61, 0x95, 0x4b, 0x05,
+    0x43, 0x9a, 0x02, 0x25, 0x10, 0x96, 0x38, 0x61, 0x36, 0x22, 0x11, 0x81, 0x0b, 0xca, 0x43, 0xc3,
+    0x9e, 0x1a, 0x54, 0x61, 0xa1, 0x64, 0x75, 0xf4, 0xbc, 0xb2, 0x13, 0x5e, 0x56, 0xb8, 0xfa, 0x43,
+    0xbe, 0x1c, 0x1a, 0x80, 0xd2, 0x1c, 0xd3, 0xd1, 0x9c, 0x5b, 0x6a, 0xaf, 0x90, 0x3f, 0x81, 0x4c,
+    0xb6, 0x4a, 0x47, 0x6c, 0x39, 0xf2, 0xd1, 0xd6, 0x58, 0x42, 0xde, 0xb8, 0x7d, 0x9d, 0x6f, 0xa4,
+    0x35, 0x8f, 0xb2, 0x77, 0xf0, 0xe0, 0xeb, 0x9c, 0xb2, 0xb8, 0xe5, 0x53, 0xc1, 0xa2, 0x21, 0x95,
+    0x38, 0xc3, 0x03, 0x8c, 0x32, 0x5a, 0xae, 0x11, 0xe7, 0xe5, 0x0e, 0x65, 0x27, 0xb8, 0x1e, 0x92,
+    0xf5, 0xd3, 0x86, 0xbc, 0x69, 0xed, 0x1f, 0x8f, 0x87, 0x2f, 0xa9, 0xf9, 0x5d, 0xec, 0x42, 0x77,
+    0x0e, 0x51, 0xc6, 0x52, 0x75, 0x39, 0x63, 0xbe, 0x47, 0x35, 0x51, 0x97, 0x0e, 0x65, 0x2f, 0x76,
+    0xe4, 0xfa, 0x96, 0x03, 0xb8, 0xf6, 0xac, 0xd3, 0x1b, 0x42, 0x33, 0x85, 0x43, 0x6d, 0x47, 0x2d,
+    0x66, 0x24, 0x0a, 0x97, 0x49, 0x0a, 0x45, 0x14, 0x69, 0x9b, 0xd0, 0x94, 0x50, 0xd2, 0x59, 0xde,
+    0x44, 0x86, 0x2e, 0x37, 0x4c, 0x35, 0x9e, 0x09, 0x9d, 0xc2, 0x59, 0xbf, 0x28, 0x9b, 0x54, 0x46,
+    0xf5, 0x42, 0xc4, 0x62, 0xf0, 0x55, 0x11, 0xe9, 0x38, 0xca, 0x63, 0x10, 0x84, 0x2f, 0x8d, 0xaa,
+    0x90, 0x58, 0x5d, 0xca, 0x53, 0xce, 0x4d, 0x19, 0x86, 0x91, 0xc4, 0x58, 0xc6, 0x68, 0xd3, 0x8d,
+    0x0a, 0x6a, 0x56, 0x96, 0x71, 0xb3, 0x19, 0x89, 0xb9, 0xe0, 0x22, 0x05, 0x00, 0x55, 0xd0, 0x35,
+    0x64, 0x12, 0x48, 0x45, 0x03, 0x53, 0xa5, 0x0c, 0x61, 0x84, 0x14, 0xf0, 0x92, 0x8c, 0x15, 0x69,
+    0x81, 0xc4, 0xa4, 0x26, 0xd4, 0x45, 0x09, 0x5a, 0x23, 0x44, 0x44, 0x62, 0xa3, 0x3b, 0xd6, 0x49,
+    0x16, 0xa3, 0x46, 0x90, 0x58, 0x48, 0x88, 0x08, 0xa0, 0xc6, 0xcc, 0x62, 0x92, 0x60, 0x06, 0x06,
+    0x64, 0x44, 0x32, 0x20, 0x63, 0x4b, 0x18, 0xa3, 0x14, 0x22, 0x30, 0x5a, 0x09, 0xc9, 0x8c, 0xe0,
+    0x94, 0x07, 0xc1, 0x08, 0x4a, 0x10, 0x9b, 0x6c, 0xa1, 0x42, 0x62, 0x8d, 0xa9, 0x9b, 0x60, 0x2c,
+    0x23, 0x44, 0x8c, 0x02, 0x04, 0xac, 0x51, 0x2c, 0x22, 0x10, 0x02, 0x10, 0x80, 0x29, 0x04, 0x01,
+    0xc8, 0x06, 0x10, 0x30, 0x81, 0x89, 0xb4, 0x0c, 0x20, 0x33, 0x02, 0x24, 0x34, 0x55, 0x01, 0x10,
+    0x31, 0x86, 0x22, 0x8a, 0x16, 0x5c, 0xc4, 0x94, 0x49, 0x22, 0xec, 0x2e, 0x57, 0x0d, 0xa7, 0x70,
+    0x80, 0x3c, 0xca, 0x16, 0x73, 0xa9, 0xd9, 0x19, 0xc2, 0xfc, 0xd3, 0xc9, 0x21, 0xe5, 0xd7, 0x74,
+    0xda, 0x99, 0xa5, 0xcc, 0x4e, 0xfa, 0xca, 0x8e, 0xfb, 0xd7, 0x8f, 0x36, 0x1e, 0x63, 0x8b, 0xfe,
+    0x63, 0xe3, 0xce, 0x61, 0xac, 0xba, 0x77, 0xd7, 0x7c, 0xfd, 0x3b, 0x4a, 0xdc, 0xf8, 0x5b, 0x8f,
+    0x79, 0xff, 0x8e, 0x3f, 0x3f, 0x7c, 0x6b, 0xbc, 0xe9, 0x05, 0x9d, 0xae, 0x3d, 0xc2, 0xde, 0x8e,
+    0x61, 0x36, 0x27, 0x13, 0x63, 0x51, 0x7e, 0x71, 0xea, 0x6e, 0x5f, 0x11, 0x94, 0xc9, 0x8a, 0x9d,
+    0xc2, 0x01, 0x72, 0x3c, 0x76, 0xe0, 0x5b, 0xd5, 0x6e, 0x96, 0xf5, 0x59, 0x30, 0x64, 0x69, 0x79,
+    0x5d, 0x58, 0x88, 0xb8, 0xc5, 0xc2, 0xc1, 0xb5, 0x02, 0x26, 0x2a, 0x56, 0x08, 0xa6, 0xf4, 0xf0,
+    0xef, 0x8a, 0x03, 0x0e, 0x8b, 0xeb, 0x0f, 0x23, 0xe3, 0x8d, 0xbf, 0x16, 0x20, 0x62, 0x14, 0x19,
+    0xf5, 0x12, 0x6e, 0xbd, 0x1b, 0xea, 0x2f, 0x49, 0x9a, 0xa6, 0x7f, 0x85, 0xf6, 0xf8, 0xf5, 0x5b,
+    0x3f, 0x0b, 0xcd, 0x7d, 0x46, 0xcd, 0x28, 0xe2, 0xbe, 0x4f, 0xd5, 0x14, 0x88, 0x11, 0xae, 0xb3,
+    0x9a, 0xa8, 0xa1, 0x34, 0xaf, 0x1d, 0x04, 0x89, 0x1a, 0x17, 0xd6, 0x1b, 0xaa, 0x4a, 0x2c, 0xfe,
+    0xaf, 0xba, 0xf1, 0x12, 0x2b, 0xac, 0xce, 0x80, 0x88, 0x82, 0xc7, 0x4c, 0xa8, 0x84, 0x5a, 0x8e,
+    0x0f, 0x78, 0xd1, 0x75, 0x10, 0xe3, 0x12, 0xe9, 0x44, 0x31, 0x89, 0x7d, 0x0b, 0x31, 0x4e, 0x38,
+    0xef, 0x3f, 0x88, 0xca, 0x57, 0x1c, 0x4c, 0xaa, 0x13, 0x50, 0x44, 0x5e, 0x35, 0xc8, 0xd0, 0xbe,
+    0x57, 0x0f, 0x23, 0x58, 0xdf, 0xda, 0xfc, 0x57, 0x72, 0xa0, 0x09, 0x9a, 0xa7, 0x78, 0x0e, 0x18,
+    0xa3, 0x62, 0x88, 0x52, 0xe8, 0xb3, 0xc7, 0x3e, 0x5a, 0x20, 0x82, 0xc1, 0x21, 0x86, 0x09, 0x00,
+    0x90, 0x13, 0xf6, 0xe0, 0xf3, 0x50, 0xc5, 0xb1, 0x51, 0x3c, 0x9c, 0x3e, 0x6b, 0x47, 0xc9, 0x8b,
+    0x6a, 0xe0, 0xb0, 0xf3, 0x43, 0x78, 0x39, 0x86, 0x8d, 0xdf, 0x47, 0x7c, 0x6e, 0x44, 0x36, 0x42,
+    0xca, 0x9c, 0xe2, 0x27, 0x21, 0x41, 0xf7, 0x8d, 0x67, 0x31, 0x45, 0xac, 0xe7, 0xc6, 0xb9, 0xe4,
+    0xf5, 0x37, 0xab, 0xbc, 0x5e, 0xd4, 0x43, 0xb5, 0x92, 0x98, 0x80, 0x16, 0x73, 0xf1, 0xbe, 0x75,
+    0x13, 0x3a, 0x59, 0xce, 0xaa, 0xd2, 0xbb, 0x84, 0xe0, 0x9d, 0xcc, 0x6b, 0x27, 0x16, 0xf5, 0x76,
+    0xb0, 0x6c, 0xf0, 0x79, 0xa4, 0xd9, 0x3c, 0x63, 0xe7, 0xbf, 0xa5, 0x96, 0xa0, 0xcb, 0xeb, 0x63,
+    0xac, 0xb0, 0x22, 0x2c, 0x71, 0xee, 0xba, 0xca, 0xa9, 0xcc, 0x25, 0xc7, 0x26, 0x82, 0x24, 0x2e,
+    0x71, 0xae, 0x56, 0x99, 0xd6, 0xb3, 0x7a, 0x89, 0x8a, 0xc4, 0xb1, 0x1d, 0x0c, 0x9d, 0x43, 0x75,
+    0x19, 0xad, 0x6c, 0x40, 0x94, 0x90, 0x02, 0x82, 0x50, 0x9f, 0x1c, 0x04, 0x82, 0x42, 0x00, 0x80,
+    0x82, 0x45, 0x00, 0x81, 0x0b, 0x18, 0xe0, 0x34, 0x04, 0x20, 0xa2, 0x20, 0x22, 0x75, 0x85, 0x91,
+    0xd5, 0x59, 0xc0, 0x58, 0x2e, 0x30, 0x4d, 0x56, 0xd7, 0x0c, 0x44, 0x33, 0x8c, 0x59, 0xd6, 0x71,
+    0x4d, 0x51, 0x5e, 0x37, 0x9e, 0x20, 0x04, 0x26, 0xb8, 0x64, 0xa8, 0x27, 0x18, 0xbc, 0x37, 0xa7,
+    0x81, 0x27, 0xc6, 0x77, 0xfd, 0x4e, 0x7e, 0xae, 0x71, 0x8b, 0x10, 0x21, 0xae, 0x1b, 0x10, 0xf1,
+    0x5c, 0x9d, 0x68, 0x87, 0x58, 0xe7, 0x18, 0x98, 0x53, 0xd6, 0x3e, 0xe3, 0xd5, 0xe1, 0x66, 0x30,
+    0xd6, 0x27, 0x4e, 0xf1, 0x42, 0x4e, 0x31, 0x91, 0x87, 0x44, 0x40, 0x58, 0xe6, 0x3f, 0x1e, 0x67,
+    0xa9, 0x9c, 0x62, 0x58, 0x86, 0xe8, 0x31, 0x0e, 0x89, 0x04, 0x40, 0x67, 0x08, 0x84, 0x4e, 0x88,
+    0x47, 0x02, 0x42, 0x20, 0x86, 0x8b, 0xca, 0x2c, 0x87, 0x29, 0x91, 0x21, 0x8a, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcf, 0xff, 0xff, 0x7f, 0xe6, 0xe0, 0x91, 0x30, 0x59, 0x2b, 0x1a, 0x81, 0xd3, 0x74, 0x62,
+    0x08, 0x03, 0x3b, 0xdc, 0xb4, 0x16, 0xc3, 0xde, 0x1a, 0xd0, 0x3b, 0x96, 0xc6, 0x94, 0x97, 0xbc,
+    0x36, 0x03, 0x45, 0xc6, 0xaa, 0x1b, 0x07, 0x76, 0x4d, 0x51, 0xa5, 0x25, 0x58, 0xbd, 0xe6, 0x6b,
+    0x8a, 0xb2, 0x5d, 0xc1, 0xe9, 0x12, 0xee, 0x5b, 0x0e, 0xb1, 0x33, 0xf4, 0xe3, 0xa6, 0x2d, 0xe3,
+    0xa2, 0xce, 0x6f, 0x71, 0x2d, 0x19, 0xb4, 0xf3, 0x7e, 0xe0, 0xa8, 0xb6, 0x2c, 0x6c, 0xac, 0x12,
+    0xb3, 0x36, 0x9c, 0xd1, 0x8b, 0x27, 0xa6, 0x0a, 0xc1, 0x25, 0x8b, 0x8d, 0x08, 0x20, 0xf1, 0xde,
+    0x65, 0x03, 0x9a, 0xfc, 0x96, 0xe1, 0x93, 0x73, 0x10, 0x09, 0x13, 0x08, 0x48, 0x30, 0x24, 0x09,
+    0x03, 0x8b, 0x98, 0x43, 0x0c, 0x8c, 0xce, 0x6c, 0xc0, 0x81, 0xc1, 0xe2, 0x61, 0x09, 0x32, 0x0c,
+    0xcc, 0x30, 0x24, 0xc0, 0x33, 0x1c, 0x66, 0x38, 0xe4, 0x32, 0xce, 0x32, 0x43, 0x8b, 0xe5, 0xc8,
+    0x4c, 0x20, 0x64, 0x66, 0x48, 0xcc, 0x8c, 0x92, 0x48, 0x48, 0x4c, 0x5f, 0x08, 0xe1, 0x31, 0x26,
+    0x32, 0x18, 0x99, 0x08, 0x4c, 0x1c, 0x0c, 0x30, 0x1e, 0x65, 0x9c, 0xb2, 0x63, 0x31, 0x70, 0x84,
+    0x71, 0x93, 0x18, 0x40, 0x86, 0x11, 0x98, 0x32, 0x63, 0x20, 0x42, 0x10, 0x86, 0x01, 0x00, 0xc0,
+    0x81, 0x80, 0x49, 0x19, 0x8c, 0x24, 0x61, 0x1c, 0x43, 0x29, 0x01, 0x00, 0x48, 0x80, 0x31, 0x18,
+    0x0c, 0x41, 0x88, 0xa0, 0x92, 0x91, 0x49, 0x42, 0x51, 0x8a, 0x09, 0x44, 0x51, 0x51, 0x45, 0x65,
+    0x65, 0x05, 0x14, 0x28, 0xa8, 0x54, 0xb2, 0x96, 0x54, 0x51, 0x51, 0x14, 0xa1, 0x44, 0x55, 0x11,
+    0x4a, 0x0a, 0x50, 0xa2, 0x59, 0x44, 0x51, 0x44, 0xa2, 0x25, 0x11, 0x45, 0x11, 0x45, 0x28, 0x2a,
+    0x22, 0x8a, 0x2a, 0x0d, 0x85, 0x65, 0x05, 0x11, 0x10, 0xb1, 0x51, 0x41, 0x44, 0x45, 0x14, 0x11,
+    0x11, 0x10, 0xa0, 0x88, 0x22, 0x08, 0x85, 0x94, 0x14, 0x16, 0x58, 0x88, 0x08, 0x00, 0x0c, 0x22,
+    0x46, 0x04, 0x48, 0x30, 0x08, 0xc0, 0x20, 0x10, 0x20, 0x10, 0x08, 0x46, 0x01, 0x02, 0x04, 0x08,
+    0x48, 0xe4, 0x66, 0x04, 0x84, 0x24, 0x24, 0x21, 0x21, 0x21, 0x0c, 0x0c, 0x70, 0x84, 0x84, 0x24,
+    0x21, 0x81, 0x84, 0x24, 0x84, 0x90, 0xc0, 0x92, 0x12, 0x10, 0x84, 0x84, 0x21, 0x81, 0x21, 0x24,
+    0x0c, 0xcf, 0x1b, 0x66, 0xd8, 0xf3, 0x33, 0x66, 0x6c, 0xcd, 0x99, 0xb3, 0x36, 0xc6, 0xcd, 0x99,
+    0xb1, 0xeb, 0xc6, 0x6c, 0x66, 0xcc, 0xcd, 0x99, 0xb5, 0xe6, 0x33, 0x33, 0x66, 0x33, 0x36, 0xbd,
+    0x7a, 0xf5, 0xb1, 0x98, 0xcc, 0x66, 0xb6, 0xb6, 0x18, 0xcc, 0x63, 0x1a, 0xcd, 0x65, 0x80, 0x5a,
+    0x69, 0x65, 0xa1, 0x6b, 0x4b, 0x5a, 0x42, 0x5b, 0xb4, 0x34, 0x44, 0x89, 0x14, 0x52, 0xb7, 0x6e,
+    0xdc, 0x52, 0x52, 0x76, 0xa8, 0xa5, 0x14, 0x94, 0x94, 0xa5, 0x29, 0xc5, 0x3b, 0x54, 0x52, 0x76,
+    0xed, 0xc7, 0x14, 0xa5, 0x38, 0xa5, 0x2b, 0x71, 0xda, 0xa2, 0x94, 0x94, 0x94, 0xa3, 0x89, 0xda,
+    0x95, 0xb8, 0x94, 0x92, 0x89, 0x44, 0x8a, 0xdc, 0x89, 0x24, 0x4a, 0x24, 0x88, 0xad, 0x5b, 0xb4,
+    0x88, 0x91, 0x24, 0x4b, 0x76, 0x85, 0xa0, 0x00, 0x1a, 0xd6, 0xb0, 0x1a, 0xc0, 0xcc, 0x35, 0xe0,
+    0x83, 0x18, 0xcc, 0x33, 0x6b, 0xd7, 0xaf, 0x5e, 0xbc, 0x6c, 0x6c, 0x6c, 0xcc, 0xcc, 0xcc, 0xf5,
+    0xb3, 0x66, 0x6c, 0xcf, 0x5e, 0x66, 0xcd, 0x99, 0xb3, 0x3d, 0x7a, 0xf3, 0x33, 0x66, 0x6c, 0xd8,
+    0xf1, 0xb6, 0x3c, 0x6c, 0xcc, 0xd8, 0xf5, 0xeb, 0xd7, 0x8d, 0x99, 0x9b, 0x33, 0x66, 0x6c, 0xcc,
+    0xd9, 0x99, 0x9b, 0x1b, 0x31, 0xb1, 0xb5, 0xeb, 0xd7, 0xad, 0x8d, 0x8d, 0xaf, 0x5e, 0xb6, 0x33,
+    0x31, 0x98, 0xf5, 0x98, 0xcc, 0x6c, 0x63, 0x66, 0x36, 0x33, 0x31, 0x86, 0x6b, 0x06, 0xb2, 0xcb,
+    0x5a, 0xd6, 0x80, 0x9a, 0x0b, 0x20, 0x41, 0x0a, 0xd5, 0xe0, 0xb7, 0x6a, 0xdd, 0xa8, 0x8e, 0xd5,
+    0x6e, 0x25, 0x12, 0x45, 0x22, 0x76, 0xa4, 0x94, 0x93, 0xb7, 0x1c, 0x54, 0x76, 0xe2, 0x92, 0x52,
+    0x52, 0x52, 0x52, 0x52, 0x51, 0xdb, 0x89, 0x48, 0xa4, 0x52, 0x92, 0x52, 0x80, 0x94, 0x92, 0x51,
+    0x48, 0xa2, 0x8a, 0x1d, 0xab, 0x76, 0xa2, 0x28, 0x8a, 0x22, 0x48, 0x96, 0xa1, 0x5a, 0x44, 0xb7,
+    0x69, 0x24, 0x8a, 0xd4, 0x44, 0x5a, 0xb4, 0x16, 0x80, 0x00, 0x69, 0xad, 0x60, 0x35, 0x80, 0xc0,
+    0xc1, 0xb5, 0x92, 0xc6, 0x36, 0x31, 0xb5, 0xb5, 0xeb, 0xd6, 0xc6, 0x66, 0x1b, 0x5e, 0xb6, 0x33,
+    0x33, 0x6b, 0xd7, 0x8c, 0xcc, 0xd8, 0xd8, 0xf5, 0xe3, 0x66, 0x66, 0x6c, 0x6d, 0xaf, 0x33, 0x36,
+    0x3d, 0x6c, 0xd8, 0xcd, 0x8d, 0xaf, 0x19, 0x8d, 0x8d, 0x8d, 0x8d, 0x99, 0xb3, 0x66, 0x66, 0xcc,
+    0xcc, 0xcd, 0x8c, 0xcc, 0xc6, 0xd7, 0xaf, 0x59, 0x9a, 0xf5, 0xb5, 0xeb, 0x6b, 0x63, 0x19, 0x98,
+    0xcc, 0x66, 0x33, 0x0c, 0xc6, 0x31, 0x98, 0xcc, 0xcc, 0xc6, 0x66, 0x33, 0x0c, 0x18, 0x0d, 0x6b,
+    0x2c, 0x58, 0x16, 0x16, 0x5a, 0xd6, 0xb4, 0xd0, 0x5a, 0x08, 0x47, 0xad, 0x12, 0x5b, 0x84, 0x8b,
+    0x50, 0xed, 0x15, 0xa8, 0x8a, 0xd4, 0x8a, 0x45, 0x22, 0x8a, 0x25, 0x6e, 0x25, 0x14, 0x92, 0x92,
+    0x92, 0x92, 0x4a, 0x28, 0xad, 0xc4, 0x51, 0x22, 0x89, 0x24, 0xa2, 0x92, 0x4e, 0xd4, 0x92, 0x49,
+    0x1d, 0xa5, 0x11, 0x42, 0x88, 0x89, 0x16, 0xed, 0x5a, 0x84, 0x89, 0x12, 0x24, 0x3b, 0x49, 0x6e,
+    0xd2, 0x24, 0x2b, 0x56, 0xed, 0x22, 0x21, 0x05, 0xa6, 0x82, 0xc1, 0x60, 0x06, 0x8d, 0x1a, 0x6b,
+    0x5a, 0xd6, 0xb0, 0x6b, 0x1a, 0xda, 0xcc, 0x16, 0x1b, 0x5b, 0x19, 0x8c, 0x36, 0x1b, 0x0c, 0x36,
+    0x19, 0x98, 0xcc, 0xcc, 0xcc, 0x6c, 0x66, 0x66, 0x66, 0x63, 0x66, 0x3d, 0x6d, 0x8d, 0x99, 0x9b,
+    0x5e, 0x33, 0x63, 0x33, 0x19, 0x98, 0xcc, 0xc6, 0x68, 0x0c, 0xc6, 0xc6, 0x6c, 0x6c, 0xc7, 0xaf,
+    0x5e, 0xbc, 0x66, 0x66, 0x3d, 0x66, 0xd6, 0xc6, 0x6b, 0xd6, 0xd6, 0xc6, 0x31, 0x8c, 0xc3, 0x31,
+    0x8c, 0xc6, 0x63, 0x31, 0x8c, 0x63, 0x35, 0x98, 0xd7, 0xac, 0x66, 0x31, 0x8c, 0x66, 0xb3, 0x2d,
+    0xa6, 0x2c, 0x00, 0x01, 0x62, 0xcb, 0x2d, 0x65, 0xad, 0x69, 0xa2, 0xd6, 0x96, 0x96, 0x93, 0x34,
+    0x85, 0x6a, 0xdd, 0xa2, 0x22, 0xb5, 0x6a, 0xdd, 0xa2, 0x48, 0x91, 0x44, 0x8a, 0xdc, 0x47, 0x6a,
+    0x28, 0x94, 0x4a, 0x3b, 0x76, 0xa4, 0x92, 0xb5, 0x24, 0x8a, 0x24, 0x91, 0x24, 0x49, 0x22, 0x89,
+    0x24, 0x91, 0x44, 0x91, 0xda, 0x49, 0x6e, 0xd4, 0x44, 0xb7, 0x6a, 0xd4, 0x25, 0xbb, 0x44, 0xb7,
+    0x68, 0x90, 0x91, 0x6e, 0xd5, 0xab, 0x56, 0xad, 0x21, 0x16, 0xed, 0x08, 0x42, 0xd2, 0xd0, 0x40,
+    0x5a, 0x00, 0x00, 0x06, 0x9a, 0xcb, 0x16, 0x34, 0x6b, 0x58, 0x1a, 0xcb, 0xd3, 0x0d, 0x6d, 0x66,
+    0x18, 0x6b, 0x19, 0xaf, 0x5b, 0x5b, 0x0c, 0x63, 0x19, 0xad, 0x86, 0xd6, 0xc6, 0x63, 0x6b, 0x66,
+    0x31, 0x99, 0x8d, 0xaf, 0x5b, 0x31, 0xb1, 0xb1, 0x99, 0x99, 0xaf, 0x0d, 0xaf, 0x5b, 0x19, 0x8c,
+    0x6c, 0x36, 0xbd, 0x66, 0x63, 0x31, 0xb5, 0xe1, 0xeb, 0x63, 0x36, 0xbd, 0x6c, 0x3d, 0x66, 0x1b,
+    0x5b, 0x5b, 0x0c, 0xd6, 0xc3, 0x35, 0xb0, 0xc6, 0x1b, 0x58, 0xc6, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+    0x35, 0x9a, 0xda, 0xc3, 0x5b, 0x58, 0xd7, 0xad, 0x7a, 0xcd, 0x66, 0x0c, 0x1a, 0xc0, 0x1a, 0x34,
+    0x1a, 0x01, 0x60, 0xb1, 0x65, 0x96, 0x9a, 0x16, 0xb5, 0x6b, 0x76, 0x43, 0x41, 0x10, 0x88, 0x84,
+    0x82, 0x5a, 0xb4, 0x88, 0x88, 0xad, 0x25, 0xa8, 0x89, 0x12, 0xdc, 0x80, 0x56, 0xed, 0xda, 0x91,
+    0x24, 0x91, 0x24, 0x49, 0x12, 0xdc, 0x24, 0x4b, 0x76, 0xad, 0x44, 0x48, 0x92, 0xdc, 0x48, 0x95,
+    0xa8, 0x91, 0x22, 0x22, 0x25, 0xa8, 0x42, 0xb4, 0xb5, 0x69, 0x08, 0x44, 0x44, 0x25, 0xa8, 0x42,
+    0x20, 0x89, 0xbb, 0x42, 0x12, 0xd2, 0xd2, 0xd1, 0x6b, 0x56, 0x5a, 0xd3, 0x40, 0xd0, 0xd1, 0xad,
+    0x35, 0xa6, 0xb4, 0xd6, 0xb5, 0xac, 0x03, 0x58, 0x30, 0x61, 0x35, 0x9a, 0xda, 0xc6, 0x1a, 0xf5,
+    0x8c, 0x30, 0x63, 0x0c, 0xd6, 0x63, 0x18, 0xc6, 0x30, 0xda, 0xda, 0xda, 0xf5, 0x99, 0xaf, 0x5b,
+    0x19, 0x98, 0xcc, 0xc6, 0xd6, 0xd7, 0xad, 0xaf, 0x5b, 0x5e, 0xb3, 0x35, 0xeb, 0x33, 0x5b, 0x0c,
+    0xc3, 0x6b, 0xd6, 0x63, 0x33, 0x19, 0x99, 0x8c, 0xc6, 0xc3, 0x6b, 0xd6, 0x63, 0x1a, 0xf5, 0x98,
+    0x61, 0x98, 0x33, 0x5b, 0x58, 0xc6, 0x18, 0xc6, 0x18, 0xd7, 0xac, 0x61, 0xaf, 0x4c, 0xd6, 0x18,
+    0xc3, 0x1a, 0xf5, 0x8c, 0x6b, 0x6b, 0x0d, 0x65, 0x86, 0x80, 0x34, 0x01, 0xa6, 0x58, 0x10, 0x00,
+    0x16, 0x80, 0xb4, 0xd6, 0x8b, 0x42, 0x04, 0x5a, 0x22, 0xd2, 0xd5, 0xa2, 0x11, 0x04, 0x82, 0x45,
+    0xbb, 0x44, 0x44, 0x84, 0x96, 0xed, 0x5b, 0xb4, 0x91, 0x22, 0xb5, 0x11, 0x5a, 0xb5, 0x11, 0x11,
+    0x12, 0x12, 0x25, 0xa8, 0x56, 0xa1, 0x5b, 0xb4, 0x91, 0x5a, 0x89, 0x6e, 0xd4, 0x24, 0x22, 0x2d,
+    0x5a, 0x5a, 0xb4, 0xb4, 0x85, 0xbb, 0x42, 0x21, 0x11, 0x6a, 0xd5, 0xa2, 0xd5, 0xa2, 0xd5, 0xad,
+    0x5a, 0x2d, 0x5a, 0x12, 0xd1, 0x09, 0xbb, 0x26, 0x8b, 0x2c, 0xb2, 0xd6, 0x59, 0x65, 0x96, 0xb4,
+    0xd3, 0x40, 0x30, 0xd4, 0x0d, 0x6b, 0x59, 0x61, 0xa6, 0xb5, 0x8d, 0x60, 0xc1, 0x83, 0x0c, 0x19,
+    0xac, 0x61, 0x86, 0x19, 0xac, 0x63, 0x0c, 0xd6, 0x61, 0x98, 0xc6, 0x31, 0x8d, 0xac, 0xc6, 0x63,
+    0x19, 0x8c, 0xcd, 0x7a, 0xcc, 0x66, 0x19, 0x86, 0x63, 0x5e, 0xb3, 0x0d, 0xac, 0xc6, 0x6b, 0x61,
+    0x98, 0x7a, 0xc6, 0x63, 0x31, 0x98, 0x66, 0x31, 0xaf, 0x58, 0xd6, 0xd6, 0x6b, 0x6b, 0x18, 0x63,
+    0x5b, 0x58, 0xd6, 0xd6, 0x61, 0xad, 0xad, 0xac, 0x6b, 0x6b, 0x1a, 0xcd, 0x61, 0x83, 0x5b, 0x5a,
+    0xda, 0xc6, 0x0c, 0x35, 0x9a, 0xd6, 0x03, 0x4d, 0x35, 0xa6, 0x9a, 0x34, 0xd3, 0x5a, 0xd6, 0xb2,
+    0xc5, 0xab, 0x5a, 0x6b, 0x40, 0x16, 0x9a, 0x0b, 0x45, 0xa2, 0xd0, 0xb4, 0xb4, 0x41, 0x08, 0xb5,
+    0x68, 0x45, 0xab, 0x44, 0x42, 0x22, 0xdd, 0xa2, 0xb4, 0x48, 0x48, 0x56, 0xad, 0xda, 0x44, 0x85,
+    0x08, 0x96, 0xad, 0x5a, 0xb4, 0x48, 0x44, 0x44, 0x44, 0x44, 0xb5, 0x6e, 0xd2, 0x22, 0x24, 0x44,
+    0x42, 0x5a, 0x5a, 0x5a, 0xb4, 0x22, 0xd5, 0xa2, 0x08, 0x82, 0x2d, 0x5a, 0x2d, 0x5a, 0x20, 0x84,
+    0xdd, 0x90, 0xb4, 0xb4, 0x11, 0x68, 0xb4, 0x5a, 0x0b, 0x46, 0xec, 0x2c, 0xb2, 0xd6, 0xb5, 0x96,
+    0xb2, 0xd6, 0x5a, 0xcb, 0x5a, 0xcb, 0x58, 0x6b, 0x2c, 0x01, 0xad, 0x6b, 0x0d, 0x60, 0xc1, 0xac,
+    0xd6, 0x0c, 0x30, 0x61, 0x83, 0x18, 0x31, 0x86, 0x18, 0xd6, 0xd6, 0xd6, 0x31, 0x8c, 0x63, 0x5e,
+    0xb3, 0x5e, 0xb3, 0x5b, 0x18, 0x6d, 0x6d, 0x7a, 0xc6, 0x61, 0x8c, 0x61, 0x9a, 0xda, 0xda, 0xcd,
+    0x6c, 0x31, 0x86, 0x61, 0x8c, 0xd6, 0xd6, 0xd7, 0xac, 0x66, 0x19, 0x86, 0x31, 0xad, 0xac, 0x60,
+    0xc6, 0x10, 0x18, 0xd6, 0xd6, 0x35, 0x9a, 0xc6, 0x0c, 0x60, 0xc3, 0x1a, 0xc6, 0x5e, 0x98, 0x32,
+    0xf4, 0xd6, 0x6b, 0x06, 0x1a, 0xc3, 0x03, 0x58, 0x06, 0x9a, 0xd6, 0xb5, 0xad, 0x69, 0xad, 0x35,
+    0xa6, 0xb4, 0xd6, 0xb5, 0xad, 0x6e, 0xd6, 0x9a, 0x68, 0x0b, 0x2d, 0x34, 0xb2, 0x0b, 0x45, 0xa0,
+    0x82, 0x16, 0x88, 0x2d, 0xd9, 0x16, 0x88, 0x42, 0xdd, 0x92, 0xd2, 0xd5, 0xa4, 0x22, 0x12, 0xd4,
+    0x2d, 0xda, 0x45, 0xbb, 0x48, 0x48, 0x44, 0x5a, 0x9b, 0xb4, 0x45, 0xbb, 0x42, 0x42, 0x21, 0x20,
+    0xad, 0x21, 0x2d, 0x42, 0x22, 0x2d, 0xda, 0x11, 0x69, 0x69, 0x68, 0x82, 0x10, 0x85, 0xab, 0x22,
+    0x6e, 0xd6, 0xad, 0x08, 0x42, 0xd1, 0x69, 0x6b, 0x4b, 0x5a, 0x5a, 0xd5, 0x90, 0x4d, 0x5a, 0xd1,
+    0x6b, 0x40, 0xb5, 0xad, 0x69, 0xa6, 0x9a, 0x6b, 0x4d, 0x6b, 0x5a, 0xd6, 0xb5, 0xad, 0x6b, 0x5a,
+    0xc6, 0xb5, 0x96, 0x00, 0x6b, 0x58, 0x6b, 0x59, 0xa6, 0x1a, 0xc1, 0x97, 0xa6, 0x1a, 0xc6, 0x5e,
+    0x98, 0xd6, 0x6b, 0x1a, 0xda, 0xc3, 0x06, 0x30, 0xc3, 0x18, 0x66, 0xb3, 0x0c, 0x33, 0x0c, 0x61,
+    0xb5, 0x8c, 0x61, 0x9a, 0xcd, 0x6d, 0x66, 0xb6, 0xb1, 0x86, 0x35, 0xeb, 0x0c, 0xd6, 0x61, 0x8d,
+    0x7a, 0xc6, 0x30, 0xcd, 0x6d, 0x66, 0xb6, 0xb1, 0x86, 0x0c, 0x6b, 0x1a, 0xcd, 0x63, 0x06, 0x1a,
+    0xc6, 0x0c, 0x18, 0x6b, 0x35, 0x8d, 0x63, 0x58, 0x60, 0x65, 0xe9, 0xac, 0x35, 0x83, 0x58, 0x6b,
+    0x06, 0xb1, 0x7a, 0x1a, 0xd6, 0x59, 0x62, 0xc5, 0x96, 0x5a, 0xcb, 0x5a, 0xd6, 0xb4, 0xd6, 0x9a,
+    0x68, 0xb5, 0xa6, 0x80, 0x2d, 0x69, 0xbb, 0x2d, 0x04, 0xd2, 0xd6, 0x8b, 0x42, 0xd0, 0xb4, 0xb4,
+    0x2d, 0x5a, 0x02, 0x26, 0xec, 0x8b, 0x4b, 0x45, 0xa4, 0x11, 0x08, 0x44, 0x21, 0x2d, 0x21, 0x09,
+    0x69, 0x08, 0x44, 0x2d, 0xda, 0xdd, 0xa1, 0x10, 0xb5, 0x37, 0x68, 0xb5, 0x69, 0x6a, 0xd2, 0xd5,
+    0xa5, 0xab, 0x44, 0x42, 0xdd, 0x92, 0xd0, 0x85, 0xab, 0x22, 0xd2, 0xd0, 0xb4, 0xb4, 0x5a, 0x10,
+    0x41, 0x05, 0xa5, 0xa1, 0x35, 0x6b, 0x45, 0xa6, 0xec, 0xb4, 0x13, 0x45, 0xad, 0x0b, 0x5a, 0x16,
+    0x5a, 0x68, 0x68, 0x00, 0x03, 0x43, 0x46, 0x9a, 0xd3, 0x5a, 0xd6, 0xb0, 0x1a, 0xd6, 0xb1, 0x60,
+    0xd6, 0xb0, 0x6b, 0x2f, 0x4d, 0x61, 0xac, 0x1a, 0xc6, 0xb0, 0x6b, 0x35, 0x86, 0xb3, 0x58, 0x60,
+    0xc1, 0x83, 0x18, 0x30, 0xc6, 0xb6, 0xb0, 0xc6, 0x18, 0x61, 0x9a, 0xc6, 0x35, 0xb5, 0x8c, 0x35,
+    0xe9, 0x9a, 0xc6, 0x18, 0x6b, 0xd3, 0x35, 0x9a, 0xcd, 0x66, 0xb3, 0x5b, 0x58, 0xc3, 0x0c, 0x6b,
+    0x6b, 0x18, 0x6b, 0x32, 0xf4, 0xc6, 0xb1, 0xac, 0x30, 0xd6, 0x35, 0x86, 0x5e, 0x98, 0x6b, 0x35,
+    0x83, 0x2f, 0x4c, 0x35, 0x86, 0xb0, 0xd6, 0x0d, 0x60, 0xd6, 0x03, 0x2c, 0x35, 0xac, 0x0d, 0x6b,
+    0x58, 0x01, 0xa0, 0xd0, 0x68, 0x00, 0x58, 0x2c, 0xb5, 0x96, 0x9a, 0x02, 0xd6, 0xb4, 0xd0, 0x5a,
+    0xd0, 0x26, 0x8b, 0x4d, 0xd9, 0x68, 0x2d, 0x16, 0xb4, 0xb4, 0x10, 0x5b, 0xb2, 0x6e, 0xc8, 0x41,
+    0x6a, 0xd0, 0x85, 0xa4, 0x10, 0x84, 0x5a, 0x5a, 0x5a, 0xb4, 0x5a, 0x41, 0x16, 0x96, 0x96, 0x96,
+    0x8b, 0x56, 0x84, 0x21, 0x0b, 0x56, 0x8b, 0x56, 0x8b, 0x56, 0x88, 0x25, 0xa1, 0x0b, 0x4b, 0x45,
+    0xa2, 0xd1, 0x68, 0x5a, 0x5a, 0xd2, 0xd1, 0x00, 0xb5, 0x64, 0x2d, 0x0b, 0x45, 0xa6, 0xec, 0x81,
+    0x01, 0x35, 0x65, 0xa0, 0x5a, 0x69, 0x65, 0xad, 0x0b, 0x2d, 0x68, 0x01, 0x62, 0xc5, 0x8b, 0x16,
+    0x00, 0x01, 0xa3, 0x4d, 0x6b, 0x2c, 0x01, 0xad, 0x6b, 0x00, 0xd6, 0x2f, 0x4d, 0x60, 0xd6, 0xb3,
+    0x4c, 0x06, 0x06, 0xb1, 0xac, 0x18, 0x35, 0x8d, 0x61, 0x96, 0xd6, 0x1a, 0xcd, 0x63, 0x58, 0xd6,
+    0xd6, 0xb6, 0xb0, 0xc3, 0x0c, 0x18, 0xd6, 0x6b, 0x35, 0x86, 0x18, 0x30, 0xc1, 0x86, 0x0c, 0x30,
+    0x61, 0x83, 0x0c, 0x30, 0x63, 0x59, 0xac, 0x65, 0xe9, 0x8d, 0x63, 0x58, 0xd6, 0x1a, 0xc6, 0xb0,
+    0xd6, 0x1a, 0xc3, 0x58, 0x6b, 0x1a, 0xc1, 0xac, 0x35, 0x86, 0xb0, 0x6b, 0x03, 0x58, 0x69, 0x80,
+    0x6b, 0x01, 0xad, 0x60, 0x1a, 0xcb, 0x00, 0x0d, 0x1a, 0x1a, 0x34, 0x34, 0x00, 0x2c, 0x59, 0x6b,
+    0x5a, 0x69, 0xa0, 0x59, 0x69, 0xa0, 0x5a, 0xd0, 0x2d, 0x01, 0x68, 0x59, 0x02, 0x68, 0xb4, 0x16,
+    0x8b, 0x41, 0x68, 0xb4, 0x2d, 0x16, 0x84, 0x16, 0x96, 0x8b, 0x4b, 0x41, 0x16, 0x96, 0x8b, 0x4b,
+    0x42, 0x16, 0x88, 0x2d, 0x5a, 0xd5, 0xa1, 0x69, 0x68, 0xb4, 0x5a, 0x5a, 0x10, 0x42, 0x6e, 0xd0,
+    0xb4, 0xb4, 0x5a, 0x5a, 0xd5, 0xad, 0x59, 0x0b, 0x42, 0xd0, 0xb4, 0x2d, 0x04, 0xd5, 0x90, 0x20,
+    0x5a, 0x2d, 0x68, 0x5a, 0x05, 0xa0, 0xb4, 0xd0, 0xb5, 0xa0, 0x2d, 0x68, 0x05, 0x93, 0x40, 0x16,
+    0x5a, 0xcb, 0x5a, 0xd6, 0xb5, 0x96, 0xb2, 0xc5, 0x85, 0x81, 0xa1, 0xa6, 0xb5, 0xac, 0xb1, 0x6d,
+    0x1a, 0xd6, 0x01, 0xad, 0x60, 0xd4, 0x0d, 0x61, 0xa6, 0x03, 0x2c, 0x6b, 0x58, 0x6b, 0x0d, 0x60,
+    0xd6, 0x35, 0xac, 0xd6, 0x06, 0x0c, 0x1a, 0xc6, 0x5b, 0x58, 0x30, 0x60, 0xc3, 0x59, 0xac, 0x35,
+    0x9a, 0xc3, 0x59, 0xac, 0x35, 0x8d, 0x66, 0xb5, 0xb5, 0xac, 0xd6, 0x18, 0x18, 0x65, 0xb5, 0x86,
+    0xb3, 0x58, 0x6b, 0x35, 0x83, 0x06, 0xb1, 0xac, 0x35, 0x81, 0x83, 0x58, 0x35, 0x83, 0x58, 0x35,
+    0x86, 0xb2, 0xda, 0x62, 0xf4, 0xd6, 0x0d, 0x65, 0x9a, 0x6b, 0x01, 0xac, 0xb0, 0x69, 0xac, 0xb0,
+    0x69, 0xad, 0x62, 0xc0, 0xd0, 0xd1, 0xa6, 0x9a, 0x68, 0xd0, 0xd0, 0x00, 0xb1, 0x6b, 0x2d, 0x34,
+    0xd0, 0x02, 0xd6, 0xb4, 0x0b, 0x5a, 0xd0, 0x5a, 0xd0, 0x2d, 0x01, 0x69, 0xab, 0x2d, 0x0b, 0x5a,
+    0x5a, 0xd0, 0xb4, 0x2d, 0x69, 0x6b, 0x4b, 0x5a, 0x2d, 0x0b, 0x42, 0xd2, 0xd6, 0x96, 0x85, 0xa2,
+    0xd1, 0x68, 0x5a, 0x10, 0x20, 0x81, 0x05, 0xa5, 0xad, 0x59, 0x04, 0x08, 0x20, 0xb4, 0x5a, 0x2d,
+    0x04, 0x16, 0x84, 0xd5, 0x90, 0x26, 0xac, 0xb4, 0x5a, 0xd1, 0x6b, 0x42, 0xd6, 0x8b, 0x5a, 0x0b,
+    0x40, 0xb4, 0x0b, 0x5a, 0x16, 0x4d, 0x05, 0xad, 0x34, 0x16, 0x4d, 0x68, 0x0b, 0x2d, 0x68, 0xd0,
+    0x05, 0x8b, 0x16, 0x2c, 0xb0, 0xb0, 0x2c, 0x0d, 0x06, 0x9a, 0x6b, 0x2c, 0xb1, 0x61, 0xa3, 0x5a,
+    0xcb, 0x0d, 0x35, 0xac, 0x0d, 0x6b, 0x03, 0x5a, 0xc1, 0xad, 0x60, 0xd6, 0xb1, 0xa6, 0x06, 0x59,
+    0xa6, 0x06, 0xb0, 0xd6, 0xb6, 0x9a, 0xcd, 0x30, 0x6b, 0x1a, 0xc1, 0x81, 0xac, 0xd6, 0xb3, 0x5a,
+    0xcd, 0x6b, 0x35, 0x97, 0xa6, 0x06, 0x0d, 0x61, 0xac, 0x35, 0x83, 0x40, 0x5b, 0x5a, 0xc6, 0xb0,
+    0x65, 0xb5, 0xac, 0x6b, 0x06, 0xb0, 0xd6, 0x1a, 0xcb, 0x69, 0x80, 0xcb, 0x34, 0xc0, 0x6b, 0x03,
+    0x58, 0x1a, 0xcb, 0x34, 0xcb, 0x1a, 0x6b, 0x01, 0xad, 0x60, 0x69, 0xac, 0x2d, 0xa3, 0x4c, 0xb2,
+    0xc1, 0xa3, 0x4c, 0xb5, 0x8b, 0x00, 0x0d, 0x00, 0xd0, 0x00, 0x58, 0x2c, 0xb2, 0xd6, 0xb5, 0xa3,
+    0x40, 0x16, 0x5a, 0xd6, 0x80, 0xb2, 0xd3, 0x45, 0x8b, 0x40, 0x5a, 0xd0, 0x2c, 0x80, 0xb5, 0xa5,
+    0x96, 0x85, 0x90, 0x2d, 0x05, 0xa0, 0x5a, 0x16, 0xb4, 0xb2, 0x0b, 0x41, 0x34, 0xb4, 0xdd, 0x96,
+    0x85, 0xa0, 0xb4, 0x59, 0x0b, 0x5a, 0xb2, 0xd1, 0x6b, 0x45, 0xa6, 0xec, 0xb4, 0x2d, 0x05, 0xa1,
+    0x68, 0x10, 0x13, 0x56, 0x4d, 0x59, 0x68, 0x5a, 0xd0, 0xb2, 0x05, 0xa6, 0x96, 0x4d, 0x0b, 0x5a,
+    0x05, 0xad, 0x01, 0x68, 0xd5, 0x8b, 0x4d, 0x05, 0x96, 0x9a, 0x02, 0xcb, 0x5a, 0xd0, 0xd0, 0xb1,
+    0x65, 0xad, 0x69, 0xa6, 0x86, 0x80, 0x0d, 0x00, 0xd0, 0xd1, 0xa3, 0x5a, 0xd6, 0xb5, 0x96, 0x16,
+    0x34, 0x34, 0xd6, 0xb2, 0xc0, 0x35, 0xad, 0x60, 0x1a, 0xd6, 0x01, 0xad, 0x60, 0x69, 0x8b, 0x68,
+    0xcb, 0x0d, 0x6b, 0x06, 0xb5, 0x8d, 0x32, 0xda, 0x32, 0xcd, 0x32, 0xcd, 0x30, 0x35, 0x83, 0x58,
+    0x1a, 0xc3, 0x5a, 0xc6, 0xb5, 0x8d, 0x30, 0x35, 0x86, 0xb5, 0x86, 0xb0, 0x35, 0x81, 0xac, 0x35,
+    0xac, 0x35, 0x81, 0xac, 0x0d, 0x60, 0x65, 0x86, 0xb5, 0x86, 0xb5, 0x80, 0xcb, 0x06, 0xb2, 0xc6,
+    0x9a, 0xc0, 0x35, 0x80, 0x35, 0x96, 0x1a, 0x6b, 0x59, 0x63, 0x46, 0xb5, 0x8b, 0x06, 0xa0, 0x1a,
+    0xd6, 0xb2, 0xc2, 0xc3, 0x41, 0xa6, 0xb4, 0xd6, 0xb2, 0xd6, 0x5a, 0xcb, 0x2c, 0x59, 0x65, 0xac,
+    0xb5, 0xad, 0x6b, 0x4d, 0x68, 0xd0, 0x02, 0xcb, 0x2d, 0x68, 0xd0, 0x16, 0x5a, 0xd1, 0xa2, 0xc5,
+    0xa6, 0x80, 0xb5, 0xad, 0x0b, 0x2d, 0x68, 0x59, 0x69, 0xab, 0x16, 0x81, 0x6b, 0x41, 0x6b, 0x41,
+    0x6b, 0x41, 0x68, 0x0b, 0x40, 0xb4, 0xd5, 0x96, 0x82, 0xd6, 0x85, 0xa6, 0x96, 0x5a, 0x16, 0x40,
+    0x5a, 0x05, 0xa0, 0x2d, 0x02, 0xd0, 0x16, 0x81, 0x6b, 0x42, 0xd6, 0x80, 0xb4, 0x05, 0xad, 0x05,
+    0x91, 0xa5, 0x96, 0xb4, 0x0b, 0x26, 0x82, 0xcb, 0x4d, 0x02, 0xcb, 0x4d, 0x00, 0xb5, 0xad, 0x68,
+    0x01, 0x62, 0xd6, 0xb4, 0xd0, 0xd0, 0x0b, 0x05, 0x96, 0x59, 0x6b, 0x2d, 0x6b, 0x5a, 0xd6, 0xb2,
+    0xd6, 0xb2, 0xd6, 0x59, 0x62, 0xc0, 0x00, 0x68, 0xd6, 0xb5, 0x96, 0x16, 0x34, 0x69, 0xac, 0xb0,
+    0x06, 0x99, 0x65, 0x86, 0x9a, 0xd6, 0x59, 0xa3, 0x5a, 0xc0, 0x69, 0x8b, 0x34, 0xd6, 0xb0, 0x35,
+    0x96, 0x1a, 0x65, 0x86, 0xb5, 0x96, 0xd1, 0x96, 0x0d, 0x6b, 0x03, 0x58, 0xb6, 0x9a, 0xcb, 0x68,
+    0xcb, 0x06, 0xb5, 0x83, 0x4c, 0xb1, 0xa6, 0xb0, 0x35, 0xac, 0x0d, 0x6b, 0x03, 0x5a, 0xc0, 0xd3,
+    0x16, 0xd1, 0xac, 0x59, 0xa6, 0xb5, 0x81, 0xa6, 0x58, 0x0d, 0x32, 0xc0, 0x69, 0xac, 0x58, 0x68,
+    0xd6, 0xb2, 0xc0, 0x69, 0xa6, 0x59, 0x60, 0x03, 0x4d, 0x35, 0xac, 0xb2, 0xc2, 0xc0, 0x00, 0x68,
+    0x68, 0x68, 0xd1, 0xa3, 0x46, 0x86, 0x83, 0x40, 0x01, 0x61, 0x65, 0x96, 0x9a, 0xd3, 0x40, 0x05,
+    0x96, 0xb5, 0xa6, 0x81, 0x00, 0xb2, 0xd6, 0xb4, 0x01, 0x65, 0xa3, 0x42, 0xcb, 0x5a, 0x68, 0xb1,
+    0x69, 0xa0, 0xb2, 0x68, 0x0b, 0x5a, 0x69, 0x62, 0xd0, 0xdd, 0x8b, 0x4d, 0x0b, 0x5a, 0xd0, 0x2d,
+    0x68, 0xdd, 0x8b, 0x5a, 0x05, 0x93, 0x42, 0xcb, 0x5a, 0x0b, 0x2d, 0x00, 0xb5, 0xa0, 0x16, 0x9a,
+    0x0b, 0x2d, 0x1a, 0x58, 0xb4, 0xd0, 0x2c, 0x9a, 0x34, 0xb1, 0x6b, 0x43, 0x76, 0x16, 0x4d, 0x34,
+    0x16, 0x2d, 0x69, 0xa1, 0xab, 0x05, 0xad, 0x6b, 0x4d, 0x00, 0x05, 0x96, 0x5a, 0xd6, 0xb4, 0xd3,
+    0x46, 0x86, 0x80, 0x00, 0x00, 0x16, 0x00, 0x00, 0xd0, 0x1a, 0x1a, 0x69, 0xad, 0x6b, 0x59, 0x65,
+    0x80, 0x01, 0xa6, 0xb5, 0xac, 0xb0, 0x59, 0xa3, 0x4d, 0x6b, 0x2c, 0x01, 0xa6, 0xb5, 0x80, 0x0d,
+    0x6b, 0x58, 0x03, 0x5a, 0xcb, 0x01, 0xad, 0x6b, 0x00, 0xd3, 0x2c, 0x03, 0x5a, 0xd6, 0x06, 0x9a,
+    0xcb, 0x06, 0x9a, 0xd6, 0x01, 0xad, 0x6b, 0x01, 0xa6, 0xb1, 0x63, 0x46, 0xb2, 0xc0, 0x69, 0x96,
+    0x2d, 0xa1, 0xad, 0x61, 0x66, 0x8d, 0x6b, 0x2c, 0x0d, 0x35, 0xad, 0x61, 0x6d, 0x0d, 0x6b, 0x59,
+    0x60, 0x1a, 0x69, 0xac, 0xb1, 0x60, 0x68, 0xd3, 0x5a, 0xd6, 0xb1, 0x60, 0x00, 0x68, 0xd3, 0x5a,
+    0xd3, 0x59, 0x6b, 0x2d, 0x62, 0xcb, 0x16, 0x16, 0x0b, 0x05, 0x82, 0xc2, 0xc5, 0x8b, 0x16, 0x59,
+    0x6b, 0x5a, 0xd6, 0xb4, 0xd6, 0x8d, 0x00, 0x01, 0x62, 0xcb, 0x5a, 0xd3, 0x40, 0xd1, 0x61, 0x65,
+    0xad, 0x34, 0x34, 0xb0, 0x5a, 0xd6, 0xb4, 0x00, 0x59, 0x6b, 0x46, 0x82, 0xcb, 0x2d, 0x1a, 0x05,
+    0x96, 0xb5, 0xa0, 0x05, 0xad, 0x68, 0x13, 0x41, 0x65, 0x96, 0x8d, 0x0b, 0x16, 0x4d, 0x1a, 0x2c,
+    0x59, 0x34, 0x68, 0x2c, 0xb5, 0xad, 0x0d, 0x58, 0x59, 0x69, 0xa1, 0xab, 0x0b, 0x2d, 0x34, 0xd0,
+    0x2c, 0x59, 0x6b, 0x46, 0x80, 0x16, 0x2d, 0x6b, 0x4d, 0x0d, 0x01, 0x61, 0x6b, 0x2d, 0x6b, 0x4d,
+    0x1a, 0x0d, 0x01, 0x60, 0xb1, 0x62, 0xcb, 0x59, 0x6b, 0x5a, 0xd6, 0xb5, 0xad, 0x69, 0xad, 0x35,
+    0xa6, 0xb4, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xb5, 0xad, 0x6b, 0x59, 0x65, 0x96, 0x58, 0xb0, 0x16,
+    0x1a, 0x06, 0x8d, 0x34, 0xd6, 0xb2, 0xd6, 0x2c, 0x00, 0x1a, 0x34, 0xd6, 0xb5, 0x8b, 0x00, 0x06,
+    0x9a, 0xd6, 0xb2, 0xc1, 0x7a, 0x06, 0x9a, 0xd6, 0x58, 0x2d, 0xa0, 0xd3, 0x5a, 0xcb, 0x00, 0x0d,
+    0x35, 0xac, 0xb0, 0xb1, 0xa1, 0xa6, 0xb5, 0x96, 0x00, 0x1a, 0x6b, 0x5a, 0xcb, 0x00, 0x0d, 0x35,
+    0xad, 0x6b, 0x0b, 0x03, 0x43, 0x5a, 0x65, 0xac, 0x58, 0x00, 0x68, 0xd6, 0x9a, 0xcb, 0x2c, 0x58,
+    0x00, 0x68, 0xd3, 0x4d, 0x6b, 0x5a, 0xd6, 0x58, 0xb1, 0x60, 0x00, 0x00, 0xd0, 0x68, 0xd1, 0xa6,
+    0x9a, 0x69, 0xa6, 0x9a, 0xd3, 0x4d, 0x69, 0xad, 0x35, 0xa6, 0x9a, 0xd3, 0x4d, 0x34, 0xd1, 0xa3,
+    0x43, 0x40, 0xd0, 0x00, 0x2c, 0x0b, 0x2c, 0x5a, 0xcb, 0x5a, 0xd3, 0x5a, 0x34, 0x68, 0x00, 0x16,
+    0x2c, 0xb2, 0xd6, 0x9a, 0xd3, 0x41, 0xa0, 0xb0, 0x59, 0x65, 0xad, 0x69, 0xa3, 0x40, 0x01, 0x65,
+    0x96, 0xb5, 0xad, 0x1a, 0x1a, 0x0b, 0x05, 0x96, 0xb2, 0x6b, 0x4d, 0x06, 0x81, 0x61, 0x62, 0xd6,
+    0xb5, 0xad, 0x34, 0xd0, 0x00, 0x0b, 0x16, 0xb2, 0xd6, 0xb4, 0xd3, 0x4d, 0x20, 0x03, 0x45, 0x80,
+    0xb0, 0xb2, 0xcb, 0x5a, 0xcb, 0x4d, 0x69, 0xa6, 0x9a, 0x34, 0x0d, 0x00, 0x00, 0x01, 0x60, 0x58,
+    0x2c, 0x58, 0x58, 0xb1, 0x62, 0xcb, 0x16, 0x2c, 0x58, 0xb1, 0x62, 0xc1, 0x61, 0x60, 0x2c, 0x00,
+    0x00, 0x1a, 0x06, 0x86, 0x9a, 0x34, 0xd3, 0x5a, 0x6b, 0x59, 0x6b, 0x59, 0x65, 0x96, 0x2c, 0x0b,
+    0x00, 0x06, 0x83, 0x46, 0x9a, 0x69, 0xad, 0x6b, 0x5a, 0xcb, 0x2c, 0xb1, 0x60, 0x2c, 0x0d, 0x01,
+    0xa3, 0x4d, 0x35, 0xa6, 0xb5, 0x96, 0xb2, 0xcb, 0x16, 0x05, 0x80, 0x0d, 0x03, 0x43, 0x4d, 0x34,
+    0xd3, 0x5a, 0xd6, 0xb5, 0xad, 0x6b, 0x2d, 0x65, 0x96, 0x58, 0xb2, 0xc2, 0xc1, 0x60, 0x2c, 0x00,
+    0x00, 0x00, 0xd0, 0x0d, 0x03, 0x41, 0xa0, 0xd0, 0xd0, 0xd0, 0xd0, 0xd1, 0xa1, 0xa1, 0xa1, 0xa1,
+    0xa1, 0xa1, 0xa0, 0xd0, 0x68, 0x34, 0x0d, 0x00, 0xd0, 0x03, 0x40, 0x00, 0x00, 0x0b, 0x00, 0xb0,
+    0x2c, 0x2c, 0x58, 0xb2, 0xcb, 0x2c, 0xb2, 0xcb, 0x59, 0x6b, 0x2d, 0x6b, 0x5a, 0xd6, 0xb5, 0xad,
+    0x6b, 0x5a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd3, 0x4d, 0x34, 0xd3, 0x4d, 0x1a, 0x34, 0x68, 0x0d, 0x00,
+    0x00, 0x06, 0x81, 0xa1, 0xa0, 0x68, 0x00, 0x01, 0x60, 0xb1, 0x65, 0xe8, 0xb0, 0x59, 0x62, 0xcb,
+    0x16, 0x2c, 0x58, 0xb1, 0x62, 0xc5, 0x96, 0x58, 0xb2, 0xc5, 0x8b, 0x2c, 0x58, 0xb1, 0x65, 0x8b,
+    0x2c, 0x58, 0xb0, 0xb1, 0x61, 0x62, 0xc2, 0xc2, 0xc1, 0x60, 0x58, 0x16, 0x02, 0xc0, 0x58, 0x00,
+    0x90, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x60, 0x06, 0x00, 0x30, 0x03,
+    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00,
+    0x08, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f,
+    0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xc0,
 };
 
 #endif // KICK_SAMPLE_H
@@ -3,4462 +3,982 @@
 
 #include <stdint.h>
 
+// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).
 const int openhat_sample_len = 44538;
-const int16_t openhat_sample[] = {
-    -2, -18, 28, 84, -28, -167, -145, 187, 335, -273, 
-    -281, 229, 174, 333, -566, -1362, 965, 2406, 366, -2633, 
-    -3498, -406, 4197, 5753, -1673, -9741, -2743, 6118, 5317, 2333, 
-    -5244, -7096, 1798, 3450, 3023, 2006, -6896, -5236, 4155, 4471, 
-    1609, -1622, -1082, 1465, -1887, -106, 3124, -2967, -3699, 2933, 
-    3566, 88, -767, -1237, -2227, -769, 246, 442, 1034, -1111, 
-    -1336, 2058, 2439, 216, -1288, -972, -164, -1092, -199, 2281, 
-    182, -4406, -3773, 3118, 5682, -1017, -3841, 1482, 4498, 678, 
-    -4830, -3537, 2806, 4099, -993, -3277, 840, 2143, -109, 229, 
-    884, 1542, 1468, -68, -770, -2308, -987, 1609, -1952, -2393, 
-    1971, 1010, -676, -291, -307, 1396, 1325, -1064, -1363, -1475, 
-    -1127, 2326, 2759, -3248, -4488, 2740, 4603, -1166, -1732, 1624, 
-    -931, -2638, 228, 734, 2656, 2280, -3700, -3250, 66, 1549, 
-    3095, 1910, 762, -3496, -5196, 2569, 3734, 1284, 2740, -3214, 
-    -7009, -135, 2869, -1058, 859, 5902, -2213, -7346, 2902, 2566, 
-    -2276, 1327, 396, 2165, 1397, -5821, -2925, 2887, 5688, 1618, 
-    -6827, -886, 2807, -3458, 2229, 5064, -6971, -6642, 6165, 1165, 
-    -6001, 4489, 1865, -5880, 3302, 4363, 1268, 2055, -5160, -3071, 
-    62, -5742, 5278, 11593, -5302, -8194, 1140, 725, 5002, 4153, 
-    -5405, -439, 3685, -5137, -4130, 6697, 8662, -1358, -8559, -3241, 
-    -1444, -1762, 7860, 5802, -5682, -3474, 1296, 2230, 204, -4445, 
-    2040, 7349, -1616, -5264, 678, -623, -7399, 851, 10085, -662, 
-    -4147, -943, -5514, 3602, 7759, -5068, -4657, 2224, 1683, -1914, 
-    -2474, 5331, 1268, -10029, 1428, 9837, -3593, -4146, 7100, 1456, 
-    -7741, -1601, 5682, 1307, -5262, -1375, 5950, -480, -8149, 1918, 
-    6979, -2860, -2588, 3305, 1876, -1566, -4177, 2588, 7247, -4597, 
-    -9082, 382, 6577, 1718, -7573, -1097, 7687, 391, -4531, -1214, 
-    3709, 2107, -5330, -1984, 3644, 1964, 494, -2055, -3012, 220, 
-    3174, 180, -7088, -2410, 8778, 6008, -4922, -8264, 958, 6987, 
-    -2, -3347, -764, 2505, 5062, -857, -4293, 1520, 4603, 1795, 
-    -2513, -2897, 120, 911, 1198, 801, -820, -316, -490, 99, 
-    3318, 646, -4530, -4239, 462, 4155, -648, -3832, 2393, 3514, 
-    -990, -2498, -1444, 3133, 6742, 2133, -5511, -4984, 667, 815, 
-    1196, 3708, 443, -1581, -256, -908, -162, 422, 478, 405, 
-    -4139, -4759, 2709, 3422, -2358, -1548, -957, -2403, 3393, 3672, 
-    -3046, -2458, -188, 1831, 5021, 3783, -1739, -6753, -758, 5245, 
-    -1990, -1904, 3791, -1720, -4918, 759, 1902, -2734, 733, 5673, 
-    -2679, -6356, 698, 2018, 3125, 5276, -3030, -8324, 1238, 5790, 
-    -843, -1631, 1336, 24, -2182, -258, 5266, 3342, -4517, -2206, 
-    4261, 289, -2515, 2736, 792, -5313, -3535, 1480, 1758, -4266, 
-    -2452, 6551, -1081, -9425, 3242, 8955, -1924, -5449, -151, 3414, 
-    3565, 1583, 9, -2398, -5622, -476, 9357, 6293, -3029, -2721, 
-    -598, -1668, -211, 1087, 337, 1491, 1140, -3031, -1619, 3941, 
-    1440, -3948, -2824, 1360, 1658, -3856, -3355, 3042, -1402, -2427, 
-    5254, 1666, -2790, -4224, -4354, 6345, 7032, -2772, -2642, 496, 
-    1315, -1522, -1982, 3641, 1769, -1828, -770, -939, 303, 810, 
-    1449, 2778, -535, -2335, -1132, -1340, -1674, -1853, 1623, 4941, 
-    -362, -3387, 2900, 2938, -4303, -2571, 3876, 1801, -1597, -1392, 
-    -2150, 1527, 3097, -3616, -1211, 4150, -150, -1256, 1936, 2109, 
-    -3185, -3846, 5788, 1809, -6438, 2169, 2450, -4844, -1048, 1837, 
-    383, 146, -546, -1192, -1722, -1647, 991, 1546, -2026, 878, 
-    3941, -1809, -1382, 2753, -862, -2924, 686, 4139, 2087, -2042, 
-    -821, 2229, 172, -3557, 1581, 6705, -2838, -5957, 5127, 1431, 
-    -5372, 4576, 1697, -7524, 1519, 2757, -2860, 394, 1151, 3833, 
-    1667, -7875, -4105, 3163, 3024, 520, -3732, -2724, 646, 2054, 
-    2446, -3610, -4888, 3781, 3362, -5587, -4653, 5339, 8150, 74, 
-    -7611, -3555, 5602, 2329, -3174, 1909, 3580, 284, -2576, -2057, 
-    4643, 950, -4854, 5471, 3404, -6941, -448, 635, -254, 4701, 
-    -3886, -7631, 1144, 4443, 2715, -4480, -4566, 6645, 2883, -5896, 
-    847, 5110, -659, -6698, -3395, 6903, 3275, -2700, 2152, -3631, 
-    -6689, 5668, 5800, -3570, -5093, -1873, 2906, 1963, -2461, -482, 
-    1264, -1112, -1375, 2295, 1699, -3408, 2062, 6829, -2453, -4259, 
-    1840, -159, -278, 1889, -1224, 1499, 3160, -3785, -2453, 2231, 
-    2936, 1407, -5708, -2443, 5689, 1355, -1113, -160, -2586, -2346, 
-    1153, 2572, -2651, -3989, 2657, 3432, 125, -2213, -4288, 120, 
-    5927, 2171, -4350, -1583, 3882, 2941, -1403, -5819, -821, 6706, 
-    566, -2116, 1807, -3013, -4058, 744, 2662, 3916, -565, -5657, 
-    -506, 6025, 483, -9747, -884, 11628, 933, -5981, -663, -364, 
-    3694, 3133, -2761, 415, -1659, -4038, 2400, -104, -2454, 3632, 
-    699, -4207, 1265, 4257, 203, -1723, -3129, -960, 4660, -547, 
-    -3381, 2555, -2241, -2993, 5285, 2731, -2373, -2785, -1676, 538, 
-    -36, 1073, 4353, 2334, -1930, -1019, 2679, 1375, -2691, -2231, 
-    980, 59, -4235, -3414, 2649, 5214, 1002, -4061, -1855, 2737, 
-    605, -1975, 605, 1639, -1982, -3385, 602, 2565, 1454, 2589, 
-    614, -5384, -3715, 4228, 4987, -930, -6220, -4010, 5911, 6054, 
-    -95, 1774, -2802, -7846, 743, 5681, 3123, -715, -5332, -3532, 
-    48, -64, 1167, 1855, 206, -1054, -1370, -693, 1638, 4570, 
-    3582, -446, -3170, -4032, 133, 4286, 459, -3056, -2047, -460, 
-    1327, 789, 276, 342, -783, 1681, 2128, -2822, -3184, 2183, 
-    5992, 1901, -4611, -3493, 1744, 5456, 1602, -5244, -1849, -123, 
-    -4667, -1438, 2244, 733, 266, 1410, 523, -2924, -53, 2867, 
-    -714, -608, -1469, -569, 4637, 85, -3971, -597, 1005, 3428, 
-    3027, -2125, -3879, -2433, -129, 978, -373, 167, 2228, 1773, 
-    -761, -1398, 1759, 2398, 73, -486, -2015, -3499, -2608, 164, 
-    4142, 4747, -315, -6803, -3331, 5226, 2333, -776, 887, -1960, 
-    816, 3278, -2149, 72, 3669, -318, -329, 1480, -2508, -4543, 
-    2057, 5156, -2770, -5785, -975, 1948, 3943, 424, -4091, -227, 
-    1330, 645, 3478, 1133, -2764, -1362, 477, 1527, 494, -3158, 
-    -2438, 1349, 950, 672, 1230, -1209, 14, 1027, -3258, -2292, 
-    1001, 1496, 2345, 260, -2683, -3484, 268, 6356, 2167, -4709, 
-    -1450, 2308, -940, -3048, 2144, 3539, -1377, -765, 9, -1510, 
-    1942, 2556, -3017, -4236, 1654, 3399, -2066, -2855, -861, -838, 
-    3539, 4915, -291, -2497, -2757, -1097, 2497, 1048, -48, 1442, 
-    -2595, -3319, 2222, 1148, -529, 4602, 3338, -6287, -4789, 5952, 
-    3019, -3494, 220, 1216, 807, 2521, 113, -1093, 245, -683, 
-    -1442, -102, -688, -1323, 347, 631, 1822, 1864, -3279, -4293, 
-    240, 1597, 970, 2952, 1082, -5202, -2171, 3892, 721, -244, 
-    1436, -785, 802, 1746, -3871, -5373, 510, 3383, 85, -183, 
-    1517, -1806, -2006, 1518, 1518, 1829, -706, -3129, 3516, 1991, 
-    -7178, -1205, 3742, -1195, 1532, -175, -5305, 2489, 4526, -1473, 
-    -1029, 31, 1990, 1131, -3854, 108, 3867, -1029, -1581, 913, 
-    281, 1361, 1175, -1088, 100, -2973, -5002, 4920, 5725, -4069, 
-    -2638, 505, -321, 1860, 603, -1456, 308, 169, -1823, -1039, 
-    2102, 2102, 113, 420, -1433, -3339, 693, 3750, 2045, -1054, 
-    -3254, 417, 3169, -2149, -1786, 3702, 849, -1713, -147, -1168, 
-    830, 3214, -948, -2712, 701, 903, -872, -973, -352, 2091, 
-    408, -5383, -893, 6198, 2592, -748, -1414, -3489, -2330, -284, 
-    243, 1479, 3464, 2087, -3391, -3220, 1643, 1942, 60, -396, 
-    -664, -1050, 1617, 2623, -4875, -6744, 602, 3598, 5008, 2302, 
-    -4541, -622, 3640, -1428, -2183, 1388, 3859, 2011, -5799, -3074, 
-    7606, 1442, -6759, 1164, 2884, -3652, -2661, -370, 1874, 3553, 
-    -1259, -4187, -813, 2364, 1656, 300, 2052, -943, -4447, 1833, 
-    2897, -988, 1389, -1572, -3944, 2024, 3581, 633, -2021, -1061, 
-    369, -3086, 204, 5335, 564, -2405, -1301, -553, 1219, 1105, 
-    395, -280, -2021, -1716, 193, 1303, 844, 302, 805, -213, 
-    -1363, 671, 1277, -1377, -2222, -493, 2404, 2907, -1362, -1674, 
-    2006, 199, -528, 1395, -1796, -1934, 1311, 467, 755, -691, 
-    -4637, -1525, 3362, 2404, -1009, -2032, 666, 1039, -889, 1698, 
-    2334, -3225, -2798, 3983, 2734, -2663, 138, 3942, 797, -3024, 
-    -1861, -28, -1169, -181, 2206, 1162, -599, -1572, -1898, 320, 
-    3643, 1708, -2455, -1792, -2102, -1254, 4302, 2044, -3958, -2618, 
-    -812, 695, 5018, 2755, -3382, -682, 2300, -1345, -1491, 969, 
-    1368, 634, -1071, -1558, -741, 1685, 1807, -2566, -1602, 2157, 
-    145, -1080, 685, -673, -3739, -933, 4526, 2165, -3750, -1302, 
-    4224, -207, -4976, 1889, 5148, -1441, -4014, -1178, 975, 2554, 
-    2478, -666, -1985, -1529, -2463, 956, 4968, 1694, -2523, -3200, 
-    -210, 2598, 902, -1469, -2009, 890, 1696, -3558, -1393, 4201, 
-    1566, 372, 219, -2007, 148, 1349, 142, 148, -470, -832, 
-    -1728, 9, 3732, 681, -2217, -911, -1493, 489, 2091, -1058, 
-    -1929, 775, 3365, 337, -3662, 2444, 4995, -5143, -6265, 3316, 
-    1291, -2033, 4380, 377, -6905, -2578, 1116, 3712, 3154, -1923, 
-    -193, 377, -2449, 734, 1999, 431, 292, -908, 280, 1727, 
-    51, -371, 393, -344, -1757, -55, 1058, -1193, 592, 1961, 
-    -300, 78, -843, -1043, 1653, -502, -1803, 2668, 2941, -1631, 
-    -1843, 929, -947, -2962, 510, 1971, 310, -672, -3213, -2168, 
-    1785, 1178, 765, 1755, 862, 721, 147, -3096, -3920, 2304, 
-    5949, -435, -5271, -2085, 2175, 1764, -546, 1346, 126, -4409, 
-    551, 3797, -1605, -325, 2770, 907, -474, -2786, -1771, 2133, 
-    1312, -875, -1043, 897, 410, -3306, -817, 3770, 3100, 923, 
-    -1763, -3315, -1288, 3645, 4450, -2189, -2997, 757, -2406, -3017, 
-    2951, 4833, -291, -4592, -2220, 1769, 3470, 1092, -3712, -3307, 
-    124, 1791, -14, -2775, 951, 2825, -1030, -425, 1381, 2031, 
-    1808, -1366, -987, 1113, -166, -264, -250, -2807, -1984, 4532, 
-    5027, -3511, -5260, -272, 666, 1976, 2124, -2126, -3927, -1844, 
-    3129, 4223, -1190, -2437, 18, 3494, 3249, -5655, -4805, 4027, 
-    1137, -701, 2831, 244, -1176, 212, -1135, -1954, 419, 2534, 
-    149, 555, 2371, -4038, -4645, 3086, 2758, -167, 746, 784, 
-    -703, -2105, -652, 1139, 1126, 1774, -578, -3565, -14, 2678, 
-    -680, -1458, 1079, 1218, 965, 884, -442, 1, 124, -1952, 
-    184, 3607, 532, -3189, -3529, -754, 5167, 1189, -7214, -538, 
-    4100, -1383, 271, 498, -2879, 53, 214, -1245, 2358, 2559, 
-    -50, 884, 408, -185, 947, -3985, -4613, 3555, 2600, -1917, 
-    -771, 98, 1598, -198, -1893, 2756, 2021, -2502, -1969, -607, 
-    993, 1799, -493, -1218, 837, 1709, 103, -1551, -879, 1025, 
-    641, -2073, -2414, 1040, 3212, 365, -1721, 828, 434, -1758, 
-    1956, 4073, -976, -3996, 101, 4123, 1145, -3840, -2690, 2123, 
-    1824, -1717, -462, 846, -599, -372, -1781, -2030, 1797, 3066, 
-    979, -2005, -1786, 2286, 2110, -2461, -3629, 1323, 4220, -488, 
-    -3007, -563, 265, 1828, 2971, -636, -3009, -1351, -305, 790, 
-    2747, 1920, -1067, -2578, -1039, 2576, 3556, -640, -4847, -3533, 
-    1287, 2902, 323, -444, 744, -1118, -2926, 138, 3357, 1003, 
-    -2001, -683, 47, 36, 1747, 764, -1123, -427, 1005, 930, 
-    -1139, -463, 1026, -1055, -452, 909, -1490, -677, 2255, -143, 
-    -2233, 1365, 2028, -1140, -890, -157, 134, 766, -514, -247, 
-    865, 685, -377, -2711, -20, 3096, -1170, -1255, 1525, -405, 
-    1306, 1696, -2734, -1428, 1121, 259, 92, -292, 902, 2333, 
-    183, -1960, -1385, 2269, 3374, -1794, -3096, -527, -1822, -963, 
-    3161, 1191, -4347, -2414, 3131, 2492, 101, -846, -1646, 953, 
-    3499, -431, -4546, 719, 5504, -343, -3195, 932, 985, -661, 
-    284, 9, -2221, -2162, 477, 1431, 186, 242, 2254, 184, 
-    -4246, -1072, 3408, 1107, -1159, -1251, -1302, -1157, -952, 947, 
-    1989, 245, -931, -503, 1557, 1418, -2198, -586, 4189, 1959, 
-    -2178, -1493, -400, 302, 1985, -39, -2724, 921, 2881, -1660, 
-    -3171, -758, 1436, 2477, -711, -2354, 995, 493, -1702, -76, 
-    605, 728, 686, -649, 244, 280, -1069, -311, -675, -213, 
-    1482, 26, -849, 1042, 1848, -291, -2062, 122, 1846, -811, 
-    -2777, -158, 2290, 1481, 1082, 975, -996, -1685, 119, 1280, 
-    120, -1643, -1264, -53, -243, 607, 2571, 1400, -1605, -828, 
-    574, -766, 1496, 2927, -2485, -4066, -472, 1709, 2028, -759, 
-    -1406, 438, -1601, -1184, 1305, -1085, -1163, 1686, 1041, 525, 
-    702, -323, -315, 43, 1036, 357, -1341, 1283, 40, -4190, 
-    323, 3588, -337, -1834, 211, -235, -2042, 1879, 2852, -3089, 
-    -2002, 1153, 868, 2349, 582, -1610, -223, 596, -669, -2744, 
-    298, 1965, -1381, 2400, 2523, -4930, -2122, 2251, 816, 1516, 
-    -223, -2978, -1203, 1513, 2399, 182, -1721, 552, 2306, -248, 
-    -2605, -1258, 1082, 2786, 1877, -2023, -1765, 2823, 3295, -926, 
-    -3262, -1074, 1552, 1718, -655, -2882, -232, 2011, -1007, -1172, 
-    1799, 1546, 246, -640, -1092, -169, 383, 708, -707, -2609, 
-    659, 2445, -925, -1652, 17, 2431, 1336, -4210, -1321, 4395, 
-    407, -3605, -1520, 1791, 1487, -567, 769, 407, -1260, -1340, 
-    -2933, 1023, 4128, -1743, -963, 1649, -2799, -1313, 2181, 710, 
-    -618, -614, 361, -631, -428, 1932, 123, -506, 1067, 478, 
-    357, -67, 903, 1355, -1687, -792, 2117, -694, -3470, -562, 
-    2630, 2221, -301, -3366, -2184, 1692, 1209, -973, -785, -21, 
-    -183, 148, 2472, 2419, -1705, -2458, 1122, 1966, 608, 710, 
-    643, -1408, -3549, -1139, 3479, 3045, -305, -2124, -1746, 1270, 
-    2610, -1049, -4623, -2389, 1960, 2275, 1044, -509, -3289, -2236, 
-    2692, 4875, 1304, -2843, -2210, -1207, 49, 2538, -554, -2044, 
-    2488, 1673, -1420, 251, 2150, -428, -3854, 646, 4225, -1244, 
-    -3108, -2, 1096, 1305, 42, -2180, -2135, 1052, 2685, 588, 
-    -535, -1212, -2435, -117, 2660, 436, -2536, -993, 1429, 1476, 
-    587, -80, 740, 999, -1238, -1118, 1083, -374, -976, 1289, 
-    -1024, -2396, 1928, 2362, -91, -804, 190, 2437, -1209, -4518, 
-    590, 2256, -22, 6, -1247, -1471, 890, 2538, 1988, -1075, 
-    -2676, 478, 2698, -2109, -4201, 2554, 2792, -3055, -758, 2588, 
-    1026, -1263, -4072, -1802, 3505, 1700, -1316, -610, -1320, -917, 
-    941, 1202, 1954, 751, -1244, 555, 657, -1008, 113, -250, 
-    -1313, 689, 1855, 647, -461, -605, 633, 1675, 203, -1689, 
-    -1070, 934, 2273, 1328, -1749, -2204, 890, 1481, -1194, -1833, 
-    1238, 2999, -765, -3466, 319, 2184, -1378, -1747, 200, -336, 
-    385, 677, -901, -242, 447, -278, 308, 2007, 38, -4373, 
-    -1529, 3623, 1377, -2600, -1798, 2017, 833, -2318, 892, 906, 
-    -1102, 2298, 600, -3148, 240, 3289, 1049, -1150, 945, 1193, 
-    -1931, -2111, -991, 1399, 2108, -2375, -2022, 1592, 334, -649, 
-    -132, 280, 139, -105, 1503, -599, -2659, 1824, 2157, -761, 
-    139, -38, 975, 2020, -1257, -2041, -421, 497, 2377, 1118, 
-    -2745, -1914, 1993, 1425, -1867, -713, 1272, -720, -1180, 998, 
-    1450, 1147, 877, -749, -1929, -467, 1454, 838, -1355, -1502, 
-    1173, 897, -2329, -613, 2254, 1374, 829, -765, -2155, 196, 
-    1138, -817, -1709, -766, -311, -941, -124, 1566, 1608, -672, 
-    -3427, -3066, 572, 3963, 1366, -2807, 1602, 2267, -4491, -287, 
-    4256, -773, -124, 1177, -556, 1190, -829, -650, 3716, -1024, 
-    -3634, 2438, 2749, -514, -1339, -1301, -161, -83, 277, 894, 
-    -1233, -2316, -977, 910, 1690, 270, -492, -186, 767, 1139, 
-    -1075, -652, 1591, 296, -32, 1041, -132, -1066, -720, -25, 
-    914, 1476, 556, -1430, -1914, -732, 1323, 1605, -2331, -2471, 
-    2842, 2364, -2153, -2767, -21, 3126, 1707, -1137, 289, -473, 
-    -2654, 316, 2437, 338, -423, 613, 74, -900, -367, 590, 
-    1055, -271, -1527, 102, -486, -2172, 872, 1771, -987, -1361, 
-    -1108, 172, 1988, 436, -2248, -1973, 1064, 1875, -36, -933, 
-    -1008, 854, 2776, 357, -2765, -660, 3923, 2072, -2628, -885, 
-    1801, 599, -513, 152, 585, -1897, -2462, 1820, 2962, 32, 
-    -1906, -1809, 1022, 1616, -1007, 17, 808, -1888, -1703, 1627, 
-    3152, -201, -3070, 513, 1880, -1806, -1221, 1911, 2119, -421, 
-    -3519, -1270, 3318, 1669, -1088, -23, 313, -435, -584, -1567, 
-    -1685, 884, 2001, -270, -2544, -1754, 2481, 2779, -1895, -1887, 
-    574, 1027, 850, -1111, 11, 2294, -831, -1391, 1133, -441, 
-    -471, 1882, -86, -2569, -132, 1832, 86, 746, 2574, -25, 
-    -2246, -599, 1078, -889, -2862, 1058, 2816, -2165, -3338, 471, 
-    3227, 2388, -1518, -1926, 1062, -58, -1693, 1023, 1255, -1251, 
-    488, 2235, 59, -1443, -231, 1886, 525, -2193, -179, 685, 
-    -1419, -919, -17, 1375, 1549, -1565, -885, 1257, 293, -167, 
-    -51, 908, 226, -1752, 508, 736, -1522, 184, 249, -41, 
-    1890, 233, -1537, -1641, -1476, 1202, 1090, -1399, 55, 1364, 
-    620, 121, -698, 19, 1307, 15, -1441, -1025, 329, 1175, 
-    -432, -1997, -207, 1308, 484, -510, -1057, 112, 1854, 443, 
-    -1783, -794, 1068, 1161, -180, -2281, -399, 3647, 408, -3026, 
-    579, 1415, -662, 422, 967, -875, -1561, 371, 1339, 417, 
-    707, 371, -735, 981, 1941, -152, -910, -374, 362, 1247, 
-    -1165, -3335, -1051, 97, 69, 1293, 66, -1419, -717, -245, 
-    450, 557, 494, 1583, -346, -2886, -598, 1554, 1308, 1260, 
-    584, 275, -219, -1714, -963, 368, 998, 2244, 1065, -799, 
-    -854, -1456, -1260, 380, 1536, 79, -2524, -423, 1510, -315, 
-    -263, -802, -1263, 948, 1625, 919, -729, -983, 265, -360, 
-    1184, 1457, -2053, -1075, 1880, 2554, 1382, -2392, -3282, 102, 
-    2254, 983, -2007, -2038, 499, 934, 406, -80, -1017, -849, 
-    -481, -92, 1093, 906, -128, -337, -429, -798, -546, 1725, 
-    2350, -150, -723, -813, -323, 2282, 448, -2556, -538, 2049, 
-    2136, -459, -2048, -135, 896, -184, -1535, -764, 1161, 657, 
-    -131, -769, -1371, 527, 1338, -634, -279, 2095, -29, -2974, 
-    437, 2488, 388, -874, -2269, -485, 2194, -11, -1296, -248, 
-    842, 1500, -288, -418, 1948, 509, -2152, -1122, 83, 590, 
-    1694, 53, -1955, -911, -446, 605, 2578, -168, -3820, -1678, 
-    2027, 1582, -813, -891, 328, 886, 1177, 697, -369, -922, 
-    -158, 490, -129, 643, 520, -1938, -1133, 827, 871, 893, 
-    -838, -1522, 1011, 753, -1918, -1509, 957, 1278, -417, -552, 
-    1562, 2342, -861, -2801, 763, 2083, -860, -1096, 415, 1073, 
-    -14, -2564, -1252, 2449, 2476, -106, -1683, -546, 738, -637, 
-    -1578, 353, 2183, 524, -1187, 617, 703, -850, 693, 674, 
-    -454, 281, -2089, -1687, 3169, 882, -2779, -740, 456, 903, 
-    973, -527, -590, -142, -311, 59, 226, 159, 349, -163, 
-    -199, 1475, 557, -2230, -89, 2043, -724, -1291, 722, 886, 
-    117, -859, -1482, -904, 1321, 2000, -900, -1364, 889, 1044, 
-    -70, -1447, -448, 1819, -685, -3033, -363, 981, 146, 655, 
-    685, -340, -596, -92, 371, 924, 1044, -727, -1782, 579, 
-    2754, 1048, -2287, -866, 2811, 1320, -1233, -1826, -1596, 411, 
-    252, -604, 394, 392, 506, -273, -792, 679, 97, 99, 
-    695, -1007, -508, 966, 775, 666, -194, -548, 191, 92, 
-    -262, -101, 421, 41, -280, 999, 66, -1820, -317, 249, 
-    -644, 451, 647, -392, -952, -1388, -36, 1749, 864, -940, 
-    -676, 1373, 730, -2520, -1885, 1089, 1373, 855, 751, 304, 
-    -537, -1031, 161, 1124, 265, -308, -133, -204, 48, 390, 
-    90, -150, -920, -1332, 463, 1006, -128, -209, -916, -659, 
-    1286, 1183, 401, -138, -979, 10, 688, -223, -39, -314, 
-    -871, 1308, 2465, -541, -2108, 38, 316, -201, 2000, 1081, 
-    -2132, -1389, -173, 3, 865, 507, -948, -1441, 214, 1053, 
-    -13, 23, -347, -411, 281, -1142, -522, 1751, 885, -279, 
-    -278, 187, -139, -1388, 400, 1542, -697, -87, 838, -994, 
-    -125, 1415, -712, -1662, 881, 1318, -442, 203, 1040, 21, 
-    -617, -708, -476, 156, 235, -882, -1147, 1232, 2230, 207, 
-    -1704, -2252, -178, 1489, 499, 1423, 988, -2680, -1555, 1776, 
-    1234, 9, -248, 352, 366, -1614, -1129, 1571, 810, -1630, 
-    -960, 1825, 2125, -568, -1158, 1053, 776, -1329, -1001, -155, 
-    32, 883, 491, -682, -902, -994, -415, 952, 1040, 163, 
-    -280, -806, -285, 1128, 91, -1270, -286, 318, 322, 686, 
-    463, 277, -430, -1253, 125, 455, -1034, 601, 1863, -921, 
-    -2191, -246, 857, 452, 90, -859, -908, 1637, 1627, -1226, 
-    -1114, 34, 227, 1303, 893, -1378, -1062, 1722, 2034, -612, 
-    -1915, -148, 1606, 483, -714, 71, 346, -328, -224, 303, 
-    -138, 74, 969, -818, -2320, -820, 1151, 1582, -606, -1758, 
-    -723, -3, 948, -155, -83, 2082, -1275, -1901, 3124, 807, 
-    -2711, 771, 2126, -630, -425, 2195, 1134, -2216, -1987, 1031, 
-    1799, -77, -596, -518, -961, -296, -972, -1242, 1212, 1204, 
-    -988, -1339, 11, 1407, 1022, -1098, -1913, 868, 2611, -324, 
-    -1858, -336, 345, 1028, 977, -1097, -1063, 1389, 1505, -424, 
-    -1319, -435, 1201, 1053, -515, -1100, -733, 288, 1535, 553, 
-    -2202, -1445, 710, -426, 88, 1469, -115, -490, -184, 351, 
-    2018, 767, -1163, -415, 217, 139, 33, 357, 740, -1144, 
-    -2347, 1133, 2801, -559, -1666, -412, -557, -732, -605, 463, 
-    1377, 123, -537, -249, -247, 612, 821, -641, -1002, 734, 
-    1295, -492, -1306, -141, 1032, 739, 205, 996, 32, -2256, 
-    -841, 1366, 394, -390, 475, 424, -639, -204, 872, -129, 
-    -457, 534, -610, -763, 551, -677, -693, 971, 10, -605, 
-    266, 137, 104, -226, -310, 1461, 1026, -1279, -597, 542, 
-    194, -39, -149, 728, 749, -1030, -1150, 69, 629, 657, 
-    -343, -1578, -709, 689, -230, -70, 1191, -454, -1111, 559, 
-    766, 119, -137, 397, -33, -1460, -220, 1410, 849, -48, 
-    -179, 806, 484, -1596, -1523, 652, 1542, 33, -1352, -582, 
-    1097, 888, -2014, -1776, 2478, 1900, -1515, -781, 710, 999, 
-    545, -1070, -1113, -288, -65, 1624, 2320, -583, -2237, -375, 
-    143, -226, 1430, 637, -1701, -121, 1660, 460, -802, -298, 
-    575, -613, -1179, 1113, 1368, -1180, -1555, -194, -151, -128, 
-    187, -374, 142, 959, 296, -15, -374, -395, 860, 819, 
-    8, -351, -481, 187, -3, -575, 40, 205, -78, -280, 
-    -677, -613, 407, 1576, 961, -743, -954, -173, -266, -723, 
-    213, 1520, 992, -959, -2032, -475, 1281, 573, -531, -115, 
-    993, 272, -1284, -391, 264, 644, 1595, -923, -1591, 1612, 
-    873, -788, -228, -316, 205, 950, 919, -570, -1998, 130, 
-    1289, 270, 724, -143, -1320, -176, 1355, 1106, -1574, -1872, 
-    109, 10, 540, 660, -880, -630, -302, -179, 652, 471, 
-    245, 283, 247, 78, -551, -279, 38, 75, 981, 171, 
-    -917, 590, 562, -936, -67, 700, -274, -1063, -1013, -404, 
-    590, 1647, 1234, -690, -1388, -220, 599, 39, -81, 125, 
-    -488, -2, 922, 921, 691, -1077, -1819, 640, 1501, 155, 
-    -728, -1244, 95, 1472, 92, -20, 791, -619, -332, 620, 
-    -1234, -1729, -364, 387, 1168, 600, -294, 324, -841, -2091, 
-    146, 1294, 407, 788, -15, -1481, -251, 1105, 895, 2, 
-    -449, 1194, 1272, -1519, -1562, 323, 1003, 645, -1275, -1063, 
-    1825, 1466, -638, -728, -983, -734, 1340, 695, -2016, -1103, 
-    369, -305, 162, 582, 281, 637, 23, -804, -535, 130, 
-    1508, 1617, -1171, -1823, 787, 196, -993, 1319, 642, -1674, 
-    -219, 908, 728, 336, -869, -287, 1322, 1217, -311, -1753, 
-    -781, 1095, 598, -389, -166, -130, 328, 991, -347, -1309, 
-    -342, -234, 5, 928, 267, -364, 653, 1475, -174, -2297, 
-    -968, 1329, 981, -255, -655, -610, -605, -660, -347, 732, 
-    1163, 41, -474, -535, -1256, -574, 827, 884, 643, 363, 
-    -84, -114, -213, -127, 49, -211, 426, 558, -667, -221, 
-    586, -34, -273, 102, 591, -187, -644, 1238, 1533, -131, 
-    -1023, -1221, -290, 906, 945, -407, -950, 669, 371, -950, 
-    158, 129, -1207, -556, 324, -99, 64, 700, -373, -1169, 
-    356, 1281, 464, -197, -318, -575, -669, 78, 818, 1051, 
-    837, -218, -565, 294, 347, -413, -482, 334, 505, -137, 
-    -25, -133, -758, -383, -60, -69, 203, -338, -267, 1022, 
-    -317, -2160, 184, 1703, -118, -834, -480, 845, 1980, 291, 
-    -637, -11, -132, -16, -500, -574, 846, 829, -184, -558, 
-    -333, 257, -86, -174, 190, -464, -283, -135, -1221, -455, 
-    1414, 1037, -1062, -1487, 565, 1728, 875, -558, -1469, -342, 
-    1544, 1382, 126, -130, -260, -780, -302, 821, 1555, 816, 
-    -1419, -1261, 560, -206, -785, 41, -67, -195, -499, 260, 
-    1581, -526, -1535, 603, 82, -968, 6, 681, 856, -49, 
-    -789, -140, -91, -50, 588, 111, -583, 216, 751, -268, 
-    -603, 286, 1048, 731, -658, -421, 777, -199, -863, -143, 
-    -495, -819, -65, 415, 162, -372, -261, 224, -59, -204, 
-    383, 972, 1074, -213, -1258, -48, 812, 148, -454, -454, 
-    585, 998, -48, -311, -112, -373, -508, -419, -101, 265, 
-    922, 329, -1538, -748, 665, -164, 195, 774, -339, -27, 
-    976, -64, -880, -360, 121, 771, -177, -1014, 1642, 1246, 
-    -2266, -1162, 714, 706, 1363, 56, -1499, -280, 555, 645, 
-    378, -1301, -1122, 569, 158, -154, 213, -94, -132, -623, 
-    -638, 888, 1477, 772, 304, 304, 127, -306, -277, -343, 
-    -617, -293, -117, 378, 887, -650, -1590, -88, 978, 983, 
-    -111, -1372, -532, 275, -240, 19, 282, -337, -152, 1010, 
-    1363, 233, -603, 92, -211, -1317, 88, 1068, -538, -828, 
-    413, 1167, 1056, 41, -791, -1249, -1110, 418, 1464, 625, 
-    -835, -1650, -631, 1420, 1419, 55, -487, -839, -218, 1081, 
-    25, -2003, -1263, 1031, 1431, 523, 270, -70, -341, 239, 
-    259, -625, -1322, -601, 1425, 1239, -812, -342, 624, -610, 
-    -1004, 460, 1360, 712, -320, -526, -330, -547, -411, 459, 
-    567, 345, 527, -426, -806, 778, 1010, 57, 300, -215, 
-    -1393, -118, 1104, -272, -444, 175, -1302, -1510, 585, 1504, 
-    624, -195, -3, -91, -612, -189, 239, 121, 470, 19, 
-    -968, 375, 1185, -728, -697, 447, -161, 256, 476, -985, 
-    -765, 500, 514, 162, -135, 455, 1307, -59, -1425, -574, 
-    338, 97, -919, -466, 1294, 1047, 88, -265, -616, 112, 
-    523, -379, -1161, -772, 698, 1026, 97, -573, -283, 953, 
-    281, -1025, 87, 440, -210, -65, -97, 97, -54, -576, 
-    -260, 227, 479, -42, -581, 154, 783, 438, -810, -962, 
-    1161, 1395, -243, -177, 241, 168, -83, -514, -216, -316, 
-    -375, 938, 739, -827, -426, -15, -337, 537, 110, -1017, 
-    -214, -226, -607, 186, 319, 593, 567, -151, 259, -109, 
-    -736, 439, 730, 238, 63, -758, -419, 678, 349, -270, 
-    -829, -876, 590, 1148, -69, -707, -469, 125, 544, 55, 
-    8, 286, -519, -577, 477, 464, -236, -417, 21, 639, 
-    726, 173, -373, -297, -81, 88, 244, 200, 749, 650, 
-    -616, -529, -82, -325, -20, -42, -390, -247, 163, -51, 
-    -890, 273, 1483, -571, -1657, -252, 441, 579, 366, -420, 
-    -122, 1170, 835, -848, -557, 607, -61, -508, 504, 313, 
-    -1108, -487, 991, 403, -473, -78, 229, -726, -743, 1135, 
-    345, -1268, 290, 739, -334, -320, -249, -5, 196, 198, 
-    170, -56, 226, 385, 62, -395, -650, 453, 1242, 304, 
-    -300, -170, -77, -223, -770, -497, 637, 741, 83, -120, 
-    -112, 137, 278, -426, -689, -48, 177, 63, -152, -2, 
-    895, 301, -1265, -483, 609, -356, -673, 567, 1193, 268, 
-    -726, -245, 377, 326, 54, -399, 355, 724, -916, -684, 
-    1123, 808, -824, -1168, 685, 1144, -796, -854, 30, -295, 
-    -456, -66, 397, -52, -253, 581, 577, 89, -701, -1165, 
-    361, 1212, 65, -664, -430, 17, 496, 1005, 697, -342, 
-    -493, -133, 92, 538, 340, -544, -546, 501, 582, -280, 
-    -95, 118, -468, -736, -665, -38, 250, -333, 166, 799, 
-    -95, -644, -97, 189, 39, 148, 482, 272, -351, -476, 
-    -129, 623, 961, -246, -421, 385, -978, -1281, 845, 1478, 
-    230, -1257, -483, 1761, 1253, -805, -1641, -577, 931, 267, 
-    -729, -788, -732, 151, 676, 467, -24, -653, 48, 637, 
-    202, 242, -253, -384, 885, 1102, 236, -381, -15, 885, 
-    -80, -998, -33, 262, 187, -54, -949, -456, 367, -73, 
-    -228, 362, 514, -202, -499, -12, -309, -888, 106, 1014, 
-    -160, -548, 524, 24, -259, 598, 329, 469, 778, -105, 
-    -449, -968, -1095, 573, 929, -268, -845, -690, 317, 789, 
-    459, 87, -780, -704, -135, -298, 154, 355, 85, 120, 
-    -150, 168, 640, 450, 188, -869, -1296, 169, 924, 411, 
-    132, -322, -1104, -582, 1262, 1564, 93, -413, -58, -258, 
-    -394, 103, 227, -406, -415, 224, 234, 17, -94, -109, 
-    519, 327, -1003, -790, 613, 1154, 455, -731, -219, 658, 
-    -120, 1, 824, 436, -16, -66, -314, -572, 203, 482, 
-    -993, -967, 552, 975, 160, -784, 433, 1044, -1063, -792, 
-    840, 291, -579, -1147, -392, 966, 106, -903, -501, 7, 
-    139, -53, 413, 764, -462, -1322, -611, 237, 814, 1033, 
-    187, -314, 611, 285, -1286, -578, 1047, 609, -458, -673, 
-    -164, 330, -25, -35, 674, 860, 410, -885, -1361, 500, 
-    1186, -635, -1397, -12, 1339, 987, -206, -460, -94, -300, 
-    -477, 109, 357, 149, 227, -104, -499, 251, 1160, 379, 
-    -987, -341, 837, 279, -437, -295, -409, -564, 327, 1055, 
-    201, -590, -352, 24, 200, -20, -209, -121, -324, -480, 
-    11, 554, 280, -61, 105, -50, -69, 200, -29, -169, 
-    -116, -46, 215, -141, -416, 372, 532, -42, 208, -57, 
-    -1149, -576, 437, 320, 906, 443, -1662, -1285, 302, 283, 
-    132, 162, -81, -308, -15, 715, 733, 54, -430, 2, 
-    662, 477, 355, 15, -449, -191, -294, 164, 795, -492, 
-    -836, 527, 641, 150, 108, -52, -389, -485, 314, 570, 
-    -571, -781, 227, 495, -292, -749, -126, 344, 373, 281, 
-    -263, -474, -242, 123, 758, 492, -727, -916, 480, 1234, 
-    293, -240, -74, -258, -202, -210, -418, -341, -159, 380, 
-    131, -1019, -420, 886, 359, -298, 208, 614, 227, -693, 
-    -998, -47, 779, 872, 582, -378, -535, 508, 84, -787, 
-    -277, 66, 312, -5, -654, 458, 625, -429, 24, 110, 
-    267, 168, -1267, 102, 1435, -369, -24, 577, -1143, -993, 
-    611, 1369, 711, -586, -33, 649, -536, -1049, -76, 708, 
-    261, -703, -402, 516, 491, -134, -502, -50, 423, 174, 
-    -183, -551, -450, 8, -171, -424, -393, 145, 943, 696, 
-    151, -21, -430, -182, 645, 284, -548, -89, 586, 635, 
-    278, -938, -1235, 533, 1256, -229, -1007, -130, 268, -199, 
-    -262, 123, 342, -83, -378, 371, 414, -633, -245, 466, 
-    -398, 132, 1374, -351, -1736, -342, 1305, 1399, -637, -1248, 
-    672, 614, -474, -530, -356, 276, -81, -624, 555, 916, 
-    -195, -582, -120, 220, 476, 548, -284, -781, -41, 259, 
-    -447, -596, 714, 1247, -96, -299, 526, 38, -532, -13, 
-    197, -401, -307, 558, 213, -1243, -906, 990, 915, 29, 
-    194, -355, -715, -174, -174, -736, -954, 160, 940, 459, 
-    675, 371, -798, -386, 726, 863, 396, -266, -534, -174, 
-    77, 156, 247, -124, -312, 156, 366, 255, -187, -879, 
-    -497, 336, 530, 547, -419, -1366, -149, 1327, 1281, 203, 
-    -800, -633, -260, -167, 143, 26, -157, -193, -338, 84, 
-    644, 640, -120, -1021, -344, 773, 509, -26, -562, -795, 
-    196, 834, 444, 28, -501, -367, 583, 381, -541, -376, 
-    33, -59, 202, 764, 409, -1057, -1331, 436, 1262, 564, 
-    371, -87, -953, -728, -38, 554, 437, -567, -149, 742, 
-    -140, -594, 175, 301, -242, -388, 68, 315, 331, 455, 
-    235, -124, -310, -672, -752, -10, 562, 83, -591, -222, 
-    571, 136, -107, 476, -571, -1091, 272, 448, 368, 193, 
-    -778, 2, 960, 265, -154, 180, 384, -332, -553, 151, 
-    -192, -123, 555, -167, -564, 488, 1147, -105, -1323, -566, 
-    45, 251, 630, 162, -294, -473, 11, 686, 140, 321, 
-    729, -211, -425, -193, -531, -321, 459, 608, 61, 141, 
-    241, -302, -345, 194, 454, -143, -339, 166, -300, -196, 
-    437, 38, 325, -2, -931, 86, -39, -631, 1052, 665, 
-    -1027, -341, 137, -45, -181, -644, 257, 1278, 600, -642, 
-    -1273, -212, 1081, 624, -126, -299, -272, -52, -245, -1071, 
-    -998, 525, 861, -104, 139, 550, 315, 61, -573, -664, 
-    -228, -126, 263, 259, -181, 335, 714, 69, -565, -660, 
-    65, 866, 712, -138, -1216, -864, 792, 684, -200, 377, 
-    688, 424, 260, -615, -764, 412, 479, 119, 292, -529, 
-    -725, 436, 599, 8, -313, -76, 80, -654, -544, 299, 
-    298, 400, 324, -363, -515, -149, 506, 740, -144, -764, 
-    -375, 225, 291, -18, 98, -191, -666, 311, 889, -13, 
-    -591, -617, 43, 987, 837, -5, -704, -705, -189, -75, 
-    -63, 29, 16, -46, -394, -76, 691, 6, -742, 151, 
-    977, 334, -1044, -1249, 20, 978, 1161, 597, -421, -660, 
-    -531, 95, 1160, 71, -1299, 16, 599, -199, 328, 573, 
-    -153, -496, -586, -109, 285, -206, -101, 198, -464, -362, 
-    584, 809, 432, -523, -954, 215, 1202, 745, -259, -282, 
-    423, 139, -621, -557, 414, 874, -171, -629, 64, 298, 
-    -31, -794, -604, 789, 604, -627, -428, 374, 164, -1003, 
-    -963, 421, 330, 128, 886, -248, -1406, -193, 821, 173, 
-    -315, 385, 138, -531, 572, 1168, 185, -915, -765, 681, 
-    750, -104, -474, -740, -1, 300, -124, 370, 205, -622, 
-    -625, 325, 654, -1112, -1378, 1103, 1677, 287, -302, -236, 
-    107, 569, 543, -190, -814, -339, 366, 230, 159, 332, 
-    -259, -759, -21, 751, 323, -414, -377, -144, -223, -206, 
-    105, 535, 562, 44, -397, -317, -32, -261, -489, -55, 
-    299, 482, 758, 588, -102, -806, -541, 574, 753, 36, 
-    -406, -621, -346, 352, 652, 109, -675, -514, -159, -222, 
-    -82, -329, -296, 242, 78, 309, 602, -435, -766, 356, 
-    523, -265, -60, 266, -278, -504, -259, 337, 887, 262, 
-    -553, -249, 131, -298, -317, 594, 620, -280, -288, 166, 
-    162, 411, 569, -163, -588, -156, 63, -91, -367, -414, 
-    230, 840, 832, 490, -116, -817, -832, 123, 785, 671, 
-    110, -1143, -1156, 324, 405, 82, 455, 277, -154, -756, 
-    -548, 604, 534, -46, -117, -149, 66, 259, 376, 149, 
-    -635, -572, 440, 731, 173, -137, -436, -589, 208, 415, 
-    -549, -548, 312, 501, 311, 76, -110, -219, -943, -696, 
-    1412, 1569, -572, -1343, -342, 737, 157, -853, 149, 928, 
-    75, -747, -638, 533, 533, -618, -87, 228, -562, -392, 
-    93, 822, 894, -557, -767, -216, -670, -396, 371, 471, 
-    396, 237, 188, 94, -207, 5, 364, 436, 633, 342, 
-    -378, -426, -219, -129, 344, 497, -68, -279, -83, -124, 
-    157, 516, -352, -1042, 129, 740, -169, -285, -90, -358, 
-    -44, 205, 116, 44, -229, -102, 206, 269, 197, -272, 
-    -269, 127, -26, 63, 195, 6, 179, 119, -305, -307, 
-    135, 244, -316, -173, 571, 23, -1113, -666, 844, 566, 
-    -823, -319, 508, 84, 19, 219, 105, -51, -261, -41, 
-    438, 128, -177, 320, 273, -384, -610, -79, 1046, 808, 
-    -610, -745, -362, -175, 294, 284, -66, -153, 252, 330, 
-    -199, 129, -145, -693, 966, 915, -1089, -609, 403, 577, 
-    553, -81, -178, -172, -36, 452, -358, -818, 405, 838, 
-    -145, -914, -683, 148, 525, 63, 151, 406, -749, -1024, 
-    359, 424, -199, 161, 65, -239, 471, 648, 28, -328, 
-    -781, 80, 1005, -830, -1078, 1014, 360, -902, -307, 195, 
-    299, -134, -173, 701, 196, -786, -157, 333, -40, -173, 
-    175, 778, 92, -1149, -233, 514, 73, 788, 828, -55, 
-    -270, -729, -262, 567, 10, 206, 632, -369, -639, 299, 
-    510, -280, -583, 150, 349, -519, -668, 143, -76, -580, 
-    620, 1250, -220, -763, 283, 278, -250, 98, -218, -254, 
-    1035, 550, -658, 35, 397, 92, 5, -479, -295, 364, 
-    58, -516, -242, 335, -326, -1141, 42, 1270, 583, -591, 
-    -686, 368, 854, -263, -1419, -701, 1185, 961, -642, -231, 
-    414, -85, -47, -33, -308, -281, -116, 180, -110, -674, 
-    -67, 698, 404, 285, 190, -436, 143, 959, 8, -771, 
-    -97, 298, -748, -880, 769, 812, -268, -175, 89, 161, 
-    -30, 39, 416, -173, -555, -30, 342, 497, 224, -389, 
-    -453, 254, 609, 143, -203, -405, -441, -119, -34, 2, 
-    18, -185, 169, 669, 238, -345, -74, 132, -414, -524, 
-    -69, -156, 71, 708, -77, -806, 281, 791, 133, -172, 
-    -498, -289, 734, 740, -297, -785, -204, 546, 669, 512, 
-    17, -538, -475, -175, 159, -130, -609, 516, 845, -901, 
-    -917, 408, 687, 564, -395, -718, 772, 608, -730, -527, 
-    -248, -253, 388, 1161, 693, -1140, -1213, 429, 801, 595, 
-    -57, -904, -186, 516, 381, 173, -414, -338, 332, 144, 
-    -544, -528, 435, 737, -287, -870, -638, -357, 148, 677, 
-    545, -250, -541, 172, 324, 25, 553, 431, -615, -463, 
-    468, 453, -285, -347, 573, 547, -685, -545, 426, -53, 
-    -666, -128, 200, -49, 183, 579, 168, -463, -410, -70, 
-    78, 407, 449, -198, -700, -1027, -86, 2021, 1523, -503, 
-    -827, -564, -8, 35, -569, 441, 821, -495, -616, -123, 
-    468, 1125, 426, -556, -1071, -956, 474, 985, -285, -671, 
-    101, 335, 30, -196, 82, 565, -175, -753, 420, 397, 
-    -960, -762, 403, 1372, 1034, -429, -402, 216, -4, 393, 
-    295, -744, -639, -171, -38, 226, -170, -126, 349, -412, 
-    -552, 292, 95, 126, 619, -324, -889, 262, 432, -204, 
-    -106, -211, 401, 956, -337, -252, 500, -944, -743, 908, 
-    335, -338, -153, -34, 335, 414, 435, 314, -196, -291, 
-    -170, 141, 496, 70, -904, -1006, 169, 580, 123, 287, 
-    40, -713, -529, 515, 748, -395, -744, -157, -63, 110, 
-    509, 922, 459, -1118, -884, 746, 623, -217, -515, -723, 
-    -344, 74, 217, 1041, 1092, -302, -538, -112, -613, -161, 
-    619, 59, -64, 271, -40, -283, -334, 364, 1028, -472, 
-    -990, 770, 128, -742, 686, -6, -1044, 105, 632, 569, 
-    -22, -479, 394, 332, -303, -213, -57, 334, 191, -77, 
-    378, -30, -700, -355, 85, 460, 256, -750, -608, 189, 
-    29, -35, 47, -225, -139, 41, 205, 303, -162, -455, 
-    -180, 410, 990, 284, -1109, -804, 777, 1302, 45, -1283, 
-    -637, 582, 303, 13, 234, 133, 238, -241, -939, -285, 
-    397, 338, 82, -226, -114, 176, 314, 63, -548, -551, 
-    87, 379, -155, -546, 224, 920, 567, 63, -147, -453, 
-    -348, 357, 521, 335, 124, -518, -534, -97, 347, 1112, 
-    292, -1250, -553, 187, -466, -276, 324, 2, -346, 210, 
-    601, -212, -153, 410, -608, -330, 1193, 629, -559, -423, 
-    431, 616, 222, -3, -485, 71, 443, -919, -312, 1009, 
-    19, -532, -333, -154, 132, -288, -112, 450, 127, -434, 
-    -1284, -638, 1294, 756, -422, -3, 197, 197, -363, -977, 
-    300, 1165, 6, -688, -61, 573, 581, 329, -46, -633, 
-    -685, 176, 634, -279, -556, 624, 114, -952, -186, -146, 
-    421, 1451, -771, -1716, 510, 802, -483, -550, 704, 896, 
-    -374, -209, 375, 167, 505, 414, -971, -1289, 936, 1436, 
-    -532, -437, 3, -50, 542, -494, -466, 893, -351, -1302, 
-    -219, 677, 954, -83, -1041, -15, 574, -213, -130, 243, 
-    192, 688, 204, -820, 138, 481, -264, 604, 215, -1022, 
-    162, 358, -419, 393, 441, -268, -415, -110, 14, -494, 
-    498, 1080, -953, -1323, -217, 142, 744, 245, -738, -452, 
-    -14, 190, 194, 298, 252, -604, -524, 665, 707, 54, 
-    226, 298, -433, -374, 206, -38, 219, 117, -992, -152, 
-    732, -49, 241, -122, -867, 416, 518, -501, -244, 311, 
-    394, -512, -614, 655, 756, 268, -319, -769, 52, 311, 
-    -246, -153, -13, -289, -267, 528, 639, -118, 17, 162, 
-    -337, -311, 220, 487, 67, 125, 622, -526, -1534, 146, 
-    1480, 206, -847, -159, 554, 158, -496, 49, 594, 13, 
-    -270, -366, 272, 1062, -634, -1402, 386, 653, 190, 93, 
-    -378, 224, 516, -617, -395, 416, -142, 20, 443, -679, 
-    -773, 631, 800, -184, -749, -594, 178, 956, 196, -1137, 
-    -500, 805, 771, -1, -634, -478, 295, 632, 23, -836, 
-    -435, 807, 594, -362, -138, 74, -89, 93, -35, 2, 
-    -205, -786, 107, 638, -222, -18, 265, -26, 56, -385, 
-    -163, 766, -85, -866, 135, 747, 314, -488, -725, 93, 
-    564, 486, 78, -672, -150, 596, 108, -113, -260, -278, 
-    411, 489, 204, -223, -777, -107, 820, 641, -281, -976, 
-    -227, 683, 243, -249, 45, 379, 105, -262, -322, -185, 
-    261, 154, -128, 52, -544, -324, 912, 17, -849, 417, 
-    768, -281, -787, -205, 192, -438, -153, 808, 265, -754, 
-    -735, 523, 1529, 388, -997, -756, -262, 422, 1244, 434, 
-    -897, -667, 142, 582, 738, 515, -94, -912, -800, 451, 
-    664, -394, -724, -231, 413, 738, 123, -494, -596, -427, 
-    345, 472, -414, -299, 371, 60, -153, 255, 350, 77, 
-    -771, -844, 937, 1019, -790, -699, 180, 425, 564, -26, 
-    -321, 136, -71, -367, 12, 198, 70, 165, 232, -92, 
-    -508, -484, 180, 910, 610, -554, -816, -92, -85, -340, 
-    385, 802, -19, -640, -447, -162, 220, 580, 496, 282, 
-    -202, -607, -219, -127, -35, 310, -358, 164, 1095, -478, 
-    -820, 353, 297, 364, -62, -574, -220, -135, 517, 514, 
-    -194, 310, 62, -323, 263, 63, 96, 85, -374, 159, 
-    -1, -765, -125, 832, 958, 5, -580, -55, -351, -470, 
-    -14, -327, 129, 345, -533, -282, 381, 274, -287, -188, 
-    658, 155, -699, -756, -650, 403, 812, -11, 9, 485, 
-    525, -158, -630, -4, 151, -93, 44, 173, 373, 166, 
-    -306, -630, -457, 628, 931, -117, -902, -394, 992, 729, 
-    -629, -273, 102, -486, -306, 292, 473, -188, -668, 199, 
-    620, 124, -430, -519, 680, 561, -791, -55, 337, -314, 
-    241, 219, -231, 314, 336, -431, -321, 421, -20, -542, 
-    398, 357, -777, -102, 1176, 826, -355, -895, -186, 314, 
-    -190, -334, 14, 368, 221, -597, -600, 380, 935, 593, 
-    -198, -787, -608, -22, 28, 276, 190, -585, 405, 771, 
-    -832, -198, 856, -151, -901, -304, 682, -30, -892, 164, 
-    623, 170, -332, -422, 545, 82, -1061, 0, 649, -331, 
-    -545, 151, 700, 711, 267, -83, 82, 248, -227, -354, 
-    296, 262, -314, -221, 404, 630, -115, -570, -322, -240, 
-    548, 442, -1074, 130, 1252, -989, -1177, 613, 427, -216, 
-    -481, -188, 814, 750, -218, -512, 259, 256, -936, -373, 
-    792, 392, 104, -139, -53, 514, -136, -403, 299, 50, 
-    -185, 177, -43, -590, -341, 332, 78, -161, 490, 107, 
-    -729, -193, 263, 2, -172, -28, 273, -166, -560, 76, 
-    652, 458, -459, -680, 396, 818, -7, -1005, -403, 1256, 
-    645, -798, -369, 219, 125, 55, 166, 53, -721, -492, 
-    669, -1, -740, 626, 896, -213, -470, -504, -57, 422, 
-    -81, -151, -61, -267, 161, 469, 396, 370, -133, -298, 
-    206, -268, -477, 827, 678, -756, -459, 553, 324, -452, 
-    -200, 276, -120, 18, -41, -674, 66, 462, -175, -125, 
-    10, 257, 41, -572, 449, 696, -835, -299, 794, -278, 
-    -857, -176, 410, 637, -176, -470, 472, 484, 327, 374, 
-    -435, -309, 561, -21, -895, -124, 662, -39, -223, 101, 
-    -360, -175, 199, -222, -335, -266, 120, 568, -523, -1139, 
-    403, 969, -43, -449, -180, 398, 661, -33, -818, -415, 
-    671, 266, -677, -108, 657, 613, 130, -2, 271, 8, 
-    -117, -506, -819, 570, 672, -486, 434, 489, -957, -314, 
-    379, -699, -257, 1372, 540, -1110, -759, 340, 749, -36, 
-    -460, 436, 130, -359, 492, 359, -168, -215, 5, 890, 
-    97, -1240, 62, 734, -245, -37, -16, -495, 186, 336, 
-    -578, -555, 311, 549, -171, -847, -334, 483, 409, 142, 
-    -360, -480, 830, 682, -969, -641, 279, 97, 58, 513, 
-    663, 94, -244, -491, -217, 1172, 547, -1133, -620, 73, 
-    16, -338, 76, 1314, -280, -1634, 504, 567, -844, 251, 
-    859, -460, -1073, -272, 92, 11, 598, 768, 246, -478, 
-    -762, 94, 456, 54, 88, 20, -1, -65, -202, 560, 
-    901, -108, -585, -83, 164, -174, -435, 3, 571, 244, 
-    -758, -799, 541, 769, -268, -94, 128, -354, 89, 377, 
-    -77, -153, -79, -15, -37, -216, -47, 348, 482, 299, 
-    -9, -310, -406, -214, -36, 170, 130, -421, -436, 105, 
-    195, 254, 221, -123, 196, 410, -324, -676, -161, 615, 
-    479, -574, -13, 1212, 467, -722, -1082, -330, 957, 733, 
-    -87, -503, -517, 421, 402, -417, -60, 370, 456, 37, 
-    -1008, -492, 764, 110, -734, -359, -100, 236, 516, 97, 
-    -235, -60, 409, -32, -1021, -124, 638, -476, -119, 882, 
-    -242, -670, 163, 43, 82, 46, -280, 599, 574, -503, 
-    -193, 26, -305, 150, 449, 60, -397, -120, 633, 374, 
-    -170, -81, -409, -428, 468, 594, -219, -454, 29, 111, 
-    -139, 114, 255, -22, 167, 215, -802, -714, 954, 596, 
-    -922, -336, 748, 516, -286, -351, -259, -437, 679, 506, 
-    -1079, 14, 688, -297, 90, 268, -58, -410, -521, 592, 
-    494, -525, 2, 409, 83, 189, 252, -279, -527, -63, 
-    263, 454, 130, -388, 178, 68, -312, 745, 240, -1297, 
-    -779, 408, 941, 195, -944, -287, 630, 406, -150, -574, 
-    -174, 538, 495, -256, -488, 336, 5, -706, 384, 476, 
-    -538, -99, 467, 374, -205, -681, 146, 475, -256, -380, 
-    -191, -25, -128, -159, 125, -61, 420, 678, -357, -185, 
-    -87, -639, 378, 609, -21, 210, -508, -547, 831, 537, 
-    1, 447, -147, -878, -594, 291, 891, 21, -593, -45, 
-    -250, -340, 516, 761, 136, -567, -533, 34, 0, -472, 
-    -328, 514, 754, 17, -305, 87, 346, 259, 84, -362, 
-    -913, -264, 838, 577, -53, -192, -91, 179, -72, -341, 
-    119, 353, -14, -371, -450, -214, 210, 426, 331, 136, 
-    -235, -433, -65, 253, 208, 109, 26, -176, -354, 96, 
-    482, -123, -220, 461, 193, -455, -448, -167, 176, 220, 
-    -37, 29, 231, -96, -499, 11, 334, -432, -274, 540, 
-    -277, -826, 431, 696, -154, -103, -289, -331, 677, 332, 
-    -297, 191, -213, 76, 892, -242, -635, 320, 417, 82, 
-    -397, -300, 618, 629, -434, -889, -195, 352, 379, 193, 
-    -410, -285, 316, 23, -132, 51, -190, -118, 189, -12, 
-    -92, 145, -124, -356, -18, 370, 663, 86, -883, -399, 
-    329, 56, 133, 318, -269, -598, -121, 414, 323, -144, 
-    235, 736, -334, -1068, 13, 632, 151, -75, -74, -138, 
-    -45, 206, 365, 98, -325, -228, 167, 101, -275, -279, 
-    2, 215, 411, 251, -145, -101, -9, -87, -214, -381, 
-    -60, 47, -238, 203, 291, -268, 65, 459, 57, -33, 
-    323, 235, -466, -749, -83, 263, 87, 212, -17, -290, 
-    119, 309, 157, -257, -571, 226, 464, -420, -30, 551, 
-    -114, -182, 277, 389, 299, -216, -501, -398, -256, 224, 
-    368, -5, -164, -115, -34, 18, 26, 141, 258, 138, 
-    -195, -388, 20, 298, -516, -432, 650, -3, -305, 659, 
-    73, -548, -352, -164, 605, 383, -158, 229, -149, -180, 
-    319, 162, 186, -217, -395, 190, 124, 116, -86, -512, 
-    -101, 166, 314, 89, -580, -77, 612, 287, -442, -422, 
-    509, 379, -319, -307, -190, 309, 491, -209, -552, -24, 
-    410, -267, -384, 368, 45, -191, 20, -247, 93, 455, 
-    146, -10, -274, -532, -59, 606, 232, -755, -468, 320, 
-    371, 609, 152, -593, 186, 451, -307, -428, -166, 220, 
-    163, -9, 208, -5, 60, 150, -318, -124, 83, 65, 
-    331, -51, -457, -270, 60, 515, 111, -531, 143, 633, 
-    176, -189, -442, -236, 118, -127, -138, 184, 256, 171, 
-    -32, -21, 33, -274, -207, 244, 182, 70, 229, -154, 
-    -269, 201, -3, 46, 199, -620, -489, 265, 181, 3, 
-    -311, 37, 538, -236, -82, 507, -246, -225, 302, 261, 
-    295, -391, -896, -81, 534, 330, -158, -338, -221, -308, 
-    62, 724, 478, -243, -385, 84, 395, -21, -756, -572, 
-    674, 933, -219, -805, -279, 529, 470, -290, -102, 262, 
-    -231, -421, -135, 221, 303, 107, 240, -65, -349, 501, 
-    578, -555, -525, 471, 142, -636, -137, -28, -13, 695, 
-    58, -398, 183, -227, -414, 56, 284, 197, -365, 20, 
-    675, -48, -273, 358, 152, -360, -176, 68, -151, -125, 
-    95, 51, 63, 65, 23, 140, 173, -141, -560, -412, 
-    219, 479, 168, -143, 3, 155, -63, -79, 97, -146, 
-    -242, 166, 38, -505, -263, 528, 745, -117, -970, -352, 
-    864, 744, -365, -778, -400, 221, 794, 494, -289, -397, 
-    -29, 240, 143, -89, 18, 182, -69, -389, -90, 184, 
-    -35, 238, 150, -635, -123, 578, -23, -354, 79, 423, 
-    -98, -844, -227, 697, 666, 194, -522, -796, -229, 464, 
-    678, 24, -295, 430, 179, -604, 16, 364, -156, -216, 
-    -208, 101, 403, -142, -49, 349, -369, -644, 80, 271, 
-    -261, -418, 237, 456, -32, 222, 319, -538, -501, 165, 
-    166, -122, -413, -84, 601, 545, 287, 44, -351, -195, 
-    113, 88, 112, -140, -223, 378, 113, -387, 486, 437, 
-    -694, -450, 45, -19, -35, -224, 154, 247, -682, -232, 
-    921, 279, -619, -312, 333, 631, 282, -232, -346, -219, 
-    171, 311, -270, -394, 437, 678, -68, -454, -87, 375, 
-    120, -705, -602, 377, 675, -35, -685, -335, 202, 123, 
-    -6, -102, -10, 258, 73, -73, 102, 181, 84, -257, 
-    -155, 169, -8, 387, 505, -609, -584, 265, 187, 130, 
-    158, -129, -287, -139, 62, -50, 309, 516, -378, -206, 
-    438, -477, -888, -127, 513, 713, 65, -429, -34, 227, 
-    129, -112, -109, 280, 220, -231, -285, 196, 439, 23, 
-    -108, -34, -197, -134, -175, 49, 433, -173, -407, 176, 
-    115, -100, -109, -115, 99, 365, 239, -790, -882, 784, 
-    813, -596, -469, 229, 189, -132, -204, 98, 344, 222, 
-    -169, -232, 66, 83, 81, 234, -34, -529, -135, 601, 
-    125, -291, 177, -22, -447, -166, 209, 373, 255, -30, 
-    -130, 90, 148, -277, -381, -29, 160, -4, -298, 146, 
-    622, 72, -55, 111, -516, -472, 337, 478, 111, -264, 
-    -128, 274, -183, -459, 219, 245, -76, -28, -244, 23, 
-    131, -554, -135, 504, 124, 11, -59, -1, 244, -180, 
-    159, 732, -498, -702, 820, 206, -928, 101, 473, -183, 
-    -47, 154, 81, -111, 5, 267, -422, -627, 405, 662, 
-    47, -257, -186, 132, 495, 60, -674, -323, 86, -89, 
-    202, 346, 105, 157, 35, -161, -100, -186, -168, -13, 
-    -39, 155, 286, -148, -477, -275, 178, 322, -77, -296, 
-    7, 275, 191, 19, -181, -233, 319, 449, -315, -380, 
-    171, 324, 190, -62, 2, 80, -402, -534, 17, 345, 
-    121, -114, -53, -29, -59, -115, -173, 67, 56, -191, 
-    188, 426, -44, -240, -6, -61, -236, 136, 407, 15, 
-    -45, 31, -352, 22, 652, 105, -189, 131, -289, -332, 
-    348, 308, -63, 19, 302, 41, -374, 145, 177, -416, 
-    -45, -17, -212, 326, 93, -282, 76, 21, -231, -185, 
-    -23, 269, 443, 127, -376, -256, 233, 183, -187, -199, 
-    134, 154, -163, -31, 249, 44, -117, -2, -25, -263, 
-    -156, 297, 101, -334, -199, -39, 160, 235, -64, -72, 
-    62, -24, -96, -75, 93, 194, 104, -1, -117, -150, 
-    168, 401, -104, -351, 86, -2, -23, 302, -80, -272, 
-    -24, -102, 9, 168, 29, -107, -116, 86, 170, 123, 
-    75, -311, -428, 153, 357, -349, -633, 177, 539, 220, 
-    255, 91, -419, -458, 224, 618, -142, -394, 132, -45, 
-    -47, 269, 73, -137, -154, 148, 374, -73, -610, -512, 
-    422, 902, -109, -711, -88, 350, 412, 141, -200, -13, 
-    -153, -449, -87, 115, 183, 231, -119, -18, 334, 128, 
-    -155, -167, 57, 38, -419, -262, 563, 636, -155, -433, 
-    -89, 54, 36, -204, -227, 310, 167, -296, -98, 28, 
-    130, 112, -165, 152, 312, -146, -299, -335, -247, 238, 
-    528, 374, -164, -565, -226, 155, 97, 47, 4, 28, 
-    124, 24, 68, 255, 32, -398, -179, 425, 100, -399, 
-    34, 171, 28, 113, -291, -375, 31, -99, -67, 229, 
-    188, 169, -309, -620, 492, 712, -351, 64, 441, -318, 
-    -214, 63, -96, -173, -306, 76, 435, 233, 66, -46, 
-    -7, 19, -123, -358, -290, 607, 632, -374, -208, 251, 
-    61, -56, -312, -365, 172, 527, 58, -619, -444, 89, 
-    252, 282, 211, 47, -144, -208, 85, 93, -272, -73, 
-    224, -78, -118, 248, 221, -51, -27, 16, -245, -286, 
-    46, 202, 103, -48, -103, -105, -116, -82, -111, 30, 
-    505, 676, 84, -579, -375, 206, 356, 213, -174, -392, 
-    161, 509, -120, -487, 40, 430, 148, -318, -350, -56, 
-    18, -21, -37, -127, -27, 92, 48, 102, -58, -190, 
-    200, 155, -275, -102, 109, 3, -135, -11, 275, -88, 
-    -253, 201, -16, -129, 166, -78, -253, -29, 321, 340, 
-    4, -17, -132, -253, -94, 32, 539, 299, -762, -405, 
-    240, 3, 236, 327, 23, -3, -303, -91, 569, -9, 
-    -541, 45, 264, 116, 106, -62, -42, 98, -55, -276, 
-    -224, 4, -31, 109, 588, 128, -632, -381, 29, 376, 
-    475, -213, -486, -52, 293, 361, 51, -140, -158, -208, 
-    119, 234, -168, -217, 161, 192, -152, -86, 183, 118, 
-    39, -79, -144, 11, -33, -122, -81, 56, 219, -203, 
-    -460, 421, 659, -456, -749, 2, 282, 200, 127, -136, 
-    -128, 275, 303, -56, -245, -185, 97, 112, -168, 92, 
-    373, 31, -372, -353, 295, 565, -166, -437, -109, -182, 
-    -123, 126, -28, 84, 335, -79, -154, 210, 157, 235, 
-    -50, -664, -134, 440, 76, -136, 84, 419, 235, -359, 
-    -290, 52, 42, -23, 27, 155, 120, -107, -340, -113, 
-    503, 236, -411, -176, 141, 70, -205, -361, 20, 87, 
-    -64, 250, 44, -371, 141, 472, -1, -108, 53, -68, 
-    -10, -47, -156, 147, 206, -19, -102, -27, 152, -125, 
-    -319, 262, 246, -341, 69, 385, -377, -473, 81, 86, 
-    120, 171, 72, 136, -36, -150, -12, 5, -63, -227, 
-    73, 503, 6, -352, 91, 297, -34, -202, 285, 303, 
-    -459, -445, 74, 248, 212, -160, -329, -11, 318, 354, 
-    -223, -573, 44, 422, -50, -476, -350, 205, 625, 251, 
-    -256, -32, 83, -180, -10, 179, 16, -93, -118, -22, 
-    85, -28, -140, -138, 25, 446, 491, -247, -646, -154, 
-    233, 169, -109, -214, 264, 378, -194, -330, -100, 129, 
-    307, 65, -93, -75, -310, -212, 166, 321, 107, -255, 
-    148, 368, -366, -219, 332, -19, -222, -20, -54, -253, 
-    208, 677, -97, -316, 201, -140, -182, -48, -286, -2, 
-    34, 19, 476, 201, -198, 25, -20, -179, -108, -33, 
-    65, 4, -26, 118, 54, -59, -66, 45, 285, 129, 
-    -168, -18, -5, -242, -136, 144, 289, 273, 56, -194, 
-    -226, -56, 86, 161, 118, -205, -421, -177, 208, 296, 
-    171, 95, -334, -620, 194, 685, -117, -649, -26, 526, 
-    32, -146, 335, -62, -507, -40, 439, 463, -135, -596, 
-    -101, 302, 99, -4, 41, -59, -110, 55, -10, -251, 
-    14, 201, -95, -92, -83, -180, 74, 43, 30, 316, 
-    -79, -308, 188, 114, -114, 133, 173, -86, -228, 130, 
-    215, -370, -105, 507, 216, -103, -185, -36, 160, -334, 
-    -379, 307, 153, -110, 274, -1, -467, 59, 467, 35, 
-    -132, 148, -22, -402, -224, 187, 98, -138, 127, 80, 
-    -276, 130, 421, 12, -263, -190, 141, 282, 41, -151, 
-    -99, 72, -57, -179, 71, 132, 89, 94, -220, -293, 
-    208, 310, -155, -137, 208, -58, -349, 110, 344, -40, 
-    -45, 211, 40, -291, -272, -116, -18, 410, 211, -503, 
-    80, 389, -371, -205, 50, 93, 647, 200, -712, -408, 
-    180, 88, -167, 53, 272, -30, -133, 50, -19, -27, 
-    59, 19, 21, -45, -94, 134, 257, 102, -77, -273, 
-    -228, 233, 462, -30, -512, -183, 78, 43, 476, 260, 
-    -501, -333, 57, 322, 384, -168, -378, -97, 126, 198, 
-    -3, -51, 61, 176, 196, -386, -616, 74, 336, 78, 
-    -30, -65, -60, -92, -71, -32, -33, 120, 78, 21, 
-    242, 81, -140, -40, -81, 209, 354, -428, -382, 445, 
-    -15, -459, 216, 374, -87, -155, 84, 102, -42, -127, 
-    -168, 208, 441, -203, -715, -213, 686, 402, -428, -6, 
-    150, -286, 166, 184, -365, -177, 199, 180, -122, -214, 
-    179, 295, -82, -179, 28, 73, 98, -85, -286, 170, 
-    356, -41, -7, 66, -100, -134, -199, -49, 192, 35, 
-    -68, 117, 120, -50, -115, -163, -267, -27, 512, 260, 
-    -514, -325, 160, 103, 175, 205, -36, -180, -108, -52, 
-    -213, -59, 211, 99, 179, 246, 8, -276, -502, -60, 
-    506, 74, -345, 26, 232, 69, 124, 179, -158, -392, 
-    61, 453, -138, -600, 204, 678, -90, -307, 128, 25, 
-    -2, 147, 55, -21, -217, -276, 112, 311, 98, -31, 
-    -50, -160, 38, 275, -45, -360, -311, 3, 405, 164, 
-    -389, -158, 284, -49, -373, 31, 298, 123, 36, -115, 
-    -315, -204, 129, 482, 381, -251, -466, -142, 106, 285, 
-    91, -234, 27, 57, -169, 190, 240, -137, -124, -110, 
-    -29, 279, 162, -265, -330, 76, 278, -88, -190, 214, 
-    122, -407, -97, 522, 14, -376, 159, 243, -18, -102, 
-    -93, 156, 106, -178, -117, 202, 278, -239, -315, 214, 
-    2, -258, 161, 229, -113, -151, 116, 156, 9, 136, 
-    100, -275, -269, 124, 154, -161, -34, 247, 133, -31, 
-    -292, -220, 329, 97, -425, -76, 286, 154, -27, -11, 
-    228, 214, -204, -358, -78, 123, -65, -210, 52, 33, 
-    -270, -29, 305, 219, 64, -34, -139, -74, 185, -39, 
-    -380, 77, 286, -36, 3, -40, -139, 175, 321, -117, 
-    -457, -29, 400, 25, -435, -170, 338, 322, 88, -102, 
-    -186, 101, 94, -318, -180, 203, 123, -77, -10, 23, 
-    -64, 52, 138, -1, -136, -46, 118, -143, -142, 360, 
-    140, -221, -133, -139, 279, 452, -217, -343, -11, 128, 
-    299, 78, -205, 39, -74, -366, 66, 288, 96, 134, 
-    -199, -418, 47, 173, 32, 39, -130, -261, -74, 221, 
-    17, -208, 397, 431, -346, -260, 125, 172, 218, -124, 
-    -211, 109, -68, -12, 194, -249, -143, 360, 58, -182, 
-    -145, -121, 403, 259, -746, -441, 564, 398, -19, -60, 
-    -207, -86, 139, 9, -66, -30, -121, -159, 48, 284, 
-    168, -35, 10, 29, -69, -213, -145, 205, 36, -228, 
-    231, 222, -302, -137, 232, 204, -47, -205, -134, -65, 
-    87, 176, -36, -185, 6, 252, 99, -97, -102, -115, 
-    170, 130, -207, 104, 57, -222, 246, 172, -268, -46, 
-    70, 13, 44, 43, 71, -184, -302, -25, 123, 250, 
-    114, -279, -149, 192, 172, -103, -266, -31, 147, -30, 
-    -27, 274, 286, -169, -451, -145, 288, 359, 147, -154, 
-    -305, -36, 372, 162, -341, -65, 255, -76, -7, 167, 
-    -87, -133, -146, -159, 17, 135, 176, -84, -348, 11, 
-    317, -127, -295, 219, 140, -157, 68, 49, 90, 78, 
-    -401, -152, 361, 159, 56, 49, -163, -198, -45, 158, 
-    100, -230, -244, 141, 365, 107, -250, -187, 136, 198, 
-    -64, -116, 163, 89, -248, -29, 328, -24, -399, -24, 
-    272, -21, -110, 141, 58, -267, -210, 104, 214, 114, 
-    -114, -131, 150, 121, -117, -19, 193, 32, -423, -387, 
-    266, 448, 2, -24, 164, -168, -240, 59, 8, 166, 
-    323, -173, -367, 22, 317, 216, -213, -231, 95, -16, 
-    26, 356, -78, -541, -41, 335, 180, 30, -152, -200, 
-    -111, 133, 347, -41, -359, -85, 105, 23, -82, -54, 
-    28, 32, -84, -160, 50, 260, 182, -59, -113, 88, 
-    -61, -241, 65, 198, 31, -99, -66, 148, 189, 56, 
-    -135, -261, -61, 82, -1, -75, -55, 286, 369, -216, 
-    -406, 1, 244, 231, -21, -220, -158, -139, 63, 215, 
-    -219, -319, 207, 270, 9, 62, 87, -6, -7, -56, 
-    -84, -25, -26, 81, 81, -203, 85, 506, -93, -556, 
-    -60, 337, 165, -142, -93, 19, -95, 84, 336, 72, 
-    -266, -66, 264, 14, -365, -196, 138, 21, -139, 124, 
-    88, -286, -246, 67, 372, 203, -374, -272, 179, 292, 
-    357, -2, -406, -108, 36, -76, 81, 103, 50, -4, 
-    -153, -17, 184, 92, -88, -271, -188, 253, 337, 25, 
-    -21, 0, -105, -96, -20, 29, 0, 93, 183, -102, 
-    -176, 68, 30, -42, 44, 61, -99, -111, 189, 77, 
-    -297, -172, 157, 249, -60, -228, 176, 233, -180, -273, 
-    -63, 186, 165, -119, -144, 78, 146, 10, -58, 25, 
-    -5, -80, 65, 153, -54, -263, -98, 196, 102, -7, 
-    36, -172, -91, 163, -5, 13, 0, -253, 52, 305, 
-    72, 32, -65, -232, -35, 74, -69, -114, -60, 42, 
-    119, 89, 21, -31, 2, 30, -51, -58, 86, 186, 
-    58, -188, -104, 257, 210, -135, -121, 43, 54, 13, 
-    -69, -88, -29, 51, -58, -197, 206, 339, -157, -176, 
-    -35, 32, 251, -112, -355, -35, -51, 99, 365, 18, 
-    -237, -89, 76, 56, -154, -122, 140, 151, -48, -46, 
-    58, -44, 17, 187, -21, -212, -70, 90, -11, -201, 
-    29, 304, -22, -198, 211, 196, -220, -226, -52, 131, 
-    172, -58, -23, 85, -48, -12, 7, -96, -2, 30, 
-    -35, 105, -37, -306, 69, 346, 77, -34, -40, -140, 
-    -201, 2, 259, 49, 10, 145, -254, -327, 140, 318, 
-    75, -314, -117, 390, 152, -246, -140, 31, 151, 84, 
-    -213, -29, 415, 140, -260, -140, -105, -60, 145, 101, 
-    30, 28, -96, -158, 50, 278, -11, -371, -173, 65, 
-    114, 129, 30, -54, -161, -261, -42, 274, 185, -63, 
-    -34, -18, -86, -57, 30, 257, 134, -245, 35, 246, 
-    -134, -190, 1, 52, 81, 42, 22, 0, -22, -41, 
-    -106, 21, 9, -180, 104, 256, -36, -31, -45, -116, 
-    90, 27, -21, 157, -32, -195, -51, 122, 214, -32, 
-    -206, -80, -66, 25, 70, 23, 163, -17, -210, -25, 
-    -79, 46, 330, -2, -188, -4, -56, 6, 153, 64, 
-    -85, -88, 141, 134, -69, 68, 47, -212, -246, -86, 
-    371, 395, -318, -350, 147, 57, -86, 59, 68, -142, 
-    -189, 153, 247, -59, -81, 78, -26, -210, -77, 139, 
-    77, 6, -32, -75, 128, 223, -76, -276, -104, 103, 
-    160, 61, -147, -141, 37, 100, 116, 90, 51, -54, 
-    -172, -9, 9, -170, -1, 95, 47, 144, 40, -84, 
-    -19, 36, -39, -142, 110, 93, -346, -26, 322, -104, 
-    -156, 184, 147, -172, -266, 38, 177, 42, 27, 38, 
-    -30, -50, 1, 16, 23, 150, 156, -98, -152, 78, 
-    1, -199, -40, 116, 108, 76, 19, 20, -126, -256, 
-    26, 205, 17, -1, 19, -132, 6, 196, 26, -68, 
-    -34, -82, -12, 82, -44, -75, 149, 40, -278, -81, 
-    256, 201, -112, -333, 9, 412, 50, -334, -73, 111, 
-    141, 278, -47, -384, -105, 67, 44, 7, -155, 23, 
-    217, 38, -37, -48, -83, -144, -141, 152, 147, -62, 
-    77, -10, -101, 122, -5, -117, 47, -2, -59, 26, 
-    121, 88, -132, -135, 145, 267, 49, -206, -114, 91, 
-    58, -33, -19, 21, 83, 69, -85, -13, 149, -40, 
-    -104, 57, 37, -4, -144, -218, 101, 212, -4, -57, 
-    -21, -23, -112, -211, 38, 320, 75, -258, -158, 98, 
-    149, -1, -59, 30, -1, -65, 5, 36, -93, -138, 
-    107, 224, 23, -33, 38, -2, -44, -61, 20, 133, 
-    71, -70, -165, -54, 205, 107, -172, -118, 94, 125, 
-    -50, -80, 137, 116, -153, -173, 71, 118, -75, -73, 
-    69, 47, -50, -55, 66, 81, -106, -158, -64, 23, 
-    166, 144, -72, -136, 35, 126, -89, -136, 126, 99, 
-    -112, -117, 61, 181, -55, -164, 116, 51, -57, 243, 
-    96, -374, -258, 143, 208, -32, -78, 22, -68, 12, 
-    144, 62, -11, -206, -114, 236, 13, -170, 107, 113, 
-    -34, -75, -106, -41, 62, 98, -39, -91, 80, -53, 
-    -107, 198, 125, -117, -5, 247, 79, -390, -124, 291, 
-    -4, -156, -12, 132, 183, -38, -109, -2, 52, 54, 
-    -65, -65, 29, 53, 21, -157, -122, 140, 74, -54, 
-    40, 21, -125, -149, 81, 262, -2, -227, -36, 65, 
-    -46, 22, 142, 15, -84, -8, 2, -49, -51, 39, 
-    76, 14, 13, -49, -91, 56, 140, 12, -161, -60, 
-    119, -2, -106, -21, 48, 49, -18, 15, 39, -63, 
-    104, 176, -242, -243, 168, 151, 21, -47, -180, -78, 
-    103, 128, 30, -83, -52, -2, 30, 112, 73, -66, 
-    -45, 35, -107, -116, 131, 101, -11, 56, 19, 11, 
-    25, -97, -56, 60, -19, -88, -46, 54, 163, 85, 
-    -71, -110, -104, 5, 110, 9, -54, -43, -124, -9, 
-    238, 133, -131, -187, -72, 129, 181, 4, -113, -107, 
-    -80, 52, 201, 134, -49, -158, -115, 93, 150, -33, 
-    -85, -9, 61, 73, -90, -118, 73, 24, -100, -5, 
-    55, 56, 57, -18, -85, -90, 60, 177, -20, -91, 
-    92, 24, -178, -96, 134, 137, -59, -140, -55, 90, 
-    99, -70, -57, 132, 93, -109, -148, -36, 68, 135, 
-    87, -94, -155, -45, 58, 118, 68, -49, -61, -61, 
-    -31, 76, -2, -79, 97, 65, -142, -79, 22, 100, 
-    190, 2, -207, -152, 22, 193, 97, -139, -97, -53, 
-    -101, 79, 240, 127, -88, -136, -22, -67, 23, 299, 
-    47, -318, -167, 147, 331, 110, -249, -159, 13, 30, 
-    143, 132, -75, -153, -99, 16, 192, 186, -65, -178, 
-    17, 99, -77, -63, 69, 28, -35, -111, -73, 119, 
-    45, -142, -65, 97, 125, -17, -118, -40, 70, 185, 
-    86, -194, -134, 28, -4, 29, 17, -81, -91, -3, 
-    136, 68, -130, -18, 140, -63, -130, 115, 51, -106, 
-    63, 106, -80, -72, 161, 149, -161, -179, 54, 26, 
-    -122, -22, 130, 56, 19, 48, -19, -22, -52, -43, 
-    93, -51, -142, 137, 96, -144, -46, 21, 52, 129, 
-    -12, -68, -31, -129, -18, 199, 170, 14, -61, -1, 
-    9, -34, -26, -53, 29, 82, -123, -99, 155, 83, 
-    -132, -97, 105, 129, -99, -179, -20, 22, 30, 174, 
-    117, -98, -80, 2, 25, 60, -22, -167, -157, 63, 
-    130, -73, -37, 105, 4, -32, 84, 97, -59, -94, 
-    22, -17, 1, 119, 32, -80, -86, -22, 64, 61, 
-    -26, -144, -95, 95, 94, -30, -82, 14, 238, 217, 
-    -99, -239, -130, 21, 109, 43, -8, 22, -36, -93, 
-    -17, 131, 58, -194, -35, 120, -86, 43, 88, -154, 
-    42, 139, -47, -24, -25, -50, -58, -6, 221, 146, 
-    -177, -157, 107, 188, 13, -122, -87, -30, 54, 125, 
-    -27, -154, 38, 165, 48, -74, -136, -38, 48, -66, 
-    -45, 85, 41, -24, 21, 41, -75, -88, 77, 5, 
-    -89, 96, 89, -69, -4, 82, -37, -150, 42, 185, 
-    -31, -136, 39, 101, -99, -167, 85, 177, -30, -87, 
-    42, 17, -85, -4, 91, 29, -49, -10, 29, 0, 
-    29, 6, -83, -60, -23, 83, 154, -54, -175, -26, 
-    88, 96, -24, -131, -5, 71, -44, -69, 14, 91, 
-    56, -90, -88, 46, 71, -1, -60, -22, 127, 152, 
-    -87, -235, -11, 248, 146, -143, -170, 42, 67, -78, 
-    -25, 111, 37, -52, 13, 62, 51, -11, -78, -61, 
-    -86, -39, 165, 101, -101, -25, 12, -37, 56, 84, 
-    1, -99, -125, 22, 109, 58, 27, -8, -33, 8, 
-    -28, -140, -30, 199, 134, -152, -242, -14, 176, 119, 
-    16, -54, -60, -38, -95, -61, 132, 168, -90, -180, 
-    90, 190, 94, -24, -237, -133, 124, -3, -41, 63, 
-    -35, 9, 72, -42, -7, 24, -38, 20, 54, 21, 
-    -2, -78, -77, 80, 148, -35, -201, -29, 151, 49, 
-    -4, -105, -158, 200, 141, -235, 78, 233, -56, -14, 
-    -31, -79, 52, -42, -119, -20, 71, 118, 27, -55, 
-    -74, -72, 27, 26, -98, -57, 162, 157, -138, -116, 
-    68, -8, 74, 144, -19, -44, -107, -183, -6, 187, 
-    149, -87, -98, 97, 63, -7, -61, -84, 125, 93, 
-    -173, -87, 128, 104, -48, -53, 21, -84, -83, 31, 
-    -3, 74, 118, -44, -74, 25, 70, 22, -13, 38, 
-    -51, -158, 52, 229, -70, -264, 47, 165, -33, -61, 
-    11, -29, -88, 57, 128, -39, -64, -73, 8, 185, 
-    -67, -133, 161, -30, -169, 76, 75, 3, 26, 1, 
-    -11, -33, 38, 84, -133, -174, 166, 205, -165, -182, 
-    76, 93, 13, -86, -59, 132, 37, -113, 19, 78, 
-    -5, -45, -5, 62, 4, -96, -73, 33, 108, 9, 
-    -70, 32, -21, -74, 104, 77, -52, 27, 48, -55, 
-    -112, -2, 195, 105, -160, -95, 120, 60, -63, -70, 
-    -25, 99, 106, -48, -94, -19, 43, -18, -105, -21, 
-    82, 40, -19, -27, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -29, -29, -29, -29, 
-    -29, -29, -29, -29, -29, -29, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -28, -28, -28, -28, -28, 
-    -28, -28, -28, -28, -28, -27, -27, -27, -27, -27, 
-    -27, -27, -27, -27, -27, -27, -27, -27, -27, -27, 
-    -27, -27, -27, -27, -27, -27, -27, -27, -27, -27, 
-    -27, -27, -27, -26, -26, -26, -26, -26, -26, -26, 
-    -26, -26, -26, -26, -26, -26, -26, -26, -26, -26, 
-    -26, -25, -25, -25, -25, -25, -25, -25, -25, -25, 
-    -25, -25, -25, -25, -25, -24, -24, -24, -24, -24, 
-    -24, -24, -24, -24, -24, -24, -23, -23, -23, -23, 
-    -23, -23, -23, -23, -23, -22, -22, -22, -22, -22, 
-    -22, -22, -22, -21, -21, -21, -21, -21, -21, -21, 
-    -20, -20, -20, -20, -20, -20, -20, -19, -19, -19, 
-    -19, -19, -19, -18, -18, -18, -18, -18, -18, -17, 
-    -17, -17, -17, -17, -16, -16, -16, -16, -16, -15, 
-    -15, -15, -15, -15, -14, -14, -14, -14, -14, -13, 
-    -13, -13, -13, -12, -12, -12, -12, -12, -11, -11, 
-    -11, -11, -10, -10, -10, -10, -10, -9, -9, -9, 
-    -9, -9, -8, -8, -8, -8, -7, -7, -7, -7, 
-    -7, -6, -6, -6, -6, -6, -5, -5, -5, -5, 
-    -5, -5, -4, -4, -4, -4, -4, -4, -3, -3, 
-    -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, 
-    -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 
+const int openhat_packed_len = 15552;
+const uint8_t openhat_packed[] = {
+    0x18, 0x00, 0x30, 0x11, 0x80, 0xe0, 0x15, 0x00, 0x37, 0x0a, 0x68, 0x48, 0x42, 0xec, 0x29, 0xe1,
+    0x10, 0x88, 0xc4, 0x39, 0x41, 0x5c, 0x14, 0xd1, 0x1a, 0xd5, 0x46, 0x78, 0xa8, 0xb3, 0x05, 0xb9,
+    0x24, 0x8d, 0x6a, 0x63, 0x2b, 0xc1, 0x95, 0xb3, 0xc9, 0xa2, 0x3e, 0xc1, 0x99, 0x5b, 0x77, 0xe6,
+    0x69, 0x8a, 0x88, 0xeb, 0x47, 0xbf, 0x3b, 0x7b, 0x83, 0x2a, 0xf4, 0x9e, 0x79, 0xf5, 0x9c, 0xbb,
+    0xfa, 0x39, 0xf0, 0x3b, 0x62, 0xee, 0x64, 0x93, 0x2a, 0xd0, 0xe6, 0xb7, 0x27, 0x5e, 0x83, 0x4e,
+    0x86, 0x89, 0xcb, 0x6c, 0xe5, 0x9b, 0xaa, 0xbd, 0xc0, 0x58, 0x17, 0xf5, 0x35, 0x30, 0xb2, 0x98,
+    0x04, 0x3d, 0x83, 0x74, 0x40, 0xa2, 0x2b, 0x54, 0xdf, 0x00, 0xa4, 0x61, 0xc1, 0xb0, 0x50, 0x79,
+    0xe5, 0xc2, 0x8e, 0x88, 0x70, 0xc6, 0xc3, 0xa4, 0x16, 0xcc, 0x4d, 0x76, 0xbc, 0xd0, 0xb9, 0xb1,
+    0x90, 0xfe, 0x37, 0x00, 0xae, 0x53, 0x19, 0x21, 0x53, 0x32, 0xdd, 0xd7, 0x43, 0x2f, 0x66, 0x00,
+    0x63, 0xe0, 0xd3, 0x32, 0x69, 0x08, 0x2f, 0x81, 0xb2, 0x1c, 0xa3, 0x74, 0x30, 0x31, 0x6f, 0x00,
+    0x87, 0x30, 0x1c, 0x40, 0xe7, 0xb5, 0x64, 0x93, 0xcf, 0xe2, 0xb1, 0x7b, 0x31, 0xf9, 0x0a, 0x8e,
+    0x24, 0x51, 0x32, 0xab, 0xa1, 0x4b, 0x48, 0x4f, 0x55, 0x2a, 0xe1, 0x51, 0x9b, 0x11, 0x64, 0xb1,
+    0xd4, 0xaf, 0xe3, 0x0f, 0x95, 0xa3, 0x1f, 0xb2, 0x46, 0xdb, 0x0e, 0xcb, 0x03, 0xa2, 0xc9, 0x36,
+    0x1c, 0x82, 0xde, 0x49, 0x81, 0x0e, 0x85, 0x9c, 0xf4, 0xb1, 0x82, 0x11, 0x83, 0x54, 0x17, 0x3b,
+    0xb0, 0xbe, 0x95, 0xa7, 0xe8, 0x97, 0x90, 0x4a, 0xd2, 0xc5, 0x04, 0x4a, 0xd1, 0x48, 0xdf, 0x36,
+    0x08, 0x43, 0x66, 0x6a, 0x42, 0x19, 0xad, 0xb7, 0x0e, 0x42, 0x93, 0xd2, 0xc7, 0x35, 0x64, 0x81,
+    0x90, 0xe3, 0xa9, 0x78, 0x63, 0x10, 0x75, 0x2b, 0xab, 0x6b, 0xcc, 0xdb, 0x33, 0x47, 0x6c, 0x70,
+    0x65, 0x27, 0x2a, 0xa9, 0xba, 0xe5, 0xee, 0xac, 0x0e, 0x16, 0xac, 0xf2, 0x1c, 0xce, 0xbc, 0x7c,
+    0x7c, 0x05, 0x49, 0x1a, 0xdd, 0xc3, 0x8c, 0x49, 0xd2, 0x5b, 0x7b, 0xe9, 0xcc, 0xc4, 0x2c, 0x9e,
+    0x88, 0x03, 0xb4, 0x27, 0xcf, 0xfa, 0x07, 0xcd, 0x9b, 0x7a, 0x4f, 0x3e, 0xa9, 0x2d, 0x2d, 0x7e,
+    0x00, 0x34, 0x74, 0x16, 0xab, 0x38, 0xa6, 0x07, 0x2d, 0x47, 0x23, 0x6d, 0xb3, 0x2b, 0x41, 0x0e,
+    0x04, 0x3e, 0x45, 0x2f, 0x1d, 0x62, 0xa6, 0xfc, 0x5b, 0xb4, 0xa8, 0xad, 0x1d, 0xb8, 0x7d, 0xad,
+    0x1b, 0x55, 0x36, 0x31, 0xd6, 0x46, 0xa2, 0x08, 0x5b, 0x03, 0x31, 0x8a, 0xe5, 0xfe, 0x1d, 0x2d,
+    0x4c, 0x9f, 0xd2, 0x3e, 0x54, 0xc2, 0x6e, 0xf4, 0xe6, 0x9a, 0x9b, 0xdd, 0x94, 0x52, 0xbc, 0x0c,
+    0xa7, 0x5d, 0xd6, 0x27, 0x61, 0x27, 0x64, 0xf6, 0x79, 0x7c, 0x8c, 0x30, 0xb0, 0x34, 0x99, 0xde,
+    0x71, 0xa9, 0xe9, 0xa6, 0x4f, 0x47, 0xb9, 0x65, 0x65, 0x1e, 0xcd, 0xab, 0x04, 0x70, 0x31, 0xf3,
+    0xbc, 0x2d, 0x83, 0xb1, 0xe5, 0x90, 0x3b, 0x19, 0x14, 0x6d, 0xa4, 0x6d, 0x57, 0xbb, 0x9f, 0x07,
+    0x7f, 0xdf, 0x52, 0xef, 0xce, 0x68, 0x69, 0x95, 0xe4, 0x37, 0xa7, 0x49, 0xd5, 0x0c, 0x3b, 0xc1,
+    0x43, 0x21, 0xc7, 0x44, 0xf6, 0x3e, 0x9f, 0x37, 0x98, 0xbf, 0x38, 0xd8, 0x9a, 0xd9, 0xd6, 0x52,
+    0x89, 0x1e, 0xc0, 0xe1, 0x87, 0x63, 0x65, 0x4b, 0xdd, 0x9f, 0x50, 0x3b, 0x69, 0xa3, 0x7b, 0xfd,
+    0x8f, 0x0f, 0x58, 0x1e, 0xe4, 0x01, 0xb3, 0xc3, 0x86, 0xe2, 0x8c, 0xc0, 0xb4, 0x73, 0xaf, 0xc5,
+    0xa7, 0xe4, 0x94, 0xdd, 0xe1, 0x99, 0xcf, 0xc1, 0x1e, 0x77, 0xce, 0x69, 0x60, 0x01, 0xd4, 0x4a,
+    0x5f, 0x78, 0xe4, 0xb3, 0xc6, 0x1a, 0xc7, 0x0c, 0x4a, 0xf8, 0x31, 0xfb, 0x38, 0x1a, 0x3a, 0x19,
+    0xa8, 0x41, 0xe0, 0x71, 0xe4, 0xae, 0x19, 0x08, 0xcc, 0xe2, 0x77, 0x1e, 0x98, 0x31, 0xa9, 0xec,
+    0x28, 0x66, 0x36, 0x3c, 0x23, 0xa3, 0x9c, 0xc0, 0xec, 0x50, 0xfb, 0x7b, 0xe2, 0xb2, 0xad, 0xd0,
+    0xf7, 0x71, 0xc1, 0xad, 0x1e, 0x87, 0xae, 0x4a, 0xc8, 0x2a, 0xb5, 0x86, 0xe6, 0xef, 0x29, 0xb1,
+    0x97, 0x92, 0xb1, 0x67, 0xc0, 0xdd, 0x98, 0xb2, 0x1f, 0xf3, 0x8b, 0x85, 0x0c, 0x69, 0x83, 0xbc,
+    0x19, 0x56, 0x05, 0x5c, 0xa5, 0xb2, 0x95, 0x55, 0x79, 0x13, 0x5b, 0x05, 0xce, 0xf3, 0x16, 0x2d,
+    0x50, 0x56, 0x58, 0x4f, 0x97, 0x19, 0x98, 0x5d, 0xdc, 0x9d, 0x9c, 0xea, 0xd8, 0xe6, 0xca, 0xf2,
+    0x60, 0x97, 0xaf, 0x47, 0xd3, 0xe2, 0xdd, 0xbf, 0x6c, 0xf3, 0x5b, 0xf3, 0x35, 0x97, 0xb9, 0xdb,
+    0x92, 0xad, 0x96, 0xeb, 0x62, 0x94, 0x9d, 0xbc, 0x34, 0xe5, 0x74, 0x7e, 0x25, 0x0d, 0x5a, 0x4e,
+    0x27, 0xab, 0xf0, 0x83, 0xa6, 0xb3, 0x69, 0xe1, 0xa5, 0x59, 0x7a, 0xa7, 0x00, 0x18, 0x42, 0x16,
+    0x20, 0x3d, 0x24, 0x95, 0x0e, 0x63, 0x49, 0x84, 0xef, 0x0a, 0x50, 0x90, 0xa3, 0xa5, 0x95, 0x80,
+    0xc6, 0x1a, 0x60, 0x6b, 0x9d, 0x5c, 0x83, 0x6f, 0x30, 0xa9, 0xc6, 0x4f, 0xc6, 0x5c, 0x87, 0x1f,
+    0x4d, 0x0d, 0x2a, 0x9e, 0x5f, 0x67, 0x83, 0xea, 0x91, 0x09, 0x6d, 0x55, 0x95, 0xed, 0x31, 0x78,
+    0x02, 0x51, 0x5d, 0xeb, 0xeb, 0x1d, 0xbf, 0xa4, 0x6b, 0x84, 0xaa, 0x7a, 0x99, 0x50, 0x49, 0x56,
+    0xd0, 0x70, 0xd2, 0xa1, 0xf8, 0x54, 0x4b, 0xa6, 0x47, 0x44, 0xf5, 0xac, 0xa5, 0xbb, 0x29, 0x68,
+    0x17, 0x6b, 0xcc, 0x1e, 0xaa, 0x06, 0x7a, 0x5c, 0x3f, 0x51, 0xac, 0xf8, 0x8a, 0xf3, 0x8b, 0xd7,
+    0x48, 0x63, 0x41, 0x25, 0xcb, 0xc1, 0xff, 0x88, 0x0f, 0x86, 0x4b, 0x9b, 0xc2, 0x5a, 0x79, 0x28,
+    0xc7, 0xc0, 0xa4, 0x65, 0xf1, 0xbd, 0xee, 0xc7, 0x26, 0xe9, 0x39, 0x1c, 0xc0, 0x67, 0x55, 0x12,
+    0xf1, 0x95, 0x16, 0xa5, 0x2d, 0xa1, 0x0b, 0x62, 0x3d, 0x46, 0xba, 0x9d, 0xda, 0x26, 0xe7, 0x96,
+    0x57, 0x66, 0x9a, 0x16, 0x9d, 0x4e, 0xb3, 0x54, 0x4d, 0xe9, 0x86, 0x76, 0x41, 0x5b, 0x92, 0x1c,
+    0x24, 0xc7, 0x95, 0x6f, 0xc1, 0x96, 0xbe, 0xea, 0x0c, 0xac, 0x3f, 0x4b, 0xae, 0x06, 0xc0, 0x95,
+    0xa7, 0x3d, 0xe4, 0x10, 0x3d, 0x51, 0xc3, 0x70, 0x5e, 0xd3, 0x87, 0x11, 0x71, 0x25, 0xc1, 0xe5,
+    0x19, 0x26, 0x5d, 0x74, 0x17, 0xb9, 0x68, 0x5f, 0xc1, 0x24, 0x22, 0x1a, 0x53, 0xda, 0xe6, 0xcd,
+    0xd3, 0xdf, 0x30, 0x51, 0xfa, 0x66, 0xdc, 0xbb, 0x29, 0xc4, 0x2a, 0xcb, 0x96, 0x08, 0xd7, 0x73,
+    0x6b, 0x95, 0x73, 0x02, 0xb4, 0x09, 0xcf, 0xf3, 0x33, 0x4c, 0x2d, 0x41, 0x58, 0xaf, 0x25, 0x8b,
+    0x5c, 0x8c, 0x53, 0x15, 0xee, 0x89, 0xd0, 0x1c, 0xb2, 0xed, 0x3e, 0xf8, 0xf0, 0x1a, 0x85, 0xd5,
+    0x8e, 0xbd, 0xe9, 0x62, 0xa6, 0x57, 0x18, 0xa2, 0x3f, 0xad, 0xf2, 0x68, 0x37, 0x6c, 0x2e, 0x01,
+    0x1a, 0x2d, 0xa7, 0xa0, 0x20, 0x85, 0xa4, 0xf2, 0xa3, 0x94, 0x32, 0x00, 0xc8, 0xc7, 0x2c, 0x33,
+    0xcc, 0x5f, 0x6c, 0x55, 0x48, 0x9a, 0xe9, 0x72, 0x2c, 0xe9, 0xb6, 0xef, 0xac, 0x04, 0xa7, 0x5b,
+    0xad, 0x78, 0xba, 0xf1, 0x22, 0x32, 0xa3, 0x2d, 0xdd, 0x55, 0xfc, 0x08, 0xe2, 0x41, 0xf8, 0x04,
+    0x72, 0x23, 0x1d, 0xb3, 0x2f, 0x5e, 0xab, 0xea, 0xa6, 0x39, 0x8e, 0x46, 0xfe, 0x4f, 0x60, 0xfd,
+    0xe4, 0xba, 0xb9, 0x6f, 0xae, 0x75, 0x1e, 0x18, 0xad, 0xa5, 0x36, 0xc5, 0xff, 0x8e, 0xaf, 0x8f,
+    0xaa, 0x68, 0x6d, 0xc1, 0xe6, 0x9e, 0xcf, 0xd8, 0x52, 0x5e, 0x45, 0x3a, 0xa1, 0x79, 0x7b, 0xa9,
+    0x96, 0x94, 0x5e, 0x0d, 0x0b, 0x17, 0x79, 0x10, 0x76, 0x24, 0x6d, 0x50, 0xaf, 0x8f, 0x3e, 0x4b,
+    0xa8, 0x66, 0xb4, 0x7a, 0xb4, 0x67, 0x23, 0xc3, 0x4f, 0x02, 0x2b, 0xd5, 0x7b, 0x0f, 0x73, 0x51,
+    0xaa, 0x9f, 0x80, 0x73, 0x95, 0x6a, 0x32, 0x9c, 0x28, 0xae, 0x60, 0x09, 0xe8, 0x8a, 0xdd, 0x84,
+    0x98, 0xf5, 0xdb, 0x51, 0x61, 0x6c, 0x8c, 0x65, 0x30, 0xb7, 0x4d, 0xe0, 0xaf, 0xed, 0x92, 0xf1,
+    0x8a, 0xec, 0x72, 0x54, 0xb2, 0x2c, 0x42, 0x7f, 0x21, 0x9c, 0x4a, 0x69, 0x02, 0x90, 0x62, 0x4b,
+    0x5b, 0xca, 0x64, 0xc2, 0xab, 0x40, 0x1f, 0x50, 0xa4, 0xe1, 0x7f, 0x07, 0x86, 0xe4, 0xe8, 0x3d,
+    0xb0, 0xfd, 0xb1, 0x76, 0xe5, 0x49, 0xbe, 0x95, 0xeb, 0xb5, 0xd4, 0xcd, 0x3c, 0x8c, 0x84, 0x6c,
+    0x82, 0x1d, 0xc3, 0xd3, 0xc4, 0xdf, 0x66, 0x5d, 0x09, 0x33, 0x2e, 0x98, 0x23, 0x4e, 0xc3, 0x11,
+    0xf9, 0xef, 0x12, 0x1e, 0x37, 0xb0, 0x94, 0xdc, 0xff, 0x56, 0xc1, 0xd2, 0xb7, 0x5c, 0x94, 0xb4,
+    0x5a, 0xf6, 0x6e, 0x50, 0xf5, 0x2c, 0x88, 0xcf, 0x99, 0xeb, 0x7c, 0x5c, 0x58, 0x00, 0xcf, 0x8c,
+    0xae, 0xc6, 0x02, 0xbb, 0x60, 0xdd, 0x4f, 0x16, 0x14, 0x20, 0xcb, 0x35, 0xd6, 0x87, 0x13, 0xbf,
+    0xe4, 0x68, 0x22, 0x2d, 0x4d, 0x31, 0xfb, 0x43, 0x03, 0x3b, 0x0e, 0x94, 0xa9, 0x55, 0xa2, 0x89,
+    0x97, 0x05, 0xa2, 0xe4, 0x34, 0x02, 0x3a, 0x18, 0xb1, 0x01, 0x44, 0x78, 0xf1, 0x33, 0xfa, 0xc9,
+    0xdc, 0xab, 0xe9, 0x41, 0x61, 0x6d, 0x3d, 0x40, 0x1d, 0xb0, 0x8a, 0xd5, 0x57, 0x25, 0x96, 0x8b,
+    0xc3, 0xea, 0x5f, 0x72, 0xe7, 0xd9, 0x58, 0x89, 0x74, 0xf6, 0xd2, 0x5d, 0x33, 0x39, 0xef, 0x75,
+    0x38, 0x92, 0xd2, 0x40, 0xa5, 0xae, 0x48, 0x74, 0x4c, 0xcd, 0x41, 0xf6, 0x82, 0xe1, 0x08, 0xcd,
+    0xec, 0x74, 0x3e, 0x09, 0x7b, 0xd4, 0xf7, 0x17, 0x6f, 0x4c, 0x05, 0xeb, 0x77, 0x25, 0xe3, 0xed,
+    0x4b, 0x2e, 0x76, 0xc6, 0x2a, 0x19, 0x8b, 0x2b, 0xa6, 0x9e, 0xb9, 0x70, 0x30, 0x01, 0xfd, 0x23,
+    0xce, 0x7e, 0x0c, 0xe2, 0x0e, 0xd5, 0x66, 0x56, 0x96, 0x66, 0x63, 0xb4, 0xaf, 0xf0, 0x6f, 0x74,
+    0x61, 0xde, 0xfe, 0x10, 0xac, 0x2f, 0x83, 0x96, 0x9f, 0x7d, 0xff, 0xa3, 0x97, 0x52, 0xf1, 0x8a,
+    0x84, 0x50, 0x2a, 0xc3, 0x0e, 0xb4, 0x8a, 0x0a, 0x09, 0x82, 0xe8, 0xdf, 0x84, 0x3b, 0x76, 0x83,
+    0xb6, 0xb2, 0x02, 0xd6, 0x92, 0xda, 0x0d, 0x54, 0x0c, 0x84, 0xd1, 0xee, 0xe7, 0x10, 0x7a, 0xe4,
+    0x75, 0x59, 0xdc, 0x31, 0x05, 0xba, 0x10, 0xa2, 0xc1, 0x08, 0x2d, 0x36, 0xb8, 0x1a, 0x66, 0x66,
+    0x2c, 0x99, 0x2f, 0xd6, 0xf2, 0x47, 0x1c, 0x87, 0x40, 0xaa, 0xbc, 0x14, 0x95, 0x27, 0xda, 0xab,
+    0x22, 0x7a, 0x68, 0x26, 0x6e, 0x4d, 0x8c, 0x04, 0x20, 0x27, 0xa4, 0x17, 0x48, 0x53, 0xa1, 0x68,
+    0x6e, 0xd1, 0x7c, 0x55, 0xd6, 0xdb, 0xe8, 0xaf, 0x01, 0x24, 0x3c, 0xb7, 0xde, 0xd6, 0xab, 0x22,
+    0xf8, 0x52, 0x30, 0x2e, 0x65, 0x16, 0x13, 0xaf, 0x29, 0x2d, 0x40, 0xba, 0x35, 0x22, 0x3a, 0x30,
+    0x79, 0xbb, 0x9e, 0x9e, 0x66, 0x0a, 0x67, 0x20, 0xc9, 0x04, 0x85, 0x95, 0x42, 0x7b, 0x14, 0x8a,
+    0xe4, 0x23, 0x97, 0xc6, 0xfb, 0x00, 0x96, 0x84, 0x89, 0x68, 0xf6, 0x98, 0x9e, 0x75, 0xe7, 0x17,
+    0x67, 0x0d, 0x42, 0xff, 0x50, 0xe2, 0xa9, 0x90, 0xa1, 0x55, 0x96, 0x23, 0x6a, 0x59, 0x75, 0x51,
+    0x8e, 0xe9, 0x7d, 0xc3, 0xdc, 0xa2, 0xae, 0x30, 0xb5, 0x45, 0x1d, 0xb0, 0xa8, 0x09, 0x9c, 0x4b,
+    0x88, 0x07, 0x10, 0x0d, 0x4b, 0x9c, 0x3c, 0xe7, 0xd2, 0x5d, 0x84, 0x4a, 0x42, 0x08, 0x93, 0xd6,
+    0xb3, 0x71, 0x0c, 0x70, 0xd4, 0x41, 0xdd, 0x93, 0x25, 0x6a, 0x71, 0x04, 0x1d, 0x5e, 0x7c, 0xf8,
+    0x30, 0x2b, 0xa6, 0x56, 0x09, 0x7e, 0x40, 0x24, 0xbc, 0xb7, 0x96, 0x47, 0xf1, 0x3c, 0x8e, 0x11,
+    0x76, 0x76, 0x55, 0x1d, 0x01, 0x1c, 0xc9, 0xa6, 0xb9, 0x34, 0x5d, 0x74, 0xd9, 0x99, 0x84, 0x8b,
+    0x1c, 0x0c, 0xb1, 0x28, 0x91, 0x8e, 0x09, 0x06, 0x00, 0x5f, 0x5a, 0x24, 0x88, 0xb4, 0xf6, 0xc2,
+    0xb8, 0x8f, 0x82, 0x10, 0xe3, 0xf4, 0xa8, 0x53, 0x84, 0x77, 0x2b, 0x4e, 0xe8, 0x09, 0xe5, 0xab,
+    0x4b, 0x0d, 0xc2, 0x60, 0x0c, 0x9d, 0x1d, 0x90, 0x38, 0x91, 0x12, 0x1e, 0xa2, 0xaa, 0xad, 0x0c,
+    0x19, 0x65, 0x5f, 0x52, 0xa8, 0xad, 0x89, 0xdc, 0xe3, 0xc7, 0x48, 0x53, 0x3b, 0x86, 0x24, 0x3c,
+    0x0c, 0x7a, 0x3c, 0xa4, 0xe2, 0x08, 0x74, 0xd1, 0x47, 0x07, 0xad, 0xcd, 0x05, 0xa2, 0x0f, 0x3a,
+    0xce, 0x0c, 0x42, 0x64, 0x46, 0xd2, 0x5c, 0x7b, 0xa7, 0xe4, 0x7f, 0x95, 0x37, 0x02, 0xa8, 0x2d,
+    0xab, 0xda, 0x70, 0xdb, 0xea, 0xd7, 0xb8, 0xbd, 0xc7, 0x25, 0x16, 0x0e, 0x87, 0x1a, 0xde, 0x1f,
+    0x1d, 0xd0, 0x26, 0x96, 0x9b, 0x4f, 0x12, 0xaa, 0xbf, 0x80, 0xae, 0xe9, 0x71, 0x8d, 0xcb, 0x1a,
+    0xe2, 0xe0, 0x50, 0x12, 0x03, 0xe7, 0xc6, 0x23, 0x5a, 0xe1, 0xb0, 0x6c, 0x5c, 0x6c, 0x80, 0x96,
+    0x2c, 0x9c, 0x88, 0x46, 0x4a, 0xa2, 0x49, 0x72, 0x1f, 0xc1, 0x91, 0x39, 0xce, 0x71, 0x3c, 0xce,
+    0x1b, 0x2e, 0xaf, 0xc9, 0x92, 0x6c, 0x7e, 0x42, 0x81, 0x74, 0x40, 0xb4, 0xb6, 0x9a, 0xf9, 0x34,
+    0x0a, 0x95, 0x8f, 0x60, 0x3b, 0x83, 0x66, 0x0d, 0x81, 0xc4, 0x69, 0x13, 0x31, 0xe4, 0x2a, 0xad,
+    0x5d, 0x53, 0x2f, 0xf5, 0x03, 0xbe, 0x2d, 0x66, 0x85, 0xc3, 0x0b, 0x0c, 0x9a, 0xf9, 0xf4, 0xec,
+    0x6a, 0x2a, 0xb0, 0x89, 0x2c, 0x47, 0xd9, 0xf3, 0x88, 0xe3, 0xb3, 0xea, 0x5e, 0xaf, 0x4e, 0x1c,
+    0xd9, 0xef, 0x32, 0x57, 0xf8, 0x2b, 0x19, 0x87, 0xc8, 0x35, 0xbe, 0x7f, 0x06, 0xcd, 0x10, 0x17,
+    0x5e, 0x61, 0x7c, 0xd0, 0x72, 0x33, 0x23, 0x71, 0xe6, 0x9c, 0x77, 0x31, 0x0c, 0x13, 0xb9, 0x3e,
+    0xf1, 0x27, 0xa6, 0xb5, 0xcb, 0x01, 0xe0, 0xc5, 0xd4, 0xbe, 0x06, 0x74, 0xa2, 0xd1, 0xfb, 0xd8,
+    0x57, 0xf4, 0xaf, 0x4b, 0x4e, 0x83, 0x9e, 0xe4, 0x18, 0xfe, 0x79, 0xbc, 0xa6, 0xdf, 0x47, 0x09,
+    0x93, 0xe2, 0x1b, 0x2d, 0x8e, 0xc4, 0xd7, 0xb6, 0xfa, 0xa6, 0xf0, 0x03, 0xfe, 0x6d, 0x93, 0x44,
+    0xfd, 0x33, 0x62, 0x31, 0xb4, 0x47, 0x48, 0x7d, 0x32, 0x4b, 0x8e, 0xd4, 0x9c, 0xf0, 0xa3, 0xab,
+    0xe1, 0x6a, 0xcb, 0x39, 0x3c, 0x53, 0xc0, 0x96, 0x30, 0x08, 0x75, 0xdf, 0x2b, 0xdb, 0x29, 0x6d,
+    0x44, 0xf6, 0xf2, 0xda, 0xa2, 0x3f, 0x6c, 0xfb, 0xe8, 0x73, 0xfa, 0x4f, 0x2b, 0xe4, 0xc1, 0x24,
+    0xb8, 0xb8, 0x0d, 0x8c, 0xc7, 0xc6, 0xb9, 0x1a, 0x32, 0xc9, 0x91, 0x4a, 0x28, 0xc6, 0x1a, 0x14,
+    0x46, 0x2c, 0x45, 0xf7, 0xc9, 0xab, 0x38, 0xc1, 0x48, 0xb9, 0xa6, 0x09, 0x71, 0x92, 0x86, 0xa6,
+    0x54, 0xaa, 0x7d, 0x1f, 0xa9, 0x60, 0xe2, 0xb6, 0x7b, 0x39, 0x64, 0x6d, 0x6d, 0x2a, 0x3a, 0x89,
+    0xde, 0xb0, 0x63, 0x90, 0x7e, 0x5c, 0xd6, 0x07, 0xb8, 0xdc, 0x8f, 0x8e, 0x99, 0x79, 0x95, 0x97,
+    0xd0, 0xe6, 0x7d, 0x3c, 0x91, 0x32, 0xc8, 0x7e, 0x1b, 0xef, 0xa9, 0xa4, 0x07, 0x9b, 0xc6, 0xa8,
+    0x99, 0x1e, 0x71, 0x31, 0xd7, 0x6f, 0xb8, 0xf6, 0xab, 0x9a, 0x66, 0x88, 0xa7, 0x6c, 0xc6, 0x3a,
+    0xde, 0x7e, 0xd1, 0x20, 0x6f, 0x12, 0x11, 0x69, 0xc4, 0xf2, 0x22, 0x89, 0x5b, 0x44, 0x7b, 0x69,
+    0x94, 0x07, 0x47, 0x6a, 0xac, 0x66, 0x5b, 0x5f, 0xfc, 0x1a, 0xe3, 0x97, 0xe3, 0x39, 0x7f, 0x8e,
+    0xdd, 0x7a, 0x39, 0xb2, 0xba, 0xb7, 0x7b, 0x9a, 0x6b, 0x0d, 0xc9, 0xad, 0x54, 0xf1, 0xf8, 0x94,
+    0x0c, 0xe9, 0x5e, 0x4a, 0x56, 0x09, 0xe9, 0x05, 0xda, 0x15, 0xae, 0x4d, 0x4a, 0xac, 0x3d, 0xa0,
+    0x5d, 0x20, 0xf0, 0xda, 0x12, 0x28, 0x37, 0xaa, 0xd2, 0xa0, 0xf5, 0x35, 0x74, 0x9f, 0x35, 0xcc,
+    0x3a, 0xba, 0xa5, 0xc8, 0xaf, 0xc4, 0x00, 0x67, 0x7d, 0xb7, 0xed, 0x85, 0xf0, 0x38, 0x9a, 0x0f,
+    0x75, 0xb8, 0x99, 0xbc, 0xf6, 0x7e, 0x99, 0xae, 0x29, 0x9d, 0xe0, 0x67, 0xe3, 0x99, 0xeb, 0xbc,
+    0x7b, 0x68, 0x54, 0xf3, 0x3b, 0x5e, 0x1f, 0xe3, 0x47, 0xa2, 0x63, 0x86, 0x4d, 0xe6, 0xf6, 0x2d,
+    0xe9, 0x54, 0x0e, 0x79, 0x72, 0xe1, 0xf0, 0xd2, 0xa1, 0xe1, 0x74, 0x0d, 0xb5, 0xeb, 0x44, 0xa2,
+    0x51, 0x42, 0x38, 0x25, 0x07, 0x56, 0xcf, 0xf5, 0x7f, 0x01, 0x2e, 0xa5, 0x0a, 0xa5, 0x8a, 0x8b,
+    0x8e, 0xce, 0xa4, 0xf4, 0xb0, 0x56, 0x82, 0x1d, 0xc4, 0x58, 0x3b, 0x92, 0x51, 0x51, 0x74, 0x9b,
+    0xcc, 0x63, 0xdc, 0x1b, 0xe0, 0x5b, 0xf8, 0x78, 0xf1, 0xe8, 0x90, 0xb5, 0xf8, 0x7c, 0x8e, 0x0b,
+    0xcb, 0xf5, 0xf1, 0xd0, 0x8e, 0x17, 0x1d, 0x40, 0x38, 0x52, 0x5c, 0x14, 0x60, 0x4b, 0xcb, 0x32,
+    0x15, 0xbc, 0xbc, 0xf1, 0xaf, 0x12, 0x43, 0x8b, 0x91, 0x85, 0x5f, 0x81, 0x98, 0xb9, 0x4c, 0x48,
+    0xab, 0xeb, 0x72, 0x0d, 0xb0, 0x44, 0x8a, 0x8a, 0x50, 0x5d, 0x48, 0x95, 0xc2, 0x71, 0xa5, 0x60,
+    0x4b, 0x4e, 0xa3, 0xeb, 0xb0, 0xae, 0x9b, 0x1b, 0x7d, 0x52, 0xf6, 0xcc, 0xae, 0x84, 0xec, 0xbb,
+    0x91, 0x9f, 0xe5, 0xd9, 0x89, 0xb1, 0x4f, 0xf8, 0x8c, 0xe1, 0xdf, 0x5f, 0x28, 0x9a, 0x2f, 0xd5,
+    0x6d, 0x9a, 0xf1, 0x68, 0x84, 0x9b, 0x81, 0x7f, 0x69, 0xfc, 0x80, 0x3e, 0xcf, 0x46, 0xcb, 0xf1,
+    0x2d, 0xc1, 0x27, 0x0f, 0xea, 0xe4, 0x22, 0x1c, 0xa1, 0x03, 0xf3, 0xc9, 0xc5, 0x13, 0xba, 0xd5,
+    0x52, 0x24, 0xa2, 0x75, 0xa4, 0x71, 0x63, 0xb3, 0xd7, 0x0e, 0xba, 0xb8, 0x55, 0x49, 0x01, 0xb5,
+    0x60, 0x4a, 0xe0, 0x46, 0x69, 0xc7, 0x4d, 0x98, 0x7a, 0xba, 0x70, 0x38, 0x73, 0x6a, 0xe2, 0xf1,
+    0xe5, 0x90, 0x7f, 0x47, 0xaf, 0x2c, 0x4c, 0x46, 0x77, 0x69, 0x5e, 0xac, 0xb2, 0xf7, 0x91, 0xdc,
+    0x3b, 0xd7, 0x08, 0x91, 0x7c, 0xf7, 0xf1, 0x57, 0xae, 0x97, 0x31, 0xc8, 0x44, 0x74, 0xff, 0xe3,
+    0xaa, 0x1f, 0x15, 0xfe, 0x01, 0xbd, 0x6b, 0x5d, 0xbb, 0x61, 0x28, 0x05, 0x9a, 0x8c, 0xb2, 0xaf,
+    0xbd, 0x62, 0x09, 0x55, 0xbd, 0xac, 0x2c, 0x85, 0x2c, 0x83, 0xc7, 0xcf, 0x5e, 0xdb, 0xbf, 0xf9,
+    0xb4, 0x7b, 0xa3, 0x73, 0x6d, 0xf8, 0x8b, 0x90, 0xfa, 0x9a, 0x5d, 0xc3, 0x09, 0x8c, 0x26, 0xfb,
+    0x56, 0xd9, 0x9f, 0x83, 0x97, 0x87, 0xf4, 0x52, 0xf3, 0x09, 0x02, 0x4e, 0x69, 0x9c, 0x58, 0xbe,
+    0x85, 0xbe, 0xb1, 0x3d, 0xdd, 0xa1, 0xc4, 0xaf, 0x3b, 0x0f, 0x0f, 0x44, 0x4b, 0xc6, 0xa2, 0x1b,
+    0xb7, 0x43, 0x34, 0x6c, 0xf3, 0x04, 0xa9, 0x15, 0xb2, 0x86, 0xef, 0x17, 0xe8, 0x93, 0xc0, 0x73,
+    0x58, 0xc1, 0x4d, 0x5d, 0x46, 0x20, 0x57, 0xdc, 0x1c, 0x54, 0x5e, 0x1c, 0xd0, 0xcc, 0xae, 0xe2,
+    0x41, 0xf3, 0xd9, 0x01, 0xbd, 0x3b, 0x15, 0x3e, 0x6c, 0x70, 0x6e, 0x8c, 0x23, 0xc5, 0x37, 0x41,
+    0xb9, 0x80, 0x10, 0x7c, 0x5c, 0xfc, 0x5c, 0x3a, 0x17, 0x21, 0x47, 0x0e, 0x9e, 0x72, 0x2b, 0xc7,
+    0xf0, 0x5e, 0x8a, 0x57, 0xf0, 0x5b, 0x43, 0x3f, 0x00, 0x89, 0x66, 0x90, 0xf1, 0xf2, 0x6c, 0xfa,
+    0x0d, 0x43, 0x59, 0x1b, 0x9c, 0x9b, 0x33, 0xfe, 0x06, 0x36, 0xe8, 0x33, 0x01, 0x71, 0x76, 0x6e,
+    0xe4, 0x3e, 0x81, 0x3c, 0xf1, 0xb4, 0x50, 0xb7, 0xcb, 0x02, 0x86, 0x25, 0x1f, 0x06, 0x2e, 0xd9,
+    0x3a, 0xc4, 0x5f, 0x2b, 0x38, 0xbb, 0xb0, 0xa5, 0xeb, 0xe1, 0x58, 0x38, 0xf6, 0x63, 0x06, 0xd1,
+    0x55, 0x5a, 0x0c, 0xea, 0x0e, 0xb6, 0xec, 0x00, 0x94, 0x0b, 0x03, 0x1c, 0xb6, 0xe0, 0x41, 0xc4,
+    0x60, 0xb6, 0xaa, 0xe2, 0xcf, 0x06, 0xc9, 0x5b, 0xbb, 0xa4, 0x77, 0xd2, 0x79, 0xfe, 0xe6, 0xe1,
+    0x95, 0xe0, 0x6d, 0x0f, 0x2e, 0xbf, 0xfa, 0x81, 0xe1, 0x2d, 0x64, 0x0a, 0xb4, 0x9c, 0xdb, 0x4e,
+    0x25, 0x69, 0x73, 0xd7, 0xa6, 0xfb, 0x76, 0x0a, 0xdf, 0xd1, 0xe9, 0xaf, 0x53, 0x5f, 0x3c, 0x77,
+    0x30, 0x7c, 0xcc, 0xe7, 0xa2, 0xcc, 0x95, 0xbc, 0x3e, 0x0f, 0x3f, 0x77, 0xd4, 0x65, 0x21, 0x2b,
+    0x24, 0x6e, 0x6c, 0x9e, 0xfb, 0xc0, 0xca, 0x34, 0x98, 0x58, 0xb3, 0x57, 0x6b, 0x80, 0x41, 0x57,
+    0x42, 0x38, 0x0e, 0xe8, 0x41, 0xcf, 0x21, 0x3f, 0xfd, 0x77, 0x79, 0xcc, 0xc8, 0x3b, 0x6a, 0xc2,
+    0x86, 0x37, 0x75, 0xd0, 0x85, 0xde, 0xdb, 0x62, 0x29, 0xc8, 0xe9, 0xf5, 0xaf, 0x42, 0xaa, 0xa0,
+    0xbc, 0x09, 0x15, 0xa6, 0x5f, 0x88, 0x62, 0x9a, 0xab, 0xed, 0x3a, 0x24, 0x39, 0x4e, 0x76, 0x00,
+    0x90, 0x3d, 0x38, 0x77, 0x1a, 0x9d, 0x1a, 0xa4, 0xe3, 0x3c, 0x23, 0xb8, 0xb8, 0xca, 0xaa, 0xfb,
+    0x10, 0xe7, 0x6f, 0x31, 0x39, 0x10, 0xc5, 0xfc, 0x40, 0x31, 0xed, 0x6c, 0x25, 0x5a, 0x2f, 0x1d,
+    0x4b, 0x40, 0x9f, 0x81, 0x84, 0x48, 0xe3, 0x9b, 0x3e, 0xa3, 0x29, 0x91, 0xa5, 0x50, 0x35, 0x5b,
+    0x99, 0x3c, 0x30, 0x88, 0x18, 0x2e, 0x09, 0x1d, 0xc3, 0x32, 0x3a, 0x16, 0xeb, 0xa7, 0xcb, 0x47,
+    0x1b, 0xae, 0x4b, 0x96, 0x03, 0xe0, 0x5e, 0x83, 0xb6, 0x3b, 0x78, 0x5e, 0x16, 0x51, 0x4e, 0xf1,
+    0xf5, 0xcb, 0x6f, 0x83, 0xb6, 0x6f, 0x01, 0x94, 0xd3, 0x74, 0xdb, 0x77, 0x2e, 0x6a, 0xc6, 0xbb,
+    0xe7, 0x06, 0xb3, 0xdf, 0x30, 0x02, 0xad, 0xe1, 0xea, 0xe9, 0x0f, 0x64, 0xa5, 0x24, 0x70, 0x02,
+    0x58, 0xac, 0xe1, 0xc6, 0x77, 0x53, 0x2e, 0x17, 0x41, 0xe4, 0xc6, 0x70, 0x5c, 0x3c, 0x4a, 0xe0,
+    0xbf, 0xca, 0x82, 0x14, 0xd1, 0x0d, 0x8e, 0x2c, 0x8a, 0xe2, 0x12, 0xed, 0xee, 0xcd, 0x78, 0xa1,
+    0xea, 0x74, 0x53, 0xed, 0xa1, 0x54, 0xc5, 0x31, 0x2b, 0x49, 0x3f, 0x0b, 0xab, 0xa7, 0x62, 0x07,
+    0x3a, 0x93, 0x1f, 0x25, 0xcb, 0xc1, 0x02, 0x6e, 0xa8, 0xee, 0x65, 0xb4, 0x15, 0x3d, 0xf8, 0x62,
+    0xaf, 0x5c, 0xce, 0x33, 0x5a, 0x58, 0xdc, 0x98, 0xdf, 0x18, 0xf6, 0xaa, 0x96, 0x12, 0xe9, 0x74,
+    0xb6, 0x0a, 0xb8, 0xa2, 0x23, 0xd0, 0x46, 0x10, 0x59, 0x26, 0xd5, 0x45, 0x1a, 0x99, 0xca, 0x01,
+    0xa3, 0x50, 0xc0, 0x92, 0xce, 0x04, 0x8b, 0x80, 0xd8, 0x7a, 0x59, 0xb1, 0x95, 0x75, 0xb1, 0x13,
+    0xbc, 0x79, 0x27, 0x25, 0x07, 0x47, 0x9e, 0x7c, 0x7a, 0x94, 0x87, 0x74, 0x80, 0x03, 0xc2, 0x9a,
+    0xb1, 0xdf, 0x06, 0x91, 0xe5, 0x4b, 0xed, 0x05, 0xa5, 0xe1, 0x48, 0x96, 0x77, 0x47, 0xc5, 0xfb,
+    0x9d, 0x86, 0xdb, 0xd9, 0xb4, 0xf7, 0xc3, 0x3a, 0xfa, 0xad, 0x5f, 0x61, 0x7b, 0x65, 0xf6, 0x6d,
+    0x94, 0x81, 0x89, 0xfc, 0x8c, 0xa0, 0xf3, 0x11, 0x5a, 0x96, 0x40, 0x89, 0x06, 0x95, 0xf0, 0xa1,
+    0x49, 0xd4, 0x15, 0xa0, 0x30, 0x59, 0x52, 0x79, 0x90, 0x30, 0x28, 0x78, 0x5d, 0x94, 0x37, 0x40,
+    0x82, 0xa1, 0xb2, 0x98, 0xd3, 0x0e, 0xad, 0xfc, 0xed, 0x5d, 0xb2, 0x47, 0x02, 0x1b, 0xd1, 0xc4,
+    0x09, 0xb2, 0x32, 0x5a, 0x48, 0xca, 0x49, 0x8d, 0xea, 0x54, 0x29, 0xce, 0xad, 0xe4, 0xa9, 0x75,
+    0xa9, 0x64, 0xe5, 0x81, 0x9d, 0xb7, 0xb4, 0x1e, 0x12, 0x78, 0xcb, 0x33, 0x04, 0xf6, 0x06, 0xf7,
+    0x74, 0x38, 0xb2, 0xcf, 0x4b, 0x2b, 0xe1, 0x6c, 0xab, 0x8a, 0x28, 0x64, 0x08, 0x3d, 0xfa, 0x2c,
+    0xc7, 0x4e, 0x0e, 0x9a, 0xe2, 0x5a, 0xaa, 0xf9, 0xb5, 0xc9, 0xd8, 0x3b, 0x8d, 0xf3, 0x9d, 0xf1,
+    0x7b, 0x83, 0x1d, 0x08, 0x2a, 0xd8, 0xa3, 0xbb, 0x41, 0x8e, 0x7d, 0xed, 0x9f, 0x76, 0x24, 0xf6,
+    0x0e, 0xa0, 0xa0, 0xf6, 0x27, 0xfc, 0x21, 0xc5, 0x44, 0xbf, 0x96, 0x21, 0x61, 0x74, 0x61, 0x52,
+    0x6c, 0xc6, 0x9c, 0xe6, 0x9c, 0xe0, 0x45, 0x97, 0xf4, 0x9c, 0x3c, 0x38, 0xe4, 0xa3, 0xe4, 0xac,
+    0x65, 0xdd, 0x0a, 0x67, 0xbf, 0x5f, 0xe9, 0xcf, 0x23, 0x6b, 0x01, 0x19, 0x74, 0x75, 0xe4, 0xef,
+    0xb7, 0x4b, 0xff, 0x78, 0x20, 0x56, 0x75, 0xe1, 0x69, 0xc5, 0xae, 0xec, 0x90, 0x71, 0x0a, 0x58,
+    0xc4, 0xd3, 0x4c, 0xb2, 0xd2, 0x4e, 0xd3, 0x57, 0xb8, 0xc0, 0x7b, 0x1f, 0x9c, 0x15, 0x8e, 0xf0,
+    0xb2, 0x82, 0x15, 0xc3, 0xa5, 0x2d, 0x52, 0xd6, 0x2f, 0xc2, 0x29, 0x5a, 0xf9, 0x8d, 0xa3, 0x1e,
+    0x91, 0x98, 0xad, 0x12, 0xcf, 0x24, 0xbc, 0x43, 0xea, 0x71, 0x17, 0x27, 0x99, 0x62, 0x10, 0x29,
+    0x16, 0xd1, 0x28, 0xcd, 0x43, 0x2e, 0x6a, 0xa8, 0xe6, 0x67, 0x0c, 0x4b, 0xae, 0x26, 0x02, 0xc6,
+    0x28, 0x34, 0xbf, 0xf9, 0xdc, 0xc3, 0x97, 0x99, 0x76, 0xf9, 0x44, 0xc3, 0x84, 0xbd, 0x68, 0xe3,
+    0xd9, 0xa3, 0x24, 0x0c, 0x7d, 0x07, 0x72, 0xa9, 0xba, 0x86, 0x38, 0xd0, 0x28, 0x3f, 0x9e, 0x36,
+    0x38, 0xbb, 0xea, 0x11, 0xec, 0x2d, 0x23, 0x0d, 0x8d, 0x71, 0x43, 0x8b, 0x68, 0x31, 0x67, 0xa8,
+    0x8a, 0x77, 0xf7, 0xcd, 0xc2, 0xa2, 0x53, 0x17, 0x1f, 0x6c, 0x33, 0x0d, 0x5f, 0xb0, 0xda, 0x86,
+    0x78, 0x81, 0x46, 0xdf, 0x82, 0x38, 0x01, 0xc2, 0x42, 0x46, 0x40, 0xa9, 0x88, 0x3e, 0x15, 0xb0,
+    0x38, 0xd3, 0xe9, 0x26, 0x10, 0xb6, 0x2e, 0xf9, 0x82, 0x87, 0x4e, 0x99, 0x06, 0xd1, 0x9e, 0x7b,
+    0xe0, 0xcc, 0xaa, 0x71, 0x09, 0x2c, 0x13, 0xeb, 0x90, 0xf9, 0xd1, 0xab, 0x85, 0xdc, 0x1d, 0x8b,
+    0xad, 0xe7, 0xe4, 0x24, 0xff, 0xf9, 0x5b, 0xdc, 0x43, 0x27, 0x40, 0xb5, 0x64, 0x71, 0x7c, 0xcc,
+    0x2a, 0x2e, 0x3e, 0x69, 0x69, 0x39, 0x8d, 0x00, 0x15, 0x80, 0x64, 0x6f, 0x66, 0xfa, 0xde, 0x99,
+    0xea, 0x5e, 0x22, 0x0c, 0xba, 0x73, 0x9d, 0xe6, 0xa2, 0x98, 0x3c, 0xf8, 0x68, 0xe7, 0xe9, 0xae,
+    0x86, 0xfb, 0xa2, 0xd7, 0xaf, 0x43, 0x88, 0x02, 0x47, 0x77, 0xbe, 0x7d, 0x84, 0xf9, 0xb1, 0x55,
+    0x22, 0x48, 0xe9, 0x87, 0x24, 0xf7, 0x29, 0x75, 0xa8, 0xb2, 0x5d, 0x11, 0x77, 0xa3, 0x6e, 0x8a,
+    0xca, 0x44, 0xfb, 0xe1, 0xc4, 0x3e, 0x72, 0x41, 0x56, 0x2b, 0x3f, 0x28, 0x71, 0xcc, 0xa5, 0xca,
+    0x79, 0x54, 0x58, 0x65, 0xaa, 0x63, 0x05, 0xb7, 0x4c, 0xc7, 0x0a, 0x4c, 0x15, 0xa9, 0xc4, 0xdd,
+    0xbd, 0x27, 0x25, 0x15, 0x3b, 0x28, 0xc6, 0xb3, 0x76, 0xe5, 0xf9, 0xe6, 0x26, 0x4f, 0xd8, 0x88,
+    0x4b, 0x0e, 0xb4, 0xa3, 0x20, 0x53, 0xe6, 0x04, 0xa9, 0x4e, 0x12, 0x3c, 0x66, 0xfc, 0x45, 0x64,
+    0xd1, 0x7a, 0xe0, 0x4c, 0xf2, 0x29, 0x9f, 0x8f, 0x44, 0xe9, 0x61, 0x68, 0x9f, 0x60, 0xbb, 0xe1,
+    0x34, 0x16, 0x43, 0x6d, 0xf0, 0xe2, 0x90, 0x9b, 0xc7, 0xd1, 0x2c, 0x38, 0x4b, 0x8f, 0x07, 0x1b,
+    0x28, 0x19, 0x43, 0xed, 0xd8, 0xa2, 0xa5, 0x71, 0x5c, 0x1f, 0x5e, 0xf6, 0x5d, 0xd8, 0x3c, 0x65,
+    0x1b, 0x7c, 0xba, 0x38, 0x14, 0xe2, 0x88, 0x88, 0x39, 0x18, 0x08, 0xb0, 0x68, 0xce, 0xf9, 0x2b,
+    0x74, 0xc5, 0xb2, 0x06, 0x1b, 0x4b, 0xe2, 0x22, 0xc0, 0x96, 0xf3, 0xd7, 0xc8, 0x8e, 0x8d, 0xfc,
+    0x4d, 0x24, 0xf8, 0xb2, 0x92, 0x85, 0xe6, 0xae, 0x36, 0xf3, 0xbc, 0x94, 0xc8, 0xad, 0x2a, 0xb2,
+    0x31, 0xf0, 0x59, 0xf8, 0x9b, 0xbe, 0x64, 0xd5, 0x21, 0xec, 0xdb, 0x4b, 0xb3, 0x71, 0x13, 0xa5,
+    0x9a, 0xe3, 0x46, 0x4a, 0x56, 0x77, 0x71, 0x2a, 0x70, 0x2c, 0x8c, 0x53, 0x27, 0x19, 0xc9, 0x5e,
+    0x33, 0xd2, 0xfc, 0xe1, 0xaa, 0x31, 0x10, 0xe4, 0x66, 0x1a, 0xac, 0xaf, 0xd9, 0x36, 0xba, 0xc8,
+    0x7b, 0xd0, 0xf2, 0x92, 0x0a, 0x7f, 0xcb, 0x17, 0x7f, 0x34, 0x78, 0xed, 0xed, 0x2a, 0xcd, 0x7b,
+    0x69, 0x09, 0x8d, 0xb7, 0x98, 0xa9, 0x1e, 0xf8, 0xa0, 0x30, 0x48, 0x7b, 0xc4, 0xc9, 0x15, 0xe2,
+    0x98, 0xcf, 0x2a, 0x27, 0xd4, 0x21, 0xff, 0xfa, 0x31, 0xe6, 0x19, 0xab, 0xd2, 0x01, 0xc9, 0xd6,
+    0x45, 0x22, 0x82, 0x14, 0xa4, 0x54, 0xdf, 0x91, 0xa1, 0xc8, 0x5d, 0xe8, 0x5c, 0x72, 0xa6, 0x84,
+    0x38, 0x7a, 0xe2, 0xe6, 0xbf, 0xd0, 0xe6, 0x83, 0x2a, 0x8b, 0xd1, 0xb8, 0x94, 0x00, 0xfe, 0x04,
+    0x42, 0x0f, 0x05, 0x35, 0x9f, 0x03, 0x17, 0x24, 0x9c, 0x42, 0x2c, 0x4c, 0xae, 0xde, 0x6b, 0x6f,
+    0x25, 0x6a, 0x45, 0x64, 0x6b, 0x9a, 0x6e, 0xc6, 0x99, 0x3c, 0x61, 0xa3, 0xac, 0xe8, 0x14, 0xf0,
+    0x6c, 0xaa, 0xb4, 0x38, 0x49, 0x08, 0xec, 0x74, 0xbb, 0x27, 0x8c, 0xc2, 0x8a, 0x90, 0xd3, 0x53,
+    0x28, 0x25, 0x1c, 0x1c, 0xb7, 0x52, 0x72, 0x07, 0xc4, 0x3b, 0x3e, 0xd0, 0xcc, 0x3c, 0xbc, 0x3d,
+    0xdb, 0x42, 0xba, 0xcf, 0x6b, 0x2a, 0x18, 0x53, 0x8a, 0xc5, 0xe2, 0x0d, 0xa3, 0x18, 0xfb, 0xb4,
+    0xc1, 0x42, 0xd4, 0xc0, 0x8e, 0xe9, 0x2f, 0xbe, 0xd5, 0x9a, 0xd8, 0x16, 0x56, 0xb3, 0x2a, 0x4f,
+    0xda, 0x9b, 0x03, 0x0d, 0x21, 0xdb, 0xa6, 0xc2, 0x49, 0x5c, 0x80, 0x22, 0x60, 0x92, 0x56, 0xd1,
+    0xcc, 0xee, 0xc7, 0x1b, 0x92, 0x02, 0x05, 0xb8, 0xec, 0x42, 0xff, 0x94, 0xa0, 0x7d, 0xd0, 0x22,
+    0x65, 0x0b, 0x5f, 0xd5, 0x36, 0x96, 0xdc, 0x28, 0x06, 0x47, 0x7f, 0xb4, 0x02, 0xb5, 0x85, 0x86,
+    0xe3, 0x13, 0x6e, 0xec, 0x23, 0x8d, 0x27, 0x9b, 0xec, 0x7a, 0xf8, 0xf6, 0x54, 0x2a, 0x0f, 0xe0,
+    0x5a, 0x4e, 0x46, 0xca, 0x91, 0xf4, 0x3d, 0xa9, 0x4b, 0x74, 0x5e, 0x88, 0x86, 0xf3, 0xdf, 0xad,
+    0x9e, 0x6c, 0x5a, 0xdb, 0x5b, 0x36, 0xd7, 0xa8, 0xf9, 0x00, 0x66, 0xa4, 0x85, 0x68, 0x0b, 0x63,
+    0xd8, 0xcf, 0xb2, 0xdd, 0x86, 0xd1, 0xb8, 0x9d, 0x6d, 0xad, 0x02, 0xaf, 0x41, 0x11, 0x07, 0xb2,
+    0x80, 0x56, 0x2e, 0xa6, 0x83, 0x80, 0x63, 0x8c, 0x5a, 0x56, 0xc1, 0xb1, 0xbc, 0x76, 0x5b, 0x82,
+    0x26, 0xc0, 0x18, 0x74, 0xf2, 0x13, 0x3a, 0xee, 0x26, 0xd9, 0x54, 0x4f, 0x6e, 0xe1, 0x70, 0x4c,
+    0x07, 0x3a, 0x9c, 0xbf, 0xf4, 0x73, 0xa3, 0x8a, 0x7a, 0x18, 0xbb, 0x03, 0xb4, 0xd1, 0x47, 0x36,
+    0xd7, 0x88, 0x35, 0x89, 0x08, 0xb2, 0xaa, 0xd4, 0xc5, 0x5c, 0xb4, 0x08, 0x65, 0x7d, 0x41, 0xaa,
+    0x1c, 0xb7, 0x4c, 0x74, 0x89, 0x28, 0x53, 0x41, 0x95, 0xc6, 0x07, 0x12, 0xb5, 0xe7, 0xf0, 0xb8,
+    0x13, 0xe3, 0x17, 0x01, 0xf2, 0x05, 0x1b, 0x62, 0x0e, 0x95, 0x00, 0x69, 0xa3, 0x38, 0x78, 0xb2,
+    0x42, 0x12, 0x5d, 0xa0, 0xdd, 0x2a, 0x84, 0xd8, 0x0f, 0x25, 0x73, 0x02, 0x69, 0x1b, 0x00, 0xf4,
+    0xd0, 0x60, 0x02, 0x52, 0x51, 0x2e, 0x35, 0xfb, 0xcc, 0x8c, 0xec, 0x8e, 0x0f, 0x20, 0xfe, 0xe0,
+    0x82, 0x1c, 0x16, 0x7c, 0x37, 0x6a, 0xf6, 0xb1, 0x9c, 0x16, 0x22, 0x24, 0x2c, 0xf8, 0xe8, 0x98,
+    0xef, 0x47, 0xe3, 0x30, 0xde, 0x8d, 0x21, 0xa6, 0x1c, 0xa5, 0x66, 0x98, 0xf1, 0xcd, 0xab, 0x43,
+    0x12, 0xe6, 0x93, 0xb1, 0xa1, 0x2c, 0x31, 0x73, 0x2d, 0xeb, 0xd5, 0x5c, 0xa8, 0x4b, 0xdc, 0x6c,
+    0xba, 0xcb, 0x52, 0x37, 0xd1, 0x19, 0xe4, 0x1b, 0x03, 0x50, 0xc2, 0x08, 0xa9, 0x0d, 0x04, 0x24,
+    0xc5, 0x56, 0x64, 0x7a, 0x4e, 0x11, 0x16, 0x8f, 0x72, 0x8b, 0xc5, 0x67, 0xb4, 0x5a, 0x55, 0xd0,
+    0x92, 0x47, 0x11, 0xd8, 0x49, 0x02, 0x26, 0x1b, 0x5a, 0xb1, 0xbc, 0x29, 0x70, 0x3e, 0x66, 0x31,
+    0x10, 0x52, 0x63, 0xd6, 0xab, 0x9a, 0xfc, 0x75, 0xcb, 0xe2, 0x80, 0x01, 0x3d, 0x9d, 0xb9, 0xa6,
+    0xcf, 0x30, 0x9d, 0x48, 0x35, 0x90, 0xe3, 0xba, 0xed, 0x14, 0xb2, 0x72, 0xe5, 0xb1, 0x7a, 0xd2,
+    0x12, 0x2c, 0xf8, 0xa0, 0x4d, 0x8b, 0x00, 0x98, 0x32, 0xda, 0xc3, 0x3f, 0x49, 0x66, 0x65, 0x5f,
+    0xc6, 0x8c, 0x33, 0x31, 0x9c, 0x7a, 0xeb, 0xd6, 0xdf, 0xac, 0xf9, 0x9d, 0x30, 0xcb, 0x02, 0x7d,
+    0xfc, 0x5a, 0x84, 0xf0, 0x42, 0xde, 0x11, 0x4e, 0x28, 0x1f, 0xe5, 0x42, 0x6b, 0x2c, 0x76, 0x88,
+    0x75, 0x7a, 0xc9, 0x70, 0x4a, 0xd6, 0x95, 0x96, 0x4a, 0x17, 0x1d, 0x43, 0x80, 0xcf, 0xdd, 0x0c,
+    0xf0, 0x02, 0xc2, 0xc0, 0xe5, 0x6f, 0xfe, 0x21, 0xae, 0x00, 0x2d, 0xf3, 0xfd, 0x5f, 0x78, 0x89,
+    0x29, 0x10, 0x82, 0xb0, 0x0c, 0xad, 0x50, 0x7a, 0x4e, 0x89, 0xe6, 0x45, 0xb8, 0x2f, 0x01, 0xce,
+    0xe7, 0x66, 0xd5, 0x9b, 0x81, 0x84, 0x36, 0x9e, 0x37, 0x27, 0x93, 0x89, 0x20, 0x0a, 0xc8, 0x7c,
+    0x7b, 0xda, 0x52, 0x77, 0x04, 0x7e, 0x68, 0x77, 0x38, 0x3f, 0xac, 0x33, 0xe1, 0x86, 0x14, 0xc9,
+    0x39, 0x53, 0xc0, 0x6a, 0xba, 0x2b, 0x8e, 0x9b, 0xda, 0x5d, 0x68, 0x48, 0x29, 0xfd, 0x75, 0xea,
+    0x37, 0x7d, 0x6a, 0x2e, 0x32, 0xcb, 0x7a, 0x94, 0x83, 0x76, 0x44, 0xc9, 0x5c, 0x8b, 0x85, 0xcc,
+    0xc4, 0xec, 0xf5, 0x04, 0x05, 0x41, 0x90, 0x42, 0xe4, 0x70, 0xd9, 0x67, 0x66, 0xce, 0x6f, 0xa6,
+    0x8b, 0x9f, 0x1b, 0xf3, 0x2f, 0x15, 0xbe, 0xe7, 0x92, 0xef, 0x51, 0xfc, 0x34, 0x14, 0x4f, 0xa1,
+    0xa6, 0x49, 0x8d, 0x73, 0xaf, 0x0a, 0xfb, 0x60, 0x8c, 0xd6, 0xf0, 0x8f, 0x33, 0xe8, 0x31, 0x00,
+    0xde, 0x80, 0xf1, 0xc7, 0xcc, 0x8b, 0x35, 0x80, 0xd3, 0xa9, 0x2a, 0x21, 0xae, 0x22, 0x7c, 0xd1,
+    0x4c, 0xb0, 0xb1, 0x0e, 0x41, 0x88, 0xa2, 0xa6, 0x92, 0xbf, 0x35, 0x1a, 0xb5, 0x2a, 0x21, 0xc5,
+    0x91, 0x96, 0x0a, 0x35, 0x2d, 0xe1, 0x84, 0xdc, 0x9a, 0xda, 0xae, 0x39, 0xc8, 0x38, 0x73, 0xcd,
+    0x20, 0xea, 0x4d, 0x88, 0xd9, 0x36, 0x83, 0xb0, 0xe2, 0x09, 0xf1, 0x5d, 0x0a, 0x28, 0xc6, 0xce,
+    0x19, 0x16, 0xb1, 0x6b, 0x0b, 0x1b, 0xfb, 0x2d, 0x3c, 0x85, 0x56, 0x91, 0xbb, 0x03, 0xa9, 0xad,
+    0x67, 0x26, 0xe1, 0xf2, 0x52, 0xbd, 0x03, 0x83, 0xca, 0x9d, 0xbc, 0xa0, 0x50, 0x11, 0x73, 0x4d,
+    0x37, 0xfb, 0x1b, 0x2a, 0xce, 0xf6, 0x25, 0xaa, 0xf5, 0x42, 0x48, 0xa3, 0xca, 0xb4, 0x54, 0xe9,
+    0x4e, 0x16, 0xe5, 0xcc, 0xe7, 0x10, 0x28, 0x5a, 0xda, 0xf5, 0xa4, 0x36, 0xb0, 0x90, 0x30, 0xc7,
+    0x75, 0xb0, 0xf5, 0xf6, 0x92, 0x84, 0x68, 0x6c, 0x87, 0x47, 0x73, 0x36, 0x1f, 0x84, 0xb7, 0x31,
+    0x43, 0x10, 0x3f, 0x42, 0x21, 0x62, 0xf5, 0x4e, 0x0c, 0x20, 0xc6, 0x56, 0xe7, 0xdd, 0x3f, 0x77,
+    0x8c, 0x60, 0xe5, 0x34, 0x18, 0x34, 0x47, 0x17, 0xe0, 0xb8, 0x20, 0xb0, 0xc9, 0x34, 0xa0, 0x52,
+    0x22, 0xf7, 0xce, 0x08, 0x4b, 0x1b, 0x93, 0xc8, 0xf9, 0x28, 0x39, 0xc3, 0x28, 0x71, 0x87, 0xbb,
+    0x7c, 0xb5, 0xc1, 0x1e, 0xb5, 0x4d, 0x80, 0xea, 0xea, 0x8f, 0x2b, 0xa5, 0xb4, 0xce, 0xbe, 0xd7,
+    0x30, 0x82, 0x95, 0xd3, 0x57, 0x2e, 0xf1, 0x30, 0x21, 0x8c, 0x03, 0x45, 0x0a, 0x19, 0x04, 0x24,
+    0x4c, 0xe2, 0x12, 0x32, 0xe0, 0xc0, 0x61, 0x81, 0x68, 0x25, 0x6e, 0x5f, 0x26, 0x73, 0x9e, 0x7d,
+    0xc0, 0xff, 0x1a, 0x17, 0x27, 0x52, 0x59, 0x06, 0x44, 0xf8, 0xc8, 0x84, 0x4d, 0xe9, 0x40, 0x51,
+    0x58, 0x06, 0xf4, 0x13, 0x49, 0xcd, 0xb3, 0x64, 0x71, 0x9a, 0x12, 0x1c, 0xe0, 0xee, 0x09, 0x84,
+    0xf0, 0x32, 0x37, 0xa0, 0x83, 0x96, 0x14, 0xf2, 0xd9, 0x15, 0x90, 0x06, 0x6c, 0x23, 0xf6, 0x76,
+    0x79, 0xa0, 0x8d, 0x64, 0x0e, 0x80, 0x64, 0x0b, 0x8a, 0xd4, 0xcd, 0x48, 0xca, 0x1d, 0x68, 0x27,
+    0x5a, 0xe6, 0xea, 0x22, 0xd2, 0x2b, 0x17, 0x61, 0x15, 0x96, 0xb9, 0x90, 0x50, 0x31, 0x5c, 0x42,
+    0xb5, 0xa3, 0x1f, 0x0c, 0x3e, 0x66, 0x1c, 0xb1, 0xf4, 0xfb, 0x6e, 0x29, 0x26, 0x1b, 0x98, 0xcb,
+    0x40, 0x80, 0x0a, 0x93, 0x45, 0x61, 0xce, 0xdc, 0x4e, 0x07, 0x59, 0xb8, 0xe1, 0xeb, 0x1a, 0x0c,
+    0x5b, 0x06, 0x7a, 0xa9, 0xf8, 0xcb, 0x8b, 0x1c, 0xe8, 0x8f, 0x9a, 0x63, 0xcf, 0x71, 0xa7, 0x7d,
+    0x09, 0x6b, 0xc1, 0x1a, 0x40, 0x12, 0x1e, 0xf2, 0xc0, 0x2d, 0xca, 0x4d, 0xc3, 0x46, 0x88, 0xcc,
+    0xa9, 0x4b, 0xb7, 0x7f, 0xb2, 0x16, 0x13, 0x48, 0xdf, 0x10, 0xb8, 0x1d, 0x30, 0x84, 0x98, 0x5f,
+    0x44, 0x4d, 0x41, 0x01, 0xb9, 0x8f, 0x59, 0x54, 0xdc, 0x2d, 0xf0, 0xcc, 0xf5, 0xdc, 0x20, 0x40,
+    0x28, 0xc4, 0x5e, 0xc9, 0x64, 0x73, 0x0d, 0x00, 0xb6, 0x8f, 0x59, 0x1d, 0x93, 0xe1, 0x42, 0x2a,
+    0xe1, 0xcf, 0x11, 0x51, 0xad, 0xc7, 0x24, 0x3e, 0x8e, 0x3a, 0x02, 0x69, 0x65, 0x68, 0xe7, 0x31,
+    0xc4, 0x74, 0x7a, 0xda, 0xc8, 0xe2, 0x02, 0xd1, 0xad, 0x5c, 0x5e, 0x99, 0x54, 0xb6, 0x8c, 0x9c,
+    0x2c, 0xc1, 0x10, 0x71, 0xa4, 0x5c, 0xdf, 0x52, 0xc3, 0x82, 0x5d, 0x5d, 0x2f, 0xc8, 0x98, 0xf6,
+    0xf5, 0x12, 0x7a, 0x46, 0x1e, 0x32, 0xc9, 0x84, 0x71, 0x5a, 0x14, 0x78, 0xdf, 0x92, 0xf0, 0x89,
+    0x84, 0xa3, 0xc9, 0x33, 0x1e, 0x43, 0xec, 0xcf, 0x0f, 0xea, 0x2e, 0x25, 0xdd, 0x6e, 0xd6, 0x94,
+    0x01, 0x5d, 0xa0, 0x4d, 0x42, 0x97, 0x04, 0x48, 0xfa, 0xdb, 0x67, 0x83, 0x43, 0x27, 0x6a, 0x5a,
+    0xc0, 0xd8, 0x4e, 0x27, 0x59, 0xa8, 0xe2, 0x4d, 0x0d, 0xcc, 0x53, 0xef, 0x0b, 0x00, 0xeb, 0x07,
+    0x04, 0xca, 0x53, 0xa0, 0x5b, 0xc0, 0x92, 0x7b, 0xcb, 0xc6, 0xce, 0x2f, 0x11, 0x68, 0x7b, 0x79,
+    0x3a, 0x80, 0xb4, 0xbf, 0x9f, 0xf2, 0x12, 0x76, 0xf1, 0x6c, 0x8d, 0x19, 0x8a, 0x1e, 0xd0, 0x65,
+    0x3e, 0x56, 0x50, 0x08, 0x7a, 0x28, 0x48, 0xc1, 0x36, 0x5b, 0x53, 0xc2, 0x34, 0xf9, 0x26, 0x9b,
+    0x2c, 0x58, 0xa0, 0x74, 0x80, 0xb0, 0x97, 0x5b, 0x92, 0x40, 0x9f, 0xf2, 0x29, 0x62, 0x67, 0x34,
+    0x95, 0x8c, 0x35, 0x30, 0xb0, 0x9b, 0xd0, 0x72, 0x9e, 0x98, 0xb7, 0x95, 0xf5, 0xf1, 0x17, 0xf8,
+    0x56, 0x45, 0x59, 0xe9, 0xb2, 0x22, 0xc1, 0x09, 0x65, 0x4e, 0x46, 0x3b, 0xfd, 0x2a, 0xe3, 0x6b,
+    0xe7, 0x8a, 0x17, 0x79, 0x03, 0x66, 0xf0, 0xb3, 0x36, 0xf1, 0x72, 0xe7, 0xb5, 0x84, 0x3d, 0xa0,
+    0xc4, 0xf8, 0x9e, 0xd8, 0xc8, 0xa6, 0xa9, 0x01, 0xbd, 0x39, 0xbc, 0xd0, 0xf3, 0xd7, 0xd1, 0x99,
+    0x19, 0xc0, 0x84, 0xe3, 0x19, 0xab, 0xc8, 0x08, 0x1e, 0x67, 0xea, 0x47, 0x55, 0x8c, 0x51, 0x85,
+    0xbb, 0x66, 0xa1, 0x1f, 0xa6, 0x5e, 0xb4, 0x08, 0x0b, 0x91, 0x82, 0xc8, 0xc3, 0x9f, 0x58, 0x4e,
+    0x94, 0x99, 0x69, 0xb9, 0x60, 0x29, 0x17, 0x28, 0x50, 0x89, 0x0d, 0x03, 0x86, 0x9a, 0xf6, 0xd5,
+    0x80, 0x4c, 0xfe, 0xc5, 0x4c, 0x1e, 0x18, 0x40, 0x9a, 0x4a, 0x66, 0xc2, 0x76, 0xb0, 0x17, 0x8f,
+    0xb1, 0x15, 0x1d, 0x52, 0x44, 0xab, 0x78, 0x53, 0x98, 0x99, 0x62, 0x39, 0x62, 0x2f, 0x29, 0xce,
+    0x2f, 0x15, 0xb0, 0xbd, 0x3f, 0x83, 0xb8, 0x88, 0xb1, 0xa0, 0x83, 0xb6, 0x73, 0x6f, 0xb0, 0x4a,
+    0xa2, 0x0b, 0xe5, 0x96, 0x93, 0x1e, 0x47, 0x0e, 0xfb, 0xe5, 0x91, 0x8e, 0x03, 0x02, 0x16, 0xa3,
+    0xe2, 0x2f, 0x12, 0x55, 0xe1, 0xdd, 0xdf, 0x3b, 0xfe, 0xd7, 0x3a, 0xd8, 0xde, 0xad, 0x0c, 0xcc,
+    0x65, 0xe7, 0x42, 0x16, 0x16, 0xf1, 0x62, 0x8f, 0xc4, 0x0f, 0x16, 0x1e, 0x88, 0x22, 0x37, 0xcb,
+    0xca, 0xed, 0x23, 0xc7, 0x0f, 0x65, 0x91, 0xf5, 0xca, 0x48, 0xf1, 0xe3, 0xe1, 0xcc, 0x52, 0x1a,
+    0x53, 0x87, 0xe8, 0xc9, 0xc9, 0xae, 0x2c, 0xb5, 0x61, 0x93, 0x7e, 0x09, 0x4c, 0x19, 0x2d, 0x1f,
+    0xe5, 0xd9, 0x75, 0x91, 0xcb, 0x7e, 0x4a, 0x00, 0x75, 0x75, 0xb1, 0x5a, 0xb8, 0xa6, 0x60, 0x20,
+    0xaf, 0x5e, 0x09, 0x76, 0x00, 0xb0, 0xfa, 0x14, 0x0c, 0xd0, 0x9b, 0x45, 0xf2, 0x93, 0x19, 0x2c,
+    0xbb, 0x85, 0x0b, 0x82, 0x9c, 0xdb, 0x73, 0x2b, 0x28, 0x4e, 0x69, 0x4d, 0x56, 0xf8, 0x2f, 0x02,
+    0xdf, 0x7b, 0xdf, 0x76, 0xba, 0x02, 0x87, 0xa8, 0x25, 0x1c, 0xb7, 0x84, 0x88, 0x34, 0x0e, 0xc3,
+    0x50, 0x84, 0x84, 0x70, 0xed, 0x66, 0xbc, 0x36, 0xf1, 0x31, 0x5a, 0x54, 0x4e, 0x71, 0xd3, 0xb9,
+    0x9a, 0xb6, 0xcb, 0x2e, 0x87, 0x3e, 0xe6, 0xc8, 0x26, 0x84, 0x90, 0xe4, 0xd4, 0x11, 0xdd, 0x27,
+    0x95, 0xfd, 0x4b, 0x62, 0x93, 0x84, 0xbe, 0xa7, 0xc6, 0xd0, 0x14, 0x83, 0x89, 0x28, 0xad, 0xf8,
+    0xeb, 0x4b, 0x65, 0x96, 0x46, 0x1d, 0x71, 0xea, 0x46, 0xc7, 0xb8, 0x4e, 0x42, 0x6a, 0x2d, 0x09,
+    0x82, 0x5a, 0xea, 0x8a, 0xb5, 0x94, 0xc4, 0xe4, 0x32, 0x5a, 0x78, 0x85, 0x97, 0x84, 0x47, 0x84,
+    0xdb, 0xe9, 0x64, 0xf1, 0x39, 0xc6, 0xf6, 0x69, 0x25, 0x8f, 0x5a, 0xe6, 0xde, 0x2b, 0x82, 0x70,
+    0xa1, 0x1f, 0x4f, 0x3c, 0x01, 0xd9, 0xa5, 0x99, 0x4b, 0x36, 0x1a, 0x7a, 0x35, 0x90, 0x0d, 0xdd,
+    0x13, 0x69, 0xaf, 0xcd, 0xb8, 0xbe, 0xdc, 0x00, 0xb8, 0x04, 0xf4, 0x5d, 0x1a, 0xaa, 0x5e, 0x36,
+    0x33, 0x47, 0xcc, 0x0a, 0xd7, 0x60, 0xd9, 0x20, 0x8b, 0x04, 0x96, 0xa2, 0x2a, 0x47, 0xc2, 0xa9,
+    0x24, 0xd0, 0xe3, 0x2e, 0xa2, 0x80, 0x3b, 0xb9, 0x13, 0xeb, 0x8a, 0x2a, 0xfe, 0x00, 0x8e, 0x07,
+    0x2a, 0x99, 0xf0, 0xde, 0xef, 0x06, 0x6a, 0x1a, 0xf5, 0xa4, 0x2b, 0x3e, 0xb8, 0x4d, 0xe9, 0x0b,
+    0x6e, 0x91, 0xf7, 0x35, 0xf7, 0x5b, 0x37, 0x7a, 0x78, 0x96, 0xee, 0xef, 0xf1, 0x3a, 0xb8, 0x93,
+    0x09, 0x44, 0x88, 0xc4, 0x65, 0x1f, 0x40, 0xba, 0x91, 0xe0, 0xb4, 0x82, 0x6f, 0x23, 0x8a, 0x2c,
+    0x92, 0xf4, 0x7b, 0x44, 0xc6, 0x22, 0xf0, 0x74, 0x9d, 0x20, 0x9c, 0x89, 0x9b, 0x5b, 0x18, 0x9b,
+    0x05, 0x41, 0x59, 0x28, 0xf7, 0x4a, 0x99, 0x82, 0x4d, 0xbc, 0xd8, 0xd0, 0xce, 0x23, 0xa2, 0xb1,
+    0x84, 0x94, 0xb2, 0x06, 0xa4, 0x2e, 0xf9, 0x5a, 0xe8, 0xe5, 0x55, 0x9d, 0x30, 0x15, 0x68, 0x08,
+    0x59, 0x6b, 0xc8, 0xd6, 0xe1, 0x8a, 0xdf, 0x9f, 0x1b, 0x8f, 0xd3, 0x15, 0xd5, 0x1f, 0xd9, 0x1d,
+    0x8c, 0x38, 0xb9, 0x92, 0x75, 0x6b, 0x37, 0x19, 0x16, 0x0a, 0x4e, 0xce, 0x0b, 0x73, 0x9f, 0x0f,
+    0x74, 0xed, 0x5d, 0x12, 0x0c, 0xb5, 0x85, 0x38, 0xe3, 0x35, 0x23, 0xf4, 0x31, 0x1a, 0x56, 0xa9,
+    0x0b, 0x92, 0x6a, 0x6e, 0x62, 0x50, 0x21, 0xa2, 0x11, 0x99, 0x13, 0xc5, 0xd6, 0x41, 0xf3, 0x59,
+    0xbf, 0xa2, 0x0b, 0x7f, 0xb9, 0x89, 0x48, 0x76, 0x29, 0x6c, 0x4c, 0xb6, 0xda, 0xe4, 0xe9, 0x73,
+    0x5b, 0x59, 0x3c, 0x20, 0x59, 0x6d, 0x85, 0x75, 0x10, 0x31, 0x44, 0x04, 0xbc, 0x2e, 0x9c, 0x90,
+    0xac, 0x8d, 0x01, 0x3a, 0x03, 0x12, 0x9e, 0xe1, 0xf6, 0x4e, 0x44, 0xe5, 0x32, 0x60, 0xda, 0xa2,
+    0x8d, 0x9c, 0x34, 0xa4, 0xc5, 0x6c, 0xce, 0x5e, 0x1a, 0x9c, 0x7e, 0x44, 0x44, 0x18, 0x90, 0x99,
+    0xeb, 0x5f, 0xa1, 0xdc, 0x44, 0x99, 0x65, 0x46, 0x85, 0x6f, 0xf1, 0x3c, 0xf8, 0xdf, 0x2e, 0x1c,
+    0xa7, 0x0e, 0xba, 0x83, 0x77, 0xf5, 0x35, 0xdb, 0xc2, 0x46, 0x8f, 0x90, 0x2a, 0x41, 0xc0, 0xfb,
+    0xe7, 0x87, 0xba, 0x9c, 0xa7, 0xa2, 0xdf, 0x0b, 0x6a, 0x65, 0x01, 0x0a, 0xb2, 0xb6, 0x5f, 0x1c,
+    0xfa, 0x35, 0x21, 0xb9, 0x89, 0x71, 0xbb, 0x0c, 0xc0, 0xd6, 0x12, 0xf7, 0x3b, 0x0d, 0x5c, 0xc0,
+    0x56, 0xb4, 0x2d, 0xed, 0xe5, 0x55, 0xf0, 0x21, 0xac, 0xc1, 0xf8, 0x40, 0xd0, 0x3d, 0x0b, 0xa5,
+    0xba, 0x6a, 0xe0, 0x9a, 0x98, 0x36, 0x2b, 0x9d, 0x98, 0x60, 0x33, 0x74, 0x42, 0x14, 0x84, 0x29,
+    0x85, 0x7c, 0xa8, 0x23, 0x85, 0xa8, 0x1b, 0xdf, 0xec, 0x5b, 0x0a, 0x4b, 0x8f, 0x01, 0x92, 0xa5,
+    0x56, 0x01, 0x86, 0x8a, 0x48, 0xb8, 0xb5, 0x0c, 0x71, 0x30, 0x37, 0xa2, 0x34, 0xd8, 0x4e, 0xf2,
+    0x17, 0x8b, 0x54, 0x79, 0x83, 0x09, 0xb6, 0x92, 0x36, 0x93, 0x42, 0x46, 0x36, 0xaf, 0x48, 0xeb,
+    0xdd, 0xa6, 0x51, 0x02, 0xcf, 0x8a, 0x22, 0xe7, 0x41, 0x27, 0x00, 0x3a, 0x99, 0x75, 0xfd, 0x73,
+    0x18, 0x64, 0x35, 0x39, 0xd3, 0x0b, 0xf4, 0xb0, 0x4a, 0x1c, 0x5b, 0x8b, 0x89, 0x2b, 0xcc, 0x0b,
+    0xe9, 0xb4, 0x6f, 0xae, 0x97, 0xee, 0xd1, 0x46, 0x4a, 0x12, 0xb3, 0x45, 0x25, 0xc0, 0x1c, 0xeb,
+    0xc9, 0x91, 0x47, 0x30, 0xd4, 0x18, 0xa9, 0x41, 0xad, 0xd0, 0x07, 0xfa, 0xdf, 0x59, 0xe3, 0xca,
+    0x81, 0x8b, 0x0d, 0xf5, 0xf1, 0xa9, 0x9b, 0xcf, 0x36, 0x79, 0x13, 0x99, 0x49, 0x84, 0xd5, 0x30,
+    0x70, 0xdd, 0xaa, 0x2f, 0x85, 0x69, 0x0a, 0x5e, 0x9a, 0x29, 0xc6, 0x1c, 0x39, 0x13, 0xc2, 0x66,
+    0x6a, 0x85, 0xd9, 0x07, 0x8d, 0xd8, 0xfb, 0xaf, 0x0d, 0xc5, 0x50, 0x42, 0x60, 0x4c, 0x03, 0xf9,
+    0x31, 0xa2, 0x95, 0x5b, 0x1a, 0x29, 0x24, 0x74, 0xaf, 0x4a, 0xee, 0x91, 0x3e, 0x1a, 0xc5, 0x7d,
+    0xd2, 0x5d, 0x70, 0xdd, 0xd5, 0xbc, 0x13, 0xa2, 0x63, 0xbe, 0x09, 0x91, 0xa2, 0xa1, 0x25, 0xf7,
+    0xc9, 0xaa, 0x63, 0xa5, 0x16, 0xa2, 0xe0, 0xd2, 0xe9, 0x24, 0x58, 0x61, 0x62, 0x0c, 0xe9, 0xdd,
+    0x9d, 0x64, 0x7b, 0x08, 0x01, 0x4a, 0x8b, 0x73, 0x83, 0x8a, 0xb6, 0x89, 0xb7, 0x08, 0xe2, 0xa8,
+    0x5e, 0x38, 0xe3, 0xb7, 0x63, 0x1b, 0x16, 0x0d, 0xcf, 0x36, 0xa3, 0x4d, 0x9e, 0x1c, 0x81, 0x97,
+    0x74, 0xb9, 0xdd, 0xc0, 0x76, 0xcb, 0xa0, 0x59, 0x0e, 0x08, 0xb5, 0x52, 0x77, 0x90, 0x34, 0x70,
+    0xe9, 0x4e, 0x2c, 0x76, 0x45, 0x9a, 0xea, 0x57, 0x55, 0x71, 0xc1, 0x18, 0x77, 0xae, 0xe6, 0x35,
+    0x41, 0x32, 0x09, 0xfe, 0x06, 0xd4, 0x9c, 0x22, 0xb3, 0x57, 0x2d, 0x0d, 0xca, 0xca, 0x07, 0x9a,
+    0x9d, 0x25, 0xd0, 0xa5, 0xf2, 0x07, 0x24, 0xb0, 0x6b, 0x75, 0xc2, 0x3a, 0xf1, 0x40, 0x87, 0xdb,
+    0xb9, 0x5e, 0xd1, 0x5e, 0xf2, 0xe2, 0x4b, 0x78, 0x11, 0xc0, 0x61, 0x40, 0x28, 0xb5, 0x8c, 0x72,
+    0xf2, 0x77, 0x87, 0x93, 0xac, 0x04, 0xd7, 0x1e, 0xbb, 0xb2, 0x85, 0x35, 0xf2, 0xe2, 0xdf, 0x8a,
+    0x0a, 0x00, 0x77, 0x17, 0x63, 0x3f, 0x2f, 0xa2, 0x01, 0x0a, 0x21, 0x0d, 0x71, 0xda, 0x36, 0x0e,
+    0xbb, 0x21, 0x87, 0xb5, 0x48, 0x30, 0xac, 0xb5, 0xd1, 0xe8, 0x73, 0x05, 0xc2, 0xc1, 0x08, 0xc6,
+    0x78, 0xe0, 0x81, 0x65, 0xeb, 0x91, 0x1a, 0x07, 0x97, 0x4c, 0x02, 0x0c, 0x28, 0x79, 0x46, 0xb6,
+    0xe4, 0x8c, 0xb0, 0x02, 0x2b, 0x9b, 0x81, 0xa3, 0x10, 0x23, 0x04, 0x61, 0x06, 0xb8, 0x7f, 0x40,
+    0xe7, 0x19, 0xdf, 0x05, 0x38, 0x89, 0x26, 0x94, 0x3c, 0xdb, 0x29, 0x4e, 0xe0, 0xf2, 0x25, 0xae,
+    0x63, 0xca, 0x58, 0x4f, 0x11, 0x50, 0x14, 0xb0, 0x06, 0x6b, 0xd3, 0xba, 0xed, 0xb5, 0x49, 0xc6,
+    0xa7, 0x56, 0xa6, 0x07, 0x55, 0x0c, 0x19, 0x0d, 0xcb, 0xf1, 0x35, 0x67, 0x0e, 0x2f, 0x4b, 0xa2,
+    0x7e, 0x8a, 0x28, 0x6e, 0x25, 0xa8, 0x18, 0x6c, 0xcd, 0xfb, 0x6e, 0x9b, 0x43, 0xb8, 0x1f, 0xa7,
+    0xad, 0xa2, 0xca, 0x62, 0xba, 0x43, 0x74, 0xf3, 0x5a, 0xf1, 0x39, 0x8f, 0x81, 0x13, 0x30, 0xae,
+    0xa4, 0x7d, 0x42, 0x00, 0x6e, 0x02, 0x08, 0xf2, 0x03, 0x62, 0x05, 0xdd, 0x3a, 0x03, 0xae, 0xd0,
+    0x41, 0x54, 0x7f, 0x4d, 0x61, 0x5a, 0x5d, 0x29, 0x44, 0x50, 0x8b, 0x03, 0xd0, 0x64, 0x27, 0x6a,
+    0x45, 0x23, 0x3e, 0x08, 0x45, 0x1a, 0x89, 0x04, 0xe1, 0x4d, 0x85, 0x9e, 0xd2, 0x8c, 0x19, 0x6b,
+    0xcd, 0x11, 0x6e, 0x5a, 0x1d, 0x78, 0xf1, 0x3e, 0xed, 0xca, 0x21, 0x96, 0xe3, 0x47, 0x1e, 0x79,
+    0x24, 0xa8, 0x6a, 0x9f, 0x85, 0x98, 0xbe, 0x0f, 0x2f, 0xdd, 0xf8, 0x27, 0x2c, 0x53, 0xbc, 0xdb,
+    0xbe, 0x64, 0xce, 0xc4, 0x4d, 0x9c, 0xa9, 0xab, 0x9c, 0xdc, 0x6f, 0x2b, 0x2c, 0xf3, 0xa4, 0x49,
+    0xc6, 0x53, 0x69, 0xfc, 0xf8, 0x80, 0x93, 0x10, 0x63, 0x0a, 0xa0, 0x6f, 0x38, 0x8c, 0x08, 0x3e,
+    0x31, 0x59, 0x13, 0x71, 0x59, 0xb4, 0x4c, 0x09, 0x5c, 0xa9, 0x89, 0x93, 0x7b, 0x40, 0x6f, 0x86,
+    0x3e, 0xa7, 0x28, 0x53, 0x0e, 0xf1, 0xbe, 0x44, 0x91, 0x63, 0x53, 0x96, 0x10, 0xbe, 0x58, 0x83,
+    0xf1, 0x2f, 0x00, 0x75, 0xfc, 0x96, 0xb3, 0xc2, 0xf1, 0x63, 0x09, 0x63, 0xca, 0x0c, 0x37, 0x65,
+    0x49, 0x0c, 0x4d, 0x59, 0xe9, 0x5e, 0x4a, 0x30, 0x36, 0x31, 0xd5, 0x8d, 0x35, 0x16, 0x4f, 0x2a,
+    0xf8, 0xc6, 0xa5, 0x0a, 0x6f, 0xc8, 0xfc, 0xad, 0x63, 0xc2, 0x8d, 0xea, 0xac, 0x1e, 0x24, 0xd7,
+    0x1e, 0x20, 0xd8, 0xd0, 0x67, 0x3f, 0x31, 0x15, 0x10, 0x42, 0xca, 0x5e, 0x72, 0x32, 0xb4, 0xb2,
+    0xf0, 0x20, 0xa4, 0xbd, 0xad, 0x82, 0x27, 0xc1, 0x7b, 0x52, 0xe4, 0xaa, 0xde, 0xc9, 0x09, 0x17,
+    0x10, 0x68, 0xaa, 0x20, 0xfe, 0x10, 0xdf, 0x54, 0x46, 0x22, 0xf1, 0x7a, 0x3b, 0x1d, 0x3c, 0xdf,
+    0xc9, 0x88, 0x4b, 0x3e, 0x8a, 0x64, 0xa6, 0x51, 0xf0, 0xbd, 0x90, 0x71, 0x82, 0x5e, 0x82, 0x71,
+    0x28, 0x13, 0x71, 0x21, 0x04, 0xbd, 0xb6, 0xe8, 0x0e, 0x6f, 0x76, 0x09, 0xeb, 0xa9, 0x34, 0x0b,
+    0xb4, 0x7f, 0x00, 0x79, 0x35, 0xf6, 0x31, 0xcc, 0xf7, 0x46, 0xe2, 0xfe, 0xe1, 0x7b, 0x95, 0xc4,
+    0x9f, 0xcd, 0x1c, 0x81, 0xea, 0x34, 0x16, 0xdb, 0x1e, 0x13, 0xed, 0xba, 0x5d, 0xa9, 0x16, 0x98,
+    0x2f, 0xd1, 0x91, 0x83, 0x3e, 0x99, 0x47, 0x91, 0xf9, 0x9f, 0xfc, 0xea, 0xf2, 0x71, 0xd8, 0x9f,
+    0x20, 0xef, 0x3a, 0x89, 0xfe, 0xe5, 0x88, 0x30, 0x31, 0x76, 0x1a, 0xfa, 0xd3, 0x63, 0xe6, 0xf1,
+    0x22, 0xe3, 0xcd, 0x4c, 0x04, 0x64, 0xef, 0x28, 0x2f, 0x1a, 0x79, 0xde, 0x6a, 0x77, 0xb1, 0x3f,
+    0xc4, 0x7c, 0x18, 0x0c, 0x20, 0x2e, 0x56, 0x49, 0x2b, 0x55, 0xc1, 0x43, 0x46, 0xc0, 0xf6, 0x3f,
+    0xc8, 0xdc, 0x7a, 0xea, 0x14, 0x17, 0xe4, 0xce, 0xb1, 0xc7, 0xae, 0x15, 0x59, 0x62, 0xbb, 0x82,
+    0xfa, 0xfe, 0x86, 0xc5, 0x34, 0xd2, 0x63, 0x15, 0x47, 0x82, 0x56, 0xa8, 0x68, 0x05, 0x84, 0x5e,
+    0x39, 0x93, 0xf0, 0x7d, 0x52, 0xe9, 0xc5, 0x36, 0x42, 0x24, 0x1f, 0x93, 0xf9, 0x17, 0xee, 0xe7,
+    0xe1, 0xc1, 0x75, 0x4e, 0x47, 0x38, 0x07, 0x44, 0xcc, 0xe7, 0x1a, 0x95, 0xd3, 0xd7, 0x01, 0xd4,
+    0x08, 0x8b, 0xb3, 0x67, 0x03, 0xa4, 0x77, 0x75, 0x78, 0x57, 0x99, 0x5e, 0x82, 0x58, 0xed, 0xb5,
+    0x6d, 0x74, 0x90, 0xef, 0x00, 0xb8, 0xe1, 0x5a, 0x01, 0xf2, 0x0e, 0x39, 0xe3, 0xbb, 0x2d, 0x71,
+    0x3b, 0x83, 0xd8, 0xdc, 0x50, 0xec, 0xf2, 0x81, 0xc1, 0xfa, 0xc5, 0xe1, 0x47, 0x89, 0xbc, 0x2f,
+    0xe4, 0x84, 0x46, 0xc8, 0x5f, 0x3d, 0x68, 0x7f, 0x63, 0x0d, 0x4e, 0x86, 0xde, 0x90, 0x39, 0x16,
+    0x1a, 0x69, 0xd6, 0xfc, 0x59, 0xbf, 0x8a, 0x79, 0x8a, 0xed, 0x71, 0x73, 0xc1, 0x25, 0xda, 0x39,
+    0xe6, 0x34, 0x3a, 0xf8, 0x17, 0x90, 0x7e, 0x17, 0x66, 0x15, 0x93, 0xd4, 0x15, 0x1e, 0x4a, 0x06,
+    0x22, 0x2e, 0xa2, 0x72, 0xe2, 0x9a, 0x73, 0xa7, 0xe5, 0x0d, 0xe8, 0xf5, 0x13, 0x3d, 0x7e, 0x74,
+    0x82, 0xff, 0x1d, 0xbb, 0x6c, 0xcd, 0xd9, 0x72, 0xee, 0x2b, 0xdb, 0x93, 0x6a, 0x65, 0x25, 0x4e,
+    0x31, 0x9f, 0x79, 0x5f, 0x6f, 0x44, 0x27, 0xb7, 0x6d, 0x65, 0x4f, 0x22, 0xa1, 0x75, 0x69, 0x89,
+    0xb4, 0xc7, 0x19, 0xe4, 0x77, 0x87, 0xcc, 0x96, 0x4d, 0xcb, 0xf0, 0xc1, 0x90, 0x09, 0xda, 0x13,
+    0xc6, 0x43, 0xdb, 0xf0, 0x5b, 0x15, 0x21, 0x80, 0xf2, 0x69, 0x0c, 0x64, 0x4b, 0x20, 0x1c, 0xaa,
+    0x27, 0x38, 0xb6, 0xd7, 0x23, 0x34, 0xfe, 0x74, 0x61, 0x40, 0xa6, 0xd0, 0x0e, 0x3e, 0x7c, 0xe3,
+    0xfd, 0x6a, 0x90, 0x1d, 0x14, 0xae, 0xdf, 0x9f, 0x7f, 0x02, 0x62, 0xe4, 0x36, 0x42, 0x14, 0x42,
+    0x86, 0x33, 0x83, 0xbb, 0x2d, 0xb7, 0x43, 0x65, 0x5b, 0x01, 0x34, 0xb2, 0xdd, 0x4c, 0x60, 0x7a,
+    0xc0, 0xaf, 0xb1, 0x2d, 0x48, 0xe1, 0xb5, 0xd7, 0xe4, 0x3e, 0x0f, 0x68, 0x12, 0x58, 0x6c, 0x0c,
+    0xf4, 0x26, 0xe4, 0xc7, 0x4c, 0x74, 0xc7, 0x5e, 0x0c, 0xb8, 0xd7, 0x7a, 0x23, 0xee, 0xc9, 0xf7,
+    0x2c, 0x27, 0x54, 0x32, 0x81, 0xb6, 0xcd, 0xe3, 0x3d, 0xb7, 0xb2, 0xec, 0x6d, 0x6f, 0x49, 0xee,
+    0x07, 0xb4, 0x91, 0x29, 0xdf, 0x24, 0xe0, 0x1b, 0x26, 0xd1, 0xd4, 0x39, 0x52, 0x9e, 0xcf, 0x84,
+    0x1b, 0xbe, 0xb5, 0x1f, 0x9d, 0x93, 0x3a, 0x29, 0xb4, 0x19, 0x98, 0xe3, 0x6b, 0x4f, 0x72, 0xc5,
+    0xde, 0x0b, 0x73, 0x43, 0x23, 0x27, 0x9e, 0x16, 0xdf, 0x82, 0xa3, 0x84, 0xb0, 0xa4, 0x84, 0x8e,
+    0x00, 0x4e, 0x8d, 0xd9, 0x4c, 0xe2, 0xab, 0x21, 0x81, 0xb9, 0x05, 0x95, 0x0f, 0x79, 0x4c, 0xcf,
+    0xa6, 0xd3, 0x84, 0x2f, 0xc8, 0x2f, 0x3b, 0x7b, 0x83, 0x98, 0xdf, 0x2c, 0xb6, 0x3b, 0x24, 0xc4,
+    0x1d, 0x12, 0xc2, 0xff, 0x0c, 0x49, 0x7d, 0x88, 0x81, 0x5a, 0xfb, 0x48, 0xf0, 0x22, 0xeb, 0x21,
+    0x77, 0xac, 0x63, 0xa9, 0xca, 0xe2, 0xdb, 0x89, 0xb6, 0x0c, 0x10, 0x55, 0x6a, 0x7d, 0x11, 0x48,
+    0xba, 0xbd, 0xae, 0x09, 0x70, 0x53, 0x56, 0xd6, 0xbd, 0x0a, 0x87, 0x18, 0x8e, 0x58, 0xe4, 0xa6,
+    0x7b, 0x42, 0xce, 0xa9, 0xfb, 0x4b, 0x85, 0x5e, 0xe8, 0x39, 0x3d, 0xdd, 0x40, 0xe0, 0xc3, 0x1b,
+    0x02, 0xcf, 0x69, 0x58, 0x52, 0xcf, 0x39, 0xcd, 0x4f, 0x33, 0xc5, 0xe9, 0xb4, 0x94, 0x6d, 0x08,
+    0xf9, 0x79, 0x2f, 0x7f, 0x63, 0xe5, 0x5f, 0xc3, 0x2f, 0x9d, 0xd9, 0xf3, 0xed, 0xfe, 0xa0, 0x66,
+    0x65, 0xb3, 0xc2, 0x39, 0x8f, 0x0a, 0x0a, 0x1c, 0xdf, 0xc5, 0x6e, 0x94, 0x30, 0xb9, 0x16, 0x77,
+    0xb7, 0x16, 0xe3, 0x12, 0x21, 0xbf, 0x06, 0x45, 0x18, 0x0d, 0x5f, 0x72, 0x9f, 0x65, 0x3d, 0xbe,
+    0x2f, 0xe2, 0xae, 0x0e, 0x09, 0x98, 0x4e, 0x0c, 0xb1, 0x54, 0x86, 0x32, 0xe2, 0xe3, 0x55, 0xed,
+    0xaf, 0x44, 0xfb, 0x79, 0xd2, 0x60, 0xe9, 0x84, 0x98, 0xbb, 0x2a, 0xad, 0xab, 0x7b, 0x7f, 0xd7,
+    0x35, 0x03, 0xab, 0x16, 0x5b, 0x51, 0xa7, 0x37, 0x0e, 0xe8, 0x1e, 0xd6, 0x72, 0xfa, 0x8c, 0x41,
+    0x3c, 0x2b, 0x56, 0xc9, 0xa4, 0xe1, 0xee, 0x3d, 0xe3, 0x7a, 0x71, 0x37, 0x1f, 0xe5, 0xd7, 0x9b,
+    0xb7, 0x86, 0x50, 0x61, 0x26, 0x23, 0x54, 0x5f, 0x95, 0x69, 0x4f, 0xc5, 0xef, 0x80, 0x4c, 0xb7,
+    0x0f, 0xf3, 0xc6, 0x03, 0xa9, 0xa8, 0xf0, 0x68, 0x9c, 0xb0, 0x32, 0x8c, 0xa8, 0xd0, 0x8d, 0x00,
+    0x3b, 0xfb, 0xf3, 0x2b, 0xf8, 0x15, 0x7e, 0x83, 0x3c, 0x63, 0xe1, 0xab, 0x11, 0xc8, 0x4a, 0xf0,
+    0x1c, 0x5e, 0x99, 0xbb, 0x91, 0xd3, 0xeb, 0x0e, 0x67, 0x78, 0x84, 0x3a, 0xb2, 0x9b, 0xf1, 0x4c,
+    0xbc, 0x41, 0xf8, 0xcb, 0x5a, 0x3d, 0xdc, 0xc6, 0x89, 0xcc, 0x56, 0xf5, 0xc7, 0x6b, 0xc4, 0xbc,
+    0x54, 0xad, 0x58, 0xda, 0x94, 0xee, 0x62, 0x2f, 0x94, 0x6a, 0xf4, 0x5a, 0x78, 0xe8, 0x39, 0x11,
+    0x1d, 0xa4, 0xb5, 0x8e, 0x75, 0x8f, 0x78, 0xd7, 0xa7, 0xfb, 0xbe, 0x09, 0xe3, 0x21, 0x4d, 0x93,
+    0xad, 0xde, 0x3b, 0x22, 0x06, 0xad, 0xb8, 0xc7, 0x5f, 0x21, 0x61, 0x05, 0x80, 0x9c, 0x0c, 0x17,
+    0x04, 0xc0, 0x4e, 0xc0, 0x41, 0x24, 0xcd, 0x68, 0xa0, 0x12, 0x5f, 0x14, 0x52, 0xe5, 0xfc, 0xf5,
+    0xc5, 0x65, 0x37, 0x19, 0xee, 0x87, 0x9e, 0xc6, 0x8f, 0xc5, 0x5c, 0x6b, 0x16, 0x9f, 0x6c, 0xec,
+    0x51, 0x22, 0x5d, 0xb1, 0x05, 0xb5, 0x71, 0x18, 0x90, 0x5b, 0x64, 0xd2, 0xd5, 0x16, 0x07, 0x09,
+    0x64, 0x0d, 0x96, 0xcc, 0x01, 0xe9, 0x1a, 0x78, 0xa2, 0xdc, 0xb1, 0x61, 0x2c, 0x62, 0x3b, 0x29,
+    0x54, 0xc8, 0xae, 0xc3, 0xd6, 0xa1, 0x32, 0x45, 0x00, 0x7d, 0x45, 0x2b, 0x04, 0xdc, 0xed, 0xf0,
+    0xe3, 0x4c, 0xbc, 0x05, 0x95, 0x28, 0x90, 0xb2, 0xb4, 0xe8, 0x3c, 0x02, 0xf7, 0xf3, 0x2c, 0x34,
+    0x0f, 0xdf, 0x16, 0x9f, 0xc7, 0x2c, 0xe0, 0x3e, 0xe2, 0xac, 0x1f, 0x19, 0xde, 0x9f, 0x17, 0x7b,
+    0x97, 0x83, 0x5c, 0xba, 0x33, 0xd1, 0x6c, 0x4c, 0x8e, 0xc3, 0xd6, 0x3c, 0xe9, 0x7b, 0x8e, 0x7d,
+    0xc0, 0xe8, 0x0c, 0xb4, 0xc9, 0xed, 0x94, 0x22, 0xb1, 0xa7, 0x49, 0xc8, 0x2e, 0x62, 0x6c, 0x82,
+    0x27, 0xeb, 0xff, 0x2f, 0xf8, 0x61, 0xab, 0x0c, 0x7c, 0xf2, 0xd6, 0x0a, 0xa1, 0x02, 0x33, 0x37,
+    0x7d, 0xe9, 0xc5, 0xbe, 0x3b, 0xa2, 0x46, 0x10, 0xed, 0x4d, 0x68, 0xca, 0xe0, 0x42, 0x38, 0x92,
+    0xe5, 0x06, 0x8d, 0xe1, 0xfc, 0x56, 0x8a, 0x94, 0x82, 0x44, 0x4d, 0x5c, 0x05, 0x4a, 0x6f, 0xa6,
+    0xe4, 0x23, 0xfb, 0xef, 0x3b, 0x5c, 0x28, 0x8c, 0x11, 0x98, 0x8b, 0xee, 0x99, 0xc6, 0xee, 0x79,
+    0x03, 0x39, 0x3b, 0x9a, 0x22, 0xb7, 0x6d, 0xb9, 0x14, 0x04, 0xeb, 0xfe, 0xc0, 0xaf, 0x24, 0xa8,
+    0xfa, 0x1d, 0x04, 0x02, 0xdd, 0x13, 0x25, 0xf5, 0x98, 0x0c, 0xdc, 0xb4, 0xbb, 0xb4, 0x52, 0x73,
+    0xc2, 0x7f, 0x70, 0x42, 0x8e, 0xd2, 0x7a, 0x25, 0x95, 0x55, 0x27, 0x49, 0xf0, 0x94, 0xbe, 0xf4,
+    0x40, 0x8e, 0xf8, 0x4a, 0x10, 0x65, 0x73, 0x1b, 0x24, 0x31, 0xe9, 0x31, 0xbb, 0xf9, 0x26, 0x6c,
+    0xc3, 0xa6, 0x6c, 0xc9, 0x63, 0x2c, 0xfc, 0xd3, 0xc9, 0x0e, 0x29, 0x56, 0x0c, 0x15, 0xeb, 0x9b,
+    0x5d, 0xeb, 0x26, 0xe9, 0x40, 0x58, 0x67, 0x53, 0x91, 0x6c, 0xd9, 0xc5, 0x9a, 0x79, 0xcd, 0x45,
+    0x57, 0x3a, 0x48, 0x08, 0xa8, 0x1e, 0xf0, 0xcf, 0x2d, 0xf8, 0x55, 0x97, 0x19, 0xcb, 0x55, 0xe7,
+    0x62, 0x91, 0xdd, 0x5e, 0xc2, 0xd4, 0xa9, 0x28, 0x80, 0x73, 0xb1, 0xef, 0xf9, 0xf6, 0xc0, 0xf1,
+    0xa9, 0x5a, 0x8e, 0xb4, 0x09, 0x14, 0xc2, 0x5c, 0x78, 0xf4, 0x81, 0x72, 0xe9, 0x2e, 0xfc, 0xea,
+    0x96, 0xee, 0x19, 0xf6, 0xcf, 0x71, 0xc0, 0x18, 0xb0, 0x7b, 0xce, 0x46, 0x6b, 0x36, 0xf3, 0x86,
+    0x45, 0x68, 0xe7, 0x95, 0xff, 0x30, 0xfc, 0x9e, 0xfd, 0x1a, 0x87, 0xd1, 0x6d, 0xd7, 0x35, 0xb1,
+    0xcb, 0x0f, 0x97, 0xbe, 0x2d, 0xca, 0x59, 0xb8, 0xe6, 0x27, 0xd2, 0x62, 0x02, 0xef, 0x68, 0x53,
+    0xbb, 0xd2, 0x1a, 0x9d, 0xcf, 0x14, 0x7d, 0xbd, 0x66, 0xcd, 0x2c, 0x2e, 0xc6, 0x41, 0x62, 0x8c,
+    0xc7, 0x90, 0xfe, 0x04, 0xdd, 0x11, 0xb6, 0x2b, 0x5c, 0x4d, 0xec, 0xc9, 0x83, 0x2f, 0x89, 0x78,
+    0x73, 0x8f, 0x9b, 0xc4, 0x24, 0x52, 0xbc, 0xd9, 0x96, 0x73, 0x03, 0x46, 0x0d, 0xad, 0x45, 0xc0,
+    0x34, 0xf5, 0xbb, 0x28, 0xe4, 0x8c, 0x4f, 0x79, 0x09, 0xc8, 0xd5, 0x96, 0x95, 0x97, 0x7e, 0xe6,
+    0x46, 0x0b, 0x41, 0x11, 0xde, 0x0a, 0x42, 0xbb, 0xdf, 0x01, 0x65, 0x17, 0x3b, 0xa0, 0x66, 0x28,
+    0xbe, 0x28, 0x34, 0x53, 0x8f, 0x39, 0x49, 0x9b, 0x10, 0xbe, 0x1f, 0xa9, 0x8a, 0x25, 0x36, 0xc7,
+    0x25, 0x17, 0x25, 0xd3, 0x71, 0xf8, 0xb5, 0x9b, 0xb4, 0xed, 0xcc, 0xe4, 0x87, 0x20, 0x2e, 0xa1,
+    0xcf, 0xc6, 0x1e, 0x3f, 0x9e, 0xdc, 0x22, 0xd3, 0xe3, 0x73, 0xce, 0xdf, 0x41, 0xe4, 0x45, 0x2a,
+    0x29, 0x2c, 0x74, 0x2a, 0x4c, 0xf7, 0x9f, 0x11, 0xf2, 0xe3, 0x0b, 0x05, 0xb3, 0xa5, 0x29, 0x21,
+    0x20, 0x34, 0xf0, 0x4a, 0xb3, 0xd7, 0x1d, 0xeb, 0x86, 0xdb, 0x2b, 0x48, 0x8d, 0x67, 0xc9, 0x96,
+    0x82, 0x9f, 0x62, 0x4e, 0x23, 0xc7, 0x0b, 0xd5, 0x1b, 0x89, 0x83, 0x6d, 0xb5, 0xea, 0xee, 0xb7,
+    0xfd, 0x08, 0xfc, 0x42, 0xc7, 0x7f, 0x8f, 0xb2, 0xaf, 0x70, 0x93, 0xae, 0x54, 0xa5, 0x5d, 0x40,
+    0x25, 0xb7, 0x57, 0x3e, 0xf0, 0xab, 0x0a, 0xb3, 0x4c, 0xad, 0x72, 0x31, 0x8e, 0x87, 0x89, 0x2e,
+    0xb8, 0xd9, 0xcf, 0xcc, 0x59, 0xdf, 0xd6, 0xbf, 0x4e, 0xe8, 0xbc, 0xe6, 0xb5, 0xd4, 0x61, 0xda,
+    0x5e, 0x0b, 0xc6, 0x74, 0x0a, 0x9b, 0x15, 0xa3, 0x3c, 0xa5, 0x64, 0xf3, 0xaa, 0x6d, 0xaa, 0x03,
+    0x2c, 0x2f, 0x11, 0x0f, 0x0b, 0x4a, 0x53, 0xdd, 0x3a, 0xc0, 0x89, 0x7f, 0xe1, 0x1a, 0x05, 0xb9,
+    0x0a, 0x8c, 0x39, 0x2c, 0xe6, 0x58, 0xae, 0xcd, 0x1d, 0x02, 0xc3, 0x92, 0x65, 0xb3, 0x90, 0x69,
+    0x8a, 0x83, 0xf0, 0x64, 0xfe, 0x0c, 0xc7, 0xe6, 0x18, 0x0c, 0x59, 0x8e, 0xe8, 0xc3, 0x19, 0x50,
+    0xe7, 0xa2, 0x3b, 0xab, 0x38, 0xec, 0x17, 0x79, 0x63, 0xa6, 0x7c, 0x98, 0xc6, 0xce, 0x36, 0xc7,
+    0xdb, 0xf0, 0x54, 0x04, 0xcd, 0xb1, 0xa4, 0x32, 0xc0, 0x91, 0x46, 0xb6, 0x20, 0x0b, 0x0c, 0x80,
+    0x84, 0x53, 0xff, 0x30, 0xc9, 0xdf, 0x0b, 0x38, 0xa1, 0x98, 0x7b, 0xa3, 0x34, 0xd5, 0xd8, 0x99,
+    0x0e, 0x08, 0x34, 0xc5, 0xf8, 0x92, 0x8c, 0x6a, 0x04, 0x90, 0xeb, 0x4f, 0x63, 0x3a, 0x4d, 0xe4,
+    0x0e, 0x60, 0xd2, 0x6c, 0x82, 0xc5, 0x22, 0x85, 0x63, 0x55, 0xc4, 0x7b, 0x11, 0x32, 0xf8, 0xc7,
+    0x4a, 0xb9, 0x18, 0x90, 0xf4, 0x8f, 0x55, 0x52, 0x8c, 0x1a, 0x1f, 0x92, 0xea, 0x59, 0xbb, 0x3d,
+    0xff, 0x99, 0xd5, 0x41, 0x8d, 0x50, 0x88, 0x27, 0x76, 0xd7, 0x68, 0x80, 0x71, 0x23, 0xf8, 0x32,
+    0x50, 0x77, 0x6b, 0x8f, 0x7e, 0x35, 0xf7, 0xb2, 0x68, 0x74, 0x2e, 0x32, 0xb0, 0xd1, 0x59, 0x0b,
+    0x56, 0x75, 0xe9, 0x88, 0xe1, 0x1a, 0x73, 0x26, 0x84, 0xf5, 0x65, 0x5e, 0xe0, 0xa1, 0x71, 0xe7,
+    0xcb, 0xa3, 0x80, 0x84, 0x97, 0x0a, 0x38, 0xf0, 0x36, 0xc1, 0xbd, 0xb1, 0x81, 0x78, 0xdc, 0x0a,
+    0x33, 0x99, 0xe1, 0x38, 0x73, 0xf6, 0x2b, 0x5f, 0xc8, 0x5f, 0x91, 0xa9, 0x64, 0xba, 0xc0, 0xdd,
+    0x37, 0x47, 0x89, 0x7c, 0x87, 0xcd, 0x8f, 0x71, 0x1b, 0x7d, 0xf5, 0x86, 0xd0, 0xb1, 0xf3, 0x31,
+    0x1b, 0x37, 0xef, 0xc1, 0x6c, 0x4c, 0xd2, 0x31, 0x1a, 0x8d, 0x17, 0x00, 0x55, 0xbd, 0x89, 0xb3,
+    0x60, 0x74, 0xc0, 0x77, 0x8e, 0x4f, 0x48, 0xbf, 0x3a, 0x45, 0x4f, 0x7b, 0x32, 0x3b, 0x27, 0x75,
+    0x6e, 0x70, 0x72, 0xb2, 0x06, 0xfd, 0x15, 0xd7, 0x9f, 0x50, 0xbb, 0x05, 0xa0, 0x6e, 0x6d, 0x3c,
+    0x2a, 0x45, 0xd1, 0x06, 0x33, 0xc3, 0x13, 0x9d, 0x68, 0x36, 0xf5, 0x0c, 0x85, 0xd7, 0x4a, 0x51,
+    0x0e, 0x97, 0xca, 0xce, 0x8f, 0x75, 0xf8, 0x10, 0xe0, 0x29, 0x83, 0x15, 0x37, 0x5f, 0x9b, 0xfc,
+    0x02, 0xe2, 0xc4, 0x17, 0x57, 0x4b, 0x25, 0x08, 0x3b, 0x13, 0xaa, 0x02, 0xb3, 0x8a, 0xa1, 0xdc,
+    0xac, 0xbc, 0x4e, 0x05, 0x09, 0xb1, 0x2f, 0xe6, 0x61, 0x23, 0xcc, 0xad, 0x29, 0xae, 0x27, 0x68,
+    0x86, 0x02, 0x04, 0x8b, 0x8a, 0xa5, 0xa7, 0x4e, 0xe4, 0xb1, 0x24, 0xd0, 0x8a, 0x77, 0x82, 0xe4,
+    0x4a, 0x6e, 0x47, 0x6c, 0x41, 0x33, 0xc4, 0xb8, 0x65, 0xc2, 0xe4, 0x29, 0x57, 0xbc, 0x71, 0x07,
+    0x6f, 0x37, 0x22, 0x28, 0xf0, 0x85, 0x97, 0xc4, 0x4d, 0x3a, 0xc0, 0x00, 0x8b, 0x0c, 0xed, 0xaa,
+    0xba, 0x9f, 0x20, 0x79, 0x83, 0x81, 0x1c, 0x9a, 0xe8, 0x4f, 0x4a, 0x69, 0x86, 0xaf, 0x63, 0x45,
+    0x15, 0xd9, 0xbe, 0x04, 0x66, 0x06, 0xd9, 0xe0, 0xeb, 0xde, 0xfc, 0xd0, 0x8f, 0x44, 0xb5, 0xab,
+    0xce, 0x7f, 0x5e, 0x6a, 0xd7, 0x10, 0xb2, 0x98, 0x71, 0xe8, 0x7a, 0xe7, 0x81, 0x13, 0xe9, 0x5a,
+    0xa7, 0x72, 0x8e, 0x4c, 0x24, 0x18, 0x7f, 0x83, 0xf5, 0x9b, 0x70, 0xa1, 0xef, 0x32, 0xf3, 0xee,
+    0x64, 0xa5, 0x1a, 0x95, 0x88, 0x4f, 0x9e, 0x1c, 0xab, 0x12, 0x20, 0x32, 0xc5, 0x2a, 0xbd, 0x99,
+    0xb6, 0x76, 0xd4, 0x58, 0xa8, 0x73, 0x2d, 0x71, 0xeb, 0x11, 0xb5, 0x67, 0x10, 0x6a, 0xa0, 0xd3,
+    0xa6, 0x67, 0xfb, 0x20, 0x30, 0xad, 0xd9, 0x0c, 0xa8, 0x59, 0xda, 0x66, 0x45, 0x93, 0x94, 0xba,
+    0xc1, 0x31, 0x7a, 0xef, 0xe0, 0x29, 0x57, 0xfd, 0xca, 0xfb, 0xcd, 0x7b, 0x78, 0xeb, 0x8c, 0xe0,
+    0x78, 0x8d, 0x8e, 0x35, 0xcb, 0x8d, 0x57, 0x77, 0x33, 0xcf, 0x5b, 0x51, 0xe6, 0x55, 0x54, 0xc5,
+    0x7f, 0x17, 0x7a, 0xef, 0x6d, 0x3b, 0x65, 0x0e, 0x74, 0xf4, 0xca, 0x93, 0xc1, 0xe3, 0x0e, 0x52,
+    0x63, 0x52, 0xbb, 0xbc, 0x35, 0x22, 0x8d, 0x75, 0xff, 0x7c, 0xe9, 0x37, 0xcb, 0x8f, 0x05, 0x2a,
+    0xcd, 0x23, 0x6c, 0x00, 0x7a, 0x25, 0x13, 0xb7, 0x3f, 0x3f, 0x55, 0x51, 0x2d, 0xc4, 0x54, 0xcf,
+    0xb9, 0x75, 0x4d, 0xf1, 0x3e, 0x24, 0x17, 0xc7, 0xe6, 0x6b, 0x48, 0x7e, 0x78, 0xc0, 0xca, 0xc0,
+    0xcb, 0x9a, 0x6d, 0x2d, 0x22, 0xeb, 0xc4, 0xa1, 0x7d, 0xef, 0x47, 0x57, 0xf7, 0x37, 0xa3, 0x12,
+    0x7a, 0x51, 0xa6, 0x22, 0x1c, 0x9e, 0xa7, 0x95, 0x9a, 0x3a, 0x30, 0xf1, 0x15, 0x53, 0x46, 0xaf,
+    0x01, 0x19, 0xd0, 0xfe, 0xed, 0xaa, 0x59, 0x10, 0x7b, 0x43, 0xe1, 0x43, 0x64, 0x70, 0x87, 0x01,
+    0xb7, 0x62, 0x8a, 0xee, 0x7a, 0x72, 0x3e, 0x9b, 0x97, 0xeb, 0xa6, 0x96, 0x5b, 0xcb, 0xbe, 0x73,
+    0xee, 0xa6, 0x6f, 0x36, 0x38, 0x0b, 0xb4, 0xb2, 0xbc, 0x94, 0x6c, 0xbc, 0x22, 0xf2, 0x22, 0x2d,
+    0xe1, 0x99, 0xbf, 0x99, 0x2a, 0x0e, 0x6b, 0x0e, 0xc3, 0xfc, 0x1e, 0x13, 0xe1, 0xac, 0x9b, 0x9b,
+    0x1e, 0x04, 0x5a, 0xfe, 0xdd, 0xf0, 0x11, 0x00, 0xdc, 0xbd, 0x5c, 0x02, 0xfc, 0x27, 0x34, 0xb3,
+    0xc3, 0x1c, 0x82, 0xbb, 0x7b, 0x45, 0x24, 0xc4, 0x5d, 0x6a, 0x47, 0x19, 0x38, 0xbf, 0x13, 0x33,
+    0xd0, 0x3b, 0xd7, 0x79, 0x8a, 0x55, 0x59, 0x88, 0x01, 0xbb, 0x79, 0x7e, 0xbd, 0x07, 0x42, 0x28,
+    0xbc, 0xe0, 0xa2, 0xa2, 0x93, 0x35, 0x17, 0x94, 0x3b, 0x1a, 0xb3, 0xd3, 0x4e, 0xde, 0x43, 0x8f,
+    0x2a, 0x78, 0x8f, 0xc1, 0x2f, 0x85, 0x82, 0xd7, 0xc0, 0x5c, 0xf9, 0xc8, 0xc8, 0xbc, 0x0d, 0x3a,
+    0x88, 0x53, 0xb8, 0xf0, 0xf5, 0x56, 0x1c, 0xd1, 0xa9, 0x48, 0x52, 0x38, 0x67, 0x1a, 0xc1, 0x1d,
+    0x07, 0xec, 0x47, 0xc4, 0xd2, 0xba, 0x7b, 0x26, 0xb8, 0x86, 0xe0, 0x74, 0xc3, 0x1b, 0x87, 0xe4,
+    0x96, 0xc4, 0xcb, 0x79, 0x95, 0x82, 0x52, 0x78, 0xf8, 0xc0, 0xbc, 0x2b, 0x30, 0x65, 0xb7, 0x96,
+    0x11, 0x23, 0xdc, 0x3c, 0x51, 0x5d, 0xad, 0x1c, 0x27, 0x91, 0x00, 0x24, 0xb3, 0x69, 0x32, 0xc9,
+    0xa7, 0x4c, 0x69, 0xa6, 0x5f, 0xc9, 0x3f, 0x54, 0xb3, 0xab, 0x17, 0x6a, 0x6d, 0x5e, 0xcd, 0x06,
+    0xf0, 0x05, 0xb9, 0x24, 0x75, 0x76, 0xe9, 0x6c, 0x6f, 0xef, 0x10, 0x4d, 0x84, 0xf2, 0x65, 0x33,
+    0x42, 0x21, 0xf9, 0xbf, 0x61, 0x0f, 0xea, 0xc7, 0xf0, 0x1f, 0x3e, 0xfe, 0x0e, 0x6f, 0x45, 0x4b,
+    0x01, 0x58, 0xa6, 0x2a, 0x6a, 0xf6, 0x86, 0x2c, 0x7a, 0x34, 0x06, 0x6a, 0xf8, 0xf3, 0x8f, 0x59,
+    0x15, 0x24, 0x85, 0xbc, 0xf1, 0xd5, 0x95, 0x83, 0x3d, 0x21, 0x6e, 0x2b, 0xe7, 0x01, 0xc9, 0xd6,
+    0xf5, 0xcd, 0x23, 0xa9, 0x5f, 0x55, 0xb8, 0x0b, 0xfa, 0xcf, 0x7f, 0x38, 0x89, 0x71, 0x71, 0x2f,
+    0x60, 0x3a, 0x01, 0x3a, 0xda, 0x19, 0xdc, 0xa7, 0x5f, 0x2a, 0x79, 0xd9, 0x5f, 0x82, 0x3d, 0x50,
+    0xfa, 0x71, 0x84, 0xf5, 0xa4, 0x06, 0x18, 0xf0, 0xf2, 0xed, 0xda, 0x3e, 0x7d, 0x4b, 0xdf, 0x85,
+    0x6d, 0xae, 0xa5, 0x75, 0xd0, 0xa5, 0xf0, 0x84, 0x1d, 0xc7, 0xc6, 0xa5, 0x03, 0x79, 0x98, 0x0d,
+    0x60, 0x66, 0x38, 0xce, 0x8a, 0x5c, 0x28, 0x1f, 0x97, 0x0d, 0x77, 0x7e, 0xd4, 0x49, 0x99, 0x51,
+    0x68, 0x95, 0x72, 0x82, 0xf4, 0xf4, 0xdb, 0x07, 0x2e, 0xdd, 0xe4, 0xf1, 0xc3, 0xae, 0x3f, 0x15,
+    0x5b, 0x14, 0x73, 0x74, 0x1e, 0xad, 0xc3, 0xb0, 0xe0, 0xda, 0xf8, 0xc2, 0x45, 0x47, 0xe3, 0x2d,
+    0xf0, 0x5f, 0x4c, 0xb6, 0x18, 0x6c, 0x71, 0x22, 0xa5, 0x61, 0x9d, 0x6c, 0xe0, 0x96, 0xdb, 0x1d,
+    0x5d, 0xbf, 0x4b, 0xf6, 0xe0, 0x61, 0x78, 0x8f, 0x3e, 0x62, 0xd4, 0x0c, 0x0c, 0xbd, 0x2f, 0x3c,
+    0x6e, 0xa2, 0x97, 0xff, 0x32, 0xf4, 0x7b, 0x7a, 0x20, 0xc4, 0x7d, 0xe0, 0x08, 0xd1, 0x1b, 0x9e,
+    0xb4, 0xc4, 0x19, 0x88, 0x30, 0x57, 0x08, 0x33, 0xf8, 0xeb, 0x08, 0x94, 0x49, 0x43, 0x1b, 0x5b,
+    0x8b, 0x9c, 0x43, 0x1f, 0x59, 0xb9, 0x83, 0x7f, 0x7e, 0xd2, 0x4f, 0xb2, 0x0c, 0xe7, 0x27, 0x53,
+    0xdc, 0x54, 0x4f, 0x2e, 0xf8, 0xc5, 0x94, 0x80, 0xd4, 0x1b, 0x9b, 0x70, 0x83, 0xc4, 0xcc, 0xf3,
+    0xf9, 0xe7, 0x41, 0x34, 0x69, 0x7c, 0x2e, 0xa7, 0x9b, 0x81, 0x81, 0x19, 0xa3, 0x45, 0x6a, 0x02,
+    0x36, 0x14, 0x57, 0x6d, 0x4d, 0xe0, 0x4e, 0x77, 0x71, 0x01, 0x6f, 0xdd, 0x9c, 0xa3, 0x59, 0x3a,
+    0xf0, 0xc4, 0x79, 0xc3, 0x79, 0xf8, 0x95, 0xc0, 0x60, 0x07, 0x3c, 0xed, 0xdc, 0x4e, 0xcf, 0x00,
+    0xbb, 0x90, 0xf5, 0x97, 0x89, 0xd9, 0x49, 0x34, 0xd1, 0x32, 0x50, 0xb1, 0x2e, 0x84, 0x50, 0x11,
+    0x99, 0xe1, 0x19, 0xad, 0x9f, 0x8d, 0xd8, 0x47, 0x04, 0x83, 0x31, 0xc2, 0x80, 0xa8, 0xbb, 0xf8,
+    0x54, 0xf3, 0x0d, 0x0e, 0xdd, 0x68, 0xe9, 0x73, 0xf6, 0xa4, 0xba, 0xc6, 0x8b, 0x98, 0x4e, 0x69,
+    0xfa, 0x57, 0x95, 0x06, 0xc1, 0xc3, 0x01, 0xe1, 0x5d, 0x36, 0xba, 0x4c, 0xc3, 0x7b, 0xc1, 0x13,
+    0x57, 0x8d, 0x1a, 0x05, 0x0c, 0x7b, 0x3e, 0xe2, 0xea, 0xb3, 0xcc, 0xf8, 0x8b, 0x53, 0xd8, 0xd2,
+    0x81, 0x72, 0x0d, 0x71, 0x81, 0x49, 0xa1, 0xfe, 0x34, 0x61, 0xfc, 0x87, 0xe9, 0x00, 0x45, 0xca,
+    0x1a, 0x85, 0xc0, 0x08, 0x63, 0xc2, 0x56, 0x65, 0x80, 0xad, 0x69, 0x8f, 0x14, 0x20, 0x96, 0xf1,
+    0xed, 0xee, 0x0b, 0x7d, 0xf2, 0xa1, 0x1d, 0xc9, 0xde, 0x78, 0x17, 0x53, 0x3d, 0xb8, 0xac, 0x9d,
+    0x01, 0xd3, 0x54, 0x73, 0x23, 0x37, 0x13, 0x01, 0x8b, 0xbe, 0x8f, 0xf0, 0xfe, 0xc3, 0x69, 0x85,
+    0x13, 0xda, 0x77, 0x36, 0x9d, 0x6e, 0x21, 0xed, 0x76, 0xf2, 0x9e, 0xaa, 0xcb, 0x2b, 0x61, 0x4e,
+    0xe2, 0xac, 0xe6, 0x1e, 0x13, 0x17, 0xfa, 0x5e, 0x13, 0x5c, 0x05, 0xe4, 0xbf, 0x54, 0xbb, 0xed,
+    0xc2, 0xbd, 0x75, 0x5a, 0x2a, 0x96, 0x34, 0x06, 0x72, 0x05, 0x10, 0x23, 0x66, 0xe8, 0x30, 0xc6,
+    0x11, 0x8a, 0x53, 0xa0, 0x5b, 0xdf, 0x7b, 0x8e, 0xb4, 0x74, 0x73, 0x31, 0x31, 0x4f, 0x8b, 0xe5,
+    0xb9, 0x53, 0x29, 0xe8, 0x17, 0x11, 0x02, 0x5c, 0xff, 0x13, 0x5f, 0x54, 0x36, 0xe3, 0x22, 0x2f,
+    0x04, 0x34, 0x64, 0xf2, 0xf5, 0xb5, 0x3f, 0x44, 0x58, 0xd9, 0x32, 0xd4, 0x8f, 0x23, 0xad, 0xdf,
+    0x19, 0xe6, 0x14, 0x52, 0x9b, 0x03, 0xde, 0x3d, 0xb6, 0xe8, 0x6e, 0x05, 0x60, 0x23, 0x07, 0x1b,
+    0x07, 0xc9, 0x0b, 0x03, 0x87, 0xe3, 0x00, 0xaa, 0x9d, 0x69, 0xf0, 0x03, 0xbf, 0x27, 0xcf, 0x20,
+    0x3a, 0xf8, 0x05, 0x64, 0x38, 0xdb, 0x2f, 0x6d, 0x58, 0x37, 0x23, 0x50, 0x29, 0x65, 0x85, 0x30,
+    0xce, 0x7d, 0x42, 0x48, 0x7a, 0xbb, 0xe9, 0x22, 0x6d, 0xae, 0xbb, 0xcf, 0xa2, 0x74, 0x9b, 0x8b,
+    0x00, 0xa8, 0x25, 0x72, 0xb0, 0x69, 0x3b, 0xce, 0xb0, 0x1d, 0x2e, 0x2e, 0x45, 0x85, 0x6a, 0x75,
+    0x29, 0x91, 0x8f, 0x3a, 0xec, 0x8e, 0x74, 0x75, 0x18, 0xe9, 0xe8, 0x5d, 0x13, 0xee, 0x06, 0xd9,
+    0x67, 0x4c, 0x21, 0x33, 0x2e, 0x5c, 0x63, 0x89, 0x16, 0xc9, 0x77, 0xd3, 0x76, 0x3b, 0x36, 0x0f,
+    0x8a, 0xb7, 0x81, 0xba, 0xa1, 0x8c, 0x5c, 0x2d, 0x1b, 0x65, 0x14, 0x73, 0x78, 0x9b, 0x67, 0x36,
+    0x3a, 0x4a, 0x0a, 0xbb, 0x20, 0x6a, 0x50, 0x4f, 0x87, 0x74, 0x72, 0x65, 0x70, 0x44, 0xcb, 0xf4,
+    0xc3, 0x8e, 0x93, 0x17, 0x9f, 0xab, 0x9c, 0x74, 0x5e, 0xe4, 0xd8, 0x39, 0x38, 0x1b, 0xac, 0xa9,
+    0xca, 0xf9, 0xf1, 0xd4, 0xec, 0xa2, 0x62, 0xf8, 0x4b, 0x97, 0xe1, 0x58, 0x71, 0x0a, 0x17, 0xcc,
+    0x91, 0xa5, 0x5c, 0x06, 0xe3, 0xfb, 0x17, 0xcb, 0x04, 0xb7, 0xa1, 0x31, 0x7f, 0x55, 0x03, 0xbe,
+    0x7b, 0xa9, 0x19, 0xbc, 0xaa, 0x49, 0x7a, 0x97, 0x88, 0x45, 0x27, 0x89, 0x20, 0x06, 0x89, 0x49,
+    0x5c, 0x41, 0x4b, 0xb5, 0xe3, 0x63, 0xa0, 0xb1, 0x4a, 0x52, 0x3e, 0x0e, 0x2c, 0xc3, 0x8a, 0x10,
+    0x32, 0x39, 0xb7, 0x34, 0xa3, 0x3b, 0x0e, 0x5c, 0x73, 0x90, 0x6e, 0xfe, 0x24, 0x57, 0x4f, 0x18,
+    0xd0, 0x4f, 0x72, 0x3b, 0x73, 0xe9, 0x8e, 0x65, 0x55, 0x66, 0xbe, 0xe0, 0xae, 0xfc, 0x5c, 0xdd,
+    0xc6, 0xce, 0xff, 0xc0, 0x68, 0x01, 0xd4, 0xf9, 0xd3, 0xc3, 0x0a, 0x20, 0x68, 0x22, 0xa3, 0x4e,
+    0x02, 0x21, 0xf4, 0x96, 0x2b, 0x0c, 0x8b, 0x8a, 0xc4, 0x2a, 0xe4, 0xdc, 0xa9, 0x93, 0x04, 0xe2,
+    0x83, 0x75, 0x0d, 0x6d, 0xb1, 0x60, 0x60, 0x70, 0x08, 0xab, 0x86, 0xf0, 0x89, 0x4b, 0xc5, 0xf2,
+    0x63, 0x46, 0x2c, 0xa5, 0x95, 0xd4, 0xfa, 0x31, 0xc6, 0x40, 0x37, 0xbb, 0x34, 0x97, 0xdd, 0x0d,
+    0x0a, 0xe1, 0xdc, 0xe1, 0x6d, 0x8f, 0xa1, 0xb9, 0x4c, 0x1a, 0xb6, 0x86, 0xeb, 0xe9, 0xd0, 0x03,
+    0xb8, 0xf9, 0xc9, 0xd0, 0x06, 0xa6, 0xd5, 0xde, 0xf1, 0xc6, 0xa6, 0x14, 0x29, 0x68, 0xf3, 0x05,
+    0x54, 0x2b, 0x55, 0x46, 0x27, 0x22, 0x13, 0x14, 0xd9, 0xc8, 0x2f, 0x6e, 0x78, 0xed, 0xa9, 0x9b,
+    0xcf, 0x65, 0x71, 0x4a, 0x44, 0x58, 0x76, 0x3e, 0x14, 0x1d, 0xe1, 0x20, 0xa3, 0xa8, 0x64, 0x25,
+    0x9c, 0x57, 0x4f, 0x90, 0x52, 0x01, 0x0a, 0x58, 0xef, 0x60, 0xb5, 0xc3, 0x90, 0xb1, 0x57, 0x86,
+    0x90, 0xaf, 0x96, 0x2a, 0xfd, 0x34, 0xcf, 0xa5, 0x7e, 0xd5, 0xdb, 0x0b, 0x91, 0x23, 0xa7, 0x65,
+    0x65, 0x8d, 0x38, 0xc4, 0x14, 0xf3, 0xf4, 0xf7, 0xd2, 0xc1, 0x35, 0xbd, 0x32, 0xa6, 0x7a, 0xba,
+    0xc7, 0x37, 0x72, 0x76, 0x09, 0x9e, 0x18, 0xe1, 0x82, 0xbe, 0x72, 0xd2, 0x6e, 0xc9, 0x0a, 0xb6,
+    0x05, 0x67, 0xa3, 0x9a, 0x54, 0x20, 0xf1, 0x8e, 0x9e, 0xe9, 0xf4, 0x14, 0xd4, 0x93, 0x5f, 0x48,
+    0xb3, 0x29, 0x04, 0x00, 0xe0, 0xf0, 0x20, 0x74, 0xdf, 0x3e, 0x32, 0xe3, 0xa6, 0xa0, 0x5c, 0xba,
+    0xc9, 0x74, 0xba, 0xf3, 0x1c, 0xe7, 0xb6, 0xba, 0xc0, 0x1f, 0x97, 0x18, 0x71, 0xe5, 0x5e, 0xf6,
+    0xca, 0x8d, 0xda, 0x11, 0xec, 0xbd, 0x68, 0x41, 0x26, 0x6d, 0xd8, 0x99, 0xca, 0x7b, 0x5a, 0x05,
+    0x73, 0xd0, 0xc2, 0xf6, 0xbc, 0x7c, 0xdb, 0xc7, 0xa4, 0x49, 0x07, 0xee, 0xea, 0xe9, 0x28, 0x32,
+    0x0f, 0x15, 0x63, 0x76, 0x25, 0x2a, 0xbc, 0x9d, 0x93, 0x77, 0x1a, 0x99, 0x23, 0x93, 0x3e, 0xdf,
+    0xf1, 0xf3, 0x55, 0x3b, 0x23, 0xa0, 0x30, 0xb8, 0xc2, 0x1d, 0x30, 0x0b, 0x4b, 0x8b, 0xc7, 0x9e,
+    0xea, 0xb6, 0x3e, 0x94, 0x62, 0x37, 0x9b, 0x39, 0xae, 0x49, 0x04, 0x12, 0x8c, 0x98, 0xf8, 0x89,
+    0x0b, 0xff, 0x30, 0xef, 0x86, 0x37, 0x72, 0x5d, 0xf6, 0xe5, 0xb5, 0x97, 0xf1, 0x86, 0x0f, 0x97,
+    0x00, 0xb6, 0x56, 0x70, 0x01, 0xec, 0xb7, 0x7b, 0xe6, 0x5e, 0x59, 0x01, 0xb0, 0xb0, 0x0a, 0x00,
+    0x12, 0x05, 0x93, 0xc6, 0x0e, 0x85, 0x1a, 0xf9, 0x22, 0x52, 0xa9, 0x0a, 0xdd, 0x65, 0x01, 0xb1,
+    0xd9, 0xe8, 0xde, 0xbe, 0x1e, 0xe1, 0xd7, 0x00, 0xa0, 0xb9, 0x76, 0x80, 0x4c, 0x32, 0xca, 0x79,
+    0x13, 0x29, 0x89, 0x3a, 0x0e, 0x89, 0x2d, 0x78, 0xbb, 0x2e, 0x2e, 0x24, 0x56, 0x04, 0x63, 0x5d,
+    0x2b, 0x6a, 0xc4, 0x75, 0x51, 0x04, 0xa9, 0x35, 0x9c, 0xd2, 0x61, 0x9f, 0xc6, 0xe8, 0xf5, 0x62,
+    0x29, 0xa4, 0x87, 0xd4, 0x75, 0x07, 0x33, 0xad, 0xf6, 0x3d, 0x83, 0x3e, 0xbc, 0x5a, 0x6d, 0xa3,
+    0xf1, 0xce, 0x49, 0xf5, 0xeb, 0x6e, 0x8a, 0xdb, 0xdb, 0x81, 0x35, 0x2a, 0x92, 0x54, 0x11, 0xde,
+    0x72, 0x59, 0x01, 0x2b, 0xbb, 0xf7, 0x5f, 0x7e, 0x0d, 0xcd, 0xbb, 0x99, 0xa6, 0x3b, 0xb1, 0x81,
+    0x06, 0x13, 0xaa, 0x3b, 0xd3, 0x20, 0xff, 0xbf, 0x27, 0xbe, 0x7e, 0x5b, 0x73, 0xb7, 0x9c, 0x8f,
+    0x1e, 0x9d, 0xa8, 0xc2, 0xb1, 0x48, 0x2e, 0x42, 0xfc, 0xae, 0xc7, 0xcb, 0xda, 0xc0, 0x86, 0x91,
+    0x85, 0x2c, 0xb0, 0x43, 0xc5, 0x19, 0x3b, 0xf3, 0xca, 0x76, 0x2a, 0x65, 0x0d, 0x31, 0xaa, 0xf6,
+    0xa3, 0x29, 0x1b, 0x5b, 0x16, 0x1d, 0x1b, 0xc8, 0xa9, 0xc8, 0xff, 0x05, 0x6a, 0x73, 0x5d, 0xc4,
+    0x3d, 0x93, 0xeb, 0xa6, 0x54, 0x74, 0xce, 0x4f, 0xee, 0xc6, 0x04, 0x43, 0xb9, 0x7b, 0x01, 0x6b,
+    0x4e, 0xa7, 0x5f, 0x4f, 0x1b, 0x41, 0xcd, 0x60, 0x8a, 0x25, 0xa4, 0x18, 0x1c, 0xe9, 0x9e, 0x08,
+    0xe5, 0x05, 0xdc, 0xc1, 0x90, 0x12, 0x99, 0x14, 0xcb, 0xd3, 0xf1, 0x0b, 0x70, 0x74, 0x7d, 0x81,
+    0xd6, 0x31, 0x04, 0xa0, 0xeb, 0x21, 0x11, 0x1b, 0xf7, 0x49, 0xe0, 0xf8, 0x43, 0xc1, 0x5a, 0x61,
+    0xd5, 0xa6, 0x1b, 0xab, 0xf0, 0xf7, 0x3b, 0x29, 0x62, 0x57, 0x8f, 0x6a, 0xde, 0x1a, 0x5d, 0xe7,
+    0xfe, 0xe7, 0xca, 0x00, 0x2b, 0x60, 0xe8, 0x05, 0xb8, 0xc3, 0x33, 0x16, 0xd3, 0x4e, 0xc6, 0x67,
+    0x54, 0x52, 0x4b, 0x6c, 0xff, 0xcf, 0x75, 0xf4, 0x31, 0x3f, 0xd3, 0xd3, 0xe8, 0x79, 0xa9, 0x1a,
+    0x99, 0x32, 0x57, 0x12, 0xb7, 0x3f, 0x67, 0xa6, 0x61, 0x05, 0x2d, 0x25, 0xf7, 0xc4, 0x5e, 0x3f,
+    0x61, 0x90, 0x05, 0x5f, 0x92, 0x5e, 0x6d, 0xe5, 0x1c, 0x46, 0xe7, 0xb0, 0x55, 0x94, 0x22, 0xcb,
+    0xe7, 0x29, 0xf0, 0x23, 0x7c, 0x91, 0x0c, 0x6d, 0xc2, 0x91, 0x10, 0x00, 0xb5, 0xf2, 0x3f, 0x01,
+    0x37, 0x90, 0x22, 0x8c, 0x25, 0x74, 0xb4, 0x80, 0xc5, 0x44, 0xd3, 0xe9, 0x0c, 0x0f, 0xe4, 0x66,
+    0x41, 0x0d, 0x2b, 0xf9, 0x6a, 0xb3, 0x11, 0xf2, 0xa4, 0xee, 0x98, 0x40, 0xdc, 0xe5, 0xb0, 0x6d,
+    0x5b, 0x49, 0x55, 0x24, 0xb2, 0x20, 0xea, 0xd6, 0x12, 0x05, 0xfa, 0x68, 0x0d, 0xa0, 0xd1, 0x5f,
+    0x98, 0x66, 0x05, 0xc4, 0x3d, 0x5b, 0x7b, 0x34, 0xc1, 0x58, 0xda, 0xfe, 0xa6, 0xac, 0x0d, 0xc0,
+    0x92, 0x1d, 0x39, 0xc5, 0xfd, 0xe5, 0x05, 0xa4, 0xe5, 0x5f, 0x84, 0x78, 0x71, 0x0a, 0x78, 0xe7,
+    0x57, 0xb5, 0xc1, 0x33, 0x33, 0x62, 0x0c, 0x95, 0xd4, 0xa9, 0x31, 0x14, 0x57, 0xe6, 0xa4, 0x98,
+    0xe7, 0xc3, 0xc7, 0x9e, 0xb2, 0x02, 0xa1, 0x14, 0x94, 0x66, 0x2b, 0xe6, 0xa6, 0x75, 0x56, 0x3e,
+    0x78, 0xb0, 0xb3, 0x02, 0x7b, 0x30, 0x54, 0xce, 0x1c, 0xc7, 0x80, 0xb9, 0x07, 0x19, 0x97, 0xb3,
+    0xad, 0x7a, 0x05, 0xcb, 0x74, 0x88, 0xf7, 0x98, 0xe1, 0x1c, 0xe4, 0xd2, 0xe2, 0xb3, 0x9c, 0xb4,
+    0x76, 0x49, 0x0e, 0x08, 0x54, 0x7c, 0x83, 0x39, 0x56, 0x78, 0xd3, 0xc9, 0x0c, 0x8f, 0xba, 0xdb,
+    0x81, 0x26, 0xfc, 0x57, 0x06, 0xb3, 0xc1, 0x2e, 0x25, 0x49, 0x34, 0x4c, 0x59, 0x67, 0x26, 0xd1,
+    0x89, 0x22, 0x5c, 0x75, 0x38, 0xca, 0x84, 0xb0, 0xb4, 0x04, 0x6b, 0xa9, 0xb3, 0xec, 0x90, 0x99,
+    0x20, 0x89, 0x5a, 0xd5, 0xcf, 0x91, 0xdc, 0x5e, 0x76, 0xd9, 0x68, 0x8d, 0x05, 0xc8, 0x2b, 0x2c,
+    0x39, 0x08, 0x32, 0x19, 0xd6, 0xb4, 0x7b, 0xb2, 0x52, 0xc0, 0xe2, 0xb9, 0xa8, 0x08, 0x62, 0x19,
+    0xdd, 0x1a, 0x93, 0xa8, 0x03, 0x8e, 0xae, 0x25, 0xa0, 0xa8, 0xe1, 0xde, 0x27, 0x1c, 0x6b, 0x5c,
+    0x2a, 0xa1, 0x51, 0x59, 0xaf, 0xbd, 0x34, 0x6d, 0xff, 0x70, 0x27, 0x00, 0x12, 0xa3, 0x9c, 0xa2,
+    0x18, 0x48, 0x1a, 0x23, 0x50, 0x11, 0x14, 0x61, 0x68, 0x38, 0x51, 0x15, 0x30, 0x1e, 0xaf, 0xe8,
+    0xa0, 0x0b, 0x18, 0x74, 0x98, 0x92, 0xc4, 0x79, 0x7e, 0xa3, 0xe5, 0xd4, 0xfe, 0x4e, 0xdc, 0xa4,
+    0xa5, 0x67, 0x8f, 0xca, 0x22, 0xe8, 0xd8, 0xd1, 0x55, 0xf0, 0xf8, 0x3a, 0x0a, 0xbb, 0xfe, 0x64,
+    0xa9, 0x91, 0xd0, 0xb2, 0xc8, 0x72, 0x67, 0x32, 0x21, 0xf5, 0x73, 0xa9, 0x77, 0xea, 0x7b, 0x47,
+    0xd8, 0xca, 0xbd, 0xc6, 0xab, 0xac, 0xd0, 0xe2, 0x78, 0x5f, 0x4d, 0x20, 0xac, 0xff, 0x9c, 0x02,
+    0xd2, 0xfa, 0x14, 0x3d, 0xa5, 0xd5, 0x8e, 0x49, 0x01, 0x38, 0x47, 0x84, 0xe3, 0xae, 0x5e, 0x3a,
+    0x1b, 0xcb, 0x69, 0xe4, 0x04, 0xe6, 0xcc, 0x24, 0xc3, 0x28, 0x57, 0x4b, 0x0d, 0x19, 0x6a, 0xba,
+    0x96, 0xdc, 0x28, 0xc0, 0x8b, 0x40, 0x04, 0x8f, 0x09, 0x64, 0x7b, 0x3d, 0xca, 0x62, 0x0a, 0x4b,
+    0x0c, 0xb6, 0x46, 0x0d, 0x8f, 0x18, 0x0c, 0x6f, 0x61, 0x2a, 0x3d, 0x9e, 0x4b, 0x02, 0xf3, 0x5c,
+    0xdd, 0x73, 0xb0, 0xfd, 0x44, 0xd7, 0x08, 0x00, 0xab, 0x07, 0xe1, 0x48, 0x85, 0x08, 0xd9, 0xd7,
+    0xa1, 0x6c, 0x23, 0x1c, 0xa4, 0xce, 0x0c, 0xb2, 0x40, 0x28, 0xb8, 0xc7, 0x66, 0xbd, 0xd1, 0x82,
+    0x42, 0x26, 0xa0, 0x36, 0x6d, 0x25, 0x78, 0xd2, 0xd7, 0x51, 0xf7, 0xb5, 0xd7, 0x60, 0xe5, 0xcc,
+    0x15, 0x93, 0xb8, 0x37, 0xf7, 0xfa, 0x87, 0xc5, 0x9a, 0x52, 0x3b, 0xd4, 0x75, 0xce, 0x67, 0x3e,
+    0x7d, 0x51, 0xd7, 0x97, 0x2f, 0x00, 0xaa, 0x38, 0x58, 0x53, 0xf7, 0x3f, 0x9d, 0xfe, 0x44, 0xfe,
+    0x4a, 0xad, 0x7f, 0x24, 0xe2, 0xdf, 0x11, 0x75, 0x66, 0x43, 0x65, 0xe0, 0xcb, 0x37, 0x92, 0x60,
+    0xda, 0xeb, 0x2f, 0x35, 0xae, 0x04, 0x0e, 0xb9, 0xee, 0xaf, 0x42, 0x79, 0x57, 0xc3, 0x3d, 0x5d,
+    0x0e, 0x7b, 0xde, 0x11, 0x1b, 0x86, 0x7e, 0x6e, 0x3a, 0x70, 0xdc, 0xdd, 0x62, 0xf1, 0xd9, 0xc3,
+    0x1c, 0x51, 0x5b, 0x64, 0x51, 0xf2, 0x31, 0x7f, 0x10, 0xec, 0xc8, 0xc3, 0x67, 0xcb, 0xe8, 0x88,
+    0xb5, 0xf2, 0xbe, 0x33, 0x1f, 0x90, 0x42, 0xe8, 0x62, 0x5a, 0x86, 0x7c, 0xbf, 0xc6, 0xf5, 0xb7,
+    0x5f, 0x4a, 0x10, 0xe8, 0x1a, 0x36, 0x3e, 0xa7, 0x58, 0x51, 0x1d, 0xc7, 0x26, 0x13, 0x3b, 0xc7,
+    0x06, 0xf8, 0x83, 0xed, 0x27, 0x4f, 0xf4, 0x9e, 0xbf, 0xfd, 0x81, 0xf6, 0x86, 0xd9, 0xfc, 0x27,
+    0xc3, 0xf5, 0xd7, 0xe3, 0x4e, 0xdc, 0xc8, 0x3c, 0x32, 0x39, 0xb8, 0x21, 0xe5, 0x88, 0x92, 0x6c,
+    0x44, 0xf0, 0x4a, 0xce, 0x70, 0x22, 0xdb, 0x91, 0x67, 0xbd, 0x5e, 0xbe, 0x84, 0x16, 0xec, 0x34,
+    0xf7, 0x27, 0x30, 0xff, 0x4b, 0xd8, 0xbf, 0x39, 0x7c, 0x69, 0x42, 0x78, 0x4f, 0xf1, 0xbd, 0x93,
+    0xd4, 0x1f, 0x26, 0x0c, 0x32, 0x6f, 0x2e, 0x4c, 0xde, 0xb7, 0x10, 0x6d, 0x88, 0xde, 0xaf, 0xa7,
+    0xd9, 0x5c, 0x4d, 0x0d, 0x98, 0x75, 0xd6, 0xe1, 0xf8, 0x1d, 0x41, 0x87, 0xb0, 0x4f, 0x21, 0xdb,
+    0x5d, 0x20, 0x3f, 0xaf, 0x33, 0xf7, 0x8c, 0xfb, 0xa6, 0x4a, 0x93, 0x1e, 0x7c, 0x72, 0xa7, 0xf5,
+    0x97, 0x90, 0xb1, 0xf1, 0x63, 0x5e, 0xd0, 0xae, 0x25, 0x83, 0x82, 0x17, 0xaf, 0x77, 0xa3, 0x8b,
+    0x81, 0x7b, 0x33, 0x9a, 0xbe, 0x6b, 0xe8, 0x32, 0xd0, 0x94, 0x8b, 0x5f, 0xc6, 0x97, 0x77, 0xca,
+    0x76, 0x7f, 0xf1, 0x96, 0x2e, 0xf6, 0xae, 0x6f, 0xd3, 0x5e, 0xee, 0xc6, 0x96, 0x7e, 0xb3, 0xad,
+    0x65, 0x6c, 0xdd, 0x86, 0xf8, 0x4f, 0x9a, 0xbe, 0x4c, 0x43, 0xf4, 0x5a, 0xb7, 0x77, 0x3c, 0x3e,
+    0x81, 0xf5, 0x9e, 0xf2, 0xf9, 0x18, 0x8b, 0xf2, 0xce, 0x9d, 0xa5, 0x1e, 0xc0, 0xb6, 0x58, 0x4f,
+    0x02, 0x24, 0x92, 0x2c, 0xc9, 0xa9, 0x51, 0x80, 0x63, 0x59, 0x48, 0x1f, 0xc0, 0xdd, 0xe5, 0xec,
+    0x1f, 0x47, 0xe1, 0x29, 0xda, 0x04, 0x8f, 0x20, 0x1c, 0x7b, 0x0a, 0x9f, 0x0c, 0x79, 0xab, 0xc1,
+    0x1b, 0xce, 0x9b, 0xe6, 0xce, 0xb9, 0xfd, 0xde, 0xfd, 0xf0, 0x17, 0xd2, 0x48, 0x2e, 0x59, 0x21,
+    0xd8, 0xd0, 0x13, 0x7d, 0xb3, 0x8c, 0x2b, 0x8b, 0x37, 0x1c, 0xd1, 0x1c, 0xdc, 0x2e, 0x6b, 0x90,
+    0xe8, 0x98, 0x2e, 0x5d, 0x31, 0x73, 0x14, 0xb3, 0xc5, 0xb3, 0x03, 0x99, 0x8e, 0xd9, 0x72, 0xb1,
+    0xb6, 0xd5, 0xbd, 0xf8, 0xaf, 0xf7, 0x1f, 0xe2, 0x0f, 0xcb, 0x5e, 0xa7, 0xea, 0x9b, 0x2a, 0x7a,
+    0x81, 0xe9, 0x76, 0x26, 0xb0, 0xaf, 0x25, 0x1b, 0x3d, 0x08, 0xa6, 0x51, 0x5a, 0x84, 0x3f, 0x10,
+    0xc1, 0xbe, 0xb2, 0x7d, 0x64, 0x59, 0x88, 0x57, 0xcf, 0xb2, 0x5d, 0x45, 0xba, 0xaf, 0xe1, 0xdc,
+    0x06, 0xb4, 0x8a, 0x31, 0x4e, 0xf9, 0x1c, 0xc8, 0x00, 0x7c, 0xa7, 0x12, 0x7b, 0x71, 0x20, 0x6d,
+    0x6f, 0x78, 0x1f, 0xab, 0xf5, 0x17, 0x5e, 0x37, 0xb0, 0x7b, 0xff, 0x12, 0x4d, 0xbd, 0x2b, 0x5b,
+    0x5d, 0x49, 0x71, 0xbd, 0xce, 0x2e, 0x81, 0xbc, 0xa7, 0x06, 0xf7, 0x83, 0xe0, 0x2c, 0x75, 0x00,
+    0xdd, 0x13, 0x3c, 0x7d, 0xf5, 0xc7, 0x71, 0xfc, 0xf7, 0xf9, 0xa2, 0x9c, 0xfe, 0x3f, 0x65, 0x75,
+    0x94, 0xda, 0x5d, 0x8d, 0x14, 0x4d, 0xd0, 0x56, 0x16, 0xe4, 0xbf, 0x72, 0xf1, 0x57, 0xc5, 0x85,
+    0xec, 0x03, 0x39, 0xc1, 0x1d, 0xbc, 0x78, 0xf9, 0x0f, 0x42, 0xab, 0x16, 0x34, 0xa6, 0xb4, 0x69,
+    0x47, 0x44, 0x69, 0x05, 0x8f, 0x39, 0xc9, 0xe1, 0x92, 0x6c, 0x6d, 0x8f, 0x22, 0x7e, 0xb9, 0xc4,
+    0xb3, 0x26, 0x84, 0x4c, 0xe4, 0xf0, 0x76, 0x26, 0x9f, 0x84, 0xd3, 0x4d, 0xa3, 0x9f, 0xba, 0x0b,
+    0x3a, 0xef, 0x79, 0x5b, 0x44, 0x4f, 0x87, 0xb0, 0x22, 0x83, 0x88, 0xfc, 0x56, 0x22, 0xd6, 0x4f,
+    0x27, 0x19, 0xa4, 0x72, 0x75, 0x72, 0xcb, 0x28, 0x63, 0x84, 0xfb, 0x3c, 0x72, 0xa1, 0x5e, 0xdf,
+    0x05, 0x9e, 0x6d, 0x78, 0x43, 0x8b, 0x83, 0xc5, 0x91, 0xf6, 0xbf, 0x16, 0x7c, 0x30, 0xd2, 0x9e,
+    0x60, 0x6c, 0x83, 0xa5, 0xf5, 0xc6, 0x68, 0x3e, 0x89, 0xb2, 0xe1, 0x4b, 0x75, 0xc4, 0x53, 0x17,
+    0x1f, 0x96, 0x44, 0x35, 0x3e, 0x8c, 0x5d, 0x63, 0x34, 0xc0, 0xaa, 0xcd, 0x9c, 0x45, 0xb8, 0x6b,
+    0x9d, 0x9f, 0xdb, 0xbe, 0xff, 0xb4, 0xa6, 0xe9, 0xd6, 0x8d, 0x83, 0x23, 0x49, 0x14, 0x7b, 0x79,
+    0x16, 0x1d, 0x20, 0x31, 0x8e, 0x0d, 0x8d, 0xf2, 0x93, 0x2b, 0x4d, 0xd1, 0xa4, 0xd9, 0x02, 0xd6,
+    0x3f, 0xa3, 0xcf, 0x82, 0xf5, 0xfa, 0x55, 0x75, 0x42, 0x34, 0x00, 0x2e, 0x98, 0xae, 0x50, 0xe2,
+    0x26, 0x7e, 0xbd, 0x56, 0x00, 0xc5, 0xb9, 0x71, 0x3f, 0x87, 0xc5, 0xec, 0xb0, 0x94, 0xa0, 0x3a,
+    0x6a, 0xb9, 0xd5, 0x92, 0xa3, 0xd9, 0x2d, 0x9b, 0x79, 0x5e, 0x32, 0xd9, 0x5a, 0xe7, 0xde, 0x33,
+    0x17, 0x8d, 0xab, 0x8b, 0xf9, 0x6d, 0xc8, 0xbd, 0x27, 0x60, 0x7b, 0x52, 0x1b, 0xe1, 0x38, 0x20,
+    0xb2, 0x5d, 0xc3, 0x49, 0x28, 0x46, 0x33, 0x8a, 0x37, 0x62, 0x47, 0xd8, 0x7d, 0xff, 0xc9, 0x9f,
+    0xc1, 0x8d, 0x9f, 0xa3, 0x55, 0xfa, 0xf3, 0x8e, 0x21, 0xaa, 0x3c, 0x33, 0x18, 0xf4, 0x0a, 0xb5,
+    0xcd, 0x37, 0x59, 0xce, 0xd1, 0x1e, 0x9c, 0x80, 0x23, 0x59, 0x34, 0xe4, 0x4c, 0xe4, 0x5c, 0x17,
+    0xe6, 0x6f, 0x7c, 0x46, 0xbc, 0xc2, 0xb1, 0x36, 0x12, 0x29, 0x7b, 0x17, 0x36, 0x49, 0xd9, 0x3d,
+    0x86, 0x38, 0x81, 0x1c, 0x12, 0x4c, 0x61, 0x9c, 0x22, 0x3c, 0xab, 0xa7, 0x6e, 0xdb, 0x73, 0xc4,
+    0x1b, 0xb2, 0x47, 0xf3, 0x4d, 0x87, 0x1b, 0x30, 0x8b, 0xc0, 0x81, 0xc3, 0xe0, 0x60, 0x88, 0xbf,
+    0x88, 0x1c, 0x37, 0x32, 0xf2, 0x93, 0x23, 0x87, 0x48, 0x92, 0xb0, 0xe1, 0xc5, 0x91, 0x77, 0x68,
+    0xf9, 0x8a, 0x85, 0xb2, 0xa7, 0x89, 0x4b, 0x34, 0xfb, 0x5f, 0xb6, 0x3e, 0x90, 0xd7, 0xa8, 0x0e,
+    0x72, 0xcf, 0x75, 0x59, 0xf9, 0x7f, 0x2c, 0xe6, 0x34, 0xc7, 0x33, 0x5a, 0x48, 0x42, 0xd8, 0x34,
+    0x4c, 0xf5, 0xd9, 0x79, 0x0f, 0xd7, 0xde, 0xf0, 0xdd, 0x74, 0xfd, 0xec, 0x7a, 0x37, 0xe6, 0xfd,
+    0xb3, 0x2c, 0x78, 0x78, 0xe9, 0xed, 0x5e, 0x77, 0x59, 0x5f, 0x18, 0xd2, 0xa6, 0x2f, 0x43, 0xf4,
+    0xfa, 0xa9, 0x75, 0x87, 0xd2, 0x36, 0x02, 0x6d, 0xd7, 0x78, 0x57, 0x46, 0x51, 0xa8, 0x82, 0xe9,
+    0xc7, 0x65, 0xca, 0x51, 0x9c, 0x5f, 0x66, 0xb4, 0x5c, 0xea, 0x36, 0xe8, 0xf3, 0xbc, 0xbe, 0x48,
+    0x54, 0x7a, 0x17, 0x76, 0xd3, 0x9b, 0x22, 0xaa, 0x96, 0xf8, 0x3e, 0x42, 0xef, 0xa7, 0x7f, 0x66,
+    0x94, 0x39, 0x72, 0x28, 0xcf, 0x7a, 0xec, 0xde, 0x24, 0x14, 0x92, 0x5f, 0xa3, 0x55, 0xc1, 0x81,
+    0x98, 0x73, 0x9e, 0xe9, 0x08, 0xdb, 0x12, 0xb2, 0xdb, 0x40, 0x68, 0x34, 0x2b, 0x89, 0x95, 0xf7,
+    0xcd, 0x24, 0x1f, 0x80, 0x64, 0xc4, 0xdd, 0xf2, 0x39, 0xd0, 0x5a, 0xa0, 0x10, 0x21, 0x81, 0xef,
+    0x95, 0xd9, 0x03, 0xc6, 0xd9, 0x5b, 0xef, 0x3e, 0x29, 0xb8, 0x00, 0xd6, 0xc6, 0x8e, 0x17, 0x01,
+    0x72, 0xea, 0xd7, 0xce, 0x41, 0x1f, 0x1c, 0x96, 0xb0, 0x83, 0xa1, 0xa8, 0x7b, 0x29, 0xb1, 0x0d,
+    0xb8, 0x9e, 0xbf, 0x04, 0x0f, 0x5b, 0x5e, 0x98, 0x80, 0x3d, 0xdf, 0xbe, 0x47, 0x5b, 0xc3, 0xad,
+    0xaa, 0x9e, 0xcb, 0x33, 0xe4, 0xad, 0xa4, 0x66, 0x85, 0xe3, 0xba, 0x7d, 0xdd, 0x6a, 0x49, 0xf5,
+    0x8c, 0x85, 0x40, 0x45, 0xea, 0xb9, 0xb9, 0xd8, 0x4e, 0x4e, 0xc3, 0xe1, 0x62, 0x0b, 0xcd, 0x42,
+    0x70, 0xad, 0xa9, 0x5e, 0x97, 0xe4, 0xaf, 0x89, 0xba, 0x3f, 0xed, 0x90, 0x26, 0x34, 0xa4, 0x1f,
+    0xd0, 0x7b, 0xff, 0x13, 0x65, 0xe3, 0x7d, 0xd3, 0x38, 0xb0, 0x9c, 0x12, 0x7a, 0xe3, 0x75, 0x0f,
+    0xb7, 0x3e, 0xc1, 0xc9, 0xde, 0x6a, 0x92, 0xf9, 0xa5, 0xb3, 0x35, 0xbd, 0x5f, 0x83, 0x75, 0x46,
+    0x9e, 0x4e, 0xc6, 0x75, 0x24, 0x75, 0x6b, 0x18, 0xfe, 0x2f, 0x82, 0xf9, 0xc1, 0x31, 0x07, 0xaa,
+    0x39, 0x1a, 0xd6, 0xd9, 0xb9, 0x0c, 0xd0, 0x54, 0x16, 0x8d, 0xa3, 0x67, 0x83, 0x57, 0x53, 0xb8,
+    0x7b, 0xba, 0xd8, 0xe3, 0x59, 0x7e, 0x1a, 0x46, 0x53, 0x3b, 0x44, 0x50, 0xae, 0x3f, 0xde, 0x85,
+    0x8d, 0xcb, 0x0d, 0x75, 0x80, 0x05, 0xae, 0x6a, 0x43, 0x84, 0xcb, 0xb1, 0xbc, 0x4d, 0x4e, 0x09,
+    0x59, 0x63, 0x58, 0xc1, 0xf3, 0x9f, 0x70, 0x65, 0xd9, 0xaa, 0x51, 0x5c, 0x05, 0xbc, 0x7a, 0xc5,
+    0x44, 0xac, 0x78, 0x4a, 0xc9, 0x08, 0x40, 0x8f, 0x15, 0x85, 0xc1, 0x47, 0xdb, 0x15, 0x25, 0xdd,
+    0xc0, 0xcd, 0x7e, 0xb6, 0xca, 0x44, 0x3a, 0x4f, 0x1d, 0x65, 0xee, 0x95, 0xe7, 0x94, 0xa5, 0xe1,
+    0x54, 0x47, 0xfa, 0x44, 0x2b, 0x9f, 0x36, 0x25, 0x7b, 0xe7, 0x92, 0xc7, 0x26, 0x18, 0xfa, 0xdf,
+    0x5d, 0xd3, 0x5e, 0xe2, 0xbd, 0xaf, 0xf1, 0xfa, 0x9a, 0x67, 0x09, 0xcc, 0xc2, 0x05, 0xcb, 0xac,
+    0x56, 0xaa, 0x1b, 0xc2, 0xf0, 0x98, 0xcb, 0x9f, 0x3b, 0x5a, 0xed, 0xf8, 0x2e, 0x33, 0xb4, 0xa5,
+    0x21, 0x0d, 0x9a, 0xaf, 0x08, 0x6f, 0x4a, 0x0f, 0x49, 0xb1, 0xe0, 0x2c, 0xcc, 0x82, 0x5c, 0xa5,
+    0x73, 0x5d, 0x4f, 0x26, 0x68, 0x26, 0xb5, 0xfb, 0x14, 0x6e, 0x0d, 0xb7, 0x5a, 0xe9, 0x81, 0x2d,
+    0x76, 0x27, 0x35, 0xdf, 0x35, 0x07, 0xc9, 0x4c, 0x1c, 0xef, 0x49, 0x42, 0xf3, 0x59, 0x7f, 0x1d,
+    0x80, 0xc8, 0x82, 0x6e, 0xb8, 0xa4, 0xa8, 0xb1, 0x90, 0x9e, 0x65, 0x6b, 0x90, 0x50, 0x40, 0x81,
+    0x9b, 0xb0, 0xd8, 0x75, 0x41, 0x96, 0xb1, 0xd4, 0x05, 0x27, 0x88, 0xc1, 0x37, 0x1c, 0x1f, 0x10,
+    0x64, 0x2c, 0x44, 0x70, 0xa0, 0xec, 0x33, 0x7a, 0xb2, 0x42, 0x76, 0x53, 0x3c, 0x93, 0x30, 0xd4,
+    0x19, 0x42, 0x56, 0x5f, 0x69, 0xbf, 0x6b, 0xd0, 0x9f, 0x2d, 0x3a, 0x7e, 0x11, 0x19, 0xf8, 0x70,
+    0x81, 0x11, 0xe9, 0xe3, 0xdf, 0x7a, 0x93, 0xf9, 0xbb, 0xa7, 0xa0, 0xdf, 0x53, 0xb2, 0x72, 0xe3,
+    0x18, 0x0e, 0x52, 0x3a, 0xb6, 0xcd, 0xc1, 0x3b, 0xd4, 0x39, 0x49, 0x2f, 0x56, 0xea, 0x59, 0x9d,
+    0x28, 0x56, 0x1e, 0x67, 0x84, 0xee, 0x67, 0x9e, 0x1c, 0x8e, 0x38, 0x2a, 0x5a, 0x55, 0xd8, 0xf0,
+    0x25, 0x5d, 0xb8, 0xda, 0x3d, 0xed, 0x58, 0x33, 0x67, 0x12, 0x3c, 0x81, 0xa6, 0xf7, 0xae, 0x66,
+    0x8c, 0x9b, 0x78, 0x90, 0x03, 0xd4, 0xa7, 0x6e, 0xa6, 0x23, 0x40, 0xf1, 0x40, 0xaf, 0x88, 0xeb,
+    0xf9, 0xd9, 0x89, 0x09, 0xbf, 0x94, 0x18, 0x9e, 0x04, 0xe4, 0xa0, 0xc6, 0x0d, 0x9e, 0xe1, 0xac,
+    0x68, 0x52, 0x8b, 0x58, 0xa9, 0x03, 0x8c, 0xca, 0x8e, 0x82, 0x16, 0x4b, 0xca, 0xdf, 0x24, 0xd4,
+    0x19, 0xb2, 0x35, 0x84, 0x6a, 0x03, 0x9e, 0xb9, 0x6e, 0x6b, 0x02, 0x79, 0x66, 0xa6, 0x28, 0x64,
+    0x5c, 0x3e, 0xe7, 0x11, 0xf1, 0xa5, 0x4d, 0xdd, 0xaa, 0x0e, 0x0a, 0xdc, 0xb4, 0xc9, 0x91, 0x75,
+    0xf0, 0x75, 0x21, 0xf4, 0x7f, 0x17, 0xcd, 0x0b, 0x09, 0x34, 0xd5, 0x88, 0x07, 0x70, 0x49, 0x90,
+    0x4a, 0x35, 0x3b, 0x09, 0x85, 0x45, 0x95, 0xdc, 0x19, 0x80, 0x99, 0x89, 0x9c, 0x43, 0x63, 0xda,
+    0x5d, 0x38, 0x3b, 0xef, 0xf9, 0xb5, 0x38, 0x56, 0xeb, 0x8c, 0x11, 0xdd, 0x3a, 0x64, 0xe5, 0xa1,
+    0x38, 0x02, 0x4f, 0xde, 0x6c, 0x17, 0xe5, 0x18, 0x05, 0x32, 0x9e, 0xa6, 0x0a, 0x23, 0x80, 0xfd,
+    0x9e, 0x94, 0xd4, 0x09, 0xc1, 0xda, 0x04, 0xee, 0xb7, 0x46, 0x8f, 0xc8, 0x2f, 0x04, 0xe0, 0xaa,
+    0xe4, 0x51, 0x42, 0xe4, 0xf5, 0x0d, 0x45, 0xb1, 0x39, 0x5f, 0x7d, 0xf3, 0xd0, 0x77, 0xa5, 0x6b,
+    0x0d, 0xd8, 0xad, 0x8d, 0x55, 0x0c, 0xc2, 0x9b, 0xf6, 0x4f, 0xa8, 0x39, 0xca, 0x95, 0xfa, 0x56,
+    0xa9, 0xf9, 0x73, 0x89, 0x39, 0x5c, 0x17, 0x16, 0x63, 0xb9, 0x32, 0x70, 0xdb, 0x33, 0x0d, 0x1d,
+    0x34, 0x3c, 0xea, 0xb9, 0x9b, 0x27, 0x28, 0xe6, 0x51, 0xc2, 0x49, 0x88, 0xa9, 0xc7, 0x72, 0xa6,
+    0xc8, 0x28, 0x83, 0x50, 0x8c, 0x78, 0x2e, 0x8d, 0x30, 0xd0, 0x04, 0x64, 0x3b, 0xa9, 0xe0, 0x63,
+    0x72, 0xc8, 0xb8, 0x54, 0x6b, 0xe0, 0x0c, 0x11, 0xe0, 0x3d, 0x13, 0x20, 0x33, 0xa5, 0xea, 0x68,
+    0x8f, 0x33, 0xb5, 0xcc, 0xf5, 0x49, 0xd6, 0xa6, 0x63, 0x4c, 0xd7, 0x60, 0x43, 0x13, 0xf7, 0x59,
+    0xdf, 0xbd, 0x12, 0x9a, 0xc4, 0x69, 0x68, 0x22, 0x9f, 0x13, 0x34, 0x77, 0xc1, 0xe7, 0xae, 0x8a,
+    0x84, 0xfd, 0x5f, 0x4c, 0x7c, 0x98, 0xb3, 0xcc, 0xb0, 0x00, 0xc8, 0x07, 0x13, 0x1b, 0x85, 0x35,
+    0x8e, 0x27, 0x70, 0x66, 0xe6, 0x20, 0xf4, 0xc7, 0x1f, 0x93, 0x31, 0x31, 0x67, 0x67, 0xe6, 0xd0,
+    0x37, 0x15, 0x49, 0x1c, 0x13, 0x1d, 0xe3, 0x83, 0x0e, 0xe9, 0x1f, 0x65, 0x47, 0xb1, 0x21, 0xcb,
+    0x9d, 0x69, 0x78, 0x0b, 0xb1, 0x37, 0xd5, 0xeb, 0xd4, 0x70, 0xdb, 0x53, 0x1d, 0x2d, 0xad, 0x31,
+    0xb1, 0xca, 0x51, 0x9f, 0x2e, 0x08, 0x45, 0xee, 0xdb, 0x1c, 0xe2, 0xe9, 0x13, 0x08, 0xe9, 0x34,
+    0xc6, 0x2c, 0x57, 0xcf, 0x75, 0x63, 0xd3, 0x8b, 0x58, 0x3e, 0x14, 0x0e, 0x6e, 0xf8, 0xfa, 0xe6,
+    0x11, 0xb2, 0xd7, 0x31, 0xc3, 0x52, 0x63, 0x74, 0xd2, 0x98, 0xb2, 0xdd, 0xce, 0xb5, 0x60, 0x13,
+    0x01, 0xc8, 0x56, 0x53, 0x86, 0x2d, 0x74, 0x47, 0x01, 0x28, 0x41, 0x91, 0x89, 0x70, 0xcb, 0xe2,
+    0x34, 0x90, 0x48, 0x77, 0x74, 0x14, 0x3d, 0xc8, 0xf5, 0xbe, 0x92, 0x61, 0x72, 0x8a, 0x5f, 0x1e,
+    0x46, 0x83, 0x50, 0xad, 0x91, 0x56, 0x52, 0xfb, 0x2d, 0x36, 0xf6, 0x40, 0xd4, 0x66, 0x82, 0x16,
+    0x1b, 0x1c, 0xe6, 0x2a, 0xd9, 0x00, 0x43, 0x85, 0x52, 0x73, 0x91, 0x37, 0x7b, 0xa6, 0xb1, 0xe1,
+    0x1c, 0x0c, 0x4f, 0x85, 0x65, 0xed, 0x04, 0xe9, 0xe9, 0x11, 0xcf, 0x10, 0x0c, 0xb9, 0x96, 0x53,
+    0xd4, 0x9a, 0x11, 0x60, 0xcb, 0x9c, 0xd9, 0x4b, 0xcc, 0xf7, 0x33, 0xd2, 0xcf, 0x64, 0xc8, 0x4c,
+    0x5c, 0x7f, 0x34, 0x42, 0x80, 0x18, 0x3c, 0xb6, 0xec, 0x87, 0x61, 0xbd, 0xa1, 0x0c, 0x57, 0x30,
+    0x4c, 0x2b, 0x8b, 0xba, 0x22, 0xb1, 0xd5, 0xa1, 0x58, 0x03, 0x2b, 0x27, 0x29, 0x92, 0x72, 0x4f,
+    0x6d, 0xa1, 0x32, 0x03, 0x02, 0x0c, 0xa3, 0x79, 0x0c, 0xbd, 0x2d, 0x10, 0x09, 0xd0, 0x1e, 0x09,
+    0x49, 0xd7, 0x42, 0x2a, 0x7f, 0x86, 0xb9, 0x7b, 0x59, 0xe0, 0x77, 0xd4, 0xb1, 0x5a, 0x3d, 0xea,
+    0x56, 0xd2, 0x1c, 0x2f, 0x42, 0x5e, 0x30, 0xee, 0xd0, 0x3a, 0x4d, 0x71, 0x0b, 0xc7, 0x89, 0xb0,
+    0x37, 0xda, 0x7c, 0xe3, 0xe6, 0x8e, 0x1c, 0x12, 0x9d, 0xe9, 0xd5, 0x5c, 0x2c, 0x12, 0x41, 0x8e,
+    0xde, 0x31, 0xe9, 0x83, 0x1c, 0x4a, 0x04, 0x50, 0xa0, 0xe9, 0x13, 0x54, 0xc4, 0x34, 0xd1, 0x22,
+    0xc7, 0xb3, 0xab, 0xcc, 0xb7, 0x08, 0xda, 0x14, 0xc1, 0x76, 0x99, 0x82, 0xd0, 0x2a, 0xe9, 0x80,
+    0x8f, 0x38, 0x83, 0x2f, 0x86, 0x33, 0x05, 0x96, 0xe5, 0x95, 0x20, 0x4a, 0x75, 0xa0, 0x72, 0xae,
+    0xee, 0xc9, 0x63, 0x0b, 0x96, 0xd1, 0x81, 0xa2, 0xc1, 0x59, 0x1d, 0x37, 0xe5, 0xb1, 0x8b, 0xda,
+    0xf4, 0x72, 0x62, 0xd8, 0xa6, 0x80, 0x96, 0x19, 0xb8, 0x4c, 0x7b, 0x13, 0x0e, 0xc6, 0xb8, 0x93,
+    0x1e, 0x4a, 0x3d, 0x0b, 0x10, 0xe4, 0x0d, 0x9d, 0x13, 0x46, 0x79, 0x84, 0x8f, 0xba, 0x24, 0x4d,
+    0x52, 0x81, 0xbf, 0x92, 0xe0, 0xd9, 0x39, 0x5b, 0x04, 0xc4, 0x71, 0xe8, 0x8a, 0x0e, 0x98, 0x14,
+    0xfa, 0xdc, 0x2d, 0x9e, 0x9f, 0xb9, 0x36, 0xb6, 0x86, 0x23, 0x94, 0x41, 0x89, 0x68, 0x9c, 0xe2,
+    0x18, 0xbf, 0x69, 0x47, 0xc7, 0x03, 0x14, 0x8b, 0x45, 0x96, 0x63, 0xc6, 0x45, 0x97, 0x73, 0xc3,
+    0x5b, 0x69, 0xad, 0x79, 0xce, 0xb0, 0x85, 0x18, 0x7f, 0x73, 0xc8, 0xcb, 0x2b, 0xbc, 0x73, 0xa4,
+    0x05, 0xfc, 0x3a, 0x2f, 0xc4, 0x02, 0x96, 0xdc, 0x34, 0x74, 0xc2, 0xb5, 0x1b, 0x42, 0xac, 0x72,
+    0x38, 0xe0, 0x58, 0xb1, 0xe4, 0xe9, 0x12, 0xd0, 0x44, 0x0e, 0x4d, 0xe0, 0x5c, 0x29, 0xd0, 0x00,
+    0x41, 0x7c, 0x91, 0x27, 0xdb, 0xe7, 0x60, 0x84, 0x99, 0xa1, 0xa5, 0x9d, 0xba, 0x2c, 0xcf, 0x55,
+    0x85, 0x53, 0x66, 0xaf, 0x83, 0xe3, 0x4d, 0x90, 0x9b, 0xf1, 0xc9, 0x47, 0x4f, 0x4d, 0x03, 0xc8,
+    0xbe, 0x8f, 0x6e, 0xc1, 0x5a, 0xd8, 0xa3, 0xb3, 0x55, 0x2d, 0x21, 0x72, 0x8c, 0xd6, 0x38, 0x20,
+    0x29, 0xe3, 0xf3, 0x26, 0x08, 0x9b, 0x0e, 0xae, 0x15, 0x81, 0xe6, 0xe1, 0x41, 0x51, 0x83, 0xe6,
+    0x2a, 0x0e, 0x28, 0x9e, 0x8e, 0x10, 0x6e, 0x09, 0x3c, 0xa9, 0x00, 0x29, 0x53, 0x6e, 0x3c, 0xdc,
+    0x55, 0x7f, 0x15, 0x80, 0xae, 0x8b, 0x38, 0x53, 0x5b, 0xc7, 0x70, 0xa9, 0xfa, 0xae, 0xad, 0x73,
+    0xed, 0x3d, 0x87, 0x02, 0x47, 0xc5, 0x70, 0x2c, 0x1a, 0x6f, 0x53, 0x8c, 0x46, 0x6a, 0x25, 0x15,
+    0x2a, 0xaa, 0xef, 0x45, 0xcf, 0x95, 0xce, 0xfa, 0x8a, 0x4a, 0x86, 0xd7, 0x22, 0x65, 0xea, 0xa3,
+    0x50, 0x24, 0x30, 0x9a, 0x0f, 0x08, 0x07, 0x36, 0xcd, 0x0f, 0x0a, 0x0a, 0xa1, 0x57, 0xc2, 0xc3,
+    0x1d, 0xdd, 0x68, 0x6d, 0xd1, 0x4b, 0x6e, 0xbc, 0x3f, 0x33, 0x64, 0x8d, 0x94, 0x03, 0xe2, 0xb6,
+    0xb9, 0x21, 0x2e, 0xa2, 0x67, 0x19, 0x00, 0xf1, 0x88, 0x86, 0x70, 0x5c, 0x2b, 0xf0, 0xec, 0xef,
+    0x7d, 0x6a, 0x21, 0x90, 0xa4, 0x00, 0xd1, 0x5f, 0x89, 0xc7, 0x40, 0x05, 0xd4, 0xdc, 0xcb, 0x97,
+    0xd1, 0x03, 0xc2, 0x99, 0x60, 0xf4, 0xc5, 0x6e, 0xcf, 0x49, 0xac, 0xa3, 0x2b, 0xc7, 0x57, 0x91,
+    0xde, 0xc7, 0x98, 0x2d, 0x29, 0x9f, 0x10, 0x9f, 0x67, 0x49, 0x29, 0xdb, 0x0f, 0xa7, 0x22, 0x40,
+    0xa1, 0xcc, 0x64, 0x09, 0x4f, 0xa0, 0xa3, 0x23, 0x5e, 0x0d, 0x61, 0xd1, 0x0c, 0xc0, 0x69, 0x22,
+    0x57, 0x5a, 0xc8, 0xc0, 0x90, 0xd0, 0x02, 0xf9, 0x34, 0x66, 0x24, 0x81, 0x01, 0x03, 0x67, 0x91,
+    0x52, 0x88, 0x97, 0x19, 0xdc, 0xa8, 0xee, 0x59, 0x0a, 0x87, 0xa0, 0x41, 0xe1, 0x94, 0xe6, 0xac,
+    0x9d, 0x0e, 0x93, 0xbb, 0x3f, 0x01, 0x54, 0x90, 0x6b, 0xc4, 0xac, 0x6c, 0x0d, 0x22, 0x55, 0xe3,
+    0x93, 0x31, 0xce, 0x89, 0xa7, 0x35, 0x34, 0x73, 0x2f, 0x91, 0x48, 0x17, 0xb3, 0x7f, 0x62, 0x91,
+    0x43, 0xb2, 0xd1, 0xbe, 0xb4, 0x49, 0xd6, 0x66, 0x31, 0x87, 0x0c, 0xce, 0xe7, 0x8c, 0x65, 0xcb,
+    0xeb, 0x6e, 0x8a, 0xe4, 0x5b, 0xb1, 0x4f, 0x27, 0x85, 0xcd, 0x05, 0x78, 0x89, 0xd7, 0xb0, 0x15,
+    0xf0, 0xbe, 0x4d, 0xc2, 0x39, 0xbf, 0x43, 0x67, 0xc1, 0xb5, 0x87, 0x32, 0xd9, 0x52, 0xf8, 0xb8,
+    0x74, 0xfc, 0x0c, 0xf1, 0x16, 0xa4, 0x93, 0xec, 0x70, 0xaf, 0x9a, 0x46, 0x90, 0xd3, 0xf1, 0x7e,
+    0x22, 0x09, 0xe0, 0xcc, 0x42, 0x99, 0x17, 0x7b, 0xf8, 0x6e, 0x31, 0xef, 0x91, 0x6f, 0x73, 0xb4,
+    0xfe, 0x19, 0x98, 0x76, 0xbc, 0x5c, 0xfb, 0x2e, 0x94, 0x72, 0x93, 0x9f, 0xcf, 0xb1, 0x8f, 0x07,
+    0xc5, 0xea, 0x2e, 0xf9, 0x15, 0x28, 0xf0, 0xe2, 0x7f, 0x9d, 0xb2, 0x79, 0x60, 0xaf, 0xd9, 0x75,
+    0x98, 0x15, 0x93, 0x02, 0x3c, 0x6b, 0xd0, 0x7c, 0x25, 0x4f, 0xc9, 0x37, 0x27, 0xd4, 0x32, 0x39,
+    0x5b, 0x89, 0xe7, 0x81, 0x61, 0x9d, 0xa5, 0x1b, 0xb6, 0x61, 0x7b, 0xd8, 0x13, 0x44, 0x89, 0x50,
+    0xb0, 0x00, 0xad, 0x46, 0xa6, 0x54, 0x25, 0xb3, 0xd4, 0x3c, 0x01, 0x1c, 0xf5, 0x66, 0xcf, 0x34,
+    0x36, 0x29, 0xce, 0x8f, 0xf8, 0x2b, 0x2d, 0xd3, 0x96, 0x1f, 0xf1, 0xb8, 0xfc, 0x0c, 0xca, 0x18,
+    0x5d, 0xa3, 0x10, 0xf2, 0x33, 0x18, 0xea, 0xe7, 0xc5, 0x00, 0xf7, 0x70, 0x76, 0xf0, 0xcc, 0xca,
+    0x01, 0x29, 0x97, 0xe3, 0x58, 0x64, 0x26, 0x10, 0xbd, 0xc9, 0xfb, 0x5c, 0xaf, 0xec, 0xdf, 0x8b,
+    0x7b, 0xdf, 0xce, 0xf2, 0x67, 0x29, 0x5b, 0xb4, 0x23, 0x1b, 0xde, 0x73, 0x2e, 0xdc, 0xeb, 0x21,
+    0x8e, 0x19, 0xf2, 0x38, 0xce, 0x2d, 0x1a, 0x0c, 0x3f, 0x8a, 0xe0, 0x1c, 0xfa, 0x2f, 0xe4, 0xf4,
+    0xfa, 0x76, 0x80, 0xf5, 0x92, 0xe3, 0x29, 0x54, 0x8b, 0x44, 0xd1, 0x99, 0xaf, 0x57, 0x11, 0x12,
+    0xd4, 0xc0, 0x67, 0xcb, 0xd9, 0x02, 0x84, 0x9c, 0x95, 0x21, 0x37, 0x1b, 0xae, 0x4e, 0xbe, 0x66,
+    0x67, 0xf0, 0x4a, 0x7e, 0x6f, 0xb8, 0x64, 0xda, 0xbf, 0x89, 0xa6, 0x6c, 0x4a, 0x86, 0xc9, 0x87,
+    0x6c, 0x60, 0x44, 0x05, 0xd9, 0x66, 0x71, 0x43, 0xcb, 0xe3, 0x80, 0x5c, 0x35, 0x3e, 0xd1, 0x58,
+    0x8c, 0x13, 0x14, 0x5e, 0xfb, 0xf9, 0xa7, 0x1a, 0x22, 0x01, 0x26, 0xc1, 0xc3, 0x38, 0x41, 0xa4,
+    0x1d, 0x0e, 0x46, 0x2f, 0x24, 0x57, 0x8a, 0xe5, 0x4a, 0x1e, 0x57, 0x21, 0xf0, 0x0e, 0x25, 0x5f,
+    0xf8, 0xc8, 0x97, 0xe7, 0x0c, 0x9f, 0x1b, 0x88, 0xd7, 0xb1, 0xaf, 0x2c, 0x5d, 0xfb, 0xfd, 0x46,
+    0x0c, 0xb0, 0x1d, 0x9a, 0x97, 0x73, 0x24, 0xc4, 0x95, 0xf9, 0x2e, 0x3f, 0x8c, 0xe6, 0x19, 0x33,
+    0xdc, 0x68, 0x4e, 0x93, 0x74, 0x09, 0xb4, 0xaf, 0x01, 0xba, 0x9a, 0x5c, 0xa6, 0x18, 0x3e, 0x1b,
+    0x91, 0x78, 0xb3, 0x17, 0x1b, 0xb1, 0xcd, 0x9d, 0x10, 0x49, 0x4a, 0xa4, 0xd0, 0xa9, 0x48, 0xce,
+    0x54, 0x9f, 0x4f, 0x72, 0x4a, 0x07, 0xc7, 0xf9, 0x9d, 0x2b, 0x94, 0x03, 0xb8, 0x94, 0x96, 0xd7,
+    0xf9, 0x2a, 0x67, 0xc0, 0x22, 0xde, 0x07, 0x9d, 0xd1, 0x32, 0xa0, 0x17, 0x53, 0xc0, 0x18, 0x08,
+    0x52, 0x44, 0xe7, 0x13, 0xab, 0x74, 0x02, 0xe4, 0x14, 0xc0, 0x35, 0x77, 0x92, 0x8c, 0x2a, 0x1d,
+    0x0b, 0xd2, 0x5a, 0xf8, 0xd5, 0x5b, 0x57, 0xb5, 0xcf, 0x2f, 0x4c, 0x71, 0xfc, 0x4a, 0xd1, 0x98,
+    0xeb, 0x30, 0xeb, 0x64, 0x56, 0x23, 0x0a, 0x5e, 0x63, 0x6d, 0x82, 0x48, 0xaa, 0x79, 0xdb, 0xf9,
+    0x76, 0x99, 0x90, 0x43, 0xf0, 0xf4, 0x6b, 0xe4, 0xc7, 0x0f, 0xbe, 0x51, 0xab, 0xf6, 0x97, 0xad,
+    0xa9, 0xb7, 0x47, 0xb4, 0x33, 0x38, 0xf6, 0x6a, 0x07, 0xda, 0xfc, 0x0f, 0x1e, 0xe4, 0x07, 0xf1,
+    0xb2, 0xc8, 0x38, 0xc6, 0x40, 0xf8, 0x2b, 0xc6, 0xec, 0x7d, 0x60, 0x6b, 0x53, 0xab, 0x58, 0x90,
+    0xe2, 0xb5, 0x35, 0x17, 0xca, 0x22, 0x6c, 0xd6, 0x40, 0xd3, 0x55, 0xe1, 0x97, 0xab, 0x48, 0x4f,
+    0x6e, 0x8f, 0x7e, 0x17, 0x77, 0xf4, 0x60, 0x7c, 0xdc, 0x5f, 0x08, 0xdb, 0x92, 0xeb, 0x20, 0x6d,
+    0x0d, 0x90, 0x18, 0x09, 0xd3, 0x51, 0x56, 0x73, 0x73, 0xc6, 0x22, 0x8d, 0x6a, 0x05, 0x57, 0x9c,
+    0xa6, 0x45, 0xe1, 0x80, 0x7d, 0x15, 0x1e, 0x04, 0xb6, 0x59, 0x8e, 0x0f, 0x49, 0xc3, 0xc1, 0x18,
+    0x59, 0x53, 0xa3, 0x03, 0x83, 0x4c, 0x33, 0x57, 0x0c, 0x60, 0x63, 0x41, 0x77, 0xb7, 0x01, 0xd4,
+    0xca, 0x58, 0x18, 0x88, 0xc7, 0x93, 0x9f, 0x6a, 0x1b, 0x07, 0x63, 0xec, 0xba, 0x86, 0x5c, 0x54,
+    0xbb, 0xb3, 0xc6, 0xe9, 0xd8, 0x01, 0xe4, 0x95, 0x9c, 0x0c, 0xf2, 0xc1, 0x12, 0x81, 0xac, 0xa3,
+    0x55, 0x6c, 0xf8, 0x35, 0x28, 0x55, 0xc0, 0x98, 0x58, 0xca, 0x82, 0xde, 0xf0, 0x4b, 0x2f, 0x5b,
+    0x6c, 0xd1, 0xa5, 0x50, 0xda, 0xdd, 0x3c, 0x2a, 0xb8, 0x24, 0xd6, 0xab, 0x77, 0x11, 0xeb, 0x98,
+    0x56, 0x0b, 0xba, 0xc3, 0xf0, 0x2d, 0xa8, 0x22, 0xc3, 0x55, 0x8f, 0xb4, 0x71, 0x2c, 0x31, 0x87,
+    0x3b, 0xb2, 0xce, 0xb2, 0xc4, 0x19, 0x48, 0x8b, 0xd4, 0x4a, 0x67, 0x6b, 0x89, 0x18, 0x51, 0xc2,
+    0x5b, 0x9c, 0x1c, 0x88, 0xe5, 0x33, 0x37, 0x8d, 0x88, 0x9e, 0x6b, 0x38, 0x30, 0xd8, 0xe7, 0xf8,
+    0x66, 0x24, 0xeb, 0x8b, 0xb6, 0xcd, 0x28, 0xd0, 0xb7, 0x1c, 0x22, 0x75, 0x59, 0xc9, 0xd1, 0xe1,
+    0x18, 0x74, 0xba, 0x77, 0x9a, 0xac, 0xba, 0x5b, 0x21, 0x0c, 0x2f, 0x2f, 0x27, 0xb1, 0x80, 0x38,
+    0xed, 0x0a, 0x05, 0x8d, 0xc7, 0x4b, 0x29, 0x1b, 0xe0, 0x27, 0x1d, 0xcb, 0xcb, 0x38, 0x15, 0x0b,
+    0x15, 0xa0, 0xb4, 0xd2, 0x63, 0xdd, 0x82, 0xfd, 0x2f, 0xc3, 0xca, 0xe0, 0xa5, 0xde, 0xac, 0xbd,
+    0xef, 0x7a, 0x6e, 0x4d, 0xf1, 0x6a, 0xe7, 0x71, 0xcf, 0x46, 0x8f, 0x31, 0xec, 0x22, 0x2b, 0x98,
+    0xd1, 0x48, 0x38, 0x06, 0xe9, 0x01, 0xd8, 0xc8, 0xa8, 0xd1, 0x97, 0xd8, 0x51, 0xc2, 0x2d, 0x76,
+    0x23, 0x6e, 0x5a, 0xc6, 0xe0, 0x34, 0x2b, 0xd1, 0x0d, 0xad, 0x3e, 0x19, 0xb9, 0x4b, 0x38, 0x1e,
+    0x16, 0x70, 0x0e, 0x74, 0x45, 0x21, 0x9a, 0x82, 0xe2, 0x10, 0x8c, 0x0c, 0x8f, 0x18, 0x7d, 0xc0,
+    0xec, 0xcc, 0xd5, 0x37, 0xea, 0xa4, 0x7e, 0x1f, 0xa1, 0x65, 0x5a, 0x0e, 0xca, 0xd8, 0x69, 0x73,
+    0x2b, 0xc1, 0x1c, 0x09, 0x98, 0x09, 0x4a, 0xd9, 0xd5, 0x67, 0x4c, 0xb8, 0xde, 0x25, 0x40, 0xc7,
+    0xd6, 0xca, 0x9a, 0x30, 0x21, 0x78, 0x39, 0xee, 0x02, 0x47, 0xc3, 0xb5, 0x41, 0xc7, 0x90, 0x11,
+    0x24, 0x33, 0x36, 0x93, 0xa9, 0x25, 0xd6, 0x8b, 0x9b, 0x49, 0xb0, 0x7a, 0x0d, 0x4b, 0x02, 0xa2,
+    0xec, 0xa4, 0xe5, 0x87, 0x9a, 0xe5, 0xaa, 0x87, 0x1f, 0x04, 0x32, 0x78, 0x2b, 0xd3, 0x73, 0x97,
+    0xec, 0x12, 0x22, 0x93, 0x52, 0x08, 0x3f, 0x94, 0x50, 0x9d, 0x67, 0x65, 0x84, 0x20, 0x56, 0xe4,
+    0x08, 0xfc, 0xac, 0xae, 0x00, 0xf4, 0x67, 0x8f, 0xcf, 0x67, 0xd3, 0xc3, 0xb9, 0x18, 0xe7, 0x5c,
+    0xe6, 0x54, 0x5e, 0xbb, 0x81, 0x95, 0x56, 0x95, 0x83, 0xcb, 0x11, 0xe7, 0x24, 0x38, 0x33, 0xa7,
+    0x03, 0x45, 0xb8, 0x4a, 0xd5, 0xa6, 0x19, 0x9a, 0xa6, 0x2c, 0xba, 0x5e, 0x62, 0xc6, 0xe6, 0x17,
+    0xce, 0xb2, 0x4d, 0x87, 0x39, 0xab, 0x6f, 0x03, 0x57, 0x39, 0x69, 0xdb, 0x65, 0xe8, 0xd7, 0x33,
+    0x4c, 0xd2, 0x98, 0x22, 0x78, 0x7a, 0x5b, 0x04, 0x0d, 0x66, 0x54, 0xa4, 0x5e, 0x54, 0xa5, 0x15,
+    0x97, 0xc6, 0x82, 0xa6, 0x34, 0x09, 0x94, 0x24, 0x1e, 0x48, 0x93, 0x95, 0xaa, 0x6e, 0x47, 0xb8,
+    0x7a, 0x75, 0x2a, 0x8b, 0xa6, 0xca, 0xb6, 0x23, 0xb9, 0x6a, 0xa1, 0x14, 0xa4, 0x1e, 0x6c, 0x74,
+    0xc2, 0x26, 0x74, 0x00, 0x74, 0x19, 0x25, 0x77, 0x2d, 0x93, 0x66, 0x8d, 0x7a, 0xe9, 0x9c, 0xc2,
+    0x80, 0x5f, 0x82, 0x84, 0xc3, 0x95, 0xe1, 0x23, 0x93, 0x67, 0x09, 0x9c, 0xbd, 0x72, 0x1c, 0x02,
+    0xee, 0x57, 0x7e, 0xcc, 0x25, 0xbd, 0x54, 0x57, 0xb8, 0x64, 0x98, 0xee, 0xa6, 0xa9, 0x06, 0x8d,
+    0x98, 0xd7, 0x92, 0x99, 0xc6, 0x9f, 0x19, 0x85, 0x63, 0x6f, 0x32, 0xb4, 0xdd, 0x2a, 0x95, 0x49,
+    0x31, 0x18, 0x49, 0x70, 0x94, 0x01, 0x51, 0x6f, 0x25, 0x95, 0xa7, 0x43, 0x60, 0xf4, 0x11, 0x03,
+    0x7c, 0x5c, 0xef, 0x87, 0x61, 0x99, 0x7f, 0x63, 0x1b, 0xd8, 0x2d, 0xc4, 0x0d, 0x6e, 0xe9, 0x73,
+    0xd7, 0x9c, 0x23, 0x50, 0x99, 0xec, 0xe1, 0x7e, 0xa7, 0xff, 0x73, 0xee, 0x4f, 0xff, 0xfd, 0x9f,
+    0xf2, 0x7f, 0xb0, 0x2e, 0x8f, 0x7b, 0x15, 0x2f, 0x43, 0x4c, 0xda, 0x19, 0x72, 0x39, 0x92, 0x83,
+    0xf6, 0xfd, 0x9f, 0x81, 0xff, 0x23, 0x17, 0xff, 0xd1, 0xb3, 0xff, 0x3b, 0x84, 0x3f, 0xe8, 0xff,
+    0xdb, 0xff, 0xf4, 0x3f, 0xda, 0xff, 0xfd, 0x5f, 0x73, 0xff, 0xf4, 0xb9, 0xed, 0xdd, 0xf7, 0x79,
+    0x1a, 0x7f, 0xcd, 0x8f, 0xe7, 0x7f, 0x32, 0xb7, 0x37, 0xd3, 0xf3, 0xeb, 0x54, 0xfc, 0x3e, 0x8f,
+    0xfe, 0x27, 0xfd, 0xaf, 0xf4, 0xff, 0x8f, 0xe4, 0x1f, 0xea, 0x7f, 0xc0, 0x8b, 0xaf, 0xfa, 0xbf,
+    0xfc, 0xd2, 0xff, 0xfa, 0xdf, 0xf2, 0xbe, 0x6f, 0xe1, 0xfe, 0x17, 0x78, 0xde, 0xcf, 0xc7, 0xfe,
+    0xd7, 0xda, 0xff, 0xd9, 0xf9, 0xbf, 0xe0, 0x7e, 0x86, 0xff, 0x26, 0x57, 0xc7, 0xf8, 0xb7, 0x85,
+    0xf5, 0x3f, 0x99, 0xaf, 0xe9, 0xd2, 0xf3, 0x26, 0x33, 0x99, 0xc5, 0xff, 0xb7, 0xc8, 0xff, 0xfc,
+    0xaf, 0x2f, 0xff, 0xfc, 0xfd, 0xef, 0xfc, 0xac, 0x1e, 0xca, 0xd6, 0x7e, 0x7f, 0x4b, 0xfc, 0x0c,
+    0xde, 0xff, 0xa2, 0x87, 0xff, 0x4b, 0xc5, 0xff, 0x27, 0xff, 0x0a, 0xdf, 0xfe, 0x8f, 0xb1, 0xeb,
+    0x0d, 0x50, 0x25, 0x70, 0x73, 0x3e, 0x47, 0xf9, 0x3f, 0xfb, 0x7f, 0xf9, 0x9f, 0xfe, 0xd7, 0xfe,
+    0x4f, 0xff, 0x2f, 0xd8, 0xfb, 0x4d, 0x7c, 0xbe, 0xaf, 0xf9, 0x19, 0x5f, 0xc1, 0x8d, 0xee, 0x13,
+    0xb2, 0x4f, 0x70, 0x8f, 0xbf, 0xe8, 0xe1, 0x7e, 0xc2, 0x5e, 0x5e, 0x04, 0x9f, 0x4f, 0xf4, 0x3d,
+    0xae, 0x3d, 0x6e, 0x07, 0x37, 0xf7, 0xc3, 0xff, 0xf1, 0xbf, 0x4b, 0xfe, 0xff, 0xdd, 0xfe, 0x87,
+    0x63, 0xbb, 0xe5, 0xd1, 0xfc, 0x6f, 0xd4, 0xdf, 0xfb, 0x71, 0x75, 0xa1, 0xfe, 0x8c, 0x9f, 0x89,
+    0xa1, 0x16, 0xad, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66,
+    0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b,
+    0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c,
+    0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3,
+    0x66, 0xcd, 0x9b, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x35, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd,
+    0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5,
+    0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7,
+    0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e, 0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e,
+    0xbd, 0x7a, 0xf5, 0xeb, 0xd7, 0xaf, 0x5e, 0xad, 0x5a, 0xb5, 0x6a, 0xd5, 0xab, 0x56, 0xad, 0x5a,
+    0xb5, 0x6a, 0xd5, 0xab, 0x56, 0xad, 0x5a, 0xb5, 0x6a, 0xd5, 0xab, 0x56, 0xad, 0x5a, 0xb5, 0x69,
+    0xd3, 0xa7, 0x4e, 0x9d, 0x3a, 0x74, 0xe9, 0xd3, 0xa7, 0x4e, 0x9d, 0x3a, 0x74, 0xe9, 0xd3, 0xa3,
+    0x46, 0x8d, 0x1a, 0x34, 0x68, 0xd1, 0xa3, 0x46, 0x8d, 0x1a, 0x34, 0x67, 0xcf, 0x9f, 0x3e, 0x7c,
+    0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x36, 0x6c, 0xd9, 0xb3, 0x66, 0xcd, 0x9b, 0x36, 0x5c, 0xb9, 0x72,
+    0xe5, 0xcb, 0x97, 0x2e, 0x4c, 0x99, 0x32, 0x64, 0xc9, 0x93, 0x1e, 0x3c, 0x78, 0xf1, 0xe3, 0xc7,
+    0x8b, 0x16, 0x2c, 0x58, 0xb1, 0x61, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x30, 0x60, 0xc1, 0x82, 0xfb,
+    0xef, 0xbe, 0xfb, 0xae, 0xba, 0xeb, 0xad, 0xb6, 0xdb, 0x6d, 0xb2, 0xcb, 0x2c, 0xae, 0xba, 0xeb,
+    0xae, 0xaa, 0xaa, 0xaa, 0x9a, 0x69, 0xa6, 0x9a, 0x28, 0xa2, 0x8a, 0x27, 0x9e, 0x79, 0xe6, 0x9a,
+    0x69, 0xa6, 0x96, 0x59, 0x65, 0x96, 0x49, 0x24, 0x92, 0x49, 0x23, 0x8e, 0x38, 0xe3, 0x8e, 0x28,
+    0xa2, 0x8a, 0x28, 0xa2, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x08, 0x20, 0x82, 0x08, 0x20,
+    0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f,
+    0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c,
 };
 
 #endif // OPENHAT_SAMPLE_H
@@ -3,4462 +3,930 @@
 
 #include <stdint.h>
 
+// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).
 const int snare_sample_len = 44538;
-const int16_t snare_sample[] = {
-    -2129, -7331, -10405, -11335, -12200, -11912, -10311, -8443, -8776, -9593, 
-    -9270, -6671, -2541, -1975, -4603, -5769, -4018, 1316, 4987, 3827, 
-    1926, 1311, 2335, 2776, 1551, -26, -2932, -4788, -1912, 6143, 
-    11056, 9168, 6643, 5314, 4434, 4185, 4010, 2392, 1464, 3577, 
-    2342, -1438, -2270, 3838, 11111, 12803, 9655, 3187, 2973, 9386, 
-    12387, 10938, 8942, 10916, 11767, 9096, 5790, 2657, 3068, 4981, 
-    5668, 6261, 6743, 5824, 3203, 4615, 9424, 10150, 8126, 6718, 
-    5527, 4750, 3056, -875, -4784, -5658, -4130, -1998, 1373, 6496, 
-    8633, 7455, 5809, 3264, 805, -915, -3093, -6800, -9547, -9905, 
-    -8840, -6995, -4788, -2670, -1053, 415, 3511, 5608, 3830, -351, 
-    -6111, -6089, 384, 2137, -548, -3376, -5947, -7094, -7640, -7709, 
-    -7561, -7280, -6858, -6452, -5993, -6330, -7221, -5530, -2420, -2093, 
-    -2968, -3163, -3486, -3858, -5249, -5915, -3597, -1846, -3718, -7008, 
-    -9089, -9313, -8473, -7208, -5604, -4070, -2887, -1015, 3401, 6462, 
-    4041, 682, -878, -4077, -8114, -9673, -7808, -2705, -182, -4168, 
-    -7687, -7828, -7328, -6506, -5334, -3952, -2645, -1385, -500, -3, 
-    3128, 7919, 8075, 2676, -3520, -6131, -6196, -6111, -5383, -4753, 
-    -3719, 1666, 8092, 8362, 4579, -97, -2802, -3624, -4052, -3921, 
-    -3707, -3321, -2863, -2357, -1802, -2004, -3010, -3613, -1789, 3730, 
-    7701, 6140, 3695, 2526, 1617, 1093, -360, -2314, -3013, -442, 
-    5046, 7497, 5080, 2841, 1814, 1004, 356, -734, -704, -67, 
-    -766, 116, 3045, 2266, -654, 1004, 6070, 8292, 6345, 3933, 
-    2643, 1817, 1400, 1287, 992, 91, -56, 656, -53, 364, 
-    4151, 6427, 4592, 1215, -1399, -713, 4002, 7805, 7258, 5127, 
-    3453, 1183, -1432, -2747, -2579, -1680, -329, 1147, 2514, 3646, 
-    4440, 4935, 5174, 5335, 5290, 5182, 4811, 4486, 6545, 8945, 
-    8201, 5915, 1724, -1778, -3040, -3815, -4897, -5957, -6033, -5298, 
-    -4123, -2367, 2511, 7505, 6801, 3178, -79, 295, 4851, 6714, 
-    4416, 2225, 795, -1821, -4216, -4239, -3196, 464, 5469, 6231, 
-    4260, 2308, 19, -2478, -4697, -5263, -4649, -3521, -2143, -260, 
-    3287, 6299, 6118, 4428, 2413, -185, -3038, -4213, -1950, -366, 
-    -2536, -3948, -811, 3003, 3245, 714, -2509, -4596, -2826, 1665, 
-    3602, 2437, 917, -128, -760, -1108, -1305, -1360, -1340, -1293, 
-    -1244, -1171, -1115, -1097, -1059, -1484, -3126, -4776, -4991, -4274, 
-    -3067, -1887, -543, 2934, 5738, 4118, 509, -2946, -2398, 2055, 
-    3610, 1468, -868, -2504, -3415, -3814, -3992, -4736, -6058, -6513, 
-    -5953, -4923, -3664, -624, 4255, 5950, 3822, 918, -962, -482, 
-    -570, -1707, -2261, -2563, -2717, -2713, -2654, -2527, -2406, -2218, 
-    -1991, -2125, -2726, -2222, -483, 178, -321, -598, -824, -1692, 
-    -2153, -857, 468, 263, -734, -2419, -4048, -4416, -3929, -2959, 
-    -2097, -677, 3345, 6924, 6674, 3586, 40, -1321, -2502, -4400, 
-    -5128, -4161, -26, 3074, 452, -2583, -952, 1991, 2057, 1365, 
-    550, -1382, -1583, -1178, -1186, -913, -737, -775, -2178, -3440, 
-    -2921, 133, 4400, 3784, 1118, 2580, 3763, 1984, 435, -328, 
-    -838, -1032, -1060, -957, -843, -682, -499, -368, -727, -1169, 
-    -540, -377, -1662, -2208, -1604, -785, 251, 1257, 2069, 2645, 
-    3018, 3133, 3339, 5271, 7820, 7770, 5206, 2016, 7, -505, 
-    -1200, -2211, -3192, -4060, -4248, -3766, -2916, -1769, -513, 690, 
-    1736, 2545, 3141, 3265, 4319, 6974, 8174, 6923, 4318, 1450, 
-    -334, -1835, -3427, -4227, -4088, -3406, -2423, -1245, -153, 860, 
-    1721, 2415, 2862, 3140, 3298, 3321, 5066, 7483, 7226, 5034, 
-    2116, -301, -1369, -1959, -2189, -2191, -1999, -1634, -1275, -1408, 
-    -2307, -2830, -2438, -309, 3747, 5869, 4756, 3306, 2359, 1688, 
-    1282, 1002, 827, 702, 627, 572, 530, 523, 169, -932, 
-    -2142, -1549, 1541, 4211, 3946, 2496, 1561, 971, 637, 456, 
-    -217, -1640, -1732, 621, 2386, 2011, 936, -599, -2249, -2860, 
-    -2555, -1775, -947, -17, 2527, 5256, 5316, 3744, 1762, 178, 
-    -696, -1120, -1485, -2513, -3770, -4173, -3787, -3018, -1966, -911, 
-    -14, 659, 1173, 1492, 1696, 1584, 1962, 4091, 5347, 3955, 
-    1617, -816, -2284, -3361, -4675, -4832, -2782, -916, -1271, -2084, 
-    -2931, -4003, -4180, -3329, -493, 2906, 3219, 1649, 531, -177, 
-    -609, -897, -1042, -1075, -1131, -1220, -1301, -1370, -1440, -1637, 
-    -2177, -2344, -1779, -2014, -3086, -3411, -1904, 1220, 3007, 1965, 
-    -357, -2070, -1459, -274, -1302, -2998, -3366, -1388, 1544, 1361, 
-    -1268, -1914, 110, 675, -1398, -3106, -3137, -651, 2188, 1832, 
-    -4, -1262, -1827, -1824, -1812, -1973, -2191, -2294, -2078, -1843, 
-    -2016, -2656, -2510, -978, -593, -2188, -2337, 60, 1271, -555, 
-    -2556, -3157, -2355, 944, 3805, 2974, 466, -1874, -3051, -1877, 
-    871, 1738, 371, -640, -1076, -1408, -1710, -2536, -3068, -1840, 
-    -430, -1281, -2530, -2078, -112, 2095, 1766, 133, 933, 2394, 
-    1894, 532, -576, -1342, -1590, -1220, -588, -409, -1017, -2082, 
-    -2728, -2593, -2099, -1657, -1061, 1045, 4129, 5130, 3732, 2055, 
-    1210, 376, -599, -786, -1054, -1873, -2355, -1221, 1783, 3321, 
-    2269, 1014, 329, -147, -596, -1003, -1034, -794, -501, -179, 
-    149, 964, 2131, 2467, 1931, 1355, 733, -345, -560, 5, 
-    -820, -1001, 600, 1003, 696, 1453, 3092, 3657, 1784, -417, 
-    -815, 987, 3083, 2811, 1036, -513, -1269, -1170, -704, -43, 
-    719, 1342, 1695, 1862, 2282, 2527, 2253, 2493, 3034, 2492, 
-    1540, 2105, 4694, 6595, 4992, 1535, -401, -618, -1063, -2060, 
-    -2913, -3341, -3137, -2417, -1454, -423, 503, 1274, 1911, 2389, 
-    2670, 2809, 2908, 2987, 2871, 2773, 2341, 2640, 5588, 8108, 
-    6484, 2321, -1442, -3799, -5048, -5152, -4594, -3767, -2777, -1620, 
-    -590, 547, 2843, 4771, 4476, 3051, 1662, 793, 363, -95, 
-    -1016, -1744, -1870, -1084, 1119, 3148, 4172, 3758, 1115, -1575, 
-    -3298, -3555, -1986, -680, -512, -342, -76, 588, 2093, 2947, 
-    2795, 2214, 557, -1150, -1756, -2011, -2357, -2398, -1931, -1255, 
-    -583, 1390, 5234, 7465, 5934, 2519, -688, -1520, -396, -492, 
-    -1767, -2415, -2406, -1562, -405, 50, 716, 556, -1326, -2010, 
-    -1527, -1915, -2314, -2026, -514, 1601, 2212, 2653, 3965, 3829, 
-    2082, -211, -2452, -3278, -3293, -4060, -4730, -4808, -4833, -3005, 
-    250, 1155, 565, -196, -1126, -54, 1068, -112, -1158, -989, 
-    1088, 3965, 4045, 3174, 3372, 2614, 727, -1002, -2051, -2505, 
-    -2769, -2935, -3090, -3632, -4601, -5298, -5354, -4407, -2630, -1432, 
-    -976, -551, -199, -3, 32, -214, -678, -590, 574, 2784, 
-    4416, 3091, -57, -2241, -3285, -3969, -4458, -4825, -4920, -4479, 
-    -3906, -3881, -3766, -1910, 483, 1487, 1734, 1935, 2002, 1993, 
-    2068, 1362, 450, 1771, 3284, 2602, 1475, 1176, 1576, 1731, 
-    514, -1188, -2640, -4371, -5725, -6259, -6104, -5304, -4015, -1893, 
-    -18, 314, 79, -30, -150, -150, -129, -238, -349, -574, 
-    -782, -822, 212, 3412, 5444, 3355, 595, -776, -2228, -3161, 
-    -3110, -3683, -4498, -4339, -2658, 1259, 4172, 3248, 1503, 729, 
-    304, 66, -236, -386, -280, -854, -1620, -1327, -1360, -2409, 
-    -2393, 121, 4174, 5597, 3110, 1603, 2159, 1666, 772, 741, 
-    524, -43, -394, -679, -844, -581, -324, -742, -1506, -937, 
-    558, 373, -1086, -1234, -395, 27, 2110, 5959, 6906, 5066, 
-    3435, 1169, -1843, -2932, -303, 2942, 2567, 431, -697, -1684, 
-    -2157, -1186, -965, -1959, -2033, -400, 3635, 6268, 4275, 3380, 
-    4599, 3415, 1547, 782, 108, 1439, 5221, 6359, 3265, 1101, 
-    1050, 120, -1835, -3689, -4499, -4114, -3259, -2278, -1279, -438, 
-    286, 1073, 1771, 2087, 2176, 2063, 2857, 5975, 8480, 6897, 
-    2990, -246, -2018, -2390, -1897, -1453, -1330, -1159, -833, -396, 
-    44, 282, 389, 718, 1090, 815, 931, 2452, 3538, 3366, 
-    3015, 2715, 2752, 3116, 3062, 2006, -182, -2534, -3329, -709, 
-    3156, 3754, 2547, 2056, 1296, 307, -705, -2424, -4070, -4506, 
-    -3836, -2643, -1513, -635, 8, 537, 1074, 1465, 3617, 7245, 
-    7787, 3883, -961, -3383, -3492, -2991, -2652, -2031, 1146, 5290, 
-    5172, 1995, -352, -1628, -2675, -3606, -3021, -1295, -1055, -2490, 
-    -4053, -4368, -3345, -2269, -1512, -716, 147, 1052, 1921, 3724, 
-    6528, 7459, 5336, 2168, -563, -2302, -2900, -2948, -3023, -3192, 
-    -3726, -3943, -2671, -1309, -1632, -3185, -3762, -1184, 1838, 1284, 
-    -1150, -2625, -2580, 174, 3412, 2438, -898, -1238, 1483, 2052, 
-    -982, -2795, -494, 2207, 1617, -390, -1681, -2515, -2875, -3561, 
-    -4971, -5882, -5691, -3808, 774, 3702, 2352, 516, -608, -2186, 
-    -4018, -4884, -4624, -3831, -1058, 3245, 3505, -332, -1997, 316, 
-    2369, 1187, -807, -1730, -2323, -2680, -2900, -3013, -2760, -2270, 
-    -1920, -1826, -1742, -1650, -1608, -1519, -1340, -1117, -890, -668, 
-    -482, -353, -241, -158, -409, -556, -177, 1, -89, -122, 
-    -60, -418, -1993, -2883, -427, 3034, 3427, 1737, 491, -795, 
-    -2607, -3975, -4187, -3676, -2730, -1415, -369, 276, 416, 858, 
-    3828, 7037, 5195, 39, -3146, -4242, -4374, -3827, -2939, -2095, 
-    -1688, -1395, -1052, -720, -407, -134, 71, 275, 634, 590, 
-    2030, 6088, 7634, 4144, -165, -3318, -5450, -4785, -2703, -3007, 
-    -4499, -4425, -3418, -722, 4236, 6559, 3748, 268, -973, -946, 
-    -347, 381, 1654, 5158, 9027, 8815, 5432, 2576, 873, -149, 
-    -744, -1144, -1295, -1148, -1125, -1944, -3195, -3665, -3174, -2256, 
-    -1236, -217, 769, 1688, 2319, 2602, 2736, 2584, 3608, 7085, 
-    9354, 7379, 3569, 122, -1738, -1889, -2695, -4026, -3120, 653, 
-    3221, 2510, 1450, 1069, 696, -123, -1527, -2059, 153, 4121, 
-    4881, 2088, -285, -72, 3130, 5208, 3263, 1623, 1439, 1084, 
-    1642, 1867, 1102, 729, 526, -28, -539, 446, 1955, 1939, 
-    1512, 1467, 1423, 1295, 443, -794, -3, 2805, 3918, 2857, 
-    1956, 1456, 1040, 431, -404, -142, 1033, 1272, 611, -519, 
-    -2175, -2920, -765, 2970, 4316, 3022, 1759, 1077, 647, 437, 
-    341, 299, 319, 396, 495, 577, 661, 797, 932, 928, 
-    817, 695, 576, 461, 328, 238, -52, -919, -906, 430, 
-    833, 239, -102, -310, -365, -737, -2036, -3298, -3341, -2621, 
-    -1555, -550, 782, 4474, 8150, 7526, 4526, 2324, 818, -228, 
-    -1177, -2749, -3693, -1711, 1032, 848, -1216, -3233, -4330, -4220, 
-    -3602, -2833, -1997, -1317, -832, -534, -380, -328, -363, -445, 
-    -647, -170, 2649, 5524, 3715, -1671, -5662, -6926, -6829, -4681, 
-    -496, 1698, 558, -798, -1195, -1700, -2685, -1833, 832, 1739, 
-    353, -1551, -2759, -2847, -2396, -344, 3934, 6210, 4363, 865, 
-    -2257, -3951, -4270, -3970, -3487, -2929, -2400, -2107, -73, 4130, 
-    5232, 1133, -3519, -5769, -6334, -6074, -5395, -4538, -3614, -2749, 
-    -1955, -1283, -722, -266, 34, 322, 349, 1140, 4707, 7154, 
-    3765, 67, 286, -228, -2111, -3038, -3412, -3522, -3398, -3159, 
-    -3056, -3674, -4614, -4788, -4129, -3191, -2153, -1187, -394, 208, 
-    582, 713, 682, 1996, 5285, 6770, 4100, 107, -2912, -4161, 
-    -3627, -3156, -3350, -3314, -2965, -2501, -2360, -2259, -1304, -697, 
-    -1314, -1542, -1041, 314, 4033, 7690, 7428, 4408, 2122, 1824, 
-    1794, 856, 38, -772, -2389, -3571, -2142, -705, -2167, -3805, 
-    -3980, -3590, -2877, -2076, -1307, -619, -16, 455, 907, 1030, 
-    1913, 5476, 8397, 6563, 2756, 375, -1438, -3228, -3364, -863, 
-    1114, 670, 95, -114, -1048, -1895, -473, 2241, 2136, -242, 
-    -1638, -1640, 260, 3602, 4627, 3398, 2626, 1712, 362, -699, 
-    -939, -604, -1388, -2095, -33, 3495, 4762, 3641, 2265, 756, 
-    -521, -681, -81, 617, 2216, 5839, 8686, 7704, 4818, 2130, 
-    450, -49, -1168, -2875, -3586, -3442, -2948, -2297, -1649, -1051, 
-    -562, -143, 180, 475, 688, 908, 1088, 1109, 3035, 7019, 
-    8303, 5396, 2303, 640, -204, -373, -243, 94, 508, 955, 
-    1372, 1733, 2029, 2236, 2357, 2188, 1094, -48, 1243, 3544, 
-    3349, 1312, -902, -2442, -2766, -2457, -1945, -1322, -766, -245, 
-    164, 512, 721, 1540, 4444, 6812, 4827, 1696, 1230, 848, 
-    -210, -594, -698, -574, -366, -99, 221, 159, -843, -1774, 
-    -1678, -1046, -463, 305, 2703, 5728, 5201, 2292, 1580, 1697, 
-    341, -1162, -2007, -2430, -2647, -3289, -4339, -4737, -4176, -3095, 
-    -1845, -768, 1624, 5867, 7862, 5798, 2701, 1245, 612, -901, 
-    -829, 1352, 1732, 515, -319, -911, -1351, -1656, -1885, -2204, 
-    -3262, -4632, -5149, -4749, -4020, -3131, -2251, -1489, 780, 4601, 
-    5416, 2291, -8, -771, -1359, -1702, -2849, -3552, -1444, 1864, 
-    2257, 552, 180, 323, 523, 1085, 756, 96, -248, -577, 
-    -862, -1128, -1399, -1636, -1937, -2734, -4150, -5227, -5331, -4835, 
-    -4135, -3377, -2670, -2058, -1543, -1137, -776, -659, -192, 2560, 
-    5916, 5517, 2228, -408, -1776, -2729, -3439, -2873, -1575, -1144, 
-    -1140, -968, -788, -584, -425, -309, -263, -282, -331, -735, 
-    -1987, -3330, -3765, -3521, -3041, -2475, -1980, -1583, -1309, -1142, 
-    -1055, -1057, -1045, -1212, -107, 3546, 5385, 2484, -1051, -2813, 
-    -3731, -3978, -3856, -3518, -3033, -2485, -1888, -1298, -723, -202, 
-    257, 635, 933, 1148, 1285, 1345, 1339, 1271, 1153, 991, 
-    808, 606, 41, -1253, -1938, -386, 1471, 1257, 182, -447, 
-    -814, -1145, -1785, -2083, -1643, -1928, -2930, -3132, -2554, -1720, 
-    -810, 40, 773, 1348, 1796, 2077, 2295, 2290, 2251, 4259, 
-    7756, 7600, 3552, 721, -660, -1537, -1874, -1981, -2027, -2976, 
-    -3845, -3557, -2858, -1931, -966, -110, 610, 1152, 1539, 1787, 
-    1899, 1933, 1859, 1768, 1596, 1520, 3581, 6982, 6738, 2608, 
-    -1392, -3785, -4589, -4246, -3560, -2060, 1446, 4617, 4120, 2715, 
-    2083, 659, -1057, -2036, -1101, 1960, 3966, 3003, 872, -799, 
-    -1526, -1286, -764, 257, 3005, 5758, 4922, 2663, 2750, 3043, 
-    1852, 421, -662, -580, 380, 458, -363, -369, 723, 1337, 
-    1187, 1100, 1138, 811, -289, -496, 1335, 2205, 689, -60, 
-    2047, 4386, 4096, 2614, 1671, 513, -1080, -2187, -2270, -1738, 
-    -1166, 415, 4107, 6480, 4984, 2693, 1390, 505, 58, -156, 
-    -218, -180, -95, 53, -18, -810, -1782, -1905, -1326, -569, 
-    228, 911, 1430, 1777, 2013, 3674, 6596, 6682, 2677, -839, 
-    -1059, -1030, -2920, -4562, -4301, -1973, 613, -136, -2456, -1998, 
-    270, 462, -1486, -2604, -1512, 1580, 3991, 3182, 1094, 278, 
-    192, -667, -1653, -1733, -1185, 1017, 4549, 5747, 3991, 2086, 
-    910, 162, -512, -1469, -1657, -798, -537, -1506, -2952, -3932, 
-    -3979, -3519, -2867, -2189, -1597, -1113, -766, -522, -394, -330, 
-    -351, -388, -480, -658, 995, 4558, 4861, 510, -3493, -4654, 
-    -2858, -500, -815, -1975, -2286, -2351, -2198, -2292, -2397, -1319, 
-    -71, -206, -1263, -2275, -2097, 373, 2965, 2770, 1175, -261, 
-    -2021, -3137, -2111, 565, 1467, -241, -1319, -1459, -1747, -1855, 
-    -1869, -2156, -2910, -2467, -562, -378, -2201, -3470, -3558, -3082, 
-    -2444, -617, 2926, 4925, 3453, 1169, -219, -1073, -1553, -1878, 
-    -2501, -2827, -2425, -2032, -1717, -2028, -3219, -3118, -448, 1669, 
-    666, -456, -30, -78, -608, -875, -1001, -1025, -978, -898, 
-    -748, -834, -1324, -917, 325, 609, 282, 191, 86, 20, 
-    -20, -441, -1000, -401, 549, 134, -896, -966, -819, -1666, 
-    -1206, 898, 1183, -343, -1961, -2181, -550, 327, -25, -219, 
-    -314, -330, -120, 461, 656, 239, 76, 73, 81, 167, 
-    235, 322, 383, 442, 493, 262, -258, -41, 898, 1141, 
-    732, 444, 263, 118, 28, -30, -55, -50, -17, 47, 
-    135, 253, 381, 569, 644, 247, 319, 1481, 2197, 2051, 
-    1969, 1614, 581, -500, -98, 2638, 4833, 4190, 2785, 1929, 
-    1217, 731, 342, -372, -1775, -2099, -362, 86, -1613, -2555, 
-    -2395, -1978, -1286, -607, 65, 642, 1205, 3399, 6847, 7353, 
-    4599, 2326, 1248, 435, -207, -93, 501, -15, -385, 1478, 
-    4074, 4601, 3792, 3258, 3178, 2962, 1493, -319, -1024, -1044, 
-    -797, -468, -186, 14, 108, 120, 60, -45, -174, -303, 
-    -417, -497, -533, -515, -440, -312, -124, 92, 387, 571, 
-    946, 3433, 7037, 7216, 4207, 1757, 482, -149, -290, -413, 
-    -836, -572, 660, 1166, 450, -757, -1644, -575, 2286, 3246, 
-    1081, -1143, -2056, -2222, -1944, -1539, -1078, -694, -348, -85, 
-    94, 1797, 5076, 5667, 2789, 260, -1003, -1882, -2816, -3640, 
-    -2504, -43, 758, 249, 109, 152, -85, -363, 295, 1342, 
-    1377, 1033, 907, 759, 639, 523, 402, 300, 128, -373, 
-    -797, -578, -811, -1892, -2463, -1442, 1165, 2567, 855, -1283, 
-    -2002, -2012, -1746, -1332, -1009, -731, 1028, 3927, 3812, 326, 
-    -2475, -3563, -3836, -3640, -3264, -2801, -2360, -1941, -1583, -1269, 
-    -1020, -979, 456, 3919, 5115, 2411, -383, -1876, -2805, -3694, 
-    -4752, -5112, -4692, -2642, 967, 2323, 708, -853, -1043, -1200, 
-    -2319, -3047, -2563, -251, 2665, 2589, 786, -258, -895, -1606, 
-    -2245, -2057, -1972, -2948, -2988, -844, 890, -212, -1916, -1996, 
-    -214, 2587, 3234, 1566, -22, -1560, -2279, -1149, -453, -1673, 
-    -2795, -2841, -2518, -2063, -1572, -1168, -836, -684, -586, 910, 
-    3833, 4558, 1777, -1737, -4169, -5237, -5233, -4714, -3940, -3090, 
-    -2217, -1464, -814, 1353, 4936, 5868, 3268, 544, -306, -86, 
-    -283, -701, -816, -862, -808, -728, -634, -542, -477, -402, 
-    -566, -1388, -2325, -2537, -2158, -1605, -957, -407, 139, 2244, 
-    5339, 5376, 2714, 765, -274, -1125, -1855, -1795, -1379, -1978, 
-    -2455, -1970, -1236, -257, 2036, 5019, 4920, 2047, 309, -74, 
-    -159, 740, 3321, 5238, 3414, 252, -486, 78, -792, -2414, 
-    -2991, -2789, -2370, -1787, -1207, -665, -195, 197, 517, 771, 
-    959, 1129, 1145, 1325, 3251, 5882, 5089, 1423, -270, 983, 
-    2009, 1226, 219, -191, -305, -237, -574, -1273, -592, 1598, 
-    2676, 1992, 738, -289, -532, -175, 221, 1098, 3736, 6097, 
-    4735, 1506, -477, -1256, -1370, -1113, -754, -314, -36, 917, 
-    3696, 5158, 2544, -532, -1421, -248, 2212, 2201, -309, -1944, 
-    -2248, -1916, -1252, -482, 229, 1396, 4157, 6549, 5612, 3188, 
-    1757, 929, 408, 173, 44, 21, 35, 90, 157, 232, 
-    302, 361, 406, 433, 461, 448, 1, -887, -748, 649, 
-    918, -281, -1008, -1029, -98, 2369, 3997, 3390, 2467, 1708, 
-    797, 237, -66, -204, -243, -218, -151, -66, 30, 119, 
-    194, 250, 279, 282, 255, 209, 148, -282, -782, -498, 
-    -665, -1751, -2324, -1766, 483, 2246, 1614, 928, 467, -441, 
-    -1258, -1842, -1287, -480, -569, -677, -575, -455, -265, -67, 
-    137, 326, 491, 628, 728, 793, 817, 801, 743, 648, 
-    519, 367, 27, -604, -764, -162, -96, -1091, -2405, -3290, 
-    -3430, -3123, -2688, -2213, -1788, -1429, -1148, -938, -787, -692, 
-    -613, -675, -510, 1447, 4131, 3832, 752, -1708, -2507, -3096, 
-    -4046, -4472, -3750, -1174, 1324, 1216, 58, -581, -951, -1113, 
-    -1160, -1427, -2312, -2582, -1129, -399, -1532, -2412, -2193, -174, 
-    2306, 2137, 616, -618, -1518, -1175, -556, -953, -1894, -2756, 
-    -2594, -458, 1738, 1152, -834, -1681, -662, 1608, 2260, 1069, 
-    -59, -949, -1134, -1243, -2261, -2931, -2792, -2454, -2011, -1580, 
-    -1220, -936, -748, -625, -570, -583, -653, 257, 2813, 4160, 
-    2159, -541, -1963, -2663, -2919, -2890, -3057, -3526, -3722, -3273, 
-    -2493, -700, 2448, 4306, 3487, 2121, 1352, 882, 602, 425, 
-    309, 216, 143, 78, 23, -30, -77, -124, -166, -205, 
-    -237, -260, -275, -268, -258, -611, -1456, -2011, -1863, -1359, 
-    -733, -101, 457, 909, 1260, 1490, 1650, 1689, 1759, 3406, 
-    6017, 5373, 1999, 415, 43, -810, -1509, -2332, -3197, -3362, 
-    -2890, -2183, -1392, -631, 33, 581, 1001, 1309, 1506, 1606, 
-    1596, 2292, 4577, 6092, 4373, 1635, -5, -1202, -1802, -1630, 
-    -1874, -2471, -1665, 688, 2203, 1890, 1048, 441, 402, 766, 
-    1030, 1189, 1347, 1353, 750, 660, 1975, 2696, 2167, 1318, 
-    506, 537, 1128, 1017, 135, -961, -1442, -80, 2146, 2301, 
-    1071, 1034, 1282, 910, 611, 488, 434, 457, 510, 607, 
-    682, 395, 291, 816, 611, -185, -312, 695, 3019, 3966, 
-    2120, 815, 1853, 2974, 2485, 1579, 1024, 595, -187, -711, 
-    426, 1363, 738, -48, -965, -1972, -2299, -2000, -1478, -886, 
-    -324, 161, 555, 817, 1035, 2238, 4631, 5414, 3372, 1099, 
-    -253, -1538, -2706, -3173, -3001, -2324, -308, 2363, 3007, 1721, 
-    618, 66, -253, -400, -453, -456, -409, -398, -853, -1559, 
-    -969, 726, 1373, 923, 293, -685, -1518, -1650, -1330, -803, 
-    -348, 377, 2678, 4958, 4265, 1850, 294, 106, 157, -576, 
-    -1357, -1298, -1108, -1017, -1063, -1864, -2545, -2408, -2066, -1614, 
-    -1170, -813, -534, -362, -268, -249, -289, -366, -479, -596, 
-    -753, -616, 1063, 3002, 1632, -1023, -1505, -1695, -2382, -2588, 
-    -2586, -2405, -2147, -1844, -1390, -809, -735, -928, -618, -228, 
-    191, 309, -145, -233, -74, -98, -173, -114, 122, -3, 
-    -513, -1325, -2265, -1962, -522, 39, -464, -908, -1132, -1241, 
-    -1260, -1219, -1144, -1022, -944, -1284, -1947, -2213, -1918, -1376, 
-    -771, -296, 1056, 3751, 4756, 2891, 500, -1372, -2237, -1089, 
-    615, 503, -637, -1575, -2752, -3575, -3616, -3281, -2773, -2233, 
-    -1719, -1277, -905, -615, -388, -238, -33, 1459, 3944, 3960, 
-    1444, -607, -2114, -2968, -1985, -600, -501, -895, -906, -875, 
-    -1024, -1005, -514, -53, 157, -56, -285, 695, 1755, 1466, 
-    804, 432, 154, -52, -206, -309, -425, -804, -1050, -556, 
-    -9, -43, -372, -1091, -1477, -465, 420, -185, -995, -927, 
-    625, 2514, 2659, 1831, 1209, 872, 238, -444, 416, 1496, 
-    1213, 563, -168, -429, 191, 466, 199, 74, -219, -1006, 
-    -1225, 43, 661, -97, 466, 1772, 1645, 990, 352, -585, 
-    -1117, -963, 255, 2662, 3787, 2790, 1674, 663, -427, -576, 
-    861, 2632, 2398, 1268, 1315, 1454, 1008, 681, 304, -466, 
-    -1211, -1383, -1134, -321, 1719, 3509, 2711, 480, -879, -1255, 
-    -1176, -853, -459, -64, 293, 593, 744, 1493, 3686, 5127, 
-    3613, 1446, 425, -61, -7, 120, -101, -226, -194, -88, 
-    96, 126, -91, 232, 1086, 1308, 801, 646, 929, 521, 
-    -278, 298, 1994, 2212, 773, -142, -277, -267, 199, 2098, 
-    4066, 3119, 577, -934, -727, 918, 1601, 714, -151, -839, 
-    -933, -603, -466, -365, -880, -1486, -1334, -911, -414, 96, 
-    511, 846, 1785, 3941, 5023, 3418, 1374, 271, -455, -885, 
-    -1103, -1214, -1226, -1193, -1107, -999, -871, -735, -584, -573, 
-    -1011, -1351, -534, 456, 80, -790, -868, 404, 2124, 2011, 
-    985, 1296, 1716, 1162, 396, -555, -1284, -642, 212, -323, 
-    -1222, -1396, -223, 1605, 1416, 252, 431, 481, -17, -622, 
-    -1733, -2487, -2542, -2365, -2036, -1702, -1396, -1146, -958, -824, 
-    -740, -696, -675, -681, -675, -718, -528, 1241, 3382, 2576, 
-    157, -1184, -1838, -2337, -2639, -2193, -1314, -1058, -1016, -804, 
-    -685, -802, -713, 23, 459, 34, -358, -24, 382, 168, 
-    -360, -874, -1033, -891, -893, -1084, -1759, -2479, -2560, -2281, 
-    -1949, -1530, -206, 2022, 2785, 1421, -27, -777, -1190, -1372, 
-    -1402, -1346, -1237, -1083, -932, -1051, -1110, -497, 113, 124, 
-    6, -28, -159, -684, -1409, -1707, -1559, -1216, -845, -520, 
-    811, 3073, 3421, 1703, 303, -511, -1047, -1362, -1947, -2647, 
-    -2877, -2583, -2063, -497, 1927, 2305, 748, 88, -332, -1358, 
-    -1818, -1679, -1382, -990, -619, -296, -55, 189, 1396, 3489, 
-    3669, 1606, -61, -884, -1424, -1638, -1692, -1622, -1469, -1263, 
-    -1011, -741, -457, -179, 88, 335, 556, 749, 910, 1038, 
-    1131, 1190, 1217, 1210, 1175, 1111, 1024, 916, 793, 658, 
-    517, 374, 233, 99, -5, -182, -778, -1364, -767, 121, 
-    -297, -1112, -1262, -1058, -746, 422, 2698, 3655, 2514, 1345, 
-    730, 345, 213, 163, -126, -713, -357, 1145, 1864, 1535, 
-    1130, 459, -278, -175, 1309, 2778, 2481, 1296, 716, 669, 
-    147, -115, 933, 1520, 956, 356, -400, -1176, -1381, -1127, 
-    -741, -86, 1549, 3197, 2531, 623, -251, -384, -301, -24, 
-    260, 533, 707, 1316, 3102, 4485, 3175, 709, -75, 505, 
-    607, 31, -395, -548, -596, -530, -540, -888, -1332, -1374, 
-    -993, -527, 117, 1812, 3800, 3891, 2339, 1085, 870, 955, 
-    657, 331, 148, 38, -90, -460, -494, -236, -617, -551, 
-    650, 1146, 707, 183, -355, -214, 336, 321, 128, 85, 
-    64, 86, -140, -698, -1039, -280, 1560, 2372, 1285, 114, 
-    30, 1289, 2556, 1989, 1092, 1229, 1152, 445, -67, -59, 
-    -366, -1171, -1530, -1431, -1256, -1022, -827, -681, -595, -565, 
-    -576, -621, -684, -755, -822, -877, -911, -920, -901, -852, 
-    -772, -749, -290, 1544, 3207, 2262, 288, -615, -924, -1034, 
-    -972, -637, -210, -165, -232, -207, -173, -137, -132, -141, 
-    -197, -555, -1266, -1794, -1864, -1688, -1427, -1158, -928, -746, 
-    -617, -528, -476, -445, -430, -419, -407, -390, -354, -377, 
-    368, 2527, 3383, 1606, -123, -952, -1799, -2549, -2834, -2588, 
-    -2135, -1620, -1113, -685, -342, -104, 40, 94, 76, -2, 
-    -122, -270, -429, -588, -735, -864, -965, -1039, -1079, -1086, 
-    -1072, -1067, -463, 1403, 2755, 1598, -602, -2106, -2809, -2824, 
-    -2440, -1931, -1378, -873, -435, -90, 161, 319, 388, 392, 
-    246, 321, 1620, 2843, 1998, 170, -1490, -2356, -1981, -2027, 
-    -2836, -3168, -2953, -2478, -1942, -1207, 713, 2748, 2635, 1399, 
-    703, 323, 153, 125, 148, 212, 270, 332, 373, 407, 
-    384, 92, -86, 136, -173, -863, -1058, -460, 1025, 1491, 
-    126, -969, -1016, 74, 1430, 917, -691, -1554, -1700, -1468, 
-    -432, 1324, 1761, 421, -197, 735, 1361, 591, -333, -289, 
-    807, 2051, 1720, 396, -192, 377, 1786, 2456, 1552, 184, 
-    -891, -1161, -164, 996, 908, -94, -1090, -1658, -1692, -1413, 
-    -1015, -588, -183, 183, 402, 1045, 2772, 3798, 2909, 1594, 
-    833, 639, 557, 237, 83, 64, -68, -257, -27, 298, 
-    471, 619, 712, 713, 242, 282, 1318, 1588, 1070, 715, 
-    483, 307, 217, 64, -259, -251, 49, 167, 288, 392, 
-    683, 946, 779, 653, 662, 530, 324, 454, 640, 191, 
-    5, 1045, 2377, 2471, 1740, 1266, 989, 762, 618, 345, 
-    33, 40, 220, 254, 264, 275, 153, -354, -900, -967, 
-    -743, -455, -138, 138, 371, 542, 587, 1108, 2710, 3727, 
-    2607, 717, -294, -665, -1278, -1888, -1330, -44, 129, -723, 
-    -1148, -1054, -843, -235, 1465, 2918, 2418, 1252, 572, -108, 
-    -924, -1017, 2, 621, 315, -76, -641, -1275, -1436, -1258, 
-    -852, 505, 2202, 1985, 316, -774, -1121, -1145, -525, 1001, 
-    1618, 297, -882, -1166, -1051, 98, 1634, 1584, 269, -613, 
-    -780, -1063, -1345, -779, -378, -1037, -1535, -1448, -1195, -866, 
-    -534, -290, 11, 1081, 2493, 2150, 248, -1064, -1493, -1650, 
-    -1194, 279, 1423, 883, -249, -939, -1505, -1752, -1589, -1726, 
-    -2123, -2180, -1408, 158, 775, -113, -901, -1048, -987, -666, 
-    653, 2244, 2127, 930, 102, -414, -737, -918, -1011, -1145, 
-    -1450, -1380, -1184, -1525, -1254, -183, 72, -319, -719, -1074, 
-    -939, -957, -1492, -1715, -1309, 17, 1077, 316, -772, -1024, 
-    -982, -786, -499, 380, 2105, 2719, 1531, 388, -153, -531, 
-    -714, -801, -864, -1115, -1605, -1838, -1150, 227, 705, -219, 
-    -1170, -1465, -1415, -1205, -944, -696, -485, -323, -204, -127, 
-    -84, -63, -85, -140, 538, 2144, 2664, 1311, -139, -896, 
-    -1283, -1403, -1414, -1529, -1436, -1027, -1022, -1312, -767, 699, 
-    1555, 1252, 810, 585, 378, -63, -616, -278, 468, 170, 
-    -574, -822, -260, 1084, 1277, 273, 360, 866, 485, -9, 
-    -237, -372, -409, -390, -510, -614, -304, -229, -652, -458, 
-    825, 1884, 1675, 1100, 852, 666, 559, 482, 228, -258, 
-    -280, 607, 1237, 860, 97, -555, -601, 375, 1440, 1389, 
-    755, 383, 180, 55, -1, -183, -332, -33, 284, 144, 
-    143, 218, -178, -338, 583, 1760, 1911, 1377, 992, 772, 
-    629, 542, 486, 445, 413, 387, 365, 344, 325, 308, 
-    290, 275, 261, 250, 244, 243, 249, 260, 295, 243, 
-    7, 139, 678, 825, 448, -56, 156, 1209, 1658, 1340, 
-    1117, 1003, 915, 874, 844, 778, 446, -83, -342, -250, 
-    5, 911, 2384, 2679, 1631, 766, 184, -579, -1269, -1557, 
-    -1470, -1249, -971, -688, -435, -211, -31, 117, 232, 307, 
-    347, 901, 2353, 3150, 2102, 672, -69, -446, -612, -618, 
-    -552, -434, -298, -152, -12, 113, 216, 293, 342, 360, 
-    367, 294, 7, -96, 238, 377, -18, -365, -343, -312, 
-    -292, -511, -901, -473, -46, -599, -1143, -1138, -208, 1213, 
-    1424, 710, 259, 13, -127, -164, -169, -140, -109, -71, 
-    -36, -24, -214, -336, 48, 334, 160, -9, -112, -313, 
-    -771, -1162, -646, 141, -160, -1068, -1534, -1567, -1420, -1143, 
-    -302, 1038, 1154, -196, -890, -227, 422, 125, -530, -1085, 
-    -1691, -1921, -1191, 39, 502, 98, -254, -390, -465, -478, 
-    -463, -436, -401, -367, -331, -298, -267, -242, -217, -191, 
-    -332, -773, -858, -76, 575, 433, 124, -104, -537, -1090, 
-    -1375, -1320, -1119, -870, -631, -430, -345, 201, 1610, 1895, 
-    295, -1075, -1587, -1792, -1730, -1578, -1376, -1166, -966, -776, 
-    -607, -457, -319, -233, 119, 1528, 2657, 1569, 26, -453, 
-    -743, -886, -1136, -1589, -1270, -59, 632, 149, -230, -273, 
-    -750, -1128, -1090, -792, 166, 1271, 982, -245, -904, -1025, 
-    -994, -835, -653, -470, -352, 29, 1282, 2386, 1732, 421, 
-    -14, -147, -419, -553, -675, -986, -1251, -1180, -910, -313, 
-    1080, 2278, 2076, 1285, 754, 221, -119, -89, -317, -831, 
-    -1021, -927, -736, -492, -271, -61, 68, 236, 1276, 2671, 
-    2423, 1084, 252, -337, -808, -733, -647, -997, -1017, 15, 
-    1191, 1300, 864, 688, 587, 390, -23, -393, -111, 975, 
-    1747, 1402, 854, 538, 57, -532, -785, -215, 710, 884, 
-    654, 583, 340, 91, 22, -12, 11, 61, 138, 192, 
-    29, -241, 74, 968, 1405, 1202, 857, 372, 190, 803, 
-    1406, 1292, 937, 726, 521, 202, 54, 141, 206, 213, 
-    -84, -253, 353, 819, 613, 326, 192, 62, -186, -164, 
-    272, 478, 230, -205, -514, -70, 1126, 1754, 1398, 1007, 
-    758, 276, -183, 167, 982, 1060, 680, 455, 152, -385, 
-    -551, 160, 736, 497, 175, 27, -93, -145, -189, -395, 
-    -769, -619, 119, 200, -363, -554, -404, -202, 333, 1562, 
-    2543, 2076, 1099, 566, 235, 18, -98, -177, -212, -232, 
-    -340, -675, -1030, -1095, -907, -680, -236, 862, 1761, 1210, 
-    17, -560, -185, 804, 1142, 570, -85, -710, -1248, -1414, 
-    -1271, -998, -680, -409, -135, 849, 2198, 2065, 833, 163, 
-    -377, -1108, -1447, -1484, -1201, -92, 758, 79, -920, -1259, 
-    -1318, -1202, -1007, -806, -611, -438, -327, 5, 1267, 2277, 
-    1512, 267, -353, -737, -1069, -1263, -967, -582, -580, -601, 
-    -537, -547, -669, -613, -422, -672, -941, -379, 610, 704, 
-    -185, -906, -1115, -1092, -945, -769, -622, -237, 852, 1810, 
-    1361, 261, -388, -731, -1086, -1503, -1478, -837, -567, -940, 
-    -1157, -1016, -760, -465, -235, 75, 1092, 2228, 2027, 936, 
-    -22, -920, -1305, -914, -824, -1391, -1771, -1818, -1585, -527, 
-    593, 299, -814, -1469, -1640, -1528, -1272, -969, -646, -397, 
-    70, 1406, 2468, 1878, 853, 351, 39, -100, -136, -125, 
-    -77, -25, 36, 88, 130, 158, 135, -105, -527, -767, 
-    -724, -581, -417, -267, -160, -94, -71, -80, -114, -166, 
-    -226, -286, -340, -381, -406, -411, -396, -359, -304, -230, 
-    -141, -47, 21, 473, 1731, 2615, 1885, 563, -72, -234, 
-    -535, -859, -846, -607, -314, -54, 585, 1786, 2155, 1135, 
-    118, -310, -460, -454, -391, -305, -230, -165, -114, -75, 
-    -45, -24, -4, 14, 36, 62, 101, 124, 190, 1064, 
-    2404, 2271, 1027, 142, -421, -494, -454, -773, -884, -567, 
-    420, 1375, 1057, 668, 1158, 1285, 878, 610, 365, -65, 
-    -489, -443, 363, 1168, 1059, 577, 339, 192, 104, 78, 
-    63, -28, -138, 87, 456, 448, 112, -226, -325, -166, 
-    56, 404, 1285, 2232, 2200, 1491, 962, 644, 223, -121, 
-    181, 615, 489, 175, 13, -114, -327, -396, -243, -109, 
-    -11, -175, -271, 223, 409, -36, -358, -201, 681, 1387, 
-    876, 128, 345, 1102, 1225, 739, 290, -275, -588, -61, 
-    488, 373, 65, -249, -384, -257, -485, -838, -839, -311, 
-    805, 1315, 806, 333, 115, -42, -101, -124, -114, -87, 
-    -51, -5, 41, 88, 129, 164, 190, 206, 210, 203, 
-    185, 162, 99, -137, -550, -771, -333, 525, 823, 406, 
-    -100, -630, -916, -562, -293, -672, -1061, -1075, -921, -704, 
-    -465, -239, -58, 79, 712, 1789, 1979, 1271, 623, -110, 
-    -874, -1127, -539, 284, 343, -43, -286, -556, -972, -1291, 
-    -1321, -1176, -974, -761, -578, -429, -323, -252, -216, -206, 
-    -215, -240, -264, -333, 27, 1134, 1419, 485, -218, -872, 
-    -1584, -1421, -887, -1010, -1380, -991, 5, 484, 125, -419, 
-    -806, -920, -787, -445, 448, 1183, 661, -233, -180, 449, 
-    546, -61, -603, -635, -496, -563, -706, -735, -788, -911, 
-    -879, -717, -825, -1051, -1005, -789, -538, -294, -113, 395, 
-    1476, 2035, 1383, 500, -71, -562, -795, -779, -740, -573, 
-    -436, -503, -649, -971, -1064, -537, -98, -50, -66, -60, 
-    -38, -8, 27, 61, 90, 111, 147, -11, -253, 173, 
-    676, 518, 211, -116, -279, -191, -188, -190, -415, -832, 
-    -932, -822, -660, -471, -102, 886, 1492, 686, -303, -604, 
-    -656, -522, 143, 1243, 1465, 499, -318, -353, 319, 963, 
-    835, 470, 318, 233, 195, 173, 23, -294, -547, -553, 
-    -416, -248, -87, 41, 130, 180, 196, 186, 158, 120, 
-    78, 44, 0, -38, 477, 1497, 1501, 327, -561, -818, 
-    -819, -513, 500, 1555, 1516, 947, 635, 366, -18, -54, 
-    570, 1033, 900, 696, 539, 203, -217, -441, -427, -327, 
-    -194, -68, 36, 115, 170, 206, 230, 245, 264, 267, 
-    383, 1217, 2214, 1723, 328, -452, -663, -602, -367, -88, 
-    196, 677, 1705, 2308, 1527, 538, 189, 78, 74, 134, 
-    178, 213, 213, 192, 146, 84, 10, -70, -148, -220, 
-    -279, -321, -343, -344, -322, -279, -215, -135, -41, 64, 
-    175, 291, 354, 637, 1628, 2302, 1575, 795, 806, 695, 
-    337, -1, -434, -565, -108, 95, -297, -587, -599, -515, 
-    -378, -249, -138, -59, -7, 19, 34, -11, 277, 1257, 
-    1519, 362, -644, -964, -1050, -930, -738, -513, -296, 335, 
-    1427, 1497, 413, -288, -466, -365, 386, 958, 385, -390, 
-    -266, 216, 186, -157, -536, -805, -565, -434, -887, -1196, 
-    -1013, -278, 494, 450, -19, -266, -368, -415, -514, -754, 
-    -727, -155, 345, 322, 162, 99, 73, 20, -136, -166, 
-    64, 193, 90, -133, -319, -204, -34, -107, -243, -335, 
-    -398, -482, -675, -710, -613, -796, -753, -298, -338, -762, 
-    -914, -846, -733, -394, 563, 1313, 912, 87, -311, -274, 
-    -258, -427, -520, -558, -582, -562, -596, -722, -622, -280, 
-    -185, -260, -263, -262, -248, -225, -202, -174, -149, -123, 
-    -100, -79, -58, -82, -207, -202, 69, 177, -46, -202, 
-    -148, -271, -594, -490, 109, 424, 229, -129, -475, -432, 
-    -207, -481, -910, -1012, -931, -780, -611, -459, 48, 1042, 
-    1421, 625, -351, -702, -267, 320, 167, -426, -761, -780, 
-    -631, -418, -229, 275, 1314, 1742, 954, 1, -394, -40, 
-    543, 464, -69, -597, -939, -981, -865, -685, -482, -297, 
-    -130, 3, 119, 189, 302, 1009, 1933, 1567, 297, -492, 
-    -773, -805, -685, -309, 595, 1132, 793, 474, 294, 5, 
-    -232, -355, -263, -327, -596, -626, -472, -283, -78, 87, 
-    413, 1230, 1930, 1590, 791, 324, 73, -83, -249, -522, 
-    -518, 3, 461, 446, 317, 293, 251, 137, 158, 258, 
-    136, 215, 699, 911, 725, 445, 211, 208, 159, -171, 
-    -266, 260, 690, 349, -120, 125, 747, 867, 523, 280, 
-    147, 72, 53, 57, 85, 118, 160, 203, 245, 284, 
-    317, 347, 273, 157, 332, 573, 525, 419, 368, 308, 
-    267, 214, 36, -259, -177, 374, 612, 397, 155, -48, 
-    -54, 52, 74, 110, 160, 298, 356, 229, 36, -228, 
-    -181, 341, 654, 511, 333, 258, 139, -20, 9, 231, 
-    297, 199, 137, 106, 81, -43, -309, -308, 174, 543, 
-    405, 19, -323, -449, -406, -187, 510, 1169, 1093, 674, 
-    373, 281, 259, 97, -109, -418, -737, -830, -753, -602, 
-    -433, -276, -144, -45, 24, 65, 83, 81, 66, 41, 
-    13, -19, -43, -79, -46, 594, 1450, 1060, -175, -709, 
-    -527, -583, -998, -1166, -1047, -872, -640, -424, -232, -79, 
-    33, 104, 138, 139, 107, 63, 326, 1033, 1110, 69, 
-    -869, -1197, -1314, -1184, -536, 238, 153, -634, -1140, -972, 
-    -322, 19, -332, -757, -880, -646, 85, 771, 725, 214, 
-    -289, -571, -301, 332, 546, 256, -31, -209, -336, -420, 
-    -479, -519, -547, -562, -566, -559, -543, -518, -485, -446, 
-    -403, -346, -346, -438, -314, -6, 78, 30, 34, 28, 
-    -76, -161, 43, 230, 154, 67, 14, -41, -116, -293, 
-    -336, -268, -452, -431, 39, 184, -55, -283, -468, -386, 
-    -164, -211, -464, -706, -768, -634, -433, -228, 25, 627, 
-    1363, 1244, 423, -86, -221, -252, -223, 15, 714, 1222, 
-    718, -218, -771, -966, -989, -918, -813, -702, -597, -502, 
-    -418, -344, -279, -221, -168, -112, -84, -4, 630, 1495, 
-    1414, 650, 136, -113, -213, -207, -150, -60, 38, 140, 
-    234, 315, 380, 424, 448, 451, 433, 404, 308, 40, 
-    -264, -382, -351, -271, -173, -85, -13, 40, 76, 100, 
-    112, 121, 125, 133, 132, 305, 1016, 1481, 755, -182, 
-    -459, -161, 487, 667, 304, 67, -74, -208, -149, -3, 
-    119, 294, 351, 270, 233, 208, 79, -168, -340, -77, 
-    550, 881, 685, 428, 300, 231, 158, 30, 49, 283, 
-    394, 255, 179, 271, 358, 411, 438, 518, 636, 586, 
-    472, 403, 340, 297, 249, 94, -189, -382, -385, -289, 
-    -189, 145, 944, 1364, 923, 391, -47, -466, -370, -17, 
-    -147, -481, -290, 355, 668, 388, 61, 38, 49, -182, 
-    -290, 156, 636, 442, 10, 154, 704, 879, 508, 137, 
-    63, -10, -289, -376, 84, 609, 574, 144, -268, -479, 
-    -235, 275, 309, -124, -386, -204, 327, 651, 462, 102, 
-    -232, -251, -68, -251, -606, -719, -679, -589, -182, 526, 
-    668, 45, -356, -62, 310, 212, -64, -205, -268, -271, 
-    -240, -185, -121, -51, 18, 82, 139, 186, 221, 243, 
-    250, 244, 223, 190, 149, 10, -152, -124, -206, -528, 
-    -700, -696, -653, -574, -503, -441, -395, -361, -339, -324, 
-    -314, -303, -299, -72, 642, 915, 181, -265, -112, -222, 
-    -460, -531, -531, -489, -421, -343, -265, -195, -136, -91, 
-    -62, -48, -45, -76, -236, -465, -384, 9, 160, -23, 
-    -196, -291, -425, -560, -536, -512, -683, -805, -757, -566, 
-    30, 742, 823, 441, 160, -69, -248, -230, -178, -105, 
-    26, 15, -98, -285, -574, -726, -424, 161, 309, 33, 
-    -241, -578, -876, -953, -886, -754, -595, -448, -281, 301, 
-    1082, 1049, 443, 22, -369, -548, -173, 209, 180, 65, 
-    58, 42, -34, -54, 65, -9, -230, -262, -183, -93, 
-    4, 72, 116, 131, 121, 93, 49, -2, -58, -112, 
-    -161, -202, -231, -248, -252, -243, -222, -191, -150, -102, 
-    -46, -16, 100, 668, 1278, 977, 138, -338, -464, -443, 
-    -343, -215, -90, 19, 108, 173, 217, 240, 245, 235, 
-    215, 187, 157, 129, 67, 248, 943, 1160, 373, -355, 
-    -610, -672, -584, -441, -273, -124, 313, 1155, 1429, 892, 
-    431, 189, -111, -387, -497, -426, -295, -141, 7, 130, 
-    230, 296, 561, 1242, 1551, 983, 358, 56, -142, -235, 
-    -263, -252, -210, -151, -80, -63, -63, 64, 233, 328, 
-    408, 462, 496, 515, 513, 519, 581, 597, 483, 362, 
-    283, 208, 146, 91, 42, -1, -30, -83, -205, -215, 
-    -33, 59, -68, -143, -58, -105, -140, 214, 527, 487, 
-    387, 349, 334, 347, 354, 276, 247, 354, 417, 451, 
-    463, 467, 365, 163, 347, 650, 542, 315, 65, -265, 
-    -471, -494, -438, -350, -258, -177, -112, -64, -32, -13, 
-    -6, -6, -12, -20, -28, -36, -40, -43, -44, -41, 
-    190, 814, 1010, 279, -424, -636, -671, -599, -470, -335, 
-    -210, -85, 322, 1006, 1201, 682, 167, -91, -244, -358, 
-    -488, -484, -319, -304, -364, -311, -376, -550, -582, -493, 
-    -370, -243, -128, -65, 90, 649, 1032, 554, -159, -506, 
-    -368, 116, 222, -103, -355, -487, -553, -562, -545, -503, 
-    -453, -394, -331, -266, -281, -427, -374, 21, 147, -120, 
-    -157, 285, 680, 569, 297, 159, 47, -31, -88, -136, 
-    -174, -211, -242, -272, -298, -323, -345, -364, -380, -406, 
-    -517, -718, -840, -799, -682, -542, -402, -275, -167, -82, 
-    -29, 150, 706, 1178, 899, 293, -62, -241, -338, -364, 
-    -355, -322, -278, -228, -176, -129, -87, -56, -30, -26, 
-    -128, -328, -462, -459, -388, -298, -214, -149, -106, -84, 
-    -80, -91, -111, -137, -165, -192, -214, -230, -238, -234, 
-    -250, -18, 690, 996, 459, -70, -298, -433, -549, -710, 
-    -746, -617, -421, -206, 2, 170, 466, 1126, 1516, 1112, 
-    573, 188, -207, -428, -459, -409, -324, -235, -152, -84, 
-    -33, 3, 23, 32, 30, 22, 10, -3, -16, -27, 
-    -35, -39, -40, -37, -30, -19, -6, 9, 27, 45, 
-    67, 65, 137, 613, 1189, 1066, 458, 35, -173, -272, 
-    -297, -278, -226, -198, -226, -145, -18, -85, -178, -130, 
-    -23, 360, 991, 1180, 857, 534, 200, -47, 140, 442, 
-    411, 153, -115, -274, -262, -172, -68, 240, 880, 1122, 
-    599, 50, -179, -241, -203, -94, 336, 917, 902, 453, 
-    119, -192, -442, -481, -407, -283, -148, -18, 89, 243, 
-    707, 1260, 1168, 621, 266, 84, -35, -84, -104, -98, 
-    -80, -49, -35, -120, -229, -60, 307, 366, 92, -119, 
-    -148, -88, -8, 255, 813, 1131, 863, 465, 228, 80, 
-    -9, -60, -84, -93, -89, -71, -107, -168, -57, 121, 
-    144, 108, 100, 82, -19, -212, -320, -83, 403, 502, 
-    122, -203, -321, -323, -279, -141, 359, 825, 623, 105, 
-    -170, -165, -139, -225, -276, -278, -270, -236, -197, -147, 
-    -95, -57, -86, -65, 131, 264, 232, 152, -10, -56, 
-    191, 363, 304, 229, 167, 108, 57, -27, -199, -233, 
-    -3, 81, -92, -291, -526, -733, -789, -731, -631, -537, 
-    -350, 136, 515, 244, -264, -498, -545, -514, -214, 366, 
-    554, 196, -72, -162, -185, -104, -93, -146, -163, -164, 
-    -153, -138, -121, -101, -136, -218, -143, 18, 5, -178, 
-    -368, -248, 84, 61, -260, -465, -503, -457, -371, -276, 
-    -188, -115, -57, -16, 11, 24, 27, 21, 7, -12, 
-    -32, 171, 714, 859, 305, -232, -588, -903, -1019, -970, 
-    -851, -702, -551, -408, -284, -178, -94, -29, 17, 48, 
-    65, 72, 53, 129, 550, 979, 767, 196, -172, -355, 
-    -455, -535, -675, -788, -768, -666, -430, 104, 560, 496, 
-    215, 43, -56, -180, -376, -377, -112, -48, -253, -359, 
-    -346, -207, 276, 720, 621, 313, 141, 33, -18, -95, 
-    -168, -98, -26, 47, 180, 170, 27, 15, 72, -34, 
-    -15, 298, 401, 204, -47, -246, -298, -249, -170, -79, 
-    2, 71, 124, 162, 186, 199, 203, 196, 192, 390, 
-    892, 1036, 439, -200, -468, -547, -449, -59, 328, 201, 
-    -179, -325, -306, -237, -134, -34, 57, 130, 187, 230, 
-    237, 313, 721, 1146, 963, 383, 1, -122, -258, -438, 
-    -498, -310, 183, 552, 466, 173, -50, 47, 354, 433, 
-    337, 274, 239, 176, 9, -62, 170, 293, 85, -86, 
-    -100, -71, -9, 53, 109, 152, 169, 378, 901, 1055, 
-    593, 179, -39, -277, -487, -565, -499, -361, 11, 566, 
-    719, 454, 226, 18, -179, -140, 211, 553, 514, 312, 
-    131, -64, -34, 244, 361, 243, 138, 85, 43, 22, 
-    -19, -136, -285, -350, -254, 105, 530, 576, 277, -37, 
-    -110, 106, 265, 155, -74, -266, -332, -306, -175, 239, 
-    661, 621, 330, 134, -41, -258, -419, -445, -386, -295, 
-    -191, -114, 13, 458, 885, 715, 297, 49, -110, -197, 
-    -279, -435, -561, -573, -422, 23, 420, 342, 116, 11, 
-    -64, -162, -328, -445, -431, -352, -252, -148, -64, 87, 
-    520, 898, 682, 245, 12, -131, -220, -258, -277, -274, 
-    -263, -272, -362, -473, -485, -402, -292, -192, -60, 295, 
-    726, 660, 138, -273, -438, -483, -461, -413, -358, -306, 
-    -259, -239, -166, 197, 544, 293, -241, -370, -187, -220, 
-    -490, -652, -551, -162, 77, -139, -342, -158, 101, 110, 
-    12, -47, -75, -170, -348, -407, -381, -246, 190, 532, 
-    379, 87, -70, -183, -247, -283, -301, -304, -299, -284, 
-    -264, -238, -209, -178, -157, -194, -184, -27, 73, 45, 
-    -17, -148, -271, -179, 172, 432, 333, 149, 55, -17, 
-    -80, -173, -235, -199, -170, -168, -161, -123, -63, -113, 
-    -276, -422, -466, -408, -307, -196, -88, 8, 80, 143, 
-    415, 874, 971, 571, 108, -222, -311, -58, 222, 200, 
-    49, -41, -152, -309, -408, -393, -317, -222, -127, -44, 
-    22, 72, 105, 125, 133, 132, 124, 113, 101, 74, 
-    252, 735, 856, 386, -63, -218, -278, -420, -518, -457, 
-    -348, -215, -80, 40, 139, 362, 839, 1046, 678, 213, 
-    -105, -284, -312, -248, 35, 381, 287, -82, -250, -261, 
-    -227, -152, -74, -5, 151, 556, 905, 735, 307, 87, 
-    92, 116, 76, 49, 56, 71, 96, 91, 53, 110, 
-    228, 184, 18, -73, -64, -11, 53, 113, 157, 170, 
-    332, 743, 895, 565, 199, -14, -149, -216, -246, -245, 
-    -225, -190, -141, -131, -133, -34, 71, 149, 191, 92, 
-    45, 310, 650, 622, 323, 135, 205, 510, 641, 464, 
-    297, 197, 111, 52, 3, -34, -66, -95, -169, -311, 
-    -413, -404, -337, -252, -163, -82, -13, 43, 87, 120, 
-    144, 152, 188, 443, 839, 830, 413, 92, -57, -144, 
-    -175, -176, -159, -131, -97, -69, -110, -197, -119, 137, 
-    264, 198, 84, -74, -224, -277, -253, -200, -141, -87, 
-    -45, -12, 1, 5, 230, 637, 652, 265, -38, -227, 
-    -421, -587, -600, -315, 24, 67, -42, -136, -280, -368, 
-    -343, -278, -94, 321, 571, 386, 147, 21, -77, -141, 
-    -237, -302, -264, -312, -448, -476, -333, 25, 278, 137, 
-    -105, -174, -106, -80, -124, -141, -178, -208, -145, -77, 
-    -42, -8, 11, 26, 37, 11, -105, -226, -207, 28, 
-    340, 374, 117, -92, -158, -246, -406, -494, -483, -436, 
-    -375, -312, -256, -208, -168, -145, -126, 104, 505, 512, 
-    60, -346, -452, -240, -24, -69, -176, -221, -299, -405, 
-    -326, -50, 84, 40, -23, -150, -218, -29, 177, 144, 
-    -20, -190, -277, -108, 199, 259, 103, -3, -61, -130, 
-    -208, -195, -163, -264, -338, -273, -9, 343, 382, 189, 
-    75, 15, -26, -70, -176, -286, -308, -257, -185, -109, 
-    -41, 12, 51, 69, 89, 276, 618, 664, 284, -130, 
-    -402, -465, -269, -108, -222, -381, -397, -332, -248, -143, 
-    130, 505, 531, 221, 1, -54, -38, -3, 96, 428, 
-    735, 585, 188, -65, -33, 207, 288, 153, 38, -47, 
-    -179, -308, -348, -307, -237, -156, -79, -11, 45, 89, 
-    121, 144, 158, 165, 171, 163, 207, 513, 757, 451, 
-    125, 116, -25, -244, -297, -165, 150, 274, 61, -94, 
-    -91, -52, 16, 86, 146, 195, 229, 247, 260, 411, 
-    743, 807, 390, -42, -232, -293, -280, -230, -167, -100, 
-    -38, 18, 66, 106, 138, 159, 161, 284, 606, 707, 
-    355, -31, -161, -15, 172, 65, -167, -263, -258, -210, 
-    -141, -70, -5, 53, 85, 162, 484, 774, 618, 290, 
-    99, -16, -114, -179, -142, -92, -56, -20, 24, 109, 
-    133, 97, 38, -77, -139, -3, 288, 394, 263, 152, 
-    88, 17, -95, -229, -285, -264, -216, -159, -104, -47, 
-    147, 490, 562, 281, 25, -166, -293, -184, 6, 29, 
-    -30, -41, -32, -14, 13, 40, 67, 90, 110, 126, 
-    116, 37, -26, 88, 254, 203, 7, -121, -155, -145, 
-    -118, -89, -67, -54, -49, -53, -62, -76, -93, -111, 
-    -129, -146, -160, -171, -179, -184, -184, -182, -177, -169, 
-    -160, -149, -137, -125, -111, -103, -89, 137, 501, 465, 
-    112, -115, -227, -312, -377, -355, -297, -354, -391, -334, 
-    -241, 3, 318, 297, 33, -18, 178, 292, 168, -39, 
-    -198, -280, -272, -234, -185, -138, -101, -74, -59, -54, 
-    -59, -72, -90, -111, -134, -157, -179, -198, -213, -224, 
-    -230, -230, -226, -216, -201, -182, -159, -147, -30, 306, 
-    525, 343, 61, -86, -152, -171, -161, -136, -105, -72, 
-    -38, -30, -88, -163, -176, -139, -88, -37, 2, 28, 
-    40, 40, 30, 12, -11, -37, -63, -87, -108, -124, 
-    -135, -140, -139, -131, -119, -102, -80, -62, 82, 421, 
-    512, 254, 19, -173, -300, -288, -236, -160, -81, -11, 
-    50, 94, 127, 144, 150, 141, 204, 443, 558, 251, 
-    -119, -270, -318, -317, -280, -234, -182, -132, -84, -42, 
-    -4, 29, 56, 78, 96, 109, 119, 125, 129, 126, 
-    120, 272, 577, 597, 273, 53, -7, -76, -135, -155, 
-    -154, -136, -113, -124, -118, -14, 82, 67, 29, 73, 
-    87, 37, 144, 310, 254, 93, 10, 4, 35, 75, 
-    224, 526, 623, 417, 229, 128, 44, -57, -166, -113, 
-    25, -21, -148, -169, -136, -87, -28, 25, 73, 109, 
-    137, 157, 169, 175, 177, 170, 178, 330, 604, 614, 
-    316, 77, -34, -118, -211, -267, -167, -42, -64, -41, 
-    111, 174, 120, 50, 8, 26, 16, -63, -102, -78, 
-    -33, 17, 65, 95, 133, 333, 591, 554, 298, 105, 
-    -8, -77, -113, -129, -131, -126, -113, -96, -77, -56, 
-    -35, -49, -120, -105, 76, 197, 162, 105, 15, -71, 
-    21, 186, 193, 79, -46, -129, -50, 175, 248, 75, 
-    -95, -112, 53, 208, 102, -100, -195, -210, -188, -139, 
-    19, 261, 253, -5, -168, -204, -204, -174, -136, -98, 
-    -62, -32, -7, 13, 28, 38, 41, 40, 149, 408, 
-    501, 272, 17, -127, -257, -377, -431, -412, -358, -293, 
-    -229, -172, -126, -91, -67, -53, -47, -49, -53, -72, 
-    -65, 135, 371, 240, -117, -346, -434, -436, -390, -335, 
-    -212, 87, 304, 205, 42, -33, -78, -92, -93, -87, 
-    -77, -68, -59, -53, -48, -47, -48, -51, -57, -64, 
-    -73, -81, -89, -122, -159, -133, -136, -218, -207, -20, 
-    146, 119, 18, -66, -168, -221, -203, -155, -100, -44, 
-    96, 348, 457, 293, 86, -51, -118, -143, -222, -305, 
-    -313, -284, -242, -197, -155, -120, -92, -72, -57, -45, 
-    -50, -8, 212, 411, 300, 56, -92, -168, -200, -204, 
-    -189, -165, -135, -101, -68, -36, -7, 18, 38, 53, 
-    63, 68, 69, 66, 62, 34, -16, -9, 9, 17, 
-    50, 6, -49, -35, -95, -180, -109, 93, 182, 84, 
-    -52, -121, -30, 107, 94, -4, -99, -135, -18, 189, 
-    254, 171, 111, 85, 49, -19, -59, 42, 180, 178, 
-    78, -25, -67, 40, 229, 286, 180, 42, -53, -83, 
-    -62, -24, 18, 56, 86, 107, 120, 126, 124, 116, 
-    104, 89, 72, 54, 36, 20, 6, -6, -14, -19, 
-    -21, -19, -14, -6, 5, 18, 23, 139, 420, 511, 
-    301, 112, 24, -24, -36, -66, -58, 32, 94, 66, 
-    40, 77, 76, 2, -30, -10, 15, 47, 71, 88, 
-    96, 97, 92, 82, 70, 56, 43, 31, 22, 13, 
-    58, 255, 391, 192, -65, -67, 39, 51, 27, 33, 
-    18, 2, 13, 26, 43, 60, 62, 38, 43, 101, 
-    128, 99, 42, -47, -123, -79, 83, 174, 115, 19, 
-    -80, -183, -209, -79, 94, 121, 55, 15, -28, -56, 
-    -4, 65, 57, 16, 44, 113, 128, 109, 101, 90, 
-    81, 70, 31, -13, 17, 54, 25, -26, -90, -107, 
-    -103, -177, -245, -243, -219, -182, -143, -21, 218, 295, 
-    135, -3, -64, -103, -113, -111, -104, -123, -172, -193, 
-    -161, -103, 29, 254, 357, 233, 80, 21, 2, -11, 
-    1, -11, -91, -191, -247, -178, -15, 53, -14, -103, 
-    -165, -163, -114, -114, -175, -244, -270, -250, -197, -37, 
-    181, 232, 124, 32, -33, -123, -174, -87, 22, 21, 
-    -30, -88, -113, -93, -132, -201, -148, 23, 104, 42, 
-    -33, -122, -197, -127, -5, 1, -48, -70, -83, -111, 
-    -175, -181, -52, 47, 21, -17, -31, -43, -47, -52, 
-    -84, -146, -124, 8, 70, 6, -90, -165, -151, -15, 
-    63, -13, -28, 56, 50, -17, -52, -71, -82, -85, 
-    -83, -78, -71, -63, -54, -45, -36, -27, -20, -13, 
-    -6, -2, 3, 7, -12, -70, -79, 25, 115, 100, 
-    56, 31, 15, 5, -1, -5, -6, -6, -5, -1, 
-    -18, -42, -18, -11, -67, -96, -83, -40, 121, 275, 
-    196, 31, -39, -58, -52, -37, 32, 233, 347, 215, 
-    33, -39, -29, -30, -62, -72, -72, -67, -55, -55, 
-    -68, -37, -9, -32, 33, 158, 171, 127, 107, 94, 
-    65, 42, 77, 123, 112, 90, 81, 72, 66, 53, 
-    21, 16, 64, 87, 41, -34, -84, -30, 119, 202, 
-    157, 81, 4, -73, -104, -89, -55, -15, 24, 54, 
-    79, 195, 390, 423, 268, 112, 4, -33, -46, -112, 
-    -145, -40, 111, 136, 78, 22, -53, -106, -105, -80, 
-    -4, 188, 325, 261, 153, 65, -31, -18, 74, 56, 
-    -28, -53, 9, 168, 229, 103, 6, -9, -3, 18, 
-    52, 179, 360, 333, 117, -38, -96, -111, -98, -77, 
-    -53, -32, -16, -3, 5, 9, 10, 8, 4, -2, 
-    -7, -13, -18, -22, -25, -26, -26, -31, -5, 144, 
-    307, 256, 73, -45, -99, -123, -124, -114, -96, -75, 
-    -53, -32, -12, 5, 18, 29, 35, 38, 39, 16, 
-    -13, 13, 49, 35, 9, -8, -28, -74, -141, -177, 
-    -170, -68, 104, 144, 56, -9, -44, -67, -76, -80, 
-    -79, -75, -69, -62, -54, -46, -39, -50, -68, -33, 
-    18, 4, -41, -37, 8, 13, -13, -26, -37, -46, 
-    -51, -57, -60, -63, -64, -64, -63, -70, -107, -140, 
-    -87, -15, -35, -40, 39, 70, 28, -6, -23, -34, 
-    -53, -99, -151, -167, -148, -123, -78, 59, 210, 197, 
-    74, -17, -72, -105, -138, -198, -230, -152, -59, -57, 
-    -85, -97, -100, -98, -114, -123, -72, -25, -24, -35, 
-    -78, -107, -31, 37, -15, -66, 9, 114, 114, 68, 
-    37, 30, 38, 11, -20, -33, -47, -53, -61, -92, 
-    -145, -172, -158, -127, -91, -56, -27, 48, 202, 266, 
-    160, 37, -71, -138, -80, 13, 20, -1, -6, -30, 
-    -50, -65, -106, -146, -118, 7, 121, 117, 65, 37, 
-    20, -13, -65, -100, -98, -75, 11, 156, 213, 156, 
-    73, -24, -75, -3, 75, 27, -61, -89, -84, -67, 
-    18, 191, 248, 130, 56, 54, 27, -2, -14, -20, 
-    -41, -50, -19, -26, -69, -73, -14, 137, 241, 190, 
-    113, 47, -26, -6, 67, 41, -34, -51, 7, 135, 
-    165, 73, 75, 128, 96, 41, -4, -22, 15, 38, 
-    7, -46, -79, -32, 97, 168, 118, 74, 76, 71, 
-    70, 72, 63, 30, 33, 108, 143, 92, 17, -40, 
-    -57, -49, 4, 140, 243, 199, 105, 44, -16, -85, 
-    -128, -128, -105, -73, -40, -8, 20, 44, 64, 72, 
-    96, 223, 338, 274, 164, 98, 33, -21, -59, -49, 
-    -43, -87, -88, 21, 137, 132, 56, 20, 24, -8, 
-    -63, -76, -61, -45, 9, 151, 242, 134, -24, -98, 
-    -122, -117, -97, -73, -49, -28, -8, 58, 209, 286, 
-    171, 12, -80, -71, 0, 14, -21, -37, -42, -42, 
-    -37, -31, -37, -71, -87, -22, 56, 58, 25, 0, 
-    -33, -48, -19, 1, -28, -56, -49, -37, -31, -28, 
-    -16, 9, 9, -7, -14, -19, -40, -49, -28, -41, 
-    -87, -63, 50, 120, 84, 33, 5, -18, -32, -43, 
-    -50, -56, -60, -78, -121, -162, -137, -21, 58, -5, 
-    -90, -67, -19, -59, -74, 0, 21, -19, -43, -54, 
-    -60, -61, -59, -63, -80, -72, -27, -10, -43, -90, 
-    -119, -113, -90, -63, 9, 144, 204, 95, -42, -105, 
-    -126, -107, -14, 78, 35, -79, -132, -90, 4, 14, 
-    -79, -117, -51, -15, -76, -143, -145, -57, 56, 66, 
-    6, -36, -56, -65, -77, -111, -143, -144, -120, -90, 
-    -46, 78, 208, 191, 97, 38, 0, -23, -35, -52, 
-    -78, -69, -58, -96, -123, -105, -14, 92, 58, -40, 
-    -76, -78, -70, -17, 115, 194, 114, 6, -35, -45, 
-    -85, -120, -64, 48, 87, 34, -33, -77, -85, -64, 
-    -38, 14, 133, 234, 183, 78, 39, 17, -4, -39, 
-    -90, -110, -98, -77, -53, -30, -9, 8, 22, 28, 
-    44, 139, 258, 239, 116, 26, -31, -92, -114, -50, 
-    20, 27, 7, -17, -14, 27, 50, 46, 29, -13, 
-    -16, 59, 109, 90, 62, 46, 33, 25, 19, 15, 
-    13, 13, 13, 15, 18, 24, 20, 6, 22, 39, 
-    10, -10, 6, 34, 127, 253, 249, 151, 121, 119, 
-    86, 59, 36, -6, -55, -75, -67, -50, -29, -10, 
-    6, 18, 26, 31, 33, 33, 32, 30, 25, 49, 
-    153, 246, 186, 39, -66, -83, -26, 12, -13, -59, 
-    -64, -4, 33, 17, 48, 110, 111, 62, 7, -27, 
-    -30, -17, 0, 17, 25, 70, 188, 243, 158, 58, 
-    0, -39, -80, -128, -112, -45, -44, -88, -98, -54, 
-    64, 144, 110, 59, 14, -40, -63, -56, -37, -14, 
-    7, 69, 184, 192, 65, -26, -54, -66, -62, -43, 
-    44, 150, 116, -20, -104, -130, -128, -76, 29, 83, 
-    42, -11, -65, -106, -103, -84, -60, -35, -14, 4, 
-    17, 25, 29, 25, 57, 159, 216, 125, -11, -82, 
-    -108, -121, -127, -126, -121, -135, -165, -167, -149, -94, 
-    27, 113, 86, 29, -3, -40, -83, -108, -104, -43, 
-    71, 106, 28, -51, -67, 0, 67, 45, 0, -26, 
-    -61, -108, -136, -134, -116, -95, -43, 77, 139, 51, 
-    -57, -103, -115, -105, -88, -67, -48, -31, -16, -5, 
-    3, 41, 150, 211, 123, 14, -39, -75, -106, -120, 
-    -109, -116, -144, -143, -121, -94, -66, -42, -21, -6, 
-    5, 12, 15, 12, 16, 81, 166, 124, -14, -103, 
-    -133, -138, -128, -111, -96, -64, 39, 136, 108, 21, 
-    -33, -73, -118, -146, -142, -120, -90, -62, -17, 97, 
-    189, 153, 75, 32, 4, -10, -17, -19, -18, -16, 
-    -12, -8, -3, -1, -19, -50, -62, -51, -31, -9, 
-    10, 26, 38, 45, 49, 49, 47, 42, 37, 31, 
-    24, 18, 13, 8, 5, 1, 1, 41, 147, 192, 
-    101, 4, -43, -85, -123, -135, -117, -86, -53, -19, 
-    10, 34, 53, 67, 76, 76, 100, 190, 251, 175, 
-    66, 10, -44, -94, -107, -96, -75, -51, -26, -4, 
-    16, 33, 46, 56, 64, 67, 70, 138, 242, 216, 
-    96, 33, -13, -71, -94, -89, -74, -44, 50, 149, 
-    119, 18, -39, -25, 50, 84, 49, 21, 9, 1, 
-    0, 2, 6, 9, 0, -3, 16, 11, -17, -19, 
-    22, 105, 140, 75, 30, 72, 126, 111, 52, 18, 
-    13, -10, -45, -27, 46, 87, 60, 25, 9, -2, 
-    -8, -9, -11, -27, -52, -36, 25, 56, 43, 19, 
-    -15, -28, 17, 65, 63, 43, 32, 25, 4, -28, 
-    -15, 43, 58, 12, -30, -42, -37, -23, -8, 5, 
-    16, 23, 27, 28, 26, 78, 175, 160, 29, -70, 
-    -113, -126, -118, -103, -84, -60, 23, 124, 110, 30, 
-    -13, -36, -49, -52, -51, -47, -42, -39, -53, -71, 
-    -44, 6, -5, -45, -51, -11, 60, 70, 17, 18, 
-    37, -7, -67, -93, -93, -82, -65, -48, -32, -20, 
-    -9, 40, 132, 161, 88, 12, -27, -53, -83, -115, 
-    -128, -118, -98, -75, -54, -37, 14, 107, 129, 44, 
-    -44, -88, -104, -103, -97, -84, -67, -55, -48, -43, 
-    -38, -39, -15, 63, 104, 51, -16, -58, -91, -96, 
-    -81, -81, -68, -25, -5, -1, 4, 10, 30, 69, 
-    91, 47, -18, -53, -70, -80, -81, -70, -59, -28, 
-    34, 54, 6, -37, -53, -62, -63, -60, -55, -48, 
-    -41, -43, -58, -49, -4, 16, -12, -30, -2, 66, 
-    102, 63, 40, 64, 47, -13, -56, -67, -63, -51, 
-    -38, -25, -15, -11, 12, 94, 159, 113, 28, -23, 
-    -53, -78, -111, -131, -124, -103, -75, -45, -21, 13, 
-    108, 190, 142, 40, -17, -39, -39, -29, -16, -3, 
-    8, 17, 23, 27, 27, 33, 99, 182, 145, 44, 
-    -14, -54, -85, -81, -79, -90, -54, -8, -3, 1, 
-    9, 29, 44, 40, 39, 42, 45, 48, 44, 35, 
-    39, 52, 57, 52, 26, -2, -6, 2, 12, 22, 
-    30, 35, 38, 39, 38, 35, 32, 28, 24, 17, 
-    22, 86, 164, 130, 16, -64, -68, -9, 21, -7, 
-    -21, -16, -9, -3, -21, -36, -27, -10, 11, 30, 
-    46, 57, 65, 69, 69, 66, 62, 56, 47, 43, 
-    98, 178, 137, 28, -19, -56, -102, -116, -92, -13, 
-    56, 44, 11, 1, -3, -1, 4, 9, 15, 20, 
-    25, 28, 31, 30, 12, -14, -16, 33, 95, 100, 
-    65, 40, 17, -18, -45, -51, -41, -28, -13, 0, 
-    11, 19, 22, 33, 89, 149, 107, 7, -27, 7, 
-    21, -9, -39, -56, -83, -102, -71, -18, -5, -28, 
-    -58, -76, -44, 28, 62, 37, -6, -39, -51, -46, 
-    -27, 43, 114, 90, 12, -35, -26, 31, 52, 19, 
-    -8, -22, -35, -58, -82, -58, -19, -36, -68, -71, 
-    -61, -48, -6, 77, 115, 61, -2, -23, -31, -58, 
-    -82, -79, -62, -10, 69, 86, 39, 3, -20, -53, 
-    -81, -90, -81, -67, -53, -31, 29, 88, 58, -21, 
-    -63, -75, -77, -45, 23, 44, -15, -70, -86, -87, 
-    -71, -8, 66, 58, -14, -65, -58, -3, 29, 6, 
-    -28, -33, -34, -56, -72, -68, -56, -41, -27, -15, 
-    -5, 1, 5, 3, 21, 95, 139, 77, -12, -75, 
-    -111, -85, -24, -5, -36, -60, -54, -52, -71, -76, 
-    -53, 12, 79, 73, 36, 18, 6, -11, -37, -59, 
-    -61, -51, -39, -26, -1, 64, 117, 77, 10, -15, 
-    -28, -41, -58, -65, -38, -28, -56, -70, -63, -35, 
-    35, 92, 69, 6, -31, -36, 2, 66, 84, 52, 
-    23, 8, -2, -7, -9, -10, -10, -9, -7, -18, 
-    -38, -26, 13, 14, 2, 29, 35, 4, -17, -8, 
-    48, 104, 94, 58, 37, 24, 15, 11, 8, 6, 
-    6, 2, -15, -38, -39, 7, 63, 64, 24, -13, 
-    -20, 18, 40, 23, 9, 3, -1, -1, 0, 2, 
-    5, 8, 12, 15, 12, 8, 19, 30, 40, 49, 
-    38, 31, 31, 11, -8, -7, -1, 13, 58, 112, 
-    97, 31, 8, 39, 58, 30, -8, -20, -23, -43, 
-    -54, -17, 39, 53, 35, 22, 17, 16, 17, 20, 
-    22, 25, 27, 29, 31, 31, 31, 31, 29, 28, 
-    18, 6, 12, 8, -16, -28, -25, -17, -6, 4, 
-    13, 19, 24, 27, 29, 29, 29, 27, 41, 106, 
-    146, 89, 7, -47, -78, -82, -73, -59, -43, -28, 
-    -14, -3, 5, 11, 14, 29, 81, 122, 85, 23, 
-    -12, -33, -56, -64, -35, -9, -16, -24, -24, -21, 
-    -16, -11, -5, 1, 6, 10, 14, 16, 17, 18, 
-    17, 15, 13, 10, 4, -16, -36, -20, 13, 6, 
-    -31, -57, -63, -59, -53, -24, 43, 75, 39, -1, 
-    -22, -36, -41, -43, -42, -40, -36, -32, -28, -23, 
-    -19, -15, -13, -11, -9, -10, -21, -41, -53, -50, 
-    -40, -7, 56, 77, 34, -11, -26, -34, -59, -71, 
-    -39, -2, -16, -50, -57, -28, 21, 28, -14, -40, 
-    -41, -36, -26, -16, -8, -1, 4, 6, 6, 6, 
-    38, 94, 91, 14, -57, -89, -98, -94, -84, -71, 
-    -60, -45, 8, 72, 63, -3, -49, -65, -64, -53, 
-    -39, -24, -10, 1, 10, 17, 21, 24, 24, 22, 
-    19, 15, 10, 5, -1, -6, -11, -16, -21, -24, 
-    -28, -30, -31, -32, -3, 65, 78, 16, -31, -50, 
-    -60, -60, -57, -57, -50, -23, -3, 1, 6, 12, 
-    17, 21, 24, 27, 28, 25, 16, 13, 16, 5, 
-    6, 33, 43, 26, 6, -9, -11, -14, -32, -43, 
-    -39, -30, -12, 37, 79, 59, 8, -16, 2, 42, 
-    43, 15, 20, 34, 23, 7, -1, -5, -7, -7, 
-    -15, -33, -27, 5, 8, -16, -15, 23, 44, 36, 
-    22, -4, -22, 5, 49, 56, 35, 24, 12, 0, 
-    6, 9, -7, -15, -3, 40, 81, 74, 53, 41, 
-    38, 33, 15, 11, 6, -16, -27, -15, 28, 69, 
-    61, 30, 15, 5, 0, -2, -3, -2, 0, 2, 
-    5, 9, 12, 15, 18, 21, 23, 25, 26, 27, 
-    27, 26, 26, 20, 4, -13, -19, -15, -7, 0, 
-    11, 54, 99, 81, 32, 13, 5, -15, -33, -29, 
-    -16, -18, -30, -26, -7, 1, 0, 3, 5, 8, 
-    12, 15, 18, 16, 9, 16, 33, 32, 17, 12, 
-    16, 3, 1, 29, 34, 2, -24, -32, -30, -25, 
-    -10, 35, 66, 31, -15, -10, 13, 1, -21, -5, 
-    9, -5, -19, -30, -27, -11, -7, -10, -10, -9, 
-    -8, -14, -28, -38, -36, -28, -18, -8, 0, 6, 
-    10, 11, 11, 10, 8, 5, 1, -3, -6, -10, 
-    -15, 3, 51, 57, 5, -23, -30, -57, -80, -81, 
-    -48, 2, 15, -8, -36, -44, -17, 8, 1, -15, 
-    -15, -2, 2, -4, -6, -8, -15, -21, -15, -17, 
-    -35, -41, -35, -29, -15, 28, 71, 48, -7, -37, 
-    -31, 3, 15, -9, -38, -59, -66, -60, -44, -2, 
-    31, 9, -29, -42, -42, -38, -30, -24, -18, 4, 
-    48, 61, 14, -27, -17, 6, 0, -20, -32, -44, 
-    -60, -56, -26, -5, -7, -12, -13, -13, -11, -8, 
-    -7, -12, -11, 3, 12, 4, -3, 2, -3, -10, 
-    10, 31, 26, 14, 7, 2, -1, -3, -5, -6, 
-    -6, -7, -7, -6, -9, -17, -14, -9, -19, -10, 
-    19, 23, 11, -1, -19, -33, -33, -26, -16, -7, 
-    9, 53, 90, 70, 23, -12, -33, -38, -34, -26, 
-    -17, -9, -2, 16, 61, 91, 64, 21, -6, -20, 
-    -22, -30, -44, -43, -35, -24, 3, 52, 78, 59, 
-    31, 17, 9, 4, -4, -19, -26, -5, 34, 45, 
-    21, -3, -12, -1, 35, 57, 47, 31, 21, 13, 
-    -2, -5, 18, 27, 18, 7, -10, -24, -27, -20, 
-    -10, 1, 10, 20, 55, 102, 93, 39, 3, -12, 
-    -15, -11, -5, 2, 8, 13, 17, 20, 21, 22, 
-    21, 19, 17, 15, 13, 10, 7, 15, 53, 82, 
-    45, -17, -45, -36, -6, 5, -8, -16, -20, -23, 
-    -16, -11, -12, 5, 32, 37, 29, 25, 23, 22, 
-    21, 20, 19, 17, 16, 14, 12, 10, 8, 6, 
-    5, 2, -5, -9, 1, 8, 1, -14, -27, -28, 
-    -24, -8, 33, 64, 52, 26, 5, -18, -32, -18, 
-    17, 29, 14, -2, -15, -16, -5, -6, -12, -14, 
-    -16, -16, -17, -16, -16, -15, -14, -13, -11, -11, 
-    -19, -27, -11, 17, 21, 5, -12, -21, -8, 22, 
-    33, 22, 9, -10, -22, -21, -17, -12, -7, -4, 
-    -1, 0, 0, -1, 17, 54, 60, 18, -23, -40, 
-    -49, -64, -73, -70, -60, -48, -37, -25, 6, 52, 
-    63, 36, 12, -1, -9, -12, -13, -14, -20, -21, 
-    -15, -21, -33, -34, -30, -23, -17, -13, -9, -6, 
-    -5, -5, -6, -6, 20, 59, 48, 4, -26, -51, 
-    -70, -66, -35, -6, -9, -18, -20, -19, -17, -14, 
-    -11, -12, -21, -21, -1, 8, -8, -14, 8, 31, 
-    26, 8, -2, -9, -14, -17, -18, -19, -19, -18, 
-    -17, -15, -13, -10, -7, -5, -2, 1, 3, 5, 
-    2, -8, -16, -15, -10, -3, 4, 9, 12, 14, 
-    14, 13, 10, 7, 4, 0, -4, -8, -11, -14, 
-    -18, -10, 26, 44, 18, -12, -27, -35, -46, -45, 
-    -19, -3, -5, -5, -2, 2, 6, 11, 14, 11, 
-    1, -3, 1, 8, 15, 21, 25, 28, 29, 28, 
-    27, 24, 21, 18, 14, 11, 10, 29, 63, 58, 
-    13, -13, -21, -24, -21, -25, -27, -19, -13, -7, 
-    -1, 8, 16, 16, 15, 16, 16, 17, 17, 18, 
-    18, 16, 10, 9, 12, 4, -6, -7, -3, 1, 
-    20, 56, 67, 37, 5, -11, -15, -13, -8, -3, 
-    3, 7, 11, 13, 15, 16, 15, 24, 61, 77, 
-    42, 8, -4, -14, -17, -18, -13, -7, -9, -11, 
-    -19, -22, -1, 21, 21, 16, 14, 13, 13, 13, 
-    14, 14, 14, 13, 13, 12, 12, 11, 10, 9, 
-    8, 7, 6, 5, 5, 4, 4, 3, 3, 3, 
-    1, -7, -17, -19, -15, -8, -1, 5, 10, 14, 
-    16, 17, 17, 15, 26, 58, 68, 39, 6, -12, 
-    -23, -29, -31, -31, -30, -32, -33, -22, -11, -11, 
-    -15, -10, -7, -14, -18, -13, 11, 37, 28, 5, 
-    6, 24, 27, 17, 5, -9, -4, 3, -12, -26, 
-    -29, -27, -23, -19, -15, -11, -9, 3, 35, 50, 
-    23, -7, -21, -30, -39, -51, -54, -38, -8, 6, 
-    -2, -7, -11, -19, -22, -7, 13, 14, 8, 4, 
-    -3, -14, -21, -21, -17, -12, -7, -4, -1, 0, 
-    0, 0, -2, -5, -4, 17, 44, 34, 2, -21, 
-    -33, -41, -51, -59, -58, -50, -40, -29, -17, 13, 
-    47, 45, 23, 9, 0, -8, -15, -12, -5, -13, 
-    -25, -30, -27, -22, -16, -11, -6, -3, 0, 1, 
-    2, 2, 1, 6, 32, 48, 17, -21, -33, -23, 
-    1, 5, -10, -19, -22, -23, -22, -20, -17, -14, 
-    -12, -13, -12, -1, 5, 4, 0, -9, -10, 6, 
-    17, 7, -9, -15, -10, 11, 29, 27, 19, 14, 
-    6, 0, -3, -4, -7, -15, -24, -20, 0, 16, 
-    16, 14, 7, 0, 0, -6, -16, -9, 12, 16, 
-    0, -6, 12, 28, 23, 7, 1, 1, -6, -15, 
-    -15, -11, -5, 0, 12, 43, 61, 43, 20, 9, 
-    1, -4, -10, -14, -7, -1, -2, -3, -3, -2, 
-    -2, -5, -4, 1, -2, 2, 16, 14, 1, -1, 
-    2, 7, 20, 48, 63, 49, 29, 18, 11, 1, 
-    -10, -16, -16, -11, -6, 0, 4, 8, 10, 19, 
-    44, 54, 29, 0, -13, -16, -15, -11, -7, 11, 
-    41, 49, 29, 4, -9, -1, 12, 12, 2, -9, 
-    -14, -12, -7, 0, 6, 10, 14, 16, 17, 17, 
-    16, 14, 12, 10, 28, 49, 31, -7, -25, -24, 
-    -4, 9, -3, -18, -19, -12, -8, -8, -6, -7, 
-    -12, -7, 12, 24, 21, 15, 7, -2, -5, -2, 
-    1, 7, 26, 49, 45, 23, 8, -1, -8, -12, 
-    -14, -16, -16, -16, -16, -14, -14, -15, -14, -10, 
-    -11, -17, -9, 13, 24, 19, 11, 5, -3, -13, 
-    -17, -16, -11, 8, 32, 29, 5, -13, -20, -22, 
-    -20, -17, -14, -11, -8, -6, -5, -4, -4, -3, 
-    -4, -4, -5, 4, 31, 41, 10, -21, -34, -37, 
-    -21, -2, -3, -8, -9, -13, -18, -25, -31, -31, 
-    -26, -16, 7, 29, 24, 3, -13, -22, -24, -21, 
-    -17, -4, 21, 33, 18, -4, -19, -27, -25, -7, 
-    13, 14, -1, -16, -25, -27, -24, -19, -14, -9, 
-    -7, 1, 24, 41, 26, 4, -7, -19, -30, -33, 
-    -32, -19, 4, 13, 5, -5, -16, -13, -5, -12, 
-    -21, -22, -9, 14, 21, 10, 1, -3, -8, -13, 
-    -12, -5, -4, -10, -12, -6, -2, -4, -6, -8, 
-    -14, -21, -18, 1, 17, 14, 5, -2, -12, -18, 
-    -16, -12, -7, -2, 10, 33, 44, 29, 11, 3, 
-    -3, -7, -9, -10, -10, -9, -12, -17, -16, -2, 
-    9, 6, -3, -11, -14, -9, 9, 28, 29, 18, 
-    8, 3, 6, 10, 8, 6, 6, 4, -1, -8, 
-    -10, -7, -3, 2, 6, 10, 12, 14, 14, 14, 
-    14, 13, 11, 10, 8, 7, 5, 4, 3, 2, 
-    2, 1, 1, 1, 8, 32, 45, 25, 0, -10, 
-    -12, -18, -24, -22, -8, 13, 17, 3, -4, -3, 
-    0, 4, 8, 11, 14, 15, 18, 31, 49, 45, 
-    26, 13, 1, -6, -6, -7, -9, -14, -19, -17, 
-    -12, -7, -1, 15, 35, 33, 13, -1, -4, -5, 
-    1, 20, 35, 28, 13, 5, 0, -5, -8, -5, 
-    -3, 0, 1, 3, 2, -4, -7, -5, -1, 3, 
-    7, 10, 12, 14, 14, 13, 20, 41, 47, 21, 
-    -5, -18, -23, -23, -21, -17, -14, -10, 2, 26, 
-    33, 15, 1, -6, -11, -15, -15, -8, -4, -8, 
-    -14, -17, -15, -10, -5, 0, 4, 6, 13, 31, 
-    45, 34, 13, 2, -5, -10, -12, -14, -14, -16, 
-    -20, -25, -25, -21, -15, -10, -5, 1, 18, 36, 
-    34, 18, 5, -4, -11, -10, -6, -7, -9, -14, 
-    -21, -22, -10, 6, 6, -3, -2, -1, -4, -6, 
-    -8, -8, -9, -9, -9, -8, -8, -7, -10, -11, 
-    -8, -9, -15, -16, -13, -10, -6, -3, -1, 3, 
-    18, 36, 29, 8, -4, -11, -16, -18, -20, -20, 
-    -20, -19, -18, -16, -15, -13, -12, -13, -17, -19, 
-    -12, 5, 14, 10, 4, 2, 0, -1, -2, -2, 
-    -2, -3, -3, -3, -4, -4, -4, -5, -7, -10, 
-    -8, -4, -3, -5, -6, -7, -7, -7, -7, -6, 
-    -8, -10, -6, 0, 0, -1, -4, -4, -1, -5, 
-    -9, -8, -6, -2, 1, 4, 5, 12, 30, 39, 
-    24, 7, -2, -8, -15, -23, -27, -26, -22, -18, 
-    -13, -4, 16, 24, 9, -5, -8, -8, -5, 9, 
-    27, 29, 16, 8, 4, 1, 0, -5, -10, -11, 
-    -9, -5, -1, 2, 5, 6, 7, 8, 8, 7, 
-    6, 5, 9, 25, 34, 22, 4, -6, -11, -13, 
-    -12, -11, -9, -6, -3, -1, -2, -4, -3, 1, 
-    6, 11, 15, 18, 19, 20, 20, 19, 17, 15, 
-    13, 10, 8, 5, 3, 1, 0, 12, 28, 20, 
-    -5, -20, -25, -20, -3, 8, 3, -4, -4, 1, 
-    5, 5, 6, 8, 9, 10, 11, 12, 12, 13, 
-    11, 7, 1, -2, -1, 1, 3, 5, 6, 7, 
-    7, 15, 30, 34, 18, 1, -5, -9, -15, -18, 
-    -9, 4, 8, 4, -1, -6, -10, -9, -6, 2, 
-    18, 29, 24, 12, 6, 7, 7, 4, -1, -4, 
-    -1, 2, -1, -6, -12, -13, -11, -8, -5, -1, 
-    1, 4, 5, 6, 14, 32, 34, 18, 5, -2, 
-    -7, -13, -19, -14, -3, -1, -4, -7, -13, -17, 
-    -12, 1, 9, 2, -8, -11, -11, -9, -5, 6, 
-    22, 22, 10, 2, -2, -4, -6, -6, -6, -6, 
-    -6, -8, -7, -3, 0, -3, -9, -12, -13, -10, 
-    -8, -5, 1, 15, 25, 17, 4, -4, -10, -14, 
-    -13, -12, -12, -11, -10, -9, -9, -7, -6, -7, 
-    -10, -6, 0, -4, -10, -11, -4, 10, 14, 7, 
-    0, -4, -7, -11, -12, -11, -15, -19, -11, -1, 
-    -3, -11, -14, -13, -12, -6, 10, 20, 9, -5, 
-    -11, -6, 5, 6, 0, -3, -5, -6, -6, -6, 
-    -6, -7, -9, -8, -4, -2, -4, -5, -5, -6, 
-    -6, -6, -6, -6, -5, -6, -9, -11, -6, 3, 
-    5, 2, 1, 0, -2, -3, 0, 3, 3, 3, 
-    1, -2, -7, -9, -8, -5, -3, 0, 1, 2, 
-    3, 3, 3, 3, 2, 1, 1, 0, -1, 0, 
-    10, 24, 19, 4, -5, -9, -12, -15, -12, -6, 
-    -5, -7, -4, 1, 2, -3, -5, -4, -1, 6, 
-    21, 26, 14, 2, -3, -4, -4, -2, -1, 1, 
-    10, 23, 22, 8, 1, -2, -3, -2, -5, -6, 
-    -4, -2, 1, 1, 0, 1, 0, -3, -3, 4, 
-    15, 18, 10, 3, 3, 11, 18, 16, 12, 7, 
-    -1, -6, -2, 8, 12, 9, 5, 3, 1, -2, 
-    -5, 0, 8, 9, 7, 4, 1, 4, 7, 5, 
-    1, -4, -3, 6, 15, 13, 8, 3, -3, -6, 
-    -6, -4, 2, 16, 22, 14, 8, 4, 2, -2, 
-    -7, -9, -7, -5, -2, 1, 4, 5, 7, 11, 
-    24, 31, 21, 8, 2, -2, -4, -6, -6, -6, 
-    -5, -5, -4, -3, -2, -1, 0, 1, 1, 0, 
-    0, 4, 6, 4, -1, 0, 5, 6, 0, -3, 
-    -3, 0, 10, 16, 13, 6, 2, 1, 0, -3, 
-    -6, -10, -14, -14, -12, -9, -6, -3, -1, 1, 
-    3, 4, 5, 5, 11, 24, 25, 8, -5, -11, 
-    -13, -12, -10, -8, -6, -4, -3, -2, -1, -1, 
-    -1, -1, 2, 13, 17, 2, -11, -16, -17, -16, 
-    -8, 2, 1, -10, -15, -15, -10, 1, 9, 5, 
-    -1, -4, -5, -6, -8, -11, -13, -12, -9, -7, 
-    -4, -2, -1, 3, 13, 18, 8, -5, -10, -12, 
-    -12, -11, -10, -3, 9, 12, 4, -3, -7, -9, 
-    -9, -10, -11, -10, -8, -6, -4, -5, -5, 0, 
-    1, -3, -6, -5, 4, 10, 4, -4, -2, 4, 
-    1, -7, -7, 0, 3, -4, -11, -14, -13, -12, 
-    -9, -7, -5, -3, -2, 0, 0, 1, 1, 1, 
-    4, 14, 21, 12, -1, -7, -9, -13, -16, -17, 
-    -14, -12, -8, -5, -3, -1, 1, 2, 5, 14, 
-    23, 18, 8, 1, -3, -5, -6, -6, -6, -7, 
-    -5, -2, -3, -6, -6, 0, 9, 10, 7, 5, 
-    3, 2, 1, -2, -5, -6, -4, 6, 14, 12, 
-    5, 2, 1, -1, -5, -6, -2, 8, 14, 9, 
-    3, -2, 0, 4, 1, 1, 5, 3, -2, -3, 
-    -3, -1, 1, 2, 4, 5, 5, 5, 7, 14, 
-    23, 19, 5, -2, -1, -2, -7, -10, -7, 1, 
-    6, 2, -3, 1, 6, 7, 6, 5, 0, -4, 
-    -2, 6, 11, 10, 6, 5, 4, 3, 3, 3, 
-    3, 3, 3, 3, 4, 3, 0, -2, -3, -1, 
-    0, 3, 12, 21, 19, 11, 7, 4, 2, 0, 
-    -3, -6, -7, -6, -4, -1, 8, 17, 15, 8, 
-    4, 2, 0, -1, -4, -7, -7, -6, -3, -1, 
-    1, 3, 4, 5, 5, 6, 6, 9, 18, 18, 
-    5, -4, -7, -8, -8, -6, 1, 10, 10, 2, 
-    -2, -4, -5, -5, -5, -5, -6, -9, -8, -1, 
-    6, 8, 5, 3, 2, 1, 1, 0, 0, 0, 
-    0, -1, -1, -1, -1, -1, -3, -4, -3, -4, 
-    -4, 0, 1, 0, -1, -1, 0, -2, -3, -3, 
-    -6, -8, -4, 2, 1, -2, 1, 3, 1, -2, 
-    -5, -8, -5, -1, -1, -2, -3, -3, -5, -6, 
-    -2, 1, -1, -3, -6, -6, -5, -7, -9, -5, 
-    2, 4, 1, -2, -3, -3, -4, -4, -4, -4, 
-    -5, -5, -4, -6, -8, -7, -2, 4, 4, -3, 
-    -4, 1, 4, 1, -2, -4, -5, -6, -6, -6, 
-    -6, -5, -5, -5, -5, -7, -9, -8, -7, -5, 
-    -3, -1, 1, 8, 15, 10, 3, 3, 1, -1, 
-    -4, -8, -10, -10, -9, -7, -5, 2, 10, 6, 
-    -3, -6, -7, -6, -5, -4, -2, -1, 0, 0, 
-    2, 8, 16, 14, 4, -4, -6, -4, -3, -7, 
-    -9, -8, -6, -3, 4, 10, 6, -1, -3, -3, 
-    0, 7, 8, 4, 0, -3, -1, 0, -3, -6, 
-    -6, -5, -3, -1, 0, 5, 14, 15, 9, 3, 
-    -1, -2, 0, 0, -1, -2, -3, -5, -6, -5, 
-    -4, -2, 0, 4, 13, 17, 12, 5, 2, 1, 
-    1, 2, 3, 0, -1, 0, 1, 1, 2, 3, 
-    4, 4, 3, 3, 3, 3, 3, 3, 2, 0, 
-    -2, -2, -1, 1, 2, 4, 5, 5, 6, 6, 
-    6, 6, 6, 5, 5, 5, 4, 4, 3, 3, 
-    3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 
-    1, 1, 4, 11, 15, 9, 2, -1, -3, -4, 
-    -4, -4, -4, -2, -2, -3, -3, -1, 2, 9, 
-    15, 12, 8, 4, 0, 0, 4, 5, 2, -1, 
-    -4, -5, -5, -4, -2, -1, 0, 0, 1, 6, 
-    13, 13, 5, -1, -2, -4, -6, -3, 1, 1, 
-    -1, -1, 0, 0, -1, -1, 0, 0, -2, -3, 
-    -2, -1, 0, 1, 2, 2, 2, 2, 2, 6, 
-    12, 11, 4, -2, -5, -7, -8, -10, -11, -9, 
-    -5, -4, -4, -3, -2, -1, -1, -1, -1, -1, 
-    -1, -1, -2, -4, -5, -4, -4, -2, -1, 0, 
-    0, 1, 1, 1, 0, 2, 8, 10, 5, -1, 
-    -6, -10, -11, -10, -9, -7, -6, -4, -3, -1, 
-    6, 11, 5, -1, -3, -6, -9, -7, -2, -3, 
-    -6, -8, -6, -2, 2, 0, -1, -2, -4, -4, 
-    -4, -4, -4, -4, -3, -4, -4, -3, -1, 0, 
-    -1, -2, -4, -5, -4, -3, -2, -1, 0, 1, 
-    1, 1, 1, 1, 0, 1, 6, 9, 3, -4, 
-    -8, -6, -1, 0, -3, -5, -6, -6, -5, -5, 
-    -5, -5, -3, -4, -5, -4, -3, 1, 8, 10, 
-    6, 3, 0, -1, 0, 0, -1, -2, -2, -2, 
-    -3, -4, -2, -3, -4, -4, 1, 3, 0, -2, 
-    -2, -1, 3, 8, 6, 1, 1, 3, 4, 1, 
-    2, 4, 3, 1, 0, 0, -1, -2, -3, -4, 
-    -2, 3, 6, 4, 3, 1, 0, -2, 1, 4, 
-    4, 3, 2, 1, -1, -2, -2, -1, 1, 2, 
-    3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 
-    3, 2, 2, 1, 1, 2, 7, 9, 3, 0, 
-    1, 0, -3, -5, -5, -2, -1, -2, -3, -1, 
-    0, 2, 4, 9, 14, 13, 8, 6, 4, 2, 
-    0, -2, -2, -1, -1, 0, 1, 2, 3, 3, 
-    3, 3, 3, 3, 2, 2, 4, 9, 11, 6, 
-    1, -1, -3, -3, -4, -4, -2, 0, 0, 0, 
-    1, 1, 1, 1, 1, 2, 1, 2, 5, 4, 
-    1, 0, -1, -1, 0, 1, 1, 2, 2, 2, 
-    2, 2, 6, 11, 7, 0, -4, -6, -6, -5, 
-    -4, -3, -2, -2, 0, 5, 8, 4, -1, -3, 
-    -4, -4, -3, -2, -2, 0, 6, 9, 5, 0, 
-    -3, -3, -1, 0, -2, -4, -5, -4, 0, 1, 
-    -1, -3, -2, 1, 5, 4, 1, 0, -2, -4, 
-    -5, -4, 0, 2, 0, -2, -3, -3, -3, -3, 
-    -3, -3, -2, -2, -2, -3, -3, -3, -3, -3, 
-    -2, -2, -2, -2, -3, -4, -4, -2, 2, 3, 
-    1, 0, -2, -2, -2, -3, -2, 0, -2, -4, 
-    -4, -4, -3, -3, -2, -2, -1, -1, -1, -1, 
-    0, 4, 7, 4, -1, -4, -6, -8, -8, -5, 
-    -3, -5, -7, -7, -5, -1, 2, 0, -2, -3, 
-    -3, -2, -1, -1, 0, 0, 1, 1, 1, 1, 
-    0, 0, 0, 0, -1, -1, 2, 6, 5, -1, 
-    -5, -7, -7, -6, -5, -3, 1, 5, 4, 1, 
-    0, -1, -2, -2, -1, -1, -1, -1, -1, 0, 
-    0, -1, 0, 1, 1, 0, 0, 1, 1, 1, 
-    -1, -2, -2, 1, 4, 3, 2, 1, 0, -1, 
-    -2, -2, 1, 2, 2, 1, 1, 1, 1, 1, 
-    1, 0, -1, -2, -1, 1, 5, 6, 3, 2, 
-    3, 2, 1, 0, 0, -1, 0, 0, 0, 0, 
-    0, 2, 3, 1, -1, -1, -1, 0, 1, 2, 
-    2, 3, 3, 4, 6, 10, 10, 5, 2, 1, 
-    1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 
-    0, 0, -1, -1, 0, 1, 2, 3, 7, 10, 
-    8, 5, 3, 2, 1, 1, -1, -1, 1, 3, 
-    2, 2, 1, 1, 1, 1, 0, 1, 0, 0, 
-    2, 2, 0, 0, 0, 0, 0, 1, 2, 5, 
-    8, 6, 3, 1, 0, -2, -3, -2, 2, 4, 
-    2, 0, -1, -1, 1, 1, 1, 0, 1, 1, 
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, -1, -2, 0, 2, 
-    1, 1, 0, 0, 0, -1, -2, -3, -2, -2, 
-    -1, -1, 0, 1, 4, 6, 4, 0, -1, -3, 
-    -4, -3, -1, 0, -1, -2, -2, -2, -2, -2, 
-    -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 
-    -1, 0, 3, 5, 3, -1, -3, -4, -4, -4, 
-    -3, -3, -3, -2, -1, 2, 3, 0, -3, -4, 
-    -4, -4, -4, -3, -1, 3, 3, 1, -1, -2, 
-    -3, -3, -3, -4, -4, -4, -3, -1, 2, 2, 
-    -1, -2, -3, -3, -3, -2, -1, 2, 4, 2, 
-    0, -1, -2, -3, -3, -3, -2, -2, -2, -2, 
-    -2, -2, -2, -2, 0, 0, 0, -1, -1, -1, 
-    -2, -1, -1, -1, -1, -1, -2, -2, -1, 0, 
-    -1, -2, -2, -2, -1, 0, 3, 3, 1, -1, 
-    1, 2, 1, 0, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 
-    -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    0, 1, 1, 0, -1, 0, 0, 2, 4, 3, 
-    1, 0, 1, 3, 3, 2, 2, 1, 1, 0, 
-    0, 0, 0, -1, 0, 3, 3, 2, 1, 0, 
-    0, 0, 0, 1, 4, 6, 5, 2, 1, 0, 
-    -1, -1, 0, 1, 4, 5, 3, 2, 1, 1, 
-    1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 
-    0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 
-    2, 3, 5, 6, 3, 1, 0, -1, -2, -3, 
-    -3, -2, -2, -1, 0, 1, 2, 5, 5, 4, 
-    2, 1, 0, 0, 1, 1, -1, -1, -1, 0, 
-    0, 0, 1, 1, 4, 5, 3, 1, -1, -1, 
-    -2, -2, -1, -1, -1, -2, -1, -1, 0, 2, 
-    3, 2, 0, -1, -1, -1, -1, 0, 0, 0, 
-    0, 0, 0, 1, 3, 4, 2, 0, -1, -2, 
-    -2, -3, -3, -4, -4, -3, -2, -2, -1, 0, 
-    2, 4, 3, 1, 0, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, 
-    -3, -3, -3, -3, -2, -2, -1, -1, -1, 0, 
-    0, 0, 1, 3, 2, 0, -2, -3, -3, -1, 
-    -1, -1, -2, -2, -2, -2, -2, -2, -1, -1, 
-    -1, -1, -2, -2, -1, -1, -1, -1, -2, -2, 
-    -2, -2, 0, 1, 1, 0, -1, -1, -1, -1, 
-    -2, -2, -1, -1, -1, -2, -2, -2, -1, -1, 
-    -1, -1, -1, -1, -1, 0, 0, 1, 2, 0, 
-    -2, -2, -2, -2, -1, 1, 1, 0, -1, -1, 
-    -1, -2, -2, -2, -1, 0, 2, 2, 1, 0, 
-    0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 
-    0, 1, 2, 2, 1, 0, 0, 0, 0, -1, 
-    -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    2, 3, 3, 1, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    2, 3, 3, 2, 1, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 1, 2, 3, 2, 1, 
-    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 
-    1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 
-    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 
-    0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 
-    0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 
-    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 
-    0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 
-    1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 
-    0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 
-    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-    -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 
-    0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 
-    1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 
-    1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 
-    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 
-    1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 
-    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 
-    -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 
+const int snare_packed_len = 14720;
+const uint8_t snare_packed[] = {
+    0x97, 0x85, 0x0f, 0x00, 0x1c, 0x28, 0x30, 0xc0, 0x08, 0x28, 0x81, 0x49, 0x08, 0x85, 0xb1, 0x31,
+    0x3c, 0x78, 0x74, 0x63, 0x91, 0x3f, 0x6e, 0x7a, 0xfc, 0x3c, 0xe6, 0xd9, 0xb6, 0x57, 0x3f, 0xea,
+    0x7e, 0xfa, 0xde, 0xae, 0x4c, 0x83, 0x29, 0x9c, 0x91, 0xb5, 0x03, 0x2b, 0xf9, 0x30, 0xc0, 0xd3,
+    0xd3, 0xe3, 0xe0, 0xed, 0xc2, 0x2f, 0xf5, 0x21, 0x4f, 0x98, 0xac, 0x1c, 0x12, 0x77, 0x04, 0xa4,
+    0xd1, 0x55, 0x93, 0x7c, 0x2e, 0x44, 0xf9, 0xf0, 0xee, 0x11, 0xfb, 0x1c, 0x44, 0x6b, 0xe7, 0x33,
+    0xeb, 0x9f, 0xc7, 0xbf, 0xf0, 0xdc, 0xfc, 0xf1, 0xb9, 0x53, 0xf9, 0x61, 0xa2, 0x2f, 0x70, 0x48,
+    0x62, 0xf3, 0x83, 0x4f, 0x51, 0x5a, 0xe7, 0x61, 0x3b, 0xc8, 0xc9, 0x85, 0xd8, 0x6e, 0xcb, 0xc6,
+    0xa9, 0x7d, 0xe0, 0xb9, 0x45, 0x77, 0xe5, 0xd5, 0xed, 0x34, 0x06, 0xc8, 0xcf, 0x1c, 0xa7, 0x17,
+    0x90, 0x2c, 0xde, 0xdb, 0x2c, 0x44, 0xb8, 0x8d, 0x75, 0x6c, 0x37, 0x53, 0xe3, 0xca, 0x74, 0xee,
+    0x0a, 0x15, 0x8b, 0x8c, 0x72, 0x73, 0xf1, 0x78, 0x0c, 0xaa, 0xa6, 0x3c, 0xc3, 0x05, 0xa8, 0x16,
+    0x27, 0xd2, 0x25, 0x34, 0xb8, 0x7c, 0xde, 0xc8, 0xb9, 0x62, 0xd1, 0x57, 0xea, 0x59, 0xf9, 0x33,
+    0x7a, 0x6f, 0xf9, 0x55, 0x88, 0xe9, 0x01, 0x4c, 0x81, 0x2c, 0x8e, 0xe8, 0x6c, 0x84, 0x28, 0x46,
+    0x80, 0x7c, 0x1a, 0x98, 0xdd, 0x14, 0xf4, 0x2c, 0x98, 0xb6, 0xb7, 0xb1, 0x63, 0x55, 0x00, 0xff,
+    0x06, 0x17, 0xf5, 0x5a, 0xad, 0xd4, 0x11, 0xb7, 0xa2, 0x6c, 0xc4, 0xe2, 0xe5, 0x68, 0x28, 0x28,
+    0x1a, 0x91, 0x53, 0x04, 0x59, 0x5e, 0xab, 0x16, 0x7c, 0x12, 0x95, 0xf9, 0x69, 0xba, 0x9d, 0x83,
+    0xa9, 0x9a, 0xd1, 0x79, 0xae, 0x72, 0xc0, 0xe2, 0x99, 0xa1, 0x3f, 0xe5, 0xb2, 0x74, 0xdc, 0x99,
+    0x14, 0x08, 0xa1, 0x0a, 0xf0, 0x69, 0x02, 0x54, 0x17, 0x4b, 0xb4, 0xc1, 0xf4, 0x94, 0xa7, 0xc7,
+    0xa1, 0xaf, 0xcd, 0x95, 0x8e, 0x7a, 0x01, 0x67, 0xc8, 0x25, 0x8a, 0x0c, 0x18, 0x66, 0x51, 0xe3,
+    0xfd, 0x02, 0x2f, 0xc0, 0x5f, 0xbd, 0x4b, 0x7c, 0xdd, 0x9a, 0xd6, 0xc6, 0x28, 0x8b, 0xc1, 0x4c,
+    0x2b, 0x01, 0x20, 0x0c, 0x00, 0xc4, 0xbd, 0x2c, 0x8e, 0x64, 0xd9, 0x7b, 0x74, 0xde, 0xa0, 0xbf,
+    0xcc, 0xdd, 0xb9, 0xe3, 0xf0, 0x41, 0x06, 0x04, 0xe8, 0x27, 0xd3, 0x1c, 0xee, 0x31, 0x9b, 0x65,
+    0x6f, 0x73, 0xec, 0x0e, 0x2c, 0x91, 0x78, 0x1b, 0x21, 0x44, 0x37, 0x38, 0x60, 0x25, 0xf4, 0x9b,
+    0xe8, 0xb5, 0x7f, 0xee, 0x9e, 0xf8, 0x5c, 0xf9, 0xe2, 0x72, 0xa0, 0xd8, 0xdf, 0xc2, 0x44, 0xe8,
+    0x61, 0x88, 0x74, 0x06, 0x64, 0x4c, 0x02, 0xd6, 0x97, 0x6b, 0xc8, 0xd6, 0xd3, 0x19, 0x86, 0x67,
+    0x25, 0x49, 0xe6, 0xf8, 0x0e, 0xd0, 0x2d, 0x7d, 0xb8, 0xe4, 0x77, 0x7a, 0x71, 0xff, 0x1f, 0xba,
+    0x2f, 0x9c, 0x92, 0x53, 0x95, 0x8c, 0x8a, 0x27, 0x2c, 0xb6, 0xc7, 0x10, 0x1f, 0x41, 0xb2, 0x3a,
+    0xa5, 0x46, 0x4a, 0xa3, 0xfe, 0x13, 0x63, 0x36, 0x0f, 0xa4, 0x1a, 0x0b, 0x99, 0x50, 0x15, 0x57,
+    0x08, 0xfa, 0x05, 0xdb, 0x85, 0x58, 0xb1, 0x80, 0x3c, 0xe2, 0x65, 0x02, 0xc7, 0xb0, 0x65, 0x63,
+    0x70, 0x48, 0xae, 0x0c, 0x81, 0xd1, 0xf4, 0x83, 0xdb, 0x34, 0xb7, 0x3a, 0x2f, 0x78, 0x56, 0x6a,
+    0x13, 0xe1, 0x02, 0x1a, 0xcb, 0xe5, 0x14, 0x31, 0xba, 0xca, 0x22, 0x0a, 0x9a, 0x39, 0x4a, 0x0b,
+    0xc4, 0x97, 0x55, 0x90, 0x26, 0x2a, 0x11, 0x9f, 0x22, 0xca, 0x75, 0x44, 0xe1, 0x01, 0x07, 0xd0,
+    0xfc, 0xaa, 0x00, 0x85, 0xbc, 0x3c, 0x67, 0x92, 0x51, 0x29, 0x1a, 0x3f, 0xb5, 0x1c, 0xe5, 0xb8,
+    0xa9, 0xbd, 0x54, 0xd7, 0xb3, 0xce, 0x29, 0x52, 0xb9, 0xf3, 0xeb, 0x52, 0xac, 0xf0, 0xe0, 0xec,
+    0x45, 0xaa, 0x16, 0x7e, 0x7c, 0x0e, 0xcb, 0x14, 0xed, 0x8c, 0xe8, 0x8e, 0x04, 0xb8, 0x47, 0x02,
+    0x58, 0x0d, 0x80, 0x10, 0x0c, 0x00, 0x84, 0x12, 0xc0, 0xa0, 0xe7, 0x63, 0x02, 0x01, 0xf3, 0x36,
+    0x74, 0x83, 0xd4, 0x03, 0x51, 0x48, 0xc2, 0xa9, 0x50, 0x7c, 0xa3, 0xef, 0x12, 0x26, 0x9d, 0xd1,
+    0xbb, 0x41, 0x6d, 0x47, 0xd3, 0x84, 0x60, 0xd5, 0xe1, 0x6a, 0x90, 0x00, 0x6e, 0x91, 0xad, 0x20,
+    0xdb, 0x19, 0xfb, 0x8e, 0xb0, 0x72, 0xab, 0xd5, 0x65, 0xee, 0x1b, 0xfd, 0x77, 0x58, 0x3e, 0x00,
+    0x19, 0x38, 0x23, 0x7c, 0x0c, 0x52, 0x38, 0x7e, 0x04, 0xa0, 0x4f, 0x01, 0xb8, 0x22, 0x00, 0x2c,
+    0x21, 0x81, 0x38, 0xb4, 0x4e, 0x96, 0x14, 0x51, 0xa6, 0x83, 0x5c, 0x43, 0xc6, 0xf0, 0x19, 0x94,
+    0x0c, 0xcb, 0xab, 0x74, 0x07, 0x53, 0xf3, 0x62, 0xf5, 0x5f, 0x07, 0x08, 0xed, 0x35, 0x71, 0xe3,
+    0x06, 0xba, 0x2e, 0x68, 0xa8, 0x6e, 0xbd, 0x7a, 0x76, 0x2b, 0x39, 0x3c, 0x44, 0x85, 0xa1, 0x66,
+    0x62, 0x49, 0x53, 0xee, 0x18, 0x10, 0x15, 0xfa, 0x59, 0x99, 0xcf, 0xa3, 0xa4, 0x90, 0x36, 0x79,
+    0x5e, 0xb0, 0xf5, 0x85, 0xcd, 0x61, 0x92, 0xf0, 0xce, 0x48, 0xc8, 0x30, 0x46, 0xae, 0x55, 0x22,
+    0x35, 0x5e, 0xac, 0xf3, 0xa2, 0xf5, 0xec, 0x4b, 0x80, 0x1f, 0x82, 0x01, 0x16, 0xee, 0x46, 0x39,
+    0x8c, 0x48, 0x3f, 0x44, 0xf0, 0x29, 0x82, 0x0c, 0x02, 0xc0, 0xbc, 0x05, 0x80, 0xce, 0x7a, 0x61,
+    0x4b, 0x05, 0xe3, 0xa3, 0x9a, 0x7a, 0xe3, 0x43, 0xf0, 0x6b, 0x86, 0xc8, 0x0e, 0xc6, 0x0c, 0x75,
+    0xc6, 0x54, 0x80, 0xc2, 0xda, 0xaf, 0x89, 0xa5, 0xa2, 0x6e, 0x74, 0x69, 0xc7, 0x13, 0xa9, 0xd9,
+    0x0b, 0x69, 0x3b, 0x81, 0xe0, 0x71, 0x2a, 0x82, 0x9e, 0x17, 0x01, 0x29, 0x06, 0xd0, 0x34, 0x89,
+    0xc8, 0xec, 0x8d, 0x49, 0xd7, 0xba, 0x25, 0x20, 0xa6, 0xbb, 0x99, 0x2c, 0xa4, 0xc8, 0x36, 0x0f,
+    0x04, 0x6c, 0x16, 0xac, 0x60, 0xea, 0xc8, 0x7c, 0x4b, 0x43, 0x0c, 0x15, 0x61, 0x3a, 0x25, 0xe2,
+    0x9a, 0x3d, 0xa2, 0xa2, 0x1d, 0xe2, 0x1b, 0x57, 0x45, 0x40, 0xd3, 0x8e, 0xe3, 0xab, 0x56, 0x7d,
+    0x52, 0x8a, 0x3b, 0xc2, 0xd0, 0x1c, 0x81, 0x84, 0x15, 0xa0, 0x0b, 0x3d, 0x75, 0xfb, 0x2f, 0x07,
+    0x26, 0xac, 0x95, 0xc3, 0xae, 0x37, 0xc5, 0x14, 0xa8, 0x4f, 0xb8, 0x8a, 0x08, 0x48, 0x3f, 0x03,
+    0x48, 0x19, 0x01, 0x90, 0x0a, 0x00, 0x68, 0x11, 0x8a, 0xd5, 0x75, 0x43, 0x66, 0xc2, 0xd9, 0xc1,
+    0x1a, 0x3e, 0xdd, 0xb1, 0x41, 0x40, 0x62, 0xb2, 0x20, 0x01, 0x32, 0x3d, 0x75, 0xdb, 0x93, 0x36,
+    0x63, 0x49, 0x2f, 0x85, 0xba, 0xbb, 0x9c, 0xb8, 0x72, 0xc0, 0x79, 0xca, 0x0e, 0xd8, 0x18, 0x03,
+    0x32, 0x93, 0x82, 0xe5, 0xa6, 0xcd, 0x2f, 0xcc, 0xcc, 0xc7, 0x16, 0x30, 0xe1, 0x01, 0xd9, 0x4b,
+    0x47, 0x25, 0xab, 0x18, 0xa8, 0xbf, 0x88, 0xd8, 0x01, 0x84, 0xec, 0x6f, 0xc4, 0xf4, 0x61, 0x43,
+    0x94, 0x9d, 0xcf, 0x52, 0xb5, 0xcd, 0xa3, 0xa5, 0x7b, 0xb1, 0x85, 0xeb, 0xc5, 0x18, 0x70, 0xec,
+    0xc4, 0x2b, 0x13, 0xe1, 0x6f, 0xc5, 0x64, 0xe4, 0xc1, 0x0c, 0x70, 0x5b, 0xfa, 0x01, 0x17, 0x82,
+    0x46, 0x6e, 0x03, 0x76, 0xb5, 0x38, 0x83, 0x34, 0x22, 0x81, 0x20, 0x11, 0xe0, 0xe0, 0x02, 0xd0,
+    0x41, 0x01, 0x00, 0x18, 0x00, 0x10, 0xfd, 0x2a, 0xd2, 0xea, 0x5b, 0x86, 0x3f, 0x68, 0x95, 0xd6,
+    0xb2, 0x85, 0x28, 0xa4, 0xe3, 0xb0, 0xcc, 0x7f, 0xd3, 0x0b, 0x22, 0x84, 0x7c, 0xc5, 0x25, 0x4d,
+    0xe4, 0xc1, 0x92, 0xa3, 0xba, 0x70, 0x55, 0xcc, 0x6e, 0xef, 0xda, 0x6e, 0x4d, 0x97, 0x49, 0xb2,
+    0xda, 0xa8, 0xd6, 0x75, 0x45, 0x85, 0xc3, 0xd6, 0x71, 0xe9, 0x08, 0xad, 0x48, 0xe0, 0x02, 0x42,
+    0xb2, 0x0e, 0x21, 0xcc, 0x4f, 0xc0, 0x4c, 0x65, 0xe7, 0x4a, 0xc4, 0x92, 0xd4, 0x87, 0xad, 0xdd,
+    0xe6, 0x99, 0x9f, 0x24, 0x50, 0xf7, 0xb9, 0x15, 0xd9, 0x78, 0x4b, 0xdb, 0x38, 0x23, 0x6b, 0xe9,
+    0xaf, 0x51, 0x91, 0x50, 0x88, 0xb6, 0x4b, 0xd4, 0x4c, 0xb5, 0x8e, 0x2e, 0x65, 0x90, 0x8f, 0xc1,
+    0xa0, 0x07, 0x88, 0x2e, 0x49, 0x95, 0xc0, 0x16, 0xcc, 0x6a, 0x4c, 0x6e, 0xa9, 0x53, 0xd4, 0x1e,
+    0x2c, 0xf3, 0xe4, 0x5f, 0x98, 0x12, 0x95, 0x5d, 0x45, 0xae, 0xc7, 0xf0, 0xab, 0x10, 0x31, 0x35,
+    0x08, 0x30, 0xe2, 0x58, 0x94, 0xe4, 0x4d, 0x19, 0x86, 0x8b, 0x38, 0x19, 0xc4, 0xd2, 0x79, 0x8f,
+    0x49, 0x82, 0x2e, 0x57, 0xa4, 0x5a, 0xd0, 0x00, 0x2c, 0x23, 0x2c, 0x50, 0x14, 0x28, 0x9a, 0x54,
+    0x54, 0xa0, 0xb4, 0xe4, 0xdc, 0xf4, 0x3b, 0x19, 0x54, 0x74, 0x1a, 0x20, 0x36, 0x05, 0x42, 0xf0,
+    0x21, 0xe0, 0x6a, 0x03, 0xa0, 0x0c, 0x3c, 0xe2, 0xc0, 0x67, 0xd6, 0xcf, 0x04, 0xf0, 0x5b, 0x38,
+    0xf6, 0xbe, 0x61, 0x89, 0x6d, 0xa8, 0x45, 0x7b, 0x22, 0xb6, 0xb1, 0x70, 0x50, 0x6e, 0x48, 0x31,
+    0xe6, 0x16, 0x51, 0xf6, 0x16, 0xc4, 0xc0, 0x93, 0x32, 0x7f, 0x9d, 0xe8, 0xe2, 0x31, 0x93, 0x57,
+    0x16, 0xf0, 0xc3, 0x06, 0x50, 0x8a, 0x90, 0xd8, 0xb9, 0x8f, 0xd0, 0xae, 0xa0, 0x6a, 0x02, 0x12,
+    0xd4, 0x1d, 0x4c, 0xce, 0x7b, 0x57, 0xd0, 0x55, 0xfe, 0x6b, 0xf6, 0x7b, 0x9f, 0x15, 0x5b, 0x87,
+    0x1d, 0x13, 0xc4, 0x80, 0xd4, 0x93, 0xc1, 0x02, 0x07, 0x98, 0x22, 0x03, 0x44, 0x4d, 0x44, 0x2c,
+    0x4f, 0x46, 0x24, 0x46, 0xc1, 0x3c, 0x09, 0xc6, 0x14, 0x09, 0x0a, 0x6d, 0x6d, 0xb4, 0xb2, 0x35,
+    0x7f, 0x05, 0xfc, 0xf5, 0x4c, 0x82, 0x5f, 0x90, 0xa8, 0x87, 0x92, 0x96, 0x10, 0xd0, 0xa3, 0x0a,
+    0x70, 0x7e, 0x86, 0xb4, 0x43, 0x8b, 0x7f, 0x15, 0xd8, 0x69, 0x82, 0x42, 0x08, 0x1b, 0x70, 0x1b,
+    0x9c, 0xe8, 0xc1, 0x25, 0xa3, 0x90, 0x4c, 0x48, 0x56, 0xdf, 0x66, 0x67, 0x78, 0xb4, 0x82, 0xeb,
+    0xc7, 0x4d, 0xd2, 0xc8, 0x84, 0x1b, 0x0e, 0x30, 0x04, 0x0c, 0x03, 0x1c, 0x69, 0x25, 0x15, 0x7d,
+    0xb3, 0x59, 0x83, 0x38, 0x31, 0xc2, 0x68, 0xaf, 0x82, 0xd4, 0x98, 0x8f, 0xe0, 0x68, 0x80, 0x1e,
+    0x45, 0x56, 0x9e, 0xa4, 0xcf, 0x56, 0x3b, 0x5b, 0x8d, 0x06, 0x51, 0xd7, 0x48, 0x8c, 0x3c, 0x4d,
+    0x53, 0x99, 0x48, 0x9a, 0x18, 0x9c, 0x95, 0xec, 0x69, 0x99, 0xce, 0xae, 0x71, 0x5c, 0x88, 0xf3,
+    0x66, 0x80, 0xaa, 0xaf, 0x46, 0x41, 0x2d, 0xa7, 0x7e, 0x2a, 0x6d, 0x9d, 0x34, 0xfa, 0x4a, 0xa2,
+    0x18, 0x34, 0x4c, 0x39, 0x95, 0x97, 0x7c, 0x30, 0x92, 0x80, 0x1a, 0xac, 0xf5, 0x32, 0x6c, 0x96,
+    0xe7, 0x5a, 0x2a, 0xa2, 0xa3, 0x7a, 0x40, 0x64, 0xc7, 0xec, 0x43, 0x22, 0xfd, 0x6e, 0x86, 0x40,
+    0xd7, 0x65, 0xdb, 0x60, 0xb4, 0xee, 0xf0, 0xd1, 0x13, 0xc5, 0x50, 0x4a, 0x61, 0x7c, 0x0c, 0x40,
+    0x16, 0x30, 0x53, 0x55, 0x22, 0x05, 0x02, 0x7d, 0x66, 0x7c, 0x48, 0x55, 0xcb, 0x03, 0xd0, 0x91,
+    0x13, 0x71, 0x41, 0x23, 0x11, 0xb3, 0x45, 0x08, 0x34, 0x40, 0xb1, 0x20, 0xf7, 0x19, 0xb1, 0xeb,
+    0xc4, 0x43, 0xa0, 0xb4, 0x06, 0x18, 0x3d, 0x08, 0x81, 0x0c, 0x04, 0x21, 0x11, 0xc2, 0xd2, 0xb3,
+    0x48, 0x65, 0x2d, 0x95, 0xe9, 0x05, 0xb1, 0x0b, 0x09, 0x70, 0xa8, 0x61, 0x91, 0x9b, 0xc5, 0xc8,
+    0x60, 0x31, 0x25, 0x37, 0x96, 0x78, 0x57, 0x61, 0xe9, 0x95, 0xb9, 0xe4, 0x8f, 0xa1, 0x16, 0x97,
+    0x93, 0x34, 0x2b, 0x12, 0x85, 0x1e, 0x93, 0x41, 0x0f, 0x6d, 0x03, 0x51, 0xb4, 0x3f, 0x00, 0x54,
+    0x3c, 0x00, 0xa8, 0x40, 0xc0, 0x0c, 0x38, 0xc0, 0x88, 0x54, 0x20, 0xc9, 0x87, 0x64, 0x47, 0xfc,
+    0x0c, 0x54, 0xf6, 0x5b, 0x41, 0x42, 0x81, 0xcf, 0x60, 0x9b, 0xe3, 0xc6, 0xf3, 0x93, 0xe4, 0xc5,
+    0xe1, 0xf5, 0xfa, 0xfc, 0xb3, 0x4b, 0xcb, 0x15, 0xd0, 0xbb, 0x03, 0xf8, 0x98, 0x10, 0x02, 0xa7,
+    0x8b, 0xfc, 0x11, 0x8a, 0x2d, 0xfb, 0xe0, 0xa5, 0x9c, 0x25, 0x01, 0xb4, 0x8b, 0x95, 0xfd, 0x45,
+    0xdd, 0x47, 0x81, 0xec, 0x18, 0xb2, 0x1a, 0xbe, 0x2e, 0x6a, 0xec, 0xd8, 0x08, 0x41, 0xe0, 0xd6,
+    0x00, 0x5c, 0xa2, 0xab, 0x3d, 0x35, 0x59, 0xe7, 0x23, 0xf9, 0xf3, 0xd1, 0xf5, 0xdb, 0x34, 0x1e,
+    0x3e, 0xb9, 0xcc, 0xfa, 0xab, 0xf9, 0xc5, 0x34, 0x51, 0xeb, 0x3a, 0x7d, 0x83, 0x7f, 0x21, 0x91,
+    0xa1, 0xfc, 0x23, 0xf3, 0x83, 0x7c, 0x04, 0x6a, 0x01, 0x36, 0x91, 0x3b, 0x79, 0x7d, 0xb3, 0x0e,
+    0x55, 0xbd, 0x62, 0x6b, 0xcf, 0xfe, 0x08, 0xf1, 0x29, 0xe2, 0x13, 0xd6, 0x2c, 0xab, 0xe2, 0x78,
+    0x5b, 0x77, 0x55, 0xec, 0x9b, 0xe2, 0x9f, 0xfc, 0x87, 0xda, 0x27, 0x88, 0x2a, 0xdd, 0xc0, 0x08,
+    0xca, 0xc1, 0x46, 0x55, 0x9d, 0x60, 0xfc, 0x04, 0x84, 0xec, 0x74, 0x87, 0xe1, 0x62, 0xbe, 0xce,
+    0x29, 0x93, 0xb1, 0x6f, 0x45, 0x11, 0x93, 0xfd, 0xf7, 0xfa, 0x27, 0x93, 0xed, 0xb8, 0x6b, 0xc2,
+    0xb0, 0x83, 0x0a, 0x81, 0x0c, 0x04, 0xd8, 0x6f, 0x00, 0x63, 0x26, 0x41, 0x4d, 0xe0, 0x56, 0x90,
+    0xd6, 0x1d, 0xaf, 0xa6, 0xcb, 0x9d, 0x32, 0xca, 0x19, 0x95, 0x12, 0x8e, 0x68, 0x77, 0xa7, 0x8d,
+    0x72, 0x8f, 0xc1, 0x57, 0xea, 0xbb, 0x37, 0x5f, 0x98, 0x5e, 0x86, 0x66, 0x61, 0x0c, 0x9c, 0x90,
+    0x5b, 0x30, 0xa2, 0x4b, 0x2e, 0x98, 0xa4, 0x81, 0x60, 0xfa, 0x7d, 0xce, 0xa8, 0xe3, 0x02, 0x04,
+    0x8f, 0x9c, 0x2d, 0xc4, 0x7e, 0x06, 0xff, 0xd5, 0xdd, 0xab, 0xfa, 0xec, 0xf4, 0x25, 0x18, 0x85,
+    0x0d, 0x1a, 0x7b, 0xf8, 0xb8, 0xef, 0xf2, 0x97, 0xf7, 0xcb, 0x4f, 0x98, 0x5e, 0x39, 0x43, 0xa3,
+    0x7b, 0x18, 0xea, 0xdc, 0xdf, 0x22, 0xa3, 0xff, 0x38, 0x1a, 0x74, 0x0d, 0x49, 0xf4, 0x27, 0x08,
+    0x60, 0xa8, 0x11, 0xed, 0x32, 0xf4, 0xba, 0xa1, 0xfb, 0xdb, 0xc1, 0x4b, 0x6a, 0xbc, 0x0c, 0x75,
+    0x42, 0x60, 0x35, 0x17, 0x6b, 0x65, 0x3d, 0x6e, 0x88, 0x5a, 0x72, 0x53, 0x99, 0xbb, 0xa0, 0xfc,
+    0x53, 0x37, 0x8f, 0xdf, 0x7f, 0x55, 0xf6, 0xfd, 0xbe, 0x0f, 0x92, 0xa7, 0x91, 0xfe, 0x39, 0xfd,
+    0x39, 0xfd, 0xb4, 0x7d, 0xf5, 0x78, 0xcf, 0xfe, 0x09, 0x73, 0x15, 0xfe, 0x09, 0x19, 0x07, 0xe6,
+    0xd7, 0x62, 0x33, 0x30, 0xe4, 0x9d, 0xa2, 0x8b, 0x9a, 0x77, 0xcd, 0x89, 0xce, 0x4e, 0x3e, 0x45,
+    0xb8, 0xeb, 0xff, 0x2d, 0x6f, 0x2e, 0x64, 0x1c, 0x59, 0xfb, 0xb8, 0xcc, 0x66, 0x41, 0x57, 0x6f,
+    0x1b, 0xf4, 0xfe, 0xe5, 0x7f, 0xc0, 0x0f, 0x8f, 0x8f, 0xec, 0x51, 0x03, 0xfe, 0x51, 0x69, 0x5f,
+    0x0b, 0xca, 0x50, 0xec, 0x11, 0x21, 0xac, 0xb7, 0x0e, 0xd1, 0x17, 0x3f, 0xe0, 0x4c, 0x08, 0x06,
+    0x30, 0xbc, 0x2d, 0x02, 0xc0, 0x08, 0x01, 0x21, 0x1c, 0x38, 0x82, 0x10, 0x72, 0xa6, 0xc6, 0x84,
+    0x0e, 0x19, 0x14, 0x2e, 0x1c, 0x85, 0xf3, 0x47, 0xcc, 0x0c, 0xad, 0x7e, 0x89, 0x2f, 0x6b, 0xef,
+    0xdf, 0xc2, 0x2b, 0x78, 0x09, 0xf0, 0x36, 0xde, 0x32, 0x11, 0x34, 0xcd, 0x99, 0x71, 0x21, 0x96,
+    0x42, 0xfc, 0x52, 0xe7, 0xbc, 0x03, 0xbd, 0xff, 0x6e, 0xbf, 0x9e, 0x3e, 0xd9, 0xbc, 0x29, 0x5c,
+    0x44, 0xa7, 0x2a, 0xa0, 0xae, 0xda, 0x47, 0x18, 0x64, 0x02, 0xa0, 0x94, 0x27, 0x88, 0x70, 0x02,
+    0x4d, 0x99, 0x2e, 0xe6, 0x3e, 0x1d, 0x3d, 0xcf, 0xff, 0xda, 0xbd, 0x32, 0xe4, 0x22, 0xfe, 0xbe,
+    0x76, 0xb6, 0x25, 0xea, 0x8f, 0x28, 0xfc, 0x1e, 0x5a, 0x57, 0x26, 0x5e, 0x6b, 0x3e, 0x25, 0x7f,
+    0xf0, 0x37, 0x27, 0x3e, 0x5f, 0xb3, 0xd1, 0x0f, 0x04, 0x0a, 0x10, 0xbc, 0xb7, 0x2d, 0xaf, 0xef,
+    0x87, 0xf1, 0x8b, 0x03, 0xd9, 0x02, 0x95, 0x26, 0xac, 0x61, 0x8f, 0x92, 0x54, 0x1e, 0xf5, 0x26,
+    0xd7, 0xe8, 0x6a, 0xe0, 0x9a, 0xb0, 0xcc, 0x00, 0x21, 0x04, 0x42, 0xa3, 0xf5, 0x6e, 0x4a, 0x51,
+    0xde, 0x4c, 0x3d, 0x95, 0x65, 0xbf, 0xfc, 0x93, 0xf4, 0xaa, 0xb5, 0xb8, 0x66, 0xe5, 0x6a, 0x47,
+    0x60, 0x67, 0xcb, 0xd7, 0xd3, 0x36, 0x5a, 0x7f, 0x33, 0xaa, 0xe6, 0x53, 0x80, 0x83, 0x7b, 0x89,
+    0x1a, 0xd0, 0xf9, 0x70, 0xe6, 0xe3, 0xf2, 0x1f, 0xfb, 0xc1, 0x69, 0x1f, 0x06, 0x9f, 0x6b, 0x58,
+    0xc7, 0xfe, 0xdb, 0x53, 0x16, 0xd8, 0x0a, 0xad, 0x91, 0x29, 0x9b, 0xbb, 0x62, 0x05, 0x51, 0x5e,
+    0x85, 0x6d, 0xd8, 0x40, 0xc6, 0xfa, 0x59, 0xaa, 0xfc, 0x00, 0x42, 0x9e, 0x69, 0xd8, 0x0f, 0x7b,
+    0x1d, 0xe1, 0x72, 0x7b, 0xe3, 0xec, 0xa0, 0x32, 0x21, 0x50, 0x60, 0x4e, 0x1e, 0x24, 0xac, 0x8a,
+    0xd3, 0xec, 0x1d, 0xd4, 0xc0, 0xdd, 0x8f, 0x7d, 0x54, 0x70, 0xb1, 0xea, 0xa7, 0xe2, 0x7c, 0x1f,
+    0x44, 0x51, 0xf8, 0x37, 0x03, 0x90, 0x36, 0x07, 0xc0, 0xe4, 0x0b, 0x01, 0x08, 0x04, 0x0d, 0x00,
+    0x04, 0x8a, 0x8d, 0x50, 0x2a, 0x01, 0x80, 0x40, 0x23, 0x0a, 0xc6, 0x3e, 0x20, 0x6b, 0x83, 0x4a,
+    0xd6, 0x93, 0x79, 0x27, 0xe8, 0x85, 0x13, 0x24, 0xf3, 0x67, 0xa1, 0x2b, 0x30, 0xd3, 0xec, 0xad,
+    0x03, 0xca, 0x8e, 0xf4, 0xe0, 0x07, 0xff, 0xcc, 0xbf, 0xa8, 0xfa, 0x3c, 0x97, 0x07, 0x30, 0x30,
+    0xa3, 0x76, 0x3a, 0x3e, 0xb7, 0x27, 0xcb, 0xeb, 0x77, 0xaa, 0xf0, 0xbd, 0x66, 0x19, 0x6e, 0x7f,
+    0x04, 0xb8, 0x43, 0x13, 0x73, 0x0a, 0x5d, 0x48, 0xf8, 0xcb, 0x15, 0xa1, 0x74, 0x77, 0xca, 0x77,
+    0xa4, 0xc0, 0xe1, 0xff, 0x12, 0xff, 0xbf, 0x1d, 0x73, 0x7c, 0xa7, 0x6a, 0x8b, 0xc0, 0x37, 0x7d,
+    0x5d, 0xc6, 0xfe, 0x82, 0xcd, 0x7d, 0xbf, 0x0d, 0x77, 0x7f, 0xd2, 0xd7, 0x45, 0x5c, 0xdd, 0xf9,
+    0xe9, 0x80, 0xb9, 0x70, 0xc6, 0x04, 0x1b, 0x71, 0x05, 0xe5, 0x93, 0xba, 0x3f, 0xf0, 0x6b, 0xc7,
+    0x2a, 0xf0, 0xd9, 0x46, 0xaf, 0xa3, 0x58, 0xb7, 0x09, 0x60, 0x72, 0x75, 0xf9, 0x9a, 0xf1, 0xe5,
+    0xf8, 0x39, 0xff, 0xc5, 0x0c, 0x28, 0xfa, 0xc4, 0xe4, 0xaa, 0x9c, 0x9a, 0x31, 0x64, 0x10, 0xc1,
+    0xd4, 0x46, 0x8f, 0x31, 0xba, 0x34, 0x49, 0xb8, 0x17, 0x41, 0x33, 0xf1, 0xf3, 0x61, 0x8b, 0xff,
+    0xfe, 0x65, 0xd3, 0x4f, 0xf5, 0x35, 0x37, 0x3a, 0xb1, 0xb7, 0x88, 0x52, 0x42, 0x07, 0x50, 0x73,
+    0x10, 0xf9, 0xa1, 0x50, 0x73, 0xf9, 0x50, 0x48, 0xb8, 0x64, 0x08, 0xf2, 0xb2, 0x5f, 0x4e, 0x39,
+    0xe5, 0x28, 0x7a, 0x82, 0xed, 0xbb, 0xa1, 0x7f, 0xf0, 0xeb, 0xa5, 0x5b, 0x9c, 0xe7, 0x53, 0x9e,
+    0xe0, 0xfb, 0x26, 0x27, 0x31, 0x39, 0x0e, 0x65, 0x0a, 0x13, 0xea, 0xb1, 0x5b, 0xe6, 0x3d, 0x85,
+    0x4d, 0x95, 0x56, 0x7a, 0x78, 0x0f, 0x7f, 0xd4, 0xef, 0xcc, 0x5c, 0xde, 0x77, 0x10, 0x86, 0x2c,
+    0x5c, 0x78, 0x01, 0x0a, 0x4d, 0x6c, 0xdf, 0x0c, 0xc0, 0x43, 0xea, 0x94, 0xaf, 0xed, 0xba, 0x1a,
+    0x94, 0x30, 0xb0, 0x07, 0xe2, 0x84, 0x54, 0x90, 0x70, 0x4a, 0xa4, 0x67, 0xc3, 0xe3, 0xc2, 0x40,
+    0xff, 0xe4, 0x97, 0xb6, 0x9d, 0x92, 0x43, 0x80, 0x2e, 0xe3, 0xb3, 0xe2, 0x6a, 0x05, 0xfd, 0x74,
+    0x90, 0x55, 0xb9, 0x35, 0x22, 0xbb, 0xcd, 0xd6, 0x86, 0x3e, 0x81, 0x7c, 0xe0, 0xdd, 0x66, 0xb9,
+    0x3a, 0xdc, 0xda, 0x27, 0xa1, 0x9f, 0x33, 0x6e, 0x48, 0x8d, 0xb6, 0x74, 0x85, 0x4d, 0x50, 0xfd,
+    0x8b, 0xd1, 0x35, 0xf3, 0x45, 0xb7, 0x4f, 0x35, 0x3e, 0xa9, 0xcf, 0xe9, 0x09, 0x3a, 0x18, 0xba,
+    0x9f, 0x01, 0x89, 0x61, 0x5d, 0xe8, 0x50, 0x7f, 0xf3, 0xd3, 0xd6, 0xf9, 0x8c, 0xbe, 0x0c, 0x9d,
+    0x46, 0xbc, 0x4b, 0xde, 0x45, 0x57, 0x2b, 0xc2, 0x74, 0x01, 0x43, 0x18, 0xd9, 0x11, 0x62, 0xfc,
+    0x1b, 0x8a, 0x30, 0x1c, 0x13, 0xc9, 0xef, 0x5c, 0x5e, 0x05, 0x3e, 0x45, 0xff, 0xc5, 0xe9, 0x73,
+    0xd9, 0x65, 0x33, 0x4a, 0x32, 0x56, 0x33, 0xc2, 0x68, 0x21, 0x03, 0xb0, 0xde, 0x20, 0x45, 0x88,
+    0xab, 0x48, 0x76, 0x72, 0x17, 0xfd, 0x81, 0x5f, 0x27, 0xb7, 0xfe, 0x98, 0xcb, 0x0c, 0xa2, 0x66,
+    0x02, 0x3c, 0x8c, 0xb0, 0xde, 0x10, 0xa1, 0x14, 0x6f, 0x87, 0x92, 0x2b, 0x18, 0x9e, 0x12, 0xa0,
+    0xbf, 0xfd, 0x00, 0xe3, 0xcf, 0xe3, 0x48, 0x54, 0x4a, 0x3c, 0xa2, 0x23, 0x03, 0x90, 0x2a, 0x03,
+    0xb0, 0x6a, 0x5f, 0x76, 0xae, 0x23, 0xb0, 0x0d, 0x06, 0x01, 0x84, 0xb9, 0x71, 0x79, 0x1c, 0xdf,
+    0xbb, 0xff, 0x53, 0x7e, 0x4a, 0xa9, 0xeb, 0x70, 0x24, 0x96, 0x49, 0x1a, 0x61, 0x9c, 0x6a, 0x2c,
+    0xbe, 0x46, 0x2d, 0xfa, 0x04, 0x0a, 0x91, 0x59, 0xd2, 0x37, 0x4e, 0xde, 0x63, 0xff, 0xbb, 0x5c,
+    0x08, 0xf1, 0xa5, 0x4d, 0xd5, 0xbf, 0xc3, 0x17, 0x87, 0xae, 0x84, 0x78, 0x79, 0x5f, 0xc7, 0x90,
+    0x98, 0x10, 0xe1, 0x30, 0x2c, 0xe7, 0x15, 0x37, 0xd5, 0x55, 0x95, 0x29, 0x22, 0x80, 0x04, 0x47,
+    0x5e, 0xf1, 0xb8, 0x20, 0xfb, 0x7b, 0xfe, 0xb1, 0xe9, 0xd3, 0x80, 0x02, 0xbc, 0x7a, 0xa9, 0x1d,
+    0xbc, 0x7c, 0xfb, 0x65, 0x83, 0xeb, 0x17, 0xc3, 0x1e, 0x9a, 0xa0, 0x18, 0x39, 0x2d, 0x4a, 0xf5,
+    0x52, 0xa9, 0xe0, 0x0f, 0x05, 0x80, 0x4c, 0x02, 0x42, 0x20, 0x7f, 0x7b, 0xf1, 0xaa, 0xa9, 0xae,
+    0x6a, 0x2c, 0x0c, 0xc0, 0x74, 0x0c, 0xa2, 0xf4, 0x60, 0x8d, 0x90, 0xb2, 0x79, 0xd5, 0xe7, 0x9d,
+    0xa8, 0xb8, 0xfe, 0x55, 0x7e, 0xa4, 0xe4, 0x6b, 0x3d, 0x0c, 0xf8, 0xf3, 0x67, 0xe2, 0x6e, 0x2b,
+    0x15, 0xaa, 0x95, 0x00, 0x20, 0x0c, 0x02, 0xc8, 0x55, 0x11, 0x62, 0x04, 0x1d, 0xac, 0x5a, 0x9f,
+    0x16, 0xb6, 0x31, 0x29, 0xc7, 0x60, 0x56, 0x08, 0xd1, 0x86, 0x3d, 0x46, 0xa8, 0x9f, 0x16, 0x20,
+    0x70, 0xb2, 0xe7, 0xc3, 0xdf, 0x47, 0x45, 0x7f, 0xf2, 0x0f, 0x1e, 0x7c, 0xed, 0x54, 0xc4, 0x9f,
+    0x2e, 0x23, 0x60, 0x49, 0x83, 0xf0, 0x62, 0x01, 0xa0, 0x74, 0x35, 0x87, 0xb1, 0x42, 0x27, 0xc5,
+    0x28, 0x9b, 0x13, 0x22, 0x0c, 0x3d, 0x86, 0x30, 0xae, 0x0a, 0x41, 0x2a, 0xd5, 0x9b, 0x18, 0xc2,
+    0xf2, 0xf4, 0x98, 0xbc, 0x16, 0xd5, 0xcb, 0x7c, 0x41, 0x81, 0x21, 0x34, 0xaa, 0xc9, 0xc4, 0x9a,
+    0x99, 0x99, 0xa4, 0x0a, 0x18, 0x40, 0x02, 0x60, 0x3b, 0x8e, 0x92, 0x76, 0x3f, 0x4a, 0x68, 0x7d,
+    0x37, 0xa1, 0x0f, 0xbf, 0xed, 0xd1, 0x7f, 0x11, 0x3f, 0xd3, 0x3e, 0x60, 0xb6, 0xa8, 0xfc, 0x20,
+    0xe0, 0xe6, 0x07, 0xab, 0x0d, 0x14, 0x19, 0x0a, 0x66, 0xc7, 0x20, 0x26, 0x0d, 0x92, 0x1e, 0x58,
+    0xc9, 0xa9, 0x15, 0x21, 0xe2, 0x6c, 0x6b, 0x82, 0x11, 0x42, 0x30, 0x3c, 0x59, 0x69, 0xe3, 0xf8,
+    0x79, 0xfe, 0x96, 0xc8, 0x27, 0x11, 0xdc, 0x35, 0x63, 0xd9, 0x57, 0x52, 0xe7, 0x75, 0x8a, 0x77,
+    0xf8, 0xa7, 0xb1, 0x7a, 0x0a, 0xa2, 0xf4, 0x8f, 0x38, 0x5d, 0x7a, 0x78, 0x9c, 0xc1, 0xef, 0xd9,
+    0x8e, 0x47, 0xdc, 0xc5, 0xb0, 0x5c, 0x72, 0x34, 0x7c, 0xdc, 0xbf, 0x00, 0xaf, 0xe0, 0x27, 0x63,
+    0xbe, 0x95, 0x0c, 0xe6, 0xe5, 0xce, 0xfa, 0xb8, 0xc8, 0xd5, 0x6e, 0x57, 0x1d, 0x82, 0xd2, 0xf6,
+    0x25, 0x1d, 0xdc, 0xfb, 0x87, 0xe1, 0xf4, 0xb6, 0x68, 0x26, 0xbe, 0xbb, 0xec, 0xb8, 0x1f, 0x54,
+    0x73, 0xfd, 0xf4, 0xa0, 0x74, 0x3e, 0x22, 0x72, 0x9f, 0x06, 0xc6, 0xb5, 0xb2, 0xbc, 0xcc, 0x00,
+    0x46, 0x70, 0x50, 0xbe, 0x2f, 0x0f, 0xda, 0x4d, 0xfe, 0x8e, 0x68, 0xd6, 0xee, 0x1a, 0x23, 0x6c,
+    0x3a, 0x44, 0xc0, 0x64, 0x05, 0xe0, 0xfc, 0x6d, 0x66, 0x84, 0xb3, 0xd5, 0x14, 0xbe, 0x16, 0x40,
+    0xa0, 0x38, 0xca, 0x39, 0x57, 0x1b, 0xbb, 0x22, 0xce, 0xd7, 0xd1, 0x3f, 0xf7, 0xea, 0xf4, 0xbf,
+    0x38, 0x07, 0xcb, 0xaf, 0xd3, 0xe1, 0xd6, 0xf7, 0x82, 0x64, 0x09, 0xfa, 0x0d, 0x95, 0xc2, 0x2f,
+    0xcd, 0xa7, 0x44, 0x9e, 0x0d, 0xfc, 0x5b, 0xd3, 0xe7, 0x94, 0x4e, 0xe8, 0x25, 0x47, 0xf2, 0x4f,
+    0x9f, 0xdc, 0xf8, 0x4d, 0xa5, 0x04, 0x8f, 0xdb, 0x14, 0x8e, 0x8e, 0x3b, 0x34, 0xc9, 0xe8, 0xef,
+    0xec, 0x4c, 0x94, 0xcd, 0x93, 0x58, 0x12, 0x88, 0xd6, 0x80, 0xb0, 0x5d, 0x15, 0x79, 0x9b, 0x77,
+    0x2e, 0x92, 0xd2, 0x9f, 0xb1, 0x80, 0x06, 0x82, 0xac, 0x6b, 0x91, 0x11, 0x9a, 0x39, 0xc3, 0xf8,
+    0xa9, 0x03, 0xe1, 0xb4, 0x55, 0xf4, 0x9d, 0xd7, 0x67, 0xe5, 0xdf, 0xfe, 0x16, 0xd5, 0xc7, 0xd1,
+    0xa7, 0xd8, 0xd4, 0x32, 0x7c, 0x70, 0xd4, 0xcd, 0x51, 0x1e, 0xc3, 0x68, 0x7b, 0x40, 0xae, 0x4f,
+    0x8a, 0xa6, 0xb3, 0x6c, 0xcc, 0x2d, 0x65, 0x33, 0xcf, 0x40, 0xf4, 0xf9, 0xc5, 0xd7, 0x79, 0x3e,
+    0x50, 0xf2, 0x11, 0xe2, 0xf3, 0x8e, 0x4e, 0x76, 0xfe, 0x18, 0xe3, 0xb2, 0xd5, 0x09, 0x39, 0x68,
+    0x17, 0x88, 0x85, 0xd2, 0xe5, 0x6b, 0x6d, 0x9c, 0xb8, 0xf7, 0x5b, 0x0a, 0x99, 0x3a, 0x86, 0x82,
+    0x89, 0x94, 0xae, 0x5a, 0x38, 0x0f, 0xfd, 0x8e, 0xd2, 0xbd, 0x80, 0x41, 0x62, 0xec, 0x26, 0xc9,
+    0x4d, 0x29, 0x4d, 0x80, 0x11, 0x13, 0x71, 0xc7, 0x5b, 0xfa, 0x18, 0xf8, 0x12, 0x85, 0x1f, 0xc2,
+    0xf8, 0xed, 0xe0, 0x61, 0xd9, 0xbc, 0x34, 0x1c, 0x46, 0x86, 0x60, 0x8e, 0x08, 0x42, 0x30, 0xeb,
+    0xb2, 0x7b, 0x02, 0xa8, 0x6b, 0x7b, 0x8c, 0x53, 0xb0, 0x06, 0xc2, 0x70, 0x34, 0x5f, 0x24, 0x4f,
+    0x21, 0x8a, 0xfb, 0x55, 0x31, 0x9b, 0x70, 0x06, 0xca, 0xf0, 0xf4, 0x6d, 0xc6, 0xc7, 0x46, 0xbd,
+    0x12, 0x8b, 0x7d, 0x76, 0x74, 0xed, 0x3c, 0x79, 0x99, 0x27, 0x83, 0x18, 0x4f, 0x1c, 0x45, 0xcc,
+    0xc0, 0xe3, 0x1c, 0xfe, 0x14, 0x00, 0x2c, 0x27, 0x01, 0x18, 0x26, 0x06, 0x60, 0x0c, 0x07, 0xa3,
+    0x34, 0x83, 0x38, 0x53, 0x49, 0x2d, 0xf2, 0x2e, 0x3c, 0x86, 0xb0, 0x48, 0x0d, 0xc1, 0x00, 0x21,
+    0x03, 0xc0, 0x70, 0x0f, 0x81, 0x80, 0x3c, 0x02, 0x81, 0xe0, 0x70, 0xba, 0xf7, 0x55, 0x88, 0x46,
+    0xf7, 0x57, 0x62, 0x01, 0x10, 0xca, 0x58, 0x5f, 0xdc, 0xb7, 0xa3, 0xc8, 0x39, 0xfa, 0x2b, 0x9f,
+    0x38, 0x4a, 0x24, 0x07, 0x10, 0x61, 0x28, 0x99, 0x61, 0xc3, 0x77, 0x81, 0xad, 0x08, 0xf8, 0xc5,
+    0x9e, 0xac, 0x4e, 0x20, 0x24, 0x4c, 0x06, 0x40, 0x68, 0xbd, 0x03, 0x7c, 0x5f, 0x67, 0x33, 0xeb,
+    0xef, 0xf2, 0xee, 0xf0, 0xb2, 0xac, 0x84, 0x8a, 0xb4, 0xf4, 0x3c, 0x0c, 0x55, 0x92, 0x4f, 0x2e,
+    0x53, 0x75, 0xe0, 0xa7, 0x4d, 0xe8, 0x99, 0xc6, 0x10, 0xfc, 0xe4, 0xaa, 0xdc, 0x53, 0x4a, 0xd2,
+    0x16, 0x14, 0x81, 0x74, 0x51, 0x8d, 0x31, 0x46, 0x23, 0xc2, 0xc8, 0x2f, 0x00, 0x00, 0x78, 0x22,
+    0x05, 0x80, 0xd8, 0x1c, 0x83, 0x50, 0x78, 0x07, 0x02, 0x78, 0x6e, 0x97, 0xef, 0x10, 0x18, 0xba,
+    0xfd, 0x60, 0xfe, 0x39, 0xe1, 0x7b, 0x25, 0xd2, 0x10, 0xf5, 0x01, 0x22, 0x57, 0x95, 0xeb, 0x90,
+    0x9a, 0xbc, 0xc5, 0xbd, 0x55, 0x01, 0xda, 0x47, 0x40, 0x1d, 0x6c, 0xfe, 0x1a, 0x43, 0xae, 0x8f,
+    0xa7, 0x59, 0xbc, 0x0f, 0xe0, 0xe0, 0x26, 0x42, 0x58, 0xa5, 0x14, 0xfb, 0xe8, 0xe1, 0x43, 0xe3,
+    0xff, 0xf6, 0x32, 0xae, 0xb3, 0xc8, 0xc0, 0x03, 0x68, 0xdc, 0xed, 0x43, 0x4b, 0x5c, 0x7b, 0xe8,
+    0xed, 0x71, 0x16, 0xe4, 0x5e, 0x14, 0x6d, 0x41, 0x85, 0x5f, 0x3a, 0xf5, 0x36, 0x80, 0xac, 0x1c,
+    0x00, 0x80, 0x12, 0x09, 0x84, 0x5a, 0x91, 0x13, 0x52, 0x0c, 0xe1, 0xea, 0x7d, 0xfe, 0x70, 0xe1,
+    0xc3, 0x26, 0x5a, 0x7f, 0x0a, 0x6d, 0x4f, 0x62, 0xd3, 0x14, 0x8a, 0x09, 0x40, 0xb5, 0x0b, 0x3b,
+    0x92, 0xc7, 0x47, 0xdc, 0x5f, 0xe9, 0x56, 0x56, 0xb9, 0x62, 0xa5, 0xe7, 0x54, 0x5a, 0x05, 0x70,
+    0x2b, 0x05, 0x61, 0xe4, 0x2b, 0x88, 0x13, 0x3f, 0xae, 0x4e, 0xf6, 0x3c, 0xda, 0xff, 0x4e, 0xe2,
+    0xcf, 0x45, 0x50, 0xd0, 0x14, 0x0a, 0x8c, 0xba, 0x50, 0xc7, 0x17, 0x9c, 0x17, 0x79, 0x99, 0xfb,
+    0x35, 0x0d, 0x9a, 0xb6, 0x08, 0x57, 0x06, 0xc3, 0xb2, 0xf1, 0xd2, 0x44, 0x5c, 0x7d, 0xaf, 0xf2,
+    0xfb, 0x3d, 0xcc, 0xb8, 0x49, 0x89, 0x0a, 0x76, 0x19, 0xb8, 0x49, 0xb5, 0x0f, 0x22, 0x0c, 0xcf,
+    0xe8, 0x9e, 0x2c, 0xf8, 0xb0, 0xea, 0x32, 0xfd, 0xbc, 0x69, 0xfa, 0x15, 0x14, 0x01, 0x92, 0x99,
+    0xba, 0x72, 0x6c, 0x7d, 0x7b, 0x8c, 0x4c, 0x34, 0x2e, 0x22, 0x10, 0x12, 0x05, 0x68, 0x8f, 0x2c,
+    0xe1, 0xaf, 0x5d, 0x9b, 0x26, 0xf2, 0x57, 0xfb, 0x63, 0x9b, 0x9c, 0x3a, 0x6a, 0xa3, 0x0c, 0x10,
+    0x0c, 0x7f, 0x84, 0xc0, 0x2e, 0x1d, 0xe3, 0x37, 0x7b, 0x5b, 0x10, 0xf8, 0xb5, 0xfd, 0xcb, 0x8f,
+    0x7e, 0xa9, 0x30, 0xb8, 0xd0, 0x4d, 0xca, 0x5e, 0x11, 0x43, 0x20, 0x1a, 0x01, 0xc0, 0x06, 0x0d,
+    0x40, 0xa1, 0xdd, 0x92, 0x31, 0xcb, 0x35, 0x51, 0x3c, 0x57, 0x05, 0xf0, 0xc3, 0x00, 0xfc, 0x17,
+    0x5d, 0xe7, 0xdf, 0x1f, 0xc8, 0xac, 0xc9, 0x58, 0xe1, 0x78, 0x1e, 0x54, 0x58, 0xb2, 0x2f, 0xb4,
+    0x7a, 0x5c, 0x21, 0xf2, 0x3d, 0x5a, 0x44, 0x96, 0x4f, 0xc0, 0x9f, 0xcd, 0x5e, 0x37, 0xb5, 0x2c,
+    0x95, 0x2e, 0xc3, 0x92, 0x49, 0x2f, 0xfe, 0x4e, 0x74, 0xe7, 0xeb, 0xc3, 0x45, 0x9b, 0x33, 0x9d,
+    0xfc, 0x15, 0x50, 0xb1, 0xb2, 0x29, 0x00, 0x14, 0x25, 0x88, 0xf1, 0x36, 0x23, 0xc4, 0x18, 0x83,
+    0x04, 0x64, 0xcc, 0xa4, 0x73, 0x49, 0x30, 0x5f, 0xab, 0xff, 0xa7, 0x1e, 0xda, 0xbe, 0xc1, 0x0e,
+    0x2f, 0x44, 0x26, 0xfe, 0x2a, 0x92, 0x81, 0x6c, 0x65, 0x2b, 0x4f, 0x59, 0x1b, 0xca, 0xc5, 0x7f,
+    0x38, 0x70, 0xe6, 0x71, 0xa8, 0x82, 0x2c, 0x02, 0x73, 0xc2, 0xe7, 0x09, 0x14, 0xff, 0x22, 0xbd,
+    0x4a, 0xe6, 0xf3, 0x2d, 0x12, 0x64, 0xb9, 0x86, 0x60, 0xa2, 0x28, 0x72, 0x8d, 0xd2, 0x26, 0x92,
+    0x7f, 0xbd, 0x77, 0x37, 0xe4, 0x5b, 0xc0, 0xe6, 0x83, 0xbd, 0xa6, 0xfb, 0x85, 0xad, 0x6d, 0x33,
+    0x47, 0xc2, 0x98, 0x1a, 0x81, 0xd5, 0xc8, 0x70, 0xe8, 0xb8, 0x7f, 0x40, 0x3b, 0x9d, 0xbc, 0x28,
+    0xb6, 0x4c, 0xc8, 0xf0, 0x6a, 0x0d, 0x40, 0x94, 0x14, 0x80, 0xc0, 0x10, 0x01, 0x20, 0x54, 0x0d,
+    0x82, 0x30, 0x04, 0x14, 0x5b, 0x1b, 0x71, 0xc0, 0x36, 0x75, 0x31, 0x9f, 0xb7, 0x77, 0x61, 0x30,
+    0x96, 0xe1, 0xc0, 0x05, 0x46, 0xf9, 0x75, 0x4e, 0xe5, 0x20, 0x97, 0xab, 0xe4, 0x04, 0x52, 0x86,
+    0x30, 0x80, 0x0a, 0x80, 0x90, 0x0b, 0x00, 0xd0, 0x36, 0x09, 0x41, 0xa8, 0x33, 0x07, 0x60, 0x94,
+    0x0e, 0xae, 0x11, 0x17, 0x44, 0x0e, 0x16, 0xcb, 0x60, 0x0b, 0x1a, 0xdc, 0x9b, 0x3c, 0xbf, 0x56,
+    0xa1, 0xac, 0xe1, 0x37, 0xd1, 0x6c, 0x74, 0xb1, 0xcc, 0x7e, 0x2b, 0xfc, 0x12, 0x9a, 0x40, 0x48,
+    0x23, 0x00, 0x80, 0x0c, 0x03, 0xa0, 0xbc, 0x1b, 0x84, 0x90, 0x8a, 0x14, 0x42, 0x78, 0x53, 0x09,
+    0x21, 0x0c, 0x16, 0x97, 0x74, 0x8a, 0xeb, 0xa7, 0xd2, 0x0b, 0xf0, 0x92, 0x9f, 0x5a, 0xd4, 0xe9,
+    0x37, 0xe2, 0x00, 0x14, 0x03, 0x18, 0x83, 0x13, 0x62, 0x34, 0x3a, 0x86, 0xf0, 0x3e, 0x46, 0x4e,
+    0x37, 0x40, 0x13, 0x5d, 0xf6, 0x9b, 0xf3, 0x73, 0x1b, 0x1c, 0x7d, 0x1a, 0x45, 0xa3, 0x03, 0x18,
+    0xf8, 0xe9, 0xf0, 0x4d, 0xfc, 0x2d, 0xe0, 0xce, 0x03, 0x90, 0xd1, 0xa0, 0x1c, 0xc6, 0xde, 0x34,
+    0xe3, 0x3b, 0x97, 0x69, 0xa5, 0xea, 0x34, 0xfd, 0x62, 0x5b, 0xa1, 0x07, 0x35, 0xf1, 0x63, 0xa8,
+    0xf4, 0x7c, 0xa7, 0x33, 0x6c, 0x8a, 0x2f, 0xbe, 0x0f, 0xc4, 0xf6, 0x00, 0x3b, 0x6c, 0x0f, 0x1f,
+    0x37, 0x7a, 0xef, 0xc7, 0x37, 0x52, 0x99, 0xc6, 0xe2, 0x8f, 0xa6, 0x50, 0xfc, 0x77, 0x26, 0x08,
+    0x4c, 0x58, 0xca, 0xb8, 0xa5, 0x23, 0x1c, 0x34, 0x80, 0xb8, 0x8d, 0x12, 0xe2, 0xfc, 0x40, 0x88,
+    0x71, 0x0e, 0x1c, 0x6e, 0xa3, 0x8d, 0xcc, 0xb8, 0xfe, 0x89, 0xe5, 0xd7, 0x3f, 0x93, 0x48, 0xde,
+    0x11, 0xd1, 0x87, 0x4b, 0x68, 0x8a, 0x42, 0x94, 0xb5, 0xf5, 0x6a, 0x5b, 0x42, 0x7f, 0x1d, 0x30,
+    0x8b, 0x15, 0x49, 0x58, 0xbe, 0x0c, 0xe0, 0xf4, 0x0b, 0x81, 0x40, 0x10, 0x02, 0x80, 0x10, 0x06,
+    0x00, 0x00, 0x14, 0x01, 0x80, 0x70, 0x12, 0x02, 0x00, 0xb0, 0x03, 0x2d, 0x57, 0xae, 0x91, 0x25,
+    0xf9, 0x64, 0x0f, 0x40, 0x18, 0x24, 0xc6, 0x98, 0xc9, 0x1e, 0x22, 0x2c, 0x78, 0x83, 0xee, 0x14,
+    0xae, 0x23, 0xf2, 0xdb, 0xf2, 0xa7, 0xcf, 0xe6, 0x5e, 0x1e, 0x09, 0x34, 0x1e, 0xe1, 0x4e, 0x5e,
+    0x23, 0xe8, 0xeb, 0x0a, 0x80, 0x76, 0x30, 0x47, 0x38, 0xff, 0x1b, 0xe3, 0x74, 0x60, 0x8d, 0xb9,
+    0x84, 0xe1, 0xaa, 0x80, 0xff, 0x28, 0x77, 0xeb, 0x89, 0x46, 0xed, 0x15, 0x54, 0x10, 0xcf, 0xd6,
+    0x0e, 0xbd, 0xb8, 0x16, 0xa8, 0xbe, 0x91, 0xe0, 0x84, 0xeb, 0x43, 0x83, 0x26, 0x18, 0xe3, 0x44,
+    0x00, 0x92, 0xf8, 0xc1, 0x80, 0x2d, 0x7d, 0x45, 0x1e, 0x70, 0xd3, 0xf8, 0x4a, 0xa9, 0x68, 0x60,
+    0x97, 0xba, 0x05, 0x35, 0x71, 0x9d, 0xd3, 0x35, 0x60, 0x78, 0x2d, 0xd6, 0x8e, 0x54, 0x91, 0xd4,
+    0x6b, 0x89, 0x22, 0xc0, 0x22, 0x84, 0xd0, 0x3c, 0x0b, 0x00, 0xad, 0x69, 0x96, 0xe8, 0xea, 0x9b,
+    0x38, 0x9d, 0x93, 0xac, 0x6e, 0x69, 0x2b, 0x58, 0x3f, 0x3a, 0x30, 0x75, 0xe9, 0x38, 0x53, 0x71,
+    0x26, 0xd0, 0x55, 0xf0, 0xfc, 0x58, 0x28, 0x13, 0x8f, 0xa3, 0x1f, 0xc1, 0x99, 0x41, 0x20, 0xa2,
+    0xce, 0x54, 0x23, 0x90, 0xdf, 0x08, 0xc0, 0x76, 0x26, 0x45, 0xa9, 0x07, 0x0a, 0xf7, 0x65, 0x94,
+    0xce, 0x24, 0xfe, 0x84, 0x4e, 0x6d, 0x99, 0x08, 0x61, 0xd5, 0x2f, 0x51, 0xfc, 0xfc, 0xb4, 0xed,
+    0x23, 0xdd, 0xea, 0xf6, 0x26, 0x5b, 0xa1, 0x38, 0xe9, 0x15, 0x81, 0x78, 0x19, 0x03, 0x20, 0x47,
+    0x74, 0x67, 0xd7, 0x44, 0x18, 0xa2, 0xc1, 0x7e, 0x24, 0x4b, 0x3a, 0xb7, 0x24, 0x52, 0xf4, 0xe2,
+    0x0c, 0xf0, 0x8f, 0x43, 0x9c, 0x28, 0x02, 0x9f, 0xb3, 0x9e, 0x5c, 0xea, 0xdb, 0x56, 0x07, 0x7a,
+    0x87, 0xc2, 0xfd, 0x48, 0x10, 0x61, 0x8a, 0x44, 0x67, 0x94, 0x78, 0x53, 0x21, 0x9a, 0x1b, 0x80,
+    0x3c, 0x56, 0x89, 0xb1, 0xaa, 0x26, 0xc4, 0xa8, 0x75, 0x09, 0x21, 0x1c, 0x03, 0x84, 0xf4, 0x99,
+    0xc0, 0x62, 0x08, 0xfc, 0xec, 0xe8, 0x27, 0xc7, 0xd2, 0x48, 0x7c, 0x2f, 0x08, 0xd0, 0x16, 0x61,
+    0x34, 0x16, 0x89, 0x70, 0xfe, 0x7e, 0xa8, 0x55, 0xf7, 0x0a, 0x00, 0x74, 0x96, 0x61, 0xdd, 0x6e,
+    0x1e, 0xe2, 0xda, 0x19, 0x48, 0x61, 0x62, 0x5a, 0x2c, 0x05, 0x2d, 0x8f, 0xfc, 0xdb, 0x63, 0x8a,
+    0xb7, 0x70, 0x9e, 0x1d, 0x8d, 0xc0, 0xe6, 0x16, 0x81, 0xe0, 0x22, 0x05, 0xe0, 0xae, 0xd0, 0xd4,
+    0x2b, 0x1a, 0x86, 0x23, 0xdc, 0x1f, 0x88, 0x1d, 0x6d, 0x69, 0xfb, 0x93, 0x3f, 0xa6, 0xb8, 0x1b,
+    0x80, 0xeb, 0xde, 0xee, 0xea, 0x16, 0x3a, 0x2f, 0xc0, 0x39, 0x94, 0x3b, 0xab, 0x12, 0x87, 0x17,
+    0x81, 0x5a, 0x08, 0x00, 0xcc, 0x47, 0x88, 0xb1, 0x46, 0x1f, 0x44, 0xc8, 0x6e, 0xd0, 0x75, 0xe1,
+    0x7b, 0x49, 0xf7, 0x8e, 0xe8, 0xa4, 0xe2, 0x06, 0x8d, 0x7f, 0x16, 0xa9, 0x27, 0xc0, 0xbb, 0xb3,
+    0x3f, 0x85, 0x45, 0x9d, 0x50, 0xb6, 0x01, 0xdb, 0xeb, 0x53, 0x41, 0xff, 0x5c, 0x8a, 0x0f, 0x91,
+    0x33, 0xa6, 0x22, 0x17, 0x84, 0x80, 0xd0, 0x33, 0x03, 0x30, 0x35, 0x0a, 0xdc, 0x81, 0xab, 0x22,
+    0x62, 0x6d, 0x0b, 0x93, 0x5f, 0x3b, 0x0f, 0xdf, 0xb4, 0x6c, 0xcf, 0x37, 0x3e, 0xcc, 0x4a, 0x2f,
+    0xd9, 0xfe, 0xcc, 0xb3, 0x90, 0xea, 0x28, 0x8b, 0xff, 0x81, 0x8d, 0xc7, 0xca, 0x59, 0xba, 0x50,
+    0xda, 0xce, 0x71, 0x4b, 0x1c, 0x3b, 0x47, 0x14, 0xfb, 0xb7, 0x8e, 0x1f, 0x67, 0xb4, 0x4f, 0xe5,
+    0xff, 0xc5, 0x2d, 0xce, 0xfa, 0x63, 0x83, 0xe1, 0x14, 0x55, 0xa5, 0x5a, 0xb9, 0xe2, 0x87, 0xa9,
+    0x5f, 0x00, 0xff, 0xc9, 0x33, 0xb4, 0xd2, 0x27, 0x7a, 0xb5, 0xf8, 0xc9, 0x27, 0x3f, 0xb5, 0x3c,
+    0xff, 0xf4, 0xc8, 0xb8, 0xc9, 0x13, 0xb8, 0x63, 0xa2, 0x21, 0x96, 0x3d, 0x54, 0xac, 0x68, 0xf6,
+    0x59, 0xf3, 0xff, 0xc3, 0x7f, 0xa6, 0x3c, 0xd0, 0xed, 0x75, 0x8e, 0x7a, 0x08, 0xe0, 0x08, 0x4b,
+    0x1c, 0x52, 0x9c, 0xac, 0xfa, 0x91, 0xbb, 0xff, 0xfd, 0x15, 0xd1, 0x9f, 0x3d, 0x30, 0xbb, 0x0e,
+    0x09, 0x29, 0x6e, 0x60, 0x27, 0x44, 0xa1, 0x38, 0x99, 0xbd, 0xb8, 0x71, 0x84, 0xd9, 0xdf, 0xb6,
+    0x33, 0x02, 0xb6, 0x6b, 0x2d, 0x0d, 0xf9, 0x7d, 0xe6, 0x07, 0xd8, 0xbf, 0xcf, 0x1c, 0x18, 0xe0,
+    0xc2, 0x45, 0x64, 0x3e, 0x99, 0x11, 0x5f, 0xfc, 0xc5, 0xfc, 0x75, 0xf0, 0x3b, 0xf5, 0xb3, 0xe9,
+    0xe7, 0x60, 0xff, 0x10, 0xc2, 0xc5, 0x8b, 0x29, 0x2a, 0x83, 0x02, 0x23, 0xe6, 0x79, 0x6b, 0xbd,
+    0x90, 0x78, 0x94, 0x06, 0x8b, 0xd2, 0x7f, 0x2e, 0x3d, 0x82, 0xf1, 0x8f, 0xff, 0x3f, 0x6b, 0x6f,
+    0x56, 0xa7, 0x94, 0x50, 0x6a, 0x0d, 0x63, 0x18, 0x5a, 0x1a, 0x82, 0xc0, 0xa0, 0x10, 0x07, 0x91,
+    0x7b, 0x02, 0x62, 0x7a, 0x14, 0xad, 0x7c, 0xab, 0xbb, 0x7c, 0x30, 0xf9, 0x19, 0x60, 0x3f, 0x8a,
+    0x3d, 0x21, 0xf8, 0xe4, 0x6d, 0x76, 0x6d, 0xa7, 0x5c, 0x5b, 0xcf, 0x96, 0xcd, 0x47, 0xcd, 0x99,
+    0xaf, 0xb5, 0x5f, 0x21, 0xb4, 0x7b, 0xfb, 0x83, 0xd9, 0xdf, 0x8f, 0xc8, 0x0e, 0x23, 0x9a, 0xb7,
+    0xce, 0x65, 0x6b, 0xb3, 0xa0, 0x98, 0x01, 0x41, 0xb8, 0xde, 0x3d, 0x8d, 0x63, 0x18, 0x9e, 0x16,
+    0x86, 0xa0, 0xc0, 0xc2, 0xe9, 0x7e, 0x2b, 0x4e, 0x8f, 0xfe, 0x82, 0xfe, 0x4c, 0xf8, 0xd9, 0xab,
+    0xc9, 0xb3, 0x15, 0xbb, 0x15, 0x8b, 0x37, 0x5a, 0xb5, 0x50, 0xb9, 0x75, 0xd9, 0xcd, 0x0e, 0x8a,
+    0xfc, 0xb9, 0x10, 0xb6, 0xb0, 0x90, 0xcd, 0x78, 0xe6, 0x0e, 0x4c, 0x68, 0xb4, 0x8f, 0xaf, 0x37,
+    0x1c, 0x59, 0xcf, 0xe9, 0xa0, 0x35, 0x15, 0xdd, 0x12, 0xe8, 0x87, 0xd7, 0x1f, 0xf2, 0x74, 0xa7,
+    0xd7, 0x49, 0x44, 0xe7, 0x26, 0x05, 0x60, 0xd4, 0x2d, 0x00, 0xb0, 0x6c, 0x78, 0xd4, 0x00, 0x17,
+    0x2b, 0x50, 0x12, 0xa0, 0xc1, 0xa2, 0x6c, 0x7d, 0x56, 0xaf, 0x8c, 0x30, 0x70, 0x2d, 0xf7, 0x73,
+    0xa8, 0xdf, 0xcf, 0x3f, 0xf0, 0x8e, 0x3e, 0x64, 0xa4, 0x2c, 0x6e, 0xa0, 0xd9, 0xcb, 0x6b, 0x30,
+    0x61, 0xc4, 0xf0, 0xb3, 0x96, 0x9f, 0xdf, 0xbf, 0xe8, 0xef, 0x40, 0x9e, 0x0c, 0xbb, 0xc6, 0xcc,
+    0xae, 0x4f, 0x0b, 0xe0, 0xa4, 0x5f, 0x28, 0xc0, 0x6e, 0xc3, 0x73, 0xb3, 0xf9, 0xe3, 0xfe, 0xc2,
+    0xd1, 0x8e, 0x4c, 0x43, 0x69, 0x18, 0xa0, 0x1f, 0x05, 0x30, 0xd4, 0x2e, 0x04, 0x80, 0xe0, 0x16,
+    0x0a, 0x84, 0xe1, 0x98, 0x6e, 0x1f, 0x88, 0x22, 0x28, 0x86, 0x1f, 0x88, 0x61, 0xb8, 0x72, 0x16,
+    0x85, 0x20, 0xe8, 0x2e, 0x05, 0x80, 0x60, 0x20, 0x1c, 0x1e, 0x12, 0x35, 0x14, 0x14, 0xf4, 0xfa,
+    0x23, 0x7c, 0x33, 0xa3, 0x3a, 0x65, 0x31, 0x0d, 0x8e, 0x58, 0x79, 0x51, 0xf1, 0x37, 0xfc, 0x63,
+    0x0d, 0xf1, 0x51, 0xcc, 0x7e, 0x8a, 0x47, 0x76, 0x29, 0xf5, 0x7b, 0xcf, 0x4e, 0x0e, 0xf8, 0x5e,
+    0x4b, 0xc1, 0x32, 0x0f, 0x92, 0x1f, 0x32, 0x81, 0xdf, 0xdc, 0xbe, 0x77, 0xe5, 0xd6, 0x15, 0x5b,
+    0x58, 0x11, 0xf0, 0xf2, 0xcc, 0xf9, 0xfa, 0x23, 0xa6, 0xe1, 0x3e, 0x3b, 0x59, 0x64, 0x22, 0x0d,
+    0x76, 0xa0, 0x1a, 0xff, 0x82, 0x7e, 0xd9, 0xf8, 0x29, 0xb9, 0x4d, 0x83, 0x08, 0x07, 0x02, 0xa6,
+    0x2d, 0x66, 0xf4, 0xca, 0x92, 0xff, 0xe8, 0x4f, 0xa0, 0xff, 0xa4, 0x9f, 0x2a, 0x2d, 0xde, 0xa5,
+    0xa5, 0x90, 0x88, 0xd2, 0x39, 0x09, 0x79, 0x46, 0x5f, 0xd2, 0x4a, 0x9c, 0x55, 0x2c, 0x9e, 0x1b,
+    0x44, 0xaf, 0xe6, 0x8f, 0xe6, 0xac, 0x54, 0xf0, 0x7a, 0x2c, 0x4f, 0xd0, 0xdd, 0x1e, 0x24, 0x82,
+    0x37, 0x8e, 0x50, 0x44, 0x8c, 0xfd, 0xaf, 0xde, 0x6f, 0x6c, 0x0f, 0x53, 0x4a, 0x90, 0x6f, 0x53,
+    0xa9, 0x96, 0x34, 0xac, 0x69, 0x60, 0x58, 0x2b, 0x3d, 0xf2, 0x5d, 0xb2, 0xf2, 0x63, 0xc7, 0x2f,
+    0x01, 0xff, 0x9a, 0xa5, 0x3f, 0x8f, 0xdf, 0x1f, 0x81, 0x0f, 0xe2, 0x9c, 0x93, 0xf0, 0x51, 0xab,
+    0xce, 0xb6, 0x1b, 0x04, 0x23, 0xad, 0xe3, 0xaf, 0x96, 0x50, 0x98, 0x1d, 0x84, 0xd1, 0x84, 0x77,
+    0x1b, 0xc5, 0x11, 0x0c, 0x23, 0x03, 0xc0, 0x80, 0x60, 0x2a, 0x0c, 0x83, 0x80, 0xf0, 0x3e, 0x1c,
+    0x6b, 0x47, 0xcb, 0xe5, 0x57, 0xff, 0x17, 0xfc, 0x09, 0xf1, 0x7b, 0x29, 0x18, 0xe5, 0x62, 0x11,
+    0x17, 0x13, 0xec, 0xdf, 0x2e, 0x01, 0x20, 0x10, 0x3d, 0x06, 0xc5, 0xd8, 0xb7, 0x30, 0x56, 0xeb,
+    0x28, 0xf6, 0x15, 0x40, 0x80, 0x9a, 0x2f, 0x8d, 0x22, 0x78, 0x92, 0x14, 0x83, 0xe0, 0x38, 0x04,
+    0x05, 0x04, 0xc3, 0xaf, 0x00, 0x3e, 0x86, 0x7c, 0x2d, 0xff, 0xc9, 0x11, 0x83, 0xa1, 0x01, 0x19,
+    0x85, 0x68, 0xb0, 0x99, 0x9e, 0x1f, 0x00, 0xf2, 0x74, 0xa9, 0x34, 0x4b, 0xb2, 0xcc, 0x8f, 0x1d,
+    0xc5, 0x30, 0xdc, 0x15, 0x00, 0x01, 0x80, 0x90, 0x38, 0x0d, 0x84, 0x41, 0x08, 0x2a, 0x04, 0x72,
+    0xbb, 0xdd, 0xcc, 0x03, 0xff, 0xb3, 0x3e, 0x12, 0xeb, 0x87, 0x10, 0xb5, 0x82, 0x8f, 0x1f, 0x42,
+    0xc0, 0xbe, 0x42, 0x97, 0x25, 0xd9, 0x72, 0x58, 0x90, 0x29, 0x5b, 0x75, 0xec, 0x81, 0x2f, 0xfe,
+    0x13, 0xf6, 0xb5, 0x50, 0xe1, 0xa7, 0xb6, 0x55, 0x27, 0x7d, 0x6d, 0xd6, 0x23, 0x40, 0x81, 0xe9,
+    0x8e, 0xf5, 0x08, 0xe6, 0xff, 0x31, 0xfc, 0xc5, 0xc3, 0x88, 0xf0, 0xd2, 0x23, 0x83, 0x30, 0xa4,
+    0x05, 0x81, 0x01, 0x48, 0x1a, 0x38, 0xc1, 0x93, 0x92, 0x90, 0x61, 0x2c, 0xf9, 0xbb, 0xdc, 0x32,
+    0xe7, 0x77, 0x7d, 0x7f, 0x89, 0xb0, 0x73, 0xc3, 0x0f, 0x38, 0xa0, 0xa7, 0xf2, 0x67, 0xc8, 0xdd,
+    0xd2, 0xd9, 0xa9, 0xe9, 0xc4, 0x8d, 0xa0, 0xf8, 0x9b, 0xfb, 0xc3, 0xb4, 0x9f, 0x83, 0x91, 0x8f,
+    0xe7, 0x3a, 0x67, 0xd9, 0x0f, 0x0e, 0x12, 0x8f, 0xc4, 0xde, 0xe0, 0xee, 0x07, 0xa1, 0x5c, 0x90,
+    0xdc, 0x5f, 0xc4, 0xbb, 0x3f, 0x12, 0xb8, 0x95, 0xef, 0x32, 0x8d, 0xed, 0xff, 0x48, 0xc0, 0xca,
+    0xb1, 0x85, 0x91, 0xc8, 0xee, 0x0e, 0x82, 0xb1, 0x35, 0x25, 0xaa, 0x1e, 0x3c, 0x6b, 0xcf, 0xf3,
+    0xd6, 0xa9, 0xe2, 0xa6, 0x37, 0x1c, 0x0e, 0xda, 0x98, 0x87, 0x1c, 0x23, 0x8d, 0x46, 0x2f, 0x92,
+    0xf0, 0xc4, 0x6d, 0x2d, 0xed, 0x7d, 0xfe, 0xee, 0x46, 0xfd, 0xf0, 0x9d, 0x46, 0x3d, 0x87, 0x02,
+    0xb0, 0x7d, 0x54, 0xe4, 0xb4, 0x48, 0x5a, 0xc0, 0x60, 0x85, 0x76, 0x0d, 0xea, 0xd8, 0xa4, 0x87,
+    0x23, 0x24, 0x9c, 0xa0, 0x1c, 0x33, 0xd6, 0x07, 0x7b, 0x29, 0x12, 0x3d, 0xab, 0xe3, 0x8c, 0x02,
+    0x62, 0x86, 0x42, 0x99, 0x01, 0x13, 0x63, 0xf2, 0xb4, 0x91, 0x85, 0xe0, 0x12, 0x13, 0x40, 0x44,
+    0xdb, 0x7d, 0x11, 0x88, 0x00, 0xe8, 0x51, 0x15, 0x47, 0xb3, 0xee, 0xdc, 0x78, 0xe5, 0x92, 0x3f,
+    0xe5, 0x8f, 0x00, 0xf9, 0xbd, 0xa0, 0x0f, 0x18, 0x0d, 0xe9, 0x06, 0xd8, 0x79, 0x63, 0xe0, 0x0d,
+    0x56, 0xc0, 0xe3, 0xaa, 0x8d, 0x79, 0x10, 0xf6, 0xff, 0x50, 0x74, 0xce, 0xe6, 0x00, 0x08, 0x7e,
+    0xd3, 0x79, 0x61, 0x47, 0xfa, 0x72, 0x54, 0xab, 0x64, 0x4d, 0xb2, 0x94, 0xce, 0x47, 0x5b, 0xa5,
+    0x47, 0xf3, 0xcf, 0xea, 0xbe, 0x43, 0x6e, 0x74, 0x86, 0xd0, 0x8e, 0x8a, 0x74, 0x67, 0xfa, 0x46,
+    0x8e, 0x73, 0xfa, 0x8f, 0x78, 0x29, 0x41, 0xbf, 0x18, 0xfd, 0xe1, 0xac, 0x5b, 0x2c, 0x73, 0x80,
+    0x5c, 0xa0, 0x52, 0x7c, 0x47, 0x50, 0xb2, 0x49, 0x4c, 0x26, 0x00, 0x62, 0xbc, 0x72, 0xe0, 0x14,
+    0xac, 0xfd, 0xb5, 0xfc, 0x2d, 0xc9, 0xce, 0x73, 0x42, 0x0c, 0xca, 0xef, 0x94, 0x91, 0xfd, 0x27,
+    0xc9, 0xfa, 0xe8, 0x7c, 0x47, 0xea, 0x69, 0x15, 0xe0, 0x3c, 0xa8, 0xe3, 0xd7, 0x0d, 0x3a, 0xd3,
+    0xf7, 0x04, 0xc8, 0xd0, 0x26, 0x82, 0x04, 0x77, 0x32, 0x10, 0x7e, 0xab, 0xf8, 0xdf, 0x38, 0xa3,
+    0x83, 0x04, 0x8e, 0x16, 0x02, 0x8a, 0xab, 0x3b, 0x8f, 0xcc, 0x31, 0xcc, 0x8e, 0x20, 0x71, 0x7f,
+    0x42, 0xc1, 0x11, 0x6a, 0xea, 0x26, 0x38, 0x13, 0x1c, 0x33, 0xab, 0xa6, 0x10, 0x4f, 0xf8, 0x73,
+    0x23, 0x79, 0x11, 0x13, 0x13, 0x42, 0xdb, 0x28, 0x39, 0x39, 0xe5, 0x6f, 0xf0, 0x4c, 0x5a, 0xcb,
+    0x45, 0x19, 0x86, 0x30, 0x03, 0x05, 0xdd, 0xdd, 0x80, 0x5d, 0x32, 0xd6, 0x2e, 0x82, 0xfc, 0xf3,
+    0x0d, 0x74, 0x82, 0x59, 0x28, 0x03, 0x30, 0x32, 0x24, 0x8c, 0x22, 0xa8, 0xa6, 0x21, 0x85, 0x62,
+    0xa8, 0x83, 0xb7, 0x5d, 0x40, 0xf1, 0xef, 0xf9, 0x42, 0x60, 0xeb, 0x54, 0xe4, 0x82, 0xc6, 0xd1,
+    0x9e, 0xd0, 0x47, 0x8a, 0x4f, 0x13, 0x79, 0x0d, 0xd3, 0x2c, 0xc3, 0xf4, 0x35, 0x15, 0x6c, 0x82,
+    0x47, 0x4c, 0xdf, 0xe7, 0xb5, 0x30, 0xf0, 0x9e, 0xbd, 0xde, 0x0e, 0x2a, 0x70, 0x73, 0xcf, 0xdf,
+    0x56, 0x7c, 0x86, 0xa8, 0xdc, 0xed, 0x38, 0x60, 0xa1, 0x74, 0x62, 0x0e, 0x08, 0xa8, 0x41, 0x4f,
+    0x1d, 0x5b, 0xc7, 0x9a, 0x5e, 0x41, 0x37, 0xfe, 0xf3, 0xcd, 0xb9, 0x1c, 0x3e, 0x13, 0xc1, 0xe2,
+    0xc2, 0xe7, 0xda, 0x0e, 0x8d, 0x40, 0x1e, 0xee, 0xd0, 0x33, 0x7b, 0x2f, 0x3b, 0xf8, 0x59, 0x79,
+    0x6f, 0x91, 0xb0, 0x31, 0x52, 0x27, 0x08, 0xa3, 0xec, 0x42, 0xb0, 0x01, 0x25, 0x91, 0x45, 0x89,
+    0x8b, 0x5a, 0xec, 0x78, 0xe5, 0x00, 0x3c, 0x03, 0xd5, 0x94, 0xa9, 0x4a, 0x26, 0x87, 0x00, 0xf8,
+    0x1e, 0x04, 0x80, 0xc0, 0x20, 0x02, 0x01, 0x00, 0x40, 0x04, 0x06, 0x00, 0x80, 0x60, 0x28, 0x0a,
+    0x03, 0x80, 0xa0, 0xc0, 0xad, 0x5b, 0xe7, 0x05, 0x2e, 0xa1, 0xf8, 0x2e, 0x7e, 0xec, 0xc7, 0x24,
+    0xb2, 0xdf, 0x7f, 0x4b, 0xe3, 0x68, 0x34, 0x17, 0x81, 0x61, 0x1e, 0x4c, 0x13, 0x62, 0x60, 0xe4,
+    0xbe, 0x51, 0xb4, 0x5b, 0x1b, 0xbd, 0x33, 0xf8, 0xfa, 0xb7, 0x43, 0x65, 0xa4, 0x92, 0xa4, 0x93,
+    0xb9, 0x0c, 0x1c, 0x80, 0xa0, 0xec, 0x39, 0x15, 0xc3, 0xf1, 0x04, 0x4f, 0x11, 0x70, 0x13, 0xa0,
+    0x9a, 0x3b, 0xfc, 0x69, 0x9f, 0x7a, 0xc5, 0x36, 0x1a, 0x65, 0x00, 0x90, 0x1a, 0x02, 0x40, 0x50,
+    0x0b, 0x07, 0x42, 0xb0, 0xcc, 0x37, 0x0f, 0x41, 0x52, 0x7d, 0xab, 0x5c, 0x2b, 0x53, 0x0b, 0x85,
+    0x63, 0x04, 0xe2, 0x04, 0x81, 0x57, 0x75, 0x55, 0xe3, 0x20, 0x03, 0xda, 0x70, 0x4b, 0x12, 0xba,
+    0x75, 0x75, 0xbd, 0x73, 0xe9, 0xcc, 0x0e, 0x66, 0x8d, 0x43, 0x38, 0x40, 0x11, 0x00, 0x40, 0x38,
+    0x05, 0x0b, 0x59, 0x32, 0x22, 0xfa, 0x18, 0x76, 0x5c, 0x0a, 0x21, 0x0c, 0x38, 0x02, 0x43, 0x74,
+    0x5a, 0x0f, 0x78, 0xff, 0x97, 0xb5, 0xd2, 0xb1, 0x2d, 0x08, 0x26, 0x34, 0x5e, 0x6f, 0x63, 0xfe,
+    0xb9, 0xe9, 0x07, 0xc9, 0xa0, 0x6f, 0xac, 0x73, 0x2c, 0xc8, 0x19, 0x67, 0x87, 0x60, 0x2f, 0x46,
+    0xfe, 0xf3, 0x14, 0x68, 0x6c, 0x07, 0xa1, 0xf0, 0x38, 0x06, 0x01, 0x00, 0x04, 0x04, 0x01, 0x40,
+    0x30, 0x2c, 0x00, 0x00, 0x94, 0xd8, 0xaf, 0x32, 0x39, 0x8c, 0x82, 0xf0, 0xc5, 0x4d, 0x28, 0x99,
+    0x93, 0xbe, 0x0c, 0x4a, 0x84, 0x90, 0x60, 0x04, 0xc4, 0xb3, 0x9e, 0xcd, 0x72, 0xfb, 0xcc, 0x7f,
+    0xe5, 0xcb, 0x99, 0xcb, 0x48, 0xcd, 0x05, 0x8b, 0x41, 0x90, 0x10, 0x04, 0xc1, 0x30, 0xa4, 0x25,
+    0x05, 0xc6, 0x78, 0x29, 0xe2, 0x14, 0x2f, 0xff, 0x54, 0x6c, 0x6f, 0x8a, 0x0b, 0xd2, 0x4c, 0x6a,
+    0xb2, 0xbc, 0x08, 0xe7, 0xc6, 0x07, 0xfa, 0x56, 0x68, 0x4a, 0x0a, 0xc6, 0x63, 0x54, 0x08, 0x11,
+    0xa5, 0x09, 0x37, 0xce, 0x3e, 0xa9, 0xe3, 0x86, 0x1a, 0x26, 0x08, 0x00, 0x5c, 0x01, 0x10, 0x30,
+    0x3b, 0x9a, 0x09, 0x4f, 0xed, 0xde, 0x90, 0xf3, 0x62, 0x2e, 0x22, 0xa8, 0xa0, 0x30, 0xbc, 0x8b,
+    0x92, 0x81, 0x8e, 0x91, 0xdc, 0x38, 0x61, 0x7e, 0x77, 0xe4, 0xcc, 0x08, 0x00, 0xd8, 0x29, 0xc9,
+    0x00, 0xe1, 0xdc, 0x88, 0x87, 0x06, 0x10, 0xd4, 0x16, 0x82, 0xa5, 0x08, 0x9d, 0xcd, 0x09, 0x8d,
+    0xf9, 0xab, 0xe4, 0x2d, 0xf6, 0x79, 0x8e, 0xcc, 0x44, 0x05, 0xab, 0x3c, 0x94, 0xf0, 0xe1, 0x20,
+    0xf1, 0x57, 0x10, 0x60, 0x41, 0x2c, 0x5f, 0xb5, 0xe2, 0xb6, 0x8c, 0x71, 0x22, 0x39, 0xf9, 0x72,
+    0xca, 0xba, 0x0a, 0x49, 0xaf, 0x28, 0x38, 0xdd, 0x31, 0xb7, 0x76, 0x93, 0xa7, 0xca, 0xb8, 0x16,
+    0xb4, 0x08, 0xc3, 0x90, 0x6c, 0x1b, 0x05, 0xad, 0x89, 0xab, 0x92, 0x59, 0x0d, 0x64, 0x73, 0xfd,
+    0x1b, 0x45, 0xe2, 0xf7, 0x0d, 0x81, 0x3d, 0x99, 0x78, 0x52, 0x00, 0x30, 0xe3, 0x55, 0x9d, 0x60,
+    0xac, 0x73, 0x8b, 0xe8, 0x07, 0x03, 0x91, 0x7d, 0x3f, 0x28, 0x53, 0x20, 0x20, 0xeb, 0x83, 0x94,
+    0xf1, 0xcb, 0xb1, 0x6b, 0xa9, 0xf9, 0xbc, 0x5b, 0xc1, 0x8d, 0xfd, 0xaf, 0x11, 0x51, 0xc7, 0x44,
+    0x2e, 0xe2, 0x95, 0xa2, 0xdc, 0x1b, 0x26, 0x9b, 0x13, 0x6e, 0x9c, 0xe6, 0xe6, 0xd2, 0x1b, 0xc5,
+    0xd2, 0x95, 0x5c, 0x0e, 0x08, 0x80, 0x41, 0x43, 0x53, 0xf0, 0x63, 0x26, 0x34, 0x87, 0x41, 0xe7,
+    0x44, 0xaa, 0x1a, 0x24, 0xd6, 0xb6, 0x3d, 0xff, 0x53, 0xef, 0xdd, 0x78, 0x65, 0x0e, 0x43, 0x28,
+    0x4a, 0x16, 0x01, 0xe2, 0xbd, 0xc5, 0x09, 0xe2, 0x23, 0xf4, 0x27, 0x36, 0x5a, 0x38, 0xc6, 0xfd,
+    0x53, 0xd0, 0x3c, 0xd0, 0xeb, 0x86, 0x66, 0x68, 0xaf, 0x46, 0xca, 0x50, 0xf0, 0xae, 0x9d, 0x11,
+    0xa9, 0x04, 0x16, 0x85, 0xd0, 0x1b, 0x63, 0x26, 0xd7, 0xd9, 0x3f, 0x25, 0x71, 0x91, 0x04, 0x5f,
+    0x68, 0x84, 0x5c, 0x90, 0x1c, 0x74, 0x80, 0xbf, 0x7c, 0x63, 0xfe, 0x94, 0x43, 0x05, 0x78, 0x9e,
+    0x03, 0x00, 0xb0, 0xac, 0x7b, 0x6e, 0xba, 0x88, 0xfb, 0xfe, 0xee, 0xdb, 0xfc, 0xe2, 0x76, 0x06,
+    0x84, 0x52, 0xea, 0x16, 0x53, 0xf4, 0x2d, 0x2a, 0x89, 0x33, 0x7d, 0x64, 0x43, 0xab, 0x88, 0x4b,
+    0xc7, 0xea, 0xad, 0xcf, 0xde, 0xd6, 0xaa, 0x18, 0x00, 0xe8, 0x1f, 0x01, 0xd0, 0x72, 0xee, 0x6c,
+    0x02, 0x0b, 0xf3, 0xf7, 0x45, 0x6c, 0x34, 0x64, 0x05, 0xc7, 0xba, 0xe9, 0x9a, 0x13, 0x97, 0x41,
+    0x53, 0x89, 0x98, 0x73, 0x09, 0xc4, 0x09, 0x41, 0xb0, 0xc7, 0x77, 0xc7, 0x1e, 0x79, 0xa1, 0x43,
+    0xc6, 0x01, 0x70, 0x42, 0x2c, 0xe9, 0x0a, 0xed, 0x26, 0xa1, 0x87, 0x1c, 0x87, 0xcf, 0xa1, 0x7c,
+    0x65, 0xb2, 0x97, 0x22, 0x1b, 0x24, 0x02, 0xf0, 0x50, 0x49, 0xb6, 0x9c, 0xca, 0x84, 0x7f, 0x9c,
+    0xf5, 0x97, 0x05, 0x97, 0xc5, 0x68, 0xce, 0x17, 0x84, 0xa0, 0x20, 0x12, 0x04, 0x41, 0x30, 0x6c,
+    0x65, 0x6c, 0x56, 0xb5, 0xb2, 0x1b, 0x19, 0x01, 0x50, 0x36, 0x2a, 0x8a, 0x22, 0xa8, 0x7e, 0x18,
+    0x84, 0x60, 0x78, 0x00, 0x06, 0x03, 0x41, 0x00, 0x50, 0x14, 0x05, 0x81, 0x20, 0x4c, 0x0f, 0x01,
+    0x41, 0x9d, 0x00, 0xe2, 0x64, 0xeb, 0xfc, 0x9b, 0xc9, 0xfd, 0x5e, 0xb6, 0x48, 0xa8, 0x5b, 0x28,
+    0x9c, 0x41, 0xb0, 0x41, 0x9e, 0xd8, 0xc9, 0xc7, 0xff, 0x9b, 0x20, 0x36, 0x4d, 0x42, 0xc4, 0xe0,
+    0x72, 0x0b, 0x81, 0x50, 0x4c, 0x1b, 0x05, 0xc1, 0x10, 0x44, 0x01, 0x00, 0xc0, 0x80, 0x20, 0x1a,
+    0x07, 0xc5, 0x6e, 0x28, 0x5a, 0x4f, 0xb0, 0x3e, 0x56, 0xcc, 0xe9, 0x09, 0x75, 0x0e, 0x29, 0x9a,
+    0xd0, 0x55, 0x8d, 0x3c, 0x0f, 0xfd, 0xf1, 0x23, 0x79, 0xbd, 0x35, 0x70, 0xad, 0x16, 0x0b, 0x97,
+    0x10, 0x32, 0xd6, 0x6f, 0x80, 0x03, 0xd2, 0x39, 0xd2, 0xf4, 0x16, 0xc3, 0xb0, 0xf8, 0x0b, 0x12,
+    0xe1, 0x2c, 0x9e, 0x48, 0x27, 0x8c, 0x8f, 0x00, 0xdd, 0xe8, 0x08, 0x3f, 0x1f, 0x98, 0x54, 0x42,
+    0x76, 0x97, 0x52, 0x56, 0x86, 0x98, 0xcd, 0x26, 0xb4, 0x31, 0x08, 0xc5, 0xf5, 0xdd, 0x30, 0x11,
+    0x8a, 0xb4, 0x81, 0xbc, 0x09, 0x44, 0x78, 0x16, 0x44, 0x64, 0xe4, 0x67, 0xce, 0xd3, 0xda, 0xdf,
+    0x6d, 0x52, 0xbf, 0xec, 0x0b, 0xb3, 0xd8, 0xac, 0x38, 0xcf, 0x3c, 0xc1, 0x12, 0x8e, 0x77, 0xe3,
+    0x92, 0x01, 0x66, 0x97, 0xb0, 0x20, 0x5a, 0xcd, 0x03, 0x26, 0x29, 0xf3, 0x30, 0x30, 0x8b, 0x26,
+    0x32, 0xef, 0xbe, 0xa2, 0x43, 0xfc, 0x3d, 0x18, 0x82, 0x40, 0x84, 0x11, 0x02, 0x40, 0xa0, 0x00,
+    0x01, 0x01, 0x60, 0x58, 0x22, 0x09, 0x82, 0xe0, 0xa8, 0x2a, 0x04, 0x89, 0xea, 0xca, 0xc2, 0xc0,
+    0x69, 0x35, 0x48, 0xc5, 0xfd, 0x95, 0x2c, 0x42, 0xf7, 0xa3, 0x40, 0x0a, 0x9d, 0x0f, 0x04, 0xe7,
+    0x72, 0xa0, 0x3f, 0x05, 0x80, 0xc8, 0xb2, 0x2b, 0xde, 0x0a, 0xf1, 0xce, 0xde, 0x81, 0x8f, 0x05,
+    0x48, 0x7b, 0x7f, 0xb9, 0x24, 0xeb, 0x6f, 0xbd, 0x79, 0x47, 0x83, 0x54, 0x8c, 0xc2, 0x88, 0x4a,
+    0xf0, 0xe4, 0x0b, 0x07, 0x62, 0x18, 0xaa, 0x22, 0x88, 0xa1, 0x98, 0x4a, 0x0f, 0x80, 0x42, 0xcd,
+    0x5a, 0xdd, 0x6e, 0x35, 0xfb, 0x0a, 0xe7, 0x0c, 0x43, 0x9f, 0x35, 0xa7, 0x36, 0x90, 0xbd, 0xbb,
+    0xdd, 0x97, 0xd8, 0x13, 0xc8, 0xb5, 0xc5, 0x3a, 0x84, 0x4f, 0x73, 0x45, 0x89, 0xc9, 0xdf, 0xba,
+    0x33, 0x9f, 0xac, 0xd9, 0x01, 0x84, 0xfa, 0xfe, 0x41, 0x5f, 0xc5, 0x59, 0x9b, 0x25, 0xce, 0x40,
+    0xbc, 0x8b, 0x4d, 0x90, 0x48, 0x36, 0x75, 0xc2, 0x05, 0x50, 0x46, 0x03, 0x47, 0xd9, 0x1d, 0x8f,
+    0x58, 0x27, 0xeb, 0xab, 0x9b, 0x1c, 0x0a, 0x08, 0x08, 0xf9, 0x05, 0xc8, 0x00, 0x76, 0xcb, 0x93,
+    0xaa, 0xfb, 0x95, 0x9b, 0x05, 0x7d, 0x0d, 0x1f, 0xc2, 0xc0, 0x80, 0x10, 0x02, 0x80, 0x10, 0x24,
+    0x0f, 0x07, 0x98, 0x32, 0x9f, 0x4e, 0x09, 0xad, 0x29, 0x4a, 0x42, 0x75, 0x21, 0xf6, 0x2a, 0x40,
+    0x96, 0xf5, 0x7f, 0x8f, 0x4d, 0x20, 0xd0, 0x1b, 0x2d, 0x19, 0xad, 0x3e, 0xfe, 0x83, 0xad, 0xba,
+    0xc0, 0xf9, 0x2e, 0x98, 0x4d, 0x59, 0xb9, 0xb7, 0xea, 0x3a, 0x55, 0xc1, 0xcd, 0x86, 0x0d, 0xf8,
+    0x0e, 0xec, 0xb5, 0x44, 0x30, 0xbc, 0x10, 0x1f, 0xea, 0x69, 0x00, 0xf7, 0x23, 0xc1, 0xf0, 0x1a,
+    0x20, 0x89, 0xa2, 0x68, 0x86, 0x19, 0x84, 0x60, 0x98, 0x0e, 0x08, 0x02, 0x60, 0x66, 0x29, 0x5f,
+    0x2e, 0xf7, 0xfa, 0x67, 0x0f, 0x33, 0xba, 0x00, 0x46, 0x6d, 0x86, 0x15, 0x3c, 0x8b, 0xc2, 0x38,
+    0x04, 0x2b, 0x1c, 0xb2, 0xe3, 0x4a, 0x14, 0x1c, 0xa7, 0x23, 0x45, 0xe5, 0x94, 0xa7, 0x62, 0x1d,
+    0xc2, 0xb0, 0x42, 0x03, 0x42, 0xb0, 0xc4, 0x2f, 0x09, 0x41, 0x70, 0x44, 0x08, 0x07, 0xce, 0x2d,
+    0x9c, 0x51, 0xbe, 0xcf, 0xf4, 0x3f, 0x33, 0xb1, 0xca, 0x10, 0x2b, 0x82, 0xc0, 0x14, 0xc5, 0x62,
+    0x35, 0x51, 0xf9, 0x9e, 0xcf, 0xe8, 0x03, 0xb8, 0x6b, 0x10, 0x00, 0xf8, 0x22, 0x22, 0x85, 0x21,
+    0x88, 0x3e, 0x0b, 0x81, 0x60, 0x20, 0x18, 0x0d, 0x04, 0x41, 0x40, 0x54, 0x17, 0x05, 0x41, 0x50,
+    0x40, 0x0e, 0x02, 0xc0, 0x60, 0x14, 0x34, 0xb7, 0x1b, 0x11, 0x1e, 0x7e, 0x78, 0x8d, 0x3c, 0x2e,
+    0x3c, 0xde, 0xd0, 0xa0, 0xbd, 0x8b, 0x99, 0x30, 0xfd, 0xe5, 0x29, 0x99, 0x0b, 0x0c, 0x01, 0xa8,
+    0x0f, 0x08, 0xc3, 0xf0, 0xd4, 0x33, 0x05, 0x47, 0x79, 0x35, 0xad, 0x1b, 0x37, 0xf4, 0x55, 0x2e,
+    0xd5, 0xc7, 0x51, 0x9c, 0x24, 0x04, 0x20, 0x3e, 0x9e, 0x59, 0xae, 0xfd, 0xfa, 0x07, 0x3f, 0xb0,
+    0x5a, 0x17, 0x68, 0xa2, 0xcb, 0xe7, 0x8b, 0x27, 0xd0, 0x69, 0x99, 0x7f, 0xe3, 0x88, 0x8e, 0x6e,
+    0x5f, 0xa3, 0x67, 0x23, 0xd2, 0x0b, 0xb1, 0x8a, 0x02, 0x57, 0x17, 0xea, 0x8b, 0x78, 0x91, 0x0d,
+    0xc3, 0x3a, 0x33, 0x05, 0xb1, 0x08, 0x8f, 0xc1, 0x54, 0x44, 0xc2, 0x12, 0x83, 0x53, 0x34, 0xfc,
+    0x81, 0x06, 0x4b, 0x9e, 0x77, 0x89, 0x51, 0x68, 0x6e, 0x79, 0x47, 0xd1, 0x60, 0x3a, 0x0a, 0x4d,
+    0x94, 0xf1, 0x08, 0x85, 0xee, 0x25, 0x38, 0xbb, 0xb3, 0xfe, 0x10, 0x37, 0x02, 0xd3, 0x89, 0x9a,
+    0x8c, 0xef, 0x9f, 0xb5, 0x3e, 0xab, 0x56, 0x69, 0x02, 0x99, 0xc5, 0x30, 0x6e, 0x0e, 0x16, 0x0d,
+    0x6b, 0x7b, 0x12, 0xe4, 0xbb, 0x65, 0x34, 0x80, 0x20, 0x34, 0x12, 0x00, 0x02, 0x80, 0xa0, 0x20,
+    0x28, 0x0c, 0x00, 0x59, 0x64, 0xc0, 0x98, 0x52, 0x45, 0xd2, 0xa8, 0x6a, 0x92, 0x61, 0xa3, 0xf9,
+    0x5b, 0xb7, 0xb1, 0xbf, 0x7d, 0xc8, 0xa1, 0x8e, 0x0a, 0x9b, 0x3b, 0x96, 0x35, 0xd1, 0xd3, 0x72,
+    0x30, 0x48, 0x21, 0xd8, 0xdd, 0x9d, 0xec, 0xdf, 0xf8, 0xb6, 0x67, 0xf7, 0x17, 0xe2, 0x48, 0xc3,
+    0xec, 0x7e, 0x6f, 0xc0, 0x99, 0xe2, 0x50, 0x40, 0x0b, 0xf3, 0xb7, 0x8b, 0xbd, 0x8b, 0xff, 0x3f,
+    0xc9, 0x3e, 0x5c, 0xfb, 0x6a, 0xca, 0xf8, 0xaf, 0xa2, 0xc1, 0x53, 0xa6, 0x58, 0x8f, 0x10, 0x02,
+    0xe1, 0x18, 0x8c, 0x86, 0x21, 0x2d, 0x95, 0xbd, 0x49, 0x59, 0x7f, 0xe1, 0x3f, 0xe0, 0xfe, 0xc2,
+    0xef, 0x8b, 0xca, 0x30, 0xc0, 0x1e, 0x20, 0xdb, 0xbf, 0xb5, 0xc5, 0x10, 0xb3, 0x64, 0xd0, 0xe4,
+    0xab, 0xa3, 0x7a, 0x66, 0xde, 0x9c, 0x08, 0xc2, 0x02, 0x7c, 0x85, 0xda, 0xce, 0x9f, 0xf0, 0xff,
+    0x4a, 0xe9, 0x8a, 0xc1, 0x7c, 0x13, 0x6a, 0xe2, 0xaf, 0x05, 0x1f, 0x7a, 0xc5, 0xc6, 0xd2, 0x11,
+    0xa3, 0xe0, 0xe4, 0xf5, 0x77, 0x49, 0x71, 0x56, 0x1f, 0xe1, 0xb5, 0xd9, 0x72, 0xce, 0x2d, 0xe3,
+    0x1b, 0x5b, 0xdb, 0x4b, 0xff, 0xc0, 0xaf, 0xff, 0xa5, 0x37, 0x97, 0x75, 0xf4, 0xfb, 0x29, 0xb8,
+    0x74, 0x38, 0x0b, 0x86, 0x00, 0xa0, 0x90, 0x08, 0x02, 0x05, 0x05, 0x81, 0x59, 0xe5, 0x3c, 0x8c,
+    0x84, 0xc8, 0x27, 0x33, 0x70, 0x44, 0x4c, 0x17, 0x7c, 0xba, 0x77, 0x97, 0x55, 0x67, 0x1e, 0x89,
+    0x1a, 0x93, 0xa8, 0xa7, 0x02, 0x9c, 0x38, 0x1c, 0x58, 0x27, 0xe7, 0x14, 0x1a, 0x37, 0x37, 0x75,
+    0xb5, 0x43, 0xd1, 0xe4, 0x56, 0x71, 0x5c, 0x9f, 0x3c, 0x50, 0x51, 0xbc, 0x8e, 0x48, 0x1f, 0x03,
+    0x18, 0xb0, 0xde, 0x16, 0xec, 0x27, 0x0f, 0x7a, 0xdd, 0xe5, 0x8a, 0xc2, 0x52, 0x98, 0x3a, 0xf0,
+    0x97, 0xf5, 0xee, 0xad, 0x76, 0x54, 0x48, 0xc8, 0x5c, 0xae, 0xcd, 0x09, 0xd8, 0x92, 0xa2, 0x50,
+    0x48, 0x17, 0x18, 0x90, 0x47, 0x63, 0x71, 0x68, 0x9c, 0x32, 0x13, 0x02, 0x81, 0xc2, 0x01, 0x74,
+    0x57, 0xaf, 0xab, 0x0f, 0xfa, 0xef, 0xf4, 0xcf, 0xcf, 0x5f, 0x4c, 0x5b, 0x7b, 0x36, 0xee, 0xc7,
+    0xc7, 0x03, 0x90, 0x7c, 0x5e, 0x4d, 0x28, 0x94, 0x49, 0x24, 0x12, 0x08, 0x5f, 0x33, 0x73, 0xc7,
+    0xba, 0xff, 0xd7, 0x6c, 0xef, 0x62, 0x54, 0xd7, 0x77, 0x83, 0x1f, 0x9f, 0xad, 0x7e, 0x7b, 0xc6,
+    0x5f, 0x22, 0x76, 0x26, 0x69, 0xf9, 0x9d, 0x27, 0x97, 0x36, 0x57, 0x71, 0x16, 0x7e, 0xb7, 0xea,
+    0x10, 0x85, 0x75, 0xe5, 0x0d, 0xad, 0xc8, 0xbd, 0xde, 0x06, 0x6d, 0x19, 0x8a, 0xc3, 0x21, 0x30,
+    0x60, 0x34, 0x16, 0x0b, 0x04, 0x82, 0x41, 0x00, 0x60, 0x20, 0x38, 0x71, 0x5b, 0xd6, 0x13, 0x85,
+    0x7f, 0x03, 0x9a, 0x02, 0x6c, 0x31, 0x36, 0x42, 0x10, 0xe0, 0xd0, 0xa9, 0x10, 0x06, 0x27, 0x65,
+    0xc1, 0x8d, 0xeb, 0xde, 0x9a, 0xe8, 0x2d, 0x13, 0xbf, 0xc2, 0xc5, 0x6c, 0x2d, 0x0c, 0x61, 0x9a,
+    0x6c, 0x2d, 0x34, 0x51, 0x08, 0x60, 0x41, 0x83, 0x5d, 0x41, 0x9f, 0xab, 0x7e, 0x7b, 0xce, 0x1b,
+    0xb1, 0xa0, 0x78, 0xa8, 0xba, 0x6a, 0x7d, 0xfe, 0xe7, 0xe5, 0xfd, 0xfd, 0xb3, 0x25, 0x85, 0xe1,
+    0x10, 0x18, 0x0b, 0x09, 0x85, 0x42, 0x61, 0x10, 0x68, 0x24, 0x0c, 0x37, 0x34, 0x79, 0x52, 0xce,
+    0xfe, 0x63, 0xf9, 0x56, 0xf4, 0xc2, 0x51, 0x53, 0x50, 0xcc, 0x42, 0x08, 0x02, 0x01, 0xe1, 0x90,
+    0xf8, 0xa4, 0x4e, 0x29, 0x14, 0x85, 0x50, 0xb2, 0xb9, 0x1e, 0x74, 0x8a, 0x8c, 0x42, 0x40, 0x98,
+    0x7c, 0x4a, 0x21, 0x0b, 0x85, 0xc0, 0xa0, 0x90, 0x40, 0x46, 0x5c, 0xf1, 0xa5, 0xd7, 0xff, 0x26,
+    0xd4, 0xbf, 0x14, 0x79, 0xfb, 0x5e, 0x75, 0x3f, 0x8f, 0x5f, 0x8c, 0x00, 0x75, 0x04, 0xae, 0x17,
+    0x9a, 0x9d, 0x70, 0x99, 0x60, 0x30, 0xcf, 0x75, 0xa5, 0xb9, 0x9b, 0x6c, 0x64, 0xff, 0x0e, 0x9e,
+    0x60, 0x23, 0xb0, 0x1c, 0xdb, 0x13, 0x55, 0xcf, 0x5b, 0xcc, 0xfd, 0x28, 0x02, 0x48, 0x63, 0x33,
+    0x51, 0x32, 0x4f, 0x3f, 0x96, 0x81, 0x82, 0x80, 0x4b, 0x55, 0xfe, 0xb4, 0x9f, 0x18, 0xc0, 0x8b,
+    0x53, 0xa8, 0xb7, 0xaf, 0xeb, 0x95, 0xaa, 0xf0, 0x4d, 0xe0, 0x6c, 0x05, 0xd8, 0xb4, 0xbf, 0x86,
+    0xba, 0x33, 0x4b, 0xfa, 0x84, 0xbb, 0x98, 0x08, 0x97, 0x1b, 0xdb, 0xca, 0x84, 0x4f, 0x90, 0xed,
+    0xbf, 0x40, 0x71, 0x66, 0xed, 0xf2, 0x18, 0x03, 0x29, 0x00, 0xa9, 0xba, 0x03, 0xc8, 0xc8, 0x2f,
+    0x2f, 0xf0, 0xa8, 0x92, 0x92, 0xe8, 0xec, 0x29, 0xd6, 0xfd, 0x4b, 0x2b, 0x73, 0xc6, 0xba, 0xa7,
+    0x7c, 0x03, 0x2a, 0x8d, 0x33, 0xb5, 0x29, 0xb6, 0xe5, 0x7b, 0x92, 0x32, 0x32, 0x67, 0xac, 0xb5,
+    0xe6, 0xbf, 0xbe, 0x6b, 0xcf, 0x9b, 0x93, 0x9d, 0x57, 0x31, 0xc1, 0xc9, 0xc3, 0xc1, 0x10, 0x60,
+    0x12, 0x06, 0x00, 0x41, 0x20, 0xd0, 0x98, 0x5c, 0x32, 0x1d, 0x0c, 0x87, 0x42, 0xe0, 0xf6, 0x18,
+    0xb6, 0x7c, 0x6d, 0xdb, 0xf1, 0x64, 0xc0, 0x4e, 0x24, 0x03, 0xc2, 0x21, 0xf0, 0xb8, 0x5c, 0x1a,
+    0x09, 0x01, 0x03, 0x6b, 0xee, 0xce, 0xe7, 0x1f, 0xed, 0xdc, 0x81, 0xea, 0xec, 0x1a, 0xff, 0x93,
+    0x91, 0xc5, 0x41, 0xa0, 0x50, 0x00, 0x0f, 0x0a, 0x86, 0xc3, 0xe1, 0xd0, 0xa9, 0x0e, 0x01, 0x44,
+    0xe6, 0xcc, 0xe1, 0x71, 0xe9, 0xb0, 0xa2, 0x70, 0x9a, 0x01, 0x8f, 0x80, 0x14, 0x29, 0x8a, 0x54,
+    0x87, 0xb8, 0xa9, 0xd1, 0xee, 0xde, 0x9d, 0x65, 0x1a, 0x0c, 0x94, 0x51, 0x10, 0x54, 0x74, 0x86,
+    0xd9, 0x69, 0x36, 0x5c, 0x25, 0xd1, 0x98, 0xdb, 0x9a, 0x79, 0x3c, 0x08, 0x7d, 0x27, 0x57, 0x51,
+    0x02, 0x08, 0x6c, 0x17, 0x14, 0x71, 0xf5, 0x1d, 0xf9, 0x6f, 0xcf, 0x33, 0x90, 0xf2, 0xa8, 0xf2,
+    0xa0, 0x3b, 0x8d, 0x55, 0x6d, 0x80, 0x89, 0xdc, 0xe1, 0x0b, 0x50, 0x31, 0x2c, 0xf4, 0xde, 0x0b,
+    0x03, 0x87, 0x22, 0xf1, 0xc8, 0xc4, 0x46, 0x1f, 0x06, 0x82, 0x40, 0x80, 0xa0, 0x80, 0x60, 0x30,
+    0x1a, 0x0d, 0x06, 0x02, 0x81, 0x40, 0x70, 0x40, 0x66, 0xac, 0xe8, 0x82, 0xa7, 0xf0, 0xef, 0x8c,
+    0xf6, 0xb6, 0xbc, 0x89, 0x93, 0xc3, 0x80, 0x28, 0x7c, 0x4e, 0x2f, 0x14, 0x8a, 0x44, 0x61, 0xd0,
+    0x98, 0x3c, 0x06, 0x04, 0x21, 0xdc, 0xde, 0x04, 0xeb, 0xbf, 0xed, 0x73, 0xb7, 0x59, 0x50, 0x51,
+    0x61, 0xb8, 0x64, 0x25, 0xc8, 0x1c, 0x55, 0xe6, 0xff, 0xca, 0xa9, 0x8a, 0xd8, 0xe6, 0x30, 0x93,
+    0x26, 0xa3, 0xc0, 0xb8, 0x16, 0x31, 0x16, 0x90, 0xe8, 0xee, 0x40, 0xdc, 0xff, 0xb6, 0x4e, 0x3a,
+    0x19, 0xa0, 0xd2, 0x41, 0x13, 0x87, 0xc2, 0x20, 0xc1, 0xac, 0x42, 0xfe, 0x2a, 0x24, 0xc3, 0xa3,
+    0x31, 0x38, 0x74, 0x52, 0x10, 0x38, 0x16, 0xe0, 0x30, 0x69, 0x50, 0x10, 0x1a, 0x07, 0x03, 0x01,
+    0x81, 0xc1, 0x7a, 0x25, 0xc1, 0x40, 0x2c, 0xeb, 0x53, 0x44, 0x81, 0x03, 0x86, 0x38, 0x28, 0xa3,
+    0xb0, 0x4e, 0xe7, 0xc1, 0x70, 0xe0, 0x16, 0xa9, 0x31, 0x42, 0x05, 0x71, 0xc8, 0xac, 0x1e, 0xd3,
+    0x63, 0xf0, 0x23, 0xbb, 0x8d, 0x5d, 0xa2, 0xd4, 0xfb, 0xe2, 0x6e, 0x4f, 0x10, 0x01, 0x01, 0x50,
+    0xf8, 0x84, 0x3e, 0x19, 0x0b, 0x83, 0x41, 0x60, 0x30, 0x00, 0x00, 0x10, 0x02, 0x02, 0x02, 0x2c,
+    0x8e, 0x12, 0xe5, 0x7f, 0xe3, 0xd1, 0xc7, 0x6b, 0x4c, 0x4d, 0x63, 0x90, 0x30, 0x26, 0x00, 0xc6,
+    0x98, 0xab, 0xb4, 0x7e, 0x93, 0x04, 0x60, 0x26, 0x91, 0x38, 0x3f, 0x06, 0x48, 0x51, 0x5a, 0x55,
+    0xc4, 0xeb, 0x6c, 0xc3, 0x8f, 0x22, 0x20, 0x20, 0x2e, 0x67, 0x5c, 0x71, 0x44, 0xbf, 0xfa, 0xe6,
+    0xd5, 0xdb, 0x9d, 0x95, 0xad, 0x37, 0x9f, 0x2e, 0xa4, 0x9e, 0x08, 0x43, 0x90, 0xd0, 0x64, 0x10,
+    0x09, 0x02, 0x00, 0x89, 0xf8, 0x16, 0x8e, 0xd5, 0x98, 0x67, 0x84, 0x6c, 0xce, 0xbe, 0x2e, 0xf7,
+    0x9c, 0x83, 0x06, 0x0d, 0x08, 0x82, 0xa0, 0x90, 0x50, 0x04, 0x0c, 0x01, 0x02, 0x00, 0x40, 0x60,
+    0x30, 0x18, 0x26, 0xa9, 0x59, 0xa7, 0xa4, 0x64, 0xc0, 0xb8, 0x00, 0x19, 0x12, 0x8b, 0x47, 0xef,
+    0xcd, 0xe4, 0xa7, 0xfb, 0x77, 0x46, 0xde, 0xd3, 0x02, 0x91, 0x1c, 0x46, 0x18, 0x05, 0x81, 0x80,
+    0x40, 0x48, 0x24, 0x2a, 0x09, 0x15, 0xb4, 0xd8, 0x68, 0x48, 0x49, 0x10, 0x26, 0x05, 0x89, 0x45,
+    0x62, 0x91, 0x18, 0x74, 0x22, 0x0b, 0x01, 0x80, 0x81, 0x40, 0xc0, 0x80, 0x60, 0x4f, 0x78, 0x75,
+    0xc7, 0x11, 0xfe, 0x95, 0x08, 0x65, 0xa5, 0xd0, 0x98, 0xb2, 0xfa, 0x92, 0x90, 0xc2, 0x60, 0x69,
+    0x3e, 0x00, 0xdb, 0x18, 0x6f, 0xf1, 0x9c, 0x1b, 0x1a, 0x04, 0xe5, 0xc9, 0xf1, 0x44, 0x46, 0x04,
+    0x02, 0xc3, 0xa2, 0x10, 0xe8, 0x7c, 0x2a, 0x15, 0x05, 0x81, 0xc0, 0x20, 0x00, 0x20, 0x18, 0x10,
+    0x06, 0x04, 0x02, 0x01, 0x00, 0x40, 0x20, 0x18, 0x00, 0x08, 0x17, 0xa5, 0x38, 0xa1, 0x91, 0xf3,
+    0xaf, 0x64, 0xce, 0x55, 0x73, 0x69, 0x28, 0x58, 0x21, 0x0b, 0xcd, 0xed, 0xa2, 0xe5, 0x06, 0x33,
+    0x86, 0x8e, 0xd8, 0xa2, 0xf0, 0xe7, 0x38, 0xff, 0xdf, 0xc0, 0x05, 0x65, 0xdf, 0xb2, 0x59, 0xbe,
+    0x33, 0xd1, 0x44, 0xeb, 0x5a, 0xb4, 0x70, 0x73, 0x8c, 0x7c, 0x63, 0xf1, 0xbf, 0xfe, 0xf2, 0x67,
+    0xf0, 0x0d, 0x3a, 0x91, 0x0e, 0xf8, 0x16, 0x5d, 0xff, 0x27, 0xfd, 0x8e, 0xcc, 0x5c, 0xf5, 0xc9,
+    0xac, 0x4c, 0x82, 0xc1, 0x25, 0xab, 0xde, 0xd9, 0x32, 0xff, 0xc2, 0x7f, 0x86, 0xf0, 0x0d, 0x69,
+    0xfa, 0x18, 0x74, 0x68, 0x30, 0x34, 0x43, 0x45, 0x2f, 0xf2, 0xce, 0x19, 0xec, 0xff, 0x19, 0x7e,
+    0xdb, 0x26, 0x45, 0x1b, 0x77, 0xa7, 0x75, 0xff, 0xf8, 0x9e, 0x07, 0xa1, 0x4c, 0x9d, 0x93, 0x0d,
+    0x87, 0x86, 0x87, 0x1a, 0xcc, 0x75, 0x88, 0x36, 0x6a, 0xea, 0x70, 0x27, 0x25, 0x9b, 0xca, 0xbe,
+    0x65, 0xdc, 0xbf, 0x05, 0xfe, 0x7a, 0xdd, 0xc7, 0xad, 0x0b, 0x93, 0xcf, 0xaa, 0x21, 0xff, 0xe6,
+    0xfe, 0xef, 0xd9, 0xbc, 0xc0, 0xaa, 0xbe, 0x8c, 0xc4, 0x28, 0x68, 0x14, 0x2c, 0x08, 0x37, 0x05,
+    0x64, 0xd7, 0x9f, 0x74, 0x95, 0xf9, 0x1d, 0xa3, 0xd2, 0xa2, 0xbd, 0x34, 0x7c, 0x68, 0x18, 0x41,
+    0x06, 0x5f, 0x8a, 0x78, 0x86, 0x47, 0xe0, 0x26, 0x68, 0xe7, 0x19, 0x75, 0x91, 0x50, 0x2e, 0x75,
+    0xea, 0xd5, 0x5f, 0xfc, 0x4f, 0xac, 0xf9, 0x26, 0xed, 0x1c, 0xf1, 0xaf, 0x30, 0xfc, 0x3f, 0xfd,
+    0x0e, 0x69, 0xb2, 0x41, 0xaa, 0x10, 0xb7, 0xf4, 0x82, 0x01, 0x80, 0x80, 0x40, 0x66, 0xd5, 0xdc,
+    0xea, 0x59, 0xad, 0xea, 0x61, 0xbe, 0xd9, 0xca, 0x3e, 0x8b, 0xea, 0x76, 0x8d, 0x3a, 0x50, 0xa0,
+    0x24, 0x1a, 0x3a, 0x3a, 0x42, 0x36, 0x36, 0x26, 0x22, 0x1e, 0x12, 0x03, 0xcf, 0xbe, 0x51, 0xf8,
+    0xdf, 0xfe, 0xea, 0x45, 0xb5, 0x29, 0x70, 0xed, 0x2a, 0x18, 0x78, 0x08, 0x1e, 0x4a, 0x46, 0x56,
+    0x4a, 0x4a, 0x3a, 0x36, 0x26, 0x67, 0x3e, 0xf9, 0x90, 0x87, 0xfe, 0x03, 0xf4, 0xde, 0x2d, 0xb9,
+    0x49, 0x8a, 0x1d, 0xcd, 0xb0, 0xa9, 0x26, 0x19, 0xea, 0x91, 0xbf, 0xf0, 0xfe, 0x63, 0x5a, 0x89,
+    0x18, 0xc3, 0xf8, 0x37, 0x8a, 0x71, 0x1f, 0x19, 0xa3, 0x5b, 0xaf, 0x9f, 0x30, 0x4d, 0xff, 0x3d,
+    0xe4, 0x38, 0x84, 0x01, 0xc8, 0xcc, 0x23, 0x1e, 0x04, 0x02, 0x78, 0xc7, 0x70, 0x9c, 0x1a, 0x15,
+    0xa2, 0xde, 0xbd, 0x33, 0x91, 0xfa, 0xbb, 0x5b, 0x46, 0x4d, 0x4a, 0x3c, 0x18, 0x13, 0x17, 0x1f,
+    0x1d, 0x1b, 0x15, 0x11, 0x15, 0x06, 0xe2, 0x9e, 0xc1, 0xf4, 0xbf, 0xfe, 0x92, 0xa7, 0xf6, 0x6d,
+    0xeb, 0x62, 0xf4, 0x80, 0x5f, 0xf0, 0x3e, 0xf3, 0xd5, 0x34, 0xa6, 0x44, 0x40, 0x51, 0x12, 0x31,
+    0xf1, 0xb4, 0x78, 0x57, 0xc6, 0x08, 0xbf, 0xe7, 0xff, 0x8c, 0xf0, 0xcf, 0x06, 0x19, 0x57, 0xb8,
+    0x77, 0x0f, 0x62, 0xbb, 0xff, 0x0d, 0xe3, 0xb0, 0xcf, 0x80, 0x72, 0x4e, 0x8f, 0xae, 0xa1, 0x1c,
+    0x1b, 0xd3, 0xe8, 0x1e, 0xbd, 0x59, 0xf8, 0xaa, 0x56, 0x74, 0xac, 0x84, 0x00, 0x16, 0x32, 0x67,
+    0xc0, 0x3d, 0xd3, 0xec, 0x3f, 0xf4, 0xf6, 0x0e, 0x10, 0x4e, 0x71, 0x84, 0x64, 0x11, 0x0e, 0xa9,
+    0xb7, 0x7e, 0x47, 0xfa, 0x1a, 0x51, 0x40, 0xb7, 0x58, 0xf7, 0x01, 0x1f, 0xbc, 0xe8, 0xa5, 0x43,
+    0x7d, 0x0b, 0xb8, 0x68, 0x3d, 0x54, 0x69, 0xa0, 0x58, 0xa8, 0x9e, 0x2e, 0x7f, 0x28, 0xd0, 0xbc,
+    0x3a, 0x09, 0xf7, 0x5f, 0x98, 0x8e, 0xf6, 0x2f, 0x42, 0x71, 0xf1, 0x9b, 0x6a, 0x55, 0xf2, 0x71,
+    0x52, 0xf3, 0x61, 0x0f, 0xe3, 0x7d, 0xd6, 0x7c, 0x54, 0xa6, 0xe1, 0x87, 0x4a, 0x90, 0x06, 0x8d,
+    0x59, 0x3d, 0xf0, 0x8f, 0xfe, 0x53, 0xdb, 0xf5, 0x49, 0x94, 0x40, 0x2a, 0x26, 0x79, 0x64, 0xd1,
+    0xbd, 0x31, 0x7f, 0xf9, 0xae, 0x4f, 0x72, 0x3c, 0x2d, 0x83, 0xb1, 0x60, 0xd0, 0x22, 0xa0, 0x82,
+    0x78, 0x37, 0x9a, 0x36, 0xff, 0xc8, 0xf9, 0xcf, 0x18, 0x9a, 0x36, 0x33, 0x13, 0x16, 0x08, 0x13,
+    0xc8, 0x4a, 0x68, 0xd3, 0xe3, 0x61, 0x34, 0x0e, 0x7d, 0x18, 0xfe, 0xc3, 0xfc, 0x3e, 0xbd, 0xdb,
+    0x2e, 0x10, 0x63, 0x40, 0xe0, 0x50, 0x93, 0x56, 0xaf, 0x44, 0x1f, 0xff, 0x95, 0xf9, 0xaf, 0xe5,
+    0x5e, 0xe1, 0xcb, 0xfa, 0xcd, 0x63, 0xc3, 0xbd, 0x03, 0x2b, 0xfe, 0x1a, 0x35, 0xf8, 0x34, 0x5b,
+    0xb9, 0xd5, 0x53, 0x8f, 0xa0, 0xb2, 0x5b, 0x74, 0xaa, 0xb5, 0xeb, 0x53, 0xbf, 0xeb, 0xb8, 0xae,
+    0x1c, 0xb0, 0xc4, 0x70, 0x48, 0x3c, 0x20, 0x28, 0x14, 0x18, 0x0c, 0x08, 0x26, 0xe6, 0xbd, 0x93,
+    0x38, 0xdf, 0xd0, 0xe1, 0x22, 0x1c, 0xbb, 0xc1, 0xa6, 0xbf, 0x4d, 0x94, 0xcd, 0x0b, 0x04, 0x8e,
+    0xcf, 0xa8, 0x81, 0xa6, 0xa1, 0x47, 0xc5, 0x95, 0xbb, 0x09, 0x15, 0x32, 0x98, 0xac, 0x28, 0x0a,
+    0x2e, 0x5e, 0x23, 0xc8, 0xb7, 0x6f, 0xa9, 0xff, 0x61, 0x7d, 0xc2, 0xbb, 0x17, 0xcb, 0x0d, 0xbd,
+    0x6f, 0x01, 0x7a, 0x29, 0x5b, 0x74, 0xb2, 0x3d, 0x13, 0x00, 0x0b, 0x90, 0x8f, 0x90, 0x8c, 0x8b,
+    0x88, 0x86, 0x82, 0x80, 0x8e, 0xf1, 0xaf, 0x62, 0xfa, 0x9f, 0xfc, 0x74, 0xab, 0xd3, 0x27, 0xd2,
+    0x35, 0x8c, 0xf9, 0x80, 0xc0, 0x10, 0x74, 0xa6, 0xf1, 0xdf, 0x3c, 0x6f, 0xfd, 0xf6, 0x83, 0x93,
+    0x62, 0xd9, 0x74, 0xe3, 0x9b, 0x3f, 0x7e, 0xdf, 0xe4, 0xbc, 0x4b, 0x3a, 0x5a, 0x52, 0x06, 0x11,
+    0x97, 0x77, 0x26, 0xff, 0xf0, 0xdf, 0x03, 0xe4, 0x1d, 0x08, 0x99, 0xfc, 0x69, 0x10, 0x40, 0x50,
+    0xed, 0x06, 0x7c, 0xf5, 0xa1, 0xdc, 0xe2, 0xd4, 0x85, 0x81, 0x60, 0x71, 0xf3, 0xdc, 0xab, 0xb9,
+    0x78, 0x2f, 0xf4, 0x34, 0x7c, 0xca, 0x39, 0x08, 0x4a, 0x3e, 0x26, 0x1e, 0x1c, 0x4d, 0x17, 0xa5,
+    0x06, 0x1a, 0xa3, 0xe3, 0x2d, 0x1e, 0xe1, 0x16, 0xfa, 0xff, 0x8e, 0xd7, 0xbc, 0x13, 0xab, 0x6b,
+    0x7e, 0xce, 0x29, 0x06, 0x1c, 0x36, 0x14, 0x18, 0x0a, 0x06, 0x59, 0x83, 0xa8, 0x57, 0x9d, 0x09,
+    0x02, 0x03, 0xc5, 0xc6, 0x45, 0xc5, 0x44, 0x47, 0xce, 0x39, 0xb6, 0x35, 0xf9, 0x4f, 0xe5, 0xf4,
+    0x0d, 0x61, 0xf1, 0xc0, 0xf0, 0x90, 0x58, 0x30, 0x2e, 0x12, 0xb7, 0xa5, 0x6c, 0x98, 0x0f, 0x01,
+    0x5f, 0x57, 0x10, 0xa1, 0x46, 0x8e, 0x83, 0x02, 0x45, 0xc4, 0x49, 0xc4, 0x79, 0xd6, 0xd9, 0xf8,
+    0x7f, 0xe4, 0x72, 0x8b, 0x20, 0x49, 0xc6, 0x65, 0xea, 0x8d, 0x9e, 0x9f, 0x97, 0x8f, 0x31, 0xb8,
+    0x58, 0x94, 0x2d, 0xdd, 0x3b, 0x49, 0xfd, 0x95, 0xae, 0xc4, 0x70, 0x88, 0x7e, 0x7d, 0x4e, 0x95,
+    0xcb, 0xeb, 0x1a, 0xb7, 0x2e, 0xa8, 0xfe, 0x27, 0x49, 0xd6, 0xb1, 0x25, 0x38, 0x59, 0xb1, 0x38,
+    0x74, 0xe8, 0x29, 0x04, 0x04, 0x74, 0x1c, 0x1d, 0x26, 0x66, 0x13, 0x8c, 0x73, 0x08, 0xd7, 0x95,
+    0xfa, 0x2b, 0x06, 0x3c, 0x57, 0x0f, 0x88, 0x51, 0x92, 0x07, 0x01, 0x03, 0x43, 0xc3, 0xc8, 0x41,
+    0xf9, 0x36, 0xad, 0xf8, 0x9f, 0xf1, 0x55, 0xcf, 0x58, 0xf7, 0xc0, 0x8f, 0x09, 0x7b, 0x7c, 0x41,
+    0x37, 0xdc, 0xb8, 0x56, 0x37, 0xb1, 0x92, 0xbf, 0xbb, 0x78, 0x11, 0x17, 0x5d, 0xc1, 0x42, 0xe4,
+    0xde, 0x01, 0x8a, 0x76, 0xde, 0x5e, 0xc8, 0xc0, 0x2a, 0x23, 0x36, 0x26, 0xc2, 0x4d, 0xb1, 0x6e,
+    0x1d, 0x30, 0xf7, 0x1e, 0x9f, 0x1e, 0x6c, 0x26, 0x05, 0x7b, 0x07, 0x98, 0x44, 0x8a, 0x82, 0x03,
+    0xc7, 0x46, 0xca, 0x41, 0x34, 0xec, 0xdb, 0xd3, 0xff, 0x53, 0x43, 0xc7, 0x39, 0x17, 0x83, 0x22,
+    0xf9, 0x2a, 0xce, 0x3d, 0x22, 0x26, 0x2a, 0xd4, 0x29, 0x9f, 0x39, 0xf8, 0xfc, 0xd3, 0x4a, 0x87,
+    0x13, 0x40, 0x3a, 0x91, 0x8f, 0xf1, 0x1e, 0xdb, 0x90, 0x79, 0xd7, 0x20, 0xcf, 0x79, 0x79, 0x41,
+    0xe2, 0xe8, 0x34, 0xca, 0x44, 0x74, 0x2c, 0x0e, 0x22, 0x2e, 0x2e, 0x2e, 0x22, 0x22, 0x1a, 0x02,
+    0x36, 0xd1, 0xe1, 0x8f, 0x7f, 0xe9, 0x64, 0xfe, 0xf5, 0x83, 0xc6, 0xf4, 0xcd, 0xcb, 0x6e, 0xdf,
+    0x7e, 0x42, 0xe9, 0x9e, 0x24, 0x1d, 0x02, 0x09, 0x8a, 0x8e, 0x8f, 0x84, 0xe2, 0x9b, 0x57, 0x8b,
+    0xff, 0x41, 0x1d, 0xec, 0x98, 0x14, 0x51, 0x28, 0x68, 0x20, 0x24, 0x2c, 0x3c, 0x3c, 0x3c, 0x54,
+    0x96, 0xe5, 0xc3, 0xb9, 0xcf, 0xf0, 0x94, 0x3f, 0x00, 0xf2, 0x85, 0x2f, 0x4b, 0xbc, 0xe2, 0x14,
+    0xa5, 0x62, 0xa0, 0x40, 0xb0, 0xd3, 0x35, 0xae, 0xd4, 0x7f, 0xfb, 0xde, 0xaf, 0x89, 0x46, 0x08,
+    0x90, 0xa9, 0x83, 0x43, 0x60, 0x02, 0x0a, 0x4f, 0x2e, 0xe5, 0xad, 0xed, 0x5c, 0x33, 0x36, 0xdc,
+    0x7a, 0xc9, 0x42, 0xf0, 0x6a, 0x89, 0x5c, 0x72, 0x34, 0x6c, 0x24, 0x06, 0x09, 0x89, 0x65, 0x5e,
+    0x3b, 0xf4, 0x13, 0x28, 0x14, 0x03, 0xac, 0x48, 0xb4, 0xd9, 0x1b, 0x01, 0x40, 0x90, 0x90, 0x00,
+    0x00, 0x38, 0x28, 0x39, 0x9c, 0x24, 0x83, 0x62, 0x68, 0xe6, 0x39, 0x0c, 0x22, 0x78, 0xb0, 0x44,
+    0x08, 0x1a, 0x22, 0x1e, 0x22, 0x12, 0x13, 0x18, 0x28, 0x10, 0x00, 0x83, 0x06, 0x0c, 0x18, 0x50,
+    0x40, 0xc1, 0x81, 0x04, 0x04, 0x00, 0x20, 0xb1, 0x9f, 0xa8, 0xf2, 0x9f, 0xfe, 0x7f, 0xfe, 0xe7,
+    0xbc, 0xe9, 0x9b, 0x28, 0xd7, 0x44, 0x74, 0xaa, 0x37, 0x91, 0x1e, 0xbb, 0x1d, 0xff, 0x9f, 0xfe,
+    0x97, 0xf5, 0x5f, 0xd7, 0x68, 0xff, 0x9b, 0xd2, 0xd0, 0x66, 0xb6, 0x8f, 0x0b, 0x03, 0x26, 0x4c,
+    0xb9, 0x32, 0x63, 0xc4, 0x85, 0x06, 0x00, 0x10, 0x61, 0x02, 0x05, 0x0c, 0x10, 0x30, 0x50, 0x81,
+    0x05, 0x79, 0x2f, 0xdb, 0x75, 0x3f, 0xfe, 0x87, 0x87, 0xf1, 0xda, 0x29, 0xe7, 0x47, 0x86, 0x04,
+    0x04, 0xcf, 0x06, 0x86, 0xf2, 0x90, 0xe0, 0x02, 0xe6, 0x4d, 0x97, 0x26, 0x3c, 0x48, 0x50, 0x01,
+    0x03, 0x0a, 0x14, 0x30, 0x60, 0xe1, 0x02, 0x85, 0x07, 0xef, 0x3f, 0x0d, 0xfd, 0x7f, 0xfe, 0xe5,
+    0x74, 0xb6, 0x0b, 0xcb, 0x48, 0x30, 0x0c, 0x44, 0x8a, 0x12, 0xa7, 0xca, 0x9d, 0xc8, 0x7d, 0x07,
+    0x6f, 0xff, 0xf1, 0x77, 0xbf, 0xb6, 0xe3, 0xa8, 0xa2, 0x09, 0x0c, 0x06, 0x0c, 0x58, 0x71, 0x22,
+    0xc4, 0x87, 0x12, 0x14, 0x38, 0x31, 0xa1, 0x7d, 0xe7, 0xb2, 0xff, 0x73, 0xff, 0xaf, 0xe4, 0x3e,
+    0x00, 0x89, 0x48, 0xe5, 0x48, 0x85, 0x41, 0xa2, 0xe1, 0x07, 0xf3, 0xab, 0x74, 0x8e, 0xef, 0xfd,
+    0xd5, 0xb7, 0xee, 0xf9, 0x1c, 0xe6, 0x6a, 0x28, 0x97, 0x35, 0xec, 0xbf, 0x33, 0xff, 0x3a, 0x93,
+    0x5c, 0x89, 0x08, 0xff, 0x84, 0xd5, 0x7d, 0x7e, 0x87, 0x94, 0xac, 0x40, 0x50, 0x58, 0x92, 0xe3,
+    0xc7, 0x8f, 0x16, 0x1c, 0x89, 0xef, 0x41, 0xda, 0x7f, 0x8f, 0xff, 0xa7, 0xb6, 0xf0, 0x0d, 0x88,
+    0xc5, 0x7b, 0x86, 0x5e, 0x96, 0x6b, 0xc1, 0x6c, 0x7a, 0x93, 0xee, 0x2e, 0x1b, 0xe2, 0x64, 0x2f,
+    0x95, 0x0a, 0x06, 0x8c, 0x87, 0xc2, 0x5a, 0x7f, 0xc6, 0xfe, 0xd6, 0xfb, 0x41, 0x31, 0x04, 0xa0,
+    0xe0, 0xe2, 0x02, 0x02, 0x04, 0x01, 0x0b, 0x63, 0xac, 0xf8, 0xcb, 0x7f, 0x6e, 0xae, 0x04, 0x47,
+    0xd2, 0x64, 0xbd, 0xdf, 0x62, 0x56, 0x53, 0xe1, 0x3d, 0x27, 0xaf, 0xfe, 0xac, 0x37, 0xb2, 0xfa,
+    0xc2, 0x7f, 0xe2, 0x77, 0xfc, 0xb6, 0x82, 0x29, 0xb7, 0x35, 0xa8, 0xfe, 0xcf, 0xfb, 0x3d, 0xf7,
+    0x7d, 0x10, 0xf0, 0x80, 0x00, 0x62, 0xc4, 0x89, 0x12, 0x24, 0x68, 0x7e, 0x73, 0xd6, 0x7c, 0x5f,
+    0xfe, 0x0d, 0x9f, 0x3c, 0x70, 0xa6, 0x13, 0x25, 0x0c, 0x58, 0x08, 0xd2, 0xa5, 0x4a, 0x93, 0x1e,
+    0x3c, 0x19, 0xd6, 0x9f, 0x82, 0x88, 0xff, 0xe7, 0x7f, 0x83, 0xf0, 0x1e, 0x6b, 0x59, 0x40, 0x4b,
+    0x11, 0xf4, 0x1a, 0x3f, 0xfb, 0x7b, 0xfd, 0x83, 0xc7, 0xc6, 0x87, 0x08, 0x02, 0x00, 0x28, 0x10,
+    0xe0, 0xc1, 0x85, 0x02, 0x0c, 0x10, 0x06, 0x21, 0xef, 0x9c, 0xe7, 0x77, 0x5f, 0x40, 0xa7, 0xf0,
+    0x39, 0x34, 0x48, 0xe8, 0xb1, 0xcf, 0x07, 0x02, 0xd4, 0x74, 0x1e, 0x77, 0xfd, 0x0c, 0xae, 0x33,
+    0x19, 0x29, 0x56, 0x1f, 0x2d, 0x14, 0x68, 0x30, 0x51, 0xa3, 0x47, 0x89, 0x0a, 0x86, 0x7b, 0xe9,
+    0x14, 0xff, 0xd5, 0xf8, 0x9e, 0x03, 0x21, 0x30, 0xe1, 0x31, 0x21, 0x82, 0x00, 0x81, 0x0a, 0x1c,
+    0x48, 0x91, 0x22, 0x43, 0x87, 0x02, 0xbd, 0x5d, 0x91, 0x62, 0x6c, 0xb3, 0x25, 0x71, 0x59, 0x36,
+    0x3e, 0xe3, 0xc3, 0x74, 0x3f, 0x6b, 0x17, 0x86, 0xf8, 0x09, 0xcf, 0x57, 0xa9, 0x0d, 0x6d, 0xec,
+    0xb6, 0x9e, 0x6f, 0xd3, 0xae, 0x84, 0x26, 0xfd, 0xc7, 0x9a, 0x8a, 0xf2, 0xfc, 0x18, 0x5b, 0xaf,
+    0x55, 0xa4, 0xf0, 0xff, 0x0a, 0xfe, 0x5b, 0x05, 0x4c, 0x88, 0x40, 0x71, 0xe4, 0x47, 0x8d, 0x1e,
+    0x2c, 0x38, 0x50, 0x60, 0x40, 0x04, 0x08, 0x10, 0x40, 0x60, 0xc2, 0x03, 0x06, 0x0c, 0x10, 0x7f,
+    0x3d, 0xf1, 0x5f, 0x77, 0xff, 0x32, 0xab, 0x8a, 0x90, 0x88, 0x47, 0x19, 0xa4, 0x6f, 0xb3, 0x09,
+    0x7d, 0x17, 0x91, 0x94, 0xa8, 0x14, 0x38, 0x78, 0xd2, 0x23, 0x45, 0x89, 0x06, 0x0c, 0x10, 0x20,
+    0xc0, 0x2b, 0x3d, 0x85, 0xcf, 0xfe, 0x76, 0xcf, 0xfb, 0xee, 0x63, 0x77, 0x0e, 0xf1, 0x48, 0x16,
+    0xc1, 0x04, 0x00, 0x3a, 0xcd, 0xd5, 0x53, 0xda, 0xf6, 0xef, 0xcd, 0x76, 0x1d, 0x66, 0x37, 0xd5,
+    0xc4, 0x85, 0x0f, 0x9a, 0xf7, 0x12, 0xde, 0x8f, 0x72, 0xd0, 0x29, 0xed, 0x02, 0x2c, 0xcc, 0x0e,
+    0x2a, 0x4a, 0xae, 0x0c, 0xb0, 0x50, 0x80, 0xdb, 0x89, 0xca, 0x0e, 0xc1, 0xab, 0x33, 0x3c, 0xab,
+    0x36, 0x33, 0x18, 0xb0, 0xd0, 0x4d, 0x37, 0x55, 0xf0, 0x7f, 0xcc, 0xac, 0xcd, 0x2c, 0x74, 0x60,
+    0x53, 0x37, 0x6e, 0x2a, 0x9a, 0x65, 0x37, 0x5d, 0x9f, 0xf0, 0xae, 0x77, 0x92, 0x03, 0x19, 0x2f,
+    0xc3, 0xa7, 0x98, 0xee, 0xb7, 0x9b, 0xdf, 0x1a, 0xad, 0xb6, 0x02, 0x7a, 0x86, 0xe4, 0x7c, 0xb4,
+    0xe4, 0x17, 0x2d, 0x69, 0xf1, 0xbe, 0xf5, 0x03, 0x66, 0x31, 0xde, 0x51, 0x67, 0x37, 0x46, 0x36,
+    0x0a, 0x6a, 0xd5, 0xdf, 0x69, 0xd6, 0x6c, 0xfc, 0xe9, 0x93, 0x67, 0x3d, 0x15, 0x47, 0x4f, 0x5a,
+    0xd8, 0x91, 0xd8, 0x7b, 0x4f, 0x1c, 0xef, 0xb9, 0x2e, 0xc0, 0x21, 0x00, 0x2d, 0x5d, 0xea, 0x39,
+    0xcc, 0x5f, 0x76, 0xfd, 0x56, 0xcb, 0xb4, 0xb3, 0xf6, 0x77, 0x5c, 0x36, 0xce, 0xe6, 0x01, 0x01,
+    0x02, 0x02, 0x83, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x0a, 0x08, 0x0a, 0xd8, 0xda,
+    0x2e, 0x88, 0xdf, 0x22, 0xe5, 0x31, 0x21, 0x82, 0x02, 0x06, 0x04, 0x08, 0x32, 0x91, 0xb4, 0x08,
+    0x6f, 0x5b, 0x4a, 0x3c, 0xeb, 0x06, 0xff, 0x23, 0xab, 0xdf, 0x53, 0x32, 0x25, 0x59, 0xe2, 0x35,
+    0xbf, 0xd5, 0xd1, 0xf3, 0x9a, 0x42, 0xaf, 0x56, 0x14, 0x14, 0x38, 0xb9, 0x99, 0x80, 0xb4, 0xbb,
+    0x0b, 0x8e, 0x7e, 0xc5, 0x80, 0xe3, 0xe3, 0x2d, 0x0b, 0x58, 0x95, 0x34, 0x00, 0x30, 0xd4, 0xad,
+    0xaa, 0x98, 0xe2, 0x5c, 0xb2, 0xe4, 0x37, 0xd8, 0x3e, 0xfd, 0xe8, 0x10, 0x13, 0x93, 0x89, 0x86,
+    0x01, 0x22, 0x27, 0x6d, 0x9e, 0xf8, 0x3f, 0xb7, 0x03, 0x41, 0x8e, 0x61, 0x53, 0x05, 0xe5, 0x27,
+    0x3b, 0xbd, 0x28, 0x44, 0xab, 0x2b, 0x18, 0x53, 0x75, 0x15, 0xbf, 0x91, 0x97, 0x50, 0x3f, 0x9a,
+    0xcf, 0x73, 0x78, 0x3b, 0x6d, 0x77, 0x05, 0xc1, 0xfd, 0xab, 0xad, 0x22, 0xa3, 0xc6, 0xb7, 0x55,
+    0x9f, 0x9f, 0xfb, 0x9b, 0xae, 0x0a, 0x59, 0xc1, 0x00, 0xc1, 0x44, 0x85, 0x12, 0x1c, 0x28, 0x50,
+    0x60, 0xc1, 0x01, 0x04, 0x08, 0x10, 0x40, 0x42, 0x5f, 0x76, 0xc7, 0x3f, 0x57, 0xe1, 0xf0, 0x58,
+    0x07, 0x8b, 0x8b, 0x10, 0x0c, 0x08, 0x08, 0x10, 0xa1, 0xc1, 0x89, 0x0a, 0x0d, 0x78, 0xba, 0xe2,
+    0x94, 0x65, 0xc9, 0x05, 0x66, 0xa5, 0xf4, 0xb6, 0xfb, 0x19, 0xe1, 0xfb, 0xf5, 0xcf, 0x0c, 0x1c,
+    0x14, 0x28, 0x30, 0x40, 0x40, 0x80, 0x01, 0x46, 0x36, 0xa9, 0x06, 0x05, 0xed, 0x14, 0x94, 0x7b,
+    0xd3, 0x41, 0x02, 0x08, 0x02, 0x18, 0x00, 0x40, 0x40, 0x87, 0xbb, 0x11, 0xac, 0x4d, 0xb7, 0x3d,
+    0xa8, 0x9f, 0xc8, 0x90, 0x44, 0x30, 0x7b, 0x51, 0x71, 0x10, 0xc3, 0x14, 0x6e, 0x0e, 0x7c, 0x3f,
+    0x37, 0x01, 0x10, 0xb0, 0x03, 0x57, 0x1c, 0xe1, 0xed, 0xab, 0xb4, 0x04, 0x85, 0x23, 0x1d, 0x70,
+    0x1e, 0x6c, 0xbb, 0xf3, 0x9c, 0x90, 0xfe, 0xbc, 0x17, 0x78, 0xf3, 0x91, 0x9b, 0x3c, 0xc0, 0xf4,
+    0x28, 0x74, 0x80, 0x48, 0x03, 0x5a, 0xad, 0xa4, 0x92, 0x21, 0x40, 0x45, 0xce, 0x67, 0xb6, 0x7f,
+    0x26, 0x84, 0xf4, 0x97, 0x75, 0x0d, 0xab, 0x6e, 0x81, 0x28, 0x81, 0x4c, 0xc1, 0x62, 0x38, 0x22,
+    0xbd, 0x5c, 0xfb, 0x02, 0xc7, 0xe2, 0xc5, 0x85, 0x95, 0x2b, 0xbd, 0xd6, 0xf9, 0xff, 0xc3, 0xa6,
+    0xde, 0xe7, 0xf5, 0x8c, 0xfe, 0xde, 0x7f, 0x63, 0x09, 0x8f, 0x23, 0xe8, 0x7f, 0x1f, 0xff, 0x77,
+    0x63, 0xd0, 0xa2, 0x1c, 0x23, 0x1d, 0x63, 0x43, 0x2f, 0x1f, 0x3b, 0xbd, 0xf6, 0x37, 0x7f, 0xea,
+    0xd3, 0x58, 0xdf, 0xb5, 0xca, 0xfc, 0x5e, 0x0f, 0x53, 0xd6, 0xf3, 0x3f, 0x0f, 0xfa, 0x7f, 0x73,
+    0x8d, 0xf2, 0x66, 0xa9, 0x5b, 0x9c, 0xdf, 0x2e, 0x5c, 0x8f, 0x81, 0xf1, 0x3a, 0x7f, 0xd1, 0x33,
+    0x70, 0xd2, 0x06, 0x56, 0x7e, 0x47, 0xa1, 0x9f, 0xf2, 0xe7, 0xc4, 0xd0, 0xa5, 0xb5, 0xf1, 0xb0,
+    0x7f, 0xe2, 0xf0, 0xf0, 0x82, 0x46, 0xa6, 0xb4, 0xe4, 0x82, 0x04, 0x71, 0xc7, 0x5e, 0x07, 0xe7,
+    0x2f, 0xff, 0xc5, 0xdb, 0xd8, 0x09, 0x68, 0x1c, 0x01, 0xf8, 0x7a, 0xdf, 0xb8, 0x77, 0xf4, 0x7c,
+    0xdd, 0x0d, 0x0c, 0x79, 0xba, 0x96, 0x02, 0xcc, 0xfa, 0x1c, 0x5f, 0xff, 0x37, 0x87, 0xf2, 0x38,
+    0x96, 0x9e, 0x20, 0x01, 0x41, 0xdc, 0xf9, 0x5e, 0x9f, 0xff, 0x7f, 0x5f, 0xc6, 0xfc, 0xae, 0xe7,
+    0x47, 0x83, 0x19, 0x62, 0x8a, 0x09, 0x7a, 0xf1, 0x3e, 0x13, 0x5e, 0xbe, 0x2a, 0x07, 0xc4, 0xd8,
+    0x47, 0x82, 0x16, 0x31, 0x45, 0x8a, 0x93, 0x54, 0x5f, 0x48, 0x47, 0xd8, 0xb9, 0x87, 0x83, 0xe6,
+    0x7d, 0x2d, 0x5f, 0xd3, 0x76, 0x71, 0x49, 0x0c, 0x40, 0x42, 0x37, 0x44, 0x4f, 0x13, 0xeb, 0x64,
+    0xff, 0xb7, 0x2f, 0xf6, 0x29, 0x7c, 0xfa, 0x5f, 0x4b, 0x93, 0xd9, 0x80, 0xd1, 0x45, 0x0c, 0x5b,
+    0x34, 0xb2, 0xab, 0xf0, 0xdb, 0x89, 0x8d, 0x08, 0x8d, 0xae, 0xf7, 0xab, 0xff, 0xa3, 0x5f, 0xd4,
+    0xd4, 0xd0, 0xf5, 0x01, 0xff, 0x37, 0xcd, 0xed, 0x7d, 0xee, 0x47, 0xc7, 0xfc, 0xde, 0x77, 0xe8,
+    0x5b, 0xfc, 0x12, 0xfc, 0x2f, 0xa9, 0x4b, 0xf3, 0x7c, 0xb8, 0x93, 0x16, 0x16, 0x58, 0x97, 0xa9,
+    0x18, 0xe7, 0xc0, 0x33, 0xfe, 0x2f, 0xb3, 0x8d, 0x29, 0xe5, 0x89, 0x47, 0x18, 0x4e, 0x0a, 0xdb,
+    0x5e, 0x93, 0xdf, 0xeb, 0xf7, 0xfb, 0x98, 0x8a, 0x6d, 0x7b, 0xdc, 0x9f, 0xfb, 0xb5, 0xfc, 0x6b,
+    0xd6, 0xca, 0xfa, 0xdd, 0x0f, 0x47, 0xeb, 0xb7, 0x3b, 0x22, 0xd1, 0x55, 0x3c, 0x68, 0x7f, 0xf3,
+    0xf9, 0x7e, 0x24, 0x20, 0x9b, 0x7e, 0xf6, 0x02, 0x43, 0x02, 0x18, 0xe2, 0x9e, 0xa7, 0xbd, 0x43,
+    0xfd, 0x3f, 0xcf, 0xc2, 0xc2, 0x1f, 0x3b, 0xe6, 0x19, 0xdd, 0xaa, 0x3d, 0x6c, 0xc8, 0x75, 0x59,
+    0xa3, 0x9d, 0xee, 0x51, 0xf2, 0x51, 0x60, 0x62, 0x84, 0x10, 0x41, 0x00, 0x10, 0x21, 0x93, 0x4e,
+    0xe0, 0x5b, 0x69, 0x64, 0x31, 0xe1, 0x61, 0x7f, 0x87, 0xf6, 0xfc, 0x8b, 0x17, 0x4c, 0x22, 0x29,
+    0xb6, 0xac, 0x24, 0x40, 0x62, 0x8e, 0x38, 0xa2, 0x86, 0x08, 0x22, 0xda, 0xf8, 0x0a, 0xff, 0xd1,
+    0xf9, 0xba, 0x9f, 0x43, 0xd4, 0x8b, 0xdd, 0x93, 0xa5, 0xe1, 0x4d, 0xe4, 0xef, 0x5e, 0xec, 0xf0,
+    0xcb, 0x95, 0x7a, 0x01, 0x00, 0x23, 0x95, 0xe9, 0x77, 0x7f, 0xd7, 0x77, 0x52, 0x30, 0x66, 0xf8,
+    0x1c, 0x6f, 0x0f, 0x67, 0x13, 0x99, 0xea, 0x65, 0xff, 0x0e, 0x09, 0x88, 0xde, 0xb8, 0xc1, 0x01,
+    0xe9, 0x72, 0xbf, 0x57, 0xfc, 0xdc, 0x8e, 0xf4, 0x08, 0x0f, 0x79, 0x11, 0xbf, 0xd7, 0xfc, 0xbe,
+    0x47, 0x52, 0xc7, 0x13, 0x95, 0xc5, 0xfb, 0xab, 0x82, 0xd6, 0xc4, 0x02, 0x82, 0x1c, 0x52, 0x49,
+    0x1c, 0xfc, 0x8f, 0x33, 0x67, 0xfe, 0x3e, 0xcf, 0x85, 0xb4, 0xd1, 0xc7, 0x11, 0x15, 0xfb, 0x12,
+    0x32, 0xbc, 0x4c, 0x5f, 0xe0, 0xdb, 0xa4, 0x49, 0x71, 0x2d, 0x74, 0xb9, 0x5e, 0xef, 0xf0, 0x41,
+    0xef, 0x7c, 0x60, 0x3e, 0x8c, 0xd8, 0xc8, 0xaf, 0x1a, 0xe4, 0x01, 0xaf, 0x79, 0x1d, 0x3f, 0xf9,
+    0x71, 0xfb, 0x98, 0x93, 0x0e, 0x20, 0x30, 0xc3, 0x1c, 0x5b, 0x9e, 0x76, 0xff, 0xfc, 0x99, 0x3d,
+    0x08, 0x45, 0x42, 0xa5, 0x0e, 0x4d, 0xa9, 0x45, 0x04, 0x38, 0xa5, 0x8e, 0x38, 0xe5, 0x9d, 0xda,
+    0x91, 0xfd, 0xdf, 0xbf, 0xc2, 0xeb, 0x52, 0x78, 0xe0, 0xe1, 0x79, 0xc5, 0xff, 0x67, 0xab, 0x84,
+    0xe1, 0x30, 0xb0, 0x22, 0x20, 0x1c, 0x2f, 0x2a, 0x5f, 0xf7, 0xf4, 0xf1, 0x9e, 0x70, 0xe2, 0x86,
+    0x08, 0x40, 0x02, 0x16, 0x3b, 0x31, 0xa7, 0x24, 0x20, 0xa2, 0x8e, 0x48, 0xa3, 0x86, 0x28, 0x00,
+    0x82, 0x10, 0x40, 0x08, 0x09, 0x1a, 0x1e, 0x27, 0x67, 0xfc, 0xf2, 0xf8, 0x85, 0x11, 0x52, 0xe3,
+    0x42, 0x04, 0x49, 0x24, 0x92, 0x4a, 0x34, 0x3c, 0x4b, 0x3f, 0xe8, 0xe0, 0xf2, 0x84, 0x23, 0x2a,
+    0x82, 0x83, 0x04, 0x28, 0x62, 0x8e, 0x28, 0x64, 0x81, 0xe1, 0x64, 0x7f, 0x87, 0xf6, 0xfa, 0x50,
+    0x97, 0xc6, 0xb0, 0xa3, 0xde, 0x01, 0x5f, 0xe0, 0xf9, 0xbb, 0x1e, 0x77, 0x6b, 0x47, 0xc9, 0x3a,
+    0x01, 0x07, 0x0c, 0x20, 0x2b, 0x99, 0x32, 0x7c, 0xda, 0x9a, 0xda, 0x9b, 0xff, 0x8f, 0x23, 0xe7,
+    0x31, 0xe4, 0xeb, 0xd2, 0xb5, 0x0d, 0x7e, 0x57, 0x3a, 0xff, 0x8e, 0x7c, 0x62, 0x8a, 0x28, 0x16,
+    0xd1, 0xd2, 0xda, 0xb7, 0xae, 0xaa, 0x72, 0xba, 0x83, 0x70, 0xe1, 0xa4, 0x43, 0x6a, 0xed, 0x6d,
+    0x6a, 0xf6, 0x48, 0xb9, 0x09, 0x20, 0x83, 0x0c, 0x71, 0x45, 0x17, 0x99, 0xb5, 0xfb, 0xff, 0xc7,
+    0xc0, 0xe8, 0x5c, 0x94, 0x71, 0x05, 0x75, 0xa2, 0x7f, 0x17, 0xc3, 0xca, 0x90, 0xa2, 0x84, 0x0c,
+    0x10, 0x70, 0x47, 0xda, 0x9d, 0xd9, 0xb3, 0x89, 0xb9, 0x7b, 0xb3, 0xdd, 0xe6, 0x44, 0xee, 0xbf,
+    0x89, 0x51, 0x63, 0x00, 0x04, 0x70, 0x73, 0x35, 0xbb, 0xbf, 0x96, 0x2e, 0x53, 0x43, 0x87, 0x1a,
+    0x72, 0x83, 0x06, 0x3e, 0x26, 0xa7, 0x9b, 0xfa, 0xa2, 0xec, 0x58, 0x84, 0x51, 0xc4, 0x12, 0x48,
+    0x60, 0x17, 0x4b, 0x99, 0x93, 0xf6, 0xdb, 0xa4, 0x95, 0x89, 0x0e, 0xb5, 0x72, 0x6b, 0xe1, 0x04,
+    0xe4, 0x68, 0x3e, 0x1c, 0x9b, 0x91, 0x0e, 0x49, 0x80, 0x24, 0x5e, 0xd3, 0xf1, 0xca, 0xac, 0x72,
+    0x04, 0x08, 0x20, 0x08, 0xb3, 0x43, 0x22, 0x8e, 0xfa, 0x9b, 0x9a, 0x17, 0xfd, 0x58, 0x1b, 0xda,
+    0x3a, 0xb0, 0xb0, 0x1e, 0x40, 0x20, 0x05, 0x2e, 0x37, 0x5a, 0x0f, 0xee, 0xe6, 0xe2, 0x4a, 0x28,
+    0xf6, 0xab, 0x38, 0x70, 0x85, 0xa9, 0xda, 0x67, 0xfc, 0x3e, 0x5e, 0xd6, 0x34, 0xc5, 0x06, 0x00,
+    0x30, 0xc5, 0x0c, 0x73, 0x3b, 0x10, 0xbf, 0x9f, 0xdf, 0xd6, 0x88, 0x96, 0x30, 0x6c, 0xef, 0x29,
+    0xa2, 0x09, 0x0c, 0x13, 0x14, 0x62, 0x00, 0x00, 0xd2, 0x5a, 0x48, 0xf4, 0xe4, 0x87, 0x41, 0x81,
+    0x00, 0x0c, 0x50, 0xc3, 0x0c, 0x30, 0x01, 0x00, 0x56, 0x3a, 0xce, 0x7e, 0xff, 0xbf, 0x89, 0xec,
+    0x77, 0xac, 0xf4, 0xdc, 0x8c, 0x20, 0x33, 0xc6, 0xa0, 0x81, 0x01, 0x8a, 0x48, 0xa3, 0x8e, 0x28,
+    0x21, 0x8a, 0x57, 0x5a, 0x97, 0xf4, 0x7c, 0x7e, 0xe2, 0x88, 0xe0, 0x66, 0x73, 0x93, 0xf8, 0x32,
+    0x67, 0x18, 0x60, 0xc0, 0x04, 0x08, 0x01, 0x80, 0x3c, 0x13, 0xe8, 0x71, 0x9a, 0xe8, 0xe7, 0xa8,
+    0x22, 0xe8, 0x4a, 0x89, 0x80, 0xc4, 0x18, 0xca, 0x98, 0x3e, 0xa4, 0x7f, 0xfa, 0xff, 0x8f, 0xfc,
+    0x9f, 0xe8, 0xcf, 0xf3, 0x82, 0xa8, 0xe0, 0xfc, 0x9b, 0x3d, 0xfe, 0x76, 0xd1, 0xf9, 0x3e, 0x0f,
+    0x5f, 0xf2, 0xe3, 0x93, 0x56, 0x2b, 0x3f, 0x30, 0xbf, 0xfb, 0x7f, 0x5f, 0x77, 0xf0, 0x7e, 0x0f,
+    0x3f, 0xeb, 0x65, 0x42, 0x8c, 0x3f, 0x82, 0xef, 0xdf, 0x6f, 0x55, 0x46, 0xea, 0xf8, 0xbe, 0x9f,
+    0xfe, 0x78, 0x7e, 0x4a, 0xb2, 0x9b, 0x9a, 0xcf, 0x37, 0x37, 0xf5, 0xff, 0x7c, 0xd5, 0x46, 0xac,
+    0xd9, 0x14, 0x08, 0x3d, 0x81, 0xff, 0xe1, 0xfc, 0x3e, 0xae, 0xc9, 0x3c, 0x9e, 0x8f, 0xb7, 0xfe,
+    0xf4, 0x7b, 0xae, 0xc5, 0xf7, 0x4d, 0xff, 0x8f, 0xfb, 0xf5, 0x7f, 0x27, 0xe0, 0xdb, 0xfb, 0x65,
+    0xea, 0x46, 0x96, 0x68, 0x80, 0xc1, 0x18, 0xce, 0x35, 0xe8, 0xfe, 0x0e, 0xbf, 0xff, 0x8f, 0x97,
+    0x93, 0x9b, 0xfb, 0x3c, 0xdf, 0x1f, 0xe3, 0x77, 0x61, 0xf4, 0xd9, 0xd1, 0xf2, 0x13, 0xfe, 0x1e,
+    0xdc, 0xcc, 0x4c, 0x28, 0xd1, 0x41, 0x05, 0x47, 0xc1, 0x3f, 0xff, 0x4f, 0x2f, 0xc9, 0x40, 0x0f,
+    0x27, 0x93, 0x0f, 0xae, 0xcd, 0x5a, 0xbe, 0x4a, 0x7f, 0xef, 0xf7, 0xf2, 0x78, 0x3e, 0x6e, 0x4f,
+    0xaf, 0xf1, 0x9a, 0xc5, 0x28, 0xc2, 0x10, 0x85, 0x4c, 0x3e, 0x0e, 0x6f, 0x5d, 0x3e, 0xed, 0x3e,
+    0x99, 0x3b, 0x3e, 0xe0, 0x7f, 0x8f, 0x8e, 0xe8, 0x10, 0xa1, 0x08, 0x87, 0xa5, 0x7b, 0x3e, 0xe9,
+    0x3f, 0x6f, 0xc2, 0x6e, 0xcf, 0xaa, 0xff, 0x69, 0xa0, 0x22, 0x04, 0x21, 0x00, 0x41, 0x58, 0x6e,
+    0x00, 0x43, 0x9d, 0x0e, 0xce, 0x2d, 0x0a, 0x83, 0xba, 0x2f, 0xf4, 0xfe, 0x5f, 0x9b, 0xf6, 0x4f,
+    0xf6, 0xc7, 0xc9, 0x16, 0x18, 0xbf, 0x06, 0x6f, 0x8f, 0xbd, 0x50, 0x20, 0x84, 0x08, 0x82, 0x00,
+    0x0c, 0x00, 0x18, 0xa1, 0x1e, 0x48, 0xf3, 0xd1, 0x72, 0x8c, 0x10, 0x94, 0x23, 0x08, 0xc0, 0x3c,
+    0x1f, 0x9b, 0x87, 0xff, 0xc3, 0xc3, 0xd1, 0xbb, 0x9a, 0xa5, 0x10, 0x21, 0x29, 0x46, 0x5a, 0x3d,
+    0x52, 0xff, 0xd7, 0xc3, 0xcd, 0x60, 0xee, 0xf5, 0x17, 0xc2, 0x18, 0x0c, 0x40, 0x08, 0x01, 0x08,
+    0x06, 0x10, 0x0c, 0x20, 0x09, 0x6b, 0x07, 0xa3, 0x17, 0xbf, 0xae, 0x6d, 0x12, 0x13, 0x77, 0xb3,
+    0xcb, 0xfe, 0x73, 0xe6, 0x74, 0x46, 0x30, 0x88, 0x00, 0x08, 0x20, 0x18, 0x00, 0x58, 0xe1, 0x82,
+    0xe7, 0x6e, 0xec, 0xf8, 0xff, 0xbc, 0x7d, 0x8e, 0xc3, 0x57, 0xd0, 0xaf, 0xcb, 0x9f, 0x9b, 0xd1,
+    0xa3, 0xe3, 0xfc, 0x38, 0x38, 0x98, 0xa0, 0x0c, 0x23, 0x28, 0xc1, 0xe0, 0xe0, 0xfe, 0x5f, 0xf8,
+    0xd9, 0xee, 0xdd, 0x53, 0x0c, 0x34, 0x7b, 0x26, 0xff, 0x87, 0xf8, 0x74, 0x76, 0x62, 0x90, 0xc2,
+    0x09, 0x46, 0x32, 0x84, 0xa3, 0x08, 0x42, 0x00, 0x88, 0x00, 0x01, 0x02, 0x41, 0x03, 0xb3, 0xdd,
+    0xfb, 0x7f, 0xe5, 0xbb, 0xa2, 0x29, 0x0c, 0x57, 0x68, 0x6d, 0xe2, 0x10, 0x42, 0x10, 0x0c, 0xeb,
+    0x63, 0x2b, 0xa3, 0x93, 0x0f, 0x29, 0x55, 0x50, 0x6d, 0x75, 0xca, 0x8b, 0xb9, 0xbf, 0xd7, 0xdb,
+    0xcd, 0xf2, 0x6c, 0xf6, 0xf4, 0xf8, 0xa2, 0xe1, 0x4c, 0x08, 0x21, 0x1f, 0x1f, 0x07, 0x27, 0x4f,
+    0x2f, 0x17, 0xab, 0x0f, 0x4a, 0xe7, 0x83, 0xea, 0xc5, 0xe9, 0xe7, 0x90, 0x20, 0xc8, 0x5c, 0xb0,
+    0x68, 0xee, 0x1f, 0xdf, 0x5c, 0x51, 0x0e, 0x9b, 0x03, 0x86, 0x6d, 0xdd, 0xc3, 0xfc, 0x3b, 0x70,
+    0x29, 0x46, 0x11, 0x04, 0x01, 0x08, 0x20, 0x00, 0x02, 0x00, 0x80, 0x21, 0x12, 0xe3, 0x0c, 0xd2,
+    0x20, 0x28, 0xf0, 0x13, 0xfb, 0x7b, 0x7b, 0x26, 0x9c, 0x9b, 0x22, 0xb6, 0x3c, 0x17, 0x4b, 0x0a,
+    0x02, 0x21, 0x04, 0x09, 0x4d, 0x92, 0x63, 0xae, 0x48, 0xb0, 0xcd, 0xd9, 0xb7, 0xd2, 0xcc, 0x92,
+    0x1a, 0x4e, 0xca, 0xff, 0xc7, 0x2f, 0xe6, 0xc9, 0xe5, 0x8f, 0xd8, 0x3e, 0x70, 0x1a, 0xca, 0xa7,
+    0x69, 0x84, 0x06, 0xbd, 0x14, 0x30, 0x80, 0x18, 0xc6, 0x50, 0x84, 0x21, 0x08, 0x04, 0x10, 0xee,
+    0xec, 0xf8, 0xff, 0x8f, 0x83, 0x56, 0x74, 0x6c, 0xf2, 0x62, 0xf4, 0xf9, 0xd3, 0xa3, 0xcc, 0x3e,
+    0xf8, 0x70, 0x55, 0x0c, 0x68, 0x02, 0x45, 0x43, 0xef, 0xa2, 0x80, 0x41, 0xd4, 0x0f, 0xf1, 0xf7,
+    0xf1, 0x7a, 0x3a, 0x35, 0xf9, 0xd3, 0x05, 0x95, 0x49, 0xc9, 0x0f, 0xed, 0xbf, 0x8a, 0xa4, 0x20,
+    0x60, 0xc1, 0xb3, 0xb7, 0xf9, 0xd9, 0xf9, 0xaa, 0xe9, 0xae, 0x00, 0x1f, 0x47, 0x24, 0x3b, 0x4a,
+    0x81, 0x10, 0x43, 0x5b, 0x2a, 0x4e, 0x11, 0x51, 0x18, 0xf9, 0x85, 0xc6, 0xd5, 0x10, 0x82, 0x00,
+    0x84, 0x11, 0x08, 0xe9, 0x98, 0x96, 0xe6, 0xd1, 0xc3, 0x78, 0x16, 0x8b, 0x1c, 0x60, 0xbb, 0xa1,
+    0xbf, 0xc3, 0xcb, 0x45, 0x98, 0x22, 0x40, 0x82, 0x19, 0xb9, 0xad, 0xfe, 0x1b, 0xf0, 0x55, 0x42,
+    0xd7, 0x73, 0x8d, 0x83, 0x66, 0xdf, 0xa6, 0x1b, 0x18, 0x62, 0xb6, 0x0e, 0x8c, 0x9c, 0xfe, 0x50,
+    0x5d, 0xa3, 0x8a, 0xbe, 0xf5, 0xb0, 0x8d, 0xa3, 0x92, 0xbc, 0x63, 0x59, 0xa6, 0x90, 0xc2, 0x18,
+    0xb8, 0xa8, 0xfd, 0xff, 0x4e, 0x4d, 0x54, 0x38, 0x82, 0x08, 0x42, 0x11, 0x80, 0x61, 0x00, 0x00,
+    0x10, 0x4d, 0xd9, 0x0f, 0xf8, 0xf8, 0x7c, 0x9e, 0xad, 0x59, 0x77, 0xa9, 0x02, 0x90, 0x6b, 0xc9,
+    0x26, 0xba, 0x50, 0x41, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x02, 0x19, 0xcd, 0x61, 0x6b, 0x79,
+    0x28, 0x55, 0x1c, 0x51, 0xfc, 0xb5, 0xa8, 0x71, 0x74, 0x6a, 0xdb, 0xca, 0x13, 0x51, 0x44, 0xe9,
+    0x40, 0x08, 0x12, 0x04, 0x40, 0x00, 0x86, 0xf0, 0x70, 0x51, 0xbf, 0x38, 0x60, 0xd9, 0x8b, 0x2e,
+    0xb1, 0xad, 0xd5, 0x18, 0x40, 0x18, 0x06, 0x10, 0xe6, 0xcd, 0xdb, 0xf7, 0x8b, 0x82, 0x05, 0xb2,
+    0x87, 0x10, 0x22, 0xcd, 0x77, 0x97, 0xd6, 0x69, 0x94, 0xa2, 0x01, 0x2a, 0x74, 0xeb, 0x99, 0x46,
+    0x08, 0xc0, 0x11, 0x84, 0x22, 0xe4, 0xab, 0xf1, 0xf8, 0x6c, 0x53, 0x37, 0x73, 0x0f, 0xbd, 0x6e,
+    0x30, 0x84, 0x03, 0xbe, 0x2d, 0x12, 0xf0, 0xc9, 0xd0, 0x28, 0x7f, 0xbf, 0x1c, 0x19, 0x11, 0x00,
+    0x88, 0x08, 0x08, 0x04, 0x80, 0x42, 0x35, 0x4c, 0xa0, 0x80, 0x66, 0x26, 0x26, 0x00, 0x20, 0x04,
+    0x03, 0xc3, 0xf8, 0x79, 0xff, 0xee, 0xfd, 0xac, 0xbc, 0x3f, 0x2c, 0xfc, 0xd1, 0x88, 0x08, 0xe7,
+    0x5a, 0x60, 0xc0, 0x26, 0x26, 0x60, 0x60, 0x02, 0x49, 0xf0, 0xed, 0xff, 0x5f, 0xfb, 0xfb, 0x7a,
+    0x4a, 0x95, 0x4d, 0x0c, 0x01, 0x86, 0xe2, 0x82, 0x42, 0x42, 0x6f, 0x28, 0x6a, 0x79, 0x48, 0x3b,
+    0x79, 0x7e, 0x3f, 0xf8, 0x9f, 0x87, 0x0a, 0x30, 0x11, 0x81, 0x80, 0x9e, 0x9f, 0xc3, 0xe3, 0xff,
+    0xea, 0x5f, 0x44, 0xb2, 0x50, 0xae, 0x13, 0x97, 0xe0, 0x5f, 0x38, 0xb1, 0x10, 0x10, 0x80, 0x90,
+    0x90, 0x80, 0x00, 0x00, 0x10, 0x90, 0x90, 0x1c, 0xcf, 0x0a, 0x30, 0x08, 0x89, 0x88, 0x9f, 0x2f,
+    0x97, 0xcf, 0xfe, 0xaf, 0xda, 0xd2, 0x82, 0x12, 0x97, 0x00, 0xd5, 0xf2, 0x3c, 0xdb, 0x2f, 0x64,
+    0xff, 0x5e, 0x7f, 0x87, 0x97, 0x5e, 0x26, 0x7e, 0xc9, 0xf3, 0x2d, 0xa4, 0x80, 0x00, 0x7a, 0x7c,
+    0x3c, 0x7f, 0xf3, 0x5f, 0x09, 0x02, 0xe5, 0xed, 0xd3, 0xbf, 0xcd, 0x89, 0xe5, 0xe9, 0x2f, 0x5a,
+    0xa2, 0xbc, 0x2d, 0x02, 0x03, 0x03, 0x10, 0x31, 0x87, 0xc2, 0x9f, 0xf1, 0xf9, 0xe5, 0xb4, 0x0d,
+    0x32, 0xb2, 0x11, 0x7a, 0x43, 0xfd, 0xfd, 0xf0, 0x91, 0x16, 0x90, 0xea, 0xf6, 0xc1, 0x08, 0x40,
+    0xc0, 0xc0, 0x46, 0x9f, 0x2c, 0xff, 0xfa, 0xd7, 0xf4, 0xfa, 0x74, 0xf7, 0xf5, 0xa5, 0x11, 0x08,
+    0x80, 0x55, 0x34, 0x8d, 0x56, 0x38, 0x79, 0x47, 0xe3, 0x3d, 0x36, 0xf0, 0x5f, 0x79, 0xb2, 0xa3,
+    0x21, 0xc4, 0x79, 0x78, 0x3f, 0x73, 0x88, 0x5a, 0x6f, 0xe5, 0xd3, 0xc7, 0xdf, 0x4f, 0xc0, 0xfe,
+    0x3a, 0xe9, 0x4a, 0x9e, 0x50, 0x41, 0xb7, 0xb7, 0x1f, 0xf7, 0x8f, 0x06, 0x61, 0x4d, 0x86, 0xa0,
+    0x44, 0x2b, 0x08, 0x5e, 0xda, 0x77, 0xd7, 0x69, 0x26, 0x1d, 0xb8, 0xff, 0x19, 0xe5, 0x05, 0x19,
+    0x52, 0x40, 0x46, 0x07, 0x6f, 0x0e, 0xbf, 0xea, 0xfe, 0x1a, 0x41, 0x83, 0xa7, 0x0f, 0x9f, 0xef,
+    0x1e, 0x1f, 0x29, 0x71, 0xcc, 0x69, 0x66, 0x41, 0x30, 0x31, 0x11, 0x10, 0x0f, 0x83, 0x7f, 0xd7,
+    0xdf, 0xe1, 0xed, 0xed, 0x5f, 0xc5, 0x7a, 0x60, 0xae, 0x8a, 0xfa, 0x74, 0xaf, 0x55, 0x31, 0xa5,
+    0x01, 0xb9, 0x43, 0xf5, 0xf3, 0xb5, 0x11, 0x90, 0x10, 0x01, 0x0c, 0x51, 0xa3, 0x1e, 0x9d, 0x35,
+    0xee, 0xa8, 0x67, 0x49, 0x43, 0xa4, 0xbf, 0x5f, 0x8d, 0x36, 0x94, 0x08, 0x00, 0x04, 0x40, 0x48,
+    0xc8, 0x74, 0xf4, 0xf1, 0xff, 0xc4, 0x3d, 0x34, 0xf6, 0x6f, 0x77, 0x82, 0x89, 0x95, 0x25, 0x2e,
+    0x43, 0xfa, 0xf7, 0x95, 0xad, 0x22, 0xcb, 0x87, 0x1f, 0xd6, 0xb6, 0xb6, 0x9e, 0x09, 0xeb, 0xdc,
+    0x29, 0x69, 0x20, 0x02, 0xd3, 0xb4, 0xff, 0xbd, 0x76, 0x12, 0xc2, 0x1c, 0x34, 0xe7, 0xe2, 0x63,
+    0xd2, 0x5d, 0x4f, 0x0e, 0x9a, 0x77, 0xf3, 0x49, 0x08, 0x52, 0x93, 0xac, 0x30, 0x39, 0x80, 0x38,
+    0xe9, 0xe0, 0xbe, 0xb3, 0x45, 0x86, 0x08, 0x41, 0x6d, 0xb7, 0xfc, 0xd7, 0x44, 0x44, 0x22, 0x27,
+    0x3a, 0x72, 0x5e, 0x73, 0x29, 0x61, 0xc8, 0xbc, 0xf7, 0x29, 0x60, 0x53, 0x04, 0x35, 0x39, 0x48,
+    0x88, 0x40, 0xc0, 0xc0, 0x04, 0x48, 0x48, 0x48, 0x00, 0x84, 0x82, 0xde, 0x5a, 0xff, 0x8c, 0x7b,
+    0x60, 0xe1, 0x87, 0x0b, 0x78, 0xf9, 0xdb, 0x04, 0x20, 0x10, 0x34, 0xd2, 0x5f, 0x3e, 0xb4, 0x29,
+    0x58, 0x45, 0x42, 0xcc, 0x05, 0xa4, 0x3e, 0x7e, 0x74, 0xd9, 0x2d, 0xc9, 0xfe, 0x77, 0xb3, 0x02,
+    0x50, 0x48, 0xc9, 0x62, 0xd2, 0x40, 0x01, 0x10, 0x31, 0xc3, 0xa7, 0x5f, 0xee, 0x1c, 0xb0, 0x92,
+    0x20, 0x96, 0x1c, 0x3c, 0x7f, 0x18, 0x59, 0x0a, 0x16, 0x5b, 0x9b, 0x49, 0x80, 0x04, 0xe5, 0xb3,
+    0xfe, 0x39, 0xe9, 0x04, 0x60, 0x43, 0x31, 0x94, 0x10, 0x40, 0xb6, 0x2f, 0x7e, 0x6d, 0x04, 0xc1,
+    0xa2, 0x2a, 0x74, 0xe5, 0x0e, 0xf8, 0xe8, 0x0e, 0x40, 0x82, 0x40, 0x42, 0x4e, 0x90, 0x78, 0xca,
+    0x00, 0x42, 0x29, 0xb3, 0x7e, 0x3c, 0xf2, 0x92, 0x30, 0x20, 0x10, 0x10, 0x90, 0x9a, 0xa6, 0x5a,
+    0x5f, 0x89, 0xc0, 0x08, 0x08, 0x04, 0x80, 0x48, 0x04, 0x46, 0x48, 0xaa, 0x40, 0x40, 0x04, 0xa1,
+    0x44, 0x98, 0x9b, 0x35, 0x42, 0x44, 0x82, 0x07, 0x4d, 0xb1, 0xfb, 0x9e, 0x0c, 0x23, 0x09, 0x30,
+    0x14, 0x36, 0xdf, 0xea, 0x5b, 0x33, 0x6d, 0x0e, 0xfd, 0x65, 0x02, 0x47, 0x08, 0x32, 0x00, 0x81,
+    0x80, 0x08, 0x80, 0x4b, 0x85, 0x7e, 0x33, 0xc2, 0x4c, 0xc0, 0x44, 0x02, 0xa2, 0xcc, 0x40, 0x22,
+    0x60, 0x22, 0x20, 0x02, 0x42, 0x40, 0x5c, 0xa1, 0xf7, 0xf1, 0xd3, 0x4d, 0x38, 0x4f, 0xb9, 0xda,
+    0x42, 0xe4, 0x50, 0x88, 0x00, 0xa9, 0x6e, 0xb0, 0x80, 0x20, 0xf8, 0xeb, 0xe7, 0xfe, 0xcf, 0xd4,
+    0x3a, 0xfc, 0x63, 0xcf, 0x64, 0x2d, 0x46, 0xbc, 0x67, 0xfb, 0xe7, 0x8e, 0x8c, 0xb8, 0xe0, 0x6d,
+    0x9d, 0x52, 0x09, 0xa6, 0x3a, 0xf8, 0xfe, 0xff, 0xdd, 0x71, 0x04, 0x7d, 0x71, 0xe7, 0x22, 0x63,
+    0xd7, 0x8c, 0xff, 0x33, 0xd5, 0x44, 0x75, 0xaf, 0xef, 0xef, 0x18, 0x81, 0x00, 0x07, 0x54, 0x77,
+    0x35, 0x18, 0x2a, 0xbc, 0x5f, 0xfb, 0xce, 0xa2, 0x34, 0x0a, 0x00, 0xc1, 0x6f, 0xa8, 0xf6, 0xf5,
+    0xe3, 0xaf, 0x7f, 0x22, 0x91, 0xa8, 0xc8, 0xfc, 0x47, 0xde, 0xf5, 0x81, 0xaf, 0x8d, 0xff, 0xe6,
+    0x7c, 0x7d, 0x71, 0xef, 0x9a, 0x49, 0x00, 0x4d, 0x53, 0xb4, 0x8a, 0x00, 0x26, 0xd7, 0x58, 0xe7,
+    0x30, 0x0a, 0xc0, 0x90, 0xcb, 0xaa, 0x82, 0x98, 0x04, 0x02, 0x11, 0x11, 0xeb, 0x1f, 0xf3, 0xef,
+    0x8d, 0x21, 0xc5, 0x66, 0x75, 0x17, 0xba, 0xa8, 0xc7, 0x8f, 0x7f, 0xe4, 0x75, 0x85, 0x05, 0x75,
+    0x8f, 0xdf, 0xe7, 0xac, 0x44, 0x5c, 0x50, 0x52, 0x61, 0xba, 0xeb, 0x1d, 0xfc, 0xae, 0xbc, 0x1f,
+    0x2c, 0xcd, 0x7a, 0xe3, 0x7c, 0x98, 0x04, 0x78, 0xae, 0x64, 0x8e, 0x06, 0x59, 0xe3, 0xc0, 0xf9,
+    0x90, 0x6a, 0xa3, 0x1e, 0x3b, 0xfd, 0xc4, 0x43, 0x35, 0x80, 0x80, 0x6a, 0x3d, 0x6f, 0xfc, 0xcf,
+    0x51, 0x02, 0x02, 0x28, 0x00, 0x01, 0x2b, 0x0e, 0xe7, 0x8c, 0x5f, 0x35, 0x55, 0xd5, 0xf9, 0xba,
+    0xa0, 0xc1, 0x18, 0x84, 0x01, 0x00, 0x83, 0xc7, 0x5f, 0x7f, 0xef, 0x1d, 0x62, 0x90, 0x00, 0x80,
+    0x40, 0xaf, 0x1c, 0xff, 0xcc, 0x78, 0xc4, 0x75, 0x1f, 0x3e, 0xf8, 0xd6, 0xb8, 0x9f, 0xb7, 0x50,
+    0x09, 0x55, 0x05, 0x13, 0x5c, 0x67, 0xf9, 0x9f, 0x15, 0x08, 0x71, 0xaf, 0x3f, 0x2a, 0xa2, 0x08,
+    0x84, 0x04, 0xad, 0x5e, 0x56, 0x3c, 0x4f, 0xdb, 0xf8, 0xc7, 0x9c, 0xf8, 0xea, 0xfd, 0x8c, 0x60,
+    0x41, 0x00, 0xa6, 0x88, 0xae, 0xa7, 0xfb, 0xbe, 0xb0, 0xd4, 0x60, 0xc1, 0x20, 0x18, 0xe0, 0x7e,
+    0xf3, 0x55, 0x09, 0x03, 0x4a, 0xdd, 0x71, 0x5d, 0xda, 0x08, 0x31, 0x15, 0xe1, 0xfb, 0xce, 0x20,
+    0xba, 0xd7, 0x17, 0xf2, 0x57, 0x51, 0xcd, 0x63, 0x73, 0x85, 0x00, 0xa2, 0x44, 0x6a, 0x3f, 0x3e,
+    0xfa, 0xf0, 0xee, 0x38, 0xd4, 0xf9, 0x3e, 0x95, 0xb1, 0x6b, 0x8e, 0x27, 0x73, 0x40, 0x20, 0x00,
+    0x09, 0xb4, 0xa8, 0xc7, 0x03, 0xe7, 0x78, 0x48, 0x11, 0x10, 0x97, 0x03, 0xe7, 0x35, 0x01, 0x31,
+    0x4a, 0x08, 0x04, 0x14, 0x6b, 0x8f, 0x3f, 0x9c, 0x71, 0x0a, 0x35, 0x1e, 0x7b, 0xc4, 0x24, 0x01,
+    0x78, 0xe0, 0x67, 0x29, 0x04, 0x50, 0x05, 0x00, 0x1a, 0x86, 0xb1, 0x2c, 0x25, 0x29, 0x4a, 0xe2,
+    0x39, 0x7c, 0x1b, 0x20, 0x70, 0xac, 0x84, 0xd6, 0x8e, 0x41, 0xa5, 0x23, 0x8a, 0xce, 0x44, 0x22,
+    0x80, 0x29, 0x48, 0xac, 0x2d, 0xf3, 0xc7, 0x0f, 0x61, 0x20, 0x80, 0x44, 0x06, 0x28, 0x20, 0x06,
+    0x87, 0xdb, 0xe9, 0x82, 0x62, 0x12, 0x1a, 0x5f, 0x79, 0xe2, 0x20, 0x04, 0x41, 0x8c, 0x47, 0xbe,
+    0xe3, 0x8c, 0x1c, 0xc5, 0x25, 0x83, 0xee, 0x75, 0x15, 0x8d, 0xe4, 0x2d, 0x1b, 0x14, 0x90, 0x38,
+    0xc7, 0x7c, 0x88, 0xaa, 0x64, 0x02, 0xa0, 0x21, 0x1a, 0xcf, 0x97, 0x88, 0x48, 0x5c, 0x40, 0x28,
+    0x02, 0x50, 0x00, 0x12, 0x21, 0x22, 0x89, 0x44, 0x00, 0x50, 0x28, 0xa0, 0x50, 0x05, 0x00, 0x00,
+    0xac, 0x4f, 0xb3, 0x84, 0x90, 0x10, 0xca, 0x85, 0x83, 0xe4, 0x81, 0x8c, 0x4d, 0x81, 0x09, 0x22,
+    0x0a, 0xc4, 0x73, 0xdc, 0x68, 0x8d, 0x2b, 0x70, 0x89, 0x48, 0xb5, 0x00, 0x00, 0x40, 0x18, 0x8e,
+    0x76, 0xa9, 0x22, 0xaa, 0x24, 0xa0, 0x08, 0x00, 0x02, 0x54, 0x18, 0x20, 0xa2, 0x0d, 0x62, 0xf9,
+    0x29, 0x54, 0x04, 0x52, 0x19, 0x9f, 0xcf, 0x9f, 0x7e, 0xdd, 0xdc, 0xf8, 0xed, 0xcf, 0x3c, 0xab,
+    0x40, 0x08, 0x93, 0x22, 0xd6, 0x49, 0x24, 0x00, 0x67, 0xce, 0x7d, 0xfd, 0xee, 0x7c, 0x9b, 0x52,
+    0x01, 0x8b, 0x27, 0x9f, 0xcc, 0xee, 0xeb, 0x05, 0x05, 0xc5, 0x3e, 0x66, 0xd2, 0x79, 0xf2, 0xfa,
+    0x64, 0xd9, 0x8d, 0x45, 0x5c, 0xf9, 0xca, 0xd6, 0xf3, 0x82, 0xb5, 0x26, 0x49, 0x00, 0x00, 0x44,
+    0x49, 0xf3, 0x3e, 0xec, 0x76, 0x9c, 0x8b, 0x93, 0x33, 0xe7, 0xc7, 0xdb, 0x6d, 0xa4, 0x24, 0x90,
+    0x00, 0x4c, 0xf9, 0x9e, 0xfb, 0x68, 0x99, 0x81, 0x00, 0x23, 0x38, 0xea, 0x92, 0x10, 0x03, 0xcf,
+    0x9d, 0xfd, 0xed, 0x24, 0x90, 0xcf, 0x9c, 0xef, 0xb5, 0x24, 0x33, 0xf3, 0x9d, 0xf7, 0x4c, 0x96,
+    0xb3, 0xc9, 0x6c, 0xe7, 0x8e, 0xb6, 0xb3, 0xcc, 0xb5, 0x00, 0x20, 0x20, 0x10, 0x05, 0x33, 0xc9,
+    0x5a, 0x0c, 0xcb, 0x42, 0x10, 0x80, 0x4f, 0x39, 0xbe, 0xed, 0xa7, 0x32, 0xd3, 0x3c, 0xe5, 0xa9,
+    0x21, 0x08, 0x02, 0x02, 0x73, 0xc7, 0xef, 0x69, 0x26, 0x79, 0xe3, 0xaa, 0x90, 0x02, 0x0c, 0x82,
+    0x40, 0xa9, 0xce, 0x2a, 0xa9, 0xc8, 0x20, 0x02, 0xb3, 0x3c, 0x9a, 0xc5, 0x46, 0x00, 0x64, 0xb4,
+    0x24, 0x84, 0x26, 0x78, 0x7b, 0xa8, 0x83, 0x00, 0x88, 0x92, 0x49, 0xe7, 0x2e, 0xd5, 0x29, 0x98,
+    0x88, 0x0c, 0x4c, 0x28, 0x04, 0x9c, 0xe5, 0xda, 0xd6, 0x79, 0x96, 0xa6, 0x03, 0x01, 0x00, 0x00,
+    0x00, 0x05, 0xcc, 0x44, 0x15, 0x84, 0x24, 0xe6, 0x5e, 0xb5, 0x99, 0x14, 0x00, 0x00, 0x06, 0x12,
+    0x73, 0x2f, 0x6a, 0x10, 0x24, 0xe4, 0xdd, 0x40, 0x99, 0xe1, 0x6a, 0x82, 0x13, 0x38, 0x6a, 0x84,
+    0x9c, 0xcb, 0x55, 0x08, 0x00, 0x06, 0x02, 0x0c, 0x00, 0x49, 0x14, 0x24, 0xe1, 0x6e, 0x45, 0x40,
+    0x00, 0x00, 0x80, 0x98, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x19, 0x8d, 0x66, 0x08, 0x88, 0x0c,
+    0xe0, 0xa8, 0x13, 0x98, 0xea, 0xa4, 0x9c, 0x95, 0x40, 0x60, 0x08, 0x10, 0x80, 0x00, 0x4c, 0x9b,
+    0x55, 0x48, 0x49, 0x27, 0x06, 0xa9, 0x0a, 0x10, 0x21, 0xc9, 0x6d, 0x12, 0x03, 0x09, 0x91, 0xa8,
+    0x10, 0x00, 0x99, 0x2d, 0x51, 0x12, 0x42, 0x4c, 0xc6, 0xa8, 0x00, 0x00, 0x02, 0x20, 0x42, 0x04,
+    0x09, 0x8d, 0xa9, 0x80, 0x80, 0x10, 0x04, 0x80, 0x20, 0x64, 0x14, 0x04, 0x80, 0x84, 0x00, 0x08,
+    0x49, 0x68, 0x13, 0x05, 0x04, 0x24, 0xc1, 0x40, 0x40, 0x02, 0x48, 0x28, 0x08, 0x10, 0x00, 0x20,
+    0x00, 0x01, 0x21, 0x50, 0x00, 0x10, 0x06, 0xc4, 0x00, 0x00, 0x00, 0x0d, 0x94, 0x80, 0x66, 0xd4,
+    0x40, 0xc2, 0x60, 0x81, 0x90, 0x6d, 0x40, 0x00, 0x00, 0x01, 0x1b, 0x22, 0x03, 0x02, 0x18, 0x20,
+    0x01, 0x90, 0x06, 0xca, 0x01, 0x88, 0x00, 0x60, 0x80, 0x00, 0x1a, 0x60, 0x00, 0x00, 0x0c, 0x80,
+    0x00, 0x19, 0x01, 0x88, 0x03, 0x04, 0xc2, 0x01, 0x82, 0x06, 0x00, 0x46, 0x58, 0x08, 0x1a, 0x62,
+    0xc4, 0x31, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0x60, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f,
+    0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3e, 0x7c,
 };
 
 #endif // SNARE_SAMPLE_H
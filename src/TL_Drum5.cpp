@@ -1,9 +1,16 @@
-#include <iostream>
-#include <tuple>
 #include "plugin.hpp"
 #include "rack.hpp"
 #include "dsp/filter.hpp"
+#include <atomic>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <osdialog.h>
 #include "../helpers/dsp_utils.hpp"
+#include "../helpers/sample_bank.hpp"
+#include "../helpers/step_engine.hpp"
+#include "../helpers/worker.hpp"
+#include "../helpers/audio_file.hpp"
 #include "../res/samples/kick.h"
 #include "../res/samples/snare.h"
 #include "../res/samples/clap.h"
@@ -12,6 +19,301 @@
 using namespace rack;
 
 
+// Factory kit as float buffers, shared by every TL_Drum5 instance (lane order: KK, SN, CL, CH, OH).
+// Stored packed in the plugin binary, decoded by the first instance and freed with the last one.
+struct Drum5Kit {
+	static constexpr float NATIVE_RATE = 48000.f;  // Rate the samples were recorded at.
+
+	// The kit resampled to one engine rate. Filled once, on the worker.
+	struct RatedKit {
+		int rate = 0;
+		std::shared_ptr<const SampleBank::Buffer> voices[5];
+		std::once_flag filled;
+	};
+
+	std::shared_ptr<const SampleBank::Buffer> voices[5];
+
+	// Resampled kits keyed by rate; entries stay alive as long as the kit, so voices may keep reading them.
+	std::mutex cacheMutex;
+	std::map<int, std::shared_ptr<RatedKit>> byRate;
+	Worker worker;  // Declared last: joined before the buffers above are freed.
+
+	// Returns the kit entry for a sample rate, queueing the resample if it isn't cached. Not for the audio thread.
+	RatedKit& atRate(float sampleRate) {
+		int rate = (int)std::round(sampleRate);
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		std::shared_ptr<RatedKit>& rated = byRate[rate];
+		if (!rated) {
+			rated = std::make_shared<RatedKit>();
+			rated->rate = rate;
+			RatedKit* r = rated.get();
+			worker.push([this, r] { fill(*r); });
+		}
+		return *rated;
+	}
+
+	// Worker thread: the kit at a rate, resampling now if the queued job hasn't run yet.
+	const RatedKit& filledAtRate(float sampleRate) {
+		RatedKit& rated = atRate(sampleRate);
+		fill(rated);
+		return rated;
+	}
+
+	Drum5Kit() {
+		voices[0] = SampleBank::fromPacked(kick_packed, kick_packed_len, kick_sample_len);
+		voices[1] = SampleBank::fromPacked(snare_packed, snare_packed_len, snare_sample_len);
+		voices[2] = SampleBank::fromPacked(clap_packed, clap_packed_len, clap_sample_len);
+		voices[3] = SampleBank::fromPacked(closedhat_packed, closedhat_packed_len, closedhat_sample_len);
+		voices[4] = SampleBank::fromPacked(openhat_packed, openhat_packed_len, openhat_sample_len);
+	}
+
+private:
+	void fill(RatedKit& r) {
+		std::call_once(r.filled, [&] {
+			for (int v = 0; v < 5; v++) {
+				r.voices[v] = (r.rate == (int)NATIVE_RATE)
+					? voices[v]
+					: SampleBank::resample(*voices[v], NATIVE_RATE, r.rate);
+			}
+		});
+	}
+};
+
+
+// What the engine plays: five buffers at one rate, swapped in as a whole (lane order: KK, SN, CL, CH, OH).
+struct Drum5PlayKit {
+	uint32_t generation = 0;
+	float rate = 0.f;
+	std::shared_ptr<const SampleBank::Buffer> voices[5];
+};
+
+
+// Decodes user samples and builds play kits on the worker, hands them to the engine with an atomic
+// pointer swap, and frees replaced kits only once no voice can still be reading them.
+struct Drum5KitLoader : std::enable_shared_from_this<Drum5KitLoader> {
+	Drum5Kit* factory;  // Outlives every job: its worker runs them and is joined first.
+
+	std::atomic<const Drum5PlayKit*> current{nullptr};  // Read by the engine.
+	std::atomic<uint32_t> oldestInUse{0};  // Written by the engine: oldest generation a voice may still read.
+
+	explicit Drum5KitLoader(Drum5Kit* factory) : factory(factory) {}
+
+	void setRate(float sampleRate) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			rate = (int)std::round(sampleRate);
+		}
+		factory->atRate(sampleRate);  // Queue the factory resample ahead of the rebuild.
+		rebuild();
+	}
+
+	// User sample for one voice (empty path = factory sample).
+	void setSample(int voice, const std::string& path) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			paths[voice] = path;
+			sources[voice].reset();
+		}
+		rebuild();
+	}
+
+	std::string getSample(int voice) {
+		std::lock_guard<std::mutex> lock(mutex);
+		return paths[voice];
+	}
+
+	// UI thread: the kit the engine plays now, kept alive by the caller (the worker may retire and free it
+	// at any time otherwise).
+	std::shared_ptr<const Drum5PlayKit> getPublished() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return published;
+	}
+
+	// Frees retired kits no voice reads anymore (UI thread, also done after every build).
+	void collect() {
+		std::lock_guard<std::mutex> lock(mutex);
+		reclaim();
+	}
+
+private:
+	std::mutex mutex;  // Guards the members below (UI and worker threads).
+	std::string paths[5];
+	std::shared_ptr<const SampleBank::Buffer> sources[5];  // Decoded user samples, at their file rate.
+	float sourceRates[5] = {};
+	int rate = 0;
+	uint32_t nextGeneration = 1;
+	std::shared_ptr<const Drum5PlayKit> published;
+	std::vector<std::shared_ptr<const Drum5PlayKit>> retired;
+
+	// Queue a build on the worker; the job only holds a weak reference, so a removed module isn't kept waiting.
+	void rebuild() {
+		std::weak_ptr<Drum5KitLoader> weak = shared_from_this();
+		factory->worker.push([weak] {
+			if (auto self = weak.lock())
+				self->build();
+		});
+	}
+
+	// Worker thread: decode pending user samples, bring every voice to the engine rate, publish, reclaim.
+	void build() {
+		std::string pending[5];
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (rate == 0)
+				return;  // No engine rate yet; setRate() rebuilds.
+			for (int v = 0; v < 5; v++)
+				if (!paths[v].empty() && !sources[v])
+					pending[v] = paths[v];
+		}
+
+		// Decode outside the lock, files can be slow.
+		std::shared_ptr<const SampleBank::Buffer> decoded[5];
+		float decodedRates[5] = {};
+		for (int v = 0; v < 5; v++) {
+			std::vector<float> pcm;
+			if (pending[v].empty() || !AudioFile::loadMono(pending[v], pcm, decodedRates[v]))
+				continue;
+			auto buffer = std::make_shared<SampleBank::Buffer>((int)pcm.size());
+			std::copy(pcm.begin(), pcm.end(), buffer->data);
+			decoded[v] = buffer;
+		}
+
+		std::shared_ptr<const SampleBank::Buffer> src[5];
+		float srcRates[5];
+		int kitRate;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			for (int v = 0; v < 5; v++) {
+				if (decoded[v] && paths[v] == pending[v]) {
+					sources[v] = decoded[v];
+					sourceRates[v] = decodedRates[v];
+				}
+				src[v] = sources[v];
+				srcRates[v] = sourceRates[v];
+			}
+			kitRate = rate;
+		}
+
+		// Voices without a (readable) user sample play the factory one.
+		const Drum5Kit::RatedKit& factoryKit = factory->filledAtRate(kitRate);
+		auto kit = std::make_shared<Drum5PlayKit>();
+		kit->rate = kitRate;
+		for (int v = 0; v < 5; v++) {
+			if (!src[v])
+				kit->voices[v] = factoryKit.voices[v];
+			else if ((int)std::round(srcRates[v]) == kitRate)
+				kit->voices[v] = src[v];
+			else
+				kit->voices[v] = SampleBank::resample(*src[v], srcRates[v], kitRate);
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		kit->generation = nextGeneration++;
+		if (published)
+			retired.push_back(published);
+		published = kit;
+		current.store(kit.get(), std::memory_order_release);
+		reclaim();
+	}
+
+	// Mutex held. The engine stops picking up a kit once it has seen a newer one, so anything older
+	// than the oldest generation still referenced by a voice is unreachable.
+	void reclaim() {
+		uint32_t oldest = oldestInUse.load(std::memory_order_acquire);
+		retired.erase(std::remove_if(retired.begin(), retired.end(),
+			[oldest](const std::shared_ptr<const Drum5PlayKit>& k) { return k->generation < oldest; }), retired.end());
+	}
+};
+
+
+// What a processed hit depends on (volume and pan are applied live).
+struct Drum5HitKey {
+	uint32_t kitGeneration = 0;
+	float sampleRate = 0.f;
+	float decay = 0.f;
+	float filter = 0.f;
+	bool push = false;
+	int pushMode = 0;
+	float tune = 0.f;  // Semitones.
+
+	Drum5HitKey() {}
+	Drum5HitKey(uint32_t kitGeneration, float sampleRate, float decay, float filter, bool push, int pushMode, float tune)
+		: kitGeneration(kitGeneration), sampleRate(sampleRate), decay(decay), filter(filter), push(push), pushMode(pushMode), tune(tune) {}
+
+	bool operator==(const Drum5HitKey& o) const {
+		return kitGeneration == o.kitGeneration && sampleRate == o.sampleRate && decay == o.decay && filter == o.filter && push == o.push
+			&& pushMode == o.pushMode && tune == o.tune;
+	}
+	bool operator!=(const Drum5HitKey& o) const {
+		return !(*this == o);
+	}
+};
+
+
+// Fully processed hits (envelope, push, macro filter), one per voice, rendered on the worker once the knobs
+// settle. Published and reclaimed like play kits: the engine reports the oldest serial it may still stream.
+struct Drum5HitCache : std::enable_shared_from_this<Drum5HitCache> {
+	struct Hit {
+		uint32_t serial = 0;
+		Drum5HitKey key;
+		std::shared_ptr<const SampleBank::Buffer> data;
+	};
+
+	Worker* worker;  // Outlives every job (see Drum5KitLoader::factory).
+
+	std::atomic<const Hit*> ready[5] = {};  // Read by the engine: latest hit per voice.
+	std::atomic<uint32_t> oldestInUse{0};  // Written by the engine: oldest serial a voice may still stream.
+
+	explicit Drum5HitCache(Worker* worker) : worker(worker) {}
+
+	// Queue a render (UI thread). The job only holds a weak reference, like Drum5KitLoader::rebuild().
+	void request(int voice, const Drum5HitKey& key, std::function<std::shared_ptr<const SampleBank::Buffer>()> render) {
+		std::weak_ptr<Drum5HitCache> weak = shared_from_this();
+		worker->push([weak, voice, key, render] {
+			if (weak.expired())
+				return;
+			std::shared_ptr<const SampleBank::Buffer> data = render();
+			if (auto self = weak.lock())
+				self->publish(voice, key, data);
+		});
+	}
+
+	// Frees replaced hits no voice streams anymore (UI thread, also done after every publish).
+	void collect() {
+		std::lock_guard<std::mutex> lock(mutex);
+		reclaim();
+	}
+
+private:
+	std::mutex mutex;  // Guards the members below (UI and worker threads).
+	uint32_t nextSerial = 1;
+	std::shared_ptr<const Hit> published[5];
+	std::vector<std::shared_ptr<const Hit>> retired;
+
+	void publish(int voice, const Drum5HitKey& key, std::shared_ptr<const SampleBank::Buffer> data) {
+		auto hit = std::make_shared<Hit>();
+		hit->key = key;
+		hit->data = data;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		hit->serial = nextSerial++;
+		if (published[voice])
+			retired.push_back(published[voice]);
+		published[voice] = hit;
+		ready[voice].store(hit.get(), std::memory_order_release);
+		reclaim();
+	}
+
+	// Mutex held. Serials only grow per voice and the engine reads every voice's latest hit once per block,
+	// so anything older than the oldest serial it reported is unreachable.
+	void reclaim() {
+		uint32_t oldest = oldestInUse.load(std::memory_order_acquire);
+		retired.erase(std::remove_if(retired.begin(), retired.end(),
+			[oldest](const std::shared_ptr<const Hit>& h) { return h->serial < oldest; }), retired.end());
+	}
+};
+
+
 // General structure.
 struct TL_Drum5 : Module {
 // --------------------   Visual components namespace  ---------------------------
@@ -46,6 +348,18 @@ struct TL_Drum5 : Module {
 		FILTER_CH_PARAM,
 		FILTER_SN_PARAM,
 		FILTER_CL_PARAM,
+		TUNE_KK_PARAM,
+		TUNE_SN_PARAM,
+		TUNE_CL_PARAM,
+		TUNE_CH_PARAM,
+		TUNE_OH_PARAM,
+		SWING_PARAM,
+		HUMANIZE_PARAM,
+		NUDGE_KK_PARAM,
+		NUDGE_SN_PARAM,
+		NUDGE_CL_PARAM,
+		NUDGE_CH_PARAM,
+		NUDGE_OH_PARAM,
 		PARAMS_LEN
 	};
 	enum InputId {
@@ -54,6 +368,9 @@ struct TL_Drum5 : Module {
 		IN_OH_INPUT,
 		IN_CL_INPUT,
 		IN_SN_INPUT,
+		CLOCK_INPUT,
+		RESET_INPUT,
+		TUNE_INPUT,
 		INPUTS_LEN
 	};
 	enum OutputId {
@@ -76,60 +393,485 @@ struct TL_Drum5 : Module {
 	};
 
 // --------------------   Set initial values  ------------------------------------
-    dsp::SchmittTrigger trigKick, trigClap, trigSnare, trigClosedHat, trigOpenHat;
+	// Channels are mixed as struct-of-arrays in float_4 lanes: block 0 = KK, SN, CL, CH; block 1 = OH (+3 padding lanes).
+	static constexpr int VOICES = 5;
+	static constexpr int BLOCKS = 2;
+	static constexpr int LANES = BLOCKS * 4;
 
-	// Represents a single voice that plays a short audio sample.
-	struct Voice {
-		const int16_t* sample = nullptr;  // Pointer to the audio sample data.
-		int length = 0;  // Length of the sample.
-		float pos = 0.f;  // Current playback position (floating point for interpolation).
-		
-		// How much to advance 'pos' each step (depends on sample rate).
-		float stepSize = 1.f;  // OriginalSample: 48000 kHz / currentSampleRateVCV.
-		bool playing = false;
+	// Overlapping hits: up to POOL per channel, from one preallocated set of lanes.
+	static constexpr int POOL = 4;
+	static constexpr int POOL_LANES = VOICES * POOL;
+	static constexpr int POOL_BLOCKS = POOL_LANES / 4;
 
-		// Called on each audio frame to advance playback and get the next sample.
-		float step() {
-			if (!playing || pos >= length - 1)  // If not playing or reached the end of the sample, return silence.
-				return 0.f;
+	// PUSH saturation (drive x1.5): plain clamp (aliases), or anti-aliased hard / soft clip.
+	enum PushMode {
+		PUSH_CLAMP,
+		PUSH_HARD_ADAA1,
+		PUSH_SOFT_ADAA1,
+		PUSH_HARD_ADAA2,
+		PUSH_SOFT_ADAA2,
+		PUSH_MODES_LEN
+	};
+
+	// Per-voice wiring (ports, params, lights), in lane order.
+	struct VoiceIds {
+		int trigger, volume, push, filter, decay, link, pan, tune, nudge, output, light;
+	};
+	static constexpr VoiceIds VOICE_IDS[VOICES] = {
+		{IN_KK_INPUT, VOL_KK_PARAM, PUSH_KK_PARAM, FILTER_KK_PARAM, DECAY_KK_PARAM, LINK_KK_PARAM, PAN_KK_PARAM, TUNE_KK_PARAM, NUDGE_KK_PARAM, OUT_KK_OUTPUT, LED_KK_LIGHT},
+		{IN_SN_INPUT, VOL_SN_PARAM, PUSH_SN_PARAM, FILTER_SN_PARAM, DECAY_SN_PARAM, LINK_SN_PARAM, PAN_SN_PARAM, TUNE_SN_PARAM, NUDGE_SN_PARAM, OUT_SN_OUTPUT, LED_SN_LIGHT},
+		{IN_CL_INPUT, VOL_CL_PARAM, PUSH_CL_PARAM, FILTER_CL_PARAM, DECAY_CL_PARAM, LINK_CL_PARAM, PAN_CL_PARAM, TUNE_CL_PARAM, NUDGE_CL_PARAM, OUT_CL_OUTPUT, LED_CL_LIGHT},
+		{IN_CH_INPUT, VOL_CH_PARAM, PUSH_CH_PARAM, FILTER_CH_PARAM, DECAY_CH_PARAM, LINK_CH_PARAM, PAN_CH_PARAM, TUNE_CH_PARAM, NUDGE_CH_PARAM, OUT_CH_OUTPUT, LED_CH_LIGHT},
+		{IN_OH_INPUT, VOL_OH_PARAM, PUSH_OH_PARAM, FILTER_OH_PARAM, DECAY_OH_PARAM, LINK_OH_PARAM, PAN_OH_PARAM, TUNE_OH_PARAM, NUDGE_OH_PARAM, OUT_OH_OUTPUT, LED_OH_LIGHT},
+	};
+
+	// TUNE: knob in semitones plus 1 V/oct CV, playback rate kept within ±MAX_TUNE_OCTAVES.
+	static constexpr float MAX_TUNE_OCTAVES = 4.f;
+
+	// Plugin-wide float copy of the kit (converted once, shared by all instances).
+	std::shared_ptr<Drum5Kit> kit = SampleBank::acquire<Drum5Kit>();
+	// User samples + rate-matched kit, swapped in by the worker (integer-index playback once ready).
+	std::shared_ptr<Drum5KitLoader> loader = std::make_shared<Drum5KitLoader>(kit.get());
+	// Pre-rendered hits, streamed instead of running the voice DSP while the knobs stay put.
+	std::shared_ptr<Drum5HitCache> hitCache = std::make_shared<Drum5HitCache>(&kit->worker);
+	uint32_t newestHitSeen = 0;  // Highest hit serial read from the cache (audio thread).
+
+	dsp::SchmittTrigger triggers[VOICES];
+
+	// Hits of all five channels (sample playback + decay envelope + macro filter + steal fade) as lanes.
+	// Sounding hits are kept packed in lanes [0, count), so a frame costs one float_4 pass per four hits
+	// whatever the pool capacity; each lane is summed into the channel it plays on.
+	struct VoiceLanes {
+		int count = 0;  // Sounding hits.
+		int perChannel[VOICES] = {};  // Sounding hits per channel (at most POOL).
+		int channel[POOL_LANES] = {};
 
-			int i0 = (int)pos;  // Get the two nearest sample points for interpolation.
-			int i1 = i0 + 1;
+		// Sample playback (gathered per lane, each lane reads its own sample).
+		const float* sample[POOL_LANES] = {};  // Pointer to the audio sample data (followed by a zero guard).
+		int length[POOL_LANES] = {};  // Length of the sample.
+		float pos[POOL_LANES] = {};  // Current playback position (floating point for interpolation).
+		float stepSize[POOL_LANES] = {};  // Kit rate / engine rate: 1 once the kit matches the engine rate.
+		float rate[LANES] = {1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f};  // Per-channel tune ratio, set every frame.
+		uint32_t generation[POOL_LANES] = {};  // Play kit each lane reads from (0 = 48 kHz factory kit).
+		uint32_t started[POOL_LANES] = {};  // Trigger order, to find the oldest hit of a channel.
+		uint32_t triggerCount = 0;
+		static constexpr float ENV_FLOOR = 0.001f;  // -60 dB, same as DecayEnvelope::isActive().
 
-			if (i1 >= length)  // Clamp to avoid reading out of bounds.
-				i1 = length - 1;
+		// Pre-rendered hits streamed as is (bit per lane; these lanes skip the live DSP).
+		uint32_t streaming = 0;
+		const float* hit[POOL_LANES] = {};
+		int hitLength[POOL_LANES] = {};
+		int hitPos[POOL_LANES] = {};
+		uint32_t hitSerial[POOL_LANES] = {};
 
-			float frac = pos - i0;  // Compute linear interpolation factor.
-			
-			// Convert int16 samples to float in range [-1.0, 1.0].
-			float s0 = (float)sample[i0] / 32768.f;
-			float s1 = (float)sample[i1] / 32768.f;
+		// Stolen hits ramp down over FADE_TIME, then free their lane.
+		static constexpr float FADE_TIME = 0.002f;
+		uint32_t fading = 0;
+		float fadeStep = 0.f;  // Per frame, set for the engine rate.
 
-			float out = s0 + (s1 - s0) * frac;  // Linear interpolation between s0 and s1.
+		uint32_t ended = 0;  // Lanes done this frame, packed away at its end.
 
-			pos += stepSize;  // Advance position.
-			if (pos >= length)  // If reached end, stop playing.
-				playing = false;
+		// Decay envelope, macro filter, push and fade gain, one float_4 per four lanes.
+		simd::float_4 envValue[POOL_BLOCKS] = {};
+		simd::float_4 envCoeff[POOL_BLOCKS] = {};
+		simd::float_4 fade[POOL_BLOCKS] = {1.f, 1.f, 1.f, 1.f, 1.f};
+		DSPUtils::BiquadLanes<simd::float_4> filter[POOL_BLOCKS];
+		float push[POOL_LANES] = {};
 
-			return out;
+		// PUSH clippers: first order on float_4 lanes, second order per lane in double.
+		int pushMode = PUSH_HARD_ADAA1;
+		DSPUtils::ADAA1<DSPUtils::HardClip, simd::float_4> hardClip1[POOL_BLOCKS];
+		DSPUtils::ADAA1<DSPUtils::SoftClip, simd::float_4> softClip1[POOL_BLOCKS];
+		DSPUtils::ADAA2<DSPUtils::HardClip> hardClip2[POOL_LANES];
+		DSPUtils::ADAA2<DSPUtils::SoftClip> softClip2[POOL_LANES];
+
+		// Channel settings, copied into a lane when a hit starts there.
+		DSPUtils::BiquadLanes<simd::float_4> channelFilter[BLOCKS];  // Coefficients only.
+		float channelPush[VOICES] = {};
+		float lastFilter[VOICES] = {};  // Cached filter params (recompute on param or SR change).
+		float lastSampleRate[VOICES] = {};
+
+		// Lane for a new hit on a channel: a fresh one, else the channel's oldest hit is cut. When that fills
+		// the channel's pool, its oldest other hit starts fading, so the next hit usually finds room.
+		int allocate(int c) {
+			int lane = -1;
+			if (perChannel[c] < POOL) {
+				lane = count++;
+				perChannel[c]++;
+				channel[lane] = c;
+			}
+			else {
+				lane = oldest(c, 0);
+			}
+
+			if (perChannel[c] == POOL) {
+				int victim = oldest(c, fading | (1 << lane));
+				if (victim >= 0)
+					fading |= 1 << victim;
+			}
+			return lane;
 		}
 
-		// Starts playback of a new sample.
-		void trigger(const int16_t* s, int len, float currentSampleRate) {
-			sample = s;  // Set sample buffer.
-			length = len;  // Set buffer length.
-			pos = 0.f;  // Reset position to start.
-			stepSize = 48000.f / currentSampleRate;  // Adjust for host sample rate.
-			playing = true;  // Enable playback.
-	}
+		// Earliest started hit of a channel, leaving out the lanes in `skip` (-1 if none).
+		int oldest(int c, uint32_t skip) const {
+			int best = -1;
+			for (int l = 0; l < count; l++) {
+				if (channel[l] != c || (skip & (1 << l)))
+					continue;
+				if (best < 0 || started[l] < started[best])
+					best = l;
+			}
+			return best;
+		}
+
+		// Starts playback of a new sample and triggers the envelope of one lane.
+		void trigger(int lane, const SampleBank::Buffer& s, float step, uint32_t kitGeneration, float decay, float sampleRate) {
+			resetLane(lane);
+			sample[lane] = s.data;
+			generation[lane] = kitGeneration;
+			length[lane] = s.length;
+			pos[lane] = 0.f;
+			stepSize[lane] = step;
+
+			envValue[lane / 4][lane % 4] = 1.f;
+			envCoeff[lane / 4][lane % 4] = DSPUtils::decayCoefficient(decay, sampleRate);
+		}
+
+		// Starts streaming a pre-rendered hit on one lane.
+		void stream(int lane, const Drum5HitCache::Hit& h) {
+			resetLane(lane);
+			hit[lane] = h.data->data;
+			hitLength[lane] = h.data->length;
+			hitPos[lane] = 0;
+			hitSerial[lane] = h.serial;
+			streaming |= 1 << lane;
+		}
+
+		// Recompute a channel's macro filter when its knob or the sample rate moved (its sounding hits follow).
+		void setFilter(int c, float filterParam, float sampleRate) {
+			if (filterParam == lastFilter[c] && sampleRate == lastSampleRate[c])
+				return;
+			DSPUtils::setMacroFilterLane(channelFilter[c / 4], c % 4, filterParam, sampleRate);
+			lastFilter[c] = filterParam;
+			lastSampleRate[c] = sampleRate;
+			for (int l = 0; l < count; l++)
+				if (channel[l] == c)
+					copyCoefficients(l);
+		}
+
+		void setPush(int c, float pushParam) {
+			channelPush[c] = pushParam;
+			for (int l = 0; l < count; l++)
+				if (channel[l] == c)
+					push[l] = pushParam;
+		}
+
+		// One frame of every sounding hit, summed per channel into out[VOICES] (before volume).
+		void renderFrame(float* out) {
+			for (int c = 0; c < VOICES; c++)
+				out[c] = 0.f;
+
+			for (int b = 0; b * 4 < count; b++) {
+				simd::float_4 s = step(b);
+				s *= envelope(b);
+
+				s = saturate(b, s);
+				s = filter[b].process(s);
+				endDecayed(b);
+
+				if ((streaming >> (b * 4)) & 0xF)
+					s += streamStep(b);  // Live lanes are silent where a hit streams, and the other way round.
+				if ((fading >> (b * 4)) & 0xF)
+					s *= fadeGain(b);
+
+				for (int i = 0; i < 4 && b * 4 + i < count; i++)
+					out[channel[b * 4 + i]] += s[i];
+			}
+
+			// Pack the lanes left behind (from the top, so the lane moved down is never one that ended).
+			for (int l = count - 1; ended; l--) {
+				if (ended & (1 << l)) {
+					ended &= ~(1 << l);
+					remove(l);
+				}
+			}
+		}
+
+	private:
+		// Lanes of a block holding a live (not streamed) hit.
+		int liveMask(int b) const {
+			int used = (count - b * 4 >= 4) ? 0xF : (1 << std::max(0, count - b * 4)) - 1;
+			return used & ~(streaming >> (b * 4)) & 0xF;
+		}
+
+		// Advance playback of one block and return its interpolated samples (cubic Hermite between sample points).
+		simd::float_4 step(int b) {
+			simd::float_4 sm1 = 0.f, s0 = 0.f, s1 = 0.f, s2 = 0.f, frac = 0.f;
+
+			for (int live = liveMask(b), i = 0; live; live >>= 1, i++) {
+				if (!(live & 1))
+					continue;
+				int v = b * 4 + i;
+				if (pos[v] >= length[v] - 1) {  // Reached the end of the sample: silence, hit ends.
+					end(v);
+					continue;
+				}
+
+				int i0 = (int)pos[v];
+				s0[i] = sample[v][i0];
+				if (pos[v] != (float)i0) {
+					// Tuned or off-rate lane between two points (the zero pads cover i0 - 1 and i0 + 2).
+					sm1[i] = sample[v][i0 - 1];
+					s1[i] = sample[v][i0 + 1];
+					s2[i] = sample[v][i0 + 2];
+					frac[i] = pos[v] - i0;
+				}
+
+				pos[v] += stepSize[v] * rate[channel[v]];  // Advance position (the end is caught on the next step).
+			}
+
+			return DSPUtils::hermite4(sm1, s0, s1, s2, frac);  // All lanes at once (frac = 0 on untuned, rate-matched lanes).
+		}
+
+		// PUSH on the lanes of a block that have it. First-order clippers follow every lane, so flipping
+		// PUSH mid-hit doesn't glitch; second-order ones (double, per lane) only run where PUSH is on.
+		simd::float_4 saturate(int b, simd::float_4 s) {
+			simd::float_4 pushed = simd::float_4::load(&push[b * 4]) == 1.f;
+			simd::float_4 driven = s * 1.5f;
+			simd::float_4 clipped = 0.f;
+
+			switch (pushMode) {
+				case PUSH_HARD_ADAA1:
+					clipped = hardClip1[b].process(driven);
+					break;
+				case PUSH_SOFT_ADAA1:
+					clipped = softClip1[b].process(driven);
+					break;
+				case PUSH_HARD_ADAA2:
+				case PUSH_SOFT_ADAA2:
+					for (int on = simd::movemask(pushed), i = 0; on; on >>= 1, i++) {
+						if (!(on & 1))
+							continue;
+						int l = b * 4 + i;
+						clipped[i] = (float)((pushMode == PUSH_HARD_ADAA2) ? hardClip2[l].process(driven[i]) : softClip2[l].process(driven[i]));
+					}
+					break;
+				default:
+					return DSPUtils::applyBoost(s, pushed);
+			}
+			return simd::ifelse(pushed, clipped, s);
+		}
+
+		// Advance the streamed hits of one block (lanes end with their hit).
+		simd::float_4 streamStep(int b) {
+			simd::float_4 s = 0.f;
+			for (int mask = (streaming >> (b * 4)) & 0xF, i = 0; mask; mask >>= 1, i++) {
+				int v = b * 4 + i;
+				if (!(mask & 1) || (ended & (1 << v)))
+					continue;
+				s[i] = hit[v][hitPos[v]];
+				if (++hitPos[v] >= hitLength[v])
+					ended |= 1 << v;
+			}
+			return s;
+		}
+
+		// Advance the decay envelope of one block.
+		simd::float_4 envelope(int b) {
+			envValue[b] *= envCoeff[b];
+			return envValue[b];
+		}
+
+		// End the live lanes of a block whose envelope fell under the floor.
+		void endDecayed(int b) {
+			int decayed = simd::movemask(envValue[b] < ENV_FLOOR) & liveMask(b);
+			for (int i = 0; decayed; i++, decayed >>= 1)
+				if (decayed & 1)
+					ended |= 1 << (b * 4 + i);
+		}
+
+		// Advance the steal fades of one block (gain for this frame); lanes whose fade ran out end.
+		simd::float_4 fadeGain(int b) {
+			simd::float_4 gain = fade[b];
+			for (int mask = (fading >> (b * 4)) & 0xF, i = 0; mask; mask >>= 1, i++) {
+				if (!(mask & 1))
+					continue;
+				fade[b][i] -= fadeStep;
+				if (fade[b][i] <= 0.f)
+					ended |= 1 << (b * 4 + i);
+			}
+			return gain;
+		}
+
+		// Silences a lane at once (envelope and filter flushed), it is packed away at the end of the frame.
+		void end(int lane) {
+			ended |= 1 << lane;
+			envValue[lane / 4][lane % 4] = 0.f;
+			filter[lane / 4].z1[lane % 4] = 0.f;
+			filter[lane / 4].z2[lane % 4] = 0.f;
+		}
+
+		// Clean state for a hit starting on a lane, with its channel's settings.
+		void resetLane(int lane) {
+			int c = channel[lane];
+			streaming &= ~(1 << lane);
+			fading &= ~(1 << lane);
+			ended &= ~(1 << lane);
+			started[lane] = ++triggerCount;
+			envValue[lane / 4][lane % 4] = 0.f;
+			filter[lane / 4].z1[lane % 4] = 0.f;
+			filter[lane / 4].z2[lane % 4] = 0.f;
+			fade[lane / 4][lane % 4] = 1.f;
+			push[lane] = channelPush[c];
+			copyCoefficients(lane);
+			hardClip1[lane / 4].x1[lane % 4] = 0.f;
+			softClip1[lane / 4].x1[lane % 4] = 0.f;
+			hardClip2[lane].reset();
+			softClip2[lane].reset();
+		}
+
+		void copyCoefficients(int lane) {
+			int c = channel[lane];
+			DSPUtils::BiquadLanes<simd::float_4>& to = filter[lane / 4];
+			const DSPUtils::BiquadLanes<simd::float_4>& from = channelFilter[c / 4];
+			to.b0[lane % 4] = from.b0[c % 4];
+			to.b1[lane % 4] = from.b1[c % 4];
+			to.b2[lane % 4] = from.b2[c % 4];
+			to.a1[lane % 4] = from.a1[c % 4];
+			to.a2[lane % 4] = from.a2[c % 4];
+		}
+
+		// Frees a lane: the last sounding hit moves into it, so lanes stay packed.
+		void remove(int lane) {
+			perChannel[channel[lane]]--;
+			int last = --count;
+			if (lane != last)
+				moveLane(last, lane);
+			envValue[last / 4][last % 4] = 0.f;  // The freed top lane stays silent.
+			filter[last / 4].z1[last % 4] = 0.f;
+			filter[last / 4].z2[last % 4] = 0.f;
+			fade[last / 4][last % 4] = 1.f;
+			streaming &= ~(1 << last);
+			fading &= ~(1 << last);
+		}
+
+		void moveLane(int from, int to) {
+			channel[to] = channel[from];
+			sample[to] = sample[from];
+			length[to] = length[from];
+			pos[to] = pos[from];
+			stepSize[to] = stepSize[from];
+			generation[to] = generation[from];
+			started[to] = started[from];
+			hit[to] = hit[from];
+			hitLength[to] = hitLength[from];
+			hitPos[to] = hitPos[from];
+			hitSerial[to] = hitSerial[from];
+			push[to] = push[from];
+			hardClip2[to] = hardClip2[from];
+			softClip2[to] = softClip2[from];
+			streaming = (streaming & ~(1 << to)) | (((streaming >> from) & 1) << to);
+			fading = (fading & ~(1 << to)) | (((fading >> from) & 1) << to);
+
+			int fb = from / 4, fi = from % 4, tb = to / 4, ti = to % 4;
+			envValue[tb][ti] = envValue[fb][fi];
+			envCoeff[tb][ti] = envCoeff[fb][fi];
+			fade[tb][ti] = fade[fb][fi];
+			filter[tb].b0[ti] = filter[fb].b0[fi];
+			filter[tb].b1[ti] = filter[fb].b1[fi];
+			filter[tb].b2[ti] = filter[fb].b2[fi];
+			filter[tb].a1[ti] = filter[fb].a1[fi];
+			filter[tb].a2[ti] = filter[fb].a2[fi];
+			filter[tb].z1[ti] = filter[fb].z1[fi];
+			filter[tb].z2[ti] = filter[fb].z2[fi];
+			hardClip1[tb].x1[ti] = hardClip1[fb].x1[fi];
+			softClip1[tb].x1[ti] = softClip1[fb].x1[fi];
+		}
+	};
+
+	VoiceLanes voices;
+
+	// Block renderer: trigger edges are stamped with their frame, voices are rendered a block at a time.
+	static constexpr int MAX_BLOCK = 64;
+	int blockSize = 32;  // Frames per block (1 = per-sample rendering, no added latency).
+	int pendingBlockSize = 32;  // Set from the menu, applied at the next block boundary.
+	int frame = 0;  // Frame of the block being collected.
+	uint8_t hits[MAX_BLOCK] = {};  // Voices triggered on each frame (bit per voice).
+	float tuneCv[MAX_BLOCK][LANES] = {};  // TUNE CV of each frame, in lane order.
+
+	// Last rendered block, played back while the next one is collected (blockSize - 1 frames late).
+	simd::float_4 rendered[BLOCKS][MAX_BLOCK] = {};
+	float mixRendered[2][MAX_BLOCK] = {};
+	bool silent = true;  // Nothing sounded in the rendered block.
+	simd::float_4 panLeft[BLOCKS] = {}, panRight[BLOCKS] = {};  // Pan gains of the rendered block (Link ignored).
+
+	// Direct outputs: one mono jack per voice, or the whole kit on two polyphonic cables
+	// (KICK out = 5 voices, SNARE out = 5 panned L/R pairs; channels in lane order).
+	enum OutputMode {
+		OUTPUTS_MONO,
+		OUTPUTS_POLY,
+		OUTPUT_MODES_LEN
+	};
+	int outputMode = OUTPUTS_MONO;  // Set from the menu (UI thread).
+
+	int pushMode = PUSH_HARD_ADAA1;  // Set from the menu.
+
+	// Trigger timing (swing, humanize, nudge): delayed hits wait here for their frame.
+	struct TriggerQueue {
+		static constexpr int CAPACITY = 64;
+		int count = 0;
+		uint32_t due[CAPACITY] = {};  // Frame (of `now` below) the hit fires on.
+		uint8_t voice[CAPACITY] = {};
+
+		void push(uint32_t when, int v) {
+			if (count == CAPACITY)
+				return;  // Full: the hit is dropped.
+			due[count] = when;
+			voice[count] = v;
+			count++;
+		}
+
+		// Hits due by `now` (bit per voice), taken off the queue.
+		int pop(uint32_t now) {
+			int mask = 0;
+			for (int i = 0; i < count;) {
+				if ((int32_t)(due[i] - now) <= 0) {
+					mask |= 1 << voice[i];
+					count--;
+					due[i] = due[count];
+					voice[i] = voice[count];
+				}
+				else {
+					i++;
+				}
+			}
+			return mask;
+		}
 	};
 
-    Voice kick, clap, snare, closedHat, openHat;
-	DSPUtils::CachedLowPass kickLowFilter, clapLowFilter, snareLowFilter, closedHatLowFilter, openHatLowFilter;
-	DSPUtils::CachedHighPass kickHighFilter, clapHighFilter, snareHighFilter, closedHatHighFilter, openHatHighFilter;
+	static constexpr float MAX_NUDGE_MS = 20.f;
+	static constexpr float MAX_HUMANIZE_MS = 20.f;
+	TriggerQueue delayed;
+	uint32_t now = 0;  // Frames since start (wraps).
+	// CLOCK period for swing (median of the last intervals, 0 until two edges). An interval far longer than
+	// the period is a stopped clock: measuring starts over, so the pause never becomes a swing delay.
+	static constexpr uint32_t CLOCK_PAUSE = 4;  // Periods.
+	StepEngine::PeriodTracker clockPeriod;
+	uint32_t humanizeSeed = random::u32();  // Saved with the patch; RESET restarts the sequence.
+	DSPUtils::Rng humanizeRng;
 
+	// Built-in sequencer: one 16-step pattern per voice (bit s = step s), edited from the menu, run by CLOCK.
+	static constexpr int STEPS = 16;
+	uint16_t pattern[VOICES] = {};
+	int seqStep = -1;  // Step last played (-1 = the next clock plays step 1).
+	dsp::SchmittTrigger clockTrigger;
+	dsp::SchmittTrigger resetTrigger;
 
-	DSPUtils::DecayEnvelope kickEnvelope, clapEnvelope, snareEnvelope, closedHatEnvelope, openHatEnvelope;
+	// Hit cache requests (UI thread): knobs must hold still this long before a hit is rendered.
+	static constexpr double HIT_SETTLE_TIME = 0.25;
+	Drum5HitKey settling[VOICES];
+	double settledSince[VOICES] = {};
+	Drum5HitKey requested[VOICES];
 
 // --------------------   Config module  -----------------------------------------
 	TL_Drum5() {
@@ -177,12 +919,36 @@ struct TL_Drum5 : Module {
 		configParam(FILTER_OH_PARAM, -10.f, 10.f, 0.f, "Filter");
 		configParam(FILTER_SN_PARAM, -10.f, 10.f, 0.f, "Filter");
 		
+		// TUNE (shown in the context menu).
+		configParam(TUNE_KK_PARAM, -24.f, 24.f, 0.f, "Kick tune", " semitones");
+		configParam(TUNE_SN_PARAM, -24.f, 24.f, 0.f, "Snare tune", " semitones");
+		configParam(TUNE_CL_PARAM, -24.f, 24.f, 0.f, "Clap tune", " semitones");
+		configParam(TUNE_CH_PARAM, -24.f, 24.f, 0.f, "Closed hat tune", " semitones");
+		configParam(TUNE_OH_PARAM, -24.f, 24.f, 0.f, "Open hat tune", " semitones");
+
 		// TRIGGER INPUTS.
 		configInput(IN_CL_INPUT, "Trigger clap");
 		configInput(IN_CH_INPUT, "Trigger closed hat");
 		configInput(IN_KK_INPUT, "Trigger kick");
 		configInput(IN_OH_INPUT, "Trigger open hat");
 		configInput(IN_SN_INPUT, "Trigger snare");
+
+		// SEQUENCER.
+		configInput(CLOCK_INPUT, "Sequencer clock");
+		configInput(RESET_INPUT, "Sequencer reset");
+
+		// TUNE CV.
+		configInput(TUNE_INPUT, "Tune (1V/oct; poly: kick, snare, clap, closed hat, open hat)");
+
+		// TIMING (shown in the context menu).
+		configParam(SWING_PARAM, 0.f, 50.f, 0.f, "Swing", "%");
+		configParam(HUMANIZE_PARAM, 0.f, MAX_HUMANIZE_MS, 0.f, "Humanize", " ms");
+		configParam(NUDGE_KK_PARAM, -MAX_NUDGE_MS, MAX_NUDGE_MS, 0.f, "Kick nudge", " ms");
+		configParam(NUDGE_SN_PARAM, -MAX_NUDGE_MS, MAX_NUDGE_MS, 0.f, "Snare nudge", " ms");
+		configParam(NUDGE_CL_PARAM, -MAX_NUDGE_MS, MAX_NUDGE_MS, 0.f, "Clap nudge", " ms");
+		configParam(NUDGE_CH_PARAM, -MAX_NUDGE_MS, MAX_NUDGE_MS, 0.f, "Closed hat nudge", " ms");
+		configParam(NUDGE_OH_PARAM, -MAX_NUDGE_MS, MAX_NUDGE_MS, 0.f, "Open hat nudge", " ms");
+		humanizeRng.seed(humanizeSeed);
 		
 		// INDIVIDUAL OUTPUTS.
 		configOutput(OUT_CL_OUTPUT, "Clap");
@@ -196,90 +962,416 @@ struct TL_Drum5 : Module {
 		configOutput(OUT_R_OUTPUT, "R");
 	}
 
-// --------------------   Functions  ---------------------------------------------
-
-	// Process per channel.
-	std::tuple<float, float> processChannel(float trigger_in, float vol_in, float push_in, float filter_in, float decay_in, 
-										float link_in, dsp::SchmittTrigger& schmittTrig, Voice& voice, DSPUtils::DecayEnvelope& envelope,
-										float sampleRate, DSPUtils::CachedLowPass& lowFilter, DSPUtils::CachedHighPass& highFilter, 
-										float individual_out, float led_out, float pan_in, float mixLeft, float mixRight, 
-										const int16_t* sample_data, int sample_len) {		
-		// Get input values.
-		float trigger = inputs[trigger_in].getVoltage();
-		float volume = params[vol_in].getValue();
-		float push = params[push_in].getValue();
-		float filter = params[filter_in].getValue();
-		float decay = params[decay_in].getValue();
-		float link = params[link_in].getValue();
-		float pan = params[pan_in].getValue();
-		
-		// Trigger plays samples.
-        if (schmittTrig.process(trigger)) 
-		{voice.trigger(sample_data, sample_len, sampleRate); envelope.trigger(decay, sampleRate);}
+	// Ask for the kit at the new engine rate (resampled in the background on first use).
+	void onSampleRateChange(const SampleRateChangeEvent& e) override {
+		Module::onSampleRateChange(e);
+		loader->setRate(e.sampleRate);
+	}
 
-		// Sample processors.
-		float sample = voice.step();
-		sample *= envelope.process(); 
-		
-		sample = DSPUtils::applyBoost(sample, push);
-		sample = lowFilter.process(sample, filter, sampleRate);
-		sample = highFilter.process(sample, filter, sampleRate);
-		sample = DSPUtils::applyVolume(sample, volume);		
-		
-		outputs[individual_out].setVoltage(sample * 5.f);
-		lights[led_out].setBrightness(std::fabs(sample));
-		if (link == 0.f) 
-		{
-			float masterLeft, masterRight;
-			DSPUtils::applyPan(sample, pan, masterLeft, masterRight);
-			mixLeft += masterLeft;
-			mixRight += masterRight;
+	// User sample paths (empty = factory sample), reloaded in the background.
+	json_t* dataToJson() override {
+		json_t* rootJ = json_object();
+		json_t* samplesJ = json_array();
+		for (int v = 0; v < VOICES; v++)
+			json_array_append_new(samplesJ, json_string(loader->getSample(v).c_str()));
+		json_object_set_new(rootJ, "samples", samplesJ);
+		json_object_set_new(rootJ, "blockSize", json_integer(pendingBlockSize));
+		json_object_set_new(rootJ, "pushMode", json_integer(pushMode));
+		json_t* patternJ = json_array();
+		for (int v = 0; v < VOICES; v++)
+			json_array_append_new(patternJ, json_integer(pattern[v]));
+		json_object_set_new(rootJ, "pattern", patternJ);
+		json_object_set_new(rootJ, "humanizeSeed", json_integer(humanizeSeed));
+		json_object_set_new(rootJ, "outputMode", json_integer(outputMode));
+		return rootJ;
+	}
+
+	// Patches from before the Push saturation and render block settings keep the plain clamp and the
+	// per-sample rendering they were made with (new instances use ADAA and 32-frame blocks). The oldest ones
+	// have no module data at all, so the defaults are set before dataFromJson runs.
+	void fromJson(json_t* rootJ) override {
+		pushMode = PUSH_CLAMP;
+		pendingBlockSize = 1;
+		Module::fromJson(rootJ);
+	}
+
+	void dataFromJson(json_t* rootJ) override {
+		json_t* samplesJ = json_object_get(rootJ, "samples");
+		for (int v = 0; v < VOICES && samplesJ; v++) {
+			json_t* pathJ = json_array_get(samplesJ, v);
+			if (pathJ && json_string_value(pathJ))
+				loader->setSample(v, json_string_value(pathJ));
+		}
+
+		json_t* blockSizeJ = json_object_get(rootJ, "blockSize");
+		if (blockSizeJ)
+			pendingBlockSize = clamp((int)json_integer_value(blockSizeJ), 1, MAX_BLOCK);
+
+		json_t* pushModeJ = json_object_get(rootJ, "pushMode");
+		if (pushModeJ)
+			pushMode = clamp((int)json_integer_value(pushModeJ), 0, PUSH_MODES_LEN - 1);
+
+		json_t* patternJ = json_object_get(rootJ, "pattern");
+		for (int v = 0; v < VOICES && patternJ; v++) {
+			json_t* stepsJ = json_array_get(patternJ, v);
+			if (stepsJ)
+				pattern[v] = (uint16_t)json_integer_value(stepsJ);
+		}
+
+		json_t* seedJ = json_object_get(rootJ, "humanizeSeed");
+		if (seedJ) {
+			humanizeSeed = (uint32_t)json_integer_value(seedJ);
+			humanizeRng.seed(humanizeSeed);
 		}
 
-        return std::make_tuple(mixLeft, mixRight);
-    }
+		json_t* outputModeJ = json_object_get(rootJ, "outputMode");
+		if (outputModeJ)
+			setOutputMode(clamp((int)json_integer_value(outputModeJ), 0, OUTPUT_MODES_LEN - 1));
+	}
 
+	// UI thread: switch the direct outputs (port names follow; channel counts are set by process()).
+	void setOutputMode(int mode) {
+		static const char* names[VOICES] = {"Kick", "Snare", "Clap", "Closed hat", "Open hat"};
+		bool poly = (mode == OUTPUTS_POLY);
+		for (int v = 0; v < VOICES; v++)
+			outputInfos[VOICE_IDS[v].output]->name = names[v];
+		if (poly) {
+			outputInfos[OUT_KK_OUTPUT]->name = "All voices (poly: kick, snare, clap, closed hat, open hat)";
+			outputInfos[OUT_SN_OUTPUT]->name = "All voices panned (poly: L/R pair per voice)";
+			for (int v = 2; v < VOICES; v++)
+				outputInfos[VOICE_IDS[v].output]->name += " (unused in poly mode)";
+		}
+		outputMode = mode;
+	}
 
 // --------------------   Main cycle logic  --------------------------------------
 	void process(const ProcessArgs& args) override {
-		float sampleRate = args.sampleRate;  // Get sample rate from VCV.
-
-		// Stereo mix initial values.
-		float mixLeft = 0.f;
-		float mixRight = 0.f;
-
-		// Kick.
-		std::tie(mixLeft, mixRight) = processChannel(IN_KK_INPUT, VOL_KK_PARAM, PUSH_KK_PARAM, FILTER_KK_PARAM, DECAY_KK_PARAM, 
-			LINK_KK_PARAM, trigKick, kick, kickEnvelope, sampleRate, kickLowFilter, kickHighFilter, OUT_KK_OUTPUT, LED_KK_LIGHT, 
-			PAN_KK_PARAM, mixLeft, mixRight, kick_sample, kick_sample_len);
-			
-		// Snare.
-		std::tie(mixLeft, mixRight) = processChannel(IN_SN_INPUT, VOL_SN_PARAM, PUSH_SN_PARAM, FILTER_SN_PARAM, DECAY_SN_PARAM, 
-			LINK_SN_PARAM, trigSnare, snare, snareEnvelope, sampleRate, snareLowFilter, snareHighFilter, OUT_SN_OUTPUT, LED_SN_LIGHT, 
-			PAN_SN_PARAM, mixLeft, mixRight, snare_sample, snare_sample_len);
-
-		// Clap.
-		std::tie(mixLeft, mixRight) = processChannel(IN_CL_INPUT, VOL_CL_PARAM, PUSH_CL_PARAM, FILTER_CL_PARAM, DECAY_CL_PARAM, 
-			LINK_CL_PARAM, trigClap, clap, clapEnvelope, sampleRate, clapLowFilter, clapHighFilter, OUT_CL_OUTPUT, LED_CL_LIGHT, 
-			PAN_CL_PARAM, mixLeft, mixRight, clap_sample, clap_sample_len);
-
-		// Closed Hat.
-		std::tie(mixLeft, mixRight) = processChannel(IN_CH_INPUT, VOL_CH_PARAM, PUSH_CH_PARAM, FILTER_CH_PARAM, DECAY_CH_PARAM, 
-			LINK_CH_PARAM, trigClosedHat, closedHat, closedHatEnvelope, sampleRate, closedHatLowFilter, closedHatHighFilter, 
-			OUT_CH_OUTPUT, LED_CH_LIGHT, PAN_CH_PARAM, mixLeft, mixRight, closedhat_sample, closedhat_sample_len);
-
-		// Open Hat.
-		std::tie(mixLeft, mixRight) = processChannel(IN_OH_INPUT, VOL_OH_PARAM, PUSH_OH_PARAM, FILTER_OH_PARAM, DECAY_OH_PARAM, 
-			LINK_OH_PARAM, trigOpenHat, openHat, openHatEnvelope, sampleRate, openHatLowFilter, openHatHighFilter, OUT_OH_OUTPUT, 
-			LED_OH_LIGHT, PAN_OH_PARAM, mixLeft, mixRight, openhat_sample, openhat_sample_len);
-
-        // Stereo Outs, rescaled to ±5V.
-		outputs[OUT_L_OUTPUT].setVoltage(mixLeft * 5.f);
-		outputs[OUT_R_OUTPUT].setVoltage(mixRight * 5.f);
+		// Trigger edges are stamped with their frame, so hits stay sample-accurate inside a block.
+		int edges = 0;
+		for (int v = 0; v < VOICES; v++)
+			if (triggers[v].process(inputs[VOICE_IDS[v].trigger].getVoltage()))
+				edges |= 1 << v;
+
+		// TUNE CV is followed sample by sample: channel v tunes voice v (a mono CV tunes them all).
+		if (inputs[TUNE_INPUT].isConnected())
+			for (int v = 0; v < VOICES; v++)
+				tuneCv[frame][v] = inputs[TUNE_INPUT].getPolyVoltage(v);
+
+		// Sequencer steps land on the same frame as their clock edge (even steps; odd ones swing).
+		int swung = 0;
+		if (resetTrigger.process(inputs[RESET_INPUT].getVoltage())) {
+			seqStep = -1;
+			humanizeRng.seed(humanizeSeed);
+		}
+		if (clockTrigger.process(inputs[CLOCK_INPUT].getVoltage())) {
+			seqStep = (seqStep + 1) % STEPS;
+			edges |= stepHits(seqStep);
+			if (seqStep % 2)
+				swung = stepHits(seqStep);
+			uint32_t period = clockPeriod.period();
+			if (period && now - clockPeriod.lastEdge > CLOCK_PAUSE * period)
+				clockPeriod = StepEngine::PeriodTracker();
+			clockPeriod.edge(now);
+		}
+
+		// Timing: hits with no delay play now, the others wait in the queue.
+		if (edges)
+			hits[frame] |= delayHits(edges, swung, args.sampleRate);
+		if (delayed.count)
+			hits[frame] |= delayed.pop(now);
+		now++;
+
+		// Block complete: render it and start collecting the next one.
+		if (++frame >= blockSize) {
+			renderBlock(args.sampleRate, blockSize);
+			frame = 0;
+			if (pendingBlockSize != blockSize)
+				resizeBlock(pendingBlockSize);
+		}
+
+		// Play back the rendered block. Channel counts are set every frame: a newly patched cable starts at one.
+		if (outputMode == OUTPUTS_POLY) {
+			playPoly();
+		}
+		else {
+			for (int v = 0; v < VOICES; v++) {
+				outputs[VOICE_IDS[v].output].setChannels(1);
+				outputs[VOICE_IDS[v].output].setVoltage(silent ? 0.f : rendered[v / 4][frame][v % 4] * 5.f);
+			}
+		}
 
+		// Stereo Outs, rescaled to ±5V.
+		outputs[OUT_L_OUTPUT].setVoltage(silent ? 0.f : mixRendered[0][frame] * 5.f);
+		outputs[OUT_R_OUTPUT].setVoltage(silent ? 0.f : mixRendered[1][frame] * 5.f);
+	}
+
+	// Poly mode: every voice on the KICK jack, every voice's panned pair on the SNARE jack; the other direct
+	// jacks stay at 0 V.
+	void playPoly() {
+		Output& stems = outputs[OUT_KK_OUTPUT];
+		Output& pairs = outputs[OUT_SN_OUTPUT];
+		stems.setChannels(VOICES);
+		pairs.setChannels(2 * VOICES);
+		for (int v = 2; v < VOICES; v++) {
+			outputs[VOICE_IDS[v].output].setChannels(1);
+			outputs[VOICE_IDS[v].output].setVoltage(0.f);
+		}
+		for (int b = 0; b < BLOCKS; b++) {
+			simd::float_4 s = silent ? 0.f : rendered[b][frame] * 5.f;
+			simd::float_4 left = s * panLeft[b], right = s * panRight[b];
+			for (int i = 0; i < 4 && b * 4 + i < VOICES; i++) {
+				int v = b * 4 + i;
+				stems.setVoltage(s[i], v);
+				pairs.setVoltage(left[i], 2 * v);
+				pairs.setVoltage(right[i], 2 * v + 1);
+			}
+		}
+	}
+
+	// Lookahead of the timing stage: every hit is held this long, so negative nudges and early humanized hits
+	// can still play ahead of the others. Reported as latency.
+	int timingLatency(float sampleRate) {
+		float earliest = 0.f;
+		for (int v = 0; v < VOICES; v++)
+			earliest = std::min(earliest, params[VOICE_IDS[v].nudge].getValue());
+		float ms = params[HUMANIZE_PARAM].getValue() - earliest;
+		return (int)std::round(ms * 0.001f * sampleRate);
+	}
+
+	// Queue the hits of one frame with their nudge, humanize and (for swung steps) swing delays.
+	// Returns the hits that play on this frame.
+	int delayHits(int edges, int swung, float sampleRate) {
+		float msToFrames = 0.001f * sampleRate;
+		int latency = timingLatency(sampleRate);
+		float humanize = params[HUMANIZE_PARAM].getValue() * msToFrames;
+		float swing = params[SWING_PARAM].getValue() / 100.f * clockPeriod.period();
+
+		int playNow = 0;
+		for (int v = 0; v < VOICES; v++) {
+			if (!(edges & (1 << v)))
+				continue;
+			float delay = latency + params[VOICE_IDS[v].nudge].getValue() * msToFrames;
+			if (humanize > 0.f)
+				delay += (humanizeRng.uniform() * 2.f - 1.f) * humanize;
+			if (swung & (1 << v))
+				delay += swing;
+			int frames = std::max(0, (int)std::round(delay));
+			if (frames == 0)
+				playNow |= 1 << v;
+			else
+				delayed.push(now + frames, v);
+		}
+		return playNow;
+	}
+
+	// Voices set on step s, as a hit mask (bit per voice).
+	int stepHits(int s) const {
+		int mask = 0;
+		for (int v = 0; v < VOICES; v++)
+			mask |= ((pattern[v] >> s) & 1) << v;
+		return mask;
+	}
+
+	// Render n frames: play kit and controls are read once, each hit starts on its own frame.
+	void renderBlock(float sampleRate, int n) {
+		// Latest play kit (the 48 kHz factory kit until the first one is built). Off-rate kits interpolate.
+		const Drum5PlayKit* play = loader->current.load(std::memory_order_acquire);
+		const std::shared_ptr<const SampleBank::Buffer>* samples = play ? play->voices : kit->voices;
+		uint32_t generation = play ? play->generation : 0;
+		float step = (play ? play->rate : Drum5Kit::NATIVE_RATE) / sampleRate;
+
+		// Latest pre-rendered hits, read once per block (see Drum5HitCache::reclaim()).
+		const Drum5HitCache::Hit* ready[VOICES];
+		for (int v = 0; v < VOICES; v++)
+			ready[v] = hitCache->ready[v].load(std::memory_order_acquire);
+
+		int hit = 0;
+		for (int f = 0; f < n; f++)
+			hit |= hits[f];
+
+		// Idle fast path: nothing sounding or starting, no per-voice DSP.
+		silent = !voices.count && !hit;
+		if (silent) {
+			for (int v = 0; v < VOICES; v++)
+				lights[VOICE_IDS[v].light].setBrightness(0.f);
+			loader->oldestInUse.store(generation, std::memory_order_release);
+			storeOldestHit(ready);
+			return;
+		}
+
+		// Per-channel controls of the channels sounding or starting in this block (silent lanes: zero volume, linked).
+		float decay[VOICES] = {}, filter[VOICES] = {};
+		float tune[LANES] = {}, volume[LANES] = {}, pan[LANES] = {}, push[LANES] = {}, link[LANES] = {1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f};
+		int used = hit;
+		for (int v = 0; v < VOICES; v++)
+			if (voices.perChannel[v])
+				used |= 1 << v;
+
+		for (int v = 0; v < VOICES; v++) {
+			if (!(used & (1 << v)))
+				continue;
+			const VoiceIds& id = VOICE_IDS[v];
+			decay[v] = params[id.decay].getValue();
+			filter[v] = params[id.filter].getValue();
+			volume[v] = params[id.volume].getValue();
+			pan[v] = params[id.pan].getValue();
+			push[v] = params[id.push].getValue();
+			link[v] = params[id.link].getValue();
+			tune[v] = params[id.tune].getValue();
+			voices.setFilter(v, filter[v], sampleRate);
+			voices.setPush(v, push[v]);
+		}
+		voices.fadeStep = 1.f / (VoiceLanes::FADE_TIME * sampleRate);
+		voices.pushMode = pushMode;
+
+		// Tune ratios: once per block from the knobs, or every frame when the CV is patched.
+		bool tuneModulated = inputs[TUNE_INPUT].isConnected();
+		if (!tuneModulated)
+			for (int v = 0; v < VOICES; v++)
+				voices.rate[v] = std::exp2(clamp(tune[v] / 12.f, -MAX_TUNE_OCTAVES, MAX_TUNE_OCTAVES));
+
+		simd::float_4 gain[BLOCKS], peak[BLOCKS] = {};
+		for (int b = 0; b < BLOCKS; b++)
+			gain[b] = simd::clamp(simd::float_4::load(&volume[b * 4]) / 10.f, 0.f, 1.f);
+
+		// Sounding hits, four per pass, summed per channel.
+		for (int f = 0; f < n; f++) {
+			for (int h = hits[f], v = 0; h; h >>= 1, v++) {
+				if (!(h & 1))
+					continue;
+				// Knobs unchanged since the hit was rendered (and no tune CV): stream it, otherwise run the live DSP.
+				int lane = voices.allocate(v);
+				Drum5HitKey key = {generation, sampleRate, decay[v], filter[v], push[v] == 1.f, pushMode, tune[v]};
+				if (!tuneModulated && ready[v] && ready[v]->key == key)
+					voices.stream(lane, *ready[v]);
+				else
+					voices.trigger(lane, *samples[v], step, generation, decay[v], sampleRate);
+			}
+
+			if (tuneModulated) {
+				for (int b = 0; b < BLOCKS; b++) {
+					simd::float_4 octaves = simd::float_4::load(&tune[b * 4]) / 12.f + simd::float_4::load(tuneCv[f] + b * 4);
+					dsp::exp2_taylor5(simd::clamp(octaves, -MAX_TUNE_OCTAVES, MAX_TUNE_OCTAVES)).store(&voices.rate[b * 4]);
+				}
+			}
+
+			float out[LANES] = {};
+			voices.renderFrame(out);
+			for (int b = 0; b < BLOCKS; b++) {
+				rendered[b][f] = simd::float_4::load(&out[b * 4]) * gain[b];
+				peak[b] = simd::fmax(peak[b], simd::fabs(rendered[b][f]));
+			}
+		}
+
+		for (int v = 0; v < VOICES; v++)
+			lights[VOICE_IDS[v].light].setBrightness(peak[v / 4][v % 4]);
+
+		// Linear pan (see DSPUtils::applyPan); linked voices stay out of the stereo mix.
+		simd::float_4 gainLeft[BLOCKS], gainRight[BLOCKS];
+		for (int b = 0; b < BLOCKS; b++) {
+			simd::float_4 p = simd::clamp(simd::float_4::load(&pan[b * 4]), -1.f, 1.f);
+			simd::float_4 unlinked = simd::float_4::load(&link[b * 4]) == 0.f;
+			panLeft[b] = simd::ifelse(p <= 0.f, 1.f, 1.f - p);
+			panRight[b] = simd::ifelse(p >= 0.f, 1.f, 1.f + p);
+			gainLeft[b] = simd::ifelse(unlinked, panLeft[b], 0.f);
+			gainRight[b] = simd::ifelse(unlinked, panRight[b], 0.f);
+		}
+
+		// Stereo mix of the unlinked voices.
+		for (int f = 0; f < n; f++) {
+			simd::float_4 mixLeft = rendered[0][f] * gainLeft[0] + rendered[1][f] * gainLeft[1];
+			simd::float_4 mixRight = rendered[0][f] * gainRight[0] + rendered[1][f] * gainRight[1];
+			mixRendered[0][f] = mixLeft[0] + mixLeft[1] + mixLeft[2] + mixLeft[3];
+			mixRendered[1][f] = mixRight[0] + mixRight[1] + mixRight[2] + mixRight[3];
+		}
+
+		for (int f = 0; f < n; f++)
+			hits[f] = 0;
+
+		// Deferred reclamation: tell the loader the oldest kit a voice may still be reading.
+		uint32_t oldest = generation;
+		for (int lane = 0; lane < voices.count; lane++)
+			if (!(voices.streaming & (1 << lane)))
+				oldest = std::min(oldest, voices.generation[lane]);
+		loader->oldestInUse.store(oldest, std::memory_order_release);
+		storeOldestHit(ready);
+	}
+
+	// Same for the hit cache: the oldest hit streamed or picked up in this block. Hits the next block may pick
+	// up are newer than any seen so far, so the bound never passes newestHitSeen + 1 (even with nothing loaded).
+	void storeOldestHit(const Drum5HitCache::Hit* const* ready) {
+		for (int v = 0; v < VOICES; v++)
+			if (ready[v])
+				newestHitSeen = std::max(newestHitSeen, ready[v]->serial);
+		uint32_t oldest = newestHitSeen + 1;
+		for (int v = 0; v < VOICES; v++)
+			if (ready[v])
+				oldest = std::min(oldest, ready[v]->serial);
+		for (int lane = 0; lane < voices.count; lane++)
+			if (voices.streaming & (1 << lane))
+				oldest = std::min(oldest, voices.hitSerial[lane]);
+		hitCache->oldestInUse.store(oldest, std::memory_order_release);
+	}
+
+	// UI thread: once a voice's hit-shaping knobs have stayed put for a moment, render the hit on the worker.
+	void updateHitCache() {
+		std::shared_ptr<const Drum5PlayKit> play = loader->getPublished();  // Pinned: build() reclaims on the worker.
+		float sampleRate = APP->engine->getSampleRate();
+		double now = system::getTime();
+
+		for (int v = 0; v < VOICES; v++) {
+			const VoiceIds& id = VOICE_IDS[v];
+			Drum5HitKey key = {play ? play->generation : 0, sampleRate, params[id.decay].getValue(), params[id.filter].getValue(), params[id.push].getValue() == 1.f, pushMode,
+				params[id.tune].getValue()};
+			if (key != settling[v]) {
+				settling[v] = key;
+				settledSince[v] = now;
+				continue;
+			}
+			if (now - settledSince[v] < HIT_SETTLE_TIME || key == requested[v])
+				continue;
+
+			requested[v] = key;
+			std::shared_ptr<const SampleBank::Buffer> source = play ? play->voices[v] : kit->voices[v];
+			float step = (play ? play->rate : Drum5Kit::NATIVE_RATE) / sampleRate;
+			hitCache->request(v, key, [=] { return renderHit(*source, step, key); });
+		}
+	}
+
+	// Worker thread: one hit from an idle lane, through the same lane DSP as live playback.
+	static std::shared_ptr<const SampleBank::Buffer> renderHit(const SampleBank::Buffer& source, float step, const Drum5HitKey& key) {
+		VoiceLanes lanes;  // Rendered as the only hit of the first channel.
+		lanes.pushMode = key.pushMode;
+		lanes.setFilter(0, key.filter, key.sampleRate);
+		lanes.setPush(0, key.push ? 1.f : 0.f);
+		lanes.rate[0] = std::exp2(clamp(key.tune / 12.f, -MAX_TUNE_OCTAVES, MAX_TUNE_OCTAVES));
+		lanes.trigger(lanes.allocate(0), source, step, key.kitGeneration, key.decay, key.sampleRate);
+
+		std::vector<float> out;
+		float frame[LANES];
+		while (lanes.count) {
+			lanes.renderFrame(frame);
+			out.push_back(frame[0]);
+		}
+
+		auto buffer = std::make_shared<SampleBank::Buffer>(std::max(1, (int)out.size()));
+		std::copy(out.begin(), out.end(), buffer->data);
+		return buffer;
+	}
+
+	// Switch block size at a block boundary (the latency changes, frames past the old block play silence).
+	void resizeBlock(int size) {
+		for (int f = blockSize; f < size; f++) {
+			for (int b = 0; b < BLOCKS; b++)
+				rendered[b][f] = 0.f;
+			mixRendered[0][f] = mixRendered[1][f] = 0.f;
+		}
+		blockSize = size;
 	}
 };
 
+constexpr TL_Drum5::VoiceIds TL_Drum5::VOICE_IDS[];  // Indexed at runtime, so C++11 needs the definition.
+
 
 // --------------------   Visual components  -------------------------------------
 struct TL_Drum5Widget : ModuleWidget {
@@ -340,6 +1432,13 @@ struct TL_Drum5Widget : ModuleWidget {
 		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(56.699, 14.414)), module, TL_Drum5::IN_KK_INPUT));
 		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(31.768, 18.678)), module, TL_Drum5::IN_OH_INPUT));
 		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(6.62, 22.822)), module, TL_Drum5::IN_SN_INPUT));
+
+		// SEQUENCER.
+		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(12.189, 113.84)), module, TL_Drum5::CLOCK_INPUT));
+		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(24.189, 113.84)), module, TL_Drum5::RESET_INPUT));
+
+		// TUNE CV.
+		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(110.531, 113.84)), module, TL_Drum5::TUNE_INPUT));
 		
 		// INDIVIDUAL OUTPUTS.
 		addOutput(createOutputCentered<DarkPJ301MPort>(mm2px(Vec(115.608, 22.808)), module, TL_Drum5::OUT_CL_OUTPUT));
@@ -360,6 +1459,153 @@ struct TL_Drum5Widget : ModuleWidget {
 		addChild(createLightCentered<MediumLight<WhiteLight>>(mm2px(Vec(50.377, 104.787)), module, TL_Drum5::LED_SN_LIGHT));
 
 	}
+
+	// Free kits and hits replaced once no voice plays them anymore; queue hit renders.
+	void step() override {
+		ModuleWidget::step();
+		if (module) {
+			TL_Drum5* drum = static_cast<TL_Drum5*>(module);
+			drum->loader->collect();
+			drum->updateHitCache();
+			drum->hitCache->collect();
+		}
+	}
+
+	// Kit menu: per-voice user samples (WAV / AIFF), a kit folder, or back to factory.
+	void appendContextMenu(Menu* menu) override {
+		TL_Drum5* module = static_cast<TL_Drum5*>(this->module);
+		std::shared_ptr<Drum5KitLoader> loader = module->loader;
+		static const char* voiceNames[TL_Drum5::VOICES] = {"Kick", "Snare", "Clap", "Closed hat", "Open hat"};
+
+		// Tune, per voice (the TUNE CV adds to it).
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createMenuLabel("Tune"));
+		for (int v = 0; v < TL_Drum5::VOICES; v++)
+			menu->addChild(new ParamSlider(module->paramQuantities[TL_Drum5::VOICE_IDS[v].tune]));
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createMenuLabel("Kit"));
+		for (int v = 0; v < TL_Drum5::VOICES; v++) {
+			std::string path = loader->getSample(v);
+			menu->addChild(createSubmenuItem(voiceNames[v], path.empty() ? "Factory" : system::getFilename(path), [=](Menu* menu) {
+				menu->addChild(createMenuItem("Load sample...", "", [=]() {
+					std::string picked = pickFile(OSDIALOG_OPEN);
+					if (!picked.empty())
+						loader->setSample(v, picked);
+				}));
+				menu->addChild(createMenuItem("Factory sample", "", [=]() { loader->setSample(v, ""); }, path.empty()));
+			}));
+		}
+
+		// Folder with files named like the factory samples: kick, snare, clap, closedhat, openhat (.wav / .aif / .aiff).
+		menu->addChild(createMenuItem("Load kit folder...", "", [=]() {
+			std::string dir = pickFile(OSDIALOG_OPEN_DIR);
+			if (dir.empty())
+				return;
+			static const char* stems[TL_Drum5::VOICES] = {"kick", "snare", "clap", "closedhat", "openhat"};
+			for (const std::string& entry : system::getEntries(dir)) {
+				std::string ext = string::lowercase(system::getExtension(entry));
+				if (ext != ".wav" && ext != ".aif" && ext != ".aiff")
+					continue;
+				std::string stem = string::lowercase(system::getStem(entry));
+				for (int v = 0; v < TL_Drum5::VOICES; v++)
+					if (stem == stems[v])
+						loader->setSample(v, entry);
+			}
+		}));
+		menu->addChild(createMenuItem("Factory kit", "", [=]() {
+			for (int v = 0; v < TL_Drum5::VOICES; v++)
+				loader->setSample(v, "");
+		}));
+
+		// PUSH saturation: the anti-aliased clippers keep the drive clean at 1x rate.
+		menu->addChild(new MenuSeparator);
+		static const char* pushModeNames[TL_Drum5::PUSH_MODES_LEN] = {
+			"Hard clip (aliasing)",
+			"Hard clip, anti-aliased",
+			"Soft clip, anti-aliased",
+			"Hard clip, anti-aliased 2nd order",
+			"Soft clip, anti-aliased 2nd order",
+		};
+		menu->addChild(createIndexSubmenuItem("Push saturation",
+			std::vector<std::string>(pushModeNames, pushModeNames + TL_Drum5::PUSH_MODES_LEN),
+			[=]() { return module->pushMode; },
+			[=](int mode) { module->pushMode = mode; }));
+
+		// Sequencer patterns: 16 steps per voice, played from CLOCK (RESET goes back to step 1).
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createSubmenuItem("Sequencer", "", [=](Menu* menu) {
+			for (int v = 0; v < TL_Drum5::VOICES; v++) {
+				std::string steps;
+				for (int s = 0; s < TL_Drum5::STEPS; s++)
+					steps += (module->pattern[v] >> s & 1) ? 'x' : '-';
+				menu->addChild(createSubmenuItem(voiceNames[v], steps, [=](Menu* menu) {
+					for (int s = 0; s < TL_Drum5::STEPS; s++)
+						menu->addChild(createCheckMenuItem(string::f("Step %d", s + 1), "",
+							[=]() { return (module->pattern[v] >> s) & 1; },
+							[=]() { module->pattern[v] ^= 1 << s; }));
+					menu->addChild(createMenuItem("Clear", "", [=]() { module->pattern[v] = 0; }));
+				}));
+			}
+			menu->addChild(createMenuItem("Clear all", "", [=]() {
+				for (int v = 0; v < TL_Drum5::VOICES; v++)
+					module->pattern[v] = 0;
+			}));
+		}));
+
+		// Timing: swing (sequencer odd steps), humanize, per-voice nudge. Early hits need lookahead (latency).
+		menu->addChild(createSubmenuItem("Timing", "", [=](Menu* menu) {
+			menu->addChild(new ParamSlider(module->paramQuantities[TL_Drum5::SWING_PARAM]));
+			menu->addChild(new ParamSlider(module->paramQuantities[TL_Drum5::HUMANIZE_PARAM]));
+			menu->addChild(createMenuItem("New humanize seed", "", [=]() {
+				module->humanizeSeed = random::u32();
+				module->humanizeRng.seed(module->humanizeSeed);
+			}));
+			menu->addChild(new MenuSeparator);
+			for (int v = 0; v < TL_Drum5::VOICES; v++)
+				menu->addChild(new ParamSlider(module->paramQuantities[TL_Drum5::VOICE_IDS[v].nudge]));
+		}));
+		float sampleRate = APP->engine->getSampleRate();
+		int latency = module->timingLatency(sampleRate) + module->pendingBlockSize - 1;
+		menu->addChild(createMenuLabel(string::f("Latency: %d samples (%.1f ms)", latency, latency * 1000.f / sampleRate)));
+
+		// Direct outputs: mono jacks, or the whole kit on two poly cables.
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createIndexSubmenuItem("Direct outputs",
+			{"Mono (one jack per voice)", "Poly (KICK: 5 voices, SNARE: 5 panned L/R pairs)"},
+			[=]() { return module->outputMode; },
+			[=](int mode) { module->setOutputMode(mode); }));
+
+		// Render block: larger blocks cost less CPU, at blockSize - 1 frames of latency.
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createSubmenuItem("Render block", string::f("%d", module->pendingBlockSize), [=](Menu* menu) {
+			for (int size : {1, 16, 32, 64}) {
+				std::string latency = (size == 1) ? "no latency" : string::f("%d samples latency", size - 1);
+				menu->addChild(createCheckMenuItem(string::f("%d", size), latency,
+					[=]() { return module->pendingBlockSize == size; },
+					[=]() { module->pendingBlockSize = size; }));
+			}
+		}));
+	}
+
+	struct ParamSlider : ui::Slider {
+		explicit ParamSlider(Quantity* q) {
+			quantity = q;
+			box.size.x = 200.f;
+		}
+	};
+
+	static std::string pickFile(osdialog_file_action action) {
+		osdialog_filters* filters = (action == OSDIALOG_OPEN) ? osdialog_filters_parse("Audio (.wav .aif .aiff):wav,WAV,aif,AIF,aiff,AIFF") : nullptr;
+		char* pathC = osdialog_file(action, nullptr, nullptr, filters);
+		if (filters)
+			osdialog_filters_free(filters);
+		if (!pathC)
+			return "";
+		std::string path = pathC;
+		std::free(pathC);
+		return path;
+	}
 };
 
 
@@ -35,10 +35,14 @@ struct TL_Reseter : Module {
     bool bPressed = false;
 	bool lastAPressed = false;
 	bool lastBPressed = false;
+	// Polyphonic gate inputs: one bit per channel (= TL_Seq4 playhead).
+	uint16_t aHeadsHigh = 0;
+	uint16_t bHeadsHigh = 0;
+	uint16_t lastAHeads = 0;
+	uint16_t lastBHeads = 0;
 
-	// Expander message buffers (left/right)
-	ReseterMessage leftBuf[2];
-	ReseterMessage rightBuf[2];
+	// Resets sent so far to the left / right neighbor (see helpers/messages.hpp), copied to it every frame.
+	ReseterMessage sent[2];
 
 // --------------------   Constructor / configuration  ---------------------------
 	TL_Reseter() {
@@ -47,27 +51,26 @@ struct TL_Reseter : Module {
 		configButton(PUSH_B_PARAM, "Push B");
 		configSwitch(SIDE_A_PARAM, 0.f, 1.f, 0.f, "Side A", {"Left", "Right"});
 		configSwitch(SIDE_B_PARAM, 0.f, 1.f, 0.f, "Side B", {"Left", "Right"});
-		configInput(IN_A_INPUT, "Gate A");
-		configInput(IN_B_INPUT, "Gate B");
-
-		// Expander: bind producer/consumer buffers for message flips
-		leftExpander.producerMessage  = &leftBuf[0];
-		leftExpander.consumerMessage  = &leftBuf[1];
-		rightExpander.producerMessage = &rightBuf[0];
-		rightExpander.consumerMessage = &rightBuf[1];
+		configInput(IN_A_INPUT, "Gate A (poly: one playhead per channel)");
+		configInput(IN_B_INPUT, "Gate B (poly: one playhead per channel)");
 	}
 
 // --------------------   Helpers: UI feedback & expander I/O  -------------------
     void updateLightsAndTriggers(float deltaTime) {
-        // Read momentary buttons or gate inputs (>= 1 V considered active)
+        // Read momentary buttons or gate inputs (>= 1 V considered active). A mono gate resets the whole
+        // channel, a polyphonic one each playhead on its own channel.
+        bool aPoly = inputs[IN_A_INPUT].getChannels() > 1;
+        bool bPoly = inputs[IN_B_INPUT].getChannels() > 1;
         aPressed = (params[PUSH_A_PARAM].getValue() > 0.f) 
-                || (inputs[IN_A_INPUT].isConnected() && std::fabs(inputs[IN_A_INPUT].getVoltage()) > 1.f);
+                || (!aPoly && inputs[IN_A_INPUT].isConnected() && std::fabs(inputs[IN_A_INPUT].getVoltage()) > 1.f);
         bPressed = (params[PUSH_B_PARAM].getValue() > 0.f) 
-                || (inputs[IN_B_INPUT].isConnected() && std::fabs(inputs[IN_B_INPUT].getVoltage()) > 1.f);
+                || (!bPoly && inputs[IN_B_INPUT].isConnected() && std::fabs(inputs[IN_B_INPUT].getVoltage()) > 1.f);
+        aHeadsHigh = aPoly ? gateMask(inputs[IN_A_INPUT]) : 0;
+        bHeadsHigh = bPoly ? gateMask(inputs[IN_B_INPUT]) : 0;
 
         // Simple one-pole rise/fall for LED intensities
-        aLightIntensity += (aPressed ? (1.f - aLightIntensity) : -5.f * deltaTime);
-        bLightIntensity += (bPressed ? (1.f - bLightIntensity) : -5.f * deltaTime);
+        aLightIntensity += ((aPressed || aHeadsHigh) ? (1.f - aLightIntensity) : -5.f * deltaTime);
+        bLightIntensity += ((bPressed || bHeadsHigh) ? (1.f - bLightIntensity) : -5.f * deltaTime);
 
         // Clamp to [0..1]
         aLightIntensity = clamp(aLightIntensity, 0.f, 1.f);
@@ -78,41 +81,50 @@ struct TL_Reseter : Module {
         lights[PUSH_B_LED].setBrightness(bLightIntensity);
     }
 
+    // Channels of a polyphonic gate above 1 V, as bits.
+    static uint16_t gateMask(Input& in) {
+        uint16_t mask = 0;
+        for (int c = 0; c < in.getChannels(); c++)
+            mask |= (std::fabs(in.getVoltage(c)) > 1.f) << c;
+        return mask;
+    }
+
 	void sendToExpander() {
-		// Rising-edge detection on A/B to generate one-frame pulses
+		// Rising edges: of the buttons / mono gates, and of each polyphonic gate channel
 		bool sendA = (!lastAPressed && aPressed);
 		bool sendB = (!lastBPressed && bPressed);
 		lastAPressed = aPressed;
 		lastBPressed = bPressed;
+		uint16_t headsA = aHeadsHigh & ~lastAHeads;
+		uint16_t headsB = bHeadsHigh & ~lastBHeads;
+		lastAHeads = aHeadsHigh;
+		lastBHeads = bHeadsHigh;
+
+		// Count them for the side each channel is routed to (0 = left, 1 = right)
+		int sideA = params[SIDE_A_PARAM].getValue() == 0 ? 0 : 1;
+		int sideB = params[SIDE_B_PARAM].getValue() == 0 ? 0 : 1;
+		count(sent[sideA], 0, sendA, headsA);
+		count(sent[sideB], 1, sendB, headsB);
+		sent[0].header.sequence++;
+		sent[1].header.sequence++;
+
+		// Write into the TL_Seq4 neighbors' own buffers; they read them after the flip
+		if (leftExpander.module && leftExpander.module->model == modelTL_Seq4)
+			send(sent[0], leftExpander.module->rightExpander);
+		if (rightExpander.module && rightExpander.module->model == modelTL_Seq4)
+			send(sent[1], rightExpander.module->leftExpander);
+	}
+
+	static void count(ReseterMessage& m, int channel, bool all, uint16_t heads) {
+		m.channelResets[channel] += all;
+		for (; heads; heads &= heads - 1)
+			m.headResets[channel][__builtin_ctz(heads)]++;
+	}
 
-		// Route pulses to left or right neighbor depending on switch state
-		bool aToLeft  = params[SIDE_A_PARAM].getValue() == 0 && sendA;
-		bool aToRight = params[SIDE_A_PARAM].getValue() == 1 && sendA;
-		bool bToLeft  = params[SIDE_B_PARAM].getValue() == 0 && sendB;
-		bool bToRight = params[SIDE_B_PARAM].getValue() == 1 && sendB;
-
-		auto* l = (ReseterMessage*) leftExpander.producerMessage;
-		auto* r = (ReseterMessage*) rightExpander.producerMessage;
-
-		// Send to left (only if the neighbor is TL_Seq4), otherwise clear
-		if (leftExpander.module && leftExpander.module->model == modelTL_Seq4) {
-			l->aGate = aToLeft;
-			l->bGate = bToLeft;
-			leftExpander.requestMessageFlip();
-		} else {
-			l->aGate = false;
-			l->bGate = false;
-		}
-
-		// Send to right (only if the neighbor is TL_Seq4), otherwise clear
-		if (rightExpander.module && rightExpander.module->model == modelTL_Seq4) {
-			r->aGate = aToRight;
-			r->bGate = bToRight;
-			rightExpander.requestMessageFlip();
-		} else {
-			r->aGate = false;
-			r->bGate = false;
-		}
+	void send(ReseterMessage& m, Expander& neighbor) {
+		m.header.source = id;
+		*(ReseterMessage*) neighbor.producerMessage = m;
+		neighbor.requestMessageFlip();
 	}
 
 // --------------------   Process: per-sample UI + expander messaging ------------
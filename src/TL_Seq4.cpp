@@ -1,9 +1,14 @@
 #include "plugin.hpp"
+#include <atomic>
+#include <mutex>
+#include <osdialog.h>
+#include "../helpers/dsp_utils.hpp"
 #include "../helpers/messages.hpp"
+#include "../helpers/midi_file.hpp"
+#include "../helpers/step_engine.hpp"
+#include "../helpers/worker.hpp"
 
 
-extern Model* modelTL_Reseter;
-
 // Main module class for a dual trigger sequencer (A: 4/8 steps, B: 8/16 steps).
 struct TL_Seq4 : Module {
 // --------------------   UI enums / parameter & I/O indices  --------------------
@@ -40,6 +45,20 @@ struct TL_Seq4 : Module {
 		STEP_B15_PARAM,
 		STEP_B16_PARAM,
 
+		SWING_1_PARAM,
+		GATE_1_PARAM,
+		RATCHET_1_PARAM,
+		SWING_2_PARAM,
+		GATE_2_PARAM,
+		RATCHET_2_PARAM,
+
+		FILL_DENSITY_1_PARAM,
+		FILL_ROTATE_1_PARAM,
+		FILL_MUTATE_1_PARAM,
+		FILL_DENSITY_2_PARAM,
+		FILL_ROTATE_2_PARAM,
+		FILL_MUTATE_2_PARAM,
+
 		PARAMS_LEN
 	};
 	enum InputId {
@@ -51,6 +70,9 @@ struct TL_Seq4 : Module {
 		LENGTH_2_INPUT,
 		REVERSE_2_INPUT,
 
+		PATTERN_INPUT,
+		FILL_INPUT,
+
 		INPUTS_LEN
 	};
 	enum OutputId {
@@ -147,91 +169,185 @@ struct TL_Seq4 : Module {
 	};
 
 // --------------------   Runtime state / edge detectors  ------------------------
-	dsp::BooleanTrigger resetATrigger;
-	dsp::BooleanTrigger resetBTrigger;
-
-	// Sequencer A state.
-	bool input_a = false;
-	bool latch_a[8];
-	bool length_a = false, reverse_a = false;
-	bool cv_len_a = false, cv_rev_a = false;
-	int currentStepA = 0;
-	dsp::SchmittTrigger clockTriggerA;
-	dsp::PulseGenerator gatePulseA;
-	bool reverseA = false, lengthA = false;
-	bool reverse_a_state = false;              // Current reverse switch state (A)
-	dsp::SchmittTrigger reverse_a_cv_trigger;  // Edge detector for reverse CV (A)
-	bool manual_reverse_a = false;
-	bool length_a_state = false;               // Current length switch state (A)
-	dsp::SchmittTrigger length_a_cv_trigger;   // Edge detector for length CV (A)
-	bool manual_length_a = false;
-
-	
-	// Sequencer B state.
-	bool input_b = false;
-	bool latch_b[16];
-	bool length_b = false, reverse_b = false;
-	bool cv_len_b = false, cv_rev_b = false;
-	int currentStepB = 0;
-	dsp::SchmittTrigger clockTriggerB;
-	dsp::PulseGenerator gatePulseB;
-	bool reverseB = false, lengthB = false;
-	bool reverse_b_state = false;              // Current reverse switch state (B)
-	dsp::SchmittTrigger reverse_b_cv_trigger;  // Edge detector for reverse CV (B)
-	bool manual_reverse_b = false;
-	bool length_b_state = false;               // Current length switch state (B)
-	dsp::SchmittTrigger length_b_cv_trigger;   // Edge detector for length CV (B)
-	bool manual_length_b = false;
-	
-	int totalStepsA, totalStepsB;
-	bool latchStates[24];
-	float gateOut;
-
-	// --- Expander: input pulses from neighbor modules (TL_Reseter) -------------
-    bool resetAPulse = false;
-    bool resetBPulse = false;
+	// Per-channel wiring: A plays 4 or 8 steps, B 8 or 16 (LENGTH switch off / on). Step params and
+	// lights are contiguous in their enums, so a channel only needs its first id.
+	static constexpr int CHANNELS = 2;
+	struct ChannelIds {
+		int clock, lengthCv, reverseCv, output;
+		int length, reverse, firstStep;
+		int firstRing, firstMini, firstStepLed;
+		int steps;  // Step switches (the long length; the short one is half).
+		int swing, gateLength, ratchet;  // Menu params (no panel room).
+		int fillDensity, fillRotate, fillMutate;
+	};
+	static constexpr ChannelIds CHANNEL_IDS[CHANNELS] = {
+		{IN_STEP_1_INPUT, LENGTH_1_INPUT, REVERSE_1_INPUT, OUT_1_OUTPUT, LENGTH_1_PARAM, REVERSE_1_PARAM, STEP_A1_PARAM, LED_A1_LIGHT, MINILED_A1_LIGHT, STEP_A1_LED, 8, SWING_1_PARAM, GATE_1_PARAM, RATCHET_1_PARAM, FILL_DENSITY_1_PARAM, FILL_ROTATE_1_PARAM, FILL_MUTATE_1_PARAM},
+		{IN_STEP_2_INPUT, LENGTH_2_INPUT, REVERSE_2_INPUT, OUT_2_OUTPUT, LENGTH_2_PARAM, REVERSE_2_PARAM, STEP_B1_PARAM, LED_B1_LIGHT, MINILED_B1_LIGHT, STEP_B1_LED, 16, SWING_2_PARAM, GATE_2_PARAM, RATCHET_2_PARAM, FILL_DENSITY_2_PARAM, FILL_ROTATE_2_PARAM, FILL_MUTATE_2_PARAM},
+	};
 
-	ReseterMessage leftBuf[2];
-	ReseterMessage rightBuf[2];
+	// Sequencer state (step mask, length, direction, playheads), see helpers/step_engine.hpp. A polyphonic
+	// clock runs one playhead per channel over the same steps, with a gate output channel each; the panel
+	// shows playhead 1. Clock edges and gates are handled four channels at a time.
+	static constexpr int HEADS = StepEngine::MAX_PLAYHEADS;
+	static constexpr uint32_t ALL_HEADS = (uint32_t(1) << HEADS) - 1;
+	StepEngine::Track tracks[CHANNELS];
+	dsp::TSchmittTrigger<simd::float_4> clockTriggers[CHANNELS][HEADS / 4];
+	dsp::SchmittTrigger lengthCvTriggers[CHANNELS];   // CV edges toggle the LENGTH switch.
+	dsp::SchmittTrigger reverseCvTriggers[CHANNELS];  // CV edges toggle the REVERSE switch.
+	simd::float_4 gateTimes[CHANNELS][HEADS / 4] = {};  // Seconds left of each playhead's 1 ms gate.
 
-	// Read expander messages from left/right neighbors and convert to 1-frame pulses.
-	inline void readExpanderResets() {
-		bool a = false, b = false;
+	// Panel switches are read every PARAM_DIVISION frames, not every sample (CV toggles stay per sample).
+	static constexpr int PARAM_DIVISION = 32;
+	dsp::ClockDivider paramDivider;
+
+	// Lights are refreshed every lightDivision frames, and only those whose on/off state changed
+	// (wanted state kept as bits, bit = light id).
+	static constexpr int LIGHT_WORDS = (LIGHTS_LEN + 63) / 64;
+	int lightDivision = 256;  // Set from the menu.
+	dsp::ClockDivider lightDivider;
+	uint64_t lightsShown[LIGHT_WORDS] = {};
+
+	// Pattern bank: PATTERNS step masks per channel. The step switches edit the playing pattern; the next
+	// one (menu choice, or PATTERN CV when patched) takes over at a loop start or reset.
+	static constexpr int PATTERNS = 64;
+	uint64_t bank[CHANNELS][PATTERNS] = {};
+	StepEngine::StepLanes laneBank[CHANNELS][PATTERNS];  // Step chance / ratchet; the playing one is in the track.
+	int pattern[CHANNELS] = {};   // Playing.
+	int selected[CHANNELS] = {};  // Chosen from the menu (UI thread).
+	int pending[CHANNELS] = {};   // Next pattern, refreshed with the switches.
+
+	// Step option edits from the menu (UI thread), applied by the audio thread at its next poll to the pattern
+	// they were made for. Single producer, single consumer: each side only advances its own count.
+	struct LaneEdit {
+		uint8_t channel, pattern, step;
+		uint8_t repeats;  // 0 = chance lane, 1 = repeats lane.
+		uint8_t value;
+	};
+	static constexpr int LANE_EDITS = 64;
+	LaneEdit laneEdits[LANE_EDITS];
+	std::atomic<uint32_t> laneEditsWritten{0};
+	std::atomic<uint32_t> laneEditsRead{0};
+
+	// Length 1..MAX_STEPS from the menu (0 = LENGTH switch). Longer patterns are edited in pages: the step
+	// switches show steps page * N .. page * N + N - 1 of the mask (N = the channel's switch count).
+	int customLength[CHANNELS] = {};
+	int page[CHANNELS] = {};          // Shown on the switches.
+	int selectedPage[CHANNELS] = {};  // Chosen from the menu (UI thread).
+	bool followPage[CHANNELS] = {};   // The page follows playhead 1.
+
+	// Song mode: the pattern comes from a chain (order and loops per entry) instead of the menu or CV. The
+	// menu edits songEdits (UI thread) and flags it; the audio thread takes the copy at the next poll.
+	StepEngine::Song songs[CHANNELS];
+	bool songOn[CHANNELS] = {};
+	StepEngine::Chain songEdits[CHANNELS];
+	std::atomic<bool> songEdited[CHANNELS] = {};
+	std::atomic<bool> songCued[CHANNELS] = {};  // Song mode switched on: start at the next loop start.
+
+	// MIDI file import: a worker thread reads the file and quantizes one drum sound per channel to 16th
+	// steps, cut into patterns of the channel's length from its playing pattern on. The audio thread takes
+	// the finished masks at its next poll, all of them at once, and never frees them (the next job does).
+	struct ImportSound {
+		const char* name;
+		uint8_t keys[2];  // General MIDI drum notes (0 = none).
+	};
+	static constexpr int IMPORT_SOUNDS = 6;
+	static constexpr ImportSound IMPORT_SOUND_LIST[IMPORT_SOUNDS] = {
+		{"Kick", {35, 36}}, {"Snare", {38, 40}}, {"Clap", {39, 0}},
+		{"Closed hat", {42, 44}}, {"Open hat", {46, 0}}, {"Any note", {0, 0}},
+	};
+	struct Import {
+		int first[CHANNELS] = {};  // First pattern written.
+		int count[CHANNELS] = {};  // Patterns written.
+		uint64_t masks[CHANNELS][PATTERNS] = {};
+		Import* older = nullptr;  // Installed before this one, not freed yet.
+	};
+	int importSound[CHANNELS] = {0, 1};  // Index into IMPORT_SOUND_LIST (UI thread).
+	std::atomic<Import*> importReady{nullptr};  // Built, not yet taken by the audio thread.
+	std::atomic<Import*> importDone{nullptr};   // Installed, waiting to be freed (newest first).
+	std::mutex importMutex;  // Guards importStatus (UI and worker threads).
+	std::string importStatus;
+	std::unique_ptr<Worker> importWorker;  // Started by the first import; declared after what its jobs use.
+
+	// Timing: each playhead measures its clock period; swing, ratchets and gate length are fractions of it.
+	// Gates that are not due at once wait in a fixed-size queue per channel.
+	struct GateQueue {
+		static constexpr int CAPACITY = 128;
+		int count = 0;
+		uint32_t due[CAPACITY] = {};  // Frame (of `now` below) the gate opens on.
+		uint8_t head[CAPACITY] = {};
+		float length[CAPACITY] = {};  // Seconds.
 
-		// Read producer messages directly (ensures catching pulses even if flips are desynced).
-		if (leftExpander.module && leftExpander.module->model == modelTL_Reseter) {
-			auto* p = (ReseterMessage*) leftExpander.module->rightExpander.producerMessage;
-			if (p) { a |= p->aGate; b |= p->bGate; }
+		void push(uint32_t when, int h, float len) {
+			if (count == CAPACITY)
+				return;  // Full: the gate is dropped.
+			due[count] = when;
+			head[count] = h;
+			length[count] = len;
+			count++;
 		}
-		if (rightExpander.module && rightExpander.module->model == modelTL_Reseter) {
-			auto* p = (ReseterMessage*) rightExpander.module->leftExpander.producerMessage;
-			if (p) { a |= p->aGate; b |= p->bGate; }
+
+		// Calls open(head, length) for the gates due by `now` and takes them off the queue.
+		template <typename F>
+		void pop(uint32_t now, F open) {
+			for (int i = 0; i < count;) {
+				if ((int32_t)(due[i] - now) <= 0) {
+					open(head[i], length[i]);
+					remove(i);
+				}
+				else {
+					i++;
+				}
+			}
 		}
 
-		// Also read my consumer messages and request a flip (official expander path).
-		if (leftExpander.module && leftExpander.module->model == modelTL_Reseter) {
-			auto* c = (ReseterMessage*) leftExpander.consumerMessage;
-			a |= c->aGate;
-			b |= c->bGate;
-			leftExpander.requestMessageFlip();
-		} else {
-			((ReseterMessage*) leftExpander.consumerMessage)->aGate = false;
-			((ReseterMessage*) leftExpander.consumerMessage)->bGate = false;
+		// Forget the gates of the given playheads (bit per head).
+		void drop(uint32_t heads) {
+			for (int i = 0; i < count;) {
+				if ((heads >> head[i]) & 1)
+					remove(i);
+				else
+					i++;
+			}
 		}
 
-		if (rightExpander.module && rightExpander.module->model == modelTL_Reseter) {
-			auto* c = (ReseterMessage*) rightExpander.consumerMessage;
-			a |= c->aGate;
-			b |= c->bGate;
-			rightExpander.requestMessageFlip();
-		} else {
-			((ReseterMessage*) rightExpander.consumerMessage)->aGate = false;
-			((ReseterMessage*) rightExpander.consumerMessage)->bGate = false;
+		void remove(int i) {
+			count--;
+			due[i] = due[count];
+			head[i] = head[count];
+			length[i] = length[count];
 		}
+	};
+	static constexpr int MAX_RATCHET = StepEngine::MAX_REPEATS;
+	StepEngine::PeriodTracker periods[CHANNELS][HEADS];
+	GateQueue gateQueues[CHANNELS];
+	uint32_t now = 0;  // Frames since start (wraps).
+
+	// Fill: a Euclidean rhythm (density, rotation) with some steps flipped (mutation), written into the
+	// playing pattern. While on, it is rewritten on every clock of playhead 1, so FILL CV acts at once.
+	bool fillOn[CHANNELS] = {};
+	bool fillRequest[CHANNELS] = {};    // One-off fill from the menu (UI thread).
+	uint64_t fillFlips[CHANNELS] = {};  // Steps flipped by mutation, redrawn at playhead 1's loop start.
+
+	// Random draws (step chance, fill mutation), one generator per channel. The seed is saved with the patch
+	// and a reset of playhead 1 restarts the channel's draws, so a performance can be replayed.
+	uint32_t seed = random::u32();
+	DSPUtils::Rng rngs[CHANNELS];
+
+	// --- Expander: reset counts from neighbor modules (TL_Reseter) -------------
+	// A TL_Reseter writes into these buffers (see helpers/messages.hpp); resets come out as playhead bits,
+	// a channel-wide reset setting them all.
+	uint32_t resetPulses[CHANNELS] = {};
+
+	ReseterMessage leftBuf[2];
+	ReseterMessage rightBuf[2];
+	ReseterReceiver leftReceiver;
+	ReseterReceiver rightReceiver;
 
-		// Convert combined levels into single-frame pulses.
-		resetAPulse = resetATrigger.process(a);
-		resetBPulse = resetBTrigger.process(b);
+	// Resets in the messages that arrived since the last frame (own consumer buffers only).
+	inline void readExpanderResets() {
+		resetPulses[0] = resetPulses[1] = 0;
+		leftReceiver.take(*(const ReseterMessage*) leftExpander.consumerMessage, resetPulses);
+		rightReceiver.take(*(const ReseterMessage*) rightExpander.consumerMessage, resetPulses);
 	}
 
 
@@ -244,7 +360,7 @@ struct TL_Seq4 : Module {
 		static const std::vector<std::string> steps_labels_a = {"4", "8"};
 		configSwitch(LENGTH_1_PARAM, 0.f, 1.f, 0.f, "Steps", steps_labels_a);
 		configSwitch(REVERSE_1_PARAM, 0.f, 1.f, 0.f, "Reverse", on_off_labels);
-		configInput(IN_STEP_1_INPUT, "Trigger A");
+		configInput(IN_STEP_1_INPUT, "Trigger A (poly: one playhead per channel)");
 		configInput(LENGTH_1_INPUT, "CV Steps");
 		configInput(REVERSE_1_INPUT, "CV Reverse");
 		
@@ -263,7 +379,7 @@ struct TL_Seq4 : Module {
 		static const std::vector<std::string> steps_labels_b = {"8", "16"};
 		configSwitch(LENGTH_2_PARAM, 0.f, 1.f, 0.f, "Steps", steps_labels_b);
 		configSwitch(REVERSE_2_PARAM, 0.f, 1.f, 0.f, "Reverse", on_off_labels);
-		configInput(IN_STEP_2_INPUT, "Trigger B");
+		configInput(IN_STEP_2_INPUT, "Trigger B (poly: one playhead per channel)");
 		configInput(LENGTH_2_INPUT, "CV Steps");
 		configInput(REVERSE_2_INPUT, "CV Reverse");
 		
@@ -286,6 +402,27 @@ struct TL_Seq4 : Module {
 			
 		configOutput(OUT_2_OUTPUT, "Seq B");
 
+		configInput(PATTERN_INPUT, "Pattern (1/12 V per pattern; poly: A, B)");
+
+		static const char* timingNames[CHANNELS] = {"A", "B"};
+		for (int c = 0; c < CHANNELS; c++) {
+			const ChannelIds& id = CHANNEL_IDS[c];
+			std::string name = timingNames[c];
+			configParam(id.swing, 0.f, 50.f, 0.f, name + " swing", "% of clock");
+			configParam(id.gateLength, 0.f, 95.f, 0.f, name + " gate length (0 = 1 ms trigger)", "% of step");
+			configParam(id.ratchet, 1.f, MAX_RATCHET, 1.f, name + " ratchet", "x")->snapEnabled = true;
+			configParam(id.fillDensity, 0.f, 100.f, 50.f, name + " fill density", "%");
+			configParam(id.fillRotate, 0.f, StepEngine::MAX_STEPS - 1, 0.f, name + " fill rotation", " steps")->snapEnabled = true;
+			configParam(id.fillMutate, 0.f, 100.f, 0.f, name + " fill mutation", "%");
+		}
+		configInput(FILL_INPUT, "Fill density (10 V = 100 %; poly: A, B)");
+		reseed();
+		StepEngine::euclid(0, 1);  // Builds the fill table here rather than on the first fill.
+
+		paramDivider.setDivision(PARAM_DIVISION);
+		paramDivider.clock = PARAM_DIVISION - 1;  // Poll on the first frame.
+		lightDivider.setDivision(lightDivision);
+
 		// Expander: assign message buffers for this module.
 		leftExpander.producerMessage  = &leftBuf[0];
 		leftExpander.consumerMessage  = &leftBuf[1];
@@ -293,209 +430,577 @@ struct TL_Seq4 : Module {
 		rightExpander.consumerMessage = &rightBuf[1];
 	}
 
-// --------------------   Helpers (LEDs / inputs / indicators)  ------------------
-	// Write latched step LEDs for both sequencers (A: 8, B: 16).
-	void setStepsLeds(Module* module, const bool latch_a[], int len_a, const bool latch_b[], int len_b) {
-		const int stepLEDs[] = {
-			STEP_A1_LED, STEP_A2_LED, STEP_A3_LED, STEP_A4_LED, STEP_A5_LED, STEP_A6_LED, STEP_A7_LED, STEP_A8_LED,
-			STEP_B1_LED, STEP_B2_LED, STEP_B3_LED, STEP_B4_LED, STEP_B5_LED, STEP_B6_LED, STEP_B7_LED, STEP_B8_LED,
-			STEP_B9_LED, STEP_B10_LED, STEP_B11_LED, STEP_B12_LED, STEP_B13_LED, STEP_B14_LED, STEP_B15_LED, STEP_B16_LED,
-		};
+	~TL_Seq4() {
+		importWorker.reset();  // Joins a running import before its results are freed.
+		delete importReady.load();
+		freeImports(importDone.load());
+	}
 
-		// A latch LEDs (8)
-		for (int i = 0; i < len_a; ++i) {
-			module->lights[stepLEDs[i]].setBrightness(latch_a[i] ? 1.0f : 0.0f);
+// --------------------   Helpers (LEDs / inputs / indicators)  ------------------
+	// Read the panel switches into the tracks (step mask, length, direction) and pick the next pattern.
+	void pollSwitches() {
+		bool patternCv = inputs[PATTERN_INPUT].isConnected();
+		applyLaneEdits();
+		if (Import* in = importReady.exchange(nullptr)) {
+			installImport(*in);
+			// Linked before it is published: the worker may take the whole list at any moment.
+			in->older = importDone.load();
+			while (!importDone.compare_exchange_weak(in->older, in)) {}
 		}
-		// B latch LEDs (16)
-		for (int i = 0; i < len_b; ++i) {
-			module->lights[stepLEDs[len_a + i]].setBrightness(latch_b[i] ? 1.0f : 0.0f);
+		for (int c = 0; c < CHANNELS; c++) {
+			const ChannelIds& id = CHANNEL_IDS[c];
+			readSteps(c);
+			if (followPage[c])
+				selectedPage[c] = tracks[c].current[0] / id.steps;
+			if (selectedPage[c] != page[c]) {
+				page[c] = selectedPage[c];
+				showSteps(c);
+			}
+			tracks[c].setLength(lengthFor(c));
+			tracks[c].reverse = params[id.reverse].getValue() == 1.f;
+			if (fillRequest[c]) {
+				fillRequest[c] = false;
+				drawFlips(c);
+				applyFill(c);
+			}
+
+			if (songEdited[c].exchange(false)) {
+				songs[c].chain = songEdits[c];
+				if (songs[c].position >= songs[c].chain.length)
+					songs[c].cue();
+				if (songOn[c])
+					stageSong(c);
+			}
+			if (songCued[c].exchange(false)) {
+				songs[c].cue();
+				stageSong(c);
+			}
+			if (songOn[c])
+				continue;  // The chain picks the patterns.
+
+			pending[c] = patternCv ? clamp((int)std::round(inputs[PATTERN_INPUT].getPolyVoltage(c) * 12.f), 0, PATTERNS - 1) : selected[c];
+			// Without a clock there is no loop boundary to wait for: switch at once (editing while stopped).
+			if (pending[c] != pattern[c] && !inputs[id.clock].isConnected())
+				switchPattern(c);
 		}
 	}
-	
-	// Read user controls and CVs, update derived states (length/reverse toggles, clocks).
-	void updateAllInputStates() {
-		// A steps (8 toggles)
-		ParamId stepsParamsA[] = {
-			STEP_A1_PARAM, STEP_A2_PARAM, STEP_A3_PARAM, STEP_A4_PARAM,
-			STEP_A5_PARAM, STEP_A6_PARAM, STEP_A7_PARAM, STEP_A8_PARAM
-		};
 
-		for (int i = 0; i < 8; i++) {
-			latch_a[i] = params[stepsParamsA[i]].getValue() == 1.0f;
+	// Queue a step option edit of one pattern (UI thread). Dropped when the queue is full (module bypassed).
+	void editLane(int c, int p, int step, bool repeats, int value) {
+		uint32_t written = laneEditsWritten.load(std::memory_order_relaxed);
+		if (written - laneEditsRead.load(std::memory_order_acquire) >= LANE_EDITS)
+			return;
+		laneEdits[written % LANE_EDITS] = {(uint8_t)c, (uint8_t)p, (uint8_t)step, (uint8_t)repeats, (uint8_t)value};
+		laneEditsWritten.store(written + 1, std::memory_order_release);
+	}
+
+	void applyLaneEdits() {
+		uint32_t written = laneEditsWritten.load(std::memory_order_acquire);
+		uint32_t read = laneEditsRead.load(std::memory_order_relaxed);
+		for (; read != written; read++) {
+			const LaneEdit& e = laneEdits[read % LANE_EDITS];
+			StepEngine::StepLanes& lanes = (e.pattern == pattern[e.channel]) ? tracks[e.channel].lanes : laneBank[e.channel][e.pattern];
+			(e.repeats ? lanes.repeats : lanes.chance).set(e.step, e.value);
 		}
+		laneEditsRead.store(read, std::memory_order_release);
+	}
 
-		input_a   = inputs[IN_STEP_1_INPUT].getVoltage() >= 1.0f;
-		
-		// A length (CV edge toggles switch)
-		length_a  = params[LENGTH_1_PARAM].getValue() == 1.0f;
-		cv_len_a  = inputs[LENGTH_1_INPUT].getVoltage() >= 1.0f;
-		if (length_a_state != length_a) {
-			length_a_state = length_a;
+	// Pattern for the song's next boundary (the playing one until the entry's last loop).
+	void stageSong(int c) {
+		int next = songs[c].staged();
+		pending[c] = (next >= 0) ? next : pattern[c];
+	}
+
+	int lengthFor(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		if (customLength[c])
+			return customLength[c];
+		return params[id.length].getValue() == 1.f ? id.steps : id.steps / 2;
+	}
+
+	// Step switches into the shown page of the playing pattern.
+	void readSteps(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		int first = page[c] * id.steps;
+		uint64_t steps = tracks[c].steps & ~(StepEngine::lengthMask(id.steps) << first);
+		for (int i = 0; i < id.steps; i++)
+			if (params[id.firstStep + i].getValue() == 1.f)
+				steps |= StepEngine::stepBit(first + i);
+		tracks[c].steps = steps;
+		bank[c][pattern[c]] = steps;
+	}
+
+	// Shown page of the track onto the step switches.
+	void showSteps(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		int first = page[c] * id.steps;
+		for (int i = 0; i < id.steps; i++)
+			params[id.firstStep + i].setValue(tracks[c].isOn(first + i) ? 1.f : 0.f);
+	}
+
+	// Store the playing pattern (switches read fresh) and load the pending one into the track and switches.
+	void switchPattern(int c) {
+		readSteps(c);
+		laneBank[c][pattern[c]] = tracks[c].lanes;
+		pattern[c] = pending[c];
+		tracks[c].steps = bank[c][pattern[c]];
+		tracks[c].lanes = laneBank[c][pattern[c]];
+		showSteps(c);
+	}
+
+	// Queue a MIDI file import (UI thread). Patterns are cut at the lengths and start at the patterns
+	// playing now.
+	void importFile(const std::string& path) {
+		Import* in = new Import;
+		int lengths[CHANNELS], sounds[CHANNELS];
+		for (int c = 0; c < CHANNELS; c++) {
+			in->first[c] = pattern[c];
+			lengths[c] = tracks[c].length;
+			sounds[c] = importSound[c];
 		}
-		if (length_a_cv_trigger.process(inputs[LENGTH_1_INPUT].getVoltage())) {
-			length_a_state = !length_a_state;
+		setImportStatus("Reading " + system::getFilename(path) + "...");
+		if (!importWorker)
+			importWorker.reset(new Worker);
+		importWorker->push([=]() {
+			freeImports(importDone.exchange(nullptr));
+			std::vector<MidiFile::Note> notes;
+			int ticksPerQuarter = 0;
+			if (!MidiFile::loadNotes(path, notes, ticksPerQuarter)) {
+				delete in;
+				setImportStatus("Not a readable MIDI file");
+				return;
+			}
+			double ticksPerStep = ticksPerQuarter / 4.0;  // 16th notes.
+			for (int c = 0; c < CHANNELS; c++) {
+				const ImportSound& sound = IMPORT_SOUND_LIST[sounds[c]];
+				bool any = !sound.keys[0];
+				for (const MidiFile::Note& note : notes) {
+					if (!any && note.key != sound.keys[0] && note.key != sound.keys[1])
+						continue;
+					int64_t step = std::llround(note.tick / ticksPerStep);
+					int64_t p = step / lengths[c];
+					if (in->first[c] + p >= PATTERNS)
+						break;  // Notes are sorted: the rest don't fit either.
+					in->masks[c][in->first[c] + p] |= StepEngine::stepBit(step % lengths[c]);
+					in->count[c] = std::max(in->count[c], (int)p + 1);
+				}
+			}
+			setImportStatus(string::f("A: %d, B: %d patterns from %s", in->count[0], in->count[1], system::getFilename(path).c_str()));
+			delete importReady.exchange(in);  // One the audio thread has not taken yet is replaced.
+		});
+	}
+
+	static void freeImports(Import* in) {
+		while (in) {
+			Import* older = in->older;
+			delete in;
+			in = older;
 		}
-		
-		// Reflect current logical state in the visual switch.
-		params[LENGTH_1_PARAM].setValue(length_a_state ? 1.0f : 0.0f);
-		lengthA = length_a_state;
+	}
+
+	void setImportStatus(const std::string& status) {
+		std::lock_guard<std::mutex> lock(importMutex);
+		importStatus = status;
+	}
+
+	std::string getImportStatus() {
+		std::lock_guard<std::mutex> lock(importMutex);
+		return importStatus;
+	}
 
+	// Imported masks into the bank; the playing pattern is reloaded when it was written. Imported patterns
+	// get default step options.
+	void installImport(const Import& in) {
+		for (int c = 0; c < CHANNELS; c++) {
+			if (!in.count[c])
+				continue;
+			readSteps(c);
+			laneBank[c][pattern[c]] = tracks[c].lanes;
+			for (int p = in.first[c]; p < in.first[c] + in.count[c]; p++) {
+				bank[c][p] = in.masks[c][p];
+				laneBank[c][p] = StepEngine::StepLanes();
+			}
+			tracks[c].steps = bank[c][pattern[c]];
+			tracks[c].lanes = laneBank[c][pattern[c]];
+			showSteps(c);
+		}
+	}
 
-		// A reverse (CV edge toggles switch)
-		reverse_a = params[REVERSE_1_PARAM].getValue() == 1.0f;
-		cv_rev_a  = inputs[REVERSE_1_INPUT].getVoltage() >= 1.0f;
-		if (reverse_a_state != reverse_a) {
-			reverse_a_state = reverse_a;
+	// CV rising edges flip the LENGTH / REVERSE switches; the track follows at once (LENGTH only while no
+	// length is set from the menu).
+	void processToggles(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		if (lengthCvTriggers[c].process(inputs[id.lengthCv].getVoltage())) {
+			params[id.length].setValue(params[id.length].getValue() != 1.f ? 1.f : 0.f);
+			tracks[c].setLength(lengthFor(c));
 		}
-		if (reverse_a_cv_trigger.process(inputs[REVERSE_1_INPUT].getVoltage())) {
-			reverse_a_state = !reverse_a_state;
+		if (reverseCvTriggers[c].process(inputs[id.reverseCv].getVoltage())) {
+			bool reverse = params[id.reverse].getValue() != 1.f;
+			params[id.reverse].setValue(reverse ? 1.f : 0.f);
+			tracks[c].reverse = reverse;
 		}
-		
-		// Reflect current logical state in the visual switch.
-		params[REVERSE_1_PARAM].setValue(reverse_a_state ? 1.0f : 0.0f);
-		reverseA = reverse_a_state;
+	}
 
-		// B steps (16 toggles)
-		ParamId stepsParamsB[] = {
-			STEP_B1_PARAM, STEP_B2_PARAM, STEP_B3_PARAM, STEP_B4_PARAM,
-			STEP_B5_PARAM, STEP_B6_PARAM, STEP_B7_PARAM, STEP_B8_PARAM,
-			STEP_B9_PARAM, STEP_B10_PARAM, STEP_B11_PARAM, STEP_B12_PARAM,
-			STEP_B13_PARAM, STEP_B14_PARAM, STEP_B15_PARAM, STEP_B16_PARAM
-		};
+	// Steps flipped by the mutation amount: up to half of the played steps at 100 %.
+	void drawFlips(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		int n = tracks[c].length;
+		int count = (int)std::round(params[id.fillMutate].getValue() / 100.f * n / 2);
+		uint64_t flips = 0;
+		for (int i = 0; i < count; i++)
+			flips |= StepEngine::stepBit(rngs[c].next() % n);
+		fillFlips[c] = flips;
+	}
 
-		for (int i = 0; i < 16; i++) {
-			latch_b[i] = params[stepsParamsB[i]].getValue() == 1.0f;
-		}
+	// Fill into the played steps of the playing pattern (steps past the length keep their state).
+	void applyFill(int c) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		StepEngine::Track& track = tracks[c];
+		float density = params[id.fillDensity].getValue() / 100.f;
+		if (inputs[FILL_INPUT].isConnected())
+			density += inputs[FILL_INPUT].getPolyVoltage(c) / 10.f;
+		uint64_t played = StepEngine::lengthMask(track.length);
+		uint64_t filled = StepEngine::fill(density, (int)params[id.fillRotate].getValue(), track.length) ^ fillFlips[c];
+		uint64_t steps = (track.steps & ~played) | (filled & played);
+		if (steps == track.steps)
+			return;
+		track.steps = steps;
+		bank[c][pattern[c]] = steps;
+		showSteps(c);
+	}
 
-		input_b   = inputs[IN_STEP_2_INPUT].getVoltage() >= 1.0f;
+	void reseed(int c) {
+		rngs[c].seed(seed + c * 0x9E3779B9u);
+	}
 
-		// B length (CV edge toggles switch)
-		length_b  = params[LENGTH_2_PARAM].getValue() == 1.0f;
-		cv_len_b  = inputs[LENGTH_2_INPUT].getVoltage() >= 1.0f;
-		if (length_b_state != length_b) {
-			length_b_state = length_b;
-		}
-		if (length_b_cv_trigger.process(inputs[LENGTH_2_INPUT].getVoltage())) {
-			length_b_state = !length_b_state;
+	void reseed() {
+		for (int c = 0; c < CHANNELS; c++)
+			reseed(c);
+	}
+
+	// A step with a chance below 100 % fires on a draw (one per playhead that lands on it).
+	bool chanceFires(int c, int step) {
+		int chance = tracks[c].lanes.chance.get(step);
+		return chance == 0 || (int)(rngs[c].next() >> 29) < StepEngine::CHANCE_LEVELS - chance;
+	}
+
+	// Gates for a step that fires on playhead i: evenly spaced repeats (the step's ratchet, else the
+	// channel's), odd steps late by the swing amount, each open for the gate length. Until two clocks have
+	// set the period it is one 1 ms trigger at once, as is the default setting. Times are rounded per
+	// repeat, so the spacing does not drift.
+	void scheduleGates(int c, int i, float sampleTime) {
+		const ChannelIds& id = CHANNEL_IDS[c];
+		float period = (float)periods[c][i].period();
+		int repeats = tracks[c].lanes.repeats.get(tracks[c].current[i]);
+		int ratchet = (period > 0.f) ? (repeats ? repeats : (int)params[id.ratchet].getValue()) : 1;
+		float delay = (tracks[c].current[i] & 1) ? params[id.swing].getValue() / 100.f * period : 0.f;
+		float spacing = (period - delay) / ratchet;  // Repeats fit in what is left of the step.
+		float gate = params[id.gateLength].getValue() / 100.f * spacing * sampleTime;
+		float length = (gate > 0.f) ? std::max(gate, sampleTime) : 1e-3f;
+		for (int k = 0; k < ratchet; k++) {
+			uint32_t frames = (uint32_t)std::round(delay + k * spacing);
+			if (frames == 0)
+				openGate(c, i, length);
+			else
+				gateQueues[c].push(now + frames, i, length);
 		}
-		
-		// Reflect current logical state in the visual switch.
-		params[LENGTH_2_PARAM].setValue(length_b_state ? 1.0f : 0.0f);
-		lengthB = length_b_state;
-
-		// B reverse (CV edge toggles switch)
-		reverse_b = params[REVERSE_2_PARAM].getValue() == 1.0f;
-		cv_rev_b  = inputs[REVERSE_2_INPUT].getVoltage() >= 1.0f;
-		if (reverse_b_state != reverse_b) {
-			reverse_b_state = reverse_b;
-		}
-		if (reverse_b_cv_trigger.process(inputs[REVERSE_2_INPUT].getVoltage())) {
-			reverse_b_state = !reverse_b_state;
-		}
-		params[REVERSE_2_PARAM].setValue(reverse_b_state ? 1.0f : 0.0f);
-		reverseB = reverse_b_state;
-
-	}
-
-	// Update both step indicator rings (current step highlight).
-	void updateLedRings(const int currentSteps[2]) {
-		const int ledLeds[2][16] = {
-			{
-				LED_A1_LIGHT, LED_A2_LIGHT, LED_A3_LIGHT, LED_A4_LIGHT,
-				LED_A5_LIGHT, LED_A6_LIGHT, LED_A7_LIGHT, LED_A8_LIGHT
-			},
-			{
-				LED_B1_LIGHT, LED_B2_LIGHT, LED_B3_LIGHT, LED_B4_LIGHT,
-				LED_B5_LIGHT, LED_B6_LIGHT, LED_B7_LIGHT, LED_B8_LIGHT,
-				LED_B9_LIGHT, LED_B10_LIGHT, LED_B11_LIGHT, LED_B12_LIGHT,
-				LED_B13_LIGHT, LED_B14_LIGHT, LED_B15_LIGHT, LED_B16_LIGHT
+	}
+
+	void openGate(int c, int i, float length) {
+		float& time = gateTimes[c][i / 4][i % 4];
+		time = std::max(time, length);
+	}
+
+	// Wanted light states: step latch LEDs follow the shown page of the step masks, ring and mini LEDs mark the playheads.
+	// Only the lights that changed since the last refresh are written.
+	void updateLights() {
+		uint64_t lit[LIGHT_WORDS] = {};
+		auto set = [&](int light) { lit[light / 64] |= uint64_t(1) << (light % 64); };
+		for (int c = 0; c < CHANNELS; c++) {
+			const ChannelIds& id = CHANNEL_IDS[c];
+			int first = page[c] * id.steps;
+			for (int i = 0; i < id.steps; i++)
+				if (tracks[c].isOn(first + i))
+					set(id.firstStepLed + i);
+			int current = tracks[c].current[0] - first;
+			if (current >= 0 && current < id.steps) {
+				set(id.firstRing + current);
+				set(id.firstMini + current);
 			}
-		};
-
-		const int miniLeds[2][16] = {
-			{
-				MINILED_A1_LIGHT, MINILED_A2_LIGHT, MINILED_A3_LIGHT, MINILED_A4_LIGHT,
-				MINILED_A5_LIGHT, MINILED_A6_LIGHT, MINILED_A7_LIGHT, MINILED_A8_LIGHT
-			},
-			{
-				MINILED_B1_LIGHT, MINILED_B2_LIGHT, MINILED_B3_LIGHT, MINILED_B4_LIGHT,
-				MINILED_B5_LIGHT, MINILED_B6_LIGHT, MINILED_B7_LIGHT, MINILED_B8_LIGHT,
-				MINILED_B9_LIGHT, MINILED_B10_LIGHT, MINILED_B11_LIGHT, MINILED_B12_LIGHT,
-				MINILED_B13_LIGHT, MINILED_B14_LIGHT, MINILED_B15_LIGHT, MINILED_B16_LIGHT
+		}
+
+		for (int w = 0; w < LIGHT_WORDS; w++) {
+			for (uint64_t changed = lit[w] ^ lightsShown[w]; changed; changed &= changed - 1) {
+				int bit = __builtin_ctzll(changed);
+				lights[w * 64 + bit].setBrightness((lit[w] >> bit) & 1 ? 1.f : 0.f);
 			}
-		};
+			lightsShown[w] = lit[w];
+		}
+	}
 
-		const int totalSteps[2] = {8, 16};
+	// Pattern bank as packed step masks (one integer per pattern), playing pattern per channel.
+	json_t* dataToJson() override {
+		json_t* rootJ = json_object();
+		json_object_set_new(rootJ, "lightDivision", json_integer(lightDivision));
+		json_t* bankJ = json_array();
+		json_t* patternJ = json_array();
+		for (int c = 0; c < CHANNELS; c++) {
+			json_t* masksJ = json_array();
+			for (int p = 0; p < PATTERNS; p++)
+				json_array_append_new(masksJ, json_integer((json_int_t)bank[c][p]));
+			json_array_append_new(bankJ, masksJ);
+			json_array_append_new(patternJ, json_integer(pattern[c]));
+		}
+		json_object_set_new(rootJ, "bank", bankJ);
+		json_object_set_new(rootJ, "pattern", patternJ);
+		json_t* fillJ = json_array();
+		for (int c = 0; c < CHANNELS; c++)
+			json_array_append_new(fillJ, json_boolean(fillOn[c]));
+		json_object_set_new(rootJ, "fill", fillJ);
+		json_t* lengthJ = json_array();
+		json_t* pageJ = json_array();
+		json_t* followJ = json_array();
+		for (int c = 0; c < CHANNELS; c++) {
+			json_array_append_new(lengthJ, json_integer(customLength[c]));
+			json_array_append_new(pageJ, json_integer(page[c]));
+			json_array_append_new(followJ, json_boolean(followPage[c]));
+		}
+		json_object_set_new(rootJ, "length", lengthJ);
+		json_object_set_new(rootJ, "page", pageJ);
+		json_object_set_new(rootJ, "followPage", followJ);
+
+		// Step lanes per pattern: the chance words, then the ratchet words.
+		json_t* lanesJ = json_array();
+		for (int c = 0; c < CHANNELS; c++) {
+			json_t* patternsJ = json_array();
+			for (int p = 0; p < PATTERNS; p++) {
+				const StepEngine::StepLanes& lanes = (p == pattern[c]) ? tracks[c].lanes : laneBank[c][p];
+				json_t* wordsJ = json_array();
+				for (uint64_t word : lanes.chance.words)
+					json_array_append_new(wordsJ, json_integer((json_int_t)word));
+				for (uint64_t word : lanes.repeats.words)
+					json_array_append_new(wordsJ, json_integer((json_int_t)word));
+				json_array_append_new(patternsJ, wordsJ);
+			}
+			json_array_append_new(lanesJ, patternsJ);
+		}
+		json_object_set_new(rootJ, "lanes", lanesJ);
+		json_object_set_new(rootJ, "seed", json_integer(seed));
 
-		for (int seq = 0; seq < 2; ++seq) {
-			for (int i = 0; i < totalSteps[seq]; ++i) {
-				bool active = (i == currentSteps[seq]);
-				lights[ledLeds[seq][i]].setBrightness(active ? 1.f : 0.f);
-				lights[miniLeds[seq][i]].setBrightness(active ? 1.f : 0.f);
+		// Song chains: [pattern, loops] per entry.
+		json_t* songJ = json_array();
+		for (int c = 0; c < CHANNELS; c++) {
+			const StepEngine::Chain& chain = songEdits[c];
+			json_t* channelJ = json_object();
+			json_t* entriesJ = json_array();
+			for (int i = 0; i < chain.length; i++) {
+				json_t* entryJ = json_array();
+				json_array_append_new(entryJ, json_integer(chain.pattern[i]));
+				json_array_append_new(entryJ, json_integer(chain.loops[i]));
+				json_array_append_new(entriesJ, entryJ);
 			}
+			json_object_set_new(channelJ, "on", json_boolean(songOn[c]));
+			json_object_set_new(channelJ, "entries", entriesJ);
+			json_array_append_new(songJ, channelJ);
 		}
+		json_object_set_new(rootJ, "song", songJ);
+
+		json_t* importJ = json_array();
+		for (int c = 0; c < CHANNELS; c++)
+			json_array_append_new(importJ, json_integer(importSound[c]));
+		json_object_set_new(rootJ, "importSound", importJ);
+		return rootJ;
 	}
 
-// --------------------   Audio/logic process loop  ------------------------------
-	void process(const ProcessArgs& args) override {
+	// Params (the playing pattern's switches) are already loaded when this runs.
+	void dataFromJson(json_t* rootJ) override {
+		json_t* lightDivisionJ = json_object_get(rootJ, "lightDivision");
+		if (lightDivisionJ)
+			setLightDivision(clamp((int)json_integer_value(lightDivisionJ), 1, 4096));
 
-		updateAllInputStates();                 // Pull inputs & update internal states
-		setStepsLeds(this, latch_a, 8, latch_b, 16);  // Write step latch LEDs
-		readExpanderResets();                   // Handle expander reset pulses
+		json_t* bankJ = json_object_get(rootJ, "bank");
+		json_t* patternJ = json_object_get(rootJ, "pattern");
+		for (int c = 0; c < CHANNELS; c++) {
+			json_t* masksJ = bankJ ? json_array_get(bankJ, c) : nullptr;
+			for (int p = 0; p < PATTERNS && masksJ; p++) {
+				json_t* maskJ = json_array_get(masksJ, p);
+				if (maskJ)
+					bank[c][p] = (uint64_t)json_integer_value(maskJ);
+			}
+			json_t* indexJ = patternJ ? json_array_get(patternJ, c) : nullptr;
+			if (indexJ)
+				pattern[c] = selected[c] = pending[c] = clamp((int)json_integer_value(indexJ), 0, PATTERNS - 1);
+			tracks[c].steps = bank[c][pattern[c]];  // Steps off the shown page (the switches only hold one page).
+		}
 
-		// --- Sequencer A ---
-		totalStepsA = lengthA ? 8 : 4;
-		if (resetAPulse) {
-			gatePulseA.reset();
-			currentStepA = reverseA ? (totalStepsA - 1) : 0;
+		json_t* fillJ = json_object_get(rootJ, "fill");
+		for (int c = 0; c < CHANNELS && fillJ; c++) {
+			json_t* onJ = json_array_get(fillJ, c);
+			if (onJ)
+				fillOn[c] = json_boolean_value(onJ);
 		}
-		
-		if (clockTriggerA.process(input_a)) {
-			if (reverseA) {
-				currentStepA = (currentStepA - 1 + totalStepsA) % totalStepsA;
-			} else {
-				currentStepA = (currentStepA + 1) % totalStepsA;
+
+		// The step switches were saved showing `page`.
+		json_t* lengthJ = json_object_get(rootJ, "length");
+		json_t* pageJ = json_object_get(rootJ, "page");
+		json_t* followJ = json_object_get(rootJ, "followPage");
+		for (int c = 0; c < CHANNELS; c++) {
+			json_t* valueJ = lengthJ ? json_array_get(lengthJ, c) : nullptr;
+			if (valueJ)
+				customLength[c] = clamp((int)json_integer_value(valueJ), 0, StepEngine::MAX_STEPS);
+			valueJ = pageJ ? json_array_get(pageJ, c) : nullptr;
+			if (valueJ)
+				page[c] = selectedPage[c] = clamp((int)json_integer_value(valueJ), 0, StepEngine::MAX_STEPS / CHANNEL_IDS[c].steps - 1);
+			valueJ = followJ ? json_array_get(followJ, c) : nullptr;
+			if (valueJ)
+				followPage[c] = json_boolean_value(valueJ);
+		}
+
+		json_t* lanesJ = json_object_get(rootJ, "lanes");
+		for (int c = 0; c < CHANNELS && lanesJ; c++) {
+			json_t* patternsJ = json_array_get(lanesJ, c);
+			for (int p = 0; p < PATTERNS && patternsJ; p++) {
+				json_t* wordsJ = json_array_get(patternsJ, p);
+				if (!wordsJ)
+					continue;
+				StepEngine::StepLanes& lanes = laneBank[c][p];
+				const int words = StepEngine::MAX_STEPS / 16;
+				for (int w = 0; w < words; w++) {
+					lanes.chance.words[w] = (uint64_t)json_integer_value(json_array_get(wordsJ, w));
+					lanes.repeats.words[w] = (uint64_t)json_integer_value(json_array_get(wordsJ, words + w));
+				}
 			}
-			
-			if (latch_a[currentStepA]) {
-				gatePulseA.trigger(1e-3f); // 1 ms pulse
+			tracks[c].lanes = laneBank[c][pattern[c]];
+		}
+
+		json_t* seedJ = json_object_get(rootJ, "seed");
+		if (seedJ) {
+			seed = (uint32_t)json_integer_value(seedJ);
+			reseed();
+		}
+
+		// A song starts at the first loop start after loading.
+		json_t* songJ = json_object_get(rootJ, "song");
+		for (int c = 0; c < CHANNELS && songJ; c++) {
+			json_t* channelJ = json_array_get(songJ, c);
+			if (!channelJ)
+				continue;
+			StepEngine::Chain chain;
+			json_t* entriesJ = json_object_get(channelJ, "entries");
+			int maxEntries = StepEngine::Chain::MAX_ENTRIES;  // A copy: std::min's references would need a definition in C++11.
+			int entries = entriesJ ? std::min((int)json_array_size(entriesJ), maxEntries) : 0;
+			for (int i = 0; i < entries; i++) {
+				json_t* entryJ = json_array_get(entriesJ, i);
+				chain.pattern[i] = clamp((int)json_integer_value(json_array_get(entryJ, 0)), 0, PATTERNS - 1);
+				chain.loops[i] = clamp((int)json_integer_value(json_array_get(entryJ, 1)), 1, StepEngine::Chain::MAX_LOOPS);
 			}
+			chain.length = std::max(entries, 1);
+			chain.link();
+			songEdits[c] = songs[c].chain = chain;
+			songOn[c] = json_boolean_value(json_object_get(channelJ, "on"));
+			songs[c].cue();
+			if (songOn[c])
+				stageSong(c);
 		}
-		
-		// A gate out
-		float gateOutA = gatePulseA.process(args.sampleTime) ? 10.f : 0.f;
-		outputs[OUT_1_OUTPUT].setVoltage(gateOutA);
 
-		
-		// --- Sequencer B ---
-		totalStepsB = lengthB ? 16 : 8;
-		if (resetBPulse) {
-			gatePulseB.reset();
-			currentStepB = reverseB ? (totalStepsB - 1) : 0;
+		json_t* importJ = json_object_get(rootJ, "importSound");
+		for (int c = 0; c < CHANNELS && importJ; c++) {
+			json_t* soundJ = json_array_get(importJ, c);
+			if (soundJ)
+				importSound[c] = clamp((int)json_integer_value(soundJ), 0, IMPORT_SOUNDS - 1);
 		}
-		
-		if (clockTriggerB.process(input_b)) {
-			if (reverseB) {
-				currentStepB = (currentStepB - 1 + totalStepsB) % totalStepsB;
-			} else {
-				currentStepB = (currentStepB + 1) % totalStepsB;
+	}
+
+	void setLightDivision(int division) {
+		lightDivision = division;
+		lightDivider.setDivision(division);
+	}
+
+// --------------------   Audio/logic process loop  ------------------------------
+	void process(const ProcessArgs& args) override {
+		if (paramDivider.process())
+			pollSwitches();                     // Step / length / reverse switches
+		readExpanderResets();                   // Handle expander reset pulses
+
+		for (int c = 0; c < CHANNELS; c++) {
+			const ChannelIds& id = CHANNEL_IDS[c];
+			StepEngine::Track& track = tracks[c];
+			processToggles(c);
+
+			// One playhead per clock channel (an unpatched clock still has playhead 1, for resets and lights).
+			int heads = std::max(1, inputs[id.clock].getChannels());
+			uint32_t used = ALL_HEADS >> (HEADS - heads);
+
+			// Resets on playhead 1 also start a pending pattern.
+			if (uint32_t reset = resetPulses[c] & used) {
+				for (uint32_t r = reset; r; r &= r - 1) {
+					int i = __builtin_ctz(r);
+					gateTimes[c][i / 4][i % 4] = 0.f;
+				}
+				gateQueues[c].drop(reset);
+				track.reset(reset);
+				if (reset & 1) {
+					reseed(c);
+					if (songOn[c])
+						pending[c] = songs[c].restart();
+					if (pending[c] != pattern[c])
+						switchPattern(c);
+					if (songOn[c])
+						stageSong(c);
+				}
 			}
-			
-			if (latch_b[currentStepB]) {
-				gatePulseB.trigger(1e-3f); // 1 ms pulse
+
+			// Clock edges: next step (a new pattern starts on playhead 1's loop start), gates if it is on.
+			uint32_t clocked = 0;
+			for (int g = 0; g < heads; g += 4) {
+				simd::float_4 high = simd::ifelse(inputs[id.clock].getVoltageSimd<simd::float_4>(g) >= 1.f, 1.f, 0.f);
+				clocked |= uint32_t(simd::movemask(clockTriggers[c][g / 4].process(high))) << g;
+			}
+			clocked &= used;
+			if (clocked) {
+				for (uint32_t e = clocked; e; e &= e - 1)
+					periods[c][__builtin_ctz(e)].edge(now);
+				track.move(clocked);
+				if (track.atLoopStart(clocked) & 1) {
+					if (pending[c] != pattern[c])
+						switchPattern(c);
+					if (songOn[c]) {
+						songs[c].loop();
+						stageSong(c);
+					}
+				}
+				if (fillOn[c] && (clocked & 1)) {
+					if (track.atLoopStart(1))
+						drawFlips(c);
+					applyFill(c);
+				}
+				for (uint32_t f = track.firing(clocked); f; f &= f - 1) {
+					int i = __builtin_ctz(f);
+					if (chanceFires(c, track.current[i]))
+						scheduleGates(c, i, args.sampleTime);
+				}
+			}
+			if (gateQueues[c].count)
+				gateQueues[c].pop(now, [&](int i, float length) { openGate(c, i, length); });
+
+			outputs[id.output].setChannels(heads);
+			for (int g = 0; g < heads; g += 4) {
+				simd::float_4& t = gateTimes[c][g / 4];
+				outputs[id.output].setVoltageSimd(simd::ifelse(t > 0.f, 10.f, 0.f), g);
+				t = simd::fmax(t - args.sampleTime, 0.f);
 			}
 		}
-		
-		// B gate out
-		float gateOutB = gatePulseB.process(args.sampleTime) ? 10.f : 0.f;
-		outputs[OUT_2_OUTPUT].setVoltage(gateOutB);
 
-		// LED rings: highlight current steps (A & B)
-		int steps[2] = {currentStepA, currentStepB};
-		updateLedRings(steps);
+		if (lightDivider.process())
+			updateLights();                     // Step latch LEDs and playheads (A & B)
+		now++;
 	}
 };
 
+// Indexed at runtime, so C++11 needs definitions of these tables.
+constexpr TL_Seq4::ChannelIds TL_Seq4::CHANNEL_IDS[];
+constexpr TL_Seq4::ImportSound TL_Seq4::IMPORT_SOUND_LIST[];
+
 
 // --------------------   Widget / UI layout  ------------------------------------
 struct TL_Seq4Widget : ModuleWidget {
@@ -528,6 +1033,9 @@ struct TL_Seq4Widget : ModuleWidget {
 		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(83.588, 34.314)), module, TL_Seq4::REVERSE_1_INPUT));
 		// Output.
 		addOutput(createOutputCentered<DarkPJ301MPort>(mm2px(Vec(75.937, 18.496)), module, TL_Seq4::OUT_1_OUTPUT));
+		// Pattern and fill CV (both channels).
+		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(7.973, 52.133)), module, TL_Seq4::PATTERN_INPUT));
+		addInput(createInputCentered<PJ301MPort>(mm2px(Vec(83.588, 52.133)), module, TL_Seq4::FILL_INPUT));
 		// LEDs (ring).
 		addChild(createLightCentered<MediumLight<WhiteLight>>(mm2px(Vec(45.788, 14.285)), module, TL_Seq4::LED_A1_LIGHT));
 		addChild(createLightCentered<MediumLight<WhiteLight>>(mm2px(Vec(54.965, 18.117)), module, TL_Seq4::LED_A2_LIGHT));
@@ -614,8 +1122,230 @@ struct TL_Seq4Widget : ModuleWidget {
 
 
 	}
+
+	// Light refresh: fewer updates cost less CPU; the screen redraws at about 60 Hz anyway.
+	void appendContextMenu(Menu* menu) override {
+		TL_Seq4* module = static_cast<TL_Seq4*>(this->module);
+		float sampleRate = APP->engine->getSampleRate();
+
+		// Pattern bank: a new pattern starts at the next loop start (at once while no clock is patched).
+		menu->addChild(new MenuSeparator);
+		static const char* channelNames[TL_Seq4::CHANNELS] = {"Pattern A", "Pattern B"};
+		for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+			std::string right = string::f("%d", module->pattern[c] + 1);
+			if (module->inputs[TL_Seq4::PATTERN_INPUT].isConnected())
+				right += " (CV)";
+			menu->addChild(createSubmenuItem(channelNames[c], right, [=](Menu* menu) {
+				for (int p = 0; p < TL_Seq4::PATTERNS; p++) {
+					std::string used = module->bank[c][p] ? "●" : "";
+					menu->addChild(createCheckMenuItem(string::f("%d", p + 1), used,
+						[=]() { return module->selected[c] == p; },
+						[=]() { module->selected[c] = p; }));
+				}
+			}));
+		}
+
+		// Length and the page of steps shown on the switches (the ring marks the playhead on that page).
+		menu->addChild(new MenuSeparator);
+		static const char* lengthNames[TL_Seq4::CHANNELS] = {"Length A", "Length B"};
+		static const char* pageNames[TL_Seq4::CHANNELS] = {"Page A", "Page B"};
+		for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+			int switchSteps = TL_Seq4::CHANNEL_IDS[c].steps;
+			menu->addChild(createSubmenuItem(lengthNames[c], string::f("%d", module->tracks[c].length), [=](Menu* menu) {
+				menu->addChild(createCheckMenuItem(string::f("LENGTH switch (%d/%d)", switchSteps / 2, switchSteps), "",
+					[=]() { return module->customLength[c] == 0; },
+					[=]() { module->customLength[c] = 0; }));
+				for (int n = 1; n <= StepEngine::MAX_STEPS; n++) {
+					menu->addChild(createCheckMenuItem(string::f("%d", n), "",
+						[=]() { return module->customLength[c] == n; },
+						[=]() { module->customLength[c] = n; }));
+				}
+			}));
+			menu->addChild(createSubmenuItem(pageNames[c], string::f("%d", module->page[c] + 1), [=](Menu* menu) {
+				menu->addChild(createBoolPtrMenuItem("Follow playhead", "", &module->followPage[c]));
+				for (int p = 0; p < StepEngine::MAX_STEPS / switchSteps; p++) {
+					bool played = p * switchSteps < module->tracks[c].length;
+					menu->addChild(createCheckMenuItem(string::f("Steps %d-%d", p * switchSteps + 1, (p + 1) * switchSteps), played ? "" : "not played",
+						[=]() { return module->selectedPage[c] == p; },
+						[=]() { module->selectedPage[c] = p; module->followPage[c] = false; }));
+				}
+			}));
+		}
+
+		// Song chains: edited here, taken over by the engine at its next poll.
+		static const char* songNames[TL_Seq4::CHANNELS] = {"Song A", "Song B"};
+		for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+			menu->addChild(createSubmenuItem(songNames[c], module->songOn[c] ? "on" : "", [=](Menu* menu) {
+				menu->addChild(createCheckMenuItem("Song mode", "",
+					[=]() { return module->songOn[c]; },
+					[=]() {
+						module->songOn[c] = !module->songOn[c];
+						if (module->songOn[c])
+							module->songCued[c] = true;
+					}));
+				menu->addChild(new MenuSeparator);
+				const StepEngine::Chain& chain = module->songEdits[c];
+				for (int i = 0; i < chain.length; i++) {
+					bool playing = module->songOn[c] && module->songs[c].position == i;
+					std::string name = string::f("%d. Pattern %d, %d loop%s", i + 1, chain.pattern[i] + 1, chain.loops[i], chain.loops[i] == 1 ? "" : "s");
+					menu->addChild(createSubmenuItem(name, playing ? "▶" : "", [=](Menu* menu) {
+						auto edit = [=](std::function<void(StepEngine::Chain&)> change) {
+							change(module->songEdits[c]);
+							module->songEdited[c] = true;
+						};
+						menu->addChild(createSubmenuItem("Pattern", "", [=](Menu* menu) {
+							for (int p = 0; p < TL_Seq4::PATTERNS; p++) {
+								menu->addChild(createCheckMenuItem(string::f("%d", p + 1), module->bank[c][p] ? "●" : "",
+									[=]() { return module->songEdits[c].pattern[i] == p; },
+									[=]() { edit([=](StepEngine::Chain& chain) { chain.pattern[i] = p; }); }));
+							}
+						}));
+						menu->addChild(createSubmenuItem("Loops", "", [=](Menu* menu) {
+							for (int loops : {1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64}) {
+								menu->addChild(createCheckMenuItem(string::f("%d", loops), "",
+									[=]() { return module->songEdits[c].loops[i] == loops; },
+									[=]() { edit([=](StepEngine::Chain& chain) { chain.loops[i] = loops; }); }));
+							}
+						}));
+						menu->addChild(createMenuItem("Insert after", "", [=]() { edit([=](StepEngine::Chain& chain) { chain.insert(i); }); }));
+						menu->addChild(createMenuItem("Remove", "", [=]() { edit([=](StepEngine::Chain& chain) { chain.remove(i); }); }));
+					}));
+				}
+			}));
+		}
+
+		// Per-step chance and ratchet for the steps on the shown page.
+		static const char* stepNames[TL_Seq4::CHANNELS] = {"Step options A", "Step options B"};
+		for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+			menu->addChild(createSubmenuItem(stepNames[c], "", [=](Menu* menu) {
+				int switchSteps = TL_Seq4::CHANNEL_IDS[c].steps;
+				for (int i = 0; i < switchSteps; i++) {
+					int step = module->page[c] * switchSteps + i;
+					int p = module->pattern[c];  // Edits go to the pattern listed, even after a switch.
+					const StepEngine::StepLanes* lanes = &module->tracks[c].lanes;
+					menu->addChild(createSubmenuItem(string::f("Step %d", step + 1), stepOptionsText(*lanes, step), [=](Menu* menu) {
+						menu->addChild(createMenuLabel("Chance"));
+						for (int level = 0; level < StepEngine::CHANCE_LEVELS; level++) {
+							menu->addChild(createCheckMenuItem(chanceText(level), "",
+								[=]() { return lanes->chance.get(step) == level; },
+								[=]() { module->editLane(c, p, step, false, level); }));
+						}
+						menu->addChild(new MenuSeparator);
+						menu->addChild(createMenuLabel("Ratchet"));
+						for (int repeats = 0; repeats <= StepEngine::MAX_REPEATS; repeats++) {
+							menu->addChild(createCheckMenuItem(repeats ? string::f("%dx", repeats) : "Channel setting", "",
+								[=]() { return lanes->repeats.get(step) == repeats; },
+								[=]() { module->editLane(c, p, step, true, repeats); }));
+						}
+					}));
+				}
+			}));
+		}
+
+		// Timing: fractions of the measured clock period, per channel.
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createSubmenuItem("Timing", "", [=](Menu* menu) {
+			static const char* names[TL_Seq4::CHANNELS] = {"A", "B"};
+			for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+				const TL_Seq4::ChannelIds& id = TL_Seq4::CHANNEL_IDS[c];
+				if (c > 0)
+					menu->addChild(new MenuSeparator);
+				uint32_t period = module->periods[c][0].period();
+				std::string clock = period ? string::f("%.1f ms", 1000.f * period / sampleRate) : "no clock";
+				menu->addChild(createMenuLabel(string::f("%s clock period: %s", names[c], clock.c_str())));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.swing]));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.gateLength]));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.ratchet]));
+			}
+		}));
+
+		// Fill: Euclidean rhythm into the playing pattern, once or on every clock.
+		menu->addChild(createSubmenuItem("Fill", "", [=](Menu* menu) {
+			static const char* names[TL_Seq4::CHANNELS] = {"A", "B"};
+			for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+				const TL_Seq4::ChannelIds& id = TL_Seq4::CHANNEL_IDS[c];
+				if (c > 0)
+					menu->addChild(new MenuSeparator);
+				menu->addChild(createMenuLabel(names[c]));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.fillDensity]));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.fillRotate]));
+				menu->addChild(new ParamSlider(module->paramQuantities[id.fillMutate]));
+				menu->addChild(createBoolPtrMenuItem("Fill on every clock", "", &module->fillOn[c]));
+				menu->addChild(createMenuItem("Fill now", "", [=]() { module->fillRequest[c] = true; }));
+			}
+		}));
+
+		// MIDI import: one General MIDI drum sound per channel, into the patterns from the playing one on.
+		menu->addChild(createSubmenuItem("MIDI import", "", [=](Menu* menu) {
+			static const char* names[TL_Seq4::CHANNELS] = {"A sound", "B sound"};
+			for (int c = 0; c < TL_Seq4::CHANNELS; c++) {
+				menu->addChild(createSubmenuItem(names[c], TL_Seq4::IMPORT_SOUND_LIST[module->importSound[c]].name, [=](Menu* menu) {
+					for (int s = 0; s < TL_Seq4::IMPORT_SOUNDS; s++) {
+						menu->addChild(createCheckMenuItem(TL_Seq4::IMPORT_SOUND_LIST[s].name, "",
+							[=]() { return module->importSound[c] == s; },
+							[=]() { module->importSound[c] = s; }));
+					}
+				}));
+			}
+			menu->addChild(createMenuItem("Import MIDI file...", "", [=]() {
+				std::string path = pickFile();
+				if (!path.empty())
+					module->importFile(path);
+			}));
+			std::string status = module->getImportStatus();
+			if (!status.empty())
+				menu->addChild(createMenuLabel(status));
+		}));
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createMenuItem("New random seed", string::f("%08X", module->seed), [=]() {
+			module->seed = random::u32();
+			module->reseed();
+		}));
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createSubmenuItem("Light refresh", string::f("%.0f Hz", sampleRate / module->lightDivision), [=](Menu* menu) {
+			for (int division : {1, 64, 256, 1024}) {
+				std::string rate = (division == 1) ? "every sample" : string::f("%.0f Hz", sampleRate / division);
+				menu->addChild(createCheckMenuItem(string::f("Every %d samples", division), rate,
+					[=]() { return module->lightDivision == division; },
+					[=]() { module->setLightDivision(division); }));
+			}
+		}));
+	}
+
+	static std::string chanceText(int level) {
+		return string::f("%g%%", 100.f * (StepEngine::CHANCE_LEVELS - level) / StepEngine::CHANCE_LEVELS);
+	}
+
+	// "75% 2x" for a step with settings (empty for the defaults).
+	static std::string stepOptionsText(const StepEngine::StepLanes& lanes, int step) {
+		std::string text;
+		if (int level = lanes.chance.get(step))
+			text = chanceText(level);
+		if (int repeats = lanes.repeats.get(step))
+			text += string::f("%s%dx", text.empty() ? "" : " ", repeats);
+		return text;
+	}
+
+	struct ParamSlider : ui::Slider {
+		explicit ParamSlider(Quantity* q) {
+			quantity = q;
+			box.size.x = 200.f;
+		}
+	};
+
+	static std::string pickFile() {
+		osdialog_filters* filters = osdialog_filters_parse("MIDI (.mid .midi):mid,MID,midi,MIDI");
+		char* pathC = osdialog_file(OSDIALOG_OPEN, nullptr, nullptr, filters);
+		osdialog_filters_free(filters);
+		if (!pathC)
+			return "";
+		std::string path = pathC;
+		std::free(pathC);
+		return path;
+	}
 };
 
 
 Model* modelTL_Seq4 = createModel<TL_Seq4, TL_Seq4Widget>("TL_Seq4");
-extern Model* modelTL_Reseter;
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Packs 16-bit drum samples into the compressed headers under res/samples/.
+
+Lossless: per block of BLOCK samples, the best fixed predictor (order 0-3) and Rice
+parameter are picked, then the zigzagged residuals are written as Rice codes
+(MSB-first bit stream). Decoded by SampleBank::fromPacked (helpers/sample_bank.hpp).
+
+Usage: tools/pack_samples.py <input> <name> <output.h>
+  input: a 16-bit PCM mono .wav, or a header holding a plain int16 array (older kits).
+"""
+import re
+import struct
+import sys
+import wave
+
+BLOCK = 1024
+K_ZERO = 31  # Rice parameter code for a block of zero residuals.
+
+
+def read_samples(path):
+    if path.lower().endswith(".wav"):
+        with wave.open(path, "rb") as w:
+            if w.getsampwidth() != 2 or w.getnchannels() != 1:
+                sys.exit("expected 16-bit mono PCM: " + path)
+            frames = w.readframes(w.getnframes())
+        return list(struct.unpack("<%dh" % (len(frames) // 2), frames))
+    text = open(path).read()
+    body = text[text.index("{") + 1:text.rindex("}")]
+    return [int(v) for v in re.findall(r"-?\d+", body)]
+
+
+def predict(history, order):
+    x1, x2, x3 = history
+    return (0, x1, 2 * x1 - x2, 3 * x1 - 3 * x2 + x3)[order]
+
+
+def residuals(samples, start, end, history, order):
+    out = []
+    h = list(history)
+    for x in samples[start:end]:
+        out.append(x - predict(h, order))
+        h = [x, h[0], h[1]]
+    return out
+
+
+def zigzag(r):
+    return (r << 1) if r >= 0 else ((-r << 1) - 1)
+
+
+def rice_bits(values, k):
+    return sum((u >> k) + 1 + k for u in values)
+
+
+class BitWriter:
+    def __init__(self):
+        self.bytes = bytearray()
+        self.acc = 0
+        self.count = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.count += 1
+            if self.count == 8:
+                self.bytes.append(self.acc)
+                self.acc = 0
+                self.count = 0
+
+    def finish(self):
+        if self.count:
+            self.bytes.append(self.acc << (8 - self.count))
+        return bytes(self.bytes)
+
+
+def pack(samples):
+    bits = BitWriter()
+    history = (0, 0, 0)
+    for start in range(0, len(samples), BLOCK):
+        end = min(start + BLOCK, len(samples))
+        best = None
+        for order in range(4):
+            u = [zigzag(r) for r in residuals(samples, start, end, history, order)]
+            if not any(u):
+                best = (0, order, K_ZERO, u)
+                break
+            for k in range(17):
+                cost = rice_bits(u, k)
+                if best is None or cost < best[0]:
+                    best = (cost, order, k, u)
+        _, order, k, u = best
+        bits.write(order, 2)
+        bits.write(k, 5)
+        if k != K_ZERO:
+            for v in u:
+                q = v >> k
+                bits.write((1 << (q + 1)) - 2, q + 1)  # q ones, then a zero.
+                bits.write(v & ((1 << k) - 1), k)
+        block = samples[start:end]
+        history = tuple((list(reversed(block[-3:])) + list(history))[:3])
+    return bits.finish()
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    source, name, output = sys.argv[1:]
+    samples = read_samples(source)
+    packed = pack(samples)
+    guard = name.upper() + "_SAMPLE_H"
+    lines = [
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Generated by tools/pack_samples.py (lossless, decoded with SampleBank::fromPacked).",
+        "const int %s_sample_len = %d;" % (name, len(samples)),
+        "const int %s_packed_len = %d;" % (name, len(packed)),
+        "const uint8_t %s_packed[] = {" % name,
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("    " + " ".join("0x%02x," % b for b in packed[i:i + 16]))
+    lines += ["};", "", "#endif // %s" % guard, ""]
+    open(output, "w").write("\n".join(lines))
+    print("%s: %d samples, %d -> %d bytes" % (name, len(samples), 2 * len(samples), len(packed)))
+
+
+if __name__ == "__main__":
+    main()